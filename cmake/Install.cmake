@@ -360,6 +360,8 @@ if( APPLE )
   install(PROGRAMS "${CMAKE_BINARY_DIR}/scripts/runenergyplus" DESTINATION "./")
   install(PROGRAMS scripts/runepmacro DESTINATION "./")
   install(PROGRAMS scripts/runreadvars DESTINATION "./")
+  install(PROGRAMS scripts/runparallel DESTINATION "./")
+  install(PROGRAMS scripts/runparametric DESTINATION "./")
 
   configure_file("${PROJECT_SOURCE_DIR}/cmake/darwinpostflight.sh.in" ${CMAKE_BINARY_DIR}/darwinpostflight.sh)
   set(CPACK_POSTFLIGHT_SCRIPT "${CMAKE_BINARY_DIR}/darwinpostflight.sh")
@@ -390,6 +392,8 @@ if( UNIX AND NOT APPLE )
   install(PROGRAMS "${CMAKE_BINARY_DIR}/scripts/runenergyplus" DESTINATION "./")
   install(PROGRAMS scripts/runepmacro DESTINATION "./")
   install(PROGRAMS scripts/runreadvars DESTINATION "./")
+  install(PROGRAMS scripts/runparallel DESTINATION "./")
+  install(PROGRAMS scripts/runparametric DESTINATION "./")
 endif()
 
 configure_file("${CMAKE_SOURCE_DIR}/cmake/CMakeCPackOptions.cmake.in"
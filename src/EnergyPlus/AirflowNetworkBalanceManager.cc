@@ -126,6 +126,8 @@ namespace AirflowNetworkBalanceManager {
 	using AirflowNetworkSolver::InitAirflowNetworkData;
 	using AirflowNetworkSolver::NetworkNumOfLinks;
 	using AirflowNetworkSolver::NetworkNumOfNodes;
+	using AirflowNetworkSolver::NumOfSolverIterations;
+	using AirflowNetworkSolver::NumOfFactorizations;
 	using CurveManager::GetCurveIndex;
 	using CurveManager::GetCurveType;
 	using CurveManager::CurveValue;
@@ -169,6 +171,7 @@ namespace AirflowNetworkBalanceManager {
 	int const ProbNoAction( 0 ); // No action from probability check
 	int const ProbForceChange( 1 ); // Force open or close from probability check
 	int const ProbKeepStatus( 2 ); // Keep status at the previous time step from probability check
+	int const MinNodesByElimination( 50 ); // Networks with at least this many nodes are solved by elimination (MRXSLV)
 	static std::string const BlankString;
 
 	// DERIVED TYPE DEFINITIONS:
@@ -853,6 +856,7 @@ namespace AirflowNetworkBalanceManager {
 		}
 
 		if ( !lAlphaBlanks( 8 ) && SameString( Alphas( 8 ), "Yes" ) ) AirflowNetworkSimu.TExtHeightDep = true;
+		if ( !lAlphaBlanks( 9 ) && SameString( Alphas( 9 ), "Reuse" ) ) AirflowNetworkSimu.ReuseJacobian = true;
 
 		if ( SimObjectError ) {
 			ShowFatalError( RoutineName + "Errors found getting " + CurrentModuleObject + " object. Previous error(s) cause program termination." );
@@ -3497,6 +3501,8 @@ namespace AirflowNetworkBalanceManager {
 				SetupOutputVariable( "AFN Node Wind Pressure [Pa]", AirflowNetworkNodeSimu( i ).PZ, "System", "Average", AirflowNetworkNodeData( i ).Name );
 			}
 		}
+		SetupOutputVariable( "AFN Solver Iterations []", NumOfSolverIterations, "System", "Average", AirflowNetworkSimu.AirflowNetworkSimuName );
+		SetupOutputVariable( "AFN Solver Jacobian Factorizations []", NumOfFactorizations, "System", "Average", AirflowNetworkSimu.AirflowNetworkSimuName );
 
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			if ( ! ( SupplyFanType == FanType_SimpleOnOff && i <= AirflowNetworkNumOfSurfaces ) ) {
@@ -4130,7 +4136,6 @@ namespace AirflowNetworkBalanceManager {
 		Real64 DirSign;
 		Real64 Tamb;
 		Real64 CpAir;
-		Real64 TZON;
 		Real64 load;
 		int ZoneNum;
 		bool found;
@@ -4341,16 +4346,12 @@ namespace AirflowNetworkBalanceManager {
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balance
+		MRXSLV( AirflowNetworkNumOfNodes );
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			TZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				TZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).TZ = TZON;
+			AirflowNetworkNodeSimu( i ).TZ = MV( i );
 		}
 
 	}
@@ -4403,7 +4404,6 @@ namespace AirflowNetworkBalanceManager {
 		Real64 Ei;
 		Real64 DirSign;
 		Real64 Wamb;
-		Real64 WZON;
 		Real64 load;
 		int ZoneNum;
 		bool found;
@@ -4602,16 +4602,12 @@ namespace AirflowNetworkBalanceManager {
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balance
+		MRXSLV( AirflowNetworkNumOfNodes );
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			WZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				WZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).WZ = WZON;
+			AirflowNetworkNodeSimu( i ).WZ = MV( i );
 		}
 
 	}
@@ -4660,7 +4656,6 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
 		bool found;
 		bool OANode;
@@ -4815,16 +4810,12 @@ namespace AirflowNetworkBalanceManager {
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balance
+		MRXSLV( AirflowNetworkNumOfNodes );
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).CO2Z = COZN;
+			AirflowNetworkNodeSimu( i ).CO2Z = MV( i );
 		}
 
 	}
@@ -4873,7 +4864,6 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
 		bool found;
 		bool OANode;
@@ -5028,16 +5018,12 @@ namespace AirflowNetworkBalanceManager {
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balance
+		MRXSLV( AirflowNetworkNumOfNodes );
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).GCZ = COZN;
+			AirflowNetworkNodeSimu( i ).GCZ = MV( i );
 		}
 
 	}
@@ -5141,6 +5127,124 @@ namespace AirflowNetworkBalanceManager {
 		//   ########################################################### END
 	}
 
+	void
+	MRXSLV( int const NORDER )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct. 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine solves the node balance [MA]{X} = {MV} and returns {X} in {MV}
+
+		// METHODOLOGY EMPLOYED:
+		// Networks with fewer than MinNodesByElimination nodes are solved with the inverse matrix
+		// from MRXINV.  Larger networks are solved by Gaussian elimination with partial pivoting.
+		// A node only shares links with a few other nodes, so the rows of [MA] are mostly zero:
+		// zero multipliers are skipped and each row update only visits the nonzero entries of
+		// the pivot row.  The cost then grows with the fill-in instead of the cube of NORDER.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		int K;
+		int M;
+		int NNZ; // Number of nonzero entries right of the diagonal in the pivot row
+		Real64 R1;
+		Real64 S;
+
+		if ( NORDER < MinNodesByElimination ) {
+			Array1D< Real64 > X( NORDER );
+			MRXINV( NORDER );
+			for ( i = 1; i <= NORDER; ++i ) {
+				S = 0.0;
+				for ( j = 1; j <= NORDER; ++j ) {
+					S += MA( ( i - 1 ) * NORDER + j ) * MV( j );
+				}
+				X( i ) = S;
+			}
+			for ( i = 1; i <= NORDER; ++i ) {
+				MV( i ) = X( i );
+			}
+			return;
+		}
+
+		Array1D_int NZ( NORDER ); // Columns of the nonzero entries in the pivot row
+		for ( i = 1; i <= NORDER; ++i ) {
+			// Pivot row: largest entry in column i
+			M = i;
+			R1 = std::abs( MA( ( i - 1 ) * NORDER + i ) );
+			for ( j = i + 1; j <= NORDER; ++j ) {
+				if ( std::abs( MA( ( j - 1 ) * NORDER + i ) ) > R1 ) {
+					M = j;
+					R1 = std::abs( MA( ( j - 1 ) * NORDER + i ) );
+				}
+			}
+			if ( R1 == 0.0 ) {
+				ShowFatalError( "MRXSLV: The AirflowNetwork node balance matrix is singular at node " + AirflowNetworkNodeData( i ).Name );
+			}
+			if ( M != i ) {
+				for ( K = i; K <= NORDER; ++K ) {
+					S = MA( ( i - 1 ) * NORDER + K );
+					MA( ( i - 1 ) * NORDER + K ) = MA( ( M - 1 ) * NORDER + K );
+					MA( ( M - 1 ) * NORDER + K ) = S;
+				}
+				S = MV( i );
+				MV( i ) = MV( M );
+				MV( M ) = S;
+			}
+			NNZ = 0;
+			for ( K = i + 1; K <= NORDER; ++K ) {
+				if ( MA( ( i - 1 ) * NORDER + K ) != 0.0 ) {
+					++NNZ;
+					NZ( NNZ ) = K;
+				}
+			}
+			// Eliminate column i below the pivot
+			S = MA( ( i - 1 ) * NORDER + i );
+			for ( j = i + 1; j <= NORDER; ++j ) {
+				R1 = MA( ( j - 1 ) * NORDER + i );
+				if ( R1 == 0.0 ) continue;
+				R1 /= S;
+				MA( ( j - 1 ) * NORDER + i ) = 0.0;
+				for ( K = 1; K <= NNZ; ++K ) {
+					MA( ( j - 1 ) * NORDER + NZ( K ) ) -= R1 * MA( ( i - 1 ) * NORDER + NZ( K ) );
+				}
+				MV( j ) -= R1 * MV( i );
+			}
+		}
+		// Back substitution
+		for ( i = NORDER; i >= 1; --i ) {
+			S = MV( i );
+			for ( K = i + 1; K <= NORDER; ++K ) {
+				S -= MA( ( i - 1 ) * NORDER + K ) * MV( K );
+			}
+			MV( i ) = S / MA( ( i - 1 ) * NORDER + i );
+		}
+
+	}
+
 	void
 	ReportAirflowNetwork()
 	{
@@ -24,6 +24,7 @@ namespace AirflowNetworkBalanceManager {
 	extern int const VentCtrNum_ZoneLevel; // ZoneLevel control for a heat transfer subsurface
 	extern int const VentCtrNum_AdjTemp; // Temperature venting control based on adjacent zone conditions
 	extern int const VentCtrNum_AdjEnth; // Enthalpy venting control based on adjacent zone conditions
+	extern int const MinNodesByElimination; // Networks with at least this many nodes are solved by elimination (MRXSLV)
 
 	// DERIVED TYPE DEFINITIONS:
 	// Report variables
@@ -206,6 +207,9 @@ namespace AirflowNetworkBalanceManager {
 	void
 	MRXINV( int const NORDER );
 
+	void
+	MRXSLV( int const NORDER );
+
 	void
 	ReportAirflowNetwork();
 
@@ -77,6 +77,7 @@ namespace AirflowNetworkSolver {
 	int NetworkNumOfNodes( 0 );
 
 	int const NrInt( 20 ); // Number of intervals for a large opening
+	Real64 const JacobianReuseRatio( 0.5 ); // Residual ratio of two iterations above which a reused Jacobian is factored again
 
 	static std::string const BlankString;
 
@@ -101,10 +102,15 @@ namespace AirflowNetworkSolver {
 	Array1D< Real64 > PZ; // Pressure [Pa]
 
 	// Other array variables
-	Array1D_int ID;
+	Array1D_int ID; // Position of each node in the skyline matrix [A]
 	Array1D_int IK;
 	Array1D< Real64 > AD;
 	Array1D< Real64 > AU;
+	Array1D< Real64 > ADF; // Factored main diagonal kept for reuse
+	Array1D< Real64 > AUF; // Factored upper triangle kept for reuse
+	int NumOfFactoredNodes( 0 ); // Number of nodes of the kept factorization (0 if none)
+	int NumOfSolverIterations( 0 ); // Iterations of the last solution
+	int NumOfFactorizations( 0 ); // Jacobian factorizations of the last solution
 
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
 	Array1D_int newIK; // noel
@@ -222,9 +228,6 @@ namespace AirflowNetworkSolver {
 			gio::open( Unit21, DataStringGlobals::outputAdsFileName );
 		}
 
-		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
-			ID( n ) = n;
-		}
 		for ( i = 1; i <= NetworkNumOfLinks; ++i ) {
 			AFECTL( i ) = 1.0;
 			AFLOW( i ) = 0.0;
@@ -292,6 +295,11 @@ namespace AirflowNetworkSolver {
 		// noel, GNU says the AU is indexed above its upper bound
 		//ALLOCATE(AU(IK(NetworkNumOfNodes+1)-1))
 		AU.allocate( IK( NetworkNumOfNodes + 1 ) );
+		if ( AirflowNetworkSimu.ReuseJacobian ) {
+			ADF.allocate( NetworkNumOfNodes );
+			AUF.allocate( IK( NetworkNumOfNodes + 1 ) );
+		}
+		NumOfFactoredNodes = 0;
 
 	}
 
@@ -332,12 +340,8 @@ namespace AirflowNetworkSolver {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int i;
-		int n;
 
 		// FLOW:
-		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
-			ID( n ) = n;
-		}
 		for ( i = 1; i <= NetworkNumOfLinks; ++i ) {
 			AFECTL( i ) = 1.0;
 			AFLOW( i ) = 0.0;
@@ -352,6 +356,159 @@ namespace AirflowNetworkSolver {
 
 	}
 
+	void
+	SETORD()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct. 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets up the "ID" array, the position of each node in the skyline
+		//     matrix [A], so the profile of [A] is small.
+
+		// METHODOLOGY EMPLOYED:
+		// Reverse Cuthill-McKee ordering of the graph of the nodes with unknown pressure: each
+		// connected part is searched breadth first from a node of least degree, the neighbours
+		// of a node being taken in increasing degree, and the order found is reversed.  Fixed
+		// pressure nodes have no off-diagonal entries and go first.
+		// The multizone nodes are ordered separately and keep the leading positions, so [A]
+		// of the multizone network alone (distribution system off) is the leading block.
+
+		// REFERENCES:
+		// A. George and J. W. Liu, Computer Solution of Large Sparse Positive Definite Systems, 1981.
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// NADJ(K) - pointer to the first neighbour of node "K" in "ADJ".
+		Array1D_int NADJ( NetworkNumOfNodes + 1 );
+		Array1D_int ADJ( 2 * NetworkNumOfLinks );
+		Array1D_int NEXT( NetworkNumOfNodes ); // Next free slot of each node in "ADJ"
+		Array1D_int ORD( NetworkNumOfNodes ); // Nodes in Cuthill-McKee order
+		int i;
+		int j;
+		int k;
+		int L;
+		int M;
+		int NFIRST; // First node of the group being ordered
+		int NLAST; // Last node of the group being ordered
+		int NFIX; // Number of fixed pressure nodes
+		int NORD; // Number of nodes ordered
+		int IHEAD; // Next node of "ORD" to search from
+		int ISTART;
+		int NMZ; // Number of multizone nodes
+
+		// FLOW:
+		NMZ = min( NumOfNodesMultiZone, NetworkNumOfNodes );
+		// Count the neighbours of each node.
+		NADJ = 0;
+		for ( M = 1; M <= NetworkNumOfLinks; ++M ) {
+			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
+			if ( i == 0 || j == 0 || i == j ) continue;
+			if ( AirflowNetworkNodeData( i ).NodeTypeNum == 1 || AirflowNetworkNodeData( j ).NodeTypeNum == 1 ) continue;
+			if ( ( i <= NMZ ) != ( j <= NMZ ) ) continue;
+			++NADJ( i );
+			++NADJ( j );
+		}
+		// Convert counts to pointers and fill in the neighbours.
+		j = NADJ( 1 );
+		NADJ( 1 ) = 1;
+		for ( k = 1; k <= NetworkNumOfNodes; ++k ) {
+			i = NADJ( k + 1 );
+			NADJ( k + 1 ) = NADJ( k ) + j;
+			j = i;
+		}
+		for ( k = 1; k <= NetworkNumOfNodes; ++k ) {
+			NEXT( k ) = NADJ( k );
+		}
+		for ( M = 1; M <= NetworkNumOfLinks; ++M ) {
+			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
+			if ( i == 0 || j == 0 || i == j ) continue;
+			if ( AirflowNetworkNodeData( i ).NodeTypeNum == 1 || AirflowNetworkNodeData( j ).NodeTypeNum == 1 ) continue;
+			if ( ( i <= NMZ ) != ( j <= NMZ ) ) continue;
+			ADJ( NEXT( i ) ) = j;
+			++NEXT( i );
+			ADJ( NEXT( j ) ) = i;
+			++NEXT( j );
+		}
+
+		for ( k = 1; k <= NetworkNumOfNodes; ++k ) {
+			ID( k ) = 0; // Not yet ordered
+		}
+		NFIRST = 1;
+		NLAST = NMZ;
+		while ( NFIRST <= NetworkNumOfNodes ) {
+			// Fixed pressure nodes first, in input order.
+			NFIX = 0;
+			for ( k = NFIRST; k <= NLAST; ++k ) {
+				if ( AirflowNetworkNodeData( k ).NodeTypeNum == 1 ) {
+					ID( k ) = NFIRST + NFIX;
+					++NFIX;
+				}
+			}
+
+			// Breadth first search of each connected part from a node of least degree.
+			NORD = 0;
+			IHEAD = 1;
+			while ( NFIX + NORD <= NLAST - NFIRST ) {
+				ISTART = 0;
+				for ( k = NFIRST; k <= NLAST; ++k ) {
+					if ( ID( k ) != 0 ) continue;
+					if ( ISTART == 0 || NADJ( k + 1 ) - NADJ( k ) < NADJ( ISTART + 1 ) - NADJ( ISTART ) ) ISTART = k;
+				}
+				++NORD;
+				ORD( NORD ) = ISTART;
+				ID( ISTART ) = -1;
+				while ( IHEAD <= NORD ) {
+					k = ORD( IHEAD );
+					++IHEAD;
+					M = NORD; // Neighbours of "K" are added after "M", sorted by degree
+					for ( L = NADJ( k ); L < NADJ( k + 1 ); ++L ) {
+						j = ADJ( L );
+						if ( ID( j ) != 0 ) continue;
+						ID( j ) = -1;
+						++NORD;
+						i = NORD;
+						while ( i > M + 1 && NADJ( ORD( i - 1 ) + 1 ) - NADJ( ORD( i - 1 ) ) > NADJ( j + 1 ) - NADJ( j ) ) {
+							ORD( i ) = ORD( i - 1 );
+							--i;
+						}
+						ORD( i ) = j;
+					}
+				}
+			}
+
+			// Reverse the order after the fixed pressure nodes.
+			for ( k = 1; k <= NORD; ++k ) {
+				ID( ORD( k ) ) = NLAST + 1 - k;
+			}
+
+			// Then the distribution system nodes.
+			NFIRST = NLAST + 1;
+			NLAST = NetworkNumOfNodes;
+		}
+
+	}
+
 	void
 	SETSKY()
 	{
@@ -359,6 +516,7 @@ namespace AirflowNetworkSolver {
 		//       AUTHOR         George Walton
 		//       DATE WRITTEN   1998
 		//       MODIFIED       Feb. 2006 (L. Gu) to meet requirements of AirflowNetwork
+		//                      Oct. 2026 Node ordering and fixed pressure nodes
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -366,7 +524,9 @@ namespace AirflowNetworkSolver {
 		//     form by using the location matrix.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The nodes are first ordered by SETORD so the skyline profile (and the fill-in of the
+		// factorization) is small.  Links to fixed pressure nodes never put an entry in [A]
+		// (see FILJAC), so they do not add to the column heights.
 
 		// REFERENCES:
 		// AIRNET
@@ -398,6 +558,7 @@ namespace AirflowNetworkSolver {
 		int N2;
 
 		// FLOW:
+		SETORD();
 		// Initialize "IK".
 		for ( i = 1; i <= NetworkNumOfNodes + 1; ++i ) {
 			IK( i ) = 0;
@@ -406,8 +567,9 @@ namespace AirflowNetworkSolver {
 		for ( M = 1; M <= NetworkNumOfLinks; ++M ) {
 			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
 			if ( j == 0 ) continue;
-			L = ID( j );
 			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			if ( AirflowNetworkNodeData( i ).NodeTypeNum == 1 || AirflowNetworkNodeData( j ).NodeTypeNum == 1 ) continue;
+			L = ID( j );
 			k = ID( i );
 			N1 = std::abs( L - k );
 			N2 = max( k, L );
@@ -507,6 +669,7 @@ namespace AirflowNetworkSolver {
 		PStack();
 
 		SOLVZP( IK, AD, AU, ITER );
+		NumOfSolverIterations = ITER;
 
 		// Report element flows and zone pressures.
 		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
@@ -650,6 +813,7 @@ namespace AirflowNetworkSolver {
 		Real64 ACC0;
 		Real64 ACC1;
 		Array1D< Real64 > CCF( NetworkNumOfNodes );
+		Array1D< Real64 > B( NetworkNumOfNodes ); // Right hand side and solution in the node order of [A]
 
 		// Formats
 		static gio::Fmt Format_901( "(A5,I3,2E14.6,0P,F8.4,F24.14)" );
@@ -661,6 +825,7 @@ namespace AirflowNetworkSolver {
 		NNZE = IK( NetworkNumOfNodes + 1 ) - 1;
 		if ( LIST >= 2 ) gio::write( Unit21, fmtLD ) << "Initialization" << NetworkNumOfNodes << NetworkNumOfLinks << NNZE;
 		ITER = 0;
+		NumOfFactorizations = 0;
 
 		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 			PCF( n ) = 0.0;
@@ -682,13 +847,20 @@ namespace AirflowNetworkSolver {
 				DUMPVR( "AF:", SUMF, NetworkNumOfNodes, Unit21 );
 			}
 			// Solve linear system for approximate PZ.
+			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+				B( ID( n ) ) = PZ( n );
+			}
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
 			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, PZ, newIK, NetworkNumOfNodes, NSYM ); //noel
+			SLVSKY( newAU, AD, newAU, B, newIK, NetworkNumOfNodes, NSYM ); //noel
 #else
 			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, PZ, IK, NetworkNumOfNodes, NSYM );
+			SLVSKY( AU, AD, AU, B, IK, NetworkNumOfNodes, NSYM );
 #endif
+			++NumOfFactorizations;
+			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+				PZ( n ) = B( ID( n ) );
+			}
 			if ( LIST >= 2 ) DUMPVD( "PZ:", PZ, NetworkNumOfNodes, Unit21 );
 		}
 		// Solve nonlinear airflow network equations by modified Newton's method.
@@ -727,15 +899,33 @@ namespace AirflowNetworkSolver {
 			}
 			// Solve AA * CCF = SUMF.
 			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
-				CCF( n ) = SUMF( n );
+				B( ID( n ) ) = SUMF( n );
 			}
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
 			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, CCF, newIK, NetworkNumOfNodes, NSYM ); //noel
+			SLVSKY( newAU, AD, newAU, B, newIK, NetworkNumOfNodes, NSYM ); //noel
+			++NumOfFactorizations;
 #else
-			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, CCF, IK, NetworkNumOfNodes, NSYM );
+			if ( AirflowNetworkSimu.ReuseJacobian ) {
+				// Keep the factored Jacobian of earlier iterations (and time steps) while the residual
+				// falls fast enough: The Newton step is then taken with the old Jacobian.
+				if ( NumOfFactoredNodes != NetworkNumOfNodes || ( ITER > 1 && ACC1 > JacobianReuseRatio * ACC0 ) ) {
+					FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
+					++NumOfFactorizations;
+					ADF = AD;
+					AUF = AU;
+					NumOfFactoredNodes = NetworkNumOfNodes;
+				}
+				SLVSKY( AUF, ADF, AUF, B, IK, NetworkNumOfNodes, NSYM );
+			} else {
+				FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
+				SLVSKY( AU, AD, AU, B, IK, NetworkNumOfNodes, NSYM );
+				++NumOfFactorizations;
+			}
 #endif
+			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+				CCF( n ) = B( ID( n ) );
+			}
 			// Revise PZ (Steffensen iteration on the N-R correction factors to handle oscillating corrections).
 			if ( ACCEL == 1 ) {
 				ACCEL = 0;
@@ -860,9 +1050,9 @@ namespace AirflowNetworkSolver {
 			SUMF( n ) = 0.0;
 			SUMAF( n ) = 0.0;
 			if ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ) {
-				AD( n ) = 1.0;
+				AD( ID( n ) ) = 1.0;
 			} else {
-				AD( n ) = 0.0;
+				AD( ID( n ) ) = 0.0;
 			}
 		}
 		for ( n = 1; n <= NNZE; ++n ) {
@@ -3670,8 +3860,8 @@ Label90: ;
 		// FLOW:
 		// K = row number, L = column number.
 		if ( FLAG > 1 ) {
-			k = LM( 1 );
-			L = LM( 2 );
+			k = ID( LM( 1 ) );
+			L = ID( LM( 2 ) );
 			if ( FLAG == 4 ) {
 				AD( k ) += X( 1 );
 				if ( k < L ) {
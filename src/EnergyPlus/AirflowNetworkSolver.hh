@@ -20,6 +20,7 @@ namespace AirflowNetworkSolver {
 	extern int NetworkNumOfNodes;
 
 	extern int const NrInt; // Number of intervals for a large opening
+	extern Real64 const JacobianReuseRatio; // Residual ratio of two iterations above which a reused Jacobian is factored again
 
 	// Common block AFEDAT
 	extern Array1D< Real64 > AFECTL;
@@ -42,10 +43,15 @@ namespace AirflowNetworkSolver {
 	extern Array1D< Real64 > PZ; // Pressure [Pa]
 
 	// Other array variables
-	extern Array1D_int ID;
+	extern Array1D_int ID; // Position of each node in the skyline matrix [A]
 	extern Array1D_int IK;
 	extern Array1D< Real64 > AD;
 	extern Array1D< Real64 > AU;
+	extern Array1D< Real64 > ADF; // Factored main diagonal kept for reuse
+	extern Array1D< Real64 > AUF; // Factored upper triangle kept for reuse
+	extern int NumOfFactoredNodes; // Number of nodes of the kept factorization (0 if none)
+	extern int NumOfSolverIterations; // Iterations of the last solution
+	extern int NumOfFactorizations; // Jacobian factorizations of the last solution
 
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
 	extern Array1D_int newIK; // noel
@@ -71,6 +77,9 @@ namespace AirflowNetworkSolver {
 	void
 	InitAirflowNetworkData();
 
+	void
+	SETORD();
+
 	void
 	SETSKY();
 
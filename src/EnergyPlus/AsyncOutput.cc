@@ -0,0 +1,263 @@
+// C++ Headers
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// EnergyPlus Headers
+#include <AsyncOutput.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace AsyncOutput {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// This module moves the disk writes of the large output files (eplusout.eso and eplusout.mtr)
+	// off the simulation thread, so a slow file system does not show up as simulation time.
+
+	// METHODOLOGY EMPLOYED:
+	// The stream buffer of an output stream is replaced by one that collects the characters in
+	// large chunks.  Full chunks go on a bounded queue that a writer thread empties into the
+	// original stream buffer, so everything written to the stream (report data, time stamps and
+	// the lines that go through gio) keeps its order.  The simulation only waits when the queue
+	// is full.  Chunk buffers are recycled between the two threads.
+	// Flushes of the stream do not hand over the partial chunk: the writer would otherwise get
+	// a chunk for each record.  The data reaches the file when a chunk is full or the output is
+	// stopped (StopAsyncOutput), which must happen before the gio unit is closed.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const ChunkSize( 262144 ); // Characters collected before a chunk is handed to the writer thread
+	int const MaxQueuedChunks( 64 ); // Chunks waiting for the writer thread before the simulation waits
+
+	// Stream buffer that hands its output to a writer thread
+	class AsyncStreamBuf : public std::streambuf
+	{
+
+	public: // Creation
+
+		explicit
+		AsyncStreamBuf( std::streambuf * target ) :
+			target_( target ),
+			chunk_( ChunkSize ),
+			stop_( false ),
+			failed_( false ),
+			writer_( &AsyncStreamBuf::write_chunks, this )
+		{
+			setp( chunk_.data(), chunk_.data() + chunk_.size() );
+		}
+
+		~AsyncStreamBuf()
+		{
+			finish();
+		}
+
+	public: // Properties
+
+		// Stream buffer the output is written to
+		std::streambuf *
+		target() const
+		{
+			return target_;
+		}
+
+		// Writes to the target stream buffer failed?
+		bool
+		failed() const
+		{
+			return failed_;
+		}
+
+	public: // Methods
+
+		// Hand over the partial chunk, wait for the writer thread to finish and flush the target
+		void
+		finish()
+		{
+			if ( ! writer_.joinable() ) return;
+			hand_off();
+			{
+				std::lock_guard< std::mutex > lock( mutex_ );
+				stop_ = true;
+			}
+			not_empty_.notify_one();
+			writer_.join();
+			if ( target_->pubsync() != 0 ) failed_ = true;
+		}
+
+	protected: // std::streambuf
+
+		int_type
+		overflow( int_type c ) override
+		{
+			hand_off();
+			if ( ! traits_type::eq_int_type( c, traits_type::eof() ) ) {
+				*pptr() = traits_type::to_char_type( c );
+				pbump( 1 );
+			}
+			return traits_type::not_eof( c );
+		}
+
+		int
+		sync() override
+		{
+			return 0; // Partial chunk is kept (see module notes)
+		}
+
+	private: // Methods
+
+		// Queue the characters collected so far and start a new chunk
+		void
+		hand_off()
+		{
+			std::size_t const n( pptr() - pbase() );
+			if ( n == 0u ) return;
+			chunk_.resize( n );
+			{
+				std::unique_lock< std::mutex > lock( mutex_ );
+				not_full_.wait( lock, [ this ]{ return queue_.size() < std::size_t( MaxQueuedChunks ); } );
+				queue_.push_back( std::move( chunk_ ) );
+				if ( ! spare_.empty() ) {
+					chunk_ = std::move( spare_.back() );
+					spare_.pop_back();
+				} else {
+					chunk_ = std::vector< char >();
+				}
+			}
+			not_empty_.notify_one();
+			chunk_.resize( ChunkSize );
+			setp( chunk_.data(), chunk_.data() + chunk_.size() );
+		}
+
+		// Writer thread: write queued chunks until stopped and the queue is empty
+		void
+		write_chunks()
+		{
+			std::vector< char > chunk;
+			while ( true ) {
+				{
+					std::unique_lock< std::mutex > lock( mutex_ );
+					if ( chunk.capacity() > 0u ) spare_.push_back( std::move( chunk ) );
+					not_empty_.wait( lock, [ this ]{ return stop_ || ! queue_.empty(); } );
+					if ( queue_.empty() ) return; // Stopped and done
+					chunk = std::move( queue_.front() );
+					queue_.pop_front();
+				}
+				not_full_.notify_one();
+				std::streamsize const n( chunk.size() );
+				if ( target_->sputn( chunk.data(), n ) != n ) failed_ = true;
+			}
+		}
+
+	private: // Data
+
+		std::streambuf * target_; // Stream buffer the output is written to
+		std::vector< char > chunk_; // Chunk being filled (put area)
+		std::deque< std::vector< char > > queue_; // Chunks waiting for the writer thread
+		std::vector< std::vector< char > > spare_; // Written chunks for reuse
+		std::mutex mutex_; // Guards queue_, spare_ and stop_
+		std::condition_variable not_empty_; // Signals the writer thread
+		std::condition_variable not_full_; // Signals the simulation thread
+		bool stop_; // No more chunks will be queued
+		bool failed_; // Writes to the target failed
+		std::thread writer_; // Writer thread (last so the other members are ready when it starts)
+
+	}; // AsyncStreamBuf
+
+	// MODULE VARIABLE DECLARATIONS:
+	static std::vector< std::pair< std::ostream *, std::unique_ptr< AsyncStreamBuf > > > AsyncStreams; // Streams with a writer thread
+
+	// Functions
+
+	void
+	StartAsyncOutput( std::ostream * out_stream_p ) // Output stream pointer
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gives an output stream a writer thread, so writes to it no longer wait for the disk.
+
+		if ( ! out_stream_p ) return;
+		for ( auto const & AsyncStream : AsyncStreams ) {
+			if ( AsyncStream.first == out_stream_p ) return; // Already started
+		}
+
+		std::unique_ptr< AsyncStreamBuf > buf( new AsyncStreamBuf( out_stream_p->rdbuf() ) );
+		out_stream_p->rdbuf( buf.get() );
+		AsyncStreams.emplace_back( out_stream_p, std::move( buf ) );
+
+	}
+
+	void
+	StopAsyncOutput( std::ostream * out_stream_p ) // Output stream pointer
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the remaining output of a stream, stops its writer thread and gives the stream
+		// back its own stream buffer.  Must be called before the stream is closed.
+
+		for ( auto i = AsyncStreams.begin(); i != AsyncStreams.end(); ++i ) {
+			if ( i->first != out_stream_p ) continue;
+			AsyncStreamBuf & buf( *i->second );
+			buf.finish();
+			out_stream_p->rdbuf( buf.target() );
+			if ( buf.failed() ) {
+				ShowWarningError( "StopAsyncOutput: Errors occurred writing an output file; it may be incomplete." );
+			}
+			AsyncStreams.erase( i );
+			return;
+		}
+
+	}
+
+	void
+	StopAllAsyncOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stops the writer threads of all streams (e.g. before the files are closed on a fatal error).
+
+		while ( ! AsyncStreams.empty() ) {
+			StopAsyncOutput( AsyncStreams.back().first );
+		}
+
+	}
+
+} // AsyncOutput
+
+} // EnergyPlus
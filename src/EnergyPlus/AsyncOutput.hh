@@ -0,0 +1,34 @@
+#ifndef AsyncOutput_hh_INCLUDED
+#define AsyncOutput_hh_INCLUDED
+
+// C++ Headers
+#include <iosfwd>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace AsyncOutput {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const ChunkSize; // Characters collected before a chunk is handed to the writer thread
+	extern int const MaxQueuedChunks; // Chunks waiting for the writer thread before the simulation waits
+
+	// Functions
+
+	void
+	StartAsyncOutput( std::ostream * out_stream_p ); // Output stream pointer
+
+	void
+	StopAsyncOutput( std::ostream * out_stream_p ); // Output stream pointer
+
+	void
+	StopAllAsyncOutput();
+
+} // AsyncOutput
+
+} // EnergyPlus
+
+#endif
@@ -17,6 +17,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataTimings.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <InputProcessor.hh>
@@ -144,6 +145,8 @@ namespace BranchInputManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
 
+		DataTimings::ProfileTimer const profileTimer( "ManageBranchInput" ); // Region of the timing profile
+
 		if ( GetBranchInputFlag ) {
 			GetBranchInput();
 			if ( GetBranchListInputFlag ) {
@@ -74,7 +74,7 @@ namespace BranchNodeConnections {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   February 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, search only the connections of this node
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -82,7 +82,8 @@ namespace BranchNodeConnections {
 		// structure is intended to help with HVAC diagramming as well as validation of nodes.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The connections already registered for the node are found through NodeConnectionsOfNode,
+		// which also gets the new connection.
 
 		// REFERENCES:
 		// na
@@ -106,7 +107,6 @@ namespace BranchNodeConnections {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		bool ErrorsFoundHere;
-		int Count;
 		bool MakeNew;
 		int Found;
 
@@ -118,8 +118,8 @@ namespace BranchNodeConnections {
 		}
 
 		MakeNew = true;
-		for ( Count = 1; Count <= NumOfNodeConnections; ++Count ) {
-			if ( NodeConnections( Count ).NodeNumber != NodeNumber ) continue;
+		std::vector< int > & ConnectionsOfNode( NodeConnectionsOfNode[ NodeNumber ] );
+		for ( int const Count : ConnectionsOfNode ) {
 			if ( ! SameString( NodeConnections( Count ).ObjectType, ObjectType ) ) continue;
 			if ( ! SameString( NodeConnections( Count ).ObjectName, ObjectName ) ) continue;
 			if ( ! SameString( NodeConnections( Count ).ConnectionType, ConnectionType ) ) continue;
@@ -147,6 +147,7 @@ namespace BranchNodeConnections {
 			NodeConnections( NumOfNodeConnections ).ConnectionType = ConnectionType;
 			NodeConnections( NumOfNodeConnections ).FluidStream = FluidStream;
 			NodeConnections( NumOfNodeConnections ).ObjectIsParent = IsParent;
+			ConnectionsOfNode.push_back( NumOfNodeConnections );
 
 		}
 
@@ -246,7 +247,7 @@ namespace BranchNodeConnections {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   March 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, compare only connections of the same node (NodeConnectionsOfNode)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -315,9 +316,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
 				IsValid = true;
@@ -333,9 +333,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Actuator ) ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Sensor ) ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
@@ -356,9 +355,8 @@ namespace BranchNodeConnections {
 			IsValid = false;
 			IsInlet = false;
 			IsOutlet = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_SetPoint ) ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Inlet ) ) IsInlet = true;
@@ -408,9 +406,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_ZoneInlet ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
 				IsValid = true;
 			}
@@ -426,9 +423,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_ZoneExhaust ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
 				IsValid = true;
 			}
@@ -444,9 +440,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_InducedAir ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
 				IsValid = true;
 			}
@@ -467,9 +462,8 @@ namespace BranchNodeConnections {
 			if ( NodeConnections( Loop1 ).ObjectType == "AIRLOOPHVAC" || NodeConnections( Loop1 ).ObjectType == "CONDENSERLOOP" || NodeConnections( Loop1 ).ObjectType == "PLANTLOOP" ) continue;
 			IsValid = false;
 			MatchedAtLeastOne = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_Outlet ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneReturn ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ZoneExhaust ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_InducedAir ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_ReliefAir ) || NodeConnections( Loop2 ).ConnectionType == ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) {
 					MatchedAtLeastOne = true;
 					continue;
@@ -494,8 +488,8 @@ namespace BranchNodeConnections {
 			// Only non-parent node connections
 			if ( NodeConnections( Loop1 ).ObjectIsParent ) continue;
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
-			for ( Loop2 = Loop1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
+				if ( Loop2 <= Loop1 ) continue;
 				if ( NodeConnections( Loop2 ).ObjectIsParent ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Inlet ) ) continue;
 				if ( NodeConnections( Loop2 ).NodeNumber == NodeConnections( Loop1 ).NodeNumber ) {
@@ -517,8 +511,8 @@ namespace BranchNodeConnections {
 			// Skip if DIRECT AIR, because it only has one node which is an outlet, so it dupes the outlet which feeds it
 			if ( NodeConnections( Loop1 ).ObjectType == "AIRTERMINAL:SINGLEDUCT:UNCONTROLLED" ) continue;
 			IsValid = true;
-			for ( Loop2 = Loop1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
-				if ( Loop1 == Loop2 ) continue;
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
+				if ( Loop2 <= Loop1 ) continue;
 				if ( NodeConnections( Loop2 ).ObjectIsParent ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_Outlet ) ) continue;
 				// Skip if DIRECT AIR, because it only has one node which is an outlet, so it dupes the outlet which feeds it
@@ -539,9 +533,8 @@ namespace BranchNodeConnections {
 		for ( Loop1 = 1; Loop1 <= NumOfNodeConnections; ++Loop1 ) {
 			if ( NodeConnections( Loop1 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_OutsideAirReference ) ) continue;
 			IsValid = false;
-			for ( Loop2 = 1; Loop2 <= NumOfNodeConnections; ++Loop2 ) {
+			for ( int const Loop2 : NodeConnectionsOfNode[ NodeConnections( Loop1 ).NodeNumber ] ) {
 				if ( Loop1 == Loop2 ) continue;
-				if ( NodeConnections( Loop1 ).NodeNumber != NodeConnections( Loop2 ).NodeNumber ) continue;
 				if ( NodeConnections( Loop2 ).ConnectionType != ValidConnectionTypes( NodeConnectionType_OutsideAir ) ) continue;
 				IsValid = true;
 				break;
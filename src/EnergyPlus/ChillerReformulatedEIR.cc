@@ -1374,7 +1374,7 @@ namespace ChillerReformulatedEIR {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Lixing Gu, FSEC
 		//       DATE WRITTEN   July 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start from the previous condenser outlet temperature solution
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1384,6 +1384,9 @@ namespace ChillerReformulatedEIR {
 		// Use empirical curve fits to model performance at off-design conditions. This subroutine
 		// calls Subroutines CalcReformEIRChillerModel and SolveRegulaFalsi to obtain solution.
 		// The actual chiller performance calculations are in Subroutine CalcReformEIRChillerModel.
+		// The condenser outlet temperature changes little between calls, so the solution is first
+		// sought from the previous one (SolveCondOutTempFromGuess); the solution over the whole range
+		// of the curves is only used when that fails.
 
 		// REFERENCES:
 		// 1. Hydeman, M., P. Sreedharan, N. Webb, and S. Blanc. 2002. "Development and Testing of a Reformulated
@@ -1450,58 +1453,63 @@ namespace ChillerReformulatedEIR {
 				Tmax = max( CAPFTYTmax, EIRFTYTmax );
 			}
 
-			//  Check that condenser outlet temperature is within curve object limits prior to calling RegulaFalsi
-			CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Tmin );
-			CondTempMin = CondOutletTemp;
-			CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Tmax );
-			CondTempMax = CondOutletTemp;
-
-			if ( CondTempMin > Tmin && CondTempMax < Tmax ) {
-
-				//    Initialize iteration parameters for RegulaFalsi function
-				Par( 1 ) = EIRChillNum;
-				Par( 2 ) = MyLoad;
-				if ( RunFlag ) {
-					Par( 3 ) = 1.0;
-				} else {
-					Par( 3 ) = 0.0;
-				}
-				if ( FirstIteration ) {
-					Par( 4 ) = 1.0;
-				} else {
-					Par( 4 ) = 0.0;
-				}
-				//Par(5) = FlowLock !DSU
-				Par( 6 ) = EquipFlowCtrl;
-
-				SolveRegulaFalsi( Acc, MaxIter, SolFla, FalsiCondOutTemp, CondOutTempResidual, Tmin, Tmax, Par );
-
-				if ( SolFla == -1 ) {
-					if ( ! WarmupFlag ) {
-						++ElecReformEIRChiller( EIRChillNum ).IterLimitExceededNum;
-						if ( ElecReformEIRChiller( EIRChillNum ).IterLimitExceededNum == 1 ) {
-							ShowWarningError( ElecReformEIRChiller( EIRChillNum ).Name + ": Iteration limit exceeded calculating condenser outlet temperature and non-converged temperature is used" );
-						} else {
-							ShowRecurringWarningErrorAtEnd( ElecReformEIRChiller( EIRChillNum ).Name + ": Iteration limit exceeded calculating condenser outlet temperature.", ElecReformEIRChiller( EIRChillNum ).IterLimitErrIndex, CondOutletTemp, CondOutletTemp );
+			//    Initialize iteration parameters for RegulaFalsi function
+			Par( 1 ) = EIRChillNum;
+			Par( 2 ) = MyLoad;
+			if ( RunFlag ) {
+				Par( 3 ) = 1.0;
+			} else {
+				Par( 3 ) = 0.0;
+			}
+			if ( FirstIteration ) {
+				Par( 4 ) = 1.0;
+			} else {
+				Par( 4 ) = 0.0;
+			}
+			//Par(5) = FlowLock !DSU
+			Par( 6 ) = EquipFlowCtrl;
+
+			if ( ! SolveCondOutTempFromGuess( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Tmin, Tmax, Acc, Par ) ) {
+				//  Check that condenser outlet temperature is within curve object limits prior to calling RegulaFalsi
+				CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Tmin );
+				CondTempMin = CondOutletTemp;
+				CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Tmax );
+				CondTempMax = CondOutletTemp;
+
+				if ( CondTempMin > Tmin && CondTempMax < Tmax ) {
+
+					Par( 2 ) = MyLoad; // As limited by CalcReformEIRChillerModel
+					SolveRegulaFalsi( Acc, MaxIter, SolFla, FalsiCondOutTemp, CondOutTempResidual, Tmin, Tmax, Par );
+
+					if ( SolFla == -1 ) {
+						if ( ! WarmupFlag ) {
+							++ElecReformEIRChiller( EIRChillNum ).IterLimitExceededNum;
+							if ( ElecReformEIRChiller( EIRChillNum ).IterLimitExceededNum == 1 ) {
+								ShowWarningError( ElecReformEIRChiller( EIRChillNum ).Name + ": Iteration limit exceeded calculating condenser outlet temperature and non-converged temperature is used" );
+							} else {
+								ShowRecurringWarningErrorAtEnd( ElecReformEIRChiller( EIRChillNum ).Name + ": Iteration limit exceeded calculating condenser outlet temperature.", ElecReformEIRChiller( EIRChillNum ).IterLimitErrIndex, CondOutletTemp, CondOutletTemp );
+							}
 						}
-					}
-				} else if ( SolFla == -2 ) {
-					if ( ! WarmupFlag ) {
-						++ElecReformEIRChiller( EIRChillNum ).IterFailed;
-						if ( ElecReformEIRChiller( EIRChillNum ).IterFailed == 1 ) {
-							ShowWarningError( ElecReformEIRChiller( EIRChillNum ).Name + ": Solution found when calculating condenser outlet temperature. The inlet temperature will used and the simulation continues..." );
-							ShowContinueError( "Please check minimum and maximum values of x in EIRFPLR Curve " + ElecReformEIRChiller( EIRChillNum ).EIRFPLRName );
-						} else {
-							ShowRecurringWarningErrorAtEnd( ElecReformEIRChiller( EIRChillNum ).Name + ": Solution is not found in calculating condenser outlet temperature.", ElecReformEIRChiller( EIRChillNum ).IterFailedIndex, CondOutletTemp, CondOutletTemp );
+					} else if ( SolFla == -2 ) {
+						if ( ! WarmupFlag ) {
+							++ElecReformEIRChiller( EIRChillNum ).IterFailed;
+							if ( ElecReformEIRChiller( EIRChillNum ).IterFailed == 1 ) {
+								ShowWarningError( ElecReformEIRChiller( EIRChillNum ).Name + ": Solution found when calculating condenser outlet temperature. The inlet temperature will used and the simulation continues..." );
+								ShowContinueError( "Please check minimum and maximum values of x in EIRFPLR Curve " + ElecReformEIRChiller( EIRChillNum ).EIRFPLRName );
+							} else {
+								ShowRecurringWarningErrorAtEnd( ElecReformEIRChiller( EIRChillNum ).Name + ": Solution is not found in calculating condenser outlet temperature.", ElecReformEIRChiller( EIRChillNum ).IterFailedIndex, CondOutletTemp, CondOutletTemp );
+							}
 						}
+						CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Node( ElecReformEIRChiller( EIRChillNum ).CondInletNodeNum ).Temp );
 					}
-					CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, Node( ElecReformEIRChiller( EIRChillNum ).CondInletNodeNum ).Temp );
+				} else {
+					//    If iteration is not possible, average the min/max condenser outlet temperature and manually determine solution
+					CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, ( CondTempMin + CondTempMax ) / 2.0 );
+					CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, CondOutletTemp );
 				}
-			} else {
-				//    If iteration is not possible, average the min/max condenser outlet temperature and manually determine solution
-				CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, ( CondTempMin + CondTempMax ) / 2.0 );
-				CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, CondOutletTemp );
 			}
+			ElecReformEIRChiller( EIRChillNum ).CondOutletTempGuess = CondOutletTemp;
+			ElecReformEIRChiller( EIRChillNum ).HaveCondOutletTempGuess = true;
 
 			//  Call subroutine to evaluate all performance curve min/max values against evaporator/condenser outlet temps and PLR
 			CheckMinMaxCurveBoundaries( EIRChillNum, FirstIteration );
@@ -1762,6 +1770,84 @@ namespace ChillerReformulatedEIR {
 
 	}
 
+	bool
+	SolveCondOutTempFromGuess(
+		int const EIRChillNum, // Chiller number
+		Real64 & MyLoad, // Operating load [W]
+		bool const RunFlag, // TRUE when chiller operating
+		bool const FirstIteration, // TRUE when first iteration of timestep
+		int const EquipFlowCtrl, // Flow control mode for the equipment
+		Real64 const Tmin, // Minimum condenser leaving temperature allowed by curve objects [C]
+		Real64 const Tmax, // Maximum condenser leaving temperature allowed by curve objects [C]
+		Real64 const Acc, // Required accuracy of the condenser outlet temperature residual [C]
+		Array1< Real64 > & Par // Parameter array used to interface with RegulaFalsi solver
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solves for the condenser outlet temperature starting from the previous solution of the
+		// chiller.  Returns false, leaving the solution to the caller, if there is no previous
+		// solution or no solution is found near it.
+
+		// METHODOLOGY EMPLOYED:
+		// The residual is that of CondOutTempResidual.  The first step is a substitution (the model
+		// outlet temperature at the previous solution), the next ones are secant steps, all kept
+		// within the curve limits.  As soon as two points bracket the solution, SolveRegulaFalsi
+		// finishes on that small interval.  The model is last evaluated at the returned solution.
+
+		// Using/Aliasing
+		using General::SolveRegulaFalsi;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxSecantIter( 6 ); // Secant steps tried before giving up
+		int const MaxIter( 50 ); // Iteration control for SolveRegulaFalsi on the small interval
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 T0; // Previous condenser outlet temperature [C]
+		Real64 R0; // Residual at T0 [C]
+		Real64 T1; // Current condenser outlet temperature [C]
+		Real64 R1; // Residual at T1 [C]
+		Real64 FalsiCondOutTemp; // RegulaFalsi condenser outlet temperature result [C]
+		int SolFla; // Feedback flag from SolveRegulaFalsi
+
+		if ( ! ElecReformEIRChiller( EIRChillNum ).HaveCondOutletTempGuess || Tmax <= Tmin ) return false;
+
+		T0 = max( Tmin, min( ElecReformEIRChiller( EIRChillNum ).CondOutletTempGuess, Tmax ) );
+		CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, T0 );
+		R0 = T0 - CondOutletTemp;
+		if ( std::abs( R0 ) < Acc ) return true;
+		Par( 2 ) = MyLoad; // As limited by CalcReformEIRChillerModel
+
+		T1 = max( Tmin, min( CondOutletTemp, Tmax ) );
+		for ( int Iter = 1; Iter <= MaxSecantIter; ++Iter ) {
+			if ( T1 == T0 ) return false;
+			CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, T1 );
+			R1 = T1 - CondOutletTemp;
+			if ( std::abs( R1 ) < Acc ) return true;
+
+			if ( ( R0 < 0.0 ) != ( R1 < 0.0 ) ) {
+				SolveRegulaFalsi( Acc, MaxIter, SolFla, FalsiCondOutTemp, CondOutTempResidual, min( T0, T1 ), max( T0, T1 ), Par );
+				if ( SolFla < 0 ) return false;
+				CalcReformEIRChillerModel( EIRChillNum, MyLoad, RunFlag, FirstIteration, EquipFlowCtrl, FalsiCondOutTemp );
+				return true;
+			}
+
+			if ( R1 == R0 ) return false;
+			Real64 const T2( max( Tmin, min( T1 - R1 * ( T1 - T0 ) / ( R1 - R0 ), Tmax ) ) );
+			T0 = T1;
+			R0 = R1;
+			T1 = T2;
+		}
+		return false;
+
+	}
+
 	Real64
 	CondOutTempResidual(
 		Real64 const FalsiCondOutTemp, // RegulaFalsi condenser outlet temperature result [C]
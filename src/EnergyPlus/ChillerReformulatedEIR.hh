@@ -171,6 +171,8 @@ namespace ChillerReformulatedEIR {
 		//  INTEGER           :: MsgErrorCount = 0   ! number of occurrences of warning
 		//  INTEGER           :: ErrCount1     = 0   ! for recurring error messages
 		bool PossibleSubcooling; // flag to indicate chiller is doing less cooling that requested
+		bool HaveCondOutletTempGuess; // TRUE when CondOutletTempGuess holds a previous solution
+		Real64 CondOutletTempGuess; // Last condenser outlet temperature solution, starting point of the next solution [C]
 
 		// Default Constructor
 		ReformulatedEIRChillerSpecs() :
@@ -269,7 +271,9 @@ namespace ChillerReformulatedEIR {
 			HRBranchNum( 0 ),
 			HRCompNum( 0 ),
 			CondMassFlowIndex( 0 ),
-			PossibleSubcooling( false )
+			PossibleSubcooling( false ),
+			HaveCondOutletTempGuess( false ),
+			CondOutletTempGuess( 0.0 )
 		{}
 	};
 
@@ -404,6 +408,19 @@ namespace ChillerReformulatedEIR {
 		int const Num // Chiller number
 	);
 
+	bool
+	SolveCondOutTempFromGuess(
+		int const EIRChillNum, // Chiller number
+		Real64 & MyLoad, // Operating load [W]
+		bool const RunFlag, // TRUE when chiller operating
+		bool const FirstIteration, // TRUE when first iteration of timestep
+		int const EquipFlowCtrl, // Flow control mode for the equipment
+		Real64 const Tmin, // Minimum condenser leaving temperature allowed by curve objects [C]
+		Real64 const Tmax, // Maximum condenser leaving temperature allowed by curve objects [C]
+		Real64 const Acc, // Required accuracy of the condenser outlet temperature residual [C]
+		Array1< Real64 > & Par // Parameter array used to interface with RegulaFalsi solver
+	);
+
 	Real64
 	CondOutTempResidual(
 		Real64 const FalsiCondOutTemp, // RegulaFalsi condenser outlet temperature result [C]
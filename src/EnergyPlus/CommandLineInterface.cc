@@ -1,3 +1,15 @@
+// C++ Headers
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 // CLI Headers
 #include <ezOptionParser.hpp>
 
@@ -35,6 +47,88 @@ using namespace OutputProcessor;
 using namespace SolarShading;
 using namespace ez;
 
+// Data dictionary preloaded by the server; blank unless this process is a server job
+std::string ServerIddFileName;
+
+#ifndef _WIN32
+// Splits a server job line into its arguments at white space; double quotes group an argument containing spaces
+std::vector< std::string >
+SplitJobLine( std::string const & line )
+{
+	std::vector< std::string > jobArgs;
+	std::string arg;
+	bool inArg( false );
+	bool inQuotes( false );
+	for ( char const ch : line ) {
+		if ( ch == '"' ) {
+			inQuotes = !inQuotes;
+			inArg = true;
+		} else if ( !inQuotes && ( ch == ' ' || ch == '\t' || ch == '\r' ) ) {
+			if ( inArg ) jobArgs.push_back( arg );
+			arg.clear();
+			inArg = false;
+		} else {
+			arg += ch;
+			inArg = true;
+		}
+	}
+	if ( inArg ) jobArgs.push_back( arg );
+	return jobArgs;
+}
+
+// Reads the data dictionary once, then simulates the jobs read from standard input, one command line
+// (options and input file, as given to energyplus) per line, until the end of the input or a "quit" line.
+// Each job runs in a child process forked from the server, so it starts from the preloaded dictionary and
+// an otherwise untouched state; its messages go to standard error.  The server answers each job on standard
+// output.  Returns only in a job process, once the job's arguments are processed; the server exits here.
+void
+RunServer( std::string const & programName )
+{
+	PreloadDataDictionary();
+	ServerIddFileName = inputIddFileName;
+	std::cout << "EnergyPlus server ready" << std::endl;
+
+	std::string line;
+	int jobNumber( 0 );
+	while ( std::getline( std::cin, line ) ) {
+		std::vector< std::string > jobArgs( SplitJobLine( line ) );
+		if ( jobArgs.empty() ) continue;
+		if ( jobArgs.size() == 1u && jobArgs[0] == "quit" ) break;
+		++jobNumber;
+
+		std::cout.flush();
+		std::cerr.flush();
+		pid_t const pid = fork();
+		if ( pid == 0 ) {
+			// Keep standard output for the server answers and detach from the job stream
+			dup2( STDERR_FILENO, STDOUT_FILENO );
+			int const nullInput = open( "/dev/null", O_RDONLY );
+			if ( nullInput >= 0 ) dup2( nullInput, STDIN_FILENO );
+			jobArgs.insert( jobArgs.begin(), programName );
+			std::vector< const char * > jobArgv;
+			for ( std::string const & arg : jobArgs ) jobArgv.push_back( arg.c_str() );
+			ProcessArgs( int( jobArgv.size() ), &jobArgv[0] );
+			return;
+		}
+
+		if ( pid < 0 ) {
+			std::cout << "Job " << jobNumber << " failed (could not start a process)" << std::endl;
+			continue;
+		}
+		int status( 0 );
+		while ( waitpid( pid, &status, 0 ) < 0 ) {}
+		if ( WIFEXITED( status ) && WEXITSTATUS( status ) == EXIT_SUCCESS ) {
+			std::cout << "Job " << jobNumber << " completed successfully" << std::endl;
+		} else if ( WIFEXITED( status ) ) {
+			std::cout << "Job " << jobNumber << " failed (exit status " << WEXITSTATUS( status ) << ")" << std::endl;
+		} else {
+			std::cout << "Job " << jobNumber << " failed (signal " << WTERMSIG( status ) << ")" << std::endl;
+		}
+	}
+	exit(EXIT_SUCCESS);
+}
+#endif
+
 int
 ProcessArgs(int argc, const char * argv[])
 {
@@ -90,6 +184,12 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Force annual simulation", "-a", "--annual");
 
+	opt.add("", 0, 0, 0, "Process and check the input, then stop without simulating", "--check-input");
+
+	opt.add("", 0, 1, 0, "Save the simulation state at the end of day N of the weather file run period to a checkpoint file", "--checkpoint-at");
+
+	opt.add("", 0, 0, 0, "Write the eso, mtr and csv output files gzip compressed (.gz)", "--compress-output");
+
 	opt.add("", 0, 1, 0, "Output directory path (default: current directory)", "-d", "--output-directory");
 
 	opt.add("", 0, 0, 0, "Force design-day-only simulation", "-D", "--design-day");
@@ -102,8 +202,18 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 1, 0, "Prefix for output file names (default: eplus)", "-p", "--output-prefix");
 
+	opt.add("", 0, 1, 0, "Simulate only the Nth weather file run period after sizing (default: all)", "--run-period");
+
 	opt.add("", 0, 0, 0, "Run ReadVarsESO after simulation", "-r", "--readvars");
 
+	opt.add("", 0, 1, 0, "Resume the simulation from a checkpoint file written with --checkpoint-at", "--resume-from");
+
+	opt.add("", 0, 1, 0, "Simulate only segment K of N of each weather file run period, given as K/N", "--segment");
+
+	opt.add("", 0, 0, 0, "Stay resident with the data dictionary loaded and simulate the jobs read from standard input, one command line per line", "--server");
+
+	opt.add("0", 0, 1, 0, "Days simulated ahead of a segment to build up its starting state (default: 0)", "--segment-overlap");
+
 	opt.add("L", 0, 1, 0, "Suffix style for output file names (default: L)\n   L: Legacy (e.g., eplustbl.csv)\n   C: Capital (e.g., eplusTable.csv)\n   D: Dash (e.g., eplus-table.csv)", "-s", "--output-suffix");
 
 	opt.add("", 0, 0, 0, "Display version information", "-v", "--version");
@@ -134,7 +244,13 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.get("-i")->getString(inputIddFileName);
 
-	if (!opt.isSet("-i") && !legacyMode)
+	if (!ServerIddFileName.empty()) {
+		if (opt.isSet("--server") || opt.isSet("-i")) {
+			DisplayString("ERROR: A server job cannot use '--server' or '--idd'; it uses the data dictionary loaded by the server.");
+			exit(EXIT_FAILURE);
+		}
+		inputIddFileName = ServerIddFileName;
+	} else if (!opt.isSet("-i") && !legacyMode)
 		inputIddFileName = exeDirectory + inputIddFileName;
 
 	std::string dirPathName;
@@ -147,6 +263,72 @@ ProcessArgs(int argc, const char * argv[])
 
 	AnnualSimulation = opt.isSet("-a");
 
+	if (opt.isSet("--run-period")) {
+		opt.get("--run-period")->getInt(SelectedRunPeriod);
+		if (SelectedRunPeriod < 1) {
+			DisplayString("ERROR: The run period given with '--run-period' must be a positive integer.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (opt.isSet("--segment")) {
+		std::string segment;
+		opt.get("--segment")->getString(segment);
+		std::string::size_type slash = segment.find('/');
+		if (slash != std::string::npos) {
+			RunPeriodSegment = std::atoi(segment.substr(0, slash).c_str());
+			NumRunPeriodSegments = std::atoi(segment.substr(slash + 1).c_str());
+		}
+		if (RunPeriodSegment < 1 || RunPeriodSegment > NumRunPeriodSegments) {
+			DisplayString("ERROR: The segment given with '--segment' must be K/N with 1 <= K <= N, e.g. 2/4.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+		opt.get("--segment-overlap")->getInt(RunPeriodSegmentOverlap);
+		if (RunPeriodSegmentOverlap < 0) {
+			DisplayString("ERROR: The days given with '--segment-overlap' must not be negative.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+	} else if (opt.isSet("--segment-overlap")) {
+		DisplayString("ERROR: '--segment-overlap' is only used with '--segment'.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
+	CheckInputOnly = opt.isSet("--check-input");
+	if (CheckInputOnly && (opt.isSet("--checkpoint-at") || opt.isSet("--resume-from"))) {
+		DisplayString("ERROR: '--check-input' cannot be used with '--checkpoint-at' or '--resume-from'.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
+	if (opt.isSet("--checkpoint-at")) {
+		opt.get("--checkpoint-at")->getInt(CheckpointDay);
+		if (CheckpointDay < 1) {
+			DisplayString("ERROR: The day given with '--checkpoint-at' must be a positive integer.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	CompressOutput = opt.isSet("--compress-output");
+	if (CompressOutput && runReadVars) {
+		DisplayString("ERROR: '--compress-output' cannot be used with '--readvars'; ReadVarsESO reads uncompressed files only.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
+	if (opt.isSet("--resume-from")) {
+		opt.get("--resume-from")->getString(inputCheckpointFileName);
+		if (NumRunPeriodSegments > 0) {
+			DisplayString("ERROR: '--resume-from' cannot be used with '--segment'.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+	}
+
 	// Process standard arguments
 	if (opt.isSet("-h")) {
 		DisplayString(usage);
@@ -328,6 +510,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputSszTxtFileName = outputFilePrefix + sszSuffix + ".txt";
 	outputAdsFileName = outputFilePrefix + adsSuffix + ".out";
 	outputSqliteErrFileName = dirPathName + sqliteSuffix + ".err";
+	outputCheckpointFileName = outputFilePrefix + normalSuffix + ".ckpt";
 	outputScreenCsvFileName = outputFilePrefix + screenSuffix + ".csv";
 	outputDelightInFileName = "eplusout.delightin";
 	outputDelightOutFileName = "eplusout.delightout";
@@ -429,6 +612,21 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	if (opt.isSet("--server")) {
+#ifdef _WIN32
+		DisplayString("ERROR: '--server' is not supported on Windows.");
+		exit(EXIT_FAILURE);
+#else
+		if (argCount != (opt.isSet("-i") ? 4u : 2u)) {
+			DisplayString("ERROR: '--server' only takes '--idd'; the other options and the input file are given with each job.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+		RunServer(arguments[0]);
+		return 0;
+#endif
+	}
+
 	{ IOFlags flags; gio::inquire( inputIdfFileName, flags ); FileExists = flags.exists(); }
 	if ( ! FileExists ) {
 		DisplayString("ERROR: Could not find input data file: " + getAbsolutePath(inputIdfFileName) + "." );
@@ -0,0 +1,232 @@
+// C++ Headers
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <utility>
+#include <vector>
+
+// zlib Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <CompressedOutput.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace CompressedOutput {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// This module gzip compresses the large output files (eplusout.eso, eplusout.mtr and the csv
+	// output files) as they are written, for runs whose output is limited by the file system.
+
+	// METHODOLOGY EMPLOYED:
+	// The stream buffer of an output stream is replaced by one that collects the characters in
+	// blocks and writes each full block to the original stream buffer as a complete gzip member,
+	// using the vendored zlib.  A file of concatenated members is a valid gzip file (gunzip and
+	// zlib read it as one stream), and as each member starts at a known offset, a reader that
+	// scans for the member boundaries can decompress the blocks in parallel.
+	// As for AsyncOutput, flushes do not write the partial block; it is written when the output
+	// is stopped (StopCompressedOutput), which must happen before the file is closed.  When both
+	// are used, compression is started first so that it runs on the writer thread.
+
+	// REFERENCES:
+	// RFC 1952, GZIP file format specification version 4.3
+
+	// OTHER NOTES:
+	// The fastest compression level is used: the point is less data to write, not the smallest file.
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const BlockSize( 1048576 ); // Characters compressed into each gzip member
+
+	// Stream buffer that writes its output as gzip members
+	class GzipStreamBuf : public std::streambuf
+	{
+
+	public: // Creation
+
+		explicit
+		GzipStreamBuf( std::streambuf * target ) :
+			target_( target ),
+			block_( BlockSize ),
+			failed_( false )
+		{
+			zs_.zalloc = Z_NULL;
+			zs_.zfree = Z_NULL;
+			zs_.opaque = Z_NULL;
+			if ( deflateInit2( &zs_, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) failed_ = true; // 15 + 16: gzip wrapper
+			compressed_.resize( deflateBound( &zs_, BlockSize ) );
+			setp( block_.data(), block_.data() + block_.size() );
+		}
+
+		~GzipStreamBuf()
+		{
+			finish();
+			deflateEnd( &zs_ );
+		}
+
+	public: // Properties
+
+		// Stream buffer the output is written to
+		std::streambuf *
+		target() const
+		{
+			return target_;
+		}
+
+		// Compression or writes to the target stream buffer failed?
+		bool
+		failed() const
+		{
+			return failed_;
+		}
+
+	public: // Methods
+
+		// Write the partial block and flush the target
+		void
+		finish()
+		{
+			write_block();
+			if ( target_->pubsync() != 0 ) failed_ = true;
+		}
+
+	protected: // std::streambuf
+
+		int_type
+		overflow( int_type c ) override
+		{
+			write_block();
+			if ( ! traits_type::eq_int_type( c, traits_type::eof() ) ) {
+				*pptr() = traits_type::to_char_type( c );
+				pbump( 1 );
+			}
+			return traits_type::not_eof( c );
+		}
+
+		int
+		sync() override
+		{
+			return 0; // Partial block is kept (see module notes)
+		}
+
+	private: // Methods
+
+		// Compress the characters collected so far into a gzip member and start a new block
+		void
+		write_block()
+		{
+			std::size_t const n( pptr() - pbase() );
+			if ( n == 0u ) return;
+			if ( ! failed_ ) {
+				deflateReset( &zs_ ); // New member: gzip header, deflate stream and trailer
+				zs_.next_in = reinterpret_cast< Bytef * >( block_.data() );
+				zs_.avail_in = static_cast< uInt >( n );
+				zs_.next_out = reinterpret_cast< Bytef * >( compressed_.data() );
+				zs_.avail_out = static_cast< uInt >( compressed_.size() );
+				if ( deflate( &zs_, Z_FINISH ) == Z_STREAM_END ) { // Output fits: compressed_ holds the bound for a full block
+					std::streamsize const size( compressed_.size() - zs_.avail_out );
+					if ( target_->sputn( compressed_.data(), size ) != size ) failed_ = true;
+				} else {
+					failed_ = true;
+				}
+			}
+			setp( block_.data(), block_.data() + block_.size() );
+		}
+
+	private: // Data
+
+		std::streambuf * target_; // Stream buffer the output is written to
+		std::vector< char > block_; // Block being filled (put area)
+		std::vector< char > compressed_; // Compressed member of a block
+		z_stream zs_; // Deflate state, reset for each block
+		bool failed_; // Compression or writes to the target failed
+
+	}; // GzipStreamBuf
+
+	// MODULE VARIABLE DECLARATIONS:
+	static std::vector< std::pair< std::ostream *, std::unique_ptr< GzipStreamBuf > > > CompressedStreams; // Streams being compressed
+
+	// Functions
+
+	void
+	StartCompressedOutput( std::ostream * out_stream_p ) // Output stream pointer
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes the output written to a stream from now on go to its file gzip compressed.
+
+		if ( ! out_stream_p ) return;
+		for ( auto const & CompressedStream : CompressedStreams ) {
+			if ( CompressedStream.first == out_stream_p ) return; // Already started
+		}
+
+		std::unique_ptr< GzipStreamBuf > buf( new GzipStreamBuf( out_stream_p->rdbuf() ) );
+		out_stream_p->rdbuf( buf.get() );
+		CompressedStreams.emplace_back( out_stream_p, std::move( buf ) );
+
+	}
+
+	void
+	StopCompressedOutput( std::ostream * out_stream_p ) // Output stream pointer
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compresses and writes the remaining output of a stream and gives the stream back its own
+		// stream buffer.  Must be called before the stream is closed.
+
+		for ( auto i = CompressedStreams.begin(); i != CompressedStreams.end(); ++i ) {
+			if ( i->first != out_stream_p ) continue;
+			GzipStreamBuf & buf( *i->second );
+			buf.finish();
+			out_stream_p->rdbuf( buf.target() );
+			if ( buf.failed() ) {
+				ShowWarningError( "StopCompressedOutput: Errors occurred compressing or writing an output file; it may be incomplete." );
+			}
+			CompressedStreams.erase( i );
+			return;
+		}
+
+	}
+
+	void
+	StopAllCompressedOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stops the compression of all streams (e.g. before the files are closed on a fatal error).
+
+		while ( ! CompressedStreams.empty() ) {
+			StopCompressedOutput( CompressedStreams.back().first );
+		}
+
+	}
+
+} // CompressedOutput
+
+} // EnergyPlus
@@ -0,0 +1,33 @@
+#ifndef CompressedOutput_hh_INCLUDED
+#define CompressedOutput_hh_INCLUDED
+
+// C++ Headers
+#include <iosfwd>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace CompressedOutput {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const BlockSize; // Characters compressed into each gzip member
+
+	// Functions
+
+	void
+	StartCompressedOutput( std::ostream * out_stream_p ); // Output stream pointer
+
+	void
+	StopCompressedOutput( std::ostream * out_stream_p ); // Output stream pointer
+
+	void
+	StopAllCompressedOutput();
+
+} // CompressedOutput
+
+} // EnergyPlus
+
+#endif
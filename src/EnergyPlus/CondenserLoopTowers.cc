@@ -4943,7 +4943,7 @@ namespace CondenserLoopTowers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   Feb. 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, solve the balance on the range polynomial of the model
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4962,7 +4962,6 @@ namespace CondenserLoopTowers {
 		// Form 160.00-SG2 (0502).  2002.
 
 		// Using/Aliasing
-		using General::SolveRegulaFalsi;
 		using DataPlant::SingleSetPoint;
 		using DataPlant::DualSetPointDeadBand;
 
@@ -4981,16 +4980,11 @@ namespace CondenserLoopTowers {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int SolFla; // Flag of solver
-		Array1D< Real64 > Par( 4 ); // Parameter array for regula falsi solver
 		Real64 Tr; // range temperature which results in an energy balance
 		Real64 TempSetPoint( 0.0 ); // local temporary for loop setpoint
 
 		//   determine tower outlet water temperature
-		Par( 1 ) = TowerNum; // Index to cooling tower
-		Par( 2 ) = WaterFlowRateRatio; // water flow rate ratio
-		Par( 3 ) = AirFlowRateRatio; // air flow rate ratio
-		Par( 4 ) = Twb; // inlet air wet-bulb temperature [C]
-		SolveRegulaFalsi( Acc, MaxIte, SolFla, Tr, SimpleTowerTrResidual, 0.001, VSTower( SimpleTower( TowerNum ).VSTower ).MaxRangeTemp, Par );
+		SolveVSTowerRange( TowerNum, WaterFlowRateRatio, AirFlowRateRatio, Twb, Acc, MaxIte, SolFla, Tr );
 
 		OutletWaterTemp = SimpleTowerInlet( TowerNum ).WaterTemp - Tr;
 
@@ -5094,6 +5088,122 @@ namespace CondenserLoopTowers {
 
 	}
 
+	void
+	SolveVSTowerRange(
+		int const TowerNum, // Index to cooling tower
+		Real64 const WaterFlowRateRatio, // Water flow ratio of cooling tower
+		Real64 const AirFlowRateRatio, // Air flow ratio of cooling tower
+		Real64 const Twb, // Inlet air wet-bulb temperature [C]
+		Real64 const Acc, // Required accuracy of the balance [C]
+		int const MaxIte, // Maximum number of iterations
+		int & SolFla, // Number of iterations, -1 if not converged, -2 if there is no balance in the model range
+		Real64 & Tr // Range temperature which results in an energy balance [C]
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the range temperature at which the variable speed tower model balances,
+		// Twb + Tapproach + Trange = Node(WaterInletNode)%Temp, between 0.001 C and the model's maximum range.
+		// This is the root of SimpleTowerTrResidual, with the same accuracy and exit flags as SolveRegulaFalsi.
+
+		// METHODOLOGY EMPLOYED:
+		// The approach of the CoolTools and YorkCalc models (CalcVSTowerApproach) is a polynomial in the range
+		// temperature, of third and second order.  Its coefficients are collected once for the flow ratios and
+		// wet-bulb temperature, so each residual evaluation is a cubic.  Starting from the linear interpolation
+		// between the ends of the range, Newton steps on the cubic are taken within the bracket of the root,
+		// with a bisection of the bracket whenever a step would leave it.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const TrMin( 0.001 ); // Lower end of the range searched [C]
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 PctAirFlow; // air flow rate ratio (fan power ratio in the case of CoolTools model)
+		Real64 FlowFactor; // water flow rate to air flow rate ratio (L/G) for YorkCalc model
+		Real64 R0; // residual coefficients: residual = R0 + R1 * Tr + R2 * Tr^2 + R3 * Tr^3
+		Real64 R1;
+		Real64 R2;
+		Real64 R3;
+		Real64 TrLow; // end of the bracket with the residual of the same sign as at TrMin
+		Real64 TrHigh; // other end of the bracket
+		Real64 ResLow; // residual at TrLow
+		Real64 ResHigh; // residual at TrHigh
+		Real64 Res; // residual at Tr
+		Real64 dResdTr; // derivative of the residual at Tr
+		Real64 TrNext; // next estimate
+		int NIte; // number of iterations
+
+		Array1D< Real64 > const & Coeff( VSTower( SimpleTower( TowerNum ).VSTower ).Coeff );
+
+		if ( SimpleTower( TowerNum ).TowerModelType == YorkCalcModel || SimpleTower( TowerNum ).TowerModelType == YorkCalcUserDefined ) {
+			FlowFactor = WaterFlowRateRatio / AirFlowRateRatio;
+			R0 = Coeff( 1 ) + Coeff( 2 ) * Twb + Coeff( 3 ) * Twb * Twb + ( Coeff( 10 ) + Coeff( 11 ) * Twb + Coeff( 12 ) * Twb * Twb ) * FlowFactor + ( Coeff( 19 ) + Coeff( 20 ) * Twb + Coeff( 21 ) * Twb * Twb ) * FlowFactor * FlowFactor;
+			R1 = Coeff( 4 ) + Coeff( 5 ) * Twb + Coeff( 6 ) * Twb * Twb + ( Coeff( 13 ) + Coeff( 14 ) * Twb + Coeff( 15 ) * Twb * Twb ) * FlowFactor + ( Coeff( 22 ) + Coeff( 23 ) * Twb + Coeff( 24 ) * Twb * Twb ) * FlowFactor * FlowFactor;
+			R2 = Coeff( 7 ) + Coeff( 8 ) * Twb + Coeff( 9 ) * Twb * Twb + ( Coeff( 16 ) + Coeff( 17 ) * Twb + Coeff( 18 ) * Twb * Twb ) * FlowFactor + ( Coeff( 25 ) + Coeff( 26 ) * Twb + Coeff( 27 ) * Twb * Twb ) * FlowFactor * FlowFactor;
+			R3 = 0.0;
+		} else { // empirical model is CoolTools format
+			PctAirFlow = pow_3( AirFlowRateRatio );
+			R0 = Coeff( 1 ) + Coeff( 2 ) * PctAirFlow + Coeff( 3 ) * PctAirFlow * PctAirFlow + Coeff( 4 ) * PctAirFlow * PctAirFlow * PctAirFlow + Coeff( 5 ) * WaterFlowRateRatio + Coeff( 6 ) * PctAirFlow * WaterFlowRateRatio + Coeff( 7 ) * PctAirFlow * PctAirFlow * WaterFlowRateRatio + Coeff( 8 ) * WaterFlowRateRatio * WaterFlowRateRatio + Coeff( 9 ) * PctAirFlow * WaterFlowRateRatio * WaterFlowRateRatio + Coeff( 10 ) * WaterFlowRateRatio * WaterFlowRateRatio * WaterFlowRateRatio + Coeff( 11 ) * Twb + Coeff( 12 ) * PctAirFlow * Twb + Coeff( 13 ) * PctAirFlow * PctAirFlow * Twb + Coeff( 14 ) * WaterFlowRateRatio * Twb + Coeff( 15 ) * PctAirFlow * WaterFlowRateRatio * Twb + Coeff( 16 ) * WaterFlowRateRatio * WaterFlowRateRatio * Twb + Coeff( 17 ) * Twb * Twb + Coeff( 18 ) * PctAirFlow * Twb * Twb + Coeff( 19 ) * WaterFlowRateRatio * Twb * Twb + Coeff( 20 ) * Twb * Twb * Twb;
+			R1 = Coeff( 21 ) + Coeff( 22 ) * PctAirFlow + Coeff( 23 ) * PctAirFlow * PctAirFlow + Coeff( 24 ) * WaterFlowRateRatio + Coeff( 25 ) * PctAirFlow * WaterFlowRateRatio + Coeff( 26 ) * WaterFlowRateRatio * WaterFlowRateRatio + Coeff( 27 ) * Twb + Coeff( 28 ) * PctAirFlow * Twb + Coeff( 29 ) * WaterFlowRateRatio * Twb + Coeff( 30 ) * Twb * Twb;
+			R2 = Coeff( 31 ) + Coeff( 32 ) * PctAirFlow + Coeff( 33 ) * WaterFlowRateRatio + Coeff( 34 ) * Twb;
+			R3 = Coeff( 35 );
+		}
+		// residual of the balance Twb + Tapproach + Trange - Node(WaterInletNode)%Temp
+		R0 += Twb - Node( SimpleTower( TowerNum ).WaterInletNodeNum ).Temp;
+		R1 += 1.0;
+
+		TrLow = TrMin;
+		TrHigh = VSTower( SimpleTower( TowerNum ).VSTower ).MaxRangeTemp;
+		ResLow = R0 + ( R1 + ( R2 + R3 * TrLow ) * TrLow ) * TrLow;
+		ResHigh = R0 + ( R1 + ( R2 + R3 * TrHigh ) * TrHigh ) * TrHigh;
+		if ( ResLow * ResHigh > 0.0 ) {
+			SolFla = -2;
+			Tr = TrMin;
+			return;
+		}
+
+		dResdTr = ResLow - ResHigh;
+		if ( std::abs( dResdTr ) < 1.e-10 ) dResdTr = 1.e-10;
+		Tr = ( ResLow * TrHigh - ResHigh * TrLow ) / dResdTr;
+		for ( NIte = 1; NIte <= MaxIte; ++NIte ) {
+			Res = R0 + ( R1 + ( R2 + R3 * Tr ) * Tr ) * Tr;
+			if ( std::abs( Res ) < Acc ) {
+				SolFla = NIte;
+				return;
+			}
+			if ( Res * ResLow > 0.0 ) {
+				TrLow = Tr;
+				ResLow = Res;
+			} else {
+				TrHigh = Tr;
+			}
+			dResdTr = R1 + ( 2.0 * R2 + 3.0 * R3 * Tr ) * Tr;
+			TrNext = ( dResdTr != 0.0 ) ? Tr - Res / dResdTr : TrLow;
+			if ( ( TrNext - TrLow ) * ( TrNext - TrHigh ) >= 0.0 ) TrNext = 0.5 * ( TrLow + TrHigh );
+			Tr = TrNext;
+		}
+		SolFla = -1;
+	}
+
 	void
 	CheckModelBounds(
 		int const TowerNum, // index to tower
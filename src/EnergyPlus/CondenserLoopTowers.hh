@@ -704,6 +704,18 @@ namespace CondenserLoopTowers {
 		Real64 & Approach // Calculated approach temperature [C]
 	);
 
+	void
+	SolveVSTowerRange(
+		int const TowerNum, // Index to cooling tower
+		Real64 const WaterFlowRateRatio, // Water flow ratio of cooling tower
+		Real64 const AirFlowRateRatio, // Air flow ratio of cooling tower
+		Real64 const Twb, // Inlet air wet-bulb temperature [C]
+		Real64 const Acc, // Required accuracy of the balance [C]
+		int const MaxIte, // Maximum number of iterations
+		int & SolFla, // Number of iterations, -1 if not converged, -2 if there is no balance in the model range
+		Real64 & Tr // Range temperature which results in an energy balance [C]
+	);
+
 	void
 	CheckModelBounds(
 		int const TowerNum, // index to tower
@@ -1,7 +1,16 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <string>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -14,6 +23,8 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
@@ -100,6 +111,10 @@ namespace ConductionTransferFunctionCalc {
 	Real64 TinyLimit;
 	Array2D< Real64 > IdenMatrix; // Identity Matrix
 
+	char const CTFCacheMagic[ 8 ] = { 'E', 'P', 'C', 'T', 'F', 'C', '0', '1' }; // Tag at the start of CTF cache files
+	int NumCTFCacheLookups( 0 ); // Constructions looked up in the CTF cache
+	int NumCTFCacheHits( 0 ); // Constructions whose CTFs were loaded from the CTF cache
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
 	// MODULE SUBROUTINES:
@@ -167,6 +182,7 @@ namespace ConductionTransferFunctionCalc {
 		// Using/Aliasing
 		using namespace DataConversions;
 		using General::RoundSigDigits;
+		using DataSystemVariables::CTFCacheFolder;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -251,6 +267,8 @@ namespace ConductionTransferFunctionCalc {
 		int NumAdjResLayers; // Number of resistive layers that are adjacent
 		int OppositeLayer; // Used for comparing constructions (to see if one is the reverse of another)
 		Array1D_bool ResLayer( MaxLayersInConstruct ); // Set true if the layer must be handled as a resistive
+		bool CTFCacheHit; // Set true if the CTFs of this construct were loaded from the CTF cache
+		std::uint64_t CTFKey( 0 ); // CTF cache key of this construct
 		bool RevConst; // Set true if one construct is the reverse of another (CTFs already
 		// available)
 		Array1D< Real64 > rho( MaxLayersInConstruct ); // Density of a material layer
@@ -559,7 +577,16 @@ namespace ConductionTransferFunctionCalc {
 
 				} // ... end of construct loop (check reversed--Constr)
 
-				if ( ! RevConst ) { // Calculate CTFs (non-reversed constr)
+				// Reuse CTFs computed by an earlier run for the same layers and time step
+				CTFCacheHit = false;
+				if ( ! RevConst && ! CTFCacheFolder.empty() ) {
+					CTFKey = CTFCacheKey( ConstrNum, LayersInConstruct, dl, rk, rho, cp, lr, ResLayer, dyn );
+					++NumCTFCacheLookups;
+					CTFCacheHit = ReadCTFCache( CTFKey, ConstrNum );
+					if ( CTFCacheHit ) ++NumCTFCacheHits;
+				}
+
+				if ( ! RevConst && ! CTFCacheHit ) { // Calculate CTFs (non-reversed constr)
 
 					// Estimate number of nodes each layer of the construct will require
 					// and calculate the nodal spacing from that
@@ -1068,6 +1095,8 @@ namespace ConductionTransferFunctionCalc {
 
 					} // ... end of CTF calculation loop.
 
+					if ( ! CTFCacheFolder.empty() && ! ErrorsFound ) WriteCTFCache( CTFKey, ConstrNum );
+
 				} // ... end of IF block for non-reversed constructs.
 
 			} else { // Construct has only resistive layers (no thermal mass).
@@ -2069,6 +2098,258 @@ namespace ConductionTransferFunctionCalc {
 
 	}
 
+	std::uint64_t
+	CTFCacheKey(
+		int const ConstrNum, // Construction number
+		int const LayersInConstruct, // Number of layers after combining adjacent resistive layers
+		Array1< Real64 > const & dl, // Thickness of each layer
+		Array1< Real64 > const & rk, // Thermal conductivity of each layer
+		Array1< Real64 > const & rho, // Density of each layer
+		Array1< Real64 > const & cp, // Specific heat of each layer
+		Array1< Real64 > const & lr, // R value of each layer
+		Array1_bool const & ResLayer, // True if the layer is handled as a resistive layer
+		Real64 const dyn // Nodal spacing in the direction perpendicular to the main direction
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the key under which the CTFs of a construction are stored in the CTF cache.
+
+		// METHODOLOGY EMPLOYED:
+		// 64 bit FNV-1a hash over everything the state space CTF calculation depends on: the
+		// layer properties as they are passed to it (after resistive layers have been combined
+		// and the units converted), the solution dimensions, the source/sink and user temperature
+		// locations and the zone time step.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::uint64_t const FNVOffsetBasis( 14695981039346656037ULL );
+		std::uint64_t const FNVPrime( 1099511628211ULL );
+		int const CacheVersion( 1 ); // Change when the CTF calculation or the cached data changes
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Key( FNVOffsetBasis );
+
+		auto Mix = [ & ]( void const * const Data, std::size_t const NumBytes ) {
+			unsigned char const * const Bytes( static_cast< unsigned char const * >( Data ) );
+			for ( std::size_t I = 0; I < NumBytes; ++I ) {
+				Key ^= Bytes[ I ];
+				Key *= FNVPrime;
+			}
+		};
+		auto MixInt = [ & ]( int const Value ) {
+			Mix( &Value, sizeof( Value ) );
+		};
+		auto MixReal = [ & ]( Real64 const Value ) {
+			Mix( &Value, sizeof( Value ) );
+		};
+
+		auto const & construct( Construct( ConstrNum ) );
+		MixInt( CacheVersion );
+		MixInt( MaxCTFTerms );
+		MixInt( NumOfPerpendNodes );
+		MixReal( TimeStepZone );
+		MixInt( construct.SolutionDimensions );
+		MixInt( construct.SourceSinkPresent );
+		MixInt( construct.SourceAfterLayer );
+		MixInt( construct.TempAfterLayer );
+		MixReal( dyn );
+		MixInt( LayersInConstruct );
+		for ( int Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
+			MixReal( dl( Layer ) );
+			MixReal( rk( Layer ) );
+			MixReal( rho( Layer ) );
+			MixReal( cp( Layer ) );
+			MixReal( lr( Layer ) );
+			MixInt( ResLayer( Layer ) );
+		}
+
+		return Key;
+
+	}
+
+	std::string
+	CTFCacheFileName( std::uint64_t const Key ) // CTF cache key of the construction
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the CTF cache file holding the CTFs for a key.
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataStringGlobals::altpathChar;
+		using DataSystemVariables::CTFCacheFolder;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char KeyString[ 17 ];
+
+		std::snprintf( KeyString, sizeof( KeyString ), "%016llx", static_cast< unsigned long long >( Key ) );
+		std::string FileName( CTFCacheFolder );
+		if ( FileName.back() != pathChar && FileName.back() != altpathChar ) FileName += pathChar;
+		return FileName + "eplusctf_" + KeyString + ".bin";
+
+	}
+
+	bool
+	ReadCTFCache(
+		std::uint64_t const Key, // CTF cache key of the construction
+		int const ConstrNum // Construction number
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the time step, number of histories and state space results (s0, s and e) of a
+		// construction from the CTF cache, so they can be transferred to the CTF arrays exactly
+		// as if they had just been calculated.  Returns false (and leaves everything untouched)
+		// if there is no usable cache file for the key.
+
+		// METHODOLOGY EMPLOYED:
+		// A cache file is the CTFCacheMagic tag and the key, the number of histories, the number
+		// of CTF terms and the CTF time step, followed by s0 and then s and e for each term.  The
+		// whole file is read and checked before anything is copied.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char Magic[ sizeof( CTFCacheMagic ) ];
+		std::uint64_t FileKey( 0 );
+		std::int32_t NumHistories( 0 );
+		std::int32_t NumCTFTerms( 0 );
+		Real64 CTFTimeStep( 0.0 );
+
+		std::ifstream CacheFile( CTFCacheFileName( Key ), std::ios::binary );
+		if ( ! CacheFile ) return false;
+
+		CacheFile.read( Magic, sizeof( Magic ) );
+		CacheFile.read( reinterpret_cast< char * >( &FileKey ), sizeof( FileKey ) );
+		CacheFile.read( reinterpret_cast< char * >( &NumHistories ), sizeof( NumHistories ) );
+		CacheFile.read( reinterpret_cast< char * >( &NumCTFTerms ), sizeof( NumCTFTerms ) );
+		CacheFile.read( reinterpret_cast< char * >( &CTFTimeStep ), sizeof( CTFTimeStep ) );
+		if ( ! CacheFile || std::memcmp( Magic, CTFCacheMagic, sizeof( Magic ) ) != 0 || FileKey != Key ) return false;
+		if ( NumHistories < 1 || NumCTFTerms < 1 || NumCTFTerms > MaxCTFTerms - 1 ) return false;
+
+		std::vector< Real64 > Payload( 12 * ( NumCTFTerms + 1 ) + NumCTFTerms );
+		if ( ! CacheFile.read( reinterpret_cast< char * >( Payload.data() ), Payload.size() * sizeof( Real64 ) ) ) return false;
+		if ( CacheFile.peek() != std::ifstream::traits_type::eof() ) return false;
+
+		std::size_t l( 0 );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				s0( i, j ) = Payload[ l++ ];
+			}
+		}
+		s.allocate( 3, 4, NumCTFTerms );
+		e.allocate( NumCTFTerms );
+		for ( int HistTerm = 1; HistTerm <= NumCTFTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 3; ++i ) {
+				for ( int j = 1; j <= 4; ++j ) {
+					s( i, j, HistTerm ) = Payload[ l++ ];
+				}
+			}
+			e( HistTerm ) = Payload[ l++ ];
+		}
+		Construct( ConstrNum ).NumHistories = NumHistories;
+		Construct( ConstrNum ).NumCTFTerms = NumCTFTerms;
+		Construct( ConstrNum ).CTFTimeStep = CTFTimeStep;
+		return true;
+
+	}
+
+	void
+	WriteCTFCache(
+		std::uint64_t const Key, // CTF cache key of the construction
+		int const ConstrNum // Construction number
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the state space results of a construction in the CTF cache (see ReadCTFCache).
+
+		// METHODOLOGY EMPLOYED:
+		// As for the shading cache, the file is written under a temporary name that includes the
+		// process id and then renamed, so runs sharing the cache folder never see a partially
+		// written file.  Failures are reported once as a warning.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool WarningIssued( false );
+
+		auto const & construct( Construct( ConstrNum ) );
+		std::int32_t const NumHistories( construct.NumHistories );
+		std::int32_t const NumCTFTerms( construct.NumCTFTerms );
+		Real64 const CTFTimeStep( construct.CTFTimeStep );
+
+		std::vector< Real64 > Payload;
+		Payload.reserve( 12 * ( NumCTFTerms + 1 ) + NumCTFTerms );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				Payload.push_back( s0( i, j ) );
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= NumCTFTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 3; ++i ) {
+				for ( int j = 1; j <= 4; ++j ) {
+					Payload.push_back( s( i, j, HistTerm ) );
+				}
+			}
+			Payload.push_back( e( HistTerm ) );
+		}
+
+		std::string const FileName( CTFCacheFileName( Key ) );
+#ifdef _WIN32
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( _getpid() ) );
+#else
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( getpid() ) );
+#endif
+		bool WriteOK;
+		{
+			std::ofstream CacheFile( TempFileName, std::ios::binary | std::ios::trunc );
+			CacheFile.write( CTFCacheMagic, sizeof( CTFCacheMagic ) );
+			CacheFile.write( reinterpret_cast< char const * >( &Key ), sizeof( Key ) );
+			CacheFile.write( reinterpret_cast< char const * >( &NumHistories ), sizeof( NumHistories ) );
+			CacheFile.write( reinterpret_cast< char const * >( &NumCTFTerms ), sizeof( NumCTFTerms ) );
+			CacheFile.write( reinterpret_cast< char const * >( &CTFTimeStep ), sizeof( CTFTimeStep ) );
+			CacheFile.write( reinterpret_cast< char const * >( Payload.data() ), Payload.size() * sizeof( Real64 ) );
+			CacheFile.close();
+			WriteOK = ! CacheFile.fail();
+		}
+		if ( WriteOK ) {
+#ifdef _WIN32
+			std::remove( FileName.c_str() ); // Rename does not replace an existing file on Windows
+#endif
+			WriteOK = ( std::rename( TempFileName.c_str(), FileName.c_str() ) == 0 );
+		}
+		if ( ! WriteOK ) {
+			std::remove( TempFileName.c_str() );
+			if ( ! WarningIssued ) {
+				ShowWarningError( "WriteCTFCache: Could not write CTF cache file=\"" + FileName + "\"." );
+				ShowContinueError( "CTFs for this construction will be recalculated in later runs." );
+				WarningIssued = true;
+			}
+		}
+
+	}
+
 	void
 	ReportCTFs( bool const DoReportBecauseError )
 	{
@@ -2092,6 +2373,8 @@ namespace ConductionTransferFunctionCalc {
 
 		// Using/Aliasing
 		using General::ScanForReports;
+		using General::RoundSigDigits;
+		using DataSystemVariables::CTFCacheFolder;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2132,6 +2415,10 @@ namespace ConductionTransferFunctionCalc {
 			gio::write( OutputFileInits, fmtA ) << "! <Material CTF Summary>,Material Name,Thickness {m},Conductivity {w/m-K},Density {kg/m3},Specific Heat {J/kg-K},ThermalResistance {m2-K/w}";
 			gio::write( OutputFileInits, fmtA ) << "! <Material:Air>,Material Name,ThermalResistance {m2-K/w}";
 			gio::write( OutputFileInits, fmtA ) << "! <CTF>,Time,Outside,Cross,Inside,Flux (except final one)";
+			if ( ! CTFCacheFolder.empty() ) {
+				gio::write( OutputFileInits, fmtA ) << "! <CTF Cache>,Cache Folder,Constructions Looked Up,Constructions Found,Hit Rate {%}";
+				gio::write( OutputFileInits, fmtA ) << " CTF Cache," + CTFCacheFolder + ',' + RoundSigDigits( NumCTFCacheLookups ) + ',' + RoundSigDigits( NumCTFCacheHits ) + ',' + RoundSigDigits( NumCTFCacheLookups > 0 ? 100.0 * NumCTFCacheHits / NumCTFCacheLookups : 0.0, 1 );
+			}
 
 			for ( ThisNum = 1; ThisNum <= TotConstructs; ++ThisNum ) {
 
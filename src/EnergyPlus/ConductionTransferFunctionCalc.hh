@@ -1,6 +1,10 @@
 #ifndef ConductionTransferFunctionCalc_hh_INCLUDED
 #define ConductionTransferFunctionCalc_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <string>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -52,6 +56,10 @@ namespace ConductionTransferFunctionCalc {
 	extern Real64 TinyLimit;
 	extern Array2D< Real64 > IdenMatrix; // Identity Matrix
 
+	extern char const CTFCacheMagic[ 8 ]; // Tag at the start of CTF cache files
+	extern int NumCTFCacheLookups; // Constructions looked up in the CTF cache
+	extern int NumCTFCacheHits; // Constructions whose CTFs were loaded from the CTF cache
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
 	// Functions
@@ -77,6 +85,34 @@ namespace ConductionTransferFunctionCalc {
 		int const SolutionDimensions // Integer relating whether a 1- or 2-D solution is required
 	);
 
+	std::uint64_t
+	CTFCacheKey(
+		int const ConstrNum, // Construction number
+		int const LayersInConstruct, // Number of layers after combining adjacent resistive layers
+		Array1< Real64 > const & dl, // Thickness of each layer
+		Array1< Real64 > const & rk, // Thermal conductivity of each layer
+		Array1< Real64 > const & rho, // Density of each layer
+		Array1< Real64 > const & cp, // Specific heat of each layer
+		Array1< Real64 > const & lr, // R value of each layer
+		Array1_bool const & ResLayer, // True if the layer is handled as a resistive layer
+		Real64 const dyn // Nodal spacing in the direction perpendicular to the main direction
+	);
+
+	std::string
+	CTFCacheFileName( std::uint64_t const Key ); // CTF cache key of the construction
+
+	bool
+	ReadCTFCache(
+		std::uint64_t const Key, // CTF cache key of the construction
+		int const ConstrNum // Construction number
+	);
+
+	void
+	WriteCTFCache(
+		std::uint64_t const Key, // CTF cache key of the construction
+		int const ConstrNum // Construction number
+	);
+
 	void
 	ReportCTFs( bool const DoReportBecauseError );
 
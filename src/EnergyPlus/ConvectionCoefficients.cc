@@ -182,6 +182,10 @@ namespace ConvectionCoefficients {
 	Real64 CubeRootOfOverallBuildingVolume( 0.0 ); // building meta data. cube root of the volume of all the zones
 	Real64 RoofLongAxisOutwardAzimuth( 0.0 ); // roof surfaces meta data. outward normal azimuth for longest roof edge
 
+	Array1D_int ZoneIntConvFlowRegime; // zone flow regime for the adaptive inside face algorithm
+	Array1D_int ZoneIntConvEquipFlowRegime; // zone flow regime of the dominant equipment, before checking for mixed flow
+	Array1D_bool ZoneIntConvFlowRegimeCurrent; // zone flow regime has been determined in this call of InitInteriorConvectionCoeffs
+
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
 
@@ -208,6 +212,7 @@ namespace ConvectionCoefficients {
 		//       DATE WRITTEN   March 1998
 		//       MODIFIED       Dan Fisher, Nov 2000
 		//                      Sep 2011 LKL/BG - resimulate only zones needing it for Radiant systems
+		//                      Oct 2026, adaptive algorithm zone flow regimes determined once per call
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -341,6 +346,15 @@ namespace ConvectionCoefficients {
 			}}
 
 		}
+
+		// Zone flow regimes for the adaptive algorithm do not change during this call
+		if ( ! allocated( ZoneIntConvFlowRegimeCurrent ) ) {
+			ZoneIntConvFlowRegime.dimension( NumOfZones, 0 );
+			ZoneIntConvEquipFlowRegime.dimension( NumOfZones, 0 );
+			ZoneIntConvFlowRegimeCurrent.dimension( NumOfZones, false );
+		}
+		ZoneIntConvFlowRegimeCurrent = false;
+
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
 			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
@@ -423,6 +437,9 @@ namespace ConvectionCoefficients {
 			}
 		}
 
+		// Conditions may change before the next call
+		ZoneIntConvFlowRegimeCurrent = false;
+
 	}
 
 	void
@@ -6219,24 +6236,25 @@ namespace ConvectionCoefficients {
 
 	}
 
-	void
-	DynamicIntConvSurfaceClassification( int const SurfNum ) // surface number
+	int
+	CalcZoneIntConvFlowRegime(
+		int const ZoneNum, // zone number
+		int & EquipFlowRegime // flow regime of the dominant equipment, before checking for mixed flow
+	)
 	{
 
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR        Brent Griffith
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Aug 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, split out of DynamicIntConvSurfaceClassification
 		//       RE-ENGINEERED  na
 
-		// PURPOSE OF THIS SUBROUTINE:
-		// collects dynamic updates needed for adaptive convectin algorithm
+		// PURPOSE OF THIS FUNCTION:
+		// Determines the flow regime of a zone for the adaptive convection algorithm
 
 		// METHODOLOGY EMPLOYED:
-		// Decide flow regime to set IntConvClassification
-		//  done by zone using the following rules
-
-		// Using zone flow regime, and surface's characteristics assign IntConvHcModelEq
+		// The regime of the highest priority equipment that is on, or buoyancy if none is on.
+		// Central and zone air regimes are changed to buoyancy or mixed from the Richardson number.
 
 		// REFERENCES:
 		// na
@@ -6249,22 +6267,18 @@ namespace ConvectionCoefficients {
 		using Psychrometrics::PsyRhoAirFnPbTdbW;
 		using Psychrometrics::PsyWFnTdpPb;
 
+		// Return value
+		int FinalFlowRegime; // flow regime of the zone
+
 		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// FUNCTION ARGUMENT DEFINITIONS:
 
-		// SUBROUTINE PARAMETER DEFINITIONS:
+		// FUNCTION PARAMETER DEFINITIONS:
 		Real64 const g( 9.81 ); // gravity constant (m/s**2)
 		Real64 const v( 15.89e-6 ); // kinematic viscosity (m**2/s) for air at 300 K
 		Real64 const ActiveDelTempThreshold( 1.5 ); // deg C, temperature difference for surfaces to be considered "active"
 
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
-
-		// DERIVED TYPE DEFINITIONS:
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ZoneNum( 0 );
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		static int PriorityEquipOn( 0 );
 		static Array1D_int HeatingPriorityStack( {0,10}, 0 );
 		static Array1D_int CoolingPriorityStack( {0,10}, 0 );
@@ -6275,18 +6289,16 @@ namespace ConvectionCoefficients {
 		static int EquipOnLoop( 0 );
 		static int thisZoneInletNode( 0 );
 		//  INTEGER :: thisZnEqInletNode = 0
-		static int FinalFlowRegime( 0 );
 		static Real64 Tmin( 0.0 ); // temporary min surf temp
 		static Real64 Tmax( 0.0 ); // temporary max surf temp
 		static Real64 GrH( 0.0 ); // Grashof number for zone height H
 		static Real64 Re( 0.0 ); // Reynolds number for zone air system flow
 		static Real64 Ri( 0.0 ); // Richardson Number, Gr/Re**2 for determining mixed regime
 		static Real64 AirDensity( 0.0 ); // temporary zone air density
-		static Real64 DeltaTemp( 0.0 ); // temporary temperature difference (Tsurf - Tair)
+		Real64 DeltaTemp; // temporary temperature difference (Tsurf - Tair)
 		int SurfLoop; // local for separate looping across surfaces in the zone that has SurfNum
 
 		EquipOnCount = 0;
-		ZoneNum = Surface( SurfNum ).Zone;
 		ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
 		FlowRegimeStack = 0;
 
@@ -6441,6 +6453,7 @@ namespace ConvectionCoefficients {
 			// no equipment on, so simple bouyancy flow regime
 			FinalFlowRegime = InConvFlowRegime_A3;
 		}
+		EquipFlowRegime = FinalFlowRegime;
 
 		// now if flow regimes C or D, then check for Mixed regime or very low flow rates
 		if ( ( FinalFlowRegime == InConvFlowRegime_C ) || ( FinalFlowRegime == InConvFlowRegime_D ) ) {
@@ -6473,6 +6486,70 @@ namespace ConvectionCoefficients {
 			}
 		}
 
+		return FinalFlowRegime;
+
+	}
+
+	void
+	DynamicIntConvSurfaceClassification( int const SurfNum ) // surface number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR        Brent Griffith
+		//       DATE WRITTEN   Aug 2010
+		//       MODIFIED       Oct 2026, zone flow regime from CalcZoneIntConvFlowRegime, once per zone in InitInteriorConvectionCoeffs
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// collects dynamic updates needed for adaptive convectin algorithm
+
+		// METHODOLOGY EMPLOYED:
+		// Decide flow regime to set IntConvClassification
+		//  done by zone using the following rules
+
+		// Using zone flow regime, and surface's characteristics assign IntConvHcModelEq
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataHeatBalSurface::TH;
+		using DataHeatBalFanSys::MAT;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum; // zone of the surface
+		int FinalFlowRegime; // flow regime of the zone
+		int EquipFlowRegime; // flow regime of the dominant equipment, before checking for mixed flow
+		Real64 DeltaTemp; // temporary temperature difference (Tsurf - Tair)
+
+		ZoneNum = Surface( SurfNum ).Zone;
+
+		// The flow regime is a property of the zone, so it is only determined for the first surface of
+		// the zone in each call of InitInteriorConvectionCoeffs
+		if ( allocated( ZoneIntConvFlowRegimeCurrent ) && ZoneIntConvFlowRegimeCurrent( ZoneNum ) ) {
+			FinalFlowRegime = ZoneIntConvFlowRegime( ZoneNum );
+			EquipFlowRegime = ZoneIntConvEquipFlowRegime( ZoneNum );
+		} else {
+			FinalFlowRegime = CalcZoneIntConvFlowRegime( ZoneNum, EquipFlowRegime );
+			if ( allocated( ZoneIntConvFlowRegimeCurrent ) ) {
+				ZoneIntConvFlowRegime( ZoneNum ) = FinalFlowRegime;
+				ZoneIntConvEquipFlowRegime( ZoneNum ) = EquipFlowRegime;
+				ZoneIntConvFlowRegimeCurrent( ZoneNum ) = true;
+			}
+		}
+
 		// now finish out specific model eq for this surface
 		//Surface(SurfNum)%IntConvClassification = 0 !init/check
 		{ auto const SELECT_CASE_var( FinalFlowRegime );
@@ -6876,7 +6953,7 @@ namespace ConvectionCoefficients {
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				//mixed regime, but need to know what regime it was before it was mixed
-				{ auto const SELECT_CASE_var1( FlowRegimeStack( PriorityEquipOn ) );
+				{ auto const SELECT_CASE_var1( EquipFlowRegime );
 
 				if ( SELECT_CASE_var1 == InConvFlowRegime_C ) {
 					//assume forced flow is down along wall (ceiling diffuser)
@@ -133,6 +133,10 @@ namespace ConvectionCoefficients {
 	extern Real64 CubeRootOfOverallBuildingVolume; // building meta data. cube root of the volume of all the zones
 	extern Real64 RoofLongAxisOutwardAzimuth; // roof surfaces meta data. outward normal azimuth for longest roof edge
 
+	extern Array1D_int ZoneIntConvFlowRegime; // zone flow regime for the adaptive inside face algorithm
+	extern Array1D_int ZoneIntConvEquipFlowRegime; // zone flow regime of the dominant equipment, before checking for mixed flow
+	extern Array1D_bool ZoneIntConvFlowRegimeCurrent; // zone flow regime has been determined in this call of InitInteriorConvectionCoeffs
+
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
 
@@ -927,6 +931,12 @@ namespace ConvectionCoefficients {
 	void
 	MapExtConvClassificationToHcModels( int const SurfNum ); // surface number
 
+	int
+	CalcZoneIntConvFlowRegime(
+		int const ZoneNum, // zone number
+		int & EquipFlowRegime // flow regime of the dominant equipment, before checking for mixed flow
+	);
+
 	void
 	DynamicIntConvSurfaceClassification( int const SurfNum ); // surface number
 
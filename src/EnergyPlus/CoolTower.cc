@@ -407,7 +407,7 @@ namespace CoolTower {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Daeho Kang
 		//       DATE WRITTEN   Aug 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, outdoor humidity ratio once per call
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -475,6 +475,9 @@ namespace CoolTower {
 		MCPC = 0.0;
 		CTMFL = 0.0;
 
+		// Outdoor air humidity ratio is the same for every cooltower
+		InletHumRat = PsyWFnTdbTwbPb( OutDryBulbTemp, OutWetBulbTemp, OutBaroPress );
+
 		for ( CoolTowerNum = 1; CoolTowerNum <= NumCoolTowers; ++CoolTowerNum ) {
 			ZoneNum = CoolTowerSys( CoolTowerNum ).ZonePtr;
 
@@ -533,7 +536,6 @@ namespace CoolTower {
 				}
 
 				// Determine air mass flow rate and volume flow rate
-				InletHumRat = PsyWFnTdbTwbPb( OutDryBulbTemp, OutWetBulbTemp, OutBaroPress );
 				// Assume no pressure drops and no changes in enthalpy between inlet and outlet air
 				IntHumRat = PsyWFnTdbH( OutletTemp, OutEnthalpy ); // Initialized humidity ratio
 				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, OutletTemp, IntHumRat );
@@ -16,6 +16,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -418,6 +419,8 @@ namespace CurveManager {
 
 		// Find the number of each type of curve (note: Current Module object not used here, must rename manually)
 
+		DataTimings::ProfileTimer const profileTimer( "GetCurveInput" ); // Region of the timing profile
+
 		NumBiQuad = GetNumObjectsFound( "Curve:Biquadratic" );
 		NumCubic = GetNumObjectsFound( "Curve:Cubic" );
 		NumQuartic = GetNumObjectsFound( "Curve:Quartic" );
@@ -3680,7 +3683,7 @@ Label999: ;
 		// returns the value of an equipment performance table lookup.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The table intervals are found by FindPerfCurveTableInterval.
 
 		// REFERENCES:
 		// na
@@ -3707,10 +3710,6 @@ Label999: ;
 		Real64 V1; // 1st independent variable after limits imposed
 		Real64 V2; // 2nd independent variable after limits imposed
 		Real64 V3; // 3rd independent variable after limits imposed
-		Real64 TempX1Low;
-		Real64 TempX1High;
-		Real64 TempX2Low;
-		Real64 TempX2High;
 		//INTEGER   :: ATempX1LowPtr(1)
 		//INTEGER   :: ATempX1HighPtr(1)
 		//INTEGER   :: ATempX2LowPtr(1)
@@ -3724,11 +3723,11 @@ Label999: ;
 		Real64 X1ValLow;
 		Real64 X1ValHigh;
 		//INTEGER   :: MaxSizeArray
-		int X1Val;
-		int X2Val;
 		int TableIndex;
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
+		auto & Table( PerfCurveTableData( TableIndex ) );
+		if ( ! Table.LimitsSet ) SetPerfCurveTableLimits( Table );
 
 		V1 = max( min( Var1, PerfCurve( CurveIndex ).Var1Max ), PerfCurve( CurveIndex ).Var1Min );
 
@@ -3747,24 +3746,7 @@ Label999: ;
 		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
-			if ( V1 <= TempX1Low ) {
-				TempX1LowPtr = 1;
-				TempX1HighPtr = 1;
-			} else if ( V1 >= TempX1High ) {
-				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
-				TempX1HighPtr = TempX1LowPtr;
-			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
-				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
-					TempX1HighPtr = TempX1LowPtr;
-				} else {
-					TempX1HighPtr = TempX1LowPtr + 1;
-				}
-			}
+			FindPerfCurveTableInterval( V1, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, TempX1LowPtr, TempX1HighPtr );
 			if ( TempX1LowPtr == TempX1HighPtr ) {
 				TableValue = PerfCurveTableData( TableIndex ).Y( 1, TempX1LowPtr );
 			} else {
@@ -3774,43 +3756,8 @@ Label999: ;
 
 		} else if ( SELECT_CASE_var == 2 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
-			if ( V1 <= TempX1Low ) {
-				TempX1LowPtr = 1;
-				TempX1HighPtr = 1;
-			} else if ( V1 >= TempX1High ) {
-				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
-				TempX1HighPtr = TempX1LowPtr;
-			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
-				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
-					TempX1HighPtr = TempX1LowPtr;
-				} else {
-					TempX1HighPtr = TempX1LowPtr + 1;
-				}
-			}
-			TempX2Low = minval( PerfCurveTableData( TableIndex ).X2 );
-			TempX2High = maxval( PerfCurveTableData( TableIndex ).X2 );
-
-			if ( V2 <= TempX2Low ) {
-				TempX2LowPtr = 1;
-				TempX2HighPtr = 1;
-			} else if ( V2 >= TempX2High ) {
-				TempX2LowPtr = size( PerfCurveTableData( TableIndex ).X2 );
-				TempX2HighPtr = TempX2LowPtr;
-			} else {
-				for ( X2Val = 1; X2Val <= isize( PerfCurveTableData( TableIndex ).X2 ); ++X2Val ) {
-					if ( V2 >= PerfCurveTableData( TableIndex ).X2( X2Val ) ) TempX2LowPtr = X2Val;
-				}
-				if ( V2 == PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) {
-					TempX2HighPtr = TempX2LowPtr;
-				} else {
-					TempX2HighPtr = TempX2LowPtr + 1;
-				}
-			}
+			FindPerfCurveTableInterval( V1, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, TempX1LowPtr, TempX1HighPtr );
+			FindPerfCurveTableInterval( V2, Table.X2, Table.X2Min, Table.X2Max, Table.X2Ascending, Table.X2Hint, TempX2LowPtr, TempX2HighPtr );
 
 			if ( TempX1LowPtr == TempX1HighPtr ) {
 				if ( TempX2LowPtr == TempX2HighPtr ) {
@@ -3845,6 +3792,100 @@ Label999: ;
 
 	}
 
+	void
+	SetPerfCurveTableLimits( PerfCurveTableDataStruct & Table ) // table data
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the limits and order of the independent variable values of a performance table,
+		// once, instead of on every table lookup.
+
+		Table.X1Min = ( Table.X1.empty() ? 0.0 : minval( Table.X1 ) );
+		Table.X1Max = ( Table.X1.empty() ? 0.0 : maxval( Table.X1 ) );
+		Table.X2Min = ( Table.X2.empty() ? 0.0 : minval( Table.X2 ) );
+		Table.X2Max = ( Table.X2.empty() ? 0.0 : maxval( Table.X2 ) );
+		Table.X1Ascending = true;
+		for ( int Loop = 2; Loop <= Table.X1.isize(); ++Loop ) {
+			if ( Table.X1( Loop ) < Table.X1( Loop - 1 ) ) Table.X1Ascending = false;
+		}
+		Table.X2Ascending = true;
+		for ( int Loop = 2; Loop <= Table.X2.isize(); ++Loop ) {
+			if ( Table.X2( Loop ) < Table.X2( Loop - 1 ) ) Table.X2Ascending = false;
+		}
+		Table.X1Hint = 1;
+		Table.X2Hint = 1;
+		Table.LimitsSet = true;
+
+	}
+
+	void
+	FindPerfCurveTableInterval(
+		Real64 const V, // independent variable value
+		Array1D< Real64 > const & X, // independent variable table values
+		Real64 const XMin, // smallest table value
+		Real64 const XMax, // largest table value
+		bool const XAscending, // table values are in ascending order
+		int & Hint, // low index of the interval found last (updated)
+		int & LowPtr, // index of the table value at or below V
+		int & HighPtr // index of the table value above V (LowPtr if V is at a table value or out of range)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the table values of an independent variable of a performance table that the
+		// variable value lies between.
+
+		// METHODOLOGY EMPLOYED:
+		// Values at or beyond the limits use the first or last table value.  Otherwise the low point
+		// is the last table value at or below V.  With values in ascending order this is the interval
+		// found last when V is still in it (table lookups come in runs of similar values), else it
+		// is found by interval halving.  Values out of order are searched as they always were.
+
+		if ( V <= XMin ) {
+			LowPtr = 1;
+			HighPtr = 1;
+		} else if ( V >= XMax ) {
+			LowPtr = X.isize();
+			HighPtr = LowPtr;
+		} else {
+			if ( XAscending ) {
+				int const NumX( X.isize() );
+				if ( ( Hint < 1 ) || ( Hint >= NumX ) || ( V < X( Hint ) ) || ( V >= X( Hint + 1 ) ) ) {
+					int beg( 1 ), mid, end( NumX ); // Invariant: X( beg ) <= V < X( end )
+					while ( beg + 1 < end ) {
+						mid = ( ( beg + end ) >> 1 );
+						( V >= X( mid ) ? beg : end ) = mid;
+					}
+					Hint = beg;
+				}
+				LowPtr = Hint;
+			} else {
+				LowPtr = 0;
+				for ( int Loop = 1; Loop <= X.isize(); ++Loop ) {
+					if ( V >= X( Loop ) ) LowPtr = Loop;
+				}
+			}
+			if ( V == X( LowPtr ) ) {
+				HighPtr = LowPtr;
+			} else {
+				HighPtr = LowPtr + 1;
+			}
+		}
+
+	}
+
 	Real64
 	TableLookupObject(
 		int const CurveIndex, // index of curve in curve array
@@ -3906,11 +3947,6 @@ Label999: ;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
 		Array2D< Real64 > TWODVALS;
 		Array3D< Real64 > THREEDVALS;
-		Array1D< Real64 > VALSX;
-		Array1D< Real64 > VALSY;
-		Array1D< Real64 > VALSV3;
-		Array1D< Real64 > VALSV4;
-		Array1D< Real64 > VALSV5;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
@@ -3930,6 +3966,11 @@ Label999: ;
 		int NUMPT;
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
+		auto & VALSX( TableLookup( TableIndex ).X1Var ); // Table values are used in place
+		auto & VALSY( TableLookup( TableIndex ).X2Var );
+		auto & VALSV3( TableLookup( TableIndex ).X3Var );
+		auto & VALSV4( TableLookup( TableIndex ).X4Var );
+		auto & VALSV5( TableLookup( TableIndex ).X5Var );
 
 		V1 = max( min( Var1, PerfCurve( CurveIndex ).Var1Max ), PerfCurve( CurveIndex ).Var1Min );
 
@@ -4018,32 +4059,17 @@ Label999: ;
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = 1;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
 			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
 		} else if ( SELECT_CASE_var == 2 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
 			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
 		} else if ( SELECT_CASE_var == 3 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NV3 = TableLookup( TableIndex ).NumX3Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
 			TWODVALS.allocate( 1, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
@@ -4055,23 +4081,12 @@ Label999: ;
 				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
 			}
 			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
 		} else if ( SELECT_CASE_var == 4 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NV3 = TableLookup( TableIndex ).NumX3Vars;
 			NV4 = TableLookup( TableIndex ).NumX4Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
 			TWODVALS.allocate( NV4, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
@@ -4082,10 +4097,6 @@ Label999: ;
 			// final interpolation of 2-D array in V3 and V4
 			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
 			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
 		} else if ( SELECT_CASE_var == 5 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
@@ -4093,16 +4104,6 @@ Label999: ;
 			NV4 = TableLookup( TableIndex ).NumX4Vars;
 			NV5 = TableLookup( TableIndex ).NumX5Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
 			THREEDVALS.allocate( NV5, NV4, NV3 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
 				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
@@ -4122,11 +4123,6 @@ Label999: ;
 			}
 			TWODVALS.deallocate();
 			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
 		} else {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
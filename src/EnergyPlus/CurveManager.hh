@@ -258,9 +258,28 @@ namespace CurveManager {
 		Array1D< Real64 > X1;
 		Array1D< Real64 > X2;
 		Array2D< Real64 > Y;
+		// X1 and X2 limits and order, found on first use (SetPerfCurveTableLimits)
+		bool LimitsSet; // Limits and order below have been found
+		Real64 X1Min; // Smallest X1
+		Real64 X1Max; // Largest X1
+		Real64 X2Min; // Smallest X2
+		Real64 X2Max; // Largest X2
+		bool X1Ascending; // X1 values are in ascending order
+		bool X2Ascending; // X2 values are in ascending order
+		int X1Hint; // Low index of the X1 interval found last
+		int X2Hint; // Low index of the X2 interval found last
 
 		// Default Constructor
-		PerfCurveTableDataStruct()
+		PerfCurveTableDataStruct() :
+			LimitsSet( false ),
+			X1Min( 0.0 ),
+			X1Max( 0.0 ),
+			X2Min( 0.0 ),
+			X2Max( 0.0 ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1Hint( 1 ),
+			X2Hint( 1 )
 		{}
 
 		// Member Constructor
@@ -271,7 +290,16 @@ namespace CurveManager {
 		) :
 			X1( X1 ),
 			X2( X2 ),
-			Y( Y )
+			Y( Y ),
+			LimitsSet( false ),
+			X1Min( 0.0 ),
+			X1Max( 0.0 ),
+			X2Min( 0.0 ),
+			X2Max( 0.0 ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1Hint( 1 ),
+			X2Hint( 1 )
 		{}
 
 	};
@@ -607,6 +635,21 @@ namespace CurveManager {
 		Optional< Real64 const > Var3 = _ // 3rd independent variable
 	);
 
+	void
+	SetPerfCurveTableLimits( PerfCurveTableDataStruct & Table ); // table data
+
+	void
+	FindPerfCurveTableInterval(
+		Real64 const V, // independent variable value
+		Array1D< Real64 > const & X, // independent variable table values
+		Real64 const XMin, // smallest table value
+		Real64 const XMax, // largest table value
+		bool const XAscending, // table values are in ascending order
+		int & Hint, // low index of the interval found last (updated)
+		int & LowPtr, // index of the table value at or below V
+		int & HighPtr // index of the table value above V (LowPtr if V is at a table value or out of range)
+	);
+
 	Real64
 	TableLookupObject(
 		int const CurveIndex, // index of curve in curve array
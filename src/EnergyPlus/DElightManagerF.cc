@@ -1,6 +1,16 @@
 // C++ Headers
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -20,6 +30,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
@@ -68,6 +79,9 @@ namespace DElightManagerF {
 	using namespace DataPrecisionGlobals;
 	using namespace DataDElight;
 
+	// MODULE PARAMETER DEFINITIONS:
+	char const DElightCacheMagic[ 8 ] = { 'E', 'P', 'D', 'L', 'I', 'T', '0', '1' }; // Tag at the start of DElight cache files
+
 	void
 	DElightInputGenerator()
 	{
@@ -692,14 +706,208 @@ namespace DElightManagerF {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   September 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse the daylight factors in the DElight cache
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// The purpose of this subroutine is to provide an envelop to the DElightDaylightCoefficients routine
 
+		// METHODOLOGY EMPLOYED:
+		// When EP_DELIGHT_CACHE names a folder, the DElight input file written by DElightInputGenerator
+		// is hashed.  If the folder holds the daylight factors for that hash, DElight only loads its
+		// building data and the factors are restored from the cache, skipping the radiosity solution.
+		// Otherwise the factors are calculated and, if DElight reported no warnings or errors, stored.
+
+		// Using/Aliasing
+		using DataStringGlobals::outputDelightInFileName;
+		using DataSystemVariables::DElightCacheFolder;
+
+		if ( DElightCacheFolder.empty() ) {
+			delightdaylightcoefficients( dLatitude, &iErrorFlag );
+			return;
+		}
+
+		std::ifstream inputFile( outputDelightInFileName, std::ios::binary );
+		std::stringstream inputText;
+		inputText << inputFile.rdbuf();
+		std::uint64_t const cacheKey( DElightCacheKey( inputText.str() ) );
+
+		std::vector< Real64 > factors;
+		if ( ReadDElightCache( cacheKey, factors ) ) {
+			int loadErrorFlag( 0 );
+			delightloadbuilding( &loadErrorFlag );
+			if ( loadErrorFlag == 0 && delightnumdaylightfactors() == int( factors.size() ) ) {
+				delightsetdaylightfactors( factors.data() );
+				iErrorFlag = 0;
+				return;
+			}
+		}
+
 		delightdaylightcoefficients( dLatitude, &iErrorFlag );
+		if ( iErrorFlag == 0 ) {
+			factors.resize( delightnumdaylightfactors() );
+			delightgetdaylightfactors( factors.data() );
+			WriteDElightCache( cacheKey, factors );
+		}
+
+	}
+
+	std::uint64_t
+	DElightCacheKey( std::string const & DElightInput ) // Contents of the DElight input file
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the key under which the DElight daylight factors of a building are stored in the DElight cache.
+
+		// METHODOLOGY EMPLOYED:
+		// 64 bit FNV-1a hash of the DElight input file, which holds everything the daylight factors
+		// depend on: the site, the zone, surface, window and reference point geometry, and the
+		// constructions.  The first line only holds the time the file was written and is skipped.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::uint64_t const FNVOffsetBasis( 14695981039346656037ULL );
+		std::uint64_t const FNVPrime( 1099511628211ULL );
+		unsigned char const CacheVersion( 1 ); // Change when the DElight calculation or the cached data changes
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Key( FNVOffsetBasis );
+
+		Key ^= CacheVersion;
+		Key *= FNVPrime;
+		std::string::size_type const FirstLineEnd( DElightInput.find( '\n' ) );
+		for ( std::string::size_type i = ( FirstLineEnd == std::string::npos ? 0 : FirstLineEnd + 1 ); i < DElightInput.size(); ++i ) {
+			Key ^= static_cast< unsigned char >( DElightInput[ i ] );
+			Key *= FNVPrime;
+		}
+
+		return Key;
+	}
+
+	std::string
+	DElightCacheFileName( std::uint64_t const key ) // DElight cache key of the building
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the DElight cache file holding the daylight factors for a key.
 
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataStringGlobals::altpathChar;
+		using DataSystemVariables::DElightCacheFolder;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char keyString[ 17 ];
+
+		std::snprintf( keyString, sizeof( keyString ), "%016llx", static_cast< unsigned long long >( key ) );
+		std::string fileName( DElightCacheFolder );
+		if ( fileName.back() != pathChar && fileName.back() != altpathChar ) fileName += pathChar;
+		return fileName + "eplusdelight_" + keyString + ".bin";
+	}
+
+	bool
+	ReadDElightCache(
+		std::uint64_t const key, // DElight cache key of the building
+		std::vector< Real64 > & factors // Reference point daylight factors, in delightgetdaylightfactors order
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the DElight daylight factors for a key from the DElight cache.  Returns false (and
+		// leaves the factors empty) if there is no usable cache file for the key.
+
+		// METHODOLOGY EMPLOYED:
+		// A cache file is the DElightCacheMagic tag, the key and the number of factors, followed by
+		// the factors.  The whole file is read and checked before it is used.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char magic[ sizeof( DElightCacheMagic ) ];
+		std::uint64_t fileKey( 0 );
+		std::int32_t numFactors( 0 );
+
+		factors.clear();
+		std::ifstream cacheFile( DElightCacheFileName( key ), std::ios::binary );
+		if ( ! cacheFile ) return false;
+
+		cacheFile.read( magic, sizeof( magic ) );
+		cacheFile.read( reinterpret_cast< char * >( &fileKey ), sizeof( fileKey ) );
+		cacheFile.read( reinterpret_cast< char * >( &numFactors ), sizeof( numFactors ) );
+		if ( ! cacheFile || std::memcmp( magic, DElightCacheMagic, sizeof( magic ) ) != 0 || fileKey != key || numFactors < 0 ) return false;
+
+		std::vector< Real64 > payload( numFactors );
+		if ( ! cacheFile.read( reinterpret_cast< char * >( payload.data() ), payload.size() * sizeof( Real64 ) ) ) return false;
+		if ( cacheFile.peek() != std::ifstream::traits_type::eof() ) return false;
+
+		factors.swap( payload );
+		return true;
+	}
+
+	void
+	WriteDElightCache(
+		std::uint64_t const key, // DElight cache key of the building
+		std::vector< Real64 > const & factors // Reference point daylight factors, in delightgetdaylightfactors order
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the DElight daylight factors for a key in the DElight cache (see ReadDElightCache).
+
+		// METHODOLOGY EMPLOYED:
+		// As for the CTF and g-function caches, the file is written under a temporary name that
+		// includes the process id and then renamed, so runs sharing the cache folder never see a
+		// partially written file.  A failure is reported as a warning.
+
+		std::int32_t const numFactors( factors.size() );
+		std::string const fileName( DElightCacheFileName( key ) );
+#ifdef _WIN32
+		std::string const tempFileName( fileName + ".tmp" + std::to_string( _getpid() ) );
+#else
+		std::string const tempFileName( fileName + ".tmp" + std::to_string( getpid() ) );
+#endif
+		bool writeOK;
+		{
+			std::ofstream cacheFile( tempFileName, std::ios::binary | std::ios::trunc );
+			cacheFile.write( DElightCacheMagic, sizeof( DElightCacheMagic ) );
+			cacheFile.write( reinterpret_cast< char const * >( &key ), sizeof( key ) );
+			cacheFile.write( reinterpret_cast< char const * >( &numFactors ), sizeof( numFactors ) );
+			cacheFile.write( reinterpret_cast< char const * >( factors.data() ), factors.size() * sizeof( Real64 ) );
+			cacheFile.close();
+			writeOK = ! cacheFile.fail();
+		}
+		if ( writeOK ) {
+#ifdef _WIN32
+			std::remove( fileName.c_str() ); // Rename does not replace an existing file on Windows
+#endif
+			writeOK = ( std::rename( tempFileName.c_str(), fileName.c_str() ) == 0 );
+		}
+		if ( ! writeOK ) {
+			std::remove( tempFileName.c_str() );
+			ShowWarningError( "WriteDElightCache: Could not write DElight cache file=\"" + fileName + "\"." );
+			ShowContinueError( "DElight daylight factors will be recalculated in later runs." );
+		}
 	}
 
 	void
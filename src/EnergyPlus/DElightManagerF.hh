@@ -2,7 +2,9 @@
 #define DElightManagerF_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <string>
+#include <vector>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -20,6 +22,24 @@ namespace DElightManagerF {
 		int & iErrorFlag
 	);
 
+	std::uint64_t
+	DElightCacheKey( std::string const & DElightInput ); // Contents of the DElight input file
+
+	std::string
+	DElightCacheFileName( std::uint64_t const key ); // DElight cache key of the building
+
+	bool
+	ReadDElightCache(
+		std::uint64_t const key, // DElight cache key of the building
+		std::vector< Real64 > & factors // Reference point daylight factors, in delightgetdaylightfactors order
+	);
+
+	void
+	WriteDElightCache(
+		std::uint64_t const key, // DElight cache key of the building
+		std::vector< Real64 > const & factors // Reference point daylight factors, in delightgetdaylightfactors order
+	);
+
 	void
 	CheckForGeometricTransform(
 		bool & doTransform,
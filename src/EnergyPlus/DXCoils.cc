@@ -189,6 +189,7 @@ namespace DXCoils {
 	int NumDXMulSpeedCoolCoils( 0 ); // number of multispeed DX cooling coils
 	int NumDXMulSpeedHeatCoils( 0 ); // number of multispeed DX heating coils
 	Array1D_bool CheckEquipName;
+	Array1D_bool ReportSensLatCoolingEnergy; // True if the coil's sensible or latent cooling energy is stored for output
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -992,6 +993,7 @@ namespace DXCoils {
 		DXCoilNumericFields.allocate( NumDXCoils );
 		HeatReclaimDXCoil.allocate( NumDXCoils );
 		CheckEquipName.dimension( NumDXCoils, true );
+		ReportSensLatCoolingEnergy.dimension( NumDXCoils, true );
 
 		// Module level variable arrays
 		DXCoilOutletTemp.allocate( NumDXCoils );
@@ -4728,6 +4730,12 @@ namespace DXCoils {
 			SetupOutputVariable( "Heating Coil Total Heating Energy [J]", DXCoil( DXCoilNum ).TotalHeatingEnergy, "System", "Sum", DXCoil( DXCoilNum ).Name, _, "ENERGYTRANSFER", "HEATINGCOILS", _, "System" );
 			SetupOutputVariable( "Heating Coil Runtime Fraction []", DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, "System", "Average", DXCoil( DXCoilNum ).Name );
 		}
+
+		// The sensible and latent cooling energies are report-only; skip them in ReportDXCoil when not stored
+		for ( DXCoilNum = 1; DXCoilNum <= NumDXCoils; ++DXCoilNum ) {
+			ReportSensLatCoolingEnergy( DXCoilNum ) = OutputVariableIsStored( DXCoil( DXCoilNum ).Name, "Cooling Coil Sensible Cooling Energy" ) || OutputVariableIsStored( DXCoil( DXCoilNum ).Name, "Cooling Coil Latent Cooling Energy" );
+		}
+
 		if ( AnyEnergyManagementSystemInModel ) {
 			// setup EMS sizing actuators for single speed DX
 			for ( DXCoilNum = 1; DXCoilNum <= NumDoe2DXCoils; ++DXCoilNum ) {
@@ -6775,6 +6783,7 @@ namespace DXCoils {
 		Real64 QLatRated; // Rated latent capacity of DX coil
 		Real64 SHRUnadjusted; // SHR prior to latent degradation effective SHR calculation
 		int Counter; // Counter for dry evaporator iterations
+		bool CapCacheHit; // true when the ADP/BF iteration results are taken from the coil's cache
 		int MaxIter; // Maximum number of iterations for dry evaporator calculations
 		Real64 RF; // Relaxation factor for dry evaporator iterations
 		Real64 Tolerance; // Error tolerance for dry evaporator iterations
@@ -7051,7 +7060,20 @@ namespace DXCoils {
 			//  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
 			InletAirHumRatTemp = InletAirHumRat;
 			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			while ( true ) {
+			// The iteration only depends on the inlet, condenser and flow conditions: reuse its results when
+			// the coil is called again at the same conditions (e.g., by the part load ratio solver of its parent)
+			auto & CapCache( DXCoil( DXCoilNum ).CapCache );
+			CapCacheHit = CapCache.Valid && CapCache.Mode == Mode && CapCache.InletAirDryBulbTemp == InletAirDryBulbTemp && CapCache.InletAirHumRat == InletAirHumRat && CapCache.InletAirEnthalpy == InletAirEnthalpy && CapCache.OutdoorPressure == OutdoorPressure && CapCache.CondInletTemp == CondInletTemp && CapCache.AirMassFlow == AirMassFlow && CapCache.RatedTotCap == DXCoil( DXCoilNum ).RatedTotCap( Mode );
+			if ( CapCacheHit ) {
+				InletAirWetBulbC = CapCache.InletAirWetBulbC;
+				TotCapTempModFac = CapCache.TotCapTempModFac;
+				TotCapFlowModFac = CapCache.TotCapFlowModFac;
+				TotCap = CapCache.TotCap;
+				SHR = CapCache.SHR;
+				hDelta = CapCache.hDelta;
+				Counter = CapCache.Counter;
+			}
+			while ( ! CapCacheHit ) {
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
 					// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
 					TotCapTempModFac = 1.0;
@@ -7139,6 +7161,26 @@ namespace DXCoils {
 				}
 			} // end of DO iteration loop
 
+			// Save the results unless a curve output was reset (its warning must be counted on each call) or EMS may override a curve
+			if ( ! CapCacheHit ) {
+				CapCache.Valid = TotCapTempModFac > 0.0 && TotCapFlowModFac > 0.0 && ! AnyEnergyManagementSystemInModel;
+				CapCache.Mode = Mode;
+				CapCache.InletAirDryBulbTemp = InletAirDryBulbTemp;
+				CapCache.InletAirHumRat = InletAirHumRat;
+				CapCache.InletAirEnthalpy = InletAirEnthalpy;
+				CapCache.OutdoorPressure = OutdoorPressure;
+				CapCache.CondInletTemp = CondInletTemp;
+				CapCache.AirMassFlow = AirMassFlow;
+				CapCache.RatedTotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode );
+				CapCache.InletAirWetBulbC = InletAirWetBulbC;
+				CapCache.TotCapTempModFac = TotCapTempModFac;
+				CapCache.TotCapFlowModFac = TotCapFlowModFac;
+				CapCache.TotCap = TotCap;
+				CapCache.SHR = SHR;
+				CapCache.hDelta = hDelta;
+				CapCache.Counter = Counter;
+			}
+
 			if ( DXCoil( DXCoilNum ).PLFFPLR( Mode ) > 0 ) {
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PartLoadRatio ); // Calculate part-load factor
 			} else {
@@ -11039,6 +11081,7 @@ Label50: ;
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   May 2000
 		//       MODIFIED       Richard Raustad/Don Shirey Oct 2001, Feb 2004
+		//                      Oct 2026, skip the sensible and latent cooling energies when not stored for output
 		//                      Feb 2005 M. J. Witte, GARD Analytics, Inc.
 		//                        Always update evap value to support new coil type COIL:DX:MultiMode:CoolingEmpirical:
 		//                      Lixing Gu. Jan. 5, 2007, pass information to the AirflowNetwork model
@@ -11102,8 +11145,10 @@ Label50: ;
 			DXElecHeatingPower = DXCoil( DXCoilNum ).ElecHeatingPower + DXCoil( DXCoilNum ).CrankcaseHeaterPower;
 		} else if ( SELECT_CASE_var == CoilDX_MultiSpeedCooling ) {
 			DXCoil( DXCoilNum ).TotalCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			if ( ReportSensLatCoolingEnergy( DXCoilNum ) ) {
+				DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
+				DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			}
 			DXCoil( DXCoilNum ).CrankcaseHeaterConsumption = DXCoil( DXCoilNum ).CrankcaseHeaterPower * ReportingConstant;
 			DXElecCoolingPower = DXCoil( DXCoilNum ).ElecCoolingPower;
 			DXCoil( DXCoilNum ).EvapCondPumpElecConsumption = DXCoil( DXCoilNum ).EvapCondPumpElecPower * ReportingConstant;
@@ -11123,16 +11168,20 @@ Label50: ;
 			DXCoil( DXCoilNum ).ElecWaterHeatingConsumption = DXCoil( DXCoilNum ).ElecWaterHeatingPower * ReportingConstant;
 			// other usual DX cooling coil outputs
 			DXCoil( DXCoilNum ).TotalCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			if ( ReportSensLatCoolingEnergy( DXCoilNum ) ) {
+				DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
+				DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			}
 			DXCoil( DXCoilNum ).ElecCoolingConsumption = DXCoil( DXCoilNum ).ElecCoolingPower * ReportingConstant;
 			DXCoil( DXCoilNum ).CrankcaseHeaterConsumption = DXCoil( DXCoilNum ).CrankcaseHeaterPower * ReportingConstant;
 			// DXElecCoolingPower global is only used for air-to-air cooling and heating coils
 			DXElecCoolingPower = 0.0;
 		} else {
 			DXCoil( DXCoilNum ).TotalCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
-			DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			if ( ReportSensLatCoolingEnergy( DXCoilNum ) ) {
+				DXCoil( DXCoilNum ).SensCoolingEnergy = DXCoil( DXCoilNum ).SensCoolingEnergyRate * ReportingConstant;
+				DXCoil( DXCoilNum ).LatCoolingEnergy = DXCoil( DXCoilNum ).TotalCoolingEnergy - DXCoil( DXCoilNum ).SensCoolingEnergy;
+			}
 			DXCoil( DXCoilNum ).ElecCoolingConsumption = DXCoil( DXCoilNum ).ElecCoolingPower * ReportingConstant;
 			DXCoil( DXCoilNum ).CrankcaseHeaterConsumption = DXCoil( DXCoilNum ).CrankcaseHeaterPower * ReportingConstant;
 			DXElecCoolingPower = DXCoil( DXCoilNum ).ElecCoolingPower;
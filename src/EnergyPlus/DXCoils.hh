@@ -104,6 +104,7 @@ namespace DXCoils {
 	extern int NumDXMulSpeedCoolCoils; // number of multispeed DX cooling coils
 	extern int NumDXMulSpeedHeatCoils; // number of multispeed DX heating coils
 	extern Array1D_bool CheckEquipName;
+	extern Array1D_bool ReportSensLatCoolingEnergy; // True if the coil's sensible or latent cooling energy is stored for output
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -121,6 +122,49 @@ namespace DXCoils {
 
 	// Types
 
+	struct DXCoilCapCacheData
+	{
+		// Members
+		// Full load capacity and SHR found by the last ADP/BF iteration of a cooling coil (CalcDoe2DXCoil)
+		bool Valid; // true when the cached results may be reused
+		int Mode; // performance mode (or stage) the results are for
+		Real64 InletAirDryBulbTemp; // inlet air dry-bulb temperature [C]
+		Real64 InletAirHumRat; // inlet air humidity ratio [kg/kg]
+		Real64 InletAirEnthalpy; // inlet air enthalpy [J/kg]
+		Real64 OutdoorPressure; // outdoor air pressure [Pa]
+		Real64 CondInletTemp; // condenser inlet temperature [C]
+		Real64 AirMassFlow; // full on air mass flow rate [kg/s]
+		Real64 RatedTotCap; // rated total capacity [W]
+		Real64 InletAirWetBulbC; // inlet air wet-bulb temperature at the end of the iteration [C]
+		Real64 TotCapTempModFac; // total capacity modifier (function of temperature)
+		Real64 TotCapFlowModFac; // total capacity modifier (function of flow fraction)
+		Real64 TotCap; // full load total capacity [W]
+		Real64 SHR; // full load sensible heat ratio
+		Real64 hDelta; // change in air enthalpy across the coil [J/kg]
+		int Counter; // dry evaporator iterations
+
+		// Default Constructor
+		DXCoilCapCacheData() :
+			Valid( false ),
+			Mode( 0 ),
+			InletAirDryBulbTemp( 0.0 ),
+			InletAirHumRat( 0.0 ),
+			InletAirEnthalpy( 0.0 ),
+			OutdoorPressure( 0.0 ),
+			CondInletTemp( 0.0 ),
+			AirMassFlow( 0.0 ),
+			RatedTotCap( 0.0 ),
+			InletAirWetBulbC( 0.0 ),
+			TotCapTempModFac( 0.0 ),
+			TotCapFlowModFac( 0.0 ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			hDelta( 0.0 ),
+			Counter( 0 )
+		{}
+
+	};
+
 	struct DXCoilData
 	{
 		// Members
@@ -440,6 +484,7 @@ namespace DXCoils {
 		int MSSpeedNumHS; // current high speed number of multspeed HP
 		Real64 MSSpeedRatio; // current speed ratio of multspeed HP
 		Real64 MSCycRatio; // current cycling ratio of multspeed HP
+		DXCoilCapCacheData CapCache; // last full load capacity and SHR (not an input)
 
 		// Default Constructor
 		DXCoilData() :
@@ -660,7 +705,8 @@ namespace DXCoils {
 			MSSpeedNumLS( 1 ),
 			MSSpeedNumHS( 2 ),
 			MSSpeedRatio( 0.0 ),
-			MSCycRatio( 0.0 )
+			MSCycRatio( 0.0 ),
+			CapCache()
 
 
 		{}
@@ -1181,7 +1227,8 @@ namespace DXCoils {
 			MSSpeedNumLS( MSSpeedNumLS ),
 			MSSpeedNumHS( MSSpeedNumHS ),
 			MSSpeedRatio( MSSpeedRatio ),
-			MSCycRatio( MSCycRatio )
+			MSCycRatio( MSCycRatio ),
+			CapCache()
 
 		{}
 
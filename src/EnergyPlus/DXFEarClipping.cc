@@ -57,6 +57,8 @@ namespace DXFEarClipping {
 	// Module variable declarations:
 	// na
 	bool trackit( false );
+	Array1D< Array1D< dTriangle > > SurfaceTriangles; // cached triangulation for each surface
+	Array1D_int SurfaceTrianglesClass; // surface class used for the cached triangulation (0=not done)
 	// Subroutine specifications for module <module_name>:
 
 	// rest of routines are private.
@@ -348,6 +350,47 @@ namespace DXFEarClipping {
 		return Triangulate;
 	}
 
+	int
+	TriangulateSurface(
+		int const SurfNum, // surface number
+		int const surfclass, // surface class
+		Array1D< dTriangle > & outtriangles
+	)
+	{
+
+		// Function information:
+		//       Author         na
+		//       Date written   Oct 2026
+		//       Modified       na
+		//       Re-engineered  na
+
+		// Purpose of this function:
+		// Triangulate a surface from the Surface structure, keeping the triangles so a surface is
+		// only triangulated once when several reports (DXF, VRML) need it.
+
+		// Methodology employed:
+		// The triangulation depends on the surface class passed in (floors, roofs and overhangs are
+		// done from the other side) so it is only reused when the same class is asked for again.
+
+		using DataSurfaces::Surface;
+		using DataSurfaces::TotSurfaces;
+
+		if ( ! allocated( SurfaceTriangles ) ) {
+			SurfaceTriangles.allocate( TotSurfaces );
+			SurfaceTrianglesClass.dimension( TotSurfaces, 0 );
+		}
+
+		if ( SurfaceTrianglesClass( SurfNum ) != surfclass ) {
+			auto & surface( Surface( SurfNum ) );
+			Triangulate( surface.Sides, surface.Vertex, SurfaceTriangles( SurfNum ), surface.Azimuth, surface.Tilt, surface.Name, surfclass );
+			SurfaceTrianglesClass( SurfNum ) = surfclass;
+		}
+
+		outtriangles = SurfaceTriangles( SurfNum );
+		return outtriangles.isize();
+
+	}
+
 	Real64
 	angle_2dvector(
 		Real64 const xa, // vertex coordinate
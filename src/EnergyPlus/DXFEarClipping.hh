@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -25,6 +26,8 @@ namespace DXFEarClipping {
 	// Module variable declarations:
 	// na
 	extern bool trackit;
+	extern Array1D< Array1D< dTriangle > > SurfaceTriangles; // cached triangulation for each surface
+	extern Array1D_int SurfaceTrianglesClass; // surface class used for the cached triangulation (0=not done)
 	// Subroutine specifications for module <module_name>:
 
 	// Functions
@@ -50,6 +53,13 @@ namespace DXFEarClipping {
 		int const surfclass // surface class
 	);
 
+	int
+	TriangulateSurface(
+		int const SurfNum, // surface number
+		int const surfclass, // surface class
+		Array1D< dTriangle > & outtriangles
+	);
+
 	Real64
 	angle_2dvector(
 		Real64 const xa, // vertex coordinate
@@ -48,6 +48,9 @@ namespace DataAirLoop {
 	Real64 LoopDXCoilRTF( 0.0 ); // OnOff fan run time fraction in an HVAC Air Loop
 	Real64 LoopCompCycRatio( 0.0 ); // Loop compressor cycling ratio for multispeed heat pump
 	bool AirLoopInputsFilled( false ); // Set to TRUE after first pass through air loop
+	bool SysSubStepHold( false ); // On a later system time step of a zone time step shortened for some air loops only
+	Array1D_bool AirLoopHeldOnSysSubStep; // Air loop keeps its solution of the first system time step
+	// of the zone time step when SysSubStepHold is set
 
 	// Object Data
 	Array1D< AirLoopZoneEquipConnectData > AirToZoneNodeInfo;
@@ -37,6 +37,9 @@ namespace DataAirLoop {
 	extern Real64 LoopDXCoilRTF; // OnOff fan run time fraction in an HVAC Air Loop
 	extern Real64 LoopCompCycRatio; // Loop compressor cycling ratio for multispeed heat pump
 	extern bool AirLoopInputsFilled; // Set to TRUE after first pass through air loop
+	extern bool SysSubStepHold; // On a later system time step of a zone time step shortened for some air loops only
+	extern Array1D_bool AirLoopHeldOnSysSubStep; // Air loop keeps its solution of the first system time step
+	// of the zone time step when SysSubStepHold is set
 
 	// Types
 
@@ -52,6 +52,7 @@ namespace DataAirSystems {
 		int NodeNumOut; // Component outlet node number
 		bool MeteredVarsFound;
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		int NumSubComps;
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer  Flag needed for reporting
 		Real64 Capacity; // ventilation load factor
@@ -83,6 +84,7 @@ namespace DataAirSystems {
 			NodeNumOut( 0 ),
 			MeteredVarsFound( false ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			NumSubComps( 0 ),
 			EnergyTransComp( 0 ),
 			Capacity( 0.0 ),
@@ -150,6 +152,7 @@ namespace DataAirSystems {
 			NodeNumOut( NodeNumOut ),
 			MeteredVarsFound( MeteredVarsFound ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			NumSubComps( NumSubComps ),
 			EnergyTransComp( EnergyTransComp ),
 			Capacity( Capacity ),
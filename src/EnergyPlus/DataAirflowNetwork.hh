@@ -171,6 +171,7 @@ namespace DataAirflowNetwork {
 		std::string InitType; // Initialization flag type:
 		bool TExtHeightDep; // Choice of height dependence of external node temperature
 		// "ZeroNodePressures", or "LinearInitializationMethod"
+		bool ReuseJacobian; // Keep the factored Jacobian until the convergence slows
 
 		// Default Constructor
 		AirflowNetworkSimuProp() :
@@ -191,7 +192,8 @@ namespace DataAirflowNetwork {
 			OpenFactorErrCount( 0 ),
 			OpenFactorErrIndex( 0 ),
 			InitType( "ZeroNodePressures" ),
-			TExtHeightDep( false )
+			TExtHeightDep( false ),
+			ReuseJacobian( false )
 		{}
 
 		// Member Constructor
@@ -218,7 +220,8 @@ namespace DataAirflowNetwork {
 			int const OpenFactorErrCount, // Large opening error count at Open factor > 1.0
 			int const OpenFactorErrIndex, // Large opening error error index at Open factor > 1.0
 			std::string const & InitType, // Initialization flag type:
-			bool const TExtHeightDep // Choice of height dependence of external node temperature
+			bool const TExtHeightDep, // Choice of height dependence of external node temperature
+			bool const ReuseJacobian // Keep the factored Jacobian until the convergence slows
 		) :
 			AirflowNetworkSimuName( AirflowNetworkSimuName ),
 			Control( Control ),
@@ -242,7 +245,8 @@ namespace DataAirflowNetwork {
 			OpenFactorErrCount( OpenFactorErrCount ),
 			OpenFactorErrIndex( OpenFactorErrIndex ),
 			InitType( InitType ),
-			TExtHeightDep( TExtHeightDep )
+			TExtHeightDep( TExtHeightDep ),
+			ReuseJacobian( ReuseJacobian )
 		{}
 
 	};
@@ -469,6 +469,9 @@ namespace DataBSDFWindow {
 		Array1D< Real64 > IntegratedBkAbs; // Sum of all back layer absorptances (for each back direction)
 		Array1D< Real64 > IntegratedBkRefl; // Integrated back layer reflectance (for each back direction)
 		Array1D< Real64 > IntegratedBkTrans; // Integrated back layer transmittance (for each back direction)
+		// Solid-angle weighted row sums of the property matrices, used for every hour and timestep
+		Array1D< Real64 > FtDirHemiTrans; // Front directional-hemispherical transmittance (for each incident direction)
+		Array1D< Real64 > BkDirHemiRefl; // Back directional-hemispherical reflectance (for each back incident direction)
 
 		// Default Constructor
 		BSDFStateDescr() :
@@ -506,7 +509,9 @@ namespace DataBSDFWindow {
 			Array1< Real64 > const & IntegratedFtTrans, // Integrated back layer transmittance (for each back direction)
 			Array1< Real64 > const & IntegratedBkAbs, // Sum of all back layer absorptances (for each back direction)
 			Array1< Real64 > const & IntegratedBkRefl, // Integrated back layer reflectance (for each back direction)
-			Array1< Real64 > const & IntegratedBkTrans // Integrated back layer transmittance (for each back direction)
+			Array1< Real64 > const & IntegratedBkTrans, // Integrated back layer transmittance (for each back direction)
+			Array1< Real64 > const & FtDirHemiTrans, // Front directional-hemispherical transmittance (for each incident direction)
+			Array1< Real64 > const & BkDirHemiRefl // Back directional-hemispherical reflectance (for each back incident direction)
 		) :
 			Konst( Konst ),
 			WinDiffTrans( WinDiffTrans ),
@@ -532,7 +537,9 @@ namespace DataBSDFWindow {
 			IntegratedFtTrans( IntegratedFtTrans ),
 			IntegratedBkAbs( IntegratedBkAbs ),
 			IntegratedBkRefl( IntegratedBkRefl ),
-			IntegratedBkTrans( IntegratedBkTrans )
+			IntegratedBkTrans( IntegratedBkTrans ),
+			FtDirHemiTrans( FtDirHemiTrans ),
+			BkDirHemiRefl( BkDirHemiRefl )
 		{}
 
 	};
@@ -50,6 +50,7 @@ namespace DataBranchNodeConnections {
 	Array1D< ComponentListData > CompSets;
 	Array1D< ParentListData > ParentNodeList;
 	Array1D< NodeConnectionDef > NodeConnections;
+	std::unordered_map< int, std::vector< int > > NodeConnectionsOfNode; // Node connections of each node number, in registration order
 	Array1D< EqNodeConnectionDef > AirTerminalNodeConnections;
 
 	//     NOTICE
@@ -1,6 +1,10 @@
 #ifndef DataBranchNodeConnections_hh_INCLUDED
 #define DataBranchNodeConnections_hh_INCLUDED
 
+// C++ Headers
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -181,6 +185,7 @@ namespace DataBranchNodeConnections {
 	extern Array1D< ComponentListData > CompSets;
 	extern Array1D< ParentListData > ParentNodeList;
 	extern Array1D< NodeConnectionDef > NodeConnections;
+	extern std::unordered_map< int, std::vector< int > > NodeConnectionsOfNode; // Node connections of each node number, in registration order
 	extern Array1D< EqNodeConnectionDef > AirTerminalNodeConnections;
 
 } // DataBranchNodeConnections
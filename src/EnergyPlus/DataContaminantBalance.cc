@@ -116,6 +116,7 @@ namespace DataContaminantBalance {
 
 	// Object Data
 	Array1D< ZoneSystemContaminantDemandData > ZoneSysContDemand;
+	Array1D< ZoneSystemContaminantFlowData > ZoneSysContFlow;
 	ContaminantData Contaminant; // A logical flag to determine whether any contaminants are simulated or not | CO2 simulation flag | CO2 outdoor level schedule pointer | Generic contaminant simulation flag | Generic contaminant outdoor level schedule pointer
 	Array1D< ZoneContControls > ContaminantControlledZone;
 	Array1D< ZoneContamGenericDataConstant > ZoneContamGenericConstant;
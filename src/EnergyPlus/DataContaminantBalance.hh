@@ -260,6 +260,41 @@ namespace DataContaminantBalance {
 
 	};
 
+	struct ZoneSystemContaminantFlowData // Air system and plenum flows of a zone, gathered with the zone humidity
+	{
+		// Members
+		Real64 ZoneMassFlowRate; // Inlet mass flow rate divided by the zone multiplier [kg/s]
+		Real64 ExhMassFlowRate; // Exhaust mass flow rate divided by the zone multiplier [kg/s]
+		Real64 TotExitMassFlowRate; // Exhaust and return mass flow rate divided by the zone multiplier [kg/s]
+		Real64 CO2MassFlowRate; // Inlet mass flow rate times CO2 divided by the zone multiplier [kg/s-ppm]
+		Real64 GCMassFlowRate; // Inlet mass flow rate times generic contaminant divided by the zone multiplier [kg/s-ppm]
+
+		// Default Constructor
+		ZoneSystemContaminantFlowData() :
+			ZoneMassFlowRate( 0.0 ),
+			ExhMassFlowRate( 0.0 ),
+			TotExitMassFlowRate( 0.0 ),
+			CO2MassFlowRate( 0.0 ),
+			GCMassFlowRate( 0.0 )
+		{}
+
+		// Member Constructor
+		ZoneSystemContaminantFlowData(
+			Real64 const ZoneMassFlowRate, // Inlet mass flow rate divided by the zone multiplier [kg/s]
+			Real64 const ExhMassFlowRate, // Exhaust mass flow rate divided by the zone multiplier [kg/s]
+			Real64 const TotExitMassFlowRate, // Exhaust and return mass flow rate divided by the zone multiplier [kg/s]
+			Real64 const CO2MassFlowRate, // Inlet mass flow rate times CO2 divided by the zone multiplier [kg/s-ppm]
+			Real64 const GCMassFlowRate // Inlet mass flow rate times generic contaminant divided by the zone multiplier [kg/s-ppm]
+		) :
+			ZoneMassFlowRate( ZoneMassFlowRate ),
+			ExhMassFlowRate( ExhMassFlowRate ),
+			TotExitMassFlowRate( TotExitMassFlowRate ),
+			CO2MassFlowRate( CO2MassFlowRate ),
+			GCMassFlowRate( GCMassFlowRate )
+		{}
+
+	};
+
 	struct ZoneContamGenericDataConstant
 	{
 		// Members
@@ -551,6 +586,7 @@ namespace DataContaminantBalance {
 
 	// Object Data
 	extern Array1D< ZoneSystemContaminantDemandData > ZoneSysContDemand;
+	extern Array1D< ZoneSystemContaminantFlowData > ZoneSysContFlow;
 	extern ContaminantData Contaminant; // A logical flag to determine whether any contaminants are simulated or not | CO2 simulation flag | CO2 outdoor level schedule pointer | Generic contaminant simulation flag | Generic contaminant outdoor level schedule pointer
 	extern Array1D< ZoneContControls > ContaminantControlledZone;
 	extern Array1D< ZoneContamGenericDataConstant > ZoneContamGenericConstant;
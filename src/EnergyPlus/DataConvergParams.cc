@@ -85,6 +85,8 @@ namespace DataConvergParams {
 	//   zone air temp at Time=T and Time=T-1
 	Real64 MinSysTimeRemaining( ( 1.0 / 3600.0 ) ); // = 1 second
 	int MaxIter( 20 ); // maximum number of iterations allowed
+	bool AirLoopSysTimeStepShortening( false ); // Shorten the system time step only for the air loops serving
+	// the zones whose temperature changes too much (else for the whole building)
 
 	int MaxPlantSubIterations( 8 ); // Iteration Max for Plant Simulation sub iterations
 	int MinPlantSubIterations( 2 ); // Iteration Min for Plant Simulation sub iterations
@@ -82,6 +82,8 @@ namespace DataConvergParams {
 	//   zone air temp at Time=T and Time=T-1
 	extern Real64 MinSysTimeRemaining; // = 1 second
 	extern int MaxIter; // maximum number of iterations allowed
+	extern bool AirLoopSysTimeStepShortening; // Shorten the system time step only for the air loops serving
+	// the zones whose temperature changes too much (else for the whole building)
 
 	extern int MaxPlantSubIterations; // Iteration Max for Plant Simulation sub iterations
 	extern int MinPlantSubIterations; // Iteration Min for Plant Simulation sub iterations
@@ -18,6 +18,9 @@ namespace DataDaylighting {
 
 	// Using/Aliasing
 
+	// Storage precision of the daylight factor arrays; the factors are interpolated and combined in Real64
+	typedef float DaylFactorReal;
+
 	// Data
 	// -only module should be available to other modules and routines.
 	// Thus, all variables in this module must be PUBLIC.
@@ -133,6 +136,9 @@ namespace DataDaylighting {
 		Array1D< Real64 > BacLum; // =0.0 ! Background luminance at each reference point (cd/m2)
 		Array2D< Real64 > SolidAngAtRefPt; // (MaxRefPoints,50)
 		Array2D< Real64 > SolidAngAtRefPtWtd; // (MaxRefPoints,50)
+		Array2D< Real64 > SolidAngAtRefPtWtdPow; // SolidAngAtRefPtWtd ** 0.8, for the glare index
+		Array2D< Real64 > SolidAngAtRefPtSqrt; // Square root of SolidAngAtRefPt, for the glare index
+		bool GlareCalcNeeded; // False if no glare control acts on the zone windows and the glare index is not reported
 		Array3D< Real64 > IllumFromWinAtRefPt; // (MaxRefPoints,2,50)
 		Array3D< Real64 > BackLumFromWinAtRefPt; // (MaxRefPoints,2,50)
 		Array3D< Real64 > SourceLumFromWinAtRefPt; // (MaxRefPoints,2,50)
@@ -144,21 +150,21 @@ namespace DataDaylighting {
 		//  4: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  5: Sun position index (1 to 24)
-		Array5D< Real64 > DaylIllFacSky;
-		Array5D< Real64 > DaylSourceFacSky;
-		Array5D< Real64 > DaylBackFacSky;
+		Array5D< DaylFactorReal > DaylIllFacSky;
+		Array5D< DaylFactorReal > DaylSourceFacSky;
+		Array5D< DaylFactorReal > DaylBackFacSky;
 		// Arguments for Dayl---Sun are:
 		//  1: Daylit window number (1 to NumOfDayltgExtWins)
 		//  2: Reference point number (1 to MaxRefPoints)
 		//  3: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  4: Sun position index (1 to 24)
-		Array4D< Real64 > DaylIllFacSun;
-		Array4D< Real64 > DaylIllFacSunDisk;
-		Array4D< Real64 > DaylSourceFacSun;
-		Array4D< Real64 > DaylSourceFacSunDisk;
-		Array4D< Real64 > DaylBackFacSun;
-		Array4D< Real64 > DaylBackFacSunDisk;
+		Array4D< DaylFactorReal > DaylIllFacSun;
+		Array4D< DaylFactorReal > DaylIllFacSunDisk;
+		Array4D< DaylFactorReal > DaylSourceFacSun;
+		Array4D< DaylFactorReal > DaylSourceFacSunDisk;
+		Array4D< DaylFactorReal > DaylBackFacSun;
+		Array4D< DaylFactorReal > DaylBackFacSunDisk;
 		// Time exceeding maximum allowable discomfort glare index at reference points (hours)
 		Array1D< Real64 > TimeExceedingGlareIndexSPAtRefPt;
 		// Time exceeding daylight illuminance setpoint at reference points (hours)
@@ -191,6 +197,7 @@ namespace DataDaylighting {
 			TotInsSurfArea( 0.0 ),
 			FloorVisRefl( 0.0 ),
 			InterReflIllFrIntWins( 0.0 ),
+			GlareCalcNeeded( true ),
 			AdjZoneHasDayltgCtrl( false ),
 			MapCount( 0 )
 		{}
@@ -235,15 +242,15 @@ namespace DataDaylighting {
 			Array3< Real64 > const & IllumFromWinAtRefPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & BackLumFromWinAtRefPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & SourceLumFromWinAtRefPt, // (MaxRefPoints,2,50)
-			Array5< Real64 > const & DaylIllFacSky,
-			Array5< Real64 > const & DaylSourceFacSky,
-			Array5< Real64 > const & DaylBackFacSky,
-			Array4< Real64 > const & DaylIllFacSun,
-			Array4< Real64 > const & DaylIllFacSunDisk,
-			Array4< Real64 > const & DaylSourceFacSun,
-			Array4< Real64 > const & DaylSourceFacSunDisk,
-			Array4< Real64 > const & DaylBackFacSun,
-			Array4< Real64 > const & DaylBackFacSunDisk,
+			Array5< DaylFactorReal > const & DaylIllFacSky,
+			Array5< DaylFactorReal > const & DaylSourceFacSky,
+			Array5< DaylFactorReal > const & DaylBackFacSky,
+			Array4< DaylFactorReal > const & DaylIllFacSun,
+			Array4< DaylFactorReal > const & DaylIllFacSunDisk,
+			Array4< DaylFactorReal > const & DaylSourceFacSun,
+			Array4< DaylFactorReal > const & DaylSourceFacSunDisk,
+			Array4< DaylFactorReal > const & DaylBackFacSun,
+			Array4< DaylFactorReal > const & DaylBackFacSunDisk,
 			Array1< Real64 > const & TimeExceedingGlareIndexSPAtRefPt,
 			Array1< Real64 > const & TimeExceedingDaylightIlluminanceSPAtRefPt,
 			bool const AdjZoneHasDayltgCtrl,
@@ -285,6 +292,7 @@ namespace DataDaylighting {
 			BacLum( BacLum ),
 			SolidAngAtRefPt( SolidAngAtRefPt ),
 			SolidAngAtRefPtWtd( SolidAngAtRefPtWtd ),
+			GlareCalcNeeded( true ),
 			IllumFromWinAtRefPt( IllumFromWinAtRefPt ),
 			BackLumFromWinAtRefPt( BackLumFromWinAtRefPt ),
 			SourceLumFromWinAtRefPt( SourceLumFromWinAtRefPt ),
@@ -401,21 +409,21 @@ namespace DataDaylighting {
 		//  4: Shading index (1 to MaxSlatAngs+1; 1 = bare window; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  5: Sun position index (1 to 24)
-		Array5D< Real64 > DaylIllFacSky;
-		Array5D< Real64 > DaylSourceFacSky;
-		Array5D< Real64 > DaylBackFacSky;
+		Array5D< DaylFactorReal > DaylIllFacSky;
+		Array5D< DaylFactorReal > DaylSourceFacSky;
+		Array5D< DaylFactorReal > DaylBackFacSky;
 		// Arguments for Dayl---Sun are:
 		//  1: Daylit window number (1 to NumOfDayltgExtWins)
 		//  2: Reference point number (1 to MaxRefPoints)
 		//  3: Shading index (1 to MaxShadeIndex; 1 = no shade; 2 = with shade, or, if blinds
 		//      2 = first slat position, 3 = second position, ..., MaxSlatAngs+1 = last position)
 		//  4: Sun position index (1 to 24)
-		Array4D< Real64 > DaylIllFacSun;
-		Array4D< Real64 > DaylIllFacSunDisk;
-		Array4D< Real64 > DaylSourceFacSun;
-		Array4D< Real64 > DaylSourceFacSunDisk;
-		Array4D< Real64 > DaylBackFacSun;
-		Array4D< Real64 > DaylBackFacSunDisk;
+		Array4D< DaylFactorReal > DaylIllFacSun;
+		Array4D< DaylFactorReal > DaylIllFacSunDisk;
+		Array4D< DaylFactorReal > DaylSourceFacSun;
+		Array4D< DaylFactorReal > DaylSourceFacSunDisk;
+		Array4D< DaylFactorReal > DaylBackFacSun;
+		Array4D< DaylFactorReal > DaylBackFacSunDisk;
 
 		// Default Constructor
 		MapCalcData() :
@@ -438,15 +446,15 @@ namespace DataDaylighting {
 			Array3< Real64 > const & IllumFromWinAtMapPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & BackLumFromWinAtMapPt, // (MaxRefPoints,2,50)
 			Array3< Real64 > const & SourceLumFromWinAtMapPt, // (MaxRefPoints,2,50)
-			Array5< Real64 > const & DaylIllFacSky,
-			Array5< Real64 > const & DaylSourceFacSky,
-			Array5< Real64 > const & DaylBackFacSky,
-			Array4< Real64 > const & DaylIllFacSun,
-			Array4< Real64 > const & DaylIllFacSunDisk,
-			Array4< Real64 > const & DaylSourceFacSun,
-			Array4< Real64 > const & DaylSourceFacSunDisk,
-			Array4< Real64 > const & DaylBackFacSun,
-			Array4< Real64 > const & DaylBackFacSunDisk
+			Array5< DaylFactorReal > const & DaylIllFacSky,
+			Array5< DaylFactorReal > const & DaylSourceFacSky,
+			Array5< DaylFactorReal > const & DaylBackFacSky,
+			Array4< DaylFactorReal > const & DaylIllFacSun,
+			Array4< DaylFactorReal > const & DaylIllFacSunDisk,
+			Array4< DaylFactorReal > const & DaylSourceFacSun,
+			Array4< DaylFactorReal > const & DaylSourceFacSunDisk,
+			Array4< DaylFactorReal > const & DaylBackFacSun,
+			Array4< DaylFactorReal > const & DaylBackFacSunDisk
 		) :
 			TotalMapRefPoints( TotalMapRefPoints ),
 			Zone( Zone ),
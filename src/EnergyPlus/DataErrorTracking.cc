@@ -89,7 +89,8 @@ namespace DataErrorTracking {
 	std::string LastSevereError;
 
 	// Object Data
-	Array1D< RecurringErrorData > RecurringErrors;
+	Array1D< RecurringErrorData > RecurringErrors; // Allocated ahead of NumRecurringErrors
+	std::unordered_map< std::string, int > RecurringErrorIndex; // Recurring error number by stored message
 
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
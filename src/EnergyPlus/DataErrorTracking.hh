@@ -1,6 +1,10 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -89,6 +93,7 @@ namespace DataErrorTracking {
 		bool ReportMax; // Flag to report max value
 		bool ReportMin; // Flag to report min value
 		bool ReportSum; // Flag to report sum value
+		int SearchMatches; // Bit Loop-1 set if MessageSearch( Loop ) is found in the message
 
 		// Default Constructor
 		RecurringErrorData() :
@@ -100,7 +105,8 @@ namespace DataErrorTracking {
 			SumValue( 0.0 ),
 			ReportMax( false ),
 			ReportMin( false ),
-			ReportSum( false )
+			ReportSum( false ),
+			SearchMatches( 0 )
 		{}
 
 		// Member Constructor
@@ -117,7 +123,8 @@ namespace DataErrorTracking {
 			std::string const & SumUnits, // units for Sum values
 			bool const ReportMax, // Flag to report max value
 			bool const ReportMin, // Flag to report min value
-			bool const ReportSum // Flag to report sum value
+			bool const ReportSum, // Flag to report sum value
+			int const SearchMatches = 0 // Bit Loop-1 set if MessageSearch( Loop ) is found in the message
 		) :
 			Message( Message ),
 			Count( Count ),
@@ -131,13 +138,15 @@ namespace DataErrorTracking {
 			SumUnits( SumUnits ),
 			ReportMax( ReportMax ),
 			ReportMin( ReportMin ),
-			ReportSum( ReportSum )
+			ReportSum( ReportSum ),
+			SearchMatches( SearchMatches )
 		{}
 
 	};
 
 	// Object Data
 	extern Array1D< RecurringErrorData > RecurringErrors;
+	extern std::unordered_map< std::string, int > RecurringErrorIndex; // Recurring error number by stored message
 
 } // DataErrorTracking
 
@@ -44,6 +44,13 @@ namespace DataGlobals {
 	bool runReadVars(false);
 	bool DDOnlySimulation(false);
 	bool AnnualSimulation(false);
+	int SelectedRunPeriod(0); // Weather file run period simulated alone (--run-period), 0 for all
+	int RunPeriodSegment(0); // Segment of the weather file run periods simulated (--segment), 0 for all
+	int NumRunPeriodSegments(0); // Number of segments the weather file run periods are split into (--segment)
+	int RunPeriodSegmentOverlap(0); // Days simulated ahead of a segment to build up its starting state (--segment-overlap)
+	int CheckpointDay(0); // Day of the weather file run period after which the state is saved (--checkpoint-at), 0 for none
+	bool CompressOutput( false ); // Write the eso, mtr and csv output files gzip compressed (--compress-output)
+	bool CheckInputOnly( false ); // Process and check the input, then stop before the simulation (--check-input)
 
 	// MODULE PARAMETER DEFINITIONS:
 	int const BeginDay( 1 );
@@ -195,7 +202,11 @@ namespace DataGlobals {
 
 	int Progress( 0 ); // current progress (0-100)
 	void ( *fProgressPtr )( int const );
+	void ( *fProgressEventPtr )( int const, int const, int const, int const ); // Percent, environment, day of simulation, simulation days (see StoreProgressEventCallback)
 	void ( *fMessagePtr )( std::string const & );
+	int ( *fReportDictionaryPtr )( int const, int const, std::string const &, std::string const &, std::string const & ); // Streaming of report values (see StoreReportDictionaryCallback)
+	void ( *fReportTimeStampPtr )( int const, int const, int const, int const, int const, int const, Real64 const );
+	void ( *fReportValuePtr )( int const, Real64 const );
 
 	//     NOTICE
 	//     Copyright © 1996-2014 The Board of Trustees of the University of Illinois
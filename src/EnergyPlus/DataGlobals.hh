@@ -19,6 +19,13 @@ namespace DataGlobals {
 	extern bool runReadVars;
 	extern bool DDOnlySimulation;
 	extern bool AnnualSimulation;
+	extern int SelectedRunPeriod; // Weather file run period simulated alone (--run-period), 0 for all
+	extern int RunPeriodSegment; // Segment of the weather file run periods simulated (--segment), 0 for all
+	extern int NumRunPeriodSegments; // Number of segments the weather file run periods are split into (--segment)
+	extern int RunPeriodSegmentOverlap; // Days simulated ahead of a segment to build up its starting state (--segment-overlap)
+	extern int CheckpointDay; // Day of the weather file run period after which the state is saved (--checkpoint-at), 0 for none
+	extern bool CompressOutput; // Write the eso, mtr and csv output files gzip compressed (--compress-output)
+	extern bool CheckInputOnly; // Process and check the input, then stop before the simulation (--check-input)
 
 	// MODULE PARAMETER DEFINITIONS:
 	extern int const BeginDay;
@@ -170,7 +177,11 @@ namespace DataGlobals {
 
 	extern int Progress;
 	extern void ( *fProgressPtr )( int const );
+	extern void ( *fProgressEventPtr )( int const, int const, int const, int const );
 	extern void ( *fMessagePtr )( std::string const & );
+	extern int ( *fReportDictionaryPtr )( int const, int const, std::string const &, std::string const &, std::string const & );
+	extern void ( *fReportTimeStampPtr )( int const, int const, int const, int const, int const, int const, Real64 const );
+	extern void ( *fReportValuePtr )( int const, Real64 const );
 
 } // DataGlobals
 
@@ -166,6 +166,7 @@ namespace DataHeatBalFanSys {
 	Array1D< Real64 > ZTM1; // zone air temperature at previous timestep
 	Array1D< Real64 > ZTM2; // zone air temperature at timestep T-2
 	Array1D< Real64 > ZTM3; // zone air temperature at previous T-3
+	Array1D< Real64 > ZoneAirTempChange; // Change of the zone air temperature over the last system time step
 	// Exact and Euler solutions
 	Array1D< Real64 > ZoneTMX; // TEMPORARY ZONE TEMPERATURE TO TEST CONVERGENCE in Exact and Euler method
 	Array1D< Real64 > ZoneTM2; // TEMPORARY ZONE TEMPERATURE at timestep t-2 in Exact and Euler method
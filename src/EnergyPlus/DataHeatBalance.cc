@@ -314,6 +314,8 @@ namespace DataHeatBalance {
 	Array1D_int HeatTransferAlgosUsed;
 	int MaxNumberOfWarmupDays( 25 ); // Maximum number of warmup days allowed
 	int MinNumberOfWarmupDays( 6 ); // Minimum number of warmup days allowed
+	bool WarmupFromSimilarEnvironment( false ); // Start warmup from the converged state of an earlier environment
+	bool WarmupExtrapolation( false ); // Extrapolate the surface histories towards their converged values during warmup
 	Real64 CondFDRelaxFactor( 1.0 ); // Relaxation factor, for looping across all the surfaces.
 	Real64 CondFDRelaxFactorInput( 1.0 ); // Relaxation factor, for looping across all the surfaces, user input value
 	//LOGICAL ::  CondFDVariableProperties = .FALSE. ! if true, then variable conductivity or enthalpy in Cond FD.
@@ -546,9 +548,12 @@ namespace DataHeatBalance {
 	// without shadowing by the reveal
 	Array3D< Real64 > CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
 	Array4D_int BackSurfaces; // For a given hour and timestep, a list of up to 20 surfaces receiving
-	// beam solar radiation from a given exterior window
+	// beam solar radiation from a given exterior window (indexed by BackSurfIndex of the window)
 	Array4D< Real64 > OverlapAreas; // For a given hour and timestep, the areas of the exterior window sending
 	// beam solar radiation to the surfaces listed in BackSurfaces
+	Array1D_int BackSurfIndex; // Index of a surface in BackSurfaces and OverlapAreas (0 if it cannot send beam
+	// solar radiation to back surfaces)
+	int NumBackSurfWindows( 0 ); // Number of surfaces indexed in BackSurfaces and OverlapAreas
 	//                       Air       Argon     Krypton   Xenon
 	Array2D< Real64 > const GasCoeffsCon( 3, 10, reshape2< Real64, int >( { 2.873e-3, 2.285e-3, 9.443e-4, 4.538e-4, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 7.760e-5, 5.149e-5, 2.826e-5, 1.723e-5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }, { 3, 10 } ) ); // Gas conductivity coefficients for gases in a mixture // Explicit reshape2 template args are work-around for VC++2013 bug
 
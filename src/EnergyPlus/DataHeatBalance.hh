@@ -295,6 +295,8 @@ namespace DataHeatBalance {
 	extern Array1D_int HeatTransferAlgosUsed;
 	extern int MaxNumberOfWarmupDays; // Maximum number of warmup days allowed
 	extern int MinNumberOfWarmupDays; // Minimum number of warmup days allowed
+	extern bool WarmupFromSimilarEnvironment; // Start warmup from the converged state of an earlier environment
+	extern bool WarmupExtrapolation; // Extrapolate the surface histories towards their converged values during warmup
 	extern Real64 CondFDRelaxFactor; // Relaxation factor, for looping across all the surfaces.
 	extern Real64 CondFDRelaxFactorInput; // Relaxation factor, for looping across all the surfaces, user input value
 	//LOGICAL ::  CondFDVariableProperties = .FALSE. ! if true, then variable conductivity or enthalpy in Cond FD.
@@ -528,9 +530,12 @@ namespace DataHeatBalance {
 	// without shadowing by the reveal
 	extern Array3D< Real64 > CosIncAng; // TimeStep cosine of beam radiation incidence angle on surface
 	extern Array4D_int BackSurfaces; // For a given hour and timestep, a list of up to 20 surfaces receiving
-	// beam solar radiation from a given exterior window
+	// beam solar radiation from a given exterior window (indexed by BackSurfIndex of the window)
 	extern Array4D< Real64 > OverlapAreas; // For a given hour and timestep, the areas of the exterior window sending
 	// beam solar radiation to the surfaces listed in BackSurfaces
+	extern Array1D_int BackSurfIndex; // Index of a surface in BackSurfaces and OverlapAreas (0 if it cannot send beam
+	// solar radiation to back surfaces)
+	extern int NumBackSurfWindows; // Number of surfaces indexed in BackSurfaces and OverlapAreas
 	//                       Air       Argon     Krypton   Xenon
 	extern Array2D< Real64 > const GasCoeffsCon; // Gas conductivity coefficients for gases in a mixture
 
@@ -3802,6 +3807,14 @@ namespace DataHeatBalance {
 		int NumberOfDevices;
 		int MaxNumberOfDevices;
 		Array1D< GenericComponentZoneIntGainStruct > Device;
+		// Sums of the stored Device gain rates, updated with them in UpdateInternalGainValues
+		Real64 SumConvectGainRate; // convective gain to zone air (W)
+		Real64 SumReturnAirConvGainRate; // convective gain to return air (W)
+		Real64 SumRadiantGainRate; // radiant gain to zone surfaces (W)
+		Real64 SumLatentGainRate; // latent gain to zone air (W)
+		Real64 SumReturnAirLatentGainRate; // latent gain to return air (W)
+		Real64 SumCarbonDioxideGainRate; // carbon dioxide gain to zone air (m3/s)
+		Real64 SumGenericContamGainRate; // generic contaminant gain to zone air (m3/s)
 
 		// Default Constructor
 		ZoneSimData() :
@@ -3839,7 +3852,14 @@ namespace DataHeatBalance {
 			QBBCON( 0.0 ),
 			QBBRAD( 0.0 ),
 			NumberOfDevices( 0 ),
-			MaxNumberOfDevices( 0 )
+			MaxNumberOfDevices( 0 ),
+			SumConvectGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 		// Member Constructor
@@ -3916,7 +3936,14 @@ namespace DataHeatBalance {
 			QBBRAD( QBBRAD ),
 			NumberOfDevices( NumberOfDevices ),
 			MaxNumberOfDevices( MaxNumberOfDevices ),
-			Device( Device )
+			Device( Device ),
+			SumConvectGainRate( 0.0 ),
+			SumReturnAirConvGainRate( 0.0 ),
+			SumRadiantGainRate( 0.0 ),
+			SumLatentGainRate( 0.0 ),
+			SumReturnAirLatentGainRate( 0.0 ),
+			SumCarbonDioxideGainRate( 0.0 ),
+			SumGenericContamGainRate( 0.0 )
 		{}
 
 	};
@@ -73,82 +73,86 @@ namespace DataLoopNode {
 	struct NodeData
 	{
 		// Members
-		int FluidType; // must be one of the valid parameters
-		int FluidIndex; // For Fluid Properties
+		// Hot state: read or written by nearly every component on every iteration of the HVAC
+		// solution.  Kept together at the front so that they share the first cache line of a node
 		Real64 Temp; // {C}
-		Real64 TempMin; // {C}
-		Real64 TempMax; // {C}
-		Real64 TempSetPoint; // {C}
-		Real64 TempLastTimestep; // [C}   DSU
-		Real64 MassFlowRateRequest; // {kg/s}  DSU
 		Real64 MassFlowRate; // {kg/s}
-		Real64 MassFlowRateMin; // {kg/s}
-		Real64 MassFlowRateMax; // {kg/s}
+		Real64 HumRat; // {}
+		Real64 Enthalpy; // {J/kg}
+		Real64 Press; // {Pa}
+		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
 		Real64 MassFlowRateMinAvail; // {kg/s}
 		Real64 MassFlowRateMaxAvail; // {kg/s}
+		// Flow and setpoint state: used by controllers, setpoint managers and flow resolvers
+		Real64 MassFlowRateRequest; // {kg/s}  DSU
+		Real64 MassFlowRateMin; // {kg/s}
+		Real64 MassFlowRateMax; // {kg/s}
 		Real64 MassFlowRateSetPoint; // {kg/s}
-		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
-		Real64 Press; // {Pa}
-		Real64 Enthalpy; // {J/kg}
-		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
-		Real64 HumRat; // {}
+		Real64 TempSetPoint; // {C}
+		Real64 HumRatSetPoint; // {}
+		Real64 TempMin; // {C}
+		Real64 TempMax; // {C}
+		// Cold state: setpoint limits, last time step values, contaminants and height
 		Real64 HumRatMin; // {}
 		Real64 HumRatMax; // {}
-		Real64 HumRatSetPoint; // {}
 		Real64 TempSetPointHi; // {C}
 		Real64 TempSetPointLo; // {C}
+		Real64 TempLastTimestep; // [C}   DSU
+		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
+		Real64 CO2; // {ppm}
+		Real64 CO2SetPoint; // {ppm}
+		Real64 GenContam; // {ppm}
+		Real64 GenContamSetPoint; // {ppm}
 		Real64 Height; // {m}
 		//  Following are for Outdoor Air Nodes "read only"
 		Real64 OutAirDryBulb; // {C}
-		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
 		Real64 EMSValueForOutAirDryBulb; // value EMS is directing to use for outdoor air node's drybulb {C}
 		Real64 OutAirWetBulb; // {C}
-		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
 		Real64 EMSValueForOutAirWetBulb; // value EMS is directing to use for outdoor air node's wetbulb {C}
-		// Contaminant
-		Real64 CO2; // {ppm}
-		Real64 CO2SetPoint; // {ppm}
-		Real64 GenContam; // {ppm}
-		Real64 GenContamSetPoint; // {ppm}
+		// Integers and flags last so they pack without padding between the Real64 members
+		int FluidType; // must be one of the valid parameters
+		int FluidIndex; // For Fluid Properties
+		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
+		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
 		bool SPMNodeWetBulbRepReq; // Set to true when node has SPM which follows wetbulb
 
 		// Default Constructor
 		NodeData() :
-			FluidType( 0 ),
-			FluidIndex( 0 ),
 			Temp( 0.0 ),
-			TempMin( 0.0 ),
-			TempMax( 0.0 ),
-			TempSetPoint( SensedNodeFlagValue ),
-			TempLastTimestep( 0.0 ),
-			MassFlowRateRequest( 0.0 ),
 			MassFlowRate( 0.0 ),
-			MassFlowRateMin( 0.0 ),
-			MassFlowRateMax( SensedNodeFlagValue ),
+			HumRat( 0.0 ),
+			Enthalpy( 0.0 ),
+			Press( 0.0 ),
+			Quality( 0.0 ),
 			MassFlowRateMinAvail( 0.0 ),
 			MassFlowRateMaxAvail( 0.0 ),
+			MassFlowRateRequest( 0.0 ),
+			MassFlowRateMin( 0.0 ),
+			MassFlowRateMax( SensedNodeFlagValue ),
 			MassFlowRateSetPoint( 0.0 ),
-			Quality( 0.0 ),
-			Press( 0.0 ),
-			Enthalpy( 0.0 ),
-			EnthalpyLastTimestep( 0.0 ),
-			HumRat( 0.0 ),
+			TempSetPoint( SensedNodeFlagValue ),
+			HumRatSetPoint( SensedNodeFlagValue ),
+			TempMin( 0.0 ),
+			TempMax( 0.0 ),
 			HumRatMin( SensedNodeFlagValue ),
 			HumRatMax( SensedNodeFlagValue ),
-			HumRatSetPoint( SensedNodeFlagValue ),
 			TempSetPointHi( SensedNodeFlagValue ),
 			TempSetPointLo( SensedNodeFlagValue ),
+			TempLastTimestep( 0.0 ),
+			EnthalpyLastTimestep( 0.0 ),
+			CO2( 0.0 ),
+			CO2SetPoint( 0.0 ),
+			GenContam( 0.0 ),
+			GenContamSetPoint( 0.0 ),
 			Height( -1.0 ),
 			OutAirDryBulb( 0.0 ),
-			EMSOverrideOutAirDryBulb( false ),
 			EMSValueForOutAirDryBulb( 0.0 ),
 			OutAirWetBulb( 0.0 ),
-			EMSOverrideOutAirWetBulb( false ),
 			EMSValueForOutAirWetBulb( 0.0 ),
-			CO2( 0.0 ),
-			CO2SetPoint( 0.0 ),
-			GenContam( 0.0 ),
-			GenContamSetPoint( 0.0 ),
+			FluidType( 0 ),
+			FluidIndex( 0 ),
+			EMSOverrideOutAirDryBulb( false ),
+			EMSOverrideOutAirWetBulb( false ),
 			SPMNodeWetBulbRepReq( false )
 		{}
 
@@ -191,41 +195,41 @@ namespace DataLoopNode {
 			Real64 const GenContamSetPoint, // {ppm}
 			bool const SPMNodeWetBulbRepReq // Set to true when node has SPM which follows wetbulb
 		) :
-			FluidType( FluidType ),
-			FluidIndex( FluidIndex ),
 			Temp( Temp ),
-			TempMin( TempMin ),
-			TempMax( TempMax ),
-			TempSetPoint( TempSetPoint ),
-			TempLastTimestep( TempLastTimestep ),
-			MassFlowRateRequest( MassFlowRateRequest ),
 			MassFlowRate( MassFlowRate ),
-			MassFlowRateMin( MassFlowRateMin ),
-			MassFlowRateMax( MassFlowRateMax ),
+			HumRat( HumRat ),
+			Enthalpy( Enthalpy ),
+			Press( Press ),
+			Quality( Quality ),
 			MassFlowRateMinAvail( MassFlowRateMinAvail ),
 			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
+			MassFlowRateRequest( MassFlowRateRequest ),
+			MassFlowRateMin( MassFlowRateMin ),
+			MassFlowRateMax( MassFlowRateMax ),
 			MassFlowRateSetPoint( MassFlowRateSetPoint ),
-			Quality( Quality ),
-			Press( Press ),
-			Enthalpy( Enthalpy ),
-			EnthalpyLastTimestep( EnthalpyLastTimestep ),
-			HumRat( HumRat ),
+			TempSetPoint( TempSetPoint ),
+			HumRatSetPoint( HumRatSetPoint ),
+			TempMin( TempMin ),
+			TempMax( TempMax ),
 			HumRatMin( HumRatMin ),
 			HumRatMax( HumRatMax ),
-			HumRatSetPoint( HumRatSetPoint ),
 			TempSetPointHi( TempSetPointHi ),
 			TempSetPointLo( TempSetPointLo ),
+			TempLastTimestep( TempLastTimestep ),
+			EnthalpyLastTimestep( EnthalpyLastTimestep ),
+			CO2( CO2 ),
+			CO2SetPoint( CO2SetPoint ),
+			GenContam( GenContam ),
+			GenContamSetPoint( GenContamSetPoint ),
 			Height( Height ),
 			OutAirDryBulb( OutAirDryBulb ),
-			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
 			EMSValueForOutAirDryBulb( EMSValueForOutAirDryBulb ),
 			OutAirWetBulb( OutAirWetBulb ),
-			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
 			EMSValueForOutAirWetBulb( EMSValueForOutAirWetBulb ),
-			CO2( CO2 ),
-			CO2SetPoint( CO2SetPoint ),
-			GenContam( GenContam ),
-			GenContamSetPoint( GenContamSetPoint ),
+			FluidType( FluidType ),
+			FluidIndex( FluidIndex ),
+			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
+			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
 			SPMNodeWetBulbRepReq( SPMNodeWetBulbRepReq )
 		{}
 
@@ -344,6 +344,7 @@ namespace DataPlant {
 
 	int PlantManageSubIterations( 0 ); // tracks plant iterations to characterize solver
 	int PlantManageHalfLoopCalls( 0 ); // tracks number of half loop calls
+	int PlantManageHalfLoopSkips( 0 ); // tracks number of half loop calls skipped because nothing changed
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -358,6 +358,7 @@ namespace DataPlant {
 
 	extern int PlantManageSubIterations; // tracks plant iterations to characterize solver
 	extern int PlantManageHalfLoopCalls; // tracks number of half loop calls
+	extern int PlantManageHalfLoopSkips; // tracks number of half loop calls skipped because nothing changed
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -1849,6 +1850,7 @@ namespace DataPlant {
 		int NodeNumOut; // Component outlet node number
 		bool MeteredVarsFound;
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer - Reporting flag
 		Real64 TotPlantSupplyElec;
 		Real64 PlantSupplyElecEff;
@@ -1876,6 +1878,7 @@ namespace DataPlant {
 			NodeNumOut( 0 ),
 			MeteredVarsFound( false ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( 0 ),
 			TotPlantSupplyElec( 0.0 ),
 			PlantSupplyElecEff( 0.0 ),
@@ -1936,6 +1939,7 @@ namespace DataPlant {
 			NodeNumOut( NodeNumOut ),
 			MeteredVarsFound( MeteredVarsFound ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( EnergyTransComp ),
 			TotPlantSupplyElec( TotPlantSupplyElec ),
 			PlantSupplyElecEff( PlantSupplyElecEff ),
@@ -1973,6 +1977,7 @@ namespace DataPlant {
 		bool MeteredVarsFound;
 		bool ON; // TRUE = designated component or operation scheme available
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer - Reporting flag
 		Real64 Capacity;
 		Real64 Efficiency;
@@ -2004,6 +2009,7 @@ namespace DataPlant {
 			MeteredVarsFound( false ),
 			ON( true ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( 0 ),
 			Capacity( 0.0 ),
 			Efficiency( 0.0 ),
@@ -2071,6 +2077,7 @@ namespace DataPlant {
 			MeteredVarsFound( MeteredVarsFound ),
 			ON( ON ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( EnergyTransComp ),
 			Capacity( Capacity ),
 			Efficiency( Efficiency ),
@@ -5,6 +5,7 @@
 #include <functional>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -200,6 +201,8 @@ namespace DataRuntimeLanguage {
 		int VariableNum; // ref to global variable in runtime language
 		int SchedNum; // ref index ptr to schedule service (filled if Schedule Value)
 		//  INTEGER                                 :: VarType       = 0
+		Reference< Real64 > RealValue; // bound to the real output variable once the sensor is resolved
+		Reference_int IntValue; // bound to the integer output variable once the sensor is resolved
 
 		// Default Constructor
 		OutputVarSensorType() :
@@ -572,12 +575,74 @@ namespace DataRuntimeLanguage {
 
 	};
 
+	// Opcodes for the compiled form of an Erl expression (see RuntimeLanguageProcessor::CompileExpressions).
+	// The compiled form is a postfix instruction list evaluated on a stack of plain numbers.
+	enum ErlBytecodeOpCode {
+		ErlOpPushNumber, // push a numeric literal
+		ErlOpPushVariable, // push the value of an Erl variable, falls back to the interpreter if not a number
+		ErlOpNegative,
+		ErlOpDivide,
+		ErlOpMultiply,
+		ErlOpSubtract,
+		ErlOpAdd,
+		ErlOpEqual,
+		ErlOpNotEqual,
+		ErlOpLessOrEqual,
+		ErlOpGreaterOrEqual,
+		ErlOpLessThan,
+		ErlOpGreaterThan,
+		ErlOpRaiseToPower,
+		ErlOpLogicalAND,
+		ErlOpLogicalOR,
+		ErlOpRound,
+		ErlOpMod,
+		ErlOpSin,
+		ErlOpCos,
+		ErlOpArcSin,
+		ErlOpArcCos,
+		ErlOpDegToRad,
+		ErlOpRadToDeg,
+		ErlOpExp,
+		ErlOpLn,
+		ErlOpMax,
+		ErlOpMin,
+		ErlOpABS
+	};
+
+	struct ErlBytecodeType
+	{
+		// Members
+		int OpCode; // one of ErlBytecodeOpCode
+		int Variable; // index in ErlVariable structure for ErlOpPushVariable
+		Real64 Number; // literal value for ErlOpPushNumber
+
+		// Default Constructor
+		ErlBytecodeType() :
+			OpCode( ErlOpPushNumber ),
+			Variable( 0 ),
+			Number( 0.0 )
+		{}
+
+		// Member Constructor
+		ErlBytecodeType(
+			int const OpCode, // one of ErlBytecodeOpCode
+			int const Variable, // index in ErlVariable structure for ErlOpPushVariable
+			Real64 const Number // literal value for ErlOpPushNumber
+		) :
+			OpCode( OpCode ),
+			Variable( Variable ),
+			Number( Number )
+		{}
+
+	};
+
 	struct ErlExpressionType
 	{
 		// Members
 		int Operator; // indicates the type of operator or function 1..64
 		int NumOperands; // count of operands in expression
 		Array1D< ErlValueType > Operand; // holds Erl values for operands in expression
+		std::vector< ErlBytecodeType > Bytecode; // compiled postfix form of the expression tree, empty if it must be interpreted
 
 		// Default Constructor
 		ErlExpressionType() :
@@ -59,6 +59,8 @@ namespace DataStringGlobals {
 	extern std::string outputScreenCsvFileName;
 	extern std::string outputSqlFileName;
 	extern std::string outputSqliteErrFileName;
+	extern std::string outputCheckpointFileName;
+	extern std::string inputCheckpointFileName; // Checkpoint to resume from (--resume-from)
 	extern std::string EnergyPlusIniFileName;
 	extern std::string inStatFileName;
 	extern std::string TarcogIterationsFileName;
@@ -116,6 +116,8 @@ namespace DataStringGlobals {
 	std::string outputScreenCsvFileName("eplusscreen.csv");
 	std::string outputSqlFileName("eplusout.sql");
 	std::string outputSqliteErrFileName("eplussqlite.err");
+	std::string outputCheckpointFileName("eplusout.ckpt");
+	std::string inputCheckpointFileName; // Checkpoint to resume from (--resume-from)
 	std::string EnergyPlusIniFileName;
 	std::string inStatFileName;
 	std::string TarcogIterationsFileName("TarcogIterations.dbg");
@@ -72,6 +72,27 @@ namespace DataSystemVariables {
 	std::string const cSutherlandHodgman( "SutherlandHodgman" );
 	std::string const cMinimalSurfaceVariables( "CreateMinimalSurfaceVariables" );
 	std::string const cMinimalShadowing( "MinimalShadowing" );
+	std::string const cShadingCacheFolder( "EP_SHADING_CACHE" ); // Folder for cached shading results
+	std::string const cZoneInsideSurfConvergence( "ZoneInsideSurfConvergence" );
+	std::string const cHAMTDirectCellSolve( "HAMTDirectCellSolve" );
+	std::string const cGroundDomainLineSolve( "GroundDomainLineSolve" );
+	std::string const cBuriedPipeImplicitSolve( "BuriedPipeImplicitSolve" );
+	std::string const cGLHEMultiLevelAggregation( "GLHEMultiLevelAggregation" );
+	std::string const cParallelFMUImport( "ParallelFMUImport" );
+	std::string const cBCVTBBinaryExchange( "BCVTBBinaryExchange" );
+	std::string const cBCVTBPipelinedExchange( "BCVTBPipelinedExchange" );
+	std::string const cProfileTimings( "ProfileTimings" );
+	std::string const cMemoryBudget( "MemoryBudget" ); // Memory budget of the run {MB}
+	std::string const cCTFCacheFolder( "EP_CTF_CACHE" ); // Folder for cached CTFs
+	std::string const cGFunctionCacheFolder( "EP_GFUNC_CACHE" ); // Folder for cached ground heat exchanger g-functions
+	std::string const cDElightCacheFolder( "EP_DELIGHT_CACHE" ); // Folder for cached DElight daylight factors
+	std::string const cIDDCacheFolder( "EP_IDD_CACHE" ); // Folder for pre-parsed IDD snapshots
+	std::string const cBinaryOutput( "BinaryOutput" ); // Yes or True for eplusout.esob as well, Only for eplusout.esob values only
+	std::string const cEioRecords( "EioRecords" ); // Yes or True for eplusout.eiob as well, Only to leave its record classes out of eplusout.eio
+	std::string const cEioSuppress( "EioSuppress" ); // Semicolon separated eio record classes to leave out
+	std::string const cCsvOutput( "CsvOutput" ); // Yes or True for csv files of the eso values, TSV for tab separated files
+	std::string const cWriteOutputAsync( "WriteOutputAsync" );
+	std::string const cAsyncDisplay( "AsyncDisplay" );
 	std::string const cNumThreads( "OMP_NUM_THREADS" );
 	std::string const cepNumThreads( "EP_OMP_NUM_THREADS" );
 	std::string const cNumActiveSims( "cntActv" );
@@ -122,6 +143,30 @@ namespace DataSystemVariables {
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
+	std::string ShadingCacheFolder; // Folder for cached shading results (blank if not used)
+	bool ZoneInsideSurfConvergence( false ); // TRUE if each zone's inside surface heat balance converges on its own
+	bool HAMTDirectCellSolve( false ); // TRUE if the HAMT cells of a surface are solved together instead of one at a time
+	bool GroundDomainLineSolve( false ); // TRUE if ground domain field cells are solved a vertical column at a time
+	bool BuriedPipeImplicitSolve( false ); // TRUE if the soil nodes around a Pipe:Underground are solved implicitly, a pipe section at a time
+	bool GLHEMultiLevelAggregation( false ); // TRUE if ground heat exchanger load history uses multi-level aggregation
+	bool ParallelFMUImport( false ); // TRUE if separate imported FMUs are stepped in parallel
+	bool BCVTBBinaryExchange( false ); // TRUE if values are exchanged with the BCVTB server in binary frames
+	bool BCVTBPipelinedExchange( false ); // TRUE if the BCVTB exchange runs while the next zone time step is simulated
+	bool ProfileTimings( false ); // TRUE if the per-module timing profile is collected and written to the eio and SQL outputs
+	Real64 MemoryBudget( 0.0 ); // Memory budget of the run {MB}; when positive, features with compact variants use them (0 if not used)
+	std::string CTFCacheFolder; // Folder for cached CTFs (blank if not used)
+	std::string GFunctionCacheFolder; // Folder for cached ground heat exchanger g-functions (blank if not used)
+	std::string DElightCacheFolder; // Folder for cached DElight daylight factors (blank if not used)
+	std::string IDDCacheFolder; // Folder for pre-parsed IDD snapshots (blank if not used)
+	bool BinaryOutput( false ); // TRUE if report variable values are also written to the binary eplusout.esob file
+	bool BinaryOutputOnly( false ); // TRUE if report variable values are left out of eplusout.eso (binary file only)
+	bool EioRecords( false ); // TRUE if the structured initialization reports are also written to the binary eplusout.eiob file
+	bool EioRecordsOnly( false ); // TRUE if the record classes written to eplusout.eiob are left out of eplusout.eio
+	std::string EioSuppress; // Semicolon separated eio record classes left out of eplusout.eio and eplusout.eiob (blank if none)
+	bool CsvOutput( false ); // TRUE if the eplusout.eso values are also written to csv files, one per reporting frequency
+	bool CsvOutputTabs( false ); // TRUE if the csv output files are tab separated
+	bool WriteOutputAsync( false ); // TRUE if eplusout.eso, eplusout.mtr and the tabular files are written by writer threads
+	bool AsyncDisplay( false ); // TRUE if the console messages and the message callback are handled by a display thread
 	std::string TempFullFileName;
 	std::string envinputpath1;
 	std::string envinputpath2;
@@ -137,6 +182,11 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumberShadingThreads( 1 );
+	int NumberSurfaceHBThreads( 1 );
+	int NumberGroundDomainThreads( 1 );
+	int NumberFMUThreads( 1 );
+	int NumberRoomAirThreads( 1 );
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
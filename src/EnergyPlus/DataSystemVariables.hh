@@ -41,6 +41,27 @@ namespace DataSystemVariables {
 	extern std::string const cSutherlandHodgman;
 	extern std::string const cMinimalSurfaceVariables;
 	extern std::string const cMinimalShadowing;
+	extern std::string const cShadingCacheFolder;
+	extern std::string const cZoneInsideSurfConvergence;
+	extern std::string const cHAMTDirectCellSolve;
+	extern std::string const cGroundDomainLineSolve;
+	extern std::string const cBuriedPipeImplicitSolve;
+	extern std::string const cGLHEMultiLevelAggregation;
+	extern std::string const cParallelFMUImport;
+	extern std::string const cBCVTBBinaryExchange;
+	extern std::string const cBCVTBPipelinedExchange;
+	extern std::string const cProfileTimings;
+	extern std::string const cMemoryBudget; // Memory budget of the run {MB}
+	extern std::string const cCTFCacheFolder;
+	extern std::string const cGFunctionCacheFolder;
+	extern std::string const cDElightCacheFolder;
+	extern std::string const cIDDCacheFolder;
+	extern std::string const cBinaryOutput;
+	extern std::string const cEioRecords;
+	extern std::string const cEioSuppress;
+	extern std::string const cCsvOutput;
+	extern std::string const cWriteOutputAsync;
+	extern std::string const cAsyncDisplay;
 	extern std::string const cNumThreads;
 	extern std::string const cepNumThreads;
 	extern std::string const cNumActiveSims;
@@ -91,6 +112,30 @@ namespace DataSystemVariables {
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
+	extern std::string ShadingCacheFolder; // Folder for cached shading results (blank if not used)
+	extern bool ZoneInsideSurfConvergence; // TRUE if each zone's inside surface heat balance converges on its own
+	extern bool HAMTDirectCellSolve; // TRUE if the HAMT cells of a surface are solved together instead of one at a time
+	extern bool GroundDomainLineSolve; // TRUE if ground domain field cells are solved a vertical column at a time
+	extern bool BuriedPipeImplicitSolve; // TRUE if the soil nodes around a Pipe:Underground are solved implicitly, a pipe section at a time
+	extern bool GLHEMultiLevelAggregation; // TRUE if ground heat exchanger load history uses multi-level aggregation
+	extern bool ParallelFMUImport; // TRUE if separate imported FMUs are stepped in parallel
+	extern bool BCVTBBinaryExchange; // TRUE if values are exchanged with the BCVTB server in binary frames
+	extern bool BCVTBPipelinedExchange; // TRUE if the BCVTB exchange runs while the next zone time step is simulated
+	extern bool ProfileTimings; // TRUE if the per-module timing profile is collected and written to the eio and SQL outputs
+	extern Real64 MemoryBudget; // Memory budget of the run {MB}; when positive, features with compact variants use them (0 if not used)
+	extern std::string CTFCacheFolder; // Folder for cached CTFs (blank if not used)
+	extern std::string GFunctionCacheFolder; // Folder for cached ground heat exchanger g-functions (blank if not used)
+	extern std::string DElightCacheFolder; // Folder for cached DElight daylight factors (blank if not used)
+	extern std::string IDDCacheFolder; // Folder for pre-parsed IDD snapshots (blank if not used)
+	extern bool BinaryOutput; // TRUE if report variable values are also written to the binary eplusout.esob file
+	extern bool BinaryOutputOnly; // TRUE if report variable values are left out of eplusout.eso (binary file only)
+	extern bool EioRecords; // TRUE if the structured initialization reports are also written to the binary eplusout.eiob file
+	extern bool EioRecordsOnly; // TRUE if the record classes written to eplusout.eiob are left out of eplusout.eio
+	extern std::string EioSuppress; // Semicolon separated eio record classes left out of eplusout.eio and eplusout.eiob (blank if none)
+	extern bool CsvOutput; // TRUE if the eplusout.eso values are also written to csv files, one per reporting frequency
+	extern bool CsvOutputTabs; // TRUE if the csv output files are tab separated
+	extern bool WriteOutputAsync; // TRUE if eplusout.eso, eplusout.mtr and the tabular files are written by writer threads
+	extern bool AsyncDisplay; // TRUE if the console messages and the message callback are handled by a display thread
 	extern std::string TempFullFileName;
 	extern std::string envinputpath1;
 	extern std::string envinputpath2;
@@ -106,6 +151,11 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumberShadingThreads;
+	extern int NumberSurfaceHBThreads;
+	extern int NumberGroundDomainThreads;
+	extern int NumberFMUThreads;
+	extern int NumberRoomAirThreads;
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
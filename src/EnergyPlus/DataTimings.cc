@@ -1,3 +1,19 @@
+// C++ Headers
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/gio.hh>
@@ -7,9 +23,11 @@
 #include <CommandLineInterface.hh>
 #include <DataTimings.hh>
 #include <DataErrorTracking.hh>
+#include <DataGlobals.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <General.hh>
+#include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
 #include <Timer.h>
 
@@ -94,6 +112,54 @@ namespace DataTimings {
 
 	// Object Data
 	Array1D< timings > Timing;
+	std::vector< ProfileThreadType * > ProfileThreads; // Call trees of all threads that entered a timed region
+
+	namespace {
+		// Owns the call trees; ProfileThreads is the public view
+		std::vector< std::unique_ptr< ProfileThreadType > > ProfileThreadStorage;
+		std::mutex ProfileThreadsMutex;
+		thread_local ProfileThreadType * ThisProfileThread( nullptr );
+	}
+
+	ProfileTimer::ProfileTimer( char const * name ) :
+		m_thread( nullptr ),
+		m_node( 0 )
+	{
+		if ( ! DataSystemVariables::ProfileTimings ) return;
+		m_thread = &epProfileThread();
+		auto & nodes( m_thread->Nodes );
+		int const parent( m_thread->Current );
+
+		// Find the region under the open one, or add it
+		int node( nodes[ parent ].FirstChild );
+		while ( node >= 0 && nodes[ node ].Name != name && std::strcmp( nodes[ node ].Name, name ) != 0 ) {
+			node = nodes[ node ].NextSibling;
+		}
+		if ( node < 0 ) {
+			node = static_cast< int >( nodes.size() );
+			nodes.emplace_back();
+			nodes[ node ].Name = name;
+			nodes[ node ].Parent = parent;
+			nodes[ node ].NextSibling = nodes[ parent ].FirstChild;
+			nodes[ parent ].FirstChild = node;
+		}
+
+		m_node = node;
+		m_thread->Current = node;
+		m_start = std::chrono::steady_clock::now();
+	}
+
+	ProfileTimer::~ProfileTimer()
+	{
+		if ( m_thread == nullptr ) return;
+		Real64 const elapsed( std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - m_start ).count() );
+		auto & nodes( m_thread->Nodes );
+		auto & node( nodes[ m_node ] );
+		++node.calls;
+		node.InclusiveTime += elapsed;
+		nodes[ node.Parent ].ChildTime += elapsed;
+		m_thread->Current = node.Parent;
+	}
 
 	// Functions
 
@@ -588,6 +654,202 @@ namespace DataTimings {
 
 	}
 
+	Real64
+	epPeakMemoryUsage()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the peak resident memory (working set) of the process so far in MB, or 0 if
+		// the operating system does not report it.
+
+		// METHODOLOGY EMPLOYED:
+		// getrusage reports the maximum resident set size in kilobytes on Linux and in bytes
+		// on OS X; Windows reports the peak working set in bytes.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS counters;
+		if ( ! GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) ) return 0.0;
+		return counters.PeakWorkingSetSize / ( 1024.0 * 1024.0 );
+#else
+		struct rusage usage;
+		if ( getrusage( RUSAGE_SELF, &usage ) != 0 ) return 0.0;
+#ifdef __APPLE__
+		return usage.ru_maxrss / ( 1024.0 * 1024.0 );
+#else
+		return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+
+	}
+
+	ProfileThreadType &
+	epProfileThread()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the timing profile call tree of the calling thread, creating it the
+		// first time the thread enters a timed region.
+
+		// METHODOLOGY EMPLOYED:
+		// Each thread only touches its own tree while timing, so the timers need no locking;
+		// the lock is only taken to register a new thread.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		if ( ThisProfileThread == nullptr ) {
+			std::lock_guard< std::mutex > lock( ProfileThreadsMutex );
+			ProfileThreadStorage.emplace_back( new ProfileThreadType() );
+			ThisProfileThread = ProfileThreadStorage.back().get();
+			ThisProfileThread->ThreadIndex = static_cast< int >( ProfileThreads.size() );
+			ProfileThreads.push_back( ThisProfileThread );
+		}
+		return *ThisProfileThread;
+
+	}
+
+	void
+	epProfileReport()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the timing profile to the eio file and the Timings table of the SQLite output:
+		// one line per timed region and thread with its calls and its inclusive and exclusive
+		// time, followed by the totals of each region over all threads and call paths and the
+		// peak memory of the run so far.
+
+		// METHODOLOGY EMPLOYED:
+		// The exclusive time of a region is its inclusive time less the time of the regions
+		// timed inside it.  In the totals, a region nested inside itself is only counted once
+		// in the inclusive time.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		struct ProfileTotalType
+		{
+			Int64 calls = 0;
+			Real64 InclusiveTime = 0.0;
+			Real64 ExclusiveTime = 0.0;
+		};
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::map< std::string, ProfileTotalType > Totals; // By region name
+		int TimingIndex( 0 ); // Row of the Timings table
+
+		if ( ! DataSystemVariables::ProfileTimings || ProfileThreads.empty() ) return;
+
+		gio::write( OutputFileInits, fmtA ) << "! <Timing Profile>, Thread, Region Path, Calls, Inclusive Time {s}, Exclusive Time {s}";
+		for ( auto const thread : ProfileThreads ) {
+			auto const & nodes( thread->Nodes );
+			std::vector< std::string > Paths( nodes.size() );
+			std::vector< int > RowIndex( nodes.size(), 0 );
+
+			// Parents are always added before their children, so one forward pass sees them first
+			for ( int node = 1; node < int( nodes.size() ); ++node ) {
+				auto const & region( nodes[ node ] );
+				int const parent( region.Parent );
+				Paths[ node ] = ( parent > 0 ) ? Paths[ parent ] + '/' + region.Name : std::string( region.Name );
+				Real64 const exclusive( region.InclusiveTime - region.ChildTime );
+
+				gio::write( OutputFileInits, fmtA ) << " Timing Profile, " + RoundSigDigits( thread->ThreadIndex ) + ", " + Paths[ node ] + ", " + RoundSigDigits( int( region.calls ) ) + ", " + RoundSigDigits( region.InclusiveTime, 3 ) + ", " + RoundSigDigits( exclusive, 3 );
+				RowIndex[ node ] = ++TimingIndex;
+				if ( sqlite ) sqlite->createSQLiteTimingsRecord( TimingIndex, thread->ThreadIndex, RowIndex[ parent ], region.Name, Paths[ node ], region.calls, region.InclusiveTime, exclusive );
+
+				bool Recursive( false ); // Nested inside a region of the same name
+				for ( int ancestor = parent; ancestor > 0; ancestor = nodes[ ancestor ].Parent ) {
+					if ( std::strcmp( nodes[ ancestor ].Name, region.Name ) == 0 ) Recursive = true;
+				}
+				auto & total( Totals[ region.Name ] );
+				total.calls += region.calls;
+				if ( ! Recursive ) total.InclusiveTime += region.InclusiveTime;
+				total.ExclusiveTime += exclusive;
+			}
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Timing Profile Total>, Region, Calls, Inclusive Time {s}, Exclusive Time {s}";
+		for ( auto const & total : Totals ) {
+			gio::write( OutputFileInits, fmtA ) << " Timing Profile Total, " + total.first + ", " + RoundSigDigits( int( total.second.calls ) ) + ", " + RoundSigDigits( total.second.InclusiveTime, 3 ) + ", " + RoundSigDigits( total.second.ExclusiveTime, 3 );
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Timing Profile Peak Memory>, Peak Resident Memory {MB}";
+		gio::write( OutputFileInits, fmtA ) << " Timing Profile Peak Memory, " + RoundSigDigits( epPeakMemoryUsage(), 1 );
+
+	}
+
+	void
+	epProfileClear()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Empties the call trees of the timing profile.  Must not be called while a timed
+		// region is open.
+
+		// METHODOLOGY EMPLOYED:
+		// The trees stay registered with their threads and are reset in place.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		std::lock_guard< std::mutex > lock( ProfileThreadsMutex );
+		for ( auto const thread : ProfileThreads ) {
+			thread->Current = 0;
+			thread->Nodes.assign( 1, ProfileNodeType() );
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,6 +1,11 @@
 #ifndef DataTimings_hh_INCLUDED
 #define DataTimings_hh_INCLUDED
 
+// C++ Headers
+#include <chrono>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -96,8 +101,77 @@ namespace DataTimings {
 
 	};
 
+	// Hierarchical timing profile (collected when DataSystemVariables::ProfileTimings is on)
+	struct ProfileNodeType
+	{
+		// Members
+		char const * Name; // Name of the timed region (a string literal)
+		int Parent; // Node of the enclosing region (-1 for the root)
+		int FirstChild; // First region timed inside this one (-1 if none)
+		int NextSibling; // Next region with the same parent (-1 if none)
+		Int64 calls;
+		Real64 InclusiveTime; // Seconds spent in the region, including the regions timed inside it
+		Real64 ChildTime; // Seconds spent in the regions timed inside it
+
+		// Default Constructor
+		ProfileNodeType() :
+			Name( "" ),
+			Parent( -1 ),
+			FirstChild( -1 ),
+			NextSibling( -1 ),
+			calls( 0 ),
+			InclusiveTime( 0.0 ),
+			ChildTime( 0.0 )
+		{}
+
+	};
+
+	struct ProfileThreadType // Call tree of one thread; node 0 is the root
+	{
+		// Members
+		int ThreadIndex; // Order in which the thread first entered a timed region
+		int Current; // Node of the innermost open region
+		std::vector< ProfileNodeType > Nodes;
+
+		// Default Constructor
+		ProfileThreadType() :
+			ThreadIndex( 0 ),
+			Current( 0 ),
+			Nodes( 1 )
+		{}
+
+	};
+
+	// Times the enclosing scope as a region of the timing profile, nested in the region
+	// that is open on the same thread.  Does nothing unless ProfileTimings is on.
+	class ProfileTimer
+	{
+
+	public: // Creation
+
+		explicit
+		ProfileTimer( char const * name );
+
+		~ProfileTimer();
+
+	private: // Creation
+
+		ProfileTimer( ProfileTimer const & ); // Not copyable
+
+		ProfileTimer &
+		operator =( ProfileTimer const & ); // Not assignable
+
+	private: // Data
+
+		ProfileThreadType * m_thread; // Null when profiling is off
+		int m_node;
+		std::chrono::steady_clock::time_point m_start;
+
+	};
+
 	// Object Data
 	extern Array1D< timings > Timing;
+	extern std::vector< ProfileThreadType * > ProfileThreads; // Call trees of all threads that entered a timed region
 
 	// Functions
 
@@ -126,6 +200,18 @@ namespace DataTimings {
 	Real64
 	epElapsedTime();
 
+	Real64
+	epPeakMemoryUsage();
+
+	ProfileThreadType &
+	epProfileThread();
+
+	void
+	epProfileReport();
+
+	void
+	epProfileClear();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
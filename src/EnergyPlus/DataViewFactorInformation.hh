@@ -34,6 +34,8 @@ namespace DataViewFactorInformation {
 		Array2D< Real64 > ScriptF; // Hottel's Script F //Tuned Transposed
 		Array1D< Real64 > Area; // Surface area
 		Array1D< Real64 > Emissivity; // Surface emissivity
+		Array2D< Real64 > BaseCinverse; // Inverse of the ScriptF coefficient matrix for BaseEmissivity
+		Array1D< Real64 > BaseEmissivity; // Surface emissivities BaseCinverse was last formed with
 		Array1D< Real64 > Azimuth; // Azimuth angle of the surface (in degrees)
 		Array1D< Real64 > Tilt; // Tilt angle of the surface (in degrees)
 		Array1D_int SurfacePtr; // Surface ALLOCATABLE (to Surface derived type)
@@ -52,6 +54,8 @@ namespace DataViewFactorInformation {
 			Array2< Real64 > const & ScriptF, // Hottel's Script F //Tuned Transposed
 			Array1< Real64 > const & Area, // Surface area
 			Array1< Real64 > const & Emissivity, // Surface emissivity
+			Array2< Real64 > const & BaseCinverse, // Inverse of the ScriptF coefficient matrix for BaseEmissivity
+			Array1< Real64 > const & BaseEmissivity, // Surface emissivities BaseCinverse was last formed with
 			Array1< Real64 > const & Azimuth, // Azimuth angle of the surface (in degrees)
 			Array1< Real64 > const & Tilt, // Tilt angle of the surface (in degrees)
 			Array1_int const & SurfacePtr, // Surface ALLOCATABLE (to Surface derived type)
@@ -63,6 +67,8 @@ namespace DataViewFactorInformation {
 			ScriptF( ScriptF ),
 			Area( Area ),
 			Emissivity( Emissivity ),
+			BaseCinverse( BaseCinverse ),
+			BaseEmissivity( BaseEmissivity ),
 			Azimuth( Azimuth ),
 			Tilt( Tilt ),
 			SurfacePtr( SurfacePtr ),
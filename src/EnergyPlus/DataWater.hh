@@ -98,6 +98,7 @@ namespace DataWater {
 		Real64 ThisTimeStepVolume;
 		Real64 LastTimeStepVolume;
 		Real64 LastTimeStepTemp; // previous temperature of tank water
+		bool UpdateAfterSupply; // true if rain collectors, wells or other tanks can change this tank's supplies or demands
 		int NumWaterSupplies;
 		Array1D< Real64 > VdotAvailSupply; // Each supply component has its own term
 		Array1D< Real64 > TwaterSupply; // Each supply component has its own term
@@ -152,6 +153,7 @@ namespace DataWater {
 			ThisTimeStepVolume( 0.0 ),
 			LastTimeStepVolume( 0.0 ),
 			LastTimeStepTemp( 0.0 ),
+			UpdateAfterSupply( false ),
 			NumWaterSupplies( 0 ),
 			NumWaterDemands( 0 ),
 			VdotFromTank( 0.0 ),
@@ -259,6 +261,7 @@ namespace DataWater {
 			ThisTimeStepVolume( ThisTimeStepVolume ),
 			LastTimeStepVolume( LastTimeStepVolume ),
 			LastTimeStepTemp( LastTimeStepTemp ),
+			UpdateAfterSupply( false ),
 			NumWaterSupplies( NumWaterSupplies ),
 			VdotAvailSupply( VdotAvailSupply ),
 			TwaterSupply( TwaterSupply ),
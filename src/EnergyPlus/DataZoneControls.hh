@@ -75,6 +75,7 @@ namespace DataZoneControls {
 		//      below the original cooling setpoint, %RH/deltaC
 		std::string DehumidifyingSched; // Name of the schedule to determine the zone dehumidifying setpoint
 		int DehumidifyingSchedIndex; // Index for dehumidifying schedule
+		int NameID; // Interned ID of Name (see InputProcessor::InternName)
 
 		// Default Constructor
 		ZoneTempControls() :
@@ -102,7 +103,8 @@ namespace DataZoneControls {
 			ZoneOvercoolConstRange( 0.0 ),
 			ZoneOvercoolRangeSchedIndex( 0 ),
 			ZoneOvercoolControlRatio( 0.0 ),
-			DehumidifyingSchedIndex( 0 )
+			DehumidifyingSchedIndex( 0 ),
+			NameID( 0 )
 		{}
 
 		// Member Constructor
@@ -171,7 +173,8 @@ namespace DataZoneControls {
 			ZoneOvercoolRangeSchedIndex( ZoneOvercoolRangeSchedIndex ),
 			ZoneOvercoolControlRatio( ZoneOvercoolControlRatio ),
 			DehumidifyingSched( DehumidifyingSched ),
-			DehumidifyingSchedIndex( DehumidifyingSchedIndex )
+			DehumidifyingSchedIndex( DehumidifyingSchedIndex ),
+			NameID( 0 )
 		{}
 
 	};
@@ -191,6 +194,7 @@ namespace DataZoneControls {
 		Real64 EMSOverrideHumidifySetPointValue; // value EMS is directing to use for humidifying setpoint
 		bool EMSOverrideDehumidifySetPointOn; // EMS is calling to override dehumidifying setpoint
 		Real64 EMSOverrideDehumidifySetPointValue; // value EMS is directing to use for dehumidifying setpoint
+		int ControlNameID; // Interned ID of ControlName (see InputProcessor::InternName)
 
 		// Default Constructor
 		ZoneHumidityControls() :
@@ -201,7 +205,8 @@ namespace DataZoneControls {
 			EMSOverrideHumidifySetPointOn( false ),
 			EMSOverrideHumidifySetPointValue( 0.0 ),
 			EMSOverrideDehumidifySetPointOn( false ),
-			EMSOverrideDehumidifySetPointValue( 0.0 )
+			EMSOverrideDehumidifySetPointValue( 0.0 ),
+			ControlNameID( 0 )
 		{}
 
 		// Member Constructor
@@ -230,7 +235,8 @@ namespace DataZoneControls {
 			EMSOverrideHumidifySetPointOn( EMSOverrideHumidifySetPointOn ),
 			EMSOverrideHumidifySetPointValue( EMSOverrideHumidifySetPointValue ),
 			EMSOverrideDehumidifySetPointOn( EMSOverrideDehumidifySetPointOn ),
-			EMSOverrideDehumidifySetPointValue( EMSOverrideDehumidifySetPointValue )
+			EMSOverrideDehumidifySetPointValue( EMSOverrideDehumidifySetPointValue ),
+			ControlNameID( 0 )
 		{}
 
 	};
@@ -10,6 +10,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataTimings.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <InputProcessor.hh>
@@ -276,6 +277,8 @@ namespace DataZoneEquipment {
 		// Object Data
 		Array1D< EquipListAudit > ZoneEquipListAcct;
 
+		DataTimings::ProfileTimer const profileTimer( "GetZoneEquipmentData1" ); // Region of the timing profile
+
 		ExhaustNodeListName = "";
 		InletNodeListName = "";
 
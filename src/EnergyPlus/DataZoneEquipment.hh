@@ -150,6 +150,7 @@ namespace DataZoneEquipment {
 		int InletNodeNum;
 		int OutletNodeNum;
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		Array1D< EquipMeterData > MeteredVar; // Index of energy output report data
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer  Flag needed for reporting
 		int ZoneEqToPlantPtr; // 0=No plant loop connection, >=0 index to ZoneEqToPlant array
@@ -176,6 +177,7 @@ namespace DataZoneEquipment {
 			InletNodeNum( 0 ),
 			OutletNodeNum( 0 ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( 0 ),
 			ZoneEqToPlantPtr( 0 ),
 			OpMode( 0 ),
@@ -230,6 +232,7 @@ namespace DataZoneEquipment {
 			InletNodeNum( InletNodeNum ),
 			OutletNodeNum( OutletNodeNum ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			MeteredVar( MeteredVar ),
 			EnergyTransComp( EnergyTransComp ),
 			ZoneEqToPlantPtr( ZoneEqToPlantPtr ),
@@ -264,6 +267,7 @@ namespace DataZoneEquipment {
 		int InletNodeNum;
 		int OutletNodeNum;
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		Array1D< EquipMeterData > MeteredVar; // Index of energy output report data
 		Array1D< SubSubEquipmentData > SubSubEquipData; // Component list
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer  Flag needed for reporting
@@ -293,6 +297,7 @@ namespace DataZoneEquipment {
 			InletNodeNum( 0 ),
 			OutletNodeNum( 0 ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( 0 ),
 			ZoneEqToPlantPtr( 0 ),
 			OpMode( 0 ),
@@ -352,6 +357,7 @@ namespace DataZoneEquipment {
 			InletNodeNum( InletNodeNum ),
 			OutletNodeNum( OutletNodeNum ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			MeteredVar( MeteredVar ),
 			SubSubEquipData( SubSubEquipData ),
 			EnergyTransComp( EnergyTransComp ),
@@ -562,6 +568,7 @@ namespace DataZoneEquipment {
 		Array1D_int InletNodeNums;
 		Array1D_int OutletNodeNums;
 		int NumMeteredVars;
+		int SysRptCompType; // SystemReports component type index (-1 = not yet looked up)
 		Array1D< EquipMeterData > MeteredVar; // Index of energy output report data
 		Array1D< SubEquipmentData > SubEquipData; // Component list
 		int EnergyTransComp; // 1=EnergyTransfer, 0=No EnergyTransfer  Flag needed for reporting
@@ -589,6 +596,7 @@ namespace DataZoneEquipment {
 			NumInlets( 0 ),
 			NumOutlets( 0 ),
 			NumMeteredVars( 0 ),
+			SysRptCompType( -1 ),
 			EnergyTransComp( 0 ),
 			ZoneEqToPlantPtr( 0 ),
 			TotPlantSupplyElec( 0.0 ),
@@ -648,6 +656,7 @@ namespace DataZoneEquipment {
 			InletNodeNums( InletNodeNums ),
 			OutletNodeNums( OutletNodeNums ),
 			NumMeteredVars( NumMeteredVars ),
+			SysRptCompType( -1 ),
 			MeteredVar( MeteredVar ),
 			SubEquipData( SubEquipData ),
 			EnergyTransComp( EnergyTransComp ),
@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/numeric.hh>
@@ -166,6 +167,7 @@ namespace DaylightingDevices {
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   May 2003
 		//       MODIFIED       PGE, Aug 2003:  Added daylighting shelves.
+		//                      Oct 2026, calculate the transmittance tables and integrals in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -174,12 +176,16 @@ namespace DaylightingDevices {
 
 		// METHODOLOGY EMPLOYED:
 		// Daylighting and thermal variables are calculated.  BeamTrans/COSAngle table is calculated.
+		// The distinct pipes (aspect ratio and reflectance) are found first; the numerical integrals
+		// for their beam transmittance tables, and then the sky and horizon diffuse transmittances
+		// of each TDD, are independent and are calculated in parallel across the NumberShadingThreads.
 
 		// REFERENCES: na
 
 		// Using/Aliasing
 		using General::RoundSigDigits;
 		using DataHeatBalance::IntGainTypeOf_DaylightingDeviceTubular;
+		using DataSystemVariables::NumberShadingThreads;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS: na
@@ -202,6 +208,10 @@ namespace DaylightingDevices {
 		int ShelfNum; // Daylighting shelf object number
 		int ShelfSurf; // Daylighting shelf surface number
 		int WinSurf; // Window surface number
+		int NumTableEntries; // Number of beam transmittance table entries to integrate
+		int const NumIntermediateAngles( NumOfAngles - 2 ); // Table entries between 0 and 90 degrees
+		Array1D< Real64 > ThetaAngle( NumOfAngles ); // List of incident angles in radians
+		Array2D_int PipeStoredNum; // Stored TDD pipe object number of the visible and solar table of each TDD pipe
 
 		static int NumStored( 0 ); // Counter for number of pipes stored as they are calculated
 		static bool ShelfReported( false );
@@ -250,10 +260,12 @@ namespace DaylightingDevices {
 			Theta = 90.0 * DegToRadians;
 			for ( AngleNum = 2; AngleNum <= NumOfAngles - 1; ++AngleNum ) {
 				Theta -= dTheta;
+				ThetaAngle( AngleNum ) = Theta;
 				COSAngle( AngleNum ) = std::cos( Theta );
 			} // AngleNum
 
 			TDDPipeStored.allocate( NumOfTDDPipes * 2 );
+			PipeStoredNum.allocate( 2, NumOfTDDPipes );
 
 			for ( PipeNum = 1; PipeNum <= NumOfTDDPipes; ++PipeNum ) {
 				// Initialize optical properties
@@ -261,11 +273,11 @@ namespace DaylightingDevices {
 				TDDPipe( PipeNum ).ReflectVis = 1.0 - Construct( TDDPipe( PipeNum ).Construction ).InsideAbsorpVis;
 				TDDPipe( PipeNum ).ReflectSol = 1.0 - Construct( TDDPipe( PipeNum ).Construction ).InsideAbsorpSolar;
 
-				// Calculate the beam transmittance table for visible and solar spectrum
+				// Find the beam transmittance tables needed for the visible and solar spectrum
 				// First time thru use the visible reflectance
 				Reflectance = TDDPipe( PipeNum ).ReflectVis;
 				for ( Loop = 1; Loop <= 2; ++Loop ) {
-					// For computational efficiency, search stored pipes to see if an identical pipe has already been calculated
+					// For computational efficiency, search stored pipes to see if an identical pipe has already been found
 					Found = false;
 					for ( StoredNum = 1; StoredNum <= NumStored; ++StoredNum ) {
 						if ( TDDPipeStored( StoredNum ).AspectRatio != TDDPipe( PipeNum ).AspectRatio ) continue;
@@ -275,7 +287,7 @@ namespace DaylightingDevices {
 						}
 					} // StoredNum
 
-					if ( ! Found ) { // Not yet calculated
+					if ( ! Found ) { // Not yet found
 
 						// Add a new pipe to TDDPipeStored
 						++NumStored;
@@ -286,31 +298,43 @@ namespace DaylightingDevices {
 						TDDPipeStored( NumStored ).TransBeam( 1 ) = 0.0;
 						TDDPipeStored( NumStored ).TransBeam( NumOfAngles ) = 1.0;
 
-						// Calculate intermediate beam transmittances between 0 and 90 degrees
-						Theta = 90.0 * DegToRadians;
-						for ( AngleNum = 2; AngleNum <= NumOfAngles - 1; ++AngleNum ) {
-							Theta -= dTheta;
-							TDDPipeStored( NumStored ).TransBeam( AngleNum ) = CalcPipeTransBeam( Reflectance, TDDPipe( PipeNum ).AspectRatio, Theta );
-						} // AngleNum
-
 						StoredNum = NumStored;
 					}
 
-					// Assign stored values to TDDPipe
-					if ( Loop == 1 ) { // Visible
-						TDDPipe( PipeNum ).PipeTransVisBeam = TDDPipeStored( StoredNum ).TransBeam;
-					} else { // Solar
-						TDDPipe( PipeNum ).PipeTransSolBeam = TDDPipeStored( StoredNum ).TransBeam;
-					}
+					PipeStoredNum( Loop, PipeNum ) = StoredNum;
 
 					// Second time thru use the solar reflectance
 					Reflectance = TDDPipe( PipeNum ).ReflectSol;
 				} // Loop
+			} // PipeNum
 
-				// Calculate the solar isotropic diffuse and horizon transmittances.  These values are constant for a given TDD.
-				TDDPipe( PipeNum ).TransSolIso = CalcTDDTransSolIso( PipeNum );
-				TDDPipe( PipeNum ).TransSolHorizon = CalcTDDTransSolHorizon( PipeNum );
+			// Calculate intermediate beam transmittances between 0 and 90 degrees of all stored pipes
+			NumTableEntries = NumStored * NumIntermediateAngles;
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 && NumTableEntries > 1 )
+#endif
+			for ( int Entry = 0; Entry < NumTableEntries; ++Entry ) {
+				int const EntryStoredNum( Entry / NumIntermediateAngles + 1 );
+				int const EntryAngleNum( Entry % NumIntermediateAngles + 2 );
+				TDDPipeStored( EntryStoredNum ).TransBeam( EntryAngleNum ) = CalcPipeTransBeam( TDDPipeStored( EntryStoredNum ).Reflectance, TDDPipeStored( EntryStoredNum ).AspectRatio, ThetaAngle( EntryAngleNum ) );
+			} // Entry
+
+			// Assign stored values to TDDPipe
+			for ( PipeNum = 1; PipeNum <= NumOfTDDPipes; ++PipeNum ) {
+				TDDPipe( PipeNum ).PipeTransVisBeam = TDDPipeStored( PipeStoredNum( 1, PipeNum ) ).TransBeam;
+				TDDPipe( PipeNum ).PipeTransSolBeam = TDDPipeStored( PipeStoredNum( 2, PipeNum ) ).TransBeam;
+			} // PipeNum
+
+			// Calculate the solar isotropic diffuse and horizon transmittances.  These values are constant for a given TDD.
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 && NumOfTDDPipes > 1 )
+#endif
+			for ( int DiffPipeNum = 1; DiffPipeNum <= NumOfTDDPipes; ++DiffPipeNum ) {
+				TDDPipe( DiffPipeNum ).TransSolIso = CalcTDDTransSolIso( DiffPipeNum );
+				TDDPipe( DiffPipeNum ).TransSolHorizon = CalcTDDTransSolHorizon( DiffPipeNum );
+			} // DiffPipeNum
 
+			for ( PipeNum = 1; PipeNum <= NumOfTDDPipes; ++PipeNum ) {
 				// Initialize thermal properties
 				SumTZoneLengths = 0.0;
 				for ( TZoneNum = 1; TZoneNum <= TDDPipe( PipeNum ).NumOfTZones; ++TZoneNum ) {
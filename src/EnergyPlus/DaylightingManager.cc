@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -26,6 +27,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DaylightingDevices.hh>
 #include <DElightManagerF.hh>
 #include <DisplayRoutines.hh>
@@ -37,6 +39,7 @@
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
 #include <SQLiteProcedures.hh>
+#include <SurfaceRayTree.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -103,6 +106,7 @@ namespace DaylightingManager {
 	using DataBSDFWindow::ComplexWind;
 
 	using namespace ScheduleManager;
+	using SurfaceRayTree::SurfacesAlongRay;
 	//USE Vectors
 
 	// Data
@@ -1106,6 +1110,14 @@ namespace DaylightingManager {
 
 		} // End of reference point loop, IL
 
+		// Solid angle terms of the glare index, which only change with the geometry
+		for ( IL = 1; IL <= NRF; ++IL ) {
+			for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+				ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtdPow( loopwin, IL ) = std::pow( ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtd( loopwin, IL ), 0.8 );
+				ZoneDaylight( ZoneNum ).SolidAngAtRefPtSqrt( loopwin, IL ) = std::sqrt( ZoneDaylight( ZoneNum ).SolidAngAtRefPt( loopwin, IL ) );
+			}
+		}
+
 	}
 
 	void
@@ -2395,7 +2407,6 @@ namespace DaylightingManager {
 		int IRay;
 		int iHit;
 		int TotHits;
-		int JSurf;
 		Real64 DotProd; // Temporary variable for manipulating dot product .dot.
 		int NSky;
 		int NGnd;
@@ -2475,7 +2486,9 @@ namespace DaylightingManager {
 
 					iHit = 0;
 					TotHits = 0;
-					for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+					static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+					SurfacesAlongRay( Centroid, ComplexWind( iWin ).Geom( CurFenState ).sInc( IRay ), RaySurfNums );
+					for ( int const JSurf : RaySurfNums ) {
 						// the following test will cycle on anything except exterior surfaces and shading surfaces
 						if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
 						//  skip the base surface containing the window and any other subsurfaces of that surface
@@ -2960,7 +2973,6 @@ namespace DaylightingManager {
 		Real64 dOmegaGnd; // Solid angle element of ray from ground point (steradians)
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		int IHitObs; // 1 if obstruction is hit; 0 otherwise
-		int ObsSurfNum; // Surface number of obstruction
 		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 
 		DPhi = PiOvr2 / ( AltSteps / 2.0 );
@@ -2988,7 +3000,9 @@ namespace DaylightingManager {
 				SkyGndUnObs += IncAngSolidAngFac;
 				// Does this ground ray hit an obstruction?
 				IHitObs = 0;
-				for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+				static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+				SurfacesAlongRay( GroundHitPt, URay, RaySurfNums );
+				for ( int const ObsSurfNum : RaySurfNums ) {
 					if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 					DayltgPierceSurface( ObsSurfNum, GroundHitPt, URay, IHitObs, ObsHitPt );
 					if ( IHitObs > 0 ) break;
@@ -3354,7 +3368,9 @@ namespace DaylightingManager {
 							if ( CalcSolRefl ) { // Coordinates of ground point hit by the ray
 								// Sun reaches ground point if vector from this point to the sun is unobstructed
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+								SurfacesAlongRay( GroundHitPt, SUNCOS_iHour, RaySurfNums );
+								for ( int const ObsSurfNum : RaySurfNums ) {
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_iHour, IHitObs, ObsHitPt );
 									if ( IHitObs > 0 ) break;
@@ -3613,7 +3629,9 @@ namespace DaylightingManager {
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+									SurfacesAlongRay( HitPtRefl, RAYCOS, RaySurfNums );
+									for ( int const ObsSurfNum : RaySurfNums ) {
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 										DayltgPierceSurface( ObsSurfNum, HitPtRefl, RAYCOS, IHitObs, HitPtObs );
@@ -4051,6 +4069,8 @@ namespace DaylightingManager {
 		int NumNumbers;
 		int IOStat;
 
+		DataTimings::ProfileTimer const profileTimer( "GetDaylightingParametersInput" ); // Region of the timing profile
+
 		ErrorsFound = false;
 		cCurrentModuleObject = "Daylighting:Controls";
 		TotDaylightingDetailed = GetNumObjectsFound( cCurrentModuleObject );
@@ -4820,10 +4840,18 @@ namespace DaylightingManager {
 
 		if ( ErrorsFound ) return;
 
+		bool const GlareReported( GlareIndexReported() );
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
 			if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints == 0 ) continue;
 
+			// The glare index is only needed for glare control of the zone windows or for reporting
+			ZoneDaylight( ZoneNum ).GlareCalcNeeded = GlareReported;
+			for ( int loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+				int const ShadingCtrl( Surface( ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop ) ).WindowShadingControlPtr );
+				if ( ShadingCtrl > 0 && WindowShadingControl( ShadingCtrl ).GlareControlIsActive ) ZoneDaylight( ZoneNum ).GlareCalcNeeded = true;
+			}
+
 			if ( ZoneDaylight( ZoneNum ).TotalDaylRefPoints > 0 ) {
 				SetupOutputVariable( "Daylighting Reference Point 1 Illuminance [lux]", ZoneDaylight( ZoneNum ).DaylIllumAtRefPt( 1 ), "Zone", "Average", Zone( ZoneNum ).Name );
 				SetupOutputVariable( "Daylighting Reference Point 1 Glare Index []", ZoneDaylight( ZoneNum ).GlareIndexAtRefPt( 1 ), "Zone", "Average", Zone( ZoneNum ).Name );
@@ -5105,7 +5133,7 @@ namespace DaylightingManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   July 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, solid angle terms taken from SolidAngAtRefPtWtdPow/SolidAngAtRefPtSqrt
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5157,8 +5185,8 @@ namespace DaylightingManager {
 			if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
 			// Conversion from ft-L to cd/m2, with cd/m2 = 0.2936 ft-L, gives the 0.4794 factor
 			// below, which is (0.2936)**0.6
-			GTOT1 = 0.4794 * ( std::pow( ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL ), 1.6 ) ) * std::pow( ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtd( loop, IL ), 0.8 );
-			GTOT2 = BLUM + 0.07 * ( std::sqrt( ZoneDaylight( ZoneNum ).SolidAngAtRefPt( loop, IL ) ) ) * ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL );
+			GTOT1 = 0.4794 * ( std::pow( ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL ), 1.6 ) ) * ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtdPow( loop, IL );
+			GTOT2 = BLUM + 0.07 * ZoneDaylight( ZoneNum ).SolidAngAtRefPtSqrt( loop, IL ) * ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL );
 			GTOT += GTOT1 / ( GTOT2 + 0.000001 );
 		}
 
@@ -5169,6 +5197,64 @@ namespace DaylightingManager {
 
 	}
 
+	bool
+	GlareIndexReported()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines if the daylighting glare index is reported, as an output variable, in an
+		// Output:Table:Monthly report or in the DaylightingReportMonthly predefined report.
+
+		// METHODOLOGY EMPLOYED:
+		// The tabular report input is read after the daylighting input, so the report objects
+		// are scanned here the way isCompLoadRepReq does.
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::SameString;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static Array1D_string const GlareVarNames( 4, { "Daylighting Reference Point 1 Glare Index", "Daylighting Reference Point 1 Glare Index Setpoint Exceeded Time", "Daylighting Reference Point 2 Glare Index", "Daylighting Reference Point 2 Glare Index Setpoint Exceeded Time" } );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumParams;
+		int NumAlphas; // Number of elements in the alpha array
+		int NumNums; // Number of elements in the numeric array
+		int IOStat; // IO Status when calling get input subroutine
+
+		for ( int VarNum = 1; VarNum <= 4; ++VarNum ) {
+			if ( ReportingThisVariable( GlareVarNames( VarNum ) ) ) return true;
+		}
+
+		for ( std::string const CurrentModuleObject : { "Output:Table:Monthly", "Output:Table:SummaryReports" } ) {
+			int const NumReports( GetNumObjectsFound( CurrentModuleObject ) );
+			if ( NumReports == 0 ) continue;
+			GetObjectDefMaxArgs( CurrentModuleObject, NumParams, NumAlphas, NumNums );
+			Array1D_string AlphArray( NumAlphas );
+			Array1D< Real64 > NumArray( NumNums, 0.0 );
+			for ( int ReportNum = 1; ReportNum <= NumReports; ++ReportNum ) {
+				GetObjectItem( CurrentModuleObject, ReportNum, AlphArray, NumAlphas, NumArray, NumNums, IOStat );
+				for ( int AlphaNum = 1; AlphaNum <= NumAlphas; ++AlphaNum ) {
+					for ( int VarNum = 1; VarNum <= 4; ++VarNum ) {
+						if ( SameString( AlphArray( AlphaNum ), GlareVarNames( VarNum ) ) ) return true;
+					}
+					if ( SameString( AlphArray( AlphaNum ), "DaylightingReportMonthly" ) || SameString( AlphArray( AlphaNum ), "AllMonthly" ) || SameString( AlphArray( AlphaNum ), "AllSummaryAndMonthly" ) || SameString( AlphArray( AlphaNum ), "AllSummaryMonthlyAndSizingPeriod" ) ) return true;
+				}
+			}
+		}
+
+		return false;
+
+	}
+
 	void
 	DayltgGlareWithIntWins(
 		Array1A< Real64 > GLINDX, // Glare index
@@ -5179,7 +5265,7 @@ namespace DaylightingManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   March 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, solid angle terms taken from SolidAngAtRefPtWtdPow/SolidAngAtRefPtSqrt
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5236,8 +5322,8 @@ namespace DaylightingManager {
 				if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
 				// Conversion from ft-L to cd/m2, with cd/m2 = 0.2936 ft-L, gives the 0.4794 factor
 				// below, which is (0.2936)**0.6
-				GTOT1 = 0.4794 * ( std::pow( ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL ), 1.6 ) ) * std::pow( ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtd( loop, IL ), 0.8 );
-				GTOT2 = BacLum + 0.07 * ( std::sqrt( ZoneDaylight( ZoneNum ).SolidAngAtRefPt( loop, IL ) ) ) * ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL );
+				GTOT1 = 0.4794 * ( std::pow( ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL ), 1.6 ) ) * ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtdPow( loop, IL );
+				GTOT2 = BacLum + 0.07 * ZoneDaylight( ZoneNum ).SolidAngAtRefPtSqrt( loop, IL ) * ZoneDaylight( ZoneNum ).SourceLumFromWinAtRefPt( loop, IS, IL );
 				GTOT += GTOT1 / ( GTOT2 + 0.000001 );
 			}
 
@@ -5412,6 +5498,7 @@ namespace DaylightingManager {
 		//       DATE WRITTEN   July 1997
 		//       MODIFIED       Sept 2003, FCW: change shape test for rectangular surface to exclude
 		//                       triangular windows (Surface%Shape=8)
+		//                      Oct 2026: do the plane tests before filling the vertex arrays
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5480,31 +5567,22 @@ namespace DaylightingManager {
 			FirstTimeFlag = false;
 		}
 		IPIERC = 0;
-		// Vertex vectors
+		// First three vertices and the first two vertex-to-vertex vectors are enough for the plane
+		// tests, which reject most surfaces: the vertex arrays are only filled for non-rectangles
 		NV = Surface( ISurf ).Sides;
 		auto const & vertex( Surface( ISurf ).Vertex );
-		Array2D< Real64 >::size_type l1( 0u );
-		Array2D< Real64 >::size_type l2( MaxVerticesPerSurface );
-		Array2D< Real64 >::size_type l3( 2 * MaxVerticesPerSurface );
-		for ( N = 1; N <= NV; ++N, ++l1, ++l2, ++l3 ) {
-			V[ l1 ] = vertex( N ).x; // [ l1 ] == ( N, 1 )
-			V[ l2 ] = vertex( N ).y; // [ l2 ] == ( N, 2 )
-			V[ l3 ] = vertex( N ).z; // [ l3 ] == ( N, 3 )
-		}
-
-		// Vertex-to-vertex vectors. A(1,2) is from vertex 1 to 2, etc.
+		V1( 1 ) = vertex( 1 ).x;
+		V1( 2 ) = vertex( 1 ).y;
+		V1( 3 ) = vertex( 1 ).z;
+		V2( 1 ) = vertex( 2 ).x;
+		V2( 2 ) = vertex( 2 ).y;
+		V2( 3 ) = vertex( 2 ).z;
+		V3( 1 ) = vertex( 3 ).x;
+		V3( 2 ) = vertex( 3 ).y;
+		V3( 3 ) = vertex( 3 ).z;
 		for ( I = 1; I <= 3; ++I ) {
-			auto l( A.index( I, 1 ) );
-			for ( N = 1; N <= NV - 1; ++N, ++l ) {
-				A[ l ] = V[ l + 1 ] - V[ l ]; // [ l ] == ( N, I )
-			}
-			A( I, NV ) = V( I, 1 ) - V( I, NV );
-			l = A.index( I, 1 );
-			A1( I ) = A[ l ]; // [ l ] == ( 1, I )
-			V1( I ) = V[ l ]; // [ l ] == ( 1, I )
-			A2( I ) = A[ ++l ]; // [ l ] == ( 2, I )
-			V2( I ) = V[ l ]; // [ l ] == ( 2, I )
-			V3( I ) = V[ ++l ]; // [ l ] == ( 3, I )
+			A1( I ) = V2( I ) - V1( I );
+			A2( I ) = V3( I ) - V2( I );
 		}
 
 		// Vector normal to surface
@@ -5556,6 +5634,27 @@ namespace DaylightingManager {
 			// Surface is intersected
 			IPIERC = 1;
 		} else { // Surface is not rectangular
+			// Vertex vectors
+			{
+				Array2D< Real64 >::size_type l1( 0u );
+				Array2D< Real64 >::size_type l2( MaxVerticesPerSurface );
+				Array2D< Real64 >::size_type l3( 2 * MaxVerticesPerSurface );
+				for ( N = 1; N <= NV; ++N, ++l1, ++l2, ++l3 ) {
+					V[ l1 ] = vertex( N ).x; // [ l1 ] == ( N, 1 )
+					V[ l2 ] = vertex( N ).y; // [ l2 ] == ( N, 2 )
+					V[ l3 ] = vertex( N ).z; // [ l3 ] == ( N, 3 )
+				}
+			}
+
+			// Vertex-to-vertex vectors. A(1,2) is from vertex 1 to 2, etc.
+			for ( I = 1; I <= 3; ++I ) {
+				auto l( A.index( I, 1 ) );
+				for ( N = 1; N <= NV - 1; ++N, ++l ) {
+					A[ l ] = V[ l + 1 ] - V[ l ]; // [ l ] == ( N, I )
+				}
+				A( I, NV ) = V( I, 1 ) - V( I, NV );
+			}
+
 			// Vectors from surface vertices to CP
 			for ( I = 1; I <= 3; ++I ) {
 				auto l( C.index( I, 1 ) );
@@ -5637,7 +5736,6 @@ namespace DaylightingManager {
 		// DERIVED TYPE DEFINITIONS:na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ISurf; // Surface index
 		int IType; // Surface type/class
 		//  mirror surfaces of shading surfaces
 		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
@@ -5652,7 +5750,9 @@ namespace DaylightingManager {
 		// Building elements are assumed to be opaque. A shadowing surface is opaque unless
 		// its transmittance schedule value is non-zero.
 
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+		SurfacesAlongRay( R1, RN, RaySurfNums );
+		for ( int const ISurf : RaySurfNums ) {
 			if ( ! Surface( ISurf ).ShadowSurfPossibleObstruction ) continue;
 			IType = Surface( ISurf ).Class;
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf ) {
@@ -5727,7 +5827,6 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ISurf; // Surface index
 		int IType; // Surface type/class
 		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction
 		Real64 r12; // Distance between R1 and R2
@@ -5743,7 +5842,9 @@ namespace DaylightingManager {
 
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+		SurfacesAlongRay( R1, RN, RaySurfNums );
+		for ( int const ISurf : RaySurfNums ) {
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin ).BaseSurf && ISurf != Surface( Surface( IWin ).BaseSurf ).ExtBoundCond ) {
@@ -5813,7 +5914,6 @@ namespace DaylightingManager {
 		// DERIVED TYPE DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ISurf; // Surface index
 		int IType; // Surface type/class
 		static Array1D< Real64 > HP( 3 ); // Hit coordinates, if ray hits an obstruction surface (m)
 		Real64 r12; // Distance between R1 and R2 (m)
@@ -5830,7 +5930,9 @@ namespace DaylightingManager {
 		// Loop over obstructions, which can be building elements, like walls,
 		// or shadowing surfaces, like overhangs. Exclude base surface of window IWin1.
 		// Exclude base surface of window IWin2.
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
+		static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+		SurfacesAlongRay( R1, RN, RaySurfNums );
+		for ( int const ISurf : RaySurfNums ) {
 			IType = Surface( ISurf ).Class;
 
 			if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ISurf != Surface( IWin2 ).BaseSurf && ISurf != Surface( IWin1 ).BaseSurf && ISurf != Surface( Surface( IWin2 ).BaseSurf ).ExtBoundCond && ISurf != Surface( Surface( IWin1 ).BaseSurf ).ExtBoundCond ) {
@@ -5864,6 +5966,42 @@ namespace DaylightingManager {
 
 	}
 
+	void
+	DayltgInterpolateHours(
+		int const NumWins, // Number of daylit windows
+		DaylFactorReal const * const FacNow, // Window factors for the current hour sun position
+		DaylFactorReal const * const FacPrev, // Window factors for the previous hour sun position
+		Real64 const WeightNow, // Weight of the current hour
+		Real64 const WeightPrev, // Weight of the previous hour
+		Real64 * const Fac // Interpolated window factors
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Interpolates the daylight factors of a run of daylit windows between the current and
+		// previous hour sun positions.
+
+		// METHODOLOGY EMPLOYED:
+		// The window index is the contiguous index of the daylight factor arrays, so the factors of
+		// all the windows of a zone for one hour, shading index, sky type and reference point are
+		// adjacent and the interpolation is a single SIMD kernel. The stored factors are single
+		// precision; the interpolation is done in Real64.
+
+#if defined( _OPENMP ) && _OPENMP >= 201307
+#pragma omp simd
+#endif
+		for ( int i = 0; i < NumWins; ++i ) {
+			Fac[ i ] = WeightNow * FacNow[ i ] + WeightPrev * FacPrev[ i ];
+		}
+
+	}
+
 	void
 	DayltgInteriorIllum( int & ZoneNum ) // Zone number
 	{
@@ -5887,6 +6025,9 @@ namespace DaylightingManager {
 		//                      Jan 2010, TH (CR 7984): added iterations for switchable windows with shading
 		//                       control of MeetDaylightIlluminanceSetpoint and glare control is active
 		//                       Also corrected bugs (CR 7988) for switchable glazings not related to CR 7984
+		//                      Oct 2026: glare index skipped in zones that have no glare control and do not report it
+		//                      Oct 2026: hourly interpolation of the bare and fixed shade factors done for all
+		//                       the windows of the zone at once by DayltgInterpolateHours
 
 		//       RE-ENGINEERED  na
 
@@ -5983,6 +6124,18 @@ namespace DaylightingManager {
 		static Array3D< Real64 > tmpIllumFromWinAtRefPt;
 		static Array3D< Real64 > tmpBackLumFromWinAtRefPt;
 		static Array3D< Real64 > tmpSourceLumFromWinAtRefPt;
+		// Daylight factors interpolated between the current and previous hour sun positions, indexed by
+		// (bare/shaded, [sky type,] reference point, daylit window); the window index is contiguous
+		static Array4D< Real64 > IllFacSkyHr;
+		static Array4D< Real64 > BackFacSkyHr;
+		static Array4D< Real64 > SourceFacSkyHr;
+		static Array3D< Real64 > IllFacSunHr;
+		static Array3D< Real64 > IllFacSunDiskHr;
+		static Array3D< Real64 > BackFacSunHr;
+		static Array3D< Real64 > BackFacSunDiskHr;
+		static Array3D< Real64 > SourceFacSunHr;
+		static Array3D< Real64 > SourceFacSunDiskHr;
+		int NumFixedShadeIndexes; // 2 if a window of the zone has a shade, screen, blind with fixed slats or diffusing glass, else 1
 		static bool firstTime( true ); // true first time routine is called
 
 		static bool blnCycle( false );
@@ -5993,6 +6146,16 @@ namespace DaylightingManager {
 			tmpIllumFromWinAtRefPt.allocate( max( maxval( Zone.NumSubSurfaces() ), maxval( ZoneDaylight.NumOfDayltgExtWins() ) ), 2, 2 );
 			tmpBackLumFromWinAtRefPt.allocate( max( maxval( Zone.NumSubSurfaces() ), maxval( ZoneDaylight.NumOfDayltgExtWins() ) ), 2, 2 );
 			tmpSourceLumFromWinAtRefPt.allocate( max( maxval( Zone.NumSubSurfaces() ), maxval( ZoneDaylight.NumOfDayltgExtWins() ) ), 2, 2 );
+			int const MaxDayltgExtWins( maxval( ZoneDaylight.NumOfDayltgExtWins() ) );
+			IllFacSkyHr.allocate( 2, 4, 2, MaxDayltgExtWins );
+			BackFacSkyHr.allocate( 2, 4, 2, MaxDayltgExtWins );
+			SourceFacSkyHr.allocate( 2, 4, 2, MaxDayltgExtWins );
+			IllFacSunHr.allocate( 2, 2, MaxDayltgExtWins );
+			IllFacSunDiskHr.allocate( 2, 2, MaxDayltgExtWins );
+			BackFacSunHr.allocate( 2, 2, MaxDayltgExtWins );
+			BackFacSunDiskHr.allocate( 2, 2, MaxDayltgExtWins );
+			SourceFacSunHr.allocate( 2, 2, MaxDayltgExtWins );
+			SourceFacSunDiskHr.allocate( 2, 2, MaxDayltgExtWins );
 			firstTime = false;
 		}
 		tmpIllumFromWinAtRefPt = 0.0;
@@ -6025,6 +6188,34 @@ namespace DaylightingManager {
 			ISky2 = 4;
 		}
 
+		// Interpolate the bare window factors, and the factors of windows with a shade, screen, blind with fixed
+		// slats or diffusing glass, between the current and previous hour sun positions for all the daylit
+		// windows of the zone at once. Factors of blinds with movable slats are interpolated window by window below.
+		NumFixedShadeIndexes = 1;
+		for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
+			IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
+			if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) && ! SurfaceWindow( IWin ).MovableSlats ) NumFixedShadeIndexes = 2;
+		}
+		if ( ZoneDaylight( ZoneNum ).NumOfDayltgExtWins > 0 ) {
+			auto const & thisZoneDaylight( ZoneDaylight( ZoneNum ) );
+			int const NumWins( thisZoneDaylight.NumOfDayltgExtWins );
+			for ( IS = 1; IS <= NumFixedShadeIndexes; ++IS ) {
+				for ( IL = 1; IL <= NREFPT; ++IL ) {
+					for ( ISky = 1; ISky <= 4; ++ISky ) {
+						DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylIllFacSky( HourOfDay, IS, ISky, IL, 1 ), &thisZoneDaylight.DaylIllFacSky( PreviousHour, IS, ISky, IL, 1 ), WeightNow, WeightPreviousHour, &IllFacSkyHr( IS, ISky, IL, 1 ) );
+						DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylBackFacSky( HourOfDay, IS, ISky, IL, 1 ), &thisZoneDaylight.DaylBackFacSky( PreviousHour, IS, ISky, IL, 1 ), WeightNow, WeightPreviousHour, &BackFacSkyHr( IS, ISky, IL, 1 ) );
+						DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylSourceFacSky( HourOfDay, IS, ISky, IL, 1 ), &thisZoneDaylight.DaylSourceFacSky( PreviousHour, IS, ISky, IL, 1 ), WeightNow, WeightPreviousHour, &SourceFacSkyHr( IS, ISky, IL, 1 ) );
+					}
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylIllFacSun( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylIllFacSun( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &IllFacSunHr( IS, IL, 1 ) );
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylIllFacSunDisk( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylIllFacSunDisk( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &IllFacSunDiskHr( IS, IL, 1 ) );
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylBackFacSun( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylBackFacSun( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &BackFacSunHr( IS, IL, 1 ) );
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylBackFacSunDisk( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylBackFacSunDisk( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &BackFacSunDiskHr( IS, IL, 1 ) );
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylSourceFacSun( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylSourceFacSun( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &SourceFacSunHr( IS, IL, 1 ) );
+					DayltgInterpolateHours( NumWins, &thisZoneDaylight.DaylSourceFacSunDisk( HourOfDay, IS, IL, 1 ), &thisZoneDaylight.DaylSourceFacSunDisk( PreviousHour, IS, IL, 1 ), WeightNow, WeightPreviousHour, &SourceFacSunDiskHr( IS, IL, 1 ) );
+				}
+			}
+		}
+
 		// First loop over exterior windows associated with this zone. The window may be an exterior window in
 		// the zone or an exterior window in an adjacent zone that shares an interior window with the zone.
 		// Find contribution of each window to the daylight illum and to the glare numerator at each reference point.
@@ -6054,43 +6245,43 @@ namespace DaylightingManager {
 				for ( ISky = 1; ISky <= 4; ++ISky ) {
 
 					// ===Bare window===
-					DFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSky( PreviousHour, 1, ISky, IL, loop ) );
+					DFSKHR( 1, ISky ) = VTRatio * IllFacSkyHr( 1, ISky, IL, loop );
 
-					if ( ISky == 1 ) DFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == 1 ) DFSUHR( 1 ) = VTRatio * ( IllFacSunHr( 1, IL, loop ) + IllFacSunDiskHr( 1, IL, loop ) );
 
-					BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSky( PreviousHour, 1, ISky, IL, loop ) );
+					BFSKHR( 1, ISky ) = VTRatio * BackFacSkyHr( 1, ISky, IL, loop );
 
-					if ( ISky == 1 ) BFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == 1 ) BFSUHR( 1 ) = VTRatio * ( BackFacSunHr( 1, IL, loop ) + BackFacSunDiskHr( 1, IL, loop ) );
 
-					SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, 1, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSky( PreviousHour, 1, ISky, IL, loop ) );
+					SFSKHR( 1, ISky ) = VTRatio * SourceFacSkyHr( 1, ISky, IL, loop );
 
-					if ( ISky == 1 ) SFSUHR( 1 ) = VTRatio * ( WeightNow * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, 1, IL, loop ) ) + WeightPreviousHour * ( ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, 1, IL, loop ) + ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( PreviousHour, 1, IL, loop ) ) );
+					if ( ISky == 1 ) SFSUHR( 1 ) = VTRatio * ( SourceFacSunHr( 1, IL, loop ) + SourceFacSunDiskHr( 1, IL, loop ) );
 
 					if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
 
 						// ===Shaded window or window with diffusing glass===
 						if ( ! SurfaceWindow( IWin ).MovableSlats ) {
 							// Shade, screen, blind with fixed slats, or diffusing glass
-							DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSky( PreviousHour, 2, ISky, IL, loop ) );
+							DFSKHR( 2, ISky ) = VTRatio * IllFacSkyHr( 2, ISky, IL, loop );
 
 							if ( ISky == 1 ) {
-								DFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSun( PreviousHour, 2, IL, loop ) );
+								DFSUHR( 2 ) = VTRatio * IllFacSunHr( 2, IL, loop );
 
-								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) DFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylIllFacSunDisk( PreviousHour, 2, IL, loop ) );
+								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) DFSUHR( 2 ) += VTRatio * IllFacSunDiskHr( 2, IL, loop );
 							}
 
-							BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSky( PreviousHour, 2, ISky, IL, loop ) );
+							BFSKHR( 2, ISky ) = VTRatio * BackFacSkyHr( 2, ISky, IL, loop );
 
 							if ( ISky == 1 ) {
-								BFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSun( PreviousHour, 2, IL, loop ) );
-								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) BFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylBackFacSunDisk( PreviousHour, 2, IL, loop ) );
+								BFSUHR( 2 ) = VTRatio * BackFacSunHr( 2, IL, loop );
+								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) BFSUHR( 2 ) += VTRatio * BackFacSunDiskHr( 2, IL, loop );
 							}
 
-							SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSky( HourOfDay, 2, ISky, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSky( PreviousHour, 2, ISky, IL, loop ) );
+							SFSKHR( 2, ISky ) = VTRatio * SourceFacSkyHr( 2, ISky, IL, loop );
 
 							if ( ISky == 1 ) {
-								SFSUHR( 2 ) = VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSun( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSun( PreviousHour, 2, IL, loop ) );
-								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) SFSUHR( 2 ) += VTRatio * ( WeightNow * ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( HourOfDay, 2, IL, loop ) + WeightPreviousHour * ZoneDaylight( ZoneNum ).DaylSourceFacSunDisk( PreviousHour, 2, IL, loop ) );
+								SFSUHR( 2 ) = VTRatio * SourceFacSunHr( 2, IL, loop );
+								if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) SFSUHR( 2 ) += VTRatio * SourceFacSunDiskHr( 2, IL, loop );
 							}
 
 						} else { // Blind with movable slats
@@ -6313,8 +6504,13 @@ namespace DaylightingManager {
 		} // ISWFLG /= 0 .AND. DaylIllum(1) > SETPNT(1)
 
 		// Calculate glare index at each reference point assuming the daylight illuminance setpoint is
-		//  met at both reference points, either by daylight or electric lights
+		//  met at both reference points, either by daylight or electric lights.
+		//  Without glare control or glare reporting the glare index is not needed and left at zero.
 		for ( IL = 1; IL <= NREFPT; ++IL ) {
+			if ( ! ZoneDaylight( ZoneNum ).GlareCalcNeeded ) {
+				GLRNDX( IL ) = 0.0;
+				continue;
+			}
 			BACL = max( SetPnt( IL ) * ZoneDaylight( ZoneNum ).AveVisDiffReflect / Pi, ZoneDaylight( ZoneNum ).BacLum( IL ) );
 			// DayltgGlare uses ZoneDaylight(ZoneNum)%SourceLumFromWinAtRefPt(IL,1,loop) for unshaded windows, and
 			//  ZoneDaylight(ZoneNum)%SourceLumFromWinAtRefPt(IL,2,loop) for shaded windows
@@ -7139,7 +7335,6 @@ namespace DaylightingManager {
 		Real64 Beta;
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
 		static Array1D< Real64 > GroundHitPt( 3 ); // Coordinates of point that ray from window center hits the ground (m)
-		int ObsSurfNum; // Obstruction surface number
 		int IHitObs; // = 1 if obstruction is hit, = 0 otherwise
 		static Array1D< Real64 > ObsHitPt( 3 ); // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
@@ -7324,7 +7519,9 @@ namespace DaylightingManager {
 					if ( CalcSolRefl && ObTransM( IPH, ITH ) > 1.e-6 ) {
 						// Sun reaches ground point if vector from this point to the sun is unobstructed
 						IHitObs = 0;
-						for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+						static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+						SurfacesAlongRay( GroundHitPt, SUNCOS_IHR, RaySurfNums );
+						for ( int const ObsSurfNum : RaySurfNums ) {
 							if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 							DayltgPierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_IHR, IHitObs, ObsHitPt );
 							if ( IHitObs > 0 ) break;
@@ -8079,24 +8276,24 @@ namespace DaylightingManager {
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
-		Array2D< Real64 > FLSK; // Sky related luminous flux
-		Array1D< Real64 > FLSU; // Sun related luminous flux, excluding entering beam
-		Array1D< Real64 > FLSUdisk; // Sun related luminous flux, due to entering beam
+		static EP_THREAD_LOCAL Array2D< Real64 > FLSK; // Sky related luminous flux
+		static EP_THREAD_LOCAL Array1D< Real64 > FLSU; // Sun related luminous flux, excluding entering beam
+		static EP_THREAD_LOCAL Array1D< Real64 > FLSUdisk; // Sun related luminous flux, due to entering beam
 
-		Array2D< Real64 > FirstFluxSK; // Sky related first reflected flux
-		Array1D< Real64 > FirstFluxSU; // Sun related first reflected flux, excluding entering beam
-		Array1D< Real64 > FirstFluxSUdisk; // Sun related first reflected flux, due to entering beam
+		static EP_THREAD_LOCAL Array2D< Real64 > FirstFluxSK; // Sky related first reflected flux
+		static EP_THREAD_LOCAL Array1D< Real64 > FirstFluxSU; // Sun related first reflected flux, excluding entering beam
+		static EP_THREAD_LOCAL Array1D< Real64 > FirstFluxSUdisk; // Sun related first reflected flux, due to entering beam
 
-		Array2D< Real64 > ElementLuminanceSky; // sky related luminance at window element (exterior side)
-		Array1D< Real64 > ElementLuminanceSun; // sun related luminance at window element (exterior side), exluding beam
-		Array1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side), due to sun beam
+		static EP_THREAD_LOCAL Array2D< Real64 > ElementLuminanceSky; // sky related luminance at window element (exterior side)
+		static EP_THREAD_LOCAL Array1D< Real64 > ElementLuminanceSun; // sun related luminance at window element (exterior side), exluding beam
+		static EP_THREAD_LOCAL Array1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side), due to sun beam
 		// Total transmitted flux
-		static Array1D< Real64 > FLSKTot( 4 );
+		static EP_THREAD_LOCAL Array1D< Real64 > FLSKTot( 4 );
 		Real64 FLSUTot;
 		Real64 FLSUdiskTot;
 
 		// Total for first relflected fluxes
-		static Array1D< Real64 > FFSKTot( 4 );
+		static EP_THREAD_LOCAL Array1D< Real64 > FFSKTot( 4 );
 		Real64 FFSUTot;
 		Real64 FFSUdiskTot;
 
@@ -8122,21 +8319,19 @@ namespace DaylightingManager {
 		iConst = SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).Konst;
 		NTrnBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Trn.NBasis;
 
-		if ( ! allocated( FLSK ) ) FLSK.allocate( 4, NTrnBasis );
-		FLSK = 0.0;
-		if ( ! allocated( FLSU ) ) FLSU.dimension( NTrnBasis, 0.0 );
-		if ( ! allocated( FLSUdisk ) ) FLSUdisk.dimension( NTrnBasis, 0.0 );
+		// The scratch arrays are only reallocated when the number of basis directions changes
+		FLSK.dimension( 4, NTrnBasis, 0.0 );
+		FLSU.dimension( NTrnBasis, 0.0 );
+		FLSUdisk.dimension( NTrnBasis, 0.0 );
 
-		if ( ! allocated( FirstFluxSK ) ) FirstFluxSK.allocate( 4, NTrnBasis );
-		FirstFluxSK = 0.0;
-		if ( ! allocated( FirstFluxSU ) ) FirstFluxSU.dimension( NTrnBasis, 0.0 );
-		if ( ! allocated( FirstFluxSUdisk ) ) FirstFluxSUdisk.dimension( NTrnBasis, 0.0 );
+		FirstFluxSK.dimension( 4, NTrnBasis, 0.0 );
+		FirstFluxSU.dimension( NTrnBasis, 0.0 );
+		FirstFluxSUdisk.dimension( NTrnBasis, 0.0 );
 
 		NIncBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.NBasis;
-		if ( ! allocated( ElementLuminanceSky ) ) ElementLuminanceSky.allocate( 4, NIncBasis );
-		ElementLuminanceSky = 0.0;
-		if ( ! allocated( ElementLuminanceSun ) ) ElementLuminanceSun.dimension( NIncBasis, 0.0 );
-		if ( ! allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.dimension( NIncBasis, 0.0 );
+		ElementLuminanceSky.dimension( 4, NIncBasis, 0.0 );
+		ElementLuminanceSun.dimension( NIncBasis, 0.0 );
+		ElementLuminanceSunDisk.dimension( NIncBasis, 0.0 );
 
 		// Integration over sky/ground/sun elements is done over window incoming basis element and flux is calculated for each
 		// outgoing direction. This is used to calculate first reflected flux
@@ -8193,18 +8388,6 @@ namespace DaylightingManager {
 		EINTSU( IHR, 1 ) = FFSUTot * ( Surface( IWin ).Area / SurfaceWindow( IWin ).GlazedFrac ) / ( ZoneInsideSurfArea * ( 1.0 - ZoneDaylight( ZoneNum ).AveVisDiffReflect ) );
 		EINTSUdisk( IHR, 1 ) = FFSUdiskTot * ( Surface( IWin ).Area / SurfaceWindow( IWin ).GlazedFrac ) / ( ZoneInsideSurfArea * ( 1.0 - ZoneDaylight( ZoneNum ).AveVisDiffReflect ) );
 
-		if ( allocated( FLSK ) ) FLSK.deallocate();
-		if ( allocated( FLSU ) ) FLSU.deallocate();
-		if ( allocated( FLSUdisk ) ) FLSUdisk.deallocate();
-
-		if ( allocated( FirstFluxSK ) ) FirstFluxSK.deallocate();
-		if ( allocated( FirstFluxSU ) ) FirstFluxSU.deallocate();
-		if ( allocated( FirstFluxSUdisk ) ) FirstFluxSUdisk.deallocate();
-
-		if ( allocated( ElementLuminanceSky ) ) ElementLuminanceSky.deallocate();
-		if ( allocated( ElementLuminanceSun ) ) ElementLuminanceSun.deallocate();
-		if ( allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.deallocate();
-
 	}
 
 	void
@@ -8240,17 +8423,17 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// Luminances from different sources to the window
-		Array2D< Real64 > ElementLuminanceSky; // sky related luminance at window element (exterior side)
-		Array1D< Real64 > ElementLuminanceSun; // sun related luminance at window element (exterior side),
+		static EP_THREAD_LOCAL Array2D< Real64 > ElementLuminanceSky; // sky related luminance at window element (exterior side)
+		static EP_THREAD_LOCAL Array1D< Real64 > ElementLuminanceSun; // sun related luminance at window element (exterior side),
 		// exluding beam
-		Array1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side),
+		static EP_THREAD_LOCAL Array1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side),
 		// due to sun beam
 
-		static Array1D< Real64 > WinLumSK( 4 ); // Sky related window luminance
+		static EP_THREAD_LOCAL Array1D< Real64 > WinLumSK( 4 ); // Sky related window luminance
 		Real64 WinLumSU; // Sun related window luminance, excluding entering beam
 		//REAL(r64) :: WinLumSUdisk  ! Sun related window luminance, due to entering beam
 
-		static Array1D< Real64 > EDirSky( 4 ); // Sky related direct illuminance
+		static EP_THREAD_LOCAL Array1D< Real64 > EDirSky( 4 ); // Sky related direct illuminance
 		Real64 EDirSun; // Sun related direct illuminance, excluding entering beam
 		Real64 EDirSunDisk; // Sun related direct illuminance, due to entering beam
 
@@ -8272,10 +8455,9 @@ namespace DaylightingManager {
 		iConst = SurfaceWindow( IWin ).ComplexFen.State( CurCplxFenState ).Konst;
 		NIncBasis = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.NBasis;
 
-		if ( ! allocated( ElementLuminanceSky ) ) ElementLuminanceSky.allocate( 4, NIncBasis );
-		ElementLuminanceSky = 0.0;
-		if ( ! allocated( ElementLuminanceSun ) ) ElementLuminanceSun.dimension( NIncBasis, 0.0 );
-		if ( ! allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.dimension( NIncBasis, 0.0 );
+		ElementLuminanceSky.dimension( 4, NIncBasis, 0.0 );
+		ElementLuminanceSun.dimension( NIncBasis, 0.0 );
+		ElementLuminanceSunDisk.dimension( NIncBasis, 0.0 );
 
 		ComplexFenestrationLuminances( IWin, WinEl, NIncBasis, IHR, iRefPoint, ElementLuminanceSky, ElementLuminanceSun, ElementLuminanceSunDisk, CalledFrom, MapNum );
 
@@ -8331,10 +8513,6 @@ namespace DaylightingManager {
 		EDIRSU( IHR, 1 ) += EDirSun;
 		//AVWLSUdisk(1,IHR) = AVWLSUdisk(1,IHR) + WinLumSUdisk
 
-		if ( allocated( ElementLuminanceSky ) ) ElementLuminanceSky.deallocate();
-		if ( allocated( ElementLuminanceSun ) ) ElementLuminanceSun.deallocate();
-		if ( allocated( ElementLuminanceSunDisk ) ) ElementLuminanceSunDisk.deallocate();
-
 	}
 
 	void
@@ -8705,7 +8883,6 @@ namespace DaylightingManager {
 		// na
 		static Array1D< Real64 > HitPt( 3 ); // Hit point on an obstruction (m)
 		int IHit; // > 0 if obstruction is hit, 0 otherwise
-		int ObsSurfNum; // Obstruction surface number
 
 		int TotObstructionsHit; // Number of obstructions hit by a ray
 		int ObsSurfNumToSkip; // Surface number of obstruction to be ignored
@@ -8718,7 +8895,9 @@ namespace DaylightingManager {
 		Real64 HitDistance_sq; // Distance squared from receiving point to hit point for a ray (m^2)
 		NearestHitPt = 0.0;
 		ObsSurfNumToSkip = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+		SurfacesAlongRay( RecPt, RayVec, RaySurfNums );
+		for ( int const ObsSurfNum : RaySurfNums ) {
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
 			// to remove that surface from consideration as a hit surface for this ray
@@ -8792,7 +8971,6 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static Array1D< Real64 > ReflNorm( 3 ); // Unit normal to reflecting surface (m)
-		int ObsSurfNum; // Obstruction surface number
 		int IHitObs; // > 0 if obstruction is hit
 		static Array1D< Real64 > ObsHitPt( 3 ); // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
@@ -8819,7 +8997,9 @@ namespace DaylightingManager {
 		if ( CosIncAngAtHitPt <= 0.0 ) return; // Sun is in back of reflecting surface
 		// Sun reaches ReflHitPt if vector from ReflHitPt to sun is unobstructed
 		IHitObs = 0;
-		for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+		static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+		SurfacesAlongRay( ReflHitPt, SUNCOS_IHR, RaySurfNums );
+		for ( int const ObsSurfNum : RaySurfNums ) {
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// Exclude as a possible obstructor ReflSurfNum and its base surface (if it has one)
 			if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
@@ -8866,6 +9046,8 @@ namespace DaylightingManager {
 		//                        daylight illum at ref pt was calculated as though it was off
 		//                      June 2009, TH: modified for thermochromic windows
 		//                      March 2010, TH: fix bug (CR 8057) for electrochromic windows
+		//                      Oct 2026: drop the unreported map glare calculation, hoist the sky
+		//                      illuminance out of the window and point loops
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -8907,12 +9089,6 @@ namespace DaylightingManager {
 		static Array2D< Real64 > DFSKHR( 2, 4 ); // Sky daylight factor for sky type (first index),
 		//   bare/shaded window (second index)
 		static Array1D< Real64 > DFSUHR( 2 ); // Sun daylight factor for bare/shaded window
-		static Array2D< Real64 > BFSKHR( 2, 4 ); // Sky background luminance factor for sky type (first index),
-		//   bare/shaded window (second index)
-		static Array1D< Real64 > BFSUHR( 2 ); // Sun background luminance factor for bare/shaded window
-		static Array2D< Real64 > SFSKHR( 2, 4 ); // Sky source luminance factor for sky type (first index),
-		//   bare/shaded window (second index)
-		static Array1D< Real64 > SFSUHR( 2 ); // Sun source luminance factor for bare/shaded window
 		int IL; // Reference point index
 		int IWin; // Window index
 		int IS; // IS=1 for unshaded window, =2 for shaded window
@@ -8927,11 +9103,6 @@ namespace DaylightingManager {
 		Real64 SlatAng; // Blind slat angle (rad)
 		bool VarSlats; // True if slats are movable, i.e., variable angle
 		int loop; // Window loop index
-		Real64 GTOT;
-		Real64 GTOT1;
-		Real64 GTOT2;
-		static Array1D< Real64 > BACLUM;
-		static Array1D< Real64 > GLRNDX;
 		static bool FirstTimeFlag( true );
 		int ILB;
 
@@ -8948,8 +9119,6 @@ namespace DaylightingManager {
 
 		if ( FirstTimeFlag ) {
 			DaylIllum.allocate( MaxMapRefPoints );
-			BACLUM.allocate( MaxMapRefPoints );
-			GLRNDX.allocate( MaxMapRefPoints );
 			FirstTimeFlag = false;
 		}
 
@@ -8964,8 +9133,6 @@ namespace DaylightingManager {
 			NREFPT = IllumMapCalc( MapNum ).TotalMapRefPoints;
 
 			DaylIllum = 0.0;
-			BACLUM = 0.0;
-			GLRNDX = 0.0;
 
 			if ( SkyClearness > 3.0 ) { //Sky is average of clear and clear turbid
 				SkyWeight = min( 1.0, ( SkyClearness - 3.0 ) / 3.0 );
@@ -8981,9 +9148,20 @@ namespace DaylightingManager {
 				ISky2 = 4;
 			}
 
+			// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
+			// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
+			for ( ISky = 1; ISky <= 4; ++ISky ) {
+				HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
+			}
+
+			// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
+			// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
+			// also calculated in DayltgLuminousEfficacy.
+			HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+
 			//              First loop over windows in this space.
 			//              Find contribution of each window to the daylight illum
-			//              and to the glare numerator at each reference point.
+			//              at each reference point.
 			//              Use shading flags set in WindowShadingManager.
 
 			for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
@@ -9016,18 +9194,6 @@ namespace DaylightingManager {
 							DFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
-						BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 1, ISky, ILB, loop ) );
-
-						if ( ISky == 1 ) {
-							BFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
-						}
-
-						SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 1, ISky, ILB, loop ) );
-
-						if ( ISky == 1 ) {
-							SFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
-						}
-
 						if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
 
 							//                                 ===Shaded window===
@@ -9043,24 +9209,6 @@ namespace DaylightingManager {
 									}
 								}
 
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 2, ISky, ILB, loop ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 2, ILB, loop ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 2, ILB, loop ) );
-									}
-								}
-
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 2, ISky, ILB, loop ) );
-
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 2, ILB, loop ) );
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 2, ILB, loop ) );
-									}
-								}
-
 							} else { // Blind with movable slats
 								VarSlats = SurfaceWindow( IWin ).MovableSlats;
 								SlatAng = SurfaceWindow( IWin ).SlatAngThisTS;
@@ -9080,28 +9228,6 @@ namespace DaylightingManager {
 									}
 								}
 
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
-
-								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-
-									// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-									}
-								}
-
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
-
-								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-
-									// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
-									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
-									}
-								}
-
 							} // End of check if window has blind with movable slats
 
 						} // End of check if window is shaded or has diffusing glass
@@ -9110,35 +9236,17 @@ namespace DaylightingManager {
 
 					//              Get illuminance at ref point from bare and shaded window by
 					//              multiplying daylight factors by exterior horizontal illuminance
-
-					// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
-					// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
-					}
-
-					// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
-					// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
-					// also calculated in DayltgLuminousEfficacy.
-					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
-
 					for ( IS = 1; IS <= 2; ++IS ) {
 						if ( IS == 2 && SurfaceWindow( IWin ).ShadingFlag <= 0 && ! SurfaceWindow( IWin ).SolarDiffusing ) break;
 
 						IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, IS, ILB ) = DFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + DFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, IS, ILB ) = BFSUHR( IS ) * HISUNF + HorIllSkyFac * ( BFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + BFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = SFSUHR( IS ) * HISUNF + HorIllSkyFac * ( SFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + SFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = max( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ), 0.0 );
 					}
 
 				} // End of reference point loop
 			} // End of first loop over windows
 
 			//              Second loop over windows. Find total daylight illuminance
-			//              and background luminance for each ref pt from all windows in
-			//              the space.  Use shading flags.
+			//              for each ref pt from all windows in the space.  Use shading flags.
 
 			for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
 				IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
@@ -9164,54 +9272,16 @@ namespace DaylightingManager {
 				for ( IL = 1; IL <= NREFPT; ++IL ) {
 					//              Determine if illuminance contribution is from bare or shaded window
 					DaylIllum( IL ) += VTMULT * IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, IS, IL );
-					BACLUM( IL ) += VTMULT * IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, IS, IL );
 				}
 
 			} // End of second window loop
 
-			//              Calculate glare index at each reference point
-			for ( IL = 1; IL <= NREFPT; ++IL ) {
-				//        Following code taken directly from DayltgGlare ... duplicate calculation
-				// Initialize glare constant
-				GTOT = 0.0;
-
-				// Loop over exterior windows associated with zone
-				for ( loop = 1; loop <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loop ) {
-					IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loop );
-					IS = 1;
-					if ( ( SurfaceWindow( IWin ).ShadingFlag >= 1 && SurfaceWindow( IWin ).ShadingFlag <= 9 ) || SurfaceWindow( IWin ).SolarDiffusing ) IS = 2;
-
-					// CR 8057. 3/17/2010
-					VTMULT = 1.0;
-
-					ICtrl = Surface( IWin ).WindowShadingControlPtr;
-					if ( ICtrl > 0 ) {
-						if ( WindowShadingControl( ICtrl ).ShadingControlType == WSCT_MeetDaylIlumSetp && SurfaceWindow( IWin ).ShadingFlag == SwitchableGlazing ) {
-							// switchable windows in partial or fully switched state,
-							//  get its intermediate VT calculated in DayltgInteriorIllum
-							IConstShaded = Surface( IWin ).ShadedConstruction;
-							if ( IConstShaded > 0 ) VTDark = POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef( 1 ) ) * SurfaceWindow( IWin ).GlazedFrac;
-							if ( VTDark > 0 ) VTMULT = SurfaceWindow( IWin ).VisTransSelected / VTDark;
-						}
-					}
-
-					// Conversion from ft-L to cd/m2, with cd/m2 = 0.2936 ft-L, gives the 0.4794 factor
-					// below, which is (0.2936)**0.6
-					GTOT1 = 0.4794 * ( std::pow( VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, IL ), 1.6 ) ) * std::pow( IllumMapCalc( MapNum ).SolidAngAtMapPtWtd( loop, IL ), 0.8 );
-					GTOT2 = BACLUM( IL ) + 0.07 * ( std::sqrt( IllumMapCalc( MapNum ).SolidAngAtMapPt( loop, IL ) ) ) * VTMULT * IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, IL );
-					GTOT += GTOT1 / ( GTOT2 + 0.000001 );
-				}
-
-				// Glare index (adding 0.000001 prevents LOG10 (0))
-				GLRNDX( IL ) = 10.0 * std::log10( GTOT + 0.000001 );
-				// Set glare index to zero for GTOT < 1
-				GLRNDX( IL ) = max( 0.0, GLRNDX( IL ) );
-			}
+			// Only the illuminance is written to the map output, so the background and source luminance
+			// and the glare index are not evaluated at map points; GlareIndexAtMapPt stays zero.
 
 			//              Variables for reporting
 			for ( IL = 1; IL <= NREFPT; ++IL ) {
 				IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL ) = max( DaylIllum( IL ), 0.0 );
-				IllumMapCalc( MapNum ).GlareIndexAtMapPt( IL ) = GLRNDX( IL );
 			}
 		}
 
@@ -9823,6 +9893,8 @@ Label903: ;
 				ZoneDaylight( ZoneNum ).SolidAngAtRefPt = 0.0;
 				ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtd.allocate( ZoneExtWin( ZoneNum ), ZoneDaylight( ZoneNum ).TotalDaylRefPoints );
 				ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtd = 0.0;
+				ZoneDaylight( ZoneNum ).SolidAngAtRefPtWtdPow.dimension( ZoneExtWin( ZoneNum ), ZoneDaylight( ZoneNum ).TotalDaylRefPoints, 0.0 );
+				ZoneDaylight( ZoneNum ).SolidAngAtRefPtSqrt.dimension( ZoneExtWin( ZoneNum ), ZoneDaylight( ZoneNum ).TotalDaylRefPoints, 0.0 );
 				ZoneDaylight( ZoneNum ).IllumFromWinAtRefPt.allocate( ZoneExtWin( ZoneNum ), 2, ZoneDaylight( ZoneNum ).TotalDaylRefPoints );
 				ZoneDaylight( ZoneNum ).IllumFromWinAtRefPt = 0.0;
 				ZoneDaylight( ZoneNum ).BackLumFromWinAtRefPt.allocate( ZoneExtWin( ZoneNum ), 2, ZoneDaylight( ZoneNum ).TotalDaylRefPoints );
@@ -11,6 +11,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataBSDFWindow.hh>
+#include <DataDaylighting.hh>
 
 namespace EnergyPlus {
 
@@ -350,6 +351,9 @@ namespace DaylightingManager {
 		int & ZoneNum // Zone number
 	);
 
+	bool
+	GlareIndexReported();
+
 	void
 	DayltgGlareWithIntWins(
 		Array1A< Real64 > GLINDX, // Glare index
@@ -404,6 +408,16 @@ namespace DaylightingManager {
 		int & IHit // Hit flag: 1 = ray hits an obstruction, 0 = does not
 	);
 
+	void
+	DayltgInterpolateHours(
+		int const NumWins, // Number of daylit windows
+		DataDaylighting::DaylFactorReal const * const FacNow, // Window factors for the current hour sun position
+		DataDaylighting::DaylFactorReal const * const FacPrev, // Window factors for the previous hour sun position
+		Real64 const WeightNow, // Weight of the current hour
+		Real64 const WeightPrev, // Weight of the previous hour
+		Real64 * const Fac // Interpolated window factors
+	);
+
 	void
 	DayltgInteriorIllum( int & ZoneNum ); // Zone number
 
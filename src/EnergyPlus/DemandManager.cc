@@ -82,6 +82,7 @@ namespace DemandManager {
 	int DemandManagerHBIterations( 0 );
 	int DemandManagerHVACIterations( 0 );
 	bool GetInput( true ); // Flag to prevent input from being read multiple times
+	bool DemandManagersSurveyed( false ); // Demand managers have been surveyed in this pass through the lists
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -100,7 +101,7 @@ namespace DemandManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, survey the demand managers only when a list is over its limit
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -180,7 +181,8 @@ namespace DemandManager {
 					ResimHB = false;
 					ResimHVAC = false;
 
-					SurveyDemandManagers(); // Determines which Demand Managers can reduce demand
+					// The first list found over its limit determines which Demand Managers can reduce demand
+					DemandManagersSurveyed = false;
 
 					for ( ListNum = 1; ListNum <= NumDemandManagerList; ++ListNum ) {
 						SimulateDemandManagerList( ListNum, ResimExt, ResimHB, ResimHVAC );
@@ -217,7 +219,7 @@ namespace DemandManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, survey the demand managers here, once per pass
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -264,6 +266,12 @@ namespace DemandManager {
 
 			if ( OverLimit > 0.0 ) {
 
+				// The loads do not change between the lists, so the survey is shared by all of them
+				if ( ! DemandManagersSurveyed ) {
+					SurveyDemandManagers();
+					DemandManagersSurveyed = true;
+				}
+
 				{ auto const SELECT_CASE_var( DemandManagerList( ListNum ).ManagerPriority );
 
 				if ( SELECT_CASE_var == ManagerPrioritySequential ) { // Activate first Demand Manager that can reduce demand
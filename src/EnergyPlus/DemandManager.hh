@@ -48,6 +48,7 @@ namespace DemandManager {
 	extern int DemandManagerHBIterations;
 	extern int DemandManagerHVACIterations;
 	extern bool GetInput; // Flag to prevent input from being read multiple times
+	extern bool DemandManagersSurveyed; // Demand managers have been surveyed in this pass through the lists
 
 	// SUBROUTINE SPECIFICATIONS:
 
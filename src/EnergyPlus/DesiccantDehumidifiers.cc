@@ -1715,7 +1715,7 @@ namespace DesiccantDehumidifiers {
 		//       AUTHOR         Michael J. Witte, GARD Analytics, Inc.
 		//                      for Gas Research Institute
 		//       DATE WRITTEN   March 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse performance model results while the process inlet state is unchanged
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1867,40 +1867,53 @@ namespace DesiccantDehumidifiers {
 
 			UnitOn = true;
 
-			{ auto const SELECT_CASE_var( DesicDehum( DesicDehumNum ).PerformanceModel_Num ); // Performance Model Part A
+			// The performance model depends only on the process inlet state (the process air velocity is the nominal one)
+			if ( ! DesicDehum( DesicDehumNum ).PerfCurveInletValid || ProcAirInTemp != DesicDehum( DesicDehumNum ).PerfCurveInletTemp || ProcAirInHumRat != DesicDehum( DesicDehumNum ).PerfCurveInletHumRat ) {
 
-			if ( SELECT_CASE_var == PM_Default ) {
+				{ auto const SELECT_CASE_var( DesicDehum( DesicDehumNum ).PerformanceModel_Num ); // Performance Model Part A
 
-				WC0 = 0.0148880824323806;
-				WC1 = -0.000283393198398211;
-				WC2 = -0.87802168940547;
-				WC3 = -0.000713615831236411;
-				WC4 = 0.0311261188874622;
-				WC5 = 1.51738892142485e-06;
-				WC6 = 0.0287250198281021;
-				WC7 = 4.94796903231558e-06;
-				WC8 = 24.0771139652826;
-				WC9 = 0.000122270283927978;
-				WC10 = -0.0151657189566474;
-				WC11 = 3.91641393230322e-08;
-				WC12 = 0.126032651553348;
-				WC13 = 0.000391653854431574;
-				WC14 = 0.002160537360507;
-				WC15 = 0.00132732844211593;
+				if ( SELECT_CASE_var == PM_Default ) {
 
-				MinProcAirOutHumRat = WC0 + WC1 * ProcAirInTemp + WC2 * ProcAirInHumRat + WC3 * ProcAirVel + WC4 * ProcAirInTemp * ProcAirInHumRat + WC5 * ProcAirInTemp * ProcAirVel + WC6 * ProcAirInHumRat * ProcAirVel + WC7 * ProcAirInTemp * ProcAirInTemp + WC8 * ProcAirInHumRat * ProcAirInHumRat + WC9 * ProcAirVel * ProcAirVel + WC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + WC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + WC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + WC13 * std::log( ProcAirInTemp ) + WC14 * std::log( ProcAirInHumRat ) + WC15 * std::log( ProcAirVel );
+					WC0 = 0.0148880824323806;
+					WC1 = -0.000283393198398211;
+					WC2 = -0.87802168940547;
+					WC3 = -0.000713615831236411;
+					WC4 = 0.0311261188874622;
+					WC5 = 1.51738892142485e-06;
+					WC6 = 0.0287250198281021;
+					WC7 = 4.94796903231558e-06;
+					WC8 = 24.0771139652826;
+					WC9 = 0.000122270283927978;
+					WC10 = -0.0151657189566474;
+					WC11 = 3.91641393230322e-08;
+					WC12 = 0.126032651553348;
+					WC13 = 0.000391653854431574;
+					WC14 = 0.002160537360507;
+					WC15 = 0.00132732844211593;
 
-				// limit to 6 grains/lb (0.000857 kg/kg)
+					MinProcAirOutHumRat = WC0 + WC1 * ProcAirInTemp + WC2 * ProcAirInHumRat + WC3 * ProcAirVel + WC4 * ProcAirInTemp * ProcAirInHumRat + WC5 * ProcAirInTemp * ProcAirVel + WC6 * ProcAirInHumRat * ProcAirVel + WC7 * ProcAirInTemp * ProcAirInTemp + WC8 * ProcAirInHumRat * ProcAirInHumRat + WC9 * ProcAirVel * ProcAirVel + WC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + WC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + WC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + WC13 * std::log( ProcAirInTemp ) + WC14 * std::log( ProcAirInHumRat ) + WC15 * std::log( ProcAirVel );
 
-			} else if ( SELECT_CASE_var == PM_UserCurves ) {
+					// limit to 6 grains/lb (0.000857 kg/kg)
 
-				MinProcAirOutHumRat = CurveValue( DesicDehum( DesicDehumNum ).ProcHumRatCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).ProcHumRatCurvefV, ProcAirVel );
+				} else if ( SELECT_CASE_var == PM_UserCurves ) {
 
-			} else {
+					MinProcAirOutHumRat = CurveValue( DesicDehum( DesicDehumNum ).ProcHumRatCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).ProcHumRatCurvefV, ProcAirVel );
+
+				} else {
+
+					ShowFatalError( "Invalid performance model in desiccant dehumidifier = " + TrimSigDigits( DesicDehum( DesicDehumNum ).PerformanceModel_Num ) );
+
+				}} // Performance Model Part A
 
-				ShowFatalError( "Invalid performance model in desiccant dehumidifier = " + TrimSigDigits( DesicDehum( DesicDehumNum ).PerformanceModel_Num ) );
+				DesicDehum( DesicDehumNum ).PerfCurveInletValid = true;
+				DesicDehum( DesicDehumNum ).PerfCurveRegenValid = false;
+				DesicDehum( DesicDehumNum ).PerfCurveInletTemp = ProcAirInTemp;
+				DesicDehum( DesicDehumNum ).PerfCurveInletHumRat = ProcAirInHumRat;
+				DesicDehum( DesicDehumNum ).PerfCurveMinProcOutHumRat = MinProcAirOutHumRat;
 
-			}} // Performance Model Part A
+			} else {
+				MinProcAirOutHumRat = DesicDehum( DesicDehumNum ).PerfCurveMinProcOutHumRat;
+			}
 
 			MinProcAirOutHumRat = max( MinProcAirOutHumRat, 0.000857 );
 
@@ -1916,88 +1929,101 @@ namespace DesiccantDehumidifiers {
 			PartLoad = max( 0.0, PartLoad );
 			PartLoad = min( 1.0, PartLoad );
 
-			{ auto const SELECT_CASE_var( DesicDehum( DesicDehumNum ).PerformanceModel_Num ); // Performance Model Part B
-
-			if ( SELECT_CASE_var == PM_Default ) {
-
-				// Calculate leaving conditions
-				TC0 = -38.7782841989449;
-				TC1 = 2.0127655837628;
-				TC2 = 5212.49360216097;
-				TC3 = 15.2362536782665;
-				TC4 = -80.4910419759181;
-				TC5 = -0.105014122001509;
-				TC6 = -229.668673645144;
-				TC7 = -0.015424703743461;
-				TC8 = -69440.0689831847;
-				TC9 = -1.6686064694322;
-				TC10 = 38.5855718977592;
-				TC11 = 0.000196395381206009;
-				TC12 = 386.179386548324;
-				TC13 = -0.801959614172614;
-				TC14 = -3.33080986818745;
-				TC15 = -15.2034386065714;
-
-				ProcAirOutTemp = TC0 + TC1 * ProcAirInTemp + TC2 * ProcAirInHumRat + TC3 * ProcAirVel + TC4 * ProcAirInTemp * ProcAirInHumRat + TC5 * ProcAirInTemp * ProcAirVel + TC6 * ProcAirInHumRat * ProcAirVel + TC7 * ProcAirInTemp * ProcAirInTemp + TC8 * ProcAirInHumRat * ProcAirInHumRat + TC9 * ProcAirVel * ProcAirVel + TC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + TC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + TC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + TC13 * std::log( ProcAirInTemp ) + TC14 * std::log( ProcAirInHumRat ) + TC15 * std::log( ProcAirVel );
-
-				// Regen energy
-				QC0 = -27794046.6291107;
-				QC1 = -235725.171759615;
-				QC2 = 975461343.331328;
-				QC3 = -686069.373946731;
-				QC4 = -17717307.3766266;
-				QC5 = 31482.2539662489;
-				QC6 = 55296552.8260743;
-				QC7 = 6195.36070023868;
-				QC8 = -8304781359.40435;
-				QC9 = -188987.543809419;
-				QC10 = 3933449.40965846;
-				QC11 = -6.66122876558634;
-				QC12 = -349102295.417547;
-				QC13 = 83672.179730172;
-				QC14 = -6059524.33170538;
-				QC15 = 1220523.39525162;
-
-				SpecRegenEnergy = QC0 + QC1 * ProcAirInTemp + QC2 * ProcAirInHumRat + QC3 * ProcAirVel + QC4 * ProcAirInTemp * ProcAirInHumRat + QC5 * ProcAirInTemp * ProcAirVel + QC6 * ProcAirInHumRat * ProcAirVel + QC7 * ProcAirInTemp * ProcAirInTemp + QC8 * ProcAirInHumRat * ProcAirInHumRat + QC9 * ProcAirVel * ProcAirVel + QC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + QC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + QC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + QC13 * std::log( ProcAirInTemp ) + QC14 * std::log( ProcAirInHumRat ) + QC15 * std::log( ProcAirVel );
-
-				// Regen face velocity
-				RC0 = -4.67358908091488;
-				RC1 = 0.0654323095468338;
-				RC2 = 396.950518702316;
-				RC3 = 1.52610165426736;
-				RC4 = -11.3955868430328;
-				RC5 = 0.00520693906104437;
-				RC6 = 57.783645385621;
-				RC7 = -0.000464800668311693;
-				RC8 = -5958.78613212602;
-				RC9 = -0.205375818291012;
-				RC10 = 5.26762675442845;
-				RC11 = -8.88452553055039e-05;
-				RC12 = -182.382479369311;
-				RC13 = -0.100289774002047;
-				RC14 = -0.486980507964251;
-				RC15 = -0.972715425435447;
-
-				RegenAirVel = RC0 + RC1 * ProcAirInTemp + RC2 * ProcAirInHumRat + RC3 * ProcAirVel + RC4 * ProcAirInTemp * ProcAirInHumRat + RC5 * ProcAirInTemp * ProcAirVel + RC6 * ProcAirInHumRat * ProcAirVel + RC7 * ProcAirInTemp * ProcAirInTemp + RC8 * ProcAirInHumRat * ProcAirInHumRat + RC9 * ProcAirVel * ProcAirVel + RC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + RC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + RC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + RC13 * std::log( ProcAirInTemp ) + RC14 * std::log( ProcAirInHumRat ) + RC15 * std::log( ProcAirVel );
-
-			} else if ( SELECT_CASE_var == PM_UserCurves ) {
-
-				ProcAirOutTemp = CurveValue( DesicDehum( DesicDehumNum ).ProcDryBulbCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).ProcDryBulbCurvefV, ProcAirVel );
-
-				SpecRegenEnergy = CurveValue( DesicDehum( DesicDehumNum ).RegenEnergyCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).RegenEnergyCurvefV, ProcAirVel );
-
-				RegenAirVel = CurveValue( DesicDehum( DesicDehumNum ).RegenVelCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).RegenVelCurvefV, ProcAirVel );
+			if ( ! DesicDehum( DesicDehumNum ).PerfCurveRegenValid ) {
+
+				{ auto const SELECT_CASE_var( DesicDehum( DesicDehumNum ).PerformanceModel_Num ); // Performance Model Part B
+
+				if ( SELECT_CASE_var == PM_Default ) {
+
+					// Calculate leaving conditions
+					TC0 = -38.7782841989449;
+					TC1 = 2.0127655837628;
+					TC2 = 5212.49360216097;
+					TC3 = 15.2362536782665;
+					TC4 = -80.4910419759181;
+					TC5 = -0.105014122001509;
+					TC6 = -229.668673645144;
+					TC7 = -0.015424703743461;
+					TC8 = -69440.0689831847;
+					TC9 = -1.6686064694322;
+					TC10 = 38.5855718977592;
+					TC11 = 0.000196395381206009;
+					TC12 = 386.179386548324;
+					TC13 = -0.801959614172614;
+					TC14 = -3.33080986818745;
+					TC15 = -15.2034386065714;
+
+					ProcAirOutTemp = TC0 + TC1 * ProcAirInTemp + TC2 * ProcAirInHumRat + TC3 * ProcAirVel + TC4 * ProcAirInTemp * ProcAirInHumRat + TC5 * ProcAirInTemp * ProcAirVel + TC6 * ProcAirInHumRat * ProcAirVel + TC7 * ProcAirInTemp * ProcAirInTemp + TC8 * ProcAirInHumRat * ProcAirInHumRat + TC9 * ProcAirVel * ProcAirVel + TC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + TC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + TC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + TC13 * std::log( ProcAirInTemp ) + TC14 * std::log( ProcAirInHumRat ) + TC15 * std::log( ProcAirVel );
+
+					// Regen energy
+					QC0 = -27794046.6291107;
+					QC1 = -235725.171759615;
+					QC2 = 975461343.331328;
+					QC3 = -686069.373946731;
+					QC4 = -17717307.3766266;
+					QC5 = 31482.2539662489;
+					QC6 = 55296552.8260743;
+					QC7 = 6195.36070023868;
+					QC8 = -8304781359.40435;
+					QC9 = -188987.543809419;
+					QC10 = 3933449.40965846;
+					QC11 = -6.66122876558634;
+					QC12 = -349102295.417547;
+					QC13 = 83672.179730172;
+					QC14 = -6059524.33170538;
+					QC15 = 1220523.39525162;
+
+					SpecRegenEnergy = QC0 + QC1 * ProcAirInTemp + QC2 * ProcAirInHumRat + QC3 * ProcAirVel + QC4 * ProcAirInTemp * ProcAirInHumRat + QC5 * ProcAirInTemp * ProcAirVel + QC6 * ProcAirInHumRat * ProcAirVel + QC7 * ProcAirInTemp * ProcAirInTemp + QC8 * ProcAirInHumRat * ProcAirInHumRat + QC9 * ProcAirVel * ProcAirVel + QC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + QC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + QC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + QC13 * std::log( ProcAirInTemp ) + QC14 * std::log( ProcAirInHumRat ) + QC15 * std::log( ProcAirVel );
+
+					// Regen face velocity
+					RC0 = -4.67358908091488;
+					RC1 = 0.0654323095468338;
+					RC2 = 396.950518702316;
+					RC3 = 1.52610165426736;
+					RC4 = -11.3955868430328;
+					RC5 = 0.00520693906104437;
+					RC6 = 57.783645385621;
+					RC7 = -0.000464800668311693;
+					RC8 = -5958.78613212602;
+					RC9 = -0.205375818291012;
+					RC10 = 5.26762675442845;
+					RC11 = -8.88452553055039e-05;
+					RC12 = -182.382479369311;
+					RC13 = -0.100289774002047;
+					RC14 = -0.486980507964251;
+					RC15 = -0.972715425435447;
+
+					RegenAirVel = RC0 + RC1 * ProcAirInTemp + RC2 * ProcAirInHumRat + RC3 * ProcAirVel + RC4 * ProcAirInTemp * ProcAirInHumRat + RC5 * ProcAirInTemp * ProcAirVel + RC6 * ProcAirInHumRat * ProcAirVel + RC7 * ProcAirInTemp * ProcAirInTemp + RC8 * ProcAirInHumRat * ProcAirInHumRat + RC9 * ProcAirVel * ProcAirVel + RC10 * ProcAirInTemp * ProcAirInTemp * ProcAirInHumRat * ProcAirInHumRat + RC11 * ProcAirInTemp * ProcAirInTemp * ProcAirVel * ProcAirVel + RC12 * ProcAirInHumRat * ProcAirInHumRat * ProcAirVel * ProcAirVel + RC13 * std::log( ProcAirInTemp ) + RC14 * std::log( ProcAirInHumRat ) + RC15 * std::log( ProcAirVel );
+
+				} else if ( SELECT_CASE_var == PM_UserCurves ) {
+
+					ProcAirOutTemp = CurveValue( DesicDehum( DesicDehumNum ).ProcDryBulbCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).ProcDryBulbCurvefV, ProcAirVel );
+
+					SpecRegenEnergy = CurveValue( DesicDehum( DesicDehumNum ).RegenEnergyCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).RegenEnergyCurvefV, ProcAirVel );
+
+					RegenAirVel = CurveValue( DesicDehum( DesicDehumNum ).RegenVelCurvefTW, ProcAirInTemp, ProcAirInHumRat ) * CurveValue( DesicDehum( DesicDehumNum ).RegenVelCurvefV, ProcAirVel );
 
-			} else {
+				} else {
+
+					ShowFatalError( "Invalid performance model in desiccant dehumidifier = " + TrimSigDigits( DesicDehum( DesicDehumNum ).PerformanceModel_Num ) );
 
-				ShowFatalError( "Invalid performance model in desiccant dehumidifier = " + TrimSigDigits( DesicDehum( DesicDehumNum ).PerformanceModel_Num ) );
+					// Suppress uninitialized warnings
+					ProcAirOutTemp = 0.0;
+					SpecRegenEnergy = 0.0;
+					RegenAirVel = 0.0;
 
-				// Suppress uninitialized warnings
-				ProcAirOutTemp = 0.0;
-				SpecRegenEnergy = 0.0;
-				RegenAirVel = 0.0;
+				}} // Performance Model Part B
 
-			}} // Performance Model Part B
+				DesicDehum( DesicDehumNum ).PerfCurveRegenValid = true;
+				DesicDehum( DesicDehumNum ).PerfCurveProcOutTemp = ProcAirOutTemp;
+				DesicDehum( DesicDehumNum ).PerfCurveSpecRegenEnergy = SpecRegenEnergy;
+				DesicDehum( DesicDehumNum ).PerfCurveRegenAirVel = RegenAirVel;
+
+			} else {
+				ProcAirOutTemp = DesicDehum( DesicDehumNum ).PerfCurveProcOutTemp;
+				SpecRegenEnergy = DesicDehum( DesicDehumNum ).PerfCurveSpecRegenEnergy;
+				RegenAirVel = DesicDehum( DesicDehumNum ).PerfCurveRegenAirVel;
+			}
 
 			ProcAirOutTemp = ( 1 - PartLoad ) * ProcAirInTemp + ( PartLoad ) * ProcAirOutTemp;
 
@@ -2616,7 +2642,7 @@ namespace DesiccantDehumidifiers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse, FSEC/UCF
 		//       DATE WRITTEN   January 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start the hot water flow solution from the previous one
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2624,7 +2650,9 @@ namespace DesiccantDehumidifiers {
 
 		// METHODOLOGY EMPLOYED:
 		// Simply calls the different heating coil component.  The hot water flow rate matching the coil load
-		// is calculated iteratively.
+		// is calculated iteratively.  The coil output rises with the water flow, so the residual at the
+		// previous solution tells on which side of it the new solution lies; the search is narrowed to a
+		// band next to it when that band brackets the solution.
 
 		// REFERENCES:
 		// na
@@ -2646,6 +2674,7 @@ namespace DesiccantDehumidifiers {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const ErrTolerance( 0.001 ); // convergence limit for hotwater coil
 		int const SolveMaxIter( 50 ); // Max iteration for SolveRegulaFalsi
+		Real64 const WarmStartBand( 0.2 ); // fraction of the previous hot water flow searched next to it
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -2660,6 +2689,9 @@ namespace DesiccantDehumidifiers {
 		//unused  REAL(r64)      :: PartLoadFraction  ! heating or cooling part load fraction
 		Real64 MaxHotWaterFlow; // maximum hot water mass flow rate, kg/s
 		Real64 HotWaterMdot; // actual hot water mass flow rate
+		Real64 LastWaterFlow; // hot water mass flow rate solved last time [kg/s]
+		Real64 BandWaterFlow; // hot water mass flow rate at the edge of the band next to LastWaterFlow [kg/s]
+		Real64 LastResidual; // HotWaterCoilResidual at LastWaterFlow
 		Array1D< Real64 > Par( 3 );
 		int SolFlag;
 
@@ -2686,7 +2718,34 @@ namespace DesiccantDehumidifiers {
 						Par( 2 ) = 0.0;
 					}
 					Par( 3 ) = RegenCoilLoad;
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+					SolFlag = -2;
+					LastWaterFlow = DesicDehum( DesicDehumNum ).RegenCoilHotWaterFlowLast;
+					if ( LastWaterFlow > MinWaterFlow && LastWaterFlow < MaxHotWaterFlow ) {
+						LastResidual = HotWaterCoilResidual( LastWaterFlow, Par );
+						if ( std::abs( LastResidual ) < ErrTolerance ) {
+							HotWaterMdot = LastWaterFlow;
+							SolFlag = 1;
+						} else if ( LastResidual > 0.0 ) {
+							BandWaterFlow = max( MinWaterFlow, ( 1.0 - WarmStartBand ) * LastWaterFlow );
+							if ( HotWaterCoilResidual( BandWaterFlow, Par ) < 0.0 ) {
+								SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, BandWaterFlow, LastWaterFlow, Par );
+							} else {
+								SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, BandWaterFlow, Par );
+							}
+						} else {
+							BandWaterFlow = min( MaxHotWaterFlow, ( 1.0 + WarmStartBand ) * LastWaterFlow );
+							if ( HotWaterCoilResidual( BandWaterFlow, Par ) > 0.0 ) {
+								SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, LastWaterFlow, BandWaterFlow, Par );
+							} else {
+								SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, BandWaterFlow, MaxHotWaterFlow, Par );
+							}
+						}
+					}
+					// no usable previous solution, or the narrowed interval did not bracket one: search the full range
+					if ( SolFlag == -2 ) {
+						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+					}
+					if ( SolFlag > 0 ) DesicDehum( DesicDehumNum ).RegenCoilHotWaterFlowLast = HotWaterMdot;
 					if ( SolFlag == -1 ) {
 						if ( DesicDehum( DesicDehumNum ).HotWaterCoilMaxIterIndex == 0 ) {
 							ShowWarningMessage( "CalcNonDXHeatingCoils: Hot water coil control failed for " + DesicDehum( DesicDehumNum ).DehumType + "=\"" + DesicDehum( DesicDehumNum ).Name + "\"" );
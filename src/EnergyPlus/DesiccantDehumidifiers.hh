@@ -163,6 +163,15 @@ namespace DesiccantDehumidifiers {
 		int HotWaterCoilMaxIterIndex2; // Index to recurring warning message
 		Real64 MaxCoilFluidFlow; // hot water or steam mass flow rate regen. heating coil [kg/s]
 		Real64 RegenCoilCapacity; // hot water or steam coil operating capacity [W]
+		Real64 RegenCoilHotWaterFlowLast; // last hot water flow solved by CalcNonDXHeatingCoils [kg/s]
+		bool PerfCurveInletValid; // performance results below are valid for the inlet state below
+		bool PerfCurveRegenValid; // regen side performance results below are valid
+		Real64 PerfCurveInletTemp; // process inlet air temperature of the cached performance results [C]
+		Real64 PerfCurveInletHumRat; // process inlet air humidity ratio of the cached performance results [kgWater/kgDryAir]
+		Real64 PerfCurveMinProcOutHumRat; // cached minimum process outlet air humidity ratio, before limiting [kgWater/kgDryAir]
+		Real64 PerfCurveProcOutTemp; // cached process outlet air temperature [C]
+		Real64 PerfCurveSpecRegenEnergy; // cached specific regen energy [J/kg of water removed]
+		Real64 PerfCurveRegenAirVel; // cached regen air velocity [m/s]
 
 		// Default Constructor
 		DesiccantDehumidifierData() :
@@ -262,7 +271,16 @@ namespace DesiccantDehumidifiers {
 			HotWaterCoilMaxIterIndex( 0 ),
 			HotWaterCoilMaxIterIndex2( 0 ),
 			MaxCoilFluidFlow( 0.0 ),
-			RegenCoilCapacity( 0.0 )
+			RegenCoilCapacity( 0.0 ),
+			RegenCoilHotWaterFlowLast( 0.0 ),
+			PerfCurveInletValid( false ),
+			PerfCurveRegenValid( false ),
+			PerfCurveInletTemp( 0.0 ),
+			PerfCurveInletHumRat( 0.0 ),
+			PerfCurveMinProcOutHumRat( 0.0 ),
+			PerfCurveProcOutTemp( 0.0 ),
+			PerfCurveSpecRegenEnergy( 0.0 ),
+			PerfCurveRegenAirVel( 0.0 )
 		{}
 
 		// Member Constructor
@@ -485,7 +503,16 @@ namespace DesiccantDehumidifiers {
 			HotWaterCoilMaxIterIndex( HotWaterCoilMaxIterIndex ),
 			HotWaterCoilMaxIterIndex2( HotWaterCoilMaxIterIndex2 ),
 			MaxCoilFluidFlow( MaxCoilFluidFlow ),
-			RegenCoilCapacity( RegenCoilCapacity )
+			RegenCoilCapacity( RegenCoilCapacity ),
+			RegenCoilHotWaterFlowLast( 0.0 ),
+			PerfCurveInletValid( false ),
+			PerfCurveRegenValid( false ),
+			PerfCurveInletTemp( 0.0 ),
+			PerfCurveInletHumRat( 0.0 ),
+			PerfCurveMinProcOutHumRat( 0.0 ),
+			PerfCurveProcOutTemp( 0.0 ),
+			PerfCurveSpecRegenEnergy( 0.0 ),
+			PerfCurveRegenAirVel( 0.0 )
 		{}
 
 	};
@@ -72,15 +72,15 @@ namespace DisplacementVentMgr {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	Real64 HAT_MX; // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone
-	Real64 HA_MX; // HA_MX Convection Coefficient times Area for the upper subzone
-	Real64 HAT_OC; // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone
-	Real64 HA_OC; // HA_OC Convection Coefficient times Area for the lower subzone
-	Real64 HAT_FLOOR; // HAT_FLOOR Convection Coefficient times Area times Temperature for the floor(?) subzone
-	Real64 HA_FLOOR; // HA_FLOOR Convection Coefficient times Area for the floor(?) subzone
+	EP_THREAD_LOCAL Real64 HAT_MX; // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone
+	EP_THREAD_LOCAL Real64 HA_MX; // HA_MX Convection Coefficient times Area for the upper subzone
+	EP_THREAD_LOCAL Real64 HAT_OC; // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone
+	EP_THREAD_LOCAL Real64 HA_OC; // HA_OC Convection Coefficient times Area for the lower subzone
+	EP_THREAD_LOCAL Real64 HAT_FLOOR; // HAT_FLOOR Convection Coefficient times Area times Temperature for the floor(?) subzone
+	EP_THREAD_LOCAL Real64 HA_FLOOR; // HA_FLOOR Convection Coefficient times Area for the floor(?) subzone
 	Real64 HeightFloorSubzoneTop( 0.2 ); // Assumed thickness of floor subzone
 	Real64 ThickOccupiedSubzoneMin( 0.2 ); // Minimum thickness of occupied subzone
-	Real64 HeightIntMass( 0.0 ); // Height of internal mass surfaces, assumed vertical, cannot exceed ceiling height
+	EP_THREAD_LOCAL Real64 HeightIntMass( 0.0 ); // Height of internal mass surfaces, assumed vertical, cannot exceed ceiling height
 	Real64 HeightIntMassDefault( 2.0 ); // Default height of internal mass surfaces
 
 	// SUBROUTINE SPECIFICATIONS:
@@ -521,6 +521,7 @@ namespace DisplacementVentMgr {
 		//       AUTHOR         G. Carrilho da Graca
 		//       DATE WRITTEN   February 2004
 		//       MODIFIED       Brent Griffith June 2008 for new interpolation and time history
+		//                      Oct 2026, only touch the data of this zone so zones can be calculated in parallel
 		//       RE-ENGINEERED  -
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -611,8 +612,8 @@ namespace DisplacementVentMgr {
 		Real64 ZoneMult; // total zone multiplier
 		int Loop;
 		int FlagApertures;
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
 		static Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
 
 		static Array1D_int IntGainTypesMixedSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
@@ -639,7 +640,9 @@ namespace DisplacementVentMgr {
 
 		MIXFLAG = false;
 		FlagApertures = 1;
-		DVHcIn = HConvIn;
+		for ( int SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+			DVHcIn( SurfNum ) = HConvIn( SurfNum );
+		}
 		CeilingHeight = ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 2 ) - ZoneCeilingHeight( ( ZoneNum - 1 ) * 2 + 1 );
 		ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
@@ -939,6 +942,9 @@ namespace DisplacementVentMgr {
 			TCMF( ZoneNum ) = ZTAveraged;
 		} else {
 			if ( HeightComfort >= 0.0 && HeightComfort < HeightFloorSubzoneAve ) {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowWarningError( "Displacement ventilation comfort height is in floor subzone in Zone: " + Zone( ZoneNum ).Name );
 				TCMF( ZoneNum ) = ZTFloor( ZoneNum );
 			} else if ( HeightComfort >= HeightFloorSubzoneAve && HeightComfort < HeightOccupiedSubzoneAve ) {
@@ -951,6 +957,9 @@ namespace DisplacementVentMgr {
 			} else if ( HeightComfort >= HeightMixedSubzoneAve && HeightComfort <= CeilingHeight ) {
 				TCMF( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "Displacement ventilation comfort height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
@@ -961,6 +970,9 @@ namespace DisplacementVentMgr {
 			TempTstatAir( ZoneNum ) = ZTAveraged;
 		} else {
 			if ( HeightThermostat >= 0.0 && HeightThermostat < HeightFloorSubzoneAve ) {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowWarningError( "Displacement thermostat is in floor subzone in Zone: " + Zone( ZoneNum ).Name );
 				TempTstatAir( ZoneNum ) = ZTFloor( ZoneNum );
 			} else if ( HeightThermostat >= HeightFloorSubzoneAve && HeightThermostat < HeightOccupiedSubzoneAve ) {
@@ -973,6 +985,9 @@ namespace DisplacementVentMgr {
 			} else if ( HeightThermostat >= HeightMixedSubzoneAve && HeightThermostat <= CeilingHeight ) {
 				TempTstatAir( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "Displacement ventilation thermostat height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
@@ -1,17 +1,176 @@
 // C++ Headers
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
 
 // EnergyPlus Headers
 #include <DisplayRoutines.hh>
+#include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataSystemVariables.hh>
 
 namespace EnergyPlus {
 
+// Asynchronous display (see StartAsyncDisplay)
+int const DisplayBatchInterval( 250 ); // Shortest time between the batches written by the display thread {ms}
+
+struct DisplayMessage
+{
+	std::string Text;
+	bool Console; // Written to the console
+	bool Callback; // Passed to the message callback
+
+	DisplayMessage(
+		std::string const & Text,
+		bool const Console,
+		bool const Callback
+	) :
+		Text( Text ),
+		Console( Console ),
+		Callback( Callback )
+	{}
+};
+
+static std::vector< DisplayMessage > DisplayQueue; // Messages waiting for the display thread
+static std::mutex DisplayMutex; // Guards DisplayQueue and DisplayStop
+static std::condition_variable DisplayWake; // Signals the display thread
+static bool DisplayStop( false ); // No more messages will be queued
+static std::thread DisplayThread; // Display thread (joinable while the asynchronous display runs)
+
+static
+void
+WriteDisplayBatches()
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Display thread: writes the queued messages to the console and passes them to the message
+	// callback, a batch at a time, until the asynchronous display is stopped.
+
+	// METHODOLOGY EMPLOYED:
+	// After the first message of a batch arrives the thread waits DisplayBatchInterval for more,
+	// so the console gets one write per interval however many messages the simulation sends.
+
+	using DataGlobals::fMessagePtr;
+
+	std::vector< DisplayMessage > Batch;
+	std::string ConsoleText;
+	std::unique_lock< std::mutex > lock( DisplayMutex );
+	while ( true ) {
+		DisplayWake.wait( lock, []{ return DisplayStop || ! DisplayQueue.empty(); } );
+		if ( ! DisplayStop ) DisplayWake.wait_for( lock, std::chrono::milliseconds( DisplayBatchInterval ), []{ return DisplayStop; } );
+		Batch.swap( DisplayQueue );
+		bool const Stopping( DisplayStop );
+		lock.unlock();
+
+		ConsoleText.clear();
+		for ( auto const & Message : Batch ) {
+			if ( Message.Console ) {
+				ConsoleText += Message.Text;
+				ConsoleText += '\n';
+			}
+		}
+		if ( ! ConsoleText.empty() ) std::cout << ConsoleText << std::flush;
+		if ( fMessagePtr ) {
+			for ( auto const & Message : Batch ) {
+				if ( Message.Callback ) fMessagePtr( Message.Text );
+			}
+		}
+		Batch.clear();
+
+		if ( Stopping ) return;
+		lock.lock();
+	}
+
+}
+
+static
+bool
+QueueDisplayMessage(
+	std::string const & String, // String to be displayed
+	bool const Console, // Write to the console
+	bool const Callback // Pass to the message callback
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Queues a message for the display thread.  Returns false, leaving the message to the
+	// caller, if the asynchronous display is not running.
+
+	if ( ! DisplayThread.joinable() ) return false;
+	if ( ! Console && ! Callback ) return true;
+	{
+		std::lock_guard< std::mutex > lock( DisplayMutex );
+		DisplayQueue.emplace_back( String, Console, Callback );
+	}
+	DisplayWake.notify_one();
+	return true;
+
+}
+
+void
+StartAsyncDisplay()
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Starts the display thread (AsyncDisplay environment variable).  From now on the messages
+	// are written to the console, and passed to the message callback, by the display thread in
+	// batches, so the simulation does not wait on the console or on the caller's callback.
+
+	if ( DisplayThread.joinable() ) return;
+	DisplayStop = false;
+	DisplayThread = std::thread( WriteDisplayBatches );
+
+}
+
+void
+StopAsyncDisplay()
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Writes the queued messages and stops the display thread; later messages are displayed
+	// directly again.
+
+	if ( ! DisplayThread.joinable() ) return;
+	{
+		std::lock_guard< std::mutex > lock( DisplayMutex );
+		DisplayStop = true;
+	}
+	DisplayWake.notify_one();
+	DisplayThread.join();
+
+}
+
 void
 DisplayString( std::string const & String ) // String to be displayed
 {
@@ -19,7 +178,7 @@ DisplayString( std::string const & String ) // String to be displayed
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda Lawrie
 	//       DATE WRITTEN   Version 1.0
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, queue for the display thread when it runs
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -49,6 +208,7 @@ DisplayString( std::string const & String ) // String to be displayed
 	// na
 
 	if ( KickOffSimulation && ! DeveloperFlag ) return;
+	if ( QueueDisplayMessage( String, true, false ) ) return;
 	std::cout << String << '\n';
 
 }
@@ -60,7 +220,7 @@ DisplayString( char const * String ) // String to be displayed
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda Lawrie
 	//       DATE WRITTEN   Version 1.0
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, queue for the display thread when it runs
 	//       RE-ENGINEERED  Overload to avoid std::string creation overhead
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -90,9 +250,12 @@ DisplayString( char const * String ) // String to be displayed
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	// na
 
+	bool const Console( ! KickOffSimulation || DeveloperFlag );
+	if ( QueueDisplayMessage( String, Console, fMessagePtr != nullptr ) ) return;
+
 	if ( fMessagePtr ) fMessagePtr( String );
 
-	if ( KickOffSimulation && ! DeveloperFlag ) return;
+	if ( ! Console ) return;
 	std::cout << String << '\n';
 
 }
@@ -107,7 +270,7 @@ DisplayNumberAndString(
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda Lawrie
 	//       DATE WRITTEN   Version 1.0
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, queue for the display thread when it runs
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -139,9 +302,11 @@ DisplayNumberAndString(
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	std::stringstream sstm;
 	sstm << String << ' ' << Number;
+	bool const Console( ! KickOffSimulation || DeveloperFlag );
+	if ( QueueDisplayMessage( sstm.str(), Console, fMessagePtr != nullptr ) ) return;
 	if ( fMessagePtr ) fMessagePtr( sstm.str() );
 
-	if ( KickOffSimulation && ! DeveloperFlag ) return;
+	if ( ! Console ) return;
 	std::cout << String << ' ' << Number << '\n';
 }
 
@@ -155,7 +320,7 @@ DisplaySimDaysProgress( // This doesn't do anything!
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Linda Lawrie
 	//       DATE WRITTEN   Version 1.0
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, callbacks only when the progress changes; progress events
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -163,14 +328,18 @@ DisplaySimDaysProgress( // This doesn't do anything!
 	// Progress is percent of current days vs total days.
 
 	// METHODOLOGY EMPLOYED:
-	// Needs description, as appropriate.
+	// The progress callbacks are called only when the percent or the environment changes, so a
+	// caller is not called every simulation day with the same value.  The progress event callback
+	// also gets the environment number and the simulation days.
 
 	// REFERENCES:
 	// na
 
 	// Using/Aliasing
+	using DataEnvironment::CurEnvirNum;
 	using DataGlobals::KickOffSimulation;
 	using DataGlobals::fProgressPtr;
+	using DataGlobals::fProgressEventPtr;
 	using DataSystemVariables::DeveloperFlag;
 
 	// Locals
@@ -187,6 +356,8 @@ DisplaySimDaysProgress( // This doesn't do anything!
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	static int percent( 0 ); // Current percent progress
+	static int LastPercent( -1 ); // Percent progress at the last callback
+	static int LastEnvirNum( -1 ); // Environment at the last callback
 
 	if ( KickOffSimulation && ! DeveloperFlag ) return;
 	if ( TotalSimDays > 0 ) {
@@ -196,7 +367,12 @@ DisplaySimDaysProgress( // This doesn't do anything!
 		percent = 0;
 	}
 
+	if ( percent == LastPercent && CurEnvirNum == LastEnvirNum ) return;
+	LastPercent = percent;
+	LastEnvirNum = CurEnvirNum;
+
 	if ( fProgressPtr ) fProgressPtr( percent );
+	if ( fProgressEventPtr ) fProgressEventPtr( percent, CurEnvirNum, CurrentSimDay, TotalSimDays );
 
 }
 
@@ -9,6 +9,12 @@
 
 namespace EnergyPlus {
 
+void
+StartAsyncDisplay();
+
+void
+StopAsyncDisplay();
+
 void
 DisplayString( std::string const & String ); // String to be displayed
 
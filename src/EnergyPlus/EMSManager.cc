@@ -19,6 +19,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRuntimeLanguage.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneControls.hh>
 #include <EMSManager.hh>
 #include <General.hh>
@@ -73,6 +74,8 @@ namespace EMSManager {
 	bool GetEMSUserInput( true ); // Flag to prevent input from being read multiple times
 	bool ZoneThermostatActuatorsHaveBeenSetup( false );
 	bool FinishProcessingUserInput( true ); // Flag to indicate still need to process input
+	Array1D_bool ProgramsAtCallingPoint; // true for calling points with Erl programs attached
+	bool SkipIdleCallingPoints( false ); // true if calling points without programs can return right away
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -218,7 +221,8 @@ namespace EMSManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   June 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return early from calling points with no programs attached
+		//                      Oct 2026, timed as a region of the timing profile
 		//       RE-ENGINEERED  Brent Griffith, April 2009
 		//                      added calling point argument and logic.
 		//                      Collapsed SimulateEMS into this routine
@@ -230,6 +234,7 @@ namespace EMSManager {
 
 		// Using/Aliasing
 		using DataGlobals::AnyEnergyManagementSystemInModel;
+		using DataGlobals::BeginEnvrnFlag;
 		using DataGlobals::emsCallFromSetupSimulation;
 		using DataGlobals::emsCallFromExternalInterface;
 		using DataGlobals::emsCallFromBeginNewEvironment;
@@ -269,8 +274,16 @@ namespace EMSManager {
 		// FLOW:
 		if ( ! AnyEnergyManagementSystemInModel ) return; // quick return if nothing to do
 
+		DataTimings::ProfileTimer const profileTimer( "ManageEMS" ); // Region of the timing profile
+
 		if ( iCalledFrom == emsCallFromBeginNewEvironment ) BeginEnvrnInitializeRuntimeLanguage();
 
+		// once all the EMS input is processed, a calling point with no programs attached has nothing to do.
+		// Sensors and built-in variables are refreshed by InitEMS at the next calling point that runs programs.
+		if ( SkipIdleCallingPoints && ! BeginEnvrnFlag && ! FinishProcessingUserInput && ZoneThermostatActuatorsHaveBeenSetup ) {
+			if ( ( iCalledFrom > ProgramsAtCallingPoint.u() || ! ProgramsAtCallingPoint( iCalledFrom ) ) && iCalledFrom != emsCallFromSetupSimulation && iCalledFrom != emsCallFromExternalInterface && iCalledFrom != emsCallFromUserDefinedComponentModel ) return;
+		}
+
 		InitEMS( iCalledFrom );
 
 		if ( iCalledFrom == emsCallFromSetupSimulation ) {
@@ -354,7 +367,7 @@ namespace EMSManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   May 2009
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, read output variable sensors through their bound references
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -460,7 +473,13 @@ namespace EMSManager {
 			if ( ( ErlVariableNum > 0 ) && ( Sensor( SensorNum ).Index > 0 ) ) {
 				if ( Sensor( SensorNum ).SchedNum == 0 ) { // not a schedule so get from output processor
 
-					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetInternalVariableValue( Sensor( SensorNum ).Type, Sensor( SensorNum ).Index ), ErlVariable( ErlVariableNum ).Value );
+					if ( Sensor( SensorNum ).RealValue.associated() ) {
+						ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( Sensor( SensorNum ).RealValue(), ErlVariable( ErlVariableNum ).Value );
+					} else if ( Sensor( SensorNum ).IntValue.associated() ) {
+						ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( double( Sensor( SensorNum ).IntValue() ), ErlVariable( ErlVariableNum ).Value );
+					} else {
+						ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetInternalVariableValue( Sensor( SensorNum ).Type, Sensor( SensorNum ).Index ), ErlVariable( ErlVariableNum ).Value );
+					}
 				} else { // schedule so use schedule service
 
 					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetCurrentScheduleValue( Sensor( SensorNum ).SchedNum ), ErlVariable( ErlVariableNum ).Value );
@@ -1188,12 +1207,81 @@ namespace EMSManager {
 			ShowFatalError( "Errors found in processing Energy Management System input. Preceding condition causes termination." );
 		}
 
+		BindEMSSensorsAndCallingPoints();
+
 		if ( reportErrors ) {
 			BeginEnvrnInitializeRuntimeLanguage();
 		}
 
 	}
 
+	void
+	BindEMSSensorsAndCallingPoints()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Resolves what InitEMS and ManageEMS would otherwise look up on every call: binds each
+		// resolved real or integer output variable sensor directly to the variable it reads, and
+		// notes which calling points have Erl programs attached.
+
+		// METHODOLOGY EMPLOYED:
+		// Called at the end of each pass of ProcessEMSInput since sensors may only resolve on a later pass.
+		// Meter and schedule sensors keep going through the output processor and schedule services.
+		// Calling points without programs are only skipped if no trend variable logs a sensor or a
+		// built-in variable, since those are refreshed whenever ManageEMS initializes.
+
+		// Using/Aliasing
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::IVariableTypes;
+		using RuntimeLanguageProcessor::WarmUpFlagNum;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SensorNum; // local loop
+		int ProgramManagerNum; // local loop
+		int TrendNum; // local loop
+		int ErlVarNum; // local index
+		int MaxCallingPoint( 0 ); // highest calling point used by a program calling manager
+
+		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+			auto & thisSensor( Sensor( SensorNum ) );
+			thisSensor.RealValue >>= nullptr;
+			thisSensor.IntValue >>= nullptr;
+			if ( ! thisSensor.CheckedOkay || thisSensor.SchedNum > 0 || thisSensor.Index <= 0 ) continue;
+			if ( thisSensor.Type == 2 ) { // real
+				thisSensor.RealValue >>= RVariableTypes( thisSensor.Index ).VarPtr().Which;
+			} else if ( thisSensor.Type == 1 ) { // integer
+				thisSensor.IntValue >>= IVariableTypes( thisSensor.Index ).VarPtr().Which;
+			}
+		}
+
+		for ( ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+			MaxCallingPoint = max( MaxCallingPoint, EMSProgramCallManager( ProgramManagerNum ).CallingPoint );
+		}
+		ProgramsAtCallingPoint.dimension( MaxCallingPoint, false );
+		for ( ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+			if ( EMSProgramCallManager( ProgramManagerNum ).CallingPoint > 0 && EMSProgramCallManager( ProgramManagerNum ).NumErlPrograms > 0 ) {
+				ProgramsAtCallingPoint( EMSProgramCallManager( ProgramManagerNum ).CallingPoint ) = true;
+			}
+		}
+
+		SkipIdleCallingPoints = true;
+		for ( TrendNum = 1; TrendNum <= NumErlTrendVariables; ++TrendNum ) {
+			ErlVarNum = TrendVariable( TrendNum ).ErlVariablePointer;
+			if ( ErlVarNum <= 0 ) continue;
+			if ( ErlVarNum <= WarmUpFlagNum ) SkipIdleCallingPoints = false; // built-in variables are created first
+			for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+				if ( Sensor( SensorNum ).VariableNum == ErlVarNum ) SkipIdleCallingPoints = false;
+			}
+		}
+
+	}
+
 	void
 	GetVariableTypeAndIndex(
 		std::string const & VarName,
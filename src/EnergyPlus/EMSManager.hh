@@ -2,6 +2,7 @@
 #define EMSManager_hh_INCLUDED
 
 // ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -33,6 +34,8 @@ namespace EMSManager {
 	extern bool GetEMSUserInput; // Flag to prevent input from being read multiple times
 	extern bool ZoneThermostatActuatorsHaveBeenSetup;
 	extern bool FinishProcessingUserInput; // Flag to indicate still need to process input
+	extern Array1D_bool ProgramsAtCallingPoint; // true for calling points with Erl programs attached
+	extern bool SkipIdleCallingPoints; // true if calling points without programs can return right away
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -61,6 +64,9 @@ namespace EMSManager {
 	void
 	ProcessEMSInput( bool const reportErrors ); // .  If true, then report out errors ,otherwise setup what we can
 
+	void
+	BindEMSSensorsAndCallingPoints();
+
 	void
 	GetVariableTypeAndIndex(
 		std::string const & VarName,
@@ -383,14 +383,16 @@ namespace EarthTube {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Kwang Ho Lee
 		//       DATE WRITTEN   November 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, outdoor air properties once per call, ground temp once per day
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This subroutine simulates the components making up the EarthTube unit.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The outdoor air properties are the same for every earth tube and are calculated
+		// once per call. The ground temperature only depends on the day of the year and is
+		// recalculated when the day changes.
 
 		// REFERENCES:
 		// na
@@ -449,6 +451,10 @@ namespace EarthTube {
 		MCPE = 0.0;
 		EAMFL = 0.0;
 
+		AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, OutDryBulbTemp, OutHumRat );
+		AirSpecHeat = PsyCpAirFnWTdb( OutHumRat, OutDryBulbTemp );
+		InsideDewPointTemp = PsyTdpFnWPb( OutHumRat, OutBaroPress );
+
 		for ( Loop = 1; Loop <= TotEarthTube; ++Loop ) {
 
 			NZ = EarthTubeSys( Loop ).ZonePtr;
@@ -460,8 +466,6 @@ namespace EarthTube {
 			// Skip if below the temperature difference limit
 			if ( std::abs( MAT( NZ ) - OutDryBulbTemp ) < EarthTubeSys( Loop ).DelTemperature ) continue;
 
-			AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, OutDryBulbTemp, OutHumRat );
-			AirSpecHeat = PsyCpAirFnWTdb( OutHumRat, OutDryBulbTemp );
 			EVF( NZ ) = EarthTubeSys( Loop ).DesignLevel * GetCurrentScheduleValue( EarthTubeSys( Loop ).SchedPtr );
 			MCPE( NZ ) = EVF( NZ ) * AirDensity * AirSpecHeat * ( EarthTubeSys( Loop ).ConstantTermCoef + std::abs( OutDryBulbTemp - MAT( NZ ) ) * EarthTubeSys( Loop ).TemperatureTermCoef + WindSpeed * ( EarthTubeSys( Loop ).VelocityTermCoef + WindSpeed * EarthTubeSys( Loop ).VelocitySQTermCoef ) );
 
@@ -474,8 +478,11 @@ namespace EarthTube {
 			AirMassFlowRate = EVF( NZ ) * AirDensity;
 
 			// Calculation of Average Ground Temperature between Depth z1 and z2 at time t
-			GroundTempz1z2t = EarthTubeSys( Loop ).AverSoilSurTemp - EarthTubeSys( Loop ).ApmlSoilSurTemp * std::exp( -EarthTubeSys( Loop ).z * std::sqrt( Pi / 365.0 / EarthTubeSys( Loop ).SoilThermDiff ) ) * std::cos( 2.0 * Pi / 365.0 * ( DayOfYear - EarthTubeSys( Loop ).SoilSurPhaseConst - EarthTubeSys( Loop ).z / 2.0 * std::sqrt( 365.0 / Pi / EarthTubeSys( Loop ).SoilThermDiff ) ) );
-			EarthTubeSys( Loop ).GroundTempz1z2t = GroundTempz1z2t;
+			if ( EarthTubeSys( Loop ).GroundTempDayOfYear != DayOfYear ) {
+				EarthTubeSys( Loop ).GroundTempz1z2t = EarthTubeSys( Loop ).AverSoilSurTemp - EarthTubeSys( Loop ).ApmlSoilSurTemp * std::exp( -EarthTubeSys( Loop ).z * std::sqrt( Pi / 365.0 / EarthTubeSys( Loop ).SoilThermDiff ) ) * std::cos( 2.0 * Pi / 365.0 * ( DayOfYear - EarthTubeSys( Loop ).SoilSurPhaseConst - EarthTubeSys( Loop ).z / 2.0 * std::sqrt( 365.0 / Pi / EarthTubeSys( Loop ).SoilThermDiff ) ) );
+				EarthTubeSys( Loop ).GroundTempDayOfYear = DayOfYear;
+			}
+			GroundTempz1z2t = EarthTubeSys( Loop ).GroundTempz1z2t;
 
 			// Calculation of Convective Heat Transfer Coefficient at Inner Pipe Surface
 			AirThermCond = 0.02442 + 0.6992 * OutDryBulbTemp / 10000.0;
@@ -520,8 +527,6 @@ namespace EarthTube {
 
 			}
 
-			InsideDewPointTemp = PsyTdpFnWPb( OutHumRat, OutBaroPress );
-
 			if ( EarthTubeSys( Loop ).InsideAirTemp >= InsideDewPointTemp ) {
 				InsideEnthalpy = PsyHFnTdbW( EarthTubeSys( Loop ).InsideAirTemp, OutHumRat );
 				// Intake fans will add some heat to the air, raising the temperature for an intake fan...
@@ -50,6 +50,7 @@ namespace EarthTube {
 		Real64 FanEfficiency;
 		Real64 FanPower;
 		Real64 GroundTempz1z2t; // ground temp between z1 and z2 at time t
+		int GroundTempDayOfYear; // day of year GroundTempz1z2t was calculated for
 		Real64 InsideAirTemp;
 		Real64 AirTemp;
 		Real64 r1; // Inner Pipe Radius (m)
@@ -81,6 +82,7 @@ namespace EarthTube {
 			FanEfficiency( 0.0 ),
 			FanPower( 0.0 ),
 			GroundTempz1z2t( 0.0 ),
+			GroundTempDayOfYear( 0 ),
 			InsideAirTemp( 0.0 ),
 			AirTemp( 0.0 ),
 			r1( 0.0 ),
@@ -141,6 +143,7 @@ namespace EarthTube {
 			FanEfficiency( FanEfficiency ),
 			FanPower( FanPower ),
 			GroundTempz1z2t( GroundTempz1z2t ),
+			GroundTempDayOfYear( 0 ),
 			InsideAirTemp( InsideAirTemp ),
 			AirTemp( AirTemp ),
 			r1( r1 ),
@@ -82,6 +82,7 @@ namespace EcoRoofManager {
 	Real64 Tfold; // leaf temperature from the previous time step
 	Real64 Tgold; // ground temperature from the previous time step
 	bool EcoRoofbeginFlag( true );
+	int SoilPropsTimeStep( 0 ); // SimTimeSteps value of the last soil moisture update (0 forces an update)
 
 	// MODULE SUBROUTINES:
 
@@ -101,6 +102,7 @@ namespace EcoRoofManager {
 		//     AUTHOR          David Sailor and Toan Pham
 		//     DATE WRITTEN    January 2007
 		//     MODIFIED        David Sailor - to fix initialization between DD runs and during warm-up
+		//                     Oct 2026, update soil moisture only once per zone time step
 		//     RE-ENGINEERED   na
 
 		// PURPOSE OF THIS MODULE:
@@ -350,6 +352,7 @@ namespace EcoRoofManager {
 			Moisture = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).InitMoisture; // Initial moisture content in soil
 			MeanRootMoisture = Moisture; // Start the root zone moisture at the same value as the surface.
 			Alphag = 1.0 - Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpSolar; // albedo rather than absorptivity
+			SoilPropsTimeStep = 0; // moisture was just reset, so update it on this call as well
 		}
 		// DJS July 2007
 
@@ -377,7 +380,12 @@ namespace EcoRoofManager {
 
 		// If current surface is = FirstEcoSurf then for this time step we need to update the soil moisture
 		if ( SurfNum == FirstEcoSurf ) {
-			UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag, unit, Tg, Tf, Qsoil );
+			// The outside heat balance calls this routine on every surface iteration, but the moisture balance
+			// integrates over a full zone time step and so must only advance once per time step
+			if ( SoilPropsTimeStep != SimTimeSteps ) {
+				UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag, unit, Tg, Tf, Qsoil );
+				SoilPropsTimeStep = SimTimeSteps;
+			}
 
 			Ta = OutDryBulbTempAt( Surface( SurfNum ).Centroid.z ); // temperature outdoor - Surface is dry, use normal correlation
 			Tg = Tgold;
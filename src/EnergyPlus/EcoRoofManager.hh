@@ -29,6 +29,7 @@ namespace EcoRoofManager {
 	extern Real64 Tfold; // leaf temperature from the previous time step
 	extern Real64 Tgold; // ground temperature from the previous time step
 	extern bool EcoRoofbeginFlag;
+	extern int SoilPropsTimeStep; // SimTimeSteps value of the last soil moisture update (0 forces an update)
 
 	// Functions
 
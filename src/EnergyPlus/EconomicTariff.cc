@@ -243,6 +243,7 @@ namespace EconomicTariff {
 	int sizeStack( 0 );
 
 	//MODULE VARIABLE DECLARATIONS:
+	Array1D_int gatherTariff; // tariff that gathers the timestep values used by each tariff
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -271,7 +272,7 @@ namespace EconomicTariff {
 		// SUBROUTINE INFORMATION:
 		//    AUTHOR         Jason Glazer of GARD Analytics, Inc.
 		//    DATE WRITTEN   September 2003
-		//    MODIFIED       na
+		//    MODIFIED       Oct 2026, find the tariffs that can share gathered values
 		//    RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -323,6 +324,7 @@ namespace EconomicTariff {
 				GetInputEconomicsVariable( ErrorsFound );
 				GetInputEconomicsComputation( ErrorsFound );
 				CreateDefaultComputation();
+				setGatherTariffs();
 			}
 			GetInput = false;
 			if ( ErrorsFound ) ShowFatalError( "UpdateUtilityBills: Preceding errors cause termination." );
@@ -2977,13 +2979,52 @@ namespace EconomicTariff {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	setGatherTariffs()
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   Oct 2026
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Find the tariff that gathers the timestep values for
+		//   each tariff.
+
+		// METHODOLOGY EMPLOYED:
+		//   Tariffs on the same meter with the same conversion
+		//   factors, demand window and schedules gather the same
+		//   values, so only the first of them gathers and the
+		//   others are given its values before the computation
+		//   (see copySharedGathers).
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iTariff;
+		int jTariff;
+
+		gatherTariff.allocate( numTariff );
+		for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+			auto const & curTariff( tariff( iTariff ) );
+			gatherTariff( iTariff ) = iTariff;
+			for ( jTariff = 1; jTariff < iTariff; ++jTariff ) {
+				if ( gatherTariff( jTariff ) != jTariff ) continue;
+				auto const & sameTariff( tariff( jTariff ) );
+				if ( ( curTariff.reportMeterIndx == sameTariff.reportMeterIndx ) && ( curTariff.energyConv == sameTariff.energyConv ) && ( curTariff.demandConv == sameTariff.demandConv ) && ( curTariff.demWinTime == sameTariff.demWinTime ) && ( curTariff.seasonSchIndex == sameTariff.seasonSchIndex ) && ( curTariff.periodSchIndex == sameTariff.periodSchIndex ) && ( curTariff.monthSchIndex == sameTariff.monthSchIndex ) && ( curTariff.chargeSchIndex == sameTariff.chargeSchIndex ) && ( curTariff.baseUseSchIndex == sameTariff.baseUseSchIndex ) ) {
+					gatherTariff( iTariff ) = jTariff;
+					break;
+				}
+			}
+		}
+	}
+
 	void
 	GatherForEconomics()
 	{
 		// SUBROUTINE INFORMATION:
 		//    AUTHOR         Jason Glazer of GARD Analytics, Inc.
 		//    DATE WRITTEN   June 2004
-		//    MODIFIED       na
+		//    MODIFIED       Oct 2026, tariffs with the same inputs gather once
 		//    RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2992,6 +3033,8 @@ namespace EconomicTariff {
 		//   calculation.
 
 		// METHODOLOGY EMPLOYED:
+		//   Only the tariffs that gather for themselves (see
+		//   setGatherTariffs) are updated.
 
 		// REFERENCES:
 		// na
@@ -3021,6 +3064,7 @@ namespace EconomicTariff {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int iTariff;
+		int jTariff;
 		Real64 curInstantValue;
 		Real64 curDemand;
 		Real64 curEnergy;
@@ -3035,6 +3079,7 @@ namespace EconomicTariff {
 
 		if ( numTariff >= 1 ) {
 			for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+				if ( gatherTariff( iTariff ) != iTariff ) continue; // gathered by an earlier tariff
 				isGood = false;
 				//if the meter is defined get the value
 				if ( tariff( iTariff ).reportMeterIndx != 0 ) {
@@ -3082,8 +3127,11 @@ namespace EconomicTariff {
 							tariff( iTariff ).gatherDemand( curMonth, curPeriod ) = curDemand;
 						}
 					} else {
-						ShowWarningError( "UtilityCost:Tariff: While gathering for: " + tariff( iTariff ).tariffName );
-						ShowContinueError( "Invalid schedule values - outside of range" );
+						for ( jTariff = iTariff; jTariff <= numTariff; ++jTariff ) {
+							if ( gatherTariff( jTariff ) != iTariff ) continue;
+							ShowWarningError( "UtilityCost:Tariff: While gathering for: " + tariff( jTariff ).tariffName );
+							ShowContinueError( "Invalid schedule values - outside of range" );
+						}
 					}
 					// Real Time Pricing
 					if ( tariff( iTariff ).chargeSchIndex != 0 ) {
@@ -3118,6 +3166,39 @@ namespace EconomicTariff {
 		}
 	}
 
+	void
+	copySharedGathers()
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   Oct 2026
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Give the tariffs that did not gather for themselves
+		//   the values gathered by the tariff they share them with.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iTariff;
+
+		for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+			if ( gatherTariff( iTariff ) == iTariff ) continue;
+			auto & curTariff( tariff( iTariff ) );
+			auto const & gathered( tariff( gatherTariff( iTariff ) ) );
+			curTariff.gatherEnergy = gathered.gatherEnergy;
+			curTariff.gatherDemand = gathered.gatherDemand;
+			curTariff.collectTime = gathered.collectTime;
+			curTariff.collectEnergy = gathered.collectEnergy;
+			curTariff.RTPcost = gathered.RTPcost;
+			curTariff.RTPaboveBaseCost = gathered.RTPaboveBaseCost;
+			curTariff.RTPbelowBaseCost = gathered.RTPbelowBaseCost;
+			curTariff.RTPaboveBaseEnergy = gathered.RTPaboveBaseEnergy;
+			curTariff.RTPbelowBaseEnergy = gathered.RTPbelowBaseEnergy;
+			curTariff.seasonForMonth = gathered.seasonForMonth;
+		}
+	}
+
 	bool
 	isWithinRange(
 		int const testVal,
@@ -3183,7 +3264,7 @@ namespace EconomicTariff {
 		// SUBROUTINE INFORMATION:
 		//    AUTHOR         Jason Glazer of GARD Analytics, Inc.
 		//    DATE WRITTEN   July 2004
-		//    MODIFIED       na
+		//    MODIFIED       Oct 2026, copy shared gathered values first
 		//    RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3244,6 +3325,7 @@ namespace EconomicTariff {
 		}
 		if ( numTariff >= 1 ) {
 			WriteTabularFiles = true;
+			copySharedGathers();
 			setNativeVariables();
 			for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
 				for ( jStep = computation( iTariff ).firstStep; jStep <= computation( iTariff ).lastStep; ++jStep ) {
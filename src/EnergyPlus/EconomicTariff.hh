@@ -211,6 +211,7 @@ namespace EconomicTariff {
 	extern int sizeStack;
 
 	//MODULE VARIABLE DECLARATIONS:
+	extern Array1D_int gatherTariff; // tariff that gathers the timestep values used by each tariff
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -1098,9 +1099,15 @@ namespace EconomicTariff {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	setGatherTariffs();
+
 	void
 	GatherForEconomics();
 
+	void
+	copySharedGathers();
+
 	bool
 	isWithinRange(
 		int const testVal,
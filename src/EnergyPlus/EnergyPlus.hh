@@ -12,6 +12,15 @@
 // UNUSED( foo );
 #define EP_UNUSED( expr )
 
+// Storage class for the function-local static scratch arrays of routines that may run on several
+// threads at once: each thread then has its own arrays.  Such a static is allocated once per thread
+// instead of on every call, and is re-sized with dimension() only when the size it needs changes.
+#ifdef _OPENMP
+#define EP_THREAD_LOCAL thread_local
+#else
+#define EP_THREAD_LOCAL
+#endif
+
 // ObjexxFCL
 namespace ObjexxFCL {
 namespace fmt {
@@ -341,6 +341,83 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cMinimalShadowing, cEnvValue );
 	if ( ! cEnvValue.empty() ) lMinimalShadowing = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cShadingCacheFolder, cEnvValue );
+	if ( ! cEnvValue.empty() ) ShadingCacheFolder = cEnvValue; // Folder for cached shading results
+
+	get_environment_variable( cZoneInsideSurfConvergence, cEnvValue );
+	if ( ! cEnvValue.empty() ) ZoneInsideSurfConvergence = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cHAMTDirectCellSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) HAMTDirectCellSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGroundDomainLineSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) GroundDomainLineSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cBuriedPipeImplicitSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) BuriedPipeImplicitSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGLHEMultiLevelAggregation, cEnvValue );
+	if ( ! cEnvValue.empty() ) GLHEMultiLevelAggregation = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cParallelFMUImport, cEnvValue );
+	if ( ! cEnvValue.empty() ) ParallelFMUImport = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cBCVTBBinaryExchange, cEnvValue );
+	if ( ! cEnvValue.empty() ) BCVTBBinaryExchange = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cBCVTBPipelinedExchange, cEnvValue );
+	if ( ! cEnvValue.empty() ) BCVTBPipelinedExchange = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cProfileTimings, cEnvValue );
+	if ( ! cEnvValue.empty() ) ProfileTimings = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cMemoryBudget, cEnvValue );
+	if ( ! cEnvValue.empty() ) { // Megabytes
+		bool BudgetError( false );
+		Real64 const Budget( InputProcessor::ProcessNumber( cEnvValue, BudgetError ) );
+		if ( ! BudgetError && Budget > 0.0 ) MemoryBudget = Budget;
+	}
+
+	get_environment_variable( cCTFCacheFolder, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFCacheFolder = cEnvValue; // Folder for cached CTFs
+
+	get_environment_variable( cGFunctionCacheFolder, cEnvValue );
+	if ( ! cEnvValue.empty() ) GFunctionCacheFolder = cEnvValue; // Folder for cached g-functions
+
+	get_environment_variable( cDElightCacheFolder, cEnvValue );
+	if ( ! cEnvValue.empty() ) DElightCacheFolder = cEnvValue; // Folder for cached DElight daylight factors
+
+	get_environment_variable( cIDDCacheFolder, cEnvValue );
+	if ( ! cEnvValue.empty() ) IDDCacheFolder = cEnvValue; // Folder for pre-parsed IDD snapshots
+
+	get_environment_variable( cBinaryOutput, cEnvValue );
+	if ( ! cEnvValue.empty() ) { // Yes or True, or Only to leave the values out of eplusout.eso
+		BinaryOutputOnly = ( MakeUPPERCase( cEnvValue ) == "ONLY" );
+		BinaryOutput = env_var_on( cEnvValue ) || BinaryOutputOnly;
+	}
+
+	get_environment_variable( cEioRecords, cEnvValue );
+	if ( ! cEnvValue.empty() ) { // Yes or True, or Only to leave the record classes out of eplusout.eio
+		EioRecordsOnly = ( MakeUPPERCase( cEnvValue ) == "ONLY" );
+		EioRecords = env_var_on( cEnvValue ) || EioRecordsOnly;
+	}
+
+	get_environment_variable( cEioSuppress, cEnvValue );
+	if ( ! cEnvValue.empty() ) EioSuppress = cEnvValue; // Record classes left out of eplusout.eio and eplusout.eiob
+
+	get_environment_variable( cCsvOutput, cEnvValue );
+	if ( ! cEnvValue.empty() ) { // Yes or True, or TSV for tab separated files
+		CsvOutputTabs = ( MakeUPPERCase( cEnvValue ) == "TSV" );
+		CsvOutput = env_var_on( cEnvValue ) || CsvOutputTabs;
+	}
+
+	get_environment_variable( cWriteOutputAsync, cEnvValue );
+	if ( ! cEnvValue.empty() ) WriteOutputAsync = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAsyncDisplay, cEnvValue );
+	if ( ! cEnvValue.empty() ) AsyncDisplay = env_var_on( cEnvValue ); // Yes or True
+	if ( AsyncDisplay ) StartAsyncDisplay();
+
 	get_environment_variable( cTimingFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) TimingFlag = env_var_on( cEnvValue ); // Yes or True
 
@@ -467,6 +544,26 @@ void StoreMessageCallback( void(*f)( std::string const & ) )
 	using namespace EnergyPlus::DataGlobals;
 	fMessagePtr = f;
 }
+void StoreProgressEventCallback( void(*f)( int const, int const, int const, int const ) )
+{
+	using namespace EnergyPlus::DataGlobals;
+	fProgressEventPtr = f;
+}
+void StoreReportDictionaryCallback( int(*f)( int const, int const, std::string const &, std::string const &, std::string const & ) )
+{
+	using namespace EnergyPlus::DataGlobals;
+	fReportDictionaryPtr = f;
+}
+void StoreReportTimeStampCallback( void(*f)( int const, int const, int const, int const, int const, int const, double const ) )
+{
+	using namespace EnergyPlus::DataGlobals;
+	fReportTimeStampPtr = f;
+}
+void StoreReportValueCallback( void(*f)( int const, double const ) )
+{
+	using namespace EnergyPlus::DataGlobals;
+	fReportValuePtr = f;
+}
 
 void
 CreateCurrentDateTimeString( std::string & CurrentDateTimeString )
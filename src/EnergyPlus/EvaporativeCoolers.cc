@@ -1800,7 +1800,7 @@ namespace EvaporativeCoolers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Bigusse
 		//       DATE WRITTEN   October 2014
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start the secondary air flow solutions from the previous ones
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1910,7 +1910,7 @@ namespace EvaporativeCoolers {
 			Par( 4 ) = InletDryBulbTempSec;
 			Par( 5 ) = InletWetBulbTempSec;
 			Par( 6 ) = InletHumRatioSec;
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveEvapCoolRDDSecFlow( EvapCoolNum, TempTol, MaxIte, MassFlowRateSecMin, MassFlowRateSecMax, Par, SolFla, AirMassFlowSec );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -1961,7 +1961,7 @@ namespace EvaporativeCoolers {
 			Par( 6 ) = InletHumRatioSec;
 			// get dry operation performance first
 			Par( 2 ) = double( DryModulated );
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveEvapCoolRDDSecFlow( EvapCoolNum, TempTol, MaxIte, MassFlowRateSecMin, MassFlowRateSecMax, Par, SolFla, AirMassFlowSec );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2000,7 +2000,7 @@ namespace EvaporativeCoolers {
 			EvapCoolerTotalElectricPowerDry = IndEvapCoolerPower( EvapCoolNum, DryModulated, FlowRatioSecDry );
 			// get wet operation performance
 			Par( 2 ) = double( WetModulated );
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveEvapCoolRDDSecFlow( EvapCoolNum, TempTol, MaxIte, MassFlowRateSecMin, MassFlowRateSecMax, Par, SolFla, AirMassFlowSec );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2060,7 +2060,7 @@ namespace EvaporativeCoolers {
 			Par( 4 ) = InletDryBulbTempSec;
 			Par( 5 ) = InletWetBulbTempSec;
 			Par( 6 ) = InletHumRatioSec;
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveEvapCoolRDDSecFlow( EvapCoolNum, TempTol, MaxIte, MassFlowRateSecMin, MassFlowRateSecMax, Par, SolFla, AirMassFlowSec );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2236,6 +2236,49 @@ namespace EvaporativeCoolers {
 			return Residuum;
 	}
 
+	void
+	SolveEvapCoolRDDSecFlow(
+		int const EvapCoolNum, // evaporative cooler index
+		Real64 const TempTol, // required accuracy of the outlet temperature residual [C]
+		int const MaxIte, // maximum number of iterations for SolveRegulaFalsi
+		Real64 const MassFlowRateSecMin, // minimum secondary air mass flow rate [kg/s]
+		Real64 const MassFlowRateSecMax, // design secondary air mass flow rate [kg/s]
+		Array1< Real64 > const & Par, // CalcEvapCoolRDDSecFlowResidual parameters, Par(2) is the operating mode
+		int & SolFla, // SolveRegulaFalsi exit status
+		Real64 & AirMassFlowSec // secondary air mass flow rate meeting the setpoint [kg/s]
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Indirect research special evaporative cooler part load operation: solves for the secondary
+		// air flow rate in the dry or wet modulated mode given by Par(2).
+
+		// METHODOLOGY EMPLOYED:
+		// The solution is first sought from the previous one in the same mode (SolveResidualFromGuess);
+		// regula falsi over the whole flow range is only used when that fails.  Either way the cooler
+		// is last evaluated at the returned flow rate.
+
+		// Using/Aliasing
+		using General::SolveRegulaFalsi;
+		using General::SolveResidualFromGuess;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		bool const DryMode( int( Par( 2 ) ) == DryModulated );
+		Real64 & LastSecFlow( DryMode ? EvapCond( EvapCoolNum ).DryModulatedSecFlowLast : EvapCond( EvapCoolNum ).WetModulatedSecFlowLast );
+
+		if ( SolveResidualFromGuess( CalcEvapCoolRDDSecFlowResidual, TempTol, MaxIte, LastSecFlow, 0.05 * MassFlowRateSecMax, MassFlowRateSecMin, MassFlowRateSecMax, Par, AirMassFlowSec ) ) {
+			SolFla = 1;
+		} else {
+			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+		}
+		if ( SolFla > 0 ) LastSecFlow = AirMassFlowSec;
+	}
+
 	void
 	CalcIndirectRDDEvapCoolerOutletTemp(
 		int const EvapCoolNum,
@@ -3905,7 +3948,7 @@ namespace EvaporativeCoolers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         <author>
 		//       DATE WRITTEN   <date_written>
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start the fan speed ratio solution from the previous one
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3923,6 +3966,7 @@ namespace EvaporativeCoolers {
 		using DataHVACGlobals::ZoneCompTurnFansOff;
 		using Fans::SimulateFanComponents;
 		using General::SolveRegulaFalsi;
+		using General::SolveResidualFromGuess;
 		using General::RoundSigDigits;
 
 		// Locals
@@ -3986,7 +4030,13 @@ namespace EvaporativeCoolers {
 			Par( 5 ) = ZoneCoolingLoad;
 			FanSpeedRatio = 1.0;
 
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, FanSpeedRatio, VSEvapUnitLoadResidual, 0.0, 1.0, Par );
+			// Each residual simulates the fan and coolers, so start from the previous solution of the unit
+			if ( SolveResidualFromGuess( VSEvapUnitLoadResidual, ErrorToler, MaxIte, ZoneEvapUnit( UnitNum ).VSControlFanSpeedRatio, 0.05, 0.0, 1.0, Par, FanSpeedRatio ) ) {
+				SolFla = 1;
+			} else {
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, FanSpeedRatio, VSEvapUnitLoadResidual, 0.0, 1.0, Par );
+			}
+			if ( SolFla > 0 ) ZoneEvapUnit( UnitNum ).VSControlFanSpeedRatio = FanSpeedRatio;
 			if ( SolFla == -1 ) {
 				if ( ZoneEvapUnit( UnitNum ).UnitVSControlMaxIterErrorIndex == 0 ) {
 					ShowWarningError( "Iteration limit exceeded calculating variable speed evap unit fan speed ratio, for unit=" + ZoneEvapUnit( UnitNum ).Name );
@@ -146,6 +146,8 @@ namespace EvaporativeCoolers {
 		int IterationFailed; // Used for RegulaFalsi recurring error message error -2
 		// rather than wetbulb-depression approach
 		int EvapCoolerRDDOperatingMode; // the indirect evaporative cooler Research Special operating mode variable
+		Real64 DryModulatedSecFlowLast; // last secondary air mass flow rate solved in dry modulated mode [kg/s]
+		Real64 WetModulatedSecFlowLast; // last secondary air mass flow rate solved in wet modulated mode [kg/s]
 
 		// Default Constructor
 		EvapConditions() :
@@ -235,7 +237,9 @@ namespace EvaporativeCoolers {
 			IECOperatingStatus( 0 ),
 			IterationLimit( 0 ),
 			IterationFailed( 0 ),
-			EvapCoolerRDDOperatingMode( 0 )
+			EvapCoolerRDDOperatingMode( 0 ),
+			DryModulatedSecFlowLast( 0.0 ),
+			WetModulatedSecFlowLast( 0.0 )
 		{}
 
 	};
@@ -305,6 +309,7 @@ namespace EvaporativeCoolers {
 		int UnitVSControlLimitsErrorIndex; // regula falsi errors, limits exceeded.
 		int ZonePtr; // pointer to a zone served by an evaportive cooler unit
 		int HVACSizingIndex; // index of a HVACSizing object for an evaportive cooler unit
+		Real64 VSControlFanSpeedRatio; // last fan speed ratio solved by ControlVSEvapUnitToMeetLoad
 
 		// Default Constructor
 		ZoneEvapCoolerUnitStruct() :
@@ -361,7 +366,8 @@ namespace EvaporativeCoolers {
 			UnitVSControlMaxIterErrorIndex( 0 ),
 			UnitVSControlLimitsErrorIndex( 0 ),
 			ZonePtr( 0 ),
-			HVACSizingIndex( 0 )
+			HVACSizingIndex( 0 ),
+			VSControlFanSpeedRatio( 0.0 )
 		{}
 
 	};
@@ -470,6 +476,18 @@ namespace EvaporativeCoolers {
 		Array1< Real64 > const & Par //Par( 6 ) is desired temperature C
 	);
 
+	void
+	SolveEvapCoolRDDSecFlow(
+		int const EvapCoolNum, // evaporative cooler index
+		Real64 const TempTol, // required accuracy of the outlet temperature residual [C]
+		int const MaxIte, // maximum number of iterations for SolveRegulaFalsi
+		Real64 const MassFlowRateSecMin, // minimum secondary air mass flow rate [kg/s]
+		Real64 const MassFlowRateSecMax, // design secondary air mass flow rate [kg/s]
+		Array1< Real64 > const & Par, // CalcEvapCoolRDDSecFlowResidual parameters, Par(2) is the operating mode
+		int & SolFla, // SolveRegulaFalsi exit status
+		Real64 & AirMassFlowSec // secondary air mass flow rate meeting the setpoint [kg/s]
+	);
+
 	Real64
 	IndEvapCoolerPower(
 		int const EvapCoolIndex, // Unit index
@@ -7,6 +7,7 @@ extern "C" {
 
 
 // C++ Headers
+#include <future>
 #include <string>
 
 // ObjexxFCL Headers
@@ -106,6 +107,8 @@ namespace ExternalInterface {
 
 	bool configuredControlPoints( false ); // True if control points have been configured
 	bool useEMS( false ); // Will be set to true if ExternalInterface writes to EMS variables or actuators
+	SocketExchangeType socketExchange; // Values of the data exchange with the BCVTB or FMU export master
+	std::future< int > pendingSocketExchange; // Exchange running while the zone time step is simulated
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ExternalInterface:
 
@@ -323,9 +326,9 @@ namespace ExternalInterface {
 				if ( socketFD >= 0 ) {
 					// Socket is open
 					if ( simulationStatus == 1 ) {
-						retVal = sendclientmessage( &socketFD, &flag1 );
+						retVal = SendFlagToSocket( flag1 );
 					} else {
-						retVal = sendclientmessage( &socketFD, &flag2 );
+						retVal = SendFlagToSocket( flag2 );
 					}
 				}
 				ShowFatalError( "Error in ExternalInterface: Check EnergyPlus *.err file." );
@@ -369,7 +372,7 @@ namespace ExternalInterface {
 		}
 
 		if ( socketFD >= 0 ) {
-			retVal = sendclientmessage( &socketFD, &FlagToWriteToSocket );
+			retVal = SendFlagToSocket( FlagToWriteToSocket );
 			// Don't close socket as this may give sometimes an IOException in Windows
 			// This problem seems to affect only Windows but not Mac
 			//     close(socketFD)
@@ -633,12 +636,19 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Thierry S. Nouidui, Michael Wetter, Wangda Zuo
 		//       DATE WRITTEN   08Aug2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, exchange through buffers bound once and step the FMUs in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This routine gets, sets and does the time integration in FMUs.
 
+		// METHODOLOGY EMPLOYED:
+		// Values are exchanged through buffers set up once per instance by BindExchangeBuffersFMUImport,
+		// which are handed straight to the fmi get and set calls.  All the exchanges are done, in order,
+		// before any FMU is stepped.  The FMUs only exchange data with EnergyPlus, so once that is done
+		// the time steps do not depend on each other and separate FMUs may be stepped in parallel when
+		// ParallelFMUImport is set.  The instances of one FMU share its library and are stepped in turn.
+
 		// Using/Aliasing
 		using RuntimeLanguageProcessor::isExternalInterfaceErlVariable;
 		using RuntimeLanguageProcessor::FindEMSVariable;
@@ -649,6 +659,8 @@ namespace ExternalInterface {
 		using DataGlobals::KindOfSim;
 		using DataGlobals::ksRunPeriodWeather;
 		using DataGlobals::emsCallFromExternalInterface;
+		using DataSystemVariables::ParallelFMUImport;
+		using DataSystemVariables::NumberFMUThreads;
 		using General::TrimSigDigits;
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -659,102 +671,68 @@ namespace ExternalInterface {
 
 		for ( i = 1; i <= NumFMUObjects; ++i ) {
 			for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
+				auto & thisInstance( FMU( i ).Instance( j ) );
+				if ( ! thisInstance.ExchangeBuffersBound ) BindExchangeBuffersFMUImport( thisInstance );
+
 				if ( FlagReIni ) {
 					// Get from FMUs, values that will be set in EnergyPlus (Schedule)
 					for ( k = 1; k <= FMUTemp( i ).Instance( j ).NumOutputVariablesSchedule; ++k ) {
-						FMU( i ).Instance( j ).fmuOutputVariableSchedule( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableSchedule( k ).RealVarValue;
+						thisInstance.fmuOutputVariableSchedule( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableSchedule( k ).RealVarValue;
 					}
 
 					// Get from FMUs, values that will be set in EnergyPlus (Variable)
 					for ( k = 1; k <= FMUTemp( i ).Instance( j ).NumOutputVariablesVariable; ++k ) {
-						FMU( i ).Instance( j ).fmuOutputVariableVariable( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableVariable( k ).RealVarValue;
+						thisInstance.fmuOutputVariableVariable( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableVariable( k ).RealVarValue;
 					}
 
 					// Get from FMUs, values that will be set in EnergyPlus (Actuator)
 					for ( k = 1; k <= FMUTemp( i ).Instance( j ).NumOutputVariablesActuator; ++k ) {
-						FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue;
+						thisInstance.fmuOutputVariableActuator( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue;
 					}
 				} else {
 					// Get from FMUs, values that will be set in EnergyPlus (Schedule)
-
-					if ( size( FMU(i).Instance(j).fmuOutputVariableSchedule ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec;
-						std::vector<Real64> realVarValueVec;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							valueReferenceVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference );
-							realVarValueVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec[0], &realVarValueVec[0], &FMU( i ).Instance( j ).NumOutputVariablesSchedule, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference = valueReferenceVec[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue = realVarValueVec[x-1];
+					if ( ! thisInstance.fmuOutputScheduleRefs.empty() ) {
+						thisInstance.fmistatus = fmiEPlusGetReal( &thisInstance.fmicomponent, thisInstance.fmuOutputScheduleRefs.data(), thisInstance.fmuOutputScheduleValues.data(), &thisInstance.NumOutputVariablesSchedule, &thisInstance.Index );
+						for ( k = 1; k <= thisInstance.NumOutputVariablesSchedule; ++k ) {
+							thisInstance.fmuOutputVariableSchedule( k ).RealVarValue = thisInstance.fmuOutputScheduleValues[ k - 1 ];
 						}
 
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+						if ( thisInstance.fmistatus != fmiOK ) {
 							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+							ShowContinueError( "in instance \"" + thisInstance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+							ShowContinueError( "Error Code = \"" + TrimSigDigits( thisInstance.fmistatus ) + "\"" );
 							ErrorsFound = true;
 							StopExternalInterfaceIfError();
 						}
-
 					}
 
-					// generate vectors here first
-					if ( size(FMU(i).Instance(j).fmuOutputVariableVariable) > 0 ) {
-
-						std::vector<unsigned int> valueReferenceVec2;
-						std::vector<Real64> realVarValueVec2;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							valueReferenceVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference );
-							realVarValueVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec2[0], &realVarValueVec2[0], &FMU( i ).Instance( j ).NumOutputVariablesVariable, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference = valueReferenceVec2[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue = realVarValueVec2[x-1];
+					// Get from FMUs, values that will be set in EnergyPlus (Variable)
+					if ( ! thisInstance.fmuOutputVariableRefs.empty() ) {
+						thisInstance.fmistatus = fmiEPlusGetReal( &thisInstance.fmicomponent, thisInstance.fmuOutputVariableRefs.data(), thisInstance.fmuOutputVariableValues.data(), &thisInstance.NumOutputVariablesVariable, &thisInstance.Index );
+						for ( k = 1; k <= thisInstance.NumOutputVariablesVariable; ++k ) {
+							thisInstance.fmuOutputVariableVariable( k ).RealVarValue = thisInstance.fmuOutputVariableValues[ k - 1 ];
 						}
 
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+						if ( thisInstance.fmistatus != fmiOK ) {
 							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+							ShowContinueError( "in instance \"" + thisInstance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+							ShowContinueError( "Error Code = \"" + TrimSigDigits( thisInstance.fmistatus ) + "\"" );
 							ErrorsFound = true;
 							StopExternalInterfaceIfError();
 						}
-
 					}
 
-					if ( size( FMU( i ).Instance( j ).fmuOutputVariableActuator ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec3;
-						std::vector<Real64> realVarValueVec3;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							valueReferenceVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference );
-							realVarValueVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec3[0], &realVarValueVec3[0], &FMU( i ).Instance( j ).NumOutputVariablesActuator, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference = valueReferenceVec3[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue = realVarValueVec3[x-1];
+					// Get from FMUs, values that will be set in EnergyPlus (Actuator)
+					if ( ! thisInstance.fmuOutputActuatorRefs.empty() ) {
+						thisInstance.fmistatus = fmiEPlusGetReal( &thisInstance.fmicomponent, thisInstance.fmuOutputActuatorRefs.data(), thisInstance.fmuOutputActuatorValues.data(), &thisInstance.NumOutputVariablesActuator, &thisInstance.Index );
+						for ( k = 1; k <= thisInstance.NumOutputVariablesActuator; ++k ) {
+							thisInstance.fmuOutputVariableActuator( k ).RealVarValue = thisInstance.fmuOutputActuatorValues[ k - 1 ];
 						}
 
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+						if ( thisInstance.fmistatus != fmiOK ) {
 							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+							ShowContinueError( "in instance \"" + thisInstance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+							ShowContinueError( "Error Code = \"" + TrimSigDigits( thisInstance.fmistatus ) + "\"" );
 							ErrorsFound = true;
 							StopExternalInterfaceIfError();
 						}
@@ -762,60 +740,69 @@ namespace ExternalInterface {
 				}
 
 				// Set in EnergyPlus the values of the schedules
-				for ( k = 1; k <= FMU( i ).Instance( j ).NumOutputVariablesSchedule; ++k ) {
-					ExternalInterfaceSetSchedule( FMU( i ).Instance( j ).eplusInputVariableSchedule( k ).VarIndex, FMU( i ).Instance( j ).fmuOutputVariableSchedule( k ).RealVarValue );
+				for ( k = 1; k <= thisInstance.NumOutputVariablesSchedule; ++k ) {
+					ExternalInterfaceSetSchedule( thisInstance.eplusInputVariableSchedule( k ).VarIndex, thisInstance.fmuOutputVariableSchedule( k ).RealVarValue );
 				}
 
 				// Set in EnergyPlus the values of the variables
-				for ( k = 1; k <= FMU( i ).Instance( j ).NumOutputVariablesVariable; ++k ) {
-					ExternalInterfaceSetErlVariable( FMU( i ).Instance( j ).eplusInputVariableVariable( k ).VarIndex, FMU( i ).Instance( j ).fmuOutputVariableVariable( k ).RealVarValue );
+				for ( k = 1; k <= thisInstance.NumOutputVariablesVariable; ++k ) {
+					ExternalInterfaceSetErlVariable( thisInstance.eplusInputVariableVariable( k ).VarIndex, thisInstance.fmuOutputVariableVariable( k ).RealVarValue );
 				}
 
 				// Set in EnergyPlus the values of the actuators
-				for ( k = 1; k <= FMU( i ).Instance( j ).NumOutputVariablesActuator; ++k ) {
-					ExternalInterfaceSetErlVariable( FMU( i ).Instance( j ).eplusInputVariableActuator( k ).VarIndex, FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue );
+				for ( k = 1; k <= thisInstance.NumOutputVariablesActuator; ++k ) {
+					ExternalInterfaceSetErlVariable( thisInstance.eplusInputVariableActuator( k ).VarIndex, thisInstance.fmuOutputVariableActuator( k ).RealVarValue );
 				}
 
 				if ( FirstCallGetSetDoStep ) {
 					// Get from EnergyPlus, values that will be set in fmus
-					for ( k = 1; k <= FMU( i ).Instance( j ).NumInputVariablesInIDF; ++k ) {
+					for ( k = 1; k <= thisInstance.NumInputVariablesInIDF; ++k ) {
 						//This make sure that the variables are updated at the Zone Time Step
-						FMU( i ).Instance( j ).eplusOutputVariable( k ).RTSValue = GetInternalVariableValue( FMU( i ).Instance( j ).eplusOutputVariable( k ).VarType, FMU( i ).Instance( j ).eplusOutputVariable( k ).VarIndex );
+						thisInstance.eplusOutputVariable( k ).RTSValue = GetInternalVariableValue( thisInstance.eplusOutputVariable( k ).VarType, thisInstance.eplusOutputVariable( k ).VarIndex );
 					}
 				} else {
 					// Get from EnergyPlus, values that will be set in fmus
-					for ( k = 1; k <= FMU( i ).Instance( j ).NumInputVariablesInIDF; ++k ) {
+					for ( k = 1; k <= thisInstance.NumInputVariablesInIDF; ++k ) {
 						//This make sure that the variables are updated at the Zone Time Step
-						FMU( i ).Instance( j ).eplusOutputVariable( k ).RTSValue = GetInternalVariableValueExternalInterface( FMU( i ).Instance( j ).eplusOutputVariable( k ).VarType, FMU( i ).Instance( j ).eplusOutputVariable( k ).VarIndex );
+						if ( thisInstance.eplusOutputLastValues[ k - 1 ] != nullptr ) {
+							thisInstance.eplusOutputVariable( k ).RTSValue = *thisInstance.eplusOutputLastValues[ k - 1 ];
+						} else {
+							thisInstance.eplusOutputVariable( k ).RTSValue = GetInternalVariableValueExternalInterface( thisInstance.eplusOutputVariable( k ).VarType, thisInstance.eplusOutputVariable( k ).VarIndex );
+						}
 					}
 				}
 
 				if ( ! FlagReIni ) {
-
-					// generate vectors here first
-					std::vector<unsigned int> valueReferenceVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuInputVariable ); ++x ) {
-						valueReferenceVec4.push_back( FMU( i ).Instance( j ).fmuInputVariable( x ).ValueReference );
-					}
-
-					std::vector<Real64> rtsValueVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).eplusOutputVariable ); ++x ) {
-						rtsValueVec4.push_back( FMU( i ).Instance( j ).eplusOutputVariable( x ).RTSValue );
+					for ( k = 1; k <= isize( thisInstance.eplusOutputVariable ); ++k ) {
+						thisInstance.fmuInputValues[ k - 1 ] = thisInstance.eplusOutputVariable( k ).RTSValue;
 					}
 
-					FMU( i ).Instance( j ).fmistatus = fmiEPlusSetReal( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec4[0], &rtsValueVec4[0], &FMU( i ).Instance( j ).NumInputVariablesInIDF, &FMU( i ).Instance( j ).Index );
+					thisInstance.fmistatus = fmiEPlusSetReal( &thisInstance.fmicomponent, thisInstance.fmuInputRefs.data(), thisInstance.fmuInputValues.data(), &thisInstance.NumInputVariablesInIDF, &thisInstance.Index );
 
-					if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+					if ( thisInstance.fmistatus != fmiOK ) {
 						ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to set inputs" );
-						ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-						ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+						ShowContinueError( "in instance \"" + thisInstance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+						ShowContinueError( "Error Code = \"" + TrimSigDigits( thisInstance.fmistatus ) + "\"" );
 						ErrorsFound = true;
 						StopExternalInterfaceIfError();
 					}
 				}
-				int localfmitrue( fmiTrue );
-				// Call and simulate the FMUs to get values at the corresponding timestep.
-				FMU( i ).Instance( j ).fmistatus = fmiEPlusDoStep( &FMU( i ).Instance( j ).fmicomponent, &tComm, &hStep, &localfmitrue, &FMU( i ).Instance( j ).Index );
+			}
+		}
+
+		// Call and simulate the FMUs to get values at the corresponding timestep.
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberFMUThreads ) if ( ParallelFMUImport && NumFMUObjects > 1 )
+#endif
+		for ( i = 1; i <= NumFMUObjects; ++i ) {
+			int localfmitrue( fmiTrue );
+			for ( int InstanceNum = 1; InstanceNum <= FMU( i ).NumInstances; ++InstanceNum ) {
+				FMU( i ).Instance( InstanceNum ).fmistatus = fmiEPlusDoStep( &FMU( i ).Instance( InstanceNum ).fmicomponent, &tComm, &hStep, &localfmitrue, &FMU( i ).Instance( InstanceNum ).Index );
+			}
+		}
+
+		for ( i = 1; i <= NumFMUObjects; ++i ) {
+			for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
 				if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
 					ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to" );
 					ShowContinueError( "do the coSimulation with instance \"" + FMU( i ).Instance( j ).Name + "\"" );
@@ -835,6 +822,68 @@ namespace ExternalInterface {
 		FirstCallGetSetDoStep = false;
 	}
 
+	void
+	BindExchangeBuffersFMUImport( InstanceType & Instance )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine sets up the buffers an FMU instance exchanges with fmiEPlusGetReal and
+		// fmiEPlusSetReal, and binds each real or integer output variable read for the fmu to its
+		// last zone time step value, so that no lookup is needed at each time step.
+
+		// Using/Aliasing
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::IVariableTypes;
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::NumOfIVariable;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int k; // Loop counter
+
+		Instance.fmuOutputScheduleRefs.clear();
+		for ( k = 1; k <= isize( Instance.fmuOutputVariableSchedule ); ++k ) {
+			Instance.fmuOutputScheduleRefs.push_back( Instance.fmuOutputVariableSchedule( k ).ValueReference );
+		}
+		Instance.fmuOutputScheduleValues.assign( Instance.fmuOutputScheduleRefs.size(), 0.0 );
+
+		Instance.fmuOutputVariableRefs.clear();
+		for ( k = 1; k <= isize( Instance.fmuOutputVariableVariable ); ++k ) {
+			Instance.fmuOutputVariableRefs.push_back( Instance.fmuOutputVariableVariable( k ).ValueReference );
+		}
+		Instance.fmuOutputVariableValues.assign( Instance.fmuOutputVariableRefs.size(), 0.0 );
+
+		Instance.fmuOutputActuatorRefs.clear();
+		for ( k = 1; k <= isize( Instance.fmuOutputVariableActuator ); ++k ) {
+			Instance.fmuOutputActuatorRefs.push_back( Instance.fmuOutputVariableActuator( k ).ValueReference );
+		}
+		Instance.fmuOutputActuatorValues.assign( Instance.fmuOutputActuatorRefs.size(), 0.0 );
+
+		Instance.fmuInputRefs.clear();
+		for ( k = 1; k <= isize( Instance.fmuInputVariable ); ++k ) {
+			Instance.fmuInputRefs.push_back( Instance.fmuInputVariable( k ).ValueReference );
+		}
+		Instance.fmuInputValues.assign( isize( Instance.eplusOutputVariable ), 0.0 );
+
+		// meters and schedules keep going through GetInternalVariableValueExternalInterface
+		Instance.eplusOutputLastValues.assign( isize( Instance.eplusOutputVariable ), nullptr );
+		for ( k = 1; k <= isize( Instance.eplusOutputVariable ); ++k ) {
+			int const VarType( Instance.eplusOutputVariable( k ).VarType );
+			int const VarIndex( Instance.eplusOutputVariable( k ).VarIndex );
+			if ( VarType == 1 && VarIndex >= 1 && VarIndex <= NumOfIVariable ) { // Integer
+				Instance.eplusOutputLastValues[ k - 1 ] = &IVariableTypes( VarIndex ).VarPtr().EITSValue;
+			} else if ( VarType == 2 && VarIndex >= 1 && VarIndex <= NumOfRVariable ) { // REAL(r64)
+				Instance.eplusOutputLastValues[ k - 1 ] = &RVariableTypes( VarIndex ).VarPtr().EITSValue;
+			}
+		}
+
+		Instance.ExchangeBuffersBound = true;
+	}
+
 	void
 	InstantiateInitializeFMUImport()
 	{
@@ -1967,13 +2016,20 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   2Dec2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, pipelined and binary exchange with the BCVTB server
 		//       RE-ENGINEERED  na
 
+		// METHODOLOGY EMPLOYED:
+		// With BCVTBPipelinedExchange, the exchange with the BCVTB server runs on a worker thread
+		// while the zone time step is simulated.  The values it receives are assigned at the next
+		// call, so they are applied one zone time step later than with the blocking exchange.
+		// The first exchange of the run period is blocking, so the inputs are set from the start.
+
 		// Using/Aliasing
 		using DataGlobals::SimTimeSteps;
 		using DataGlobals::MinutesPerTimeStep;
 		using DataGlobals::emsCallFromExternalInterface;
+		using DataSystemVariables::BCVTBPipelinedExchange;
 		using ScheduleManager::ExternalInterfaceSetSchedule;
 		using RuntimeLanguageProcessor::ExternalInterfaceSetErlVariable;
 		using EMSManager::ManageEMS;
@@ -1982,20 +2038,14 @@ namespace ExternalInterface {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		int const nDblMax( 1024 ); // Maximum number of doubles
-		
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int i; // Loop counter
 		int retVal; // Return value from socket
-
-		int flaWri; // flag to write to the socket
-		int flaRea; // flag read from the socket
-		int nDblWri; // number of doubles to write to socket
-		int nDblRea; // number of doubles to read from socket
-		Real64 curSimTim; // current simulation time
 		Real64 preSimTim; // previous time step's simulation time
+		bool haveExchanged; // Flag, true if values have been received in this call
+		bool pipelined; // Flag, true if the exchange runs on a worker thread
 
-		Array1D< Real64 > dblValWri( nDblMax );
-		Array1D< Real64 > dblValRea( nDblMax );
 		std::string retValCha;
 		bool continueSimulation; // Flag, true if simulation should continue
 		static bool firstCall( true );
@@ -2008,9 +2058,12 @@ namespace ExternalInterface {
 			DisplayString( "ExternalInterface starts first data exchange." );
 			simulationStatus = 2;
 			preSimTim = 0; // In the first call, E+ did not reset SimTimeSteps to zero
+			socketExchange.dblValWri.resize( nDblMax );
+			socketExchange.dblValRea.resize( nDblMax );
 		} else {
 			preSimTim = SimTimeSteps * MinutesPerTimeStep * 60.0;
 		}
+		pipelined = BCVTBPipelinedExchange && haveExternalInterfaceBCVTB;
 
 		// Socket asked to terminate simulation, but simulation continues
 		if ( noMoreValues && showContinuationWithoutUpdate ) {
@@ -2022,78 +2075,94 @@ namespace ExternalInterface {
 
 		// Usual branch, control is configured and simulation should continue
 		if ( configuredControlPoints && ( ! noMoreValues ) ) {
-			// Data to be exchanged
-			nDblWri = size( varTypes );
-			nDblRea = 0;
-			flaWri = 0;
+			// Wait for the exchange that was started in the previous call
+			retVal = 0;
+			haveExchanged = false;
+			if ( pendingSocketExchange.valid() ) {
+				retVal = pendingSocketExchange.get();
+				haveExchanged = true;
+			}
 
 			// Get EnergyPlus variables
+			// The values must not be changed while an exchange is running
+			socketExchange.nDblWri = size( varTypes );
+			socketExchange.flaWri = 0;
 			if ( firstCall ) { // bug fix causing external interface to send zero at the beginning of sim, Thierry Nouidui
-				for ( i = 1; i <= nDblWri; ++i ) {
-					dblValWri( i ) = GetInternalVariableValue( varTypes( i ), keyVarIndexes( i ) );
+				for ( i = 1; i <= socketExchange.nDblWri; ++i ) {
+					socketExchange.dblValWri[ i - 1 ] = GetInternalVariableValue( varTypes( i ), keyVarIndexes( i ) );
 				}
 			} else {
-				for ( i = 1; i <= nDblWri; ++i ) {
-					dblValWri( i ) = GetInternalVariableValueExternalInterface( varTypes( i ), keyVarIndexes( i ) );
+				for ( i = 1; i <= socketExchange.nDblWri; ++i ) {
+					socketExchange.dblValWri[ i - 1 ] = GetInternalVariableValueExternalInterface( varTypes( i ), keyVarIndexes( i ) );
 				}
 			}
 
-			// Exchange data with socket
-			retVal = 0;
-			flaRea = 0;
-			if ( haveExternalInterfaceBCVTB ) {
-				retVal = exchangedoubleswithsocket( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_ );
-			} else if ( haveExternalInterfaceFMUExport ) {
-				retVal = exchangedoubleswithsocketFMU( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_, &FMUExportActivate );
+			// Exchange data with socket, unless the exchange runs while the time step is simulated
+			if ( firstCall || ! pipelined ) {
+				socketExchange.simTimWri = preSimTim;
+				retVal = ExchangeDoublesWithSocket( socketExchange );
+				haveExchanged = true;
 			}
-			continueSimulation = true;
-
-			// Check for errors, in which case we terminate the simulation loop
-			// Added a check since the FMUExport is terminated with the flaRea set to 1.
-			if ( haveExternalInterfaceBCVTB || ( haveExternalInterfaceFMUExport && ( flaRea == 0 ) ) ) {
-				if ( retVal != 0 ) {
-					continueSimulation = false;
-					gio::write( retValCha, Format_1000 ) << retVal;
-					ShowSevereError( "ExternalInterface: Socket communication received error value \"" + retValCha + "\" at time = " + TrimSigDigits( preSimTim / 3600, 2 ) + " hours." );
+
+			if ( haveExchanged ) {
+				int const flaRea( socketExchange.flaRea );
+				int const nDblRea( socketExchange.nDblRea );
+				Real64 const exchangeSimTim( socketExchange.simTimWri );
+				continueSimulation = true;
+
+				// Check for errors, in which case we terminate the simulation loop
+				// Added a check since the FMUExport is terminated with the flaRea set to 1.
+				if ( haveExternalInterfaceBCVTB || ( haveExternalInterfaceFMUExport && ( flaRea == 0 ) ) ) {
+					if ( retVal != 0 ) {
+						continueSimulation = false;
+						gio::write( retValCha, Format_1000 ) << retVal;
+						ShowSevereError( "ExternalInterface: Socket communication received error value \"" + retValCha + "\" at time = " + TrimSigDigits( exchangeSimTim / 3600, 2 ) + " hours." );
+						gio::write( retValCha, Format_1000 ) << flaRea;
+						ShowContinueError( "ExternalInterface: Flag from server \"" + retValCha + "\"." );
+						ErrorsFound = true;
+						StopExternalInterfaceIfError();
+					}
+				}
+
+				// Check communication flag
+				if ( flaRea != 0 ) {
+					// No more values will be received in future steps
+					// Added a check since the FMUExport  is terminated with the flaRea set to 1.
+					noMoreValues = true;
 					gio::write( retValCha, Format_1000 ) << flaRea;
-					ShowContinueError( "ExternalInterface: Flag from server \"" + retValCha + "\"." );
-					ErrorsFound = true;
-					StopExternalInterfaceIfError();
+					if ( haveExternalInterfaceBCVTB ) {
+						ShowSevereError( "ExternalInterface: Received end of simulation flag at time = " + TrimSigDigits( exchangeSimTim / 3600, 2 ) + " hours." );
+						StopExternalInterfaceIfError();
+					}
 				}
-			}
 
-			// Check communication flag
-			if ( flaRea != 0 ) {
-				// No more values will be received in future steps
-				// Added a check since the FMUExport  is terminated with the flaRea set to 1.
-				noMoreValues = true;
-				gio::write( retValCha, Format_1000 ) << flaRea;
-				if ( haveExternalInterfaceBCVTB ) {
-					ShowSevereError( "ExternalInterface: Received end of simulation flag at time = " + TrimSigDigits( preSimTim / 3600, 2 ) + " hours." );
+				// Make sure we get the right number of double values, unless retVal != 0
+				if ( ( flaRea == 0 ) && ( ! ErrorsFound ) && continueSimulation && ( nDblRea != isize( varInd ) ) ) {
+					ShowSevereError( "ExternalInterface: Received \"" + TrimSigDigits( nDblRea ) + "\" double values, expected \"" + TrimSigDigits( size( varInd ) ) + "\"." );
+					ErrorsFound = true;
 					StopExternalInterfaceIfError();
 				}
-			}
 
-			// Make sure we get the right number of double values, unless retVal != 0
-			if ( ( flaRea == 0 ) && ( ! ErrorsFound ) && continueSimulation && ( nDblRea != isize( varInd ) ) ) {
-				ShowSevereError( "ExternalInterface: Received \"" + TrimSigDigits( nDblRea ) + "\" double values, expected \"" + TrimSigDigits( size( varInd ) ) + "\"." );
-				ErrorsFound = true;
-				StopExternalInterfaceIfError();
-			}
-
-			// No errors found. Assign exchanged variables
-			if ( ( flaRea == 0 ) && continueSimulation ) {
-				for ( i = 1; i <= isize( varInd ); ++i ) {
-					if ( inpVarTypes( i ) == indexSchedule ) {
-						ExternalInterfaceSetSchedule( varInd( i ), dblValRea( i ) );
-					} else if ( ( inpVarTypes( i ) == indexVariable ) || ( inpVarTypes( i ) == indexActuator ) ) {
-						ExternalInterfaceSetErlVariable( varInd( i ), dblValRea( i ) );
-					} else {
-						ShowContinueError( "ExternalInterface: Error in finding the type of the input variable for EnergyPlus" );
-						ShowContinueError( "variable index: " + std::to_string( i ) + ". Variable will not be updated." );
+				// No errors found. Assign exchanged variables
+				if ( ( flaRea == 0 ) && continueSimulation ) {
+					for ( i = 1; i <= isize( varInd ); ++i ) {
+						if ( inpVarTypes( i ) == indexSchedule ) {
+							ExternalInterfaceSetSchedule( varInd( i ), socketExchange.dblValRea[ i - 1 ] );
+						} else if ( ( inpVarTypes( i ) == indexVariable ) || ( inpVarTypes( i ) == indexActuator ) ) {
+							ExternalInterfaceSetErlVariable( varInd( i ), socketExchange.dblValRea[ i - 1 ] );
+						} else {
+							ShowContinueError( "ExternalInterface: Error in finding the type of the input variable for EnergyPlus" );
+							ShowContinueError( "variable index: " + std::to_string( i ) + ". Variable will not be updated." );
+						}
 					}
 				}
 			}
+
+			// Start the exchange of this time step; its values are assigned in the next call
+			if ( pipelined && ! firstCall && ! noMoreValues ) {
+				socketExchange.simTimWri = preSimTim;
+				pendingSocketExchange = std::async( std::launch::async, ExchangeDoublesWithSocket, std::ref( socketExchange ) );
+			}
 		}
 
 		// If we have Erl variables, we need to call ManageEMS so that they get updated in the Erl data structure
@@ -2105,6 +2174,84 @@ namespace ExternalInterface {
 
 	}
 
+	int
+	ExchangeDoublesWithSocket( SocketExchangeType & Exchange )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sends the values of Exchange to the BCVTB server (or FMU export master) and
+		// receives its reply.  Only touches Exchange and the socket, so it can run on a
+		// worker thread (see CalcExternalInterface).
+
+		// METHODOLOGY EMPLOYED:
+		// With BCVTBBinaryExchange, the values are sent as one binary frame instead of
+		// text, which the server needs to support.
+
+		// Using/Aliasing
+		using DataSystemVariables::BCVTBBinaryExchange;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int retVal( 0 ); // Return value from socket
+		int const nDblMax( Exchange.dblValRea.size() ); // Number of doubles that can be received
+
+		Exchange.flaRea = 0;
+		Exchange.nDblRea = 0;
+		if ( haveExternalInterfaceBCVTB ) {
+			if ( BCVTBBinaryExchange ) {
+				retVal = exchangedoubleswithsocketbinary( &socketFD, &Exchange.flaWri, &Exchange.flaRea, &Exchange.nDblWri, &Exchange.nDblRea, &nDblMax, &Exchange.simTimWri, Exchange.dblValWri.data(), &Exchange.simTimRea, Exchange.dblValRea.data() );
+			} else {
+				retVal = exchangedoubleswithsocket( &socketFD, &Exchange.flaWri, &Exchange.flaRea, &Exchange.nDblWri, &Exchange.nDblRea, &Exchange.simTimWri, Exchange.dblValWri.data(), &Exchange.simTimRea, Exchange.dblValRea.data() );
+			}
+		} else if ( haveExternalInterfaceFMUExport ) {
+			retVal = exchangedoubleswithsocketFMU( &socketFD, &Exchange.flaWri, &Exchange.flaRea, &Exchange.nDblWri, &Exchange.nDblRea, &Exchange.simTimWri, Exchange.dblValWri.data(), &Exchange.simTimRea, Exchange.dblValRea.data(), &FMUExportActivate );
+		}
+		return retVal;
+	}
+
+	void
+	FinishPendingSocketExchange()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for a pipelined exchange with the BCVTB server to finish, so that nothing
+		// else is written to the socket while it runs.  Its values are not used.
+
+		if ( pendingSocketExchange.valid() ) pendingSocketExchange.get();
+	}
+
+	int
+	SendFlagToSocket( int const FlagToWriteToSocket )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Sends a message flag to the socket, in the framing used for the data exchange.
+
+		// Using/Aliasing
+		using DataSystemVariables::BCVTBBinaryExchange;
+
+		FinishPendingSocketExchange();
+		if ( BCVTBBinaryExchange && haveExternalInterfaceBCVTB ) {
+			return sendclientmessagebinary( &socketFD, &FlagToWriteToSocket );
+		} else {
+			return sendclientmessage( &socketFD, &FlagToWriteToSocket );
+		}
+	}
+
 	void
 	GetReportVariableKey(
 		Array1S_string const varKeys, // Standard variable name
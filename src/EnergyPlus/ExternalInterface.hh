@@ -18,7 +18,9 @@ extern "C" {
 #include <UtilityRoutines.hh>
 
 // C++ Standard Library Headers
+#include <future>
 #include <string>
+#include <vector>
 
 // Objexx Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -227,6 +229,17 @@ namespace ExternalInterface {
 		Array1D< fmuOutputVariableActuatorType > fmuOutputVariableActuator;
 		// Variable Types structure for energyplus input variables from type actuator
 		Array1D< eplusInputVariableActuatorType > eplusInputVariableActuator;
+		// Exchange buffers passed straight to fmiEPlusGetReal and fmiEPlusSetReal, set up once by BindExchangeBuffersFMUImport
+		bool ExchangeBuffersBound; // true once the exchange buffers below are set up
+		std::vector< unsigned int > fmuOutputScheduleRefs; // value references of fmuOutputVariableSchedule
+		std::vector< Real64 > fmuOutputScheduleValues; // values of fmuOutputVariableSchedule got from the fmu
+		std::vector< unsigned int > fmuOutputVariableRefs; // value references of fmuOutputVariableVariable
+		std::vector< Real64 > fmuOutputVariableValues; // values of fmuOutputVariableVariable got from the fmu
+		std::vector< unsigned int > fmuOutputActuatorRefs; // value references of fmuOutputVariableActuator
+		std::vector< Real64 > fmuOutputActuatorValues; // values of fmuOutputVariableActuator got from the fmu
+		std::vector< unsigned int > fmuInputRefs; // value references of fmuInputVariable
+		std::vector< Real64 > fmuInputValues; // values of eplusOutputVariable set in the fmu
+		std::vector< Real64 const * > eplusOutputLastValues; // last zone time step value of each output variable, null for meters and schedules
 
 		// Default Constructor
 		InstanceType() :
@@ -246,7 +259,8 @@ namespace ExternalInterface {
 			LenModelID( 0 ),
 			LenModelGUID( 0 ),
 			LenWorkingFolder( 0 ),
-			LenWorkingFolder_wLib( 0 )
+			LenWorkingFolder_wLib( 0 ),
+			ExchangeBuffersBound( false )
 		{
 			//fmiStatus, Index, and arrays not initialized in default constructor
 		}
@@ -285,6 +299,29 @@ namespace ExternalInterface {
 
 	};
 
+	struct SocketExchangeType {
+
+		int flaWri; // flag to write to the socket
+		int flaRea; // flag read from the socket
+		int nDblWri; // number of doubles to write to socket
+		int nDblRea; // number of doubles to read from socket
+		Real64 simTimWri; // simulation time written to the socket
+		Real64 simTimRea; // simulation time read from the socket
+		std::vector< Real64 > dblValWri; // values written to the socket
+		std::vector< Real64 > dblValRea; // values read from the socket
+
+		// Default Constructor
+		SocketExchangeType() :
+			flaWri( 0 ),
+			flaRea( 0 ),
+			nDblWri( 0 ),
+			nDblRea( 0 ),
+			simTimWri( 0.0 ),
+			simTimRea( 0.0 )
+		{}
+
+	};
+
 	extern Array1D< FMUType > FMU; // Variable Types structure
 	extern Array1D< FMUType > FMUTemp; // Variable Types structure
 	extern Array1D< checkFMUInstanceNameType > checkInstanceName; // Variable Types structure for checking instance names
@@ -316,6 +353,8 @@ namespace ExternalInterface {
 
 	extern bool configuredControlPoints; // True if control points have been configured
 	extern bool useEMS; // Will be set to true if ExternalInterface writes to EMS variables or actuators
+	extern SocketExchangeType socketExchange; // Values of the data exchange with the BCVTB or FMU export master
+	extern std::future< int > pendingSocketExchange; // Exchange running while the zone time step is simulated
 
 	// Functions
 
@@ -334,6 +373,15 @@ namespace ExternalInterface {
 	void
 	CalcExternalInterface();
 
+	int
+	ExchangeDoublesWithSocket( SocketExchangeType & Exchange );
+
+	void
+	FinishPendingSocketExchange();
+
+	int
+	SendFlagToSocket( int const FlagToWriteToSocket );
+
 	void
 	ParseString(
 		std::string const & str,
@@ -380,6 +428,9 @@ namespace ExternalInterface {
 	void
 	GetSetVariablesAndDoStepFMUImport();
 
+	void
+	BindExchangeBuffersFMUImport( InstanceType & Instance );
+
 	void
 	VerifyExternalInterfaceObject();
 
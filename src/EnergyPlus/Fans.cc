@@ -1011,6 +1011,7 @@ namespace Fans {
 			Fan( FanNum ).FanPower = 0.0;
 			Fan( FanNum ).DeltaTemp = 0.0;
 			Fan( FanNum ).FanEnergy = 0.0;
+			Fan( FanNum ).CompModelMassFlow = 0.0;
 
 			MyEnvrnFlag( FanNum ) = false;
 		}
@@ -1330,6 +1331,7 @@ namespace Fans {
 			// Calculate combined fan system efficiency: includes fan, belt, motor, and VFD
 			// Equivalent to Fan(FanNum)%FanAirPower / Fan(FanNum)%FanPower
 			Fan( FanNum ).FanEff = Fan( FanNum ).FanWheelEff * Fan( FanNum ).BeltEff * Fan( FanNum ).MotEff * Fan( FanNum ).VFDEff;
+			Fan( FanNum ).CompModelMassFlow = 0.0; // Design values above are not a simulation result
 
 			// Report fan, belt, motor, and VFD characteristics at design condition to .eio file cpw14Sep2010
 			ReportSizingOutput( Fan( FanNum ).FanType, Fan( FanNum ).FanName, "Design Fan Airflow [m3/s]", FanVolFlow );
@@ -1993,6 +1995,7 @@ namespace Fans {
 		//       AUTHOR         Craig Wray, LBNL
 		//       DATE WRITTEN   Feb 2010
 		//       MODIFIED       Chandan Sharma, March 2011, FSEC: Added LocalTurnFansOn and LocalTurnFansOff
+		//                      Oct 2026, reuse the component results when the mass flow has not changed
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2113,107 +2116,112 @@ namespace Fans {
 		if ( ( GetCurrentScheduleValue( Fan( FanNum ).AvailSchedPtrNum ) > 0.0 || LocalTurnFansOn ) && ! LocalTurnFansOff && MassFlow > 0.0 ) {
 			//Fan is operating - calculate fan pressure rise, component efficiencies and power, and also air enthalpy rise
 
-			// Calculate fan static pressure rise using fan volumetric flow, std air density, air-handling system characteristics,
-			//   and Sherman-Wray system curve model (assumes static pressure surrounding air distribution system is zero)
-			FanVolFlow = MassFlow / RhoAir; //[m3/s at standard conditions]
-			DuctStaticPress = CurveValue( Fan( FanNum ).PressResetCurveIndex, FanVolFlow ); //Duct static pressure setpoint [Pa]
-			DeltaPressTot = CurveValue( Fan( FanNum ).PressRiseCurveIndex, FanVolFlow, DuctStaticPress ); //Fan total pressure rise [Pa]
-			FanOutletVelPress = 0.5 * RhoAir * pow_2( FanVolFlow / Fan( FanNum ).FanOutletArea ); //Fan outlet velocity pressure [Pa]
-			//Outlet velocity pressure cannot exceed total pressure rise
-			FanOutletVelPress = min( FanOutletVelPress, DeltaPressTot );
-			Fan( FanNum ).DeltaPress = DeltaPressTot - FanOutletVelPress; //Fan static pressure rise [Pa]
-
-			//    IF (Fan(FanNum)%EMSFanPressureOverrideOn) DeltaPress = Fan(FanNum)%EMSFanPressureValue
-
-			// Calculate fan static air power using volumetric flow and fan static pressure rise
-			Fan( FanNum ).FanAirPower = FanVolFlow * Fan( FanNum ).DeltaPress; //[W]
-
-			// Calculate fan wheel efficiency using fan volumetric flow, fan static pressure rise,
-			//   fan characteristics, and Wray dimensionless fan static efficiency model
-			EulerNum = ( Fan( FanNum ).DeltaPress * pow_4( Fan( FanNum ).FanWheelDia ) ) / ( RhoAir * pow_2( FanVolFlow ) ); //[-]
-			NormalizedEulerNum = std::log10( EulerNum / Fan( FanNum ).EuMaxEff );
-			if ( NormalizedEulerNum <= 0.0 ) {
-				Fan( FanNum ).FanWheelEff = CurveValue( Fan( FanNum ).PLFanEffNormCurveIndex, NormalizedEulerNum );
-			} else {
-				Fan( FanNum ).FanWheelEff = CurveValue( Fan( FanNum ).PLFanEffStallCurveIndex, NormalizedEulerNum );
-			}
-			Fan( FanNum ).FanWheelEff *= Fan( FanNum ).FanMaxEff; // [-]
-			Fan( FanNum ).FanWheelEff = max( Fan( FanNum ).FanWheelEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
-
-			// Calculate fan shaft power using fan static air power and fan static efficiency
-			Fan( FanNum ).FanShaftPower = Fan( FanNum ).FanAirPower / Fan( FanNum ).FanWheelEff; //[W]
+			// The pressure rise, component efficiencies and powers depend only on the mass flow for a given fan, so they are
+			// reused when the fan is simulated again at the flow they were last evaluated at (e.g., repeated controller calls)
+			if ( MassFlow != Fan( FanNum ).CompModelMassFlow ) {
+				// Calculate fan static pressure rise using fan volumetric flow, std air density, air-handling system characteristics,
+				//   and Sherman-Wray system curve model (assumes static pressure surrounding air distribution system is zero)
+				FanVolFlow = MassFlow / RhoAir; //[m3/s at standard conditions]
+				DuctStaticPress = CurveValue( Fan( FanNum ).PressResetCurveIndex, FanVolFlow ); //Duct static pressure setpoint [Pa]
+				DeltaPressTot = CurveValue( Fan( FanNum ).PressRiseCurveIndex, FanVolFlow, DuctStaticPress ); //Fan total pressure rise [Pa]
+				FanOutletVelPress = 0.5 * RhoAir * pow_2( FanVolFlow / Fan( FanNum ).FanOutletArea ); //Fan outlet velocity pressure [Pa]
+				//Outlet velocity pressure cannot exceed total pressure rise
+				FanOutletVelPress = min( FanOutletVelPress, DeltaPressTot );
+				Fan( FanNum ).DeltaPress = DeltaPressTot - FanOutletVelPress; //Fan static pressure rise [Pa]
+
+				//    IF (Fan(FanNum)%EMSFanPressureOverrideOn) DeltaPress = Fan(FanNum)%EMSFanPressureValue
+
+				// Calculate fan static air power using volumetric flow and fan static pressure rise
+				Fan( FanNum ).FanAirPower = FanVolFlow * Fan( FanNum ).DeltaPress; //[W]
+
+				// Calculate fan wheel efficiency using fan volumetric flow, fan static pressure rise,
+				//   fan characteristics, and Wray dimensionless fan static efficiency model
+				EulerNum = ( Fan( FanNum ).DeltaPress * pow_4( Fan( FanNum ).FanWheelDia ) ) / ( RhoAir * pow_2( FanVolFlow ) ); //[-]
+				NormalizedEulerNum = std::log10( EulerNum / Fan( FanNum ).EuMaxEff );
+				if ( NormalizedEulerNum <= 0.0 ) {
+					Fan( FanNum ).FanWheelEff = CurveValue( Fan( FanNum ).PLFanEffNormCurveIndex, NormalizedEulerNum );
+				} else {
+					Fan( FanNum ).FanWheelEff = CurveValue( Fan( FanNum ).PLFanEffStallCurveIndex, NormalizedEulerNum );
+				}
+				Fan( FanNum ).FanWheelEff *= Fan( FanNum ).FanMaxEff; // [-]
+				Fan( FanNum ).FanWheelEff = max( Fan( FanNum ).FanWheelEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
 
-			// Calculate fan shaft speed, fan torque, and motor speed using Wray dimensionless fan airflow model
-			if ( NormalizedEulerNum <= 0.0 ) {
-				FanDimFlow = CurveValue( Fan( FanNum ).DimFlowNormCurveIndex, NormalizedEulerNum ); //[-]
-			} else {
-				FanDimFlow = CurveValue( Fan( FanNum ).DimFlowStallCurveIndex, NormalizedEulerNum ); //[-]
-			}
-			FanSpdRadS = FanVolFlow / ( FanDimFlow * Fan( FanNum ).FanMaxDimFlow * pow_3( Fan( FanNum ).FanWheelDia ) ); //[rad/s]
-			Fan( FanNum ).FanTrq = Fan( FanNum ).FanShaftPower / FanSpdRadS; //[N-m]
-			Fan( FanNum ).FanSpd = FanSpdRadS * 9.549296586; //[rpm, conversion factor is 30/PI]
-			MotorSpeed = Fan( FanNum ).FanSpd * Fan( FanNum ).PulleyDiaRatio; //[rpm]
+				// Calculate fan shaft power using fan static air power and fan static efficiency
+				Fan( FanNum ).FanShaftPower = Fan( FanNum ).FanAirPower / Fan( FanNum ).FanWheelEff; //[W]
 
-			// Calculate belt part-load drive efficiency using correlations and coefficients based on ACEEE data
-			// Direct-drive is represented using curve coefficients such that "belt" max eff and PL eff = 1.0
-			FanTrqRatio = Fan( FanNum ).FanTrq / Fan( FanNum ).BeltMaxTorque; //[-]
-			if ( ( FanTrqRatio <= Fan( FanNum ).BeltTorqueTrans ) && ( Fan( FanNum ).PLBeltEffReg1CurveIndex != 0 ) ) {
-				BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg1CurveIndex, FanTrqRatio ); //[-]
-			} else {
-				if ( ( FanTrqRatio > Fan( FanNum ).BeltTorqueTrans ) && ( FanTrqRatio <= 1.0 ) && ( Fan( FanNum ).PLBeltEffReg2CurveIndex != 0 ) ) {
-					BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg2CurveIndex, FanTrqRatio ); //[-]
+				// Calculate fan shaft speed, fan torque, and motor speed using Wray dimensionless fan airflow model
+				if ( NormalizedEulerNum <= 0.0 ) {
+					FanDimFlow = CurveValue( Fan( FanNum ).DimFlowNormCurveIndex, NormalizedEulerNum ); //[-]
 				} else {
-					if ( ( FanTrqRatio > 1.0 ) && ( Fan( FanNum ).PLBeltEffReg3CurveIndex != 0 ) ) {
-						BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg3CurveIndex, FanTrqRatio ); //[-]
+					FanDimFlow = CurveValue( Fan( FanNum ).DimFlowStallCurveIndex, NormalizedEulerNum ); //[-]
+				}
+				FanSpdRadS = FanVolFlow / ( FanDimFlow * Fan( FanNum ).FanMaxDimFlow * pow_3( Fan( FanNum ).FanWheelDia ) ); //[rad/s]
+				Fan( FanNum ).FanTrq = Fan( FanNum ).FanShaftPower / FanSpdRadS; //[N-m]
+				Fan( FanNum ).FanSpd = FanSpdRadS * 9.549296586; //[rpm, conversion factor is 30/PI]
+				MotorSpeed = Fan( FanNum ).FanSpd * Fan( FanNum ).PulleyDiaRatio; //[rpm]
+
+				// Calculate belt part-load drive efficiency using correlations and coefficients based on ACEEE data
+				// Direct-drive is represented using curve coefficients such that "belt" max eff and PL eff = 1.0
+				FanTrqRatio = Fan( FanNum ).FanTrq / Fan( FanNum ).BeltMaxTorque; //[-]
+				if ( ( FanTrqRatio <= Fan( FanNum ).BeltTorqueTrans ) && ( Fan( FanNum ).PLBeltEffReg1CurveIndex != 0 ) ) {
+					BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg1CurveIndex, FanTrqRatio ); //[-]
+				} else {
+					if ( ( FanTrqRatio > Fan( FanNum ).BeltTorqueTrans ) && ( FanTrqRatio <= 1.0 ) && ( Fan( FanNum ).PLBeltEffReg2CurveIndex != 0 ) ) {
+						BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg2CurveIndex, FanTrqRatio ); //[-]
 					} else {
-						BeltPLEff = 1.0; //Direct drive or no curve specified - use constant efficiency
+						if ( ( FanTrqRatio > 1.0 ) && ( Fan( FanNum ).PLBeltEffReg3CurveIndex != 0 ) ) {
+							BeltPLEff = CurveValue( Fan( FanNum ).PLBeltEffReg3CurveIndex, FanTrqRatio ); //[-]
+						} else {
+							BeltPLEff = 1.0; //Direct drive or no curve specified - use constant efficiency
+						}
 					}
 				}
-			}
-			Fan( FanNum ).BeltEff = Fan( FanNum ).BeltMaxEff * BeltPLEff; //[-]
-			Fan( FanNum ).BeltEff = max( Fan( FanNum ).BeltEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
+				Fan( FanNum ).BeltEff = Fan( FanNum ).BeltMaxEff * BeltPLEff; //[-]
+				Fan( FanNum ).BeltEff = max( Fan( FanNum ).BeltEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
 
-			// Calculate belt input power using fan shaft power and belt efficiency
-			Fan( FanNum ).BeltInputPower = Fan( FanNum ).FanShaftPower / Fan( FanNum ).BeltEff; //[W]
+				// Calculate belt input power using fan shaft power and belt efficiency
+				Fan( FanNum ).BeltInputPower = Fan( FanNum ).FanShaftPower / Fan( FanNum ).BeltEff; //[W]
 
-			// Calculate motor part-load efficiency using correlations and coefficients based on MotorMaster+ data
-			MotorOutPwrRatio = Fan( FanNum ).BeltInputPower / Fan( FanNum ).MotorMaxOutPwr; //[-]
-			if ( Fan( FanNum ).PLMotorEffCurveIndex != 0 ) {
-				MotorPLEff = CurveValue( Fan( FanNum ).PLMotorEffCurveIndex, MotorOutPwrRatio ); //[-]
-			} else {
-				MotorPLEff = 1.0; //No curve specified - use constant efficiency
-			}
-			Fan( FanNum ).MotEff = Fan( FanNum ).MotorMaxEff * MotorPLEff; //[-]
-			Fan( FanNum ).MotEff = max( Fan( FanNum ).MotEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
+				// Calculate motor part-load efficiency using correlations and coefficients based on MotorMaster+ data
+				MotorOutPwrRatio = Fan( FanNum ).BeltInputPower / Fan( FanNum ).MotorMaxOutPwr; //[-]
+				if ( Fan( FanNum ).PLMotorEffCurveIndex != 0 ) {
+					MotorPLEff = CurveValue( Fan( FanNum ).PLMotorEffCurveIndex, MotorOutPwrRatio ); //[-]
+				} else {
+					MotorPLEff = 1.0; //No curve specified - use constant efficiency
+				}
+				Fan( FanNum ).MotEff = Fan( FanNum ).MotorMaxEff * MotorPLEff; //[-]
+				Fan( FanNum ).MotEff = max( Fan( FanNum ).MotEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
 
-			// Calculate motor input power using belt input power and motor efficiency
-			Fan( FanNum ).MotorInputPower = Fan( FanNum ).BeltInputPower / Fan( FanNum ).MotEff; //[W]
+				// Calculate motor input power using belt input power and motor efficiency
+				Fan( FanNum ).MotorInputPower = Fan( FanNum ).BeltInputPower / Fan( FanNum ).MotEff; //[W]
 
-			// Calculate VFD efficiency using correlations and coefficients based on VFD type
-			if ( ( Fan( FanNum ).VFDEffType == "SPEED" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
-				VFDSpdRatio = MotorSpeed / Fan( FanNum ).MotorMaxSpd; //[-]
-				Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDSpdRatio ); //[-]
-			} else {
-				if ( ( Fan( FanNum ).VFDEffType == "POWER" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
-					VFDOutPwrRatio = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDMaxOutPwr; //[-]
-					Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDOutPwrRatio ); //[-]
+				// Calculate VFD efficiency using correlations and coefficients based on VFD type
+				if ( ( Fan( FanNum ).VFDEffType == "SPEED" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
+					VFDSpdRatio = MotorSpeed / Fan( FanNum ).MotorMaxSpd; //[-]
+					Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDSpdRatio ); //[-]
 				} else {
-					// No curve specified - use constant efficiency
-					Fan( FanNum ).VFDMaxOutPwr = 0.0;
-					Fan( FanNum ).VFDEff = 0.97;
+					if ( ( Fan( FanNum ).VFDEffType == "POWER" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
+						VFDOutPwrRatio = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDMaxOutPwr; //[-]
+						Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDOutPwrRatio ); //[-]
+					} else {
+						// No curve specified - use constant efficiency
+						Fan( FanNum ).VFDMaxOutPwr = 0.0;
+						Fan( FanNum ).VFDEff = 0.97;
+					}
 				}
-			}
-			Fan( FanNum ).VFDEff = max( Fan( FanNum ).VFDEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
+				Fan( FanNum ).VFDEff = max( Fan( FanNum ).VFDEff, 0.01 ); //Minimum efficiency is 1% to avoid numerical errors
 
-			// Calculate VFD input power using motor input power and VFD efficiency
-			Fan( FanNum ).VFDInputPower = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDEff; //[W]
-			Fan( FanNum ).FanPower = Fan( FanNum ).VFDInputPower; //[W]
+				// Calculate VFD input power using motor input power and VFD efficiency
+				Fan( FanNum ).VFDInputPower = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDEff; //[W]
+				Fan( FanNum ).FanPower = Fan( FanNum ).VFDInputPower; //[W]
 
-			// Calculate combined fan system efficiency: includes fan, belt, motor, and VFD
-			// Equivalent to Fan(FanNum)%FanAirPower / Fan(FanNum)%FanPower
-			Fan( FanNum ).FanEff = Fan( FanNum ).FanWheelEff * Fan( FanNum ).BeltEff * Fan( FanNum ).MotEff * Fan( FanNum ).VFDEff;
+				// Calculate combined fan system efficiency: includes fan, belt, motor, and VFD
+				// Equivalent to Fan(FanNum)%FanAirPower / Fan(FanNum)%FanPower
+				Fan( FanNum ).FanEff = Fan( FanNum ).FanWheelEff * Fan( FanNum ).BeltEff * Fan( FanNum ).MotEff * Fan( FanNum ).VFDEff;
 
-			//    IF (Fan(FanNum)%EMSFanEffOverrideOn) FanEff = Fan(FanNum)%EMSFanEffValue
+				//    IF (Fan(FanNum)%EMSFanEffOverrideOn) FanEff = Fan(FanNum)%EMSFanEffValue
+				Fan( FanNum ).CompModelMassFlow = MassFlow;
+			}
 
 			// Calculate air enthalpy and temperature rise from power entering air stream from fan wheel, belt, and motor
 			// Assumes MotInAirFrac applies to belt and motor but NOT to VFD
@@ -2270,6 +2278,7 @@ namespace Fans {
 			Fan( FanNum ).VFDEff = 0.0;
 			Fan( FanNum ).VFDInputPower = 0.0;
 			Fan( FanNum ).FanEff = 0.0;
+			Fan( FanNum ).CompModelMassFlow = 0.0;
 		}
 
 	}
@@ -156,6 +156,7 @@ namespace Fans {
 		Real64 VFDEff; // VFD efficiency (electrical)
 		Real64 VFDInputPower; // VFD input power for fan being Simulated [W]
 		Real64 MaxFanPowerEncountered; // Maximum VFD input power encountered [W]
+		Real64 CompModelMassFlow; // Mass flow the component model results above were evaluated at, 0 if none [kg/s]
 		//zone exhaust fan
 		int FlowFractSchedNum; // schedule index flow rate modifier schedule
 		int AvailManagerMode; // mode for how exhaust fan should react to availability managers
@@ -254,6 +255,7 @@ namespace Fans {
 			VFDEff( 0.0 ),
 			VFDInputPower( 0.0 ),
 			MaxFanPowerEncountered( 0.0 ),
+			CompModelMassFlow( 0.0 ),
 			FlowFractSchedNum( 0 ),
 			AvailManagerMode( 0 ),
 			MinTempLimitSchedNum( 0 ),
@@ -457,6 +459,7 @@ namespace Fans {
 			VFDEff( VFDEff ),
 			VFDInputPower( VFDInputPower ),
 			MaxFanPowerEncountered( MaxFanPowerEncountered ),
+			CompModelMassFlow( 0.0 ),
 			FlowFractSchedNum( FlowFractSchedNum ),
 			AvailManagerMode( AvailManagerMode ),
 			MinTempLimitSchedNum( MinTempLimitSchedNum ),
@@ -112,7 +112,7 @@ namespace FaultsManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Tianzhen Hong
 		//       DATE WRITTEN   August 2013
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, intern the thermostat and humidistat names matched at run time
 		//       RE-ENGINEERED
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -220,6 +220,8 @@ namespace FaultsManager {
 					FaultsHumidistatOffset( jFaultyHumidistat ).Name = cAlphaArgs( 1 );
 					FaultsHumidistatOffset( jFaultyHumidistat ).FaultyHumidistatName = cAlphaArgs( 2 );
 					FaultsHumidistatOffset( jFaultyHumidistat ).FaultyHumidistatType = cAlphaArgs( 3 );
+					FaultsHumidistatOffset( jFaultyHumidistat ).NameID = InternName( cAlphaArgs( 1 ) );
+					FaultsHumidistatOffset( jFaultyHumidistat ).FaultyHumidistatNameID = InternName( cAlphaArgs( 2 ) );
 
 					if ( SameString( FaultsHumidistatOffset( jFaultyHumidistat ).FaultyHumidistatType, "ThermostatOffsetDependent" ) ) {
 					// For Humidistat Offset Type: ThermostatOffsetDependent
@@ -230,6 +232,7 @@ namespace FaultsManager {
 							ErrorsFound = true;
 						} else {
 							FaultsHumidistatOffset( jFaultyHumidistat ).FaultyThermostatName = cAlphaArgs( 6 );
+							FaultsHumidistatOffset( jFaultyHumidistat ).FaultyThermostatNameID = InternName( cAlphaArgs( 6 ) );
 						}
 
 					} else {
@@ -277,6 +280,8 @@ namespace FaultsManager {
 					FaultsThermostatOffset( jFaultyThermostat ).FaultTypeEnum = iFaultTypeEnums( i );
 					FaultsThermostatOffset( jFaultyThermostat ).Name = cAlphaArgs( 1 );
 					FaultsThermostatOffset( jFaultyThermostat ).FaultyThermostatName = cAlphaArgs( 2 );
+					FaultsThermostatOffset( jFaultyThermostat ).NameID = InternName( cAlphaArgs( 1 ) );
+					FaultsThermostatOffset( jFaultyThermostat ).FaultyThermostatNameID = InternName( cAlphaArgs( 2 ) );
 
 					// Availability schedule
 					FaultsThermostatOffset( jFaultyThermostat ).AvaiSchedule = cAlphaArgs( 3 );
@@ -426,6 +431,36 @@ namespace FaultsManager {
 
 	}
 
+	void
+	UpdateFaultsStatus()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluate the availability and severity schedules of all faults once per zone time step,
+		// so the economizer, coil and thermostat models only read Status and SeverityValue.
+
+		// METHODOLOGY EMPLOYED:
+		// Called from ManageHVAC after the begin time step EMS calling point.  The severity value is
+		// zero when the fault is not available; a blank severity schedule (pointer -1) gives 1.
+
+		// Using/Aliasing
+		using ScheduleManager::GetCurrentScheduleValue;
+
+		for ( auto * FaultArray : { &Faults, &FouledCoils, &FaultsThermostatOffset, &FaultsHumidistatOffset } ) {
+			for ( auto & Fault : *FaultArray ) {
+				Fault.Status = ( GetCurrentScheduleValue( Fault.AvaiSchedPtr ) > 0.0 );
+				Fault.SeverityValue = ( Fault.Status ? GetCurrentScheduleValue( Fault.SeveritySchedPtr ) : 0.0 );
+			}
+		}
+
+	}
+
 	// *****************************************************************************
 	//     NOTICE
 
@@ -93,7 +93,8 @@ namespace FaultsManager {
 		std::string ControllerName; // Controller name
 		int ControllerID; // Point to a controller associated with the fault
 		Real64 Offset; // offset, + means sensor reading is higher than actual value
-		bool Status; // for future use
+		bool Status; // availability schedule is on this zone time step (set by UpdateFaultsStatus)
+		Real64 SeverityValue; // severity schedule value this zone time step (set by UpdateFaultsStatus)
 		int AvaiSchedPtr;
 		int SeveritySchedPtr;
 		int FaultTypeEnum;
@@ -110,6 +111,9 @@ namespace FaultsManager {
 		std::string FaultyThermostatName; // The faulty thermostat name
 		std::string FaultyHumidistatName; // The faulty humidistat name
 		std::string FaultyHumidistatType; // The faulty humidistat type
+		int NameID; // Interned ID of Name (see InputProcessor::InternName)
+		int FaultyThermostatNameID; // Interned ID of FaultyThermostatName
+		int FaultyHumidistatNameID; // Interned ID of FaultyHumidistatName
 
 		// Default Constructor
 		FaultProperties() :
@@ -117,6 +121,7 @@ namespace FaultsManager {
 			ControllerID( 0 ),
 			Offset( 0.0 ),
 			Status( false ),
+			SeverityValue( 0.0 ),
 			AvaiSchedPtr( 0 ),
 			SeveritySchedPtr( 0 ),
 			FaultTypeEnum( 0 ),
@@ -126,7 +131,10 @@ namespace FaultsManager {
 			Rfw( 0.0 ),
 			Rfa( 0.0 ),
 			Aout( 0.0 ),
-			Aratio( 0.0 )
+			Aratio( 0.0 ),
+			NameID( 0 ),
+			FaultyThermostatNameID( 0 ),
+			FaultyHumidistatNameID( 0 )
 		{}
 
 		// Member Constructor
@@ -140,7 +148,7 @@ namespace FaultsManager {
 			std::string const & ControllerName, // Controller name
 			int const ControllerID, // Point to a controller associated with the fault
 			Real64 const Offset, // offset, + means sensor reading is higher than actual value
-			bool const Status, // for future use
+			bool const Status, // availability schedule is on this zone time step (set by UpdateFaultsStatus)
 			int const AvaiSchedPtr,
 			int const SeveritySchedPtr,
 			int const FaultTypeEnum,
@@ -166,6 +174,7 @@ namespace FaultsManager {
 			ControllerID( ControllerID ),
 			Offset( Offset ),
 			Status( Status ),
+			SeverityValue( 0.0 ),
 			AvaiSchedPtr( AvaiSchedPtr ),
 			SeveritySchedPtr( SeveritySchedPtr ),
 			FaultTypeEnum( FaultTypeEnum ),
@@ -179,7 +188,10 @@ namespace FaultsManager {
 			Aratio( Aratio ),
 			FaultyThermostatName( FaultyThermostatName ),
 			FaultyHumidistatName( FaultyHumidistatName ),
-			FaultyHumidistatType( FaultyHumidistatType )
+			FaultyHumidistatType( FaultyHumidistatType ),
+			NameID( 0 ),
+			FaultyThermostatNameID( 0 ),
+			FaultyHumidistatNameID( 0 )
 		{}
 
 	};
@@ -195,6 +207,9 @@ namespace FaultsManager {
 	void
 	CheckAndReadFaults();
 
+	void
+	UpdateFaultsStatus();
+
 	// *****************************************************************************
 	//     NOTICE
 
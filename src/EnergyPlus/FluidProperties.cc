@@ -85,6 +85,7 @@ namespace FluidProperties {
 	int const PropyleneGlycolIndex( -1 );
 	int const iRefrig( 1 );
 	int const iGlycol( 1 );
+	int const GridCellsPerPoint( 16 ); // Most grid cells per array point in a FluidPropsGridIndex
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -1875,6 +1876,8 @@ namespace FluidProperties {
 
 		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
 
+		if ( ! ErrorsFound ) InitializeFluidGridIndexes(); // Grids for the table lookups of the property routines
+
 		FluidTemps.deallocate();
 
 		Alphas.deallocate();
@@ -2817,6 +2820,95 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeFluidGridIndexes()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the grids that the glycol property routines and the superheated refrigerant
+		// routines use to find their place in the temperature and pressure tables (FindGridIndex).
+
+		// METHODOLOGY EMPLOYED:
+		// Must follow InitializeGlycolTempLimits: the glycol grids cover the valid (non-zero) data.
+		// The temperature limits of GetSpecificHeatGlycol are the whole table, as in its search.
+
+		for ( auto & glycol : GlycolData ) {
+			if ( glycol.CpDataPresent ) InitializeFluidGridIndex( glycol.CpGrid, glycol.CpTemps, 1, glycol.CpTemps.isize() );
+			if ( glycol.RhoDataPresent ) InitializeFluidGridIndex( glycol.RhoGrid, glycol.RhoTemps, glycol.RhoLowTempIndex, glycol.RhoHighTempIndex );
+			if ( glycol.CondDataPresent ) InitializeFluidGridIndex( glycol.CondGrid, glycol.CondTemps, glycol.CondLowTempIndex, glycol.CondHighTempIndex );
+			if ( glycol.ViscDataPresent ) InitializeFluidGridIndex( glycol.ViscGrid, glycol.ViscTemps, glycol.ViscLowTempIndex, glycol.ViscHighTempIndex );
+		}
+
+		for ( auto & refrig : RefrigData ) {
+			if ( refrig.NumSuperTempPts > 0 ) InitializeFluidGridIndex( refrig.SHTempGrid, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+			if ( refrig.NumSuperPressPts > 0 ) InitializeFluidGridIndex( refrig.SHPressGrid, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		}
+
+	}
+
+	void
+	InitializeFluidGridIndex(
+		FluidPropsGridIndex & Grid, // Grid to set up
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up a uniform grid over the valid values of an ascending array, for FindGridIndex.
+
+		// METHODOLOGY EMPLOYED:
+		// The grid spacing is the smallest spacing of the array values (but there are at most
+		// GridCellsPerPoint cells per value), so a grid cell usually holds at most one array value.
+		// Each cell stores the FindArrayIndex result for the start of the cell less one, which
+		// allows for roundoff in the cell number of a value near the start of a cell.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		int Cell;
+		Real64 MinStep; // Smallest spacing of the array values
+		Real64 GridStep; // Grid spacing
+
+		Grid.LowBound = LowBound;
+		Grid.UpperBound = UpperBound;
+		Grid.Index.deallocate();
+		if ( UpperBound - LowBound < 2 ) return; // One interval: nothing to search (FindGridIndex searches)
+
+		Real64 const Span( Array( UpperBound ) - Array( LowBound ) );
+		if ( ! ( Span > 0.0 ) ) return;
+		MinStep = Span;
+		for ( Loop = LowBound + 1; Loop <= UpperBound; ++Loop ) {
+			Real64 const Step( Array( Loop ) - Array( Loop - 1 ) );
+			if ( Step > 0.0 ) MinStep = min( MinStep, Step );
+		}
+		int const NumCells( static_cast< int >( min( std::ceil( Span / MinStep ), Real64( GridCellsPerPoint * ( UpperBound - LowBound + 1 ) ) ) ) );
+
+		GridStep = Span / NumCells;
+		Grid.GridLow = Array( LowBound );
+		Grid.GridStepInv = NumCells / Span;
+		Grid.Index.allocate( {0,NumCells-1} );
+		for ( Cell = 0; Cell < NumCells; ++Cell ) {
+			Real64 const CellLow( Grid.GridLow + Cell * GridStep );
+			Grid.Index( Cell ) = max( LowBound, min( FindArrayIndex( CellLow, Array, LowBound, UpperBound ), UpperBound ) - 1 );
+		}
+
+	}
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols()
 	{
@@ -4032,8 +4124,8 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindGridIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid );
+		LoPressIndex = FindGridIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressGrid );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4275,7 +4367,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindGridIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4540,7 +4632,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		TempIndex = FindGridIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid );
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - refrig.SHTemps( TempIndex ) ) / ( refrig.SHTemps( HiTempIndex ) - refrig.SHTemps( TempIndex ) );
@@ -4560,7 +4652,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		LoPressIndex = FindGridIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressGrid );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( refrig.SHPress( LoPressIndex ) );
@@ -4780,11 +4872,11 @@ namespace FluidProperties {
 			//}
 			//assert( std::is_sorted( glycol_CpTemps.begin(), glycol_CpTemps.end() ) ); // Sorted temperature array is assumed: Enable if/when arrays have begin()/end()
 			assert( glycol_CpTemps.size() <= static_cast< std::size_t >( std::numeric_limits< int >::max() ) ); // Array indexes are int now so this is future protection
-			int beg( 1 ), mid, end( glycol_CpTemps.isize() ); // 1-based indexing
+			int beg( 1 ), end( glycol_CpTemps.isize() ); // 1-based indexing
 			assert( end > 0 );
-			while ( beg + 1 < end ) {
-				mid = ( ( beg + end ) >> 1 ); // bit shifting is faster than /2
-				( Temperature > glycol_CpTemps( mid ) ? beg : end ) = mid;
+			if ( beg + 1 < end ) { // Grid lookup replaced the binary search
+				beg = FindGridIndex( Temperature, glycol_CpTemps, 1, end, glycol_data.CpGrid );
+				end = beg + 1;
 			} // Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
 			return GetInterpValue_fast( Temperature, glycol_CpTemps( beg ), glycol_CpTemps( end ), glycol_CpValues( beg ), glycol_CpValues( end ) );
 		}
@@ -4888,10 +4980,9 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).RhoHighTempIndex > GlycolData( GlycolIndex ).RhoLowTempIndex ) {
+				Loop = FindGridIndex( Temperature, GlycolData( GlycolIndex ).RhoTemps, GlycolData( GlycolIndex ).RhoLowTempIndex, GlycolData( GlycolIndex ).RhoHighTempIndex, GlycolData( GlycolIndex ).RhoGrid ) + 1;
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
-				break; // DO loop
 			}
 		}
 
@@ -5029,10 +5120,9 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).CondHighTempIndex > GlycolData( GlycolIndex ).CondLowTempIndex ) {
+				Loop = FindGridIndex( Temperature, GlycolData( GlycolIndex ).CondTemps, GlycolData( GlycolIndex ).CondLowTempIndex, GlycolData( GlycolIndex ).CondHighTempIndex, GlycolData( GlycolIndex ).CondGrid ) + 1;
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
-				break; // DO loop
 			}
 		}
 
@@ -5170,10 +5260,9 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).ViscHighTempIndex > GlycolData( GlycolIndex ).ViscLowTempIndex ) {
+				Loop = FindGridIndex( Temperature, GlycolData( GlycolIndex ).ViscTemps, GlycolData( GlycolIndex ).ViscLowTempIndex, GlycolData( GlycolIndex ).ViscHighTempIndex, GlycolData( GlycolIndex ).ViscGrid ) + 1;
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
-				break; // DO loop
 			}
 		}
 
@@ -5644,6 +5733,42 @@ namespace FluidProperties {
 		}
 	}
 
+	int
+	FindGridIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsGridIndex const & Grid // Grid into the array
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Gives the same result as FindArrayIndex (the index of the low point of the interval
+		// holding the value, zero below the data and the upper bound above it) without a search.
+
+		// METHODOLOGY EMPLOYED:
+		// The grid cell of the value gives the index directly, or the index of an interval just
+		// before it (see InitializeFluidGridIndex).  Without a grid (not set up yet, or too
+		// little data to need one) FindArrayIndex is used.
+
+		if ( Grid.Index.empty() ) return FindArrayIndex( Value, Array, LowBound, UpperBound );
+		assert( ( Grid.LowBound == LowBound ) && ( Grid.UpperBound == UpperBound ) );
+		if ( Value < Array( LowBound ) ) return 0;
+		if ( Value > Array( UpperBound ) ) return UpperBound;
+		Real64 const CellValue( ( Value - Grid.GridLow ) * Grid.GridStepInv );
+		int const LastCell( Grid.Index.u() );
+		int Index( Grid.Index( CellValue < LastCell ? static_cast< int >( CellValue ) : LastCell ) );
+		while ( ( Index + 1 < UpperBound ) && ( Array( Index + 1 ) < Value ) ) ++Index;
+		assert( Index == FindArrayIndex( Value, Array, LowBound, UpperBound ) );
+		return Index;
+	}
+
 	//*****************************************************************************
 
 	Real64
@@ -40,6 +40,7 @@ namespace FluidProperties {
 	extern int const PropyleneGlycolIndex;
 	extern int const iRefrig;
 	extern int const iGlycol;
+	extern int const GridCellsPerPoint; // Most grid cells per array point in a FluidPropsGridIndex
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -64,6 +65,25 @@ namespace FluidProperties {
 
 	// Types
 
+	struct FluidPropsGridIndex // Uniform grid over an ascending data array that points into the array
+	{
+		// Members
+		int LowBound; // Valid values lower bound
+		int UpperBound; // Valid values upper bound
+		Real64 GridLow; // Value at the start of the grid
+		Real64 GridStepInv; // Inverse of the grid spacing
+		Array1D_int Index; // Lowest interval index (as from FindArrayIndex) for a value in each grid cell
+
+		// Default Constructor
+		FluidPropsGridIndex() :
+			LowBound( 0 ),
+			UpperBound( 0 ),
+			GridLow( 0.0 ),
+			GridStepInv( 0.0 )
+		{}
+
+	};
+
 	struct FluidPropsRefrigerantData
 	{
 		// Members
@@ -121,6 +141,8 @@ namespace FluidProperties {
 		Array1D< Real64 > SHPress; // Pressures for superheated gas
 		Array2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		Array2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
+		FluidPropsGridIndex SHTempGrid; // Grid into SHTemps (set up by InitializeFluidGridIndexes)
+		FluidPropsGridIndex SHPressGrid; // Grid into SHPress (set up by InitializeFluidGridIndexes)
 
 		// Default Constructor
 		FluidPropsRefrigerantData() :
@@ -422,6 +444,10 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		Array1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		Array1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		FluidPropsGridIndex CpGrid; // Grid into CpTemps (set up by InitializeFluidGridIndexes)
+		FluidPropsGridIndex RhoGrid; // Grid into RhoTemps (set up by InitializeFluidGridIndexes)
+		FluidPropsGridIndex CondGrid; // Grid into CondTemps (set up by InitializeFluidGridIndexes)
+		FluidPropsGridIndex ViscGrid; // Grid into ViscTemps (set up by InitializeFluidGridIndexes)
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -776,6 +802,19 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeFluidGridIndexes();
+
+	void
+	InitializeFluidGridIndex(
+		FluidPropsGridIndex & Grid, // Grid to set up
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	);
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols();
 
@@ -1025,6 +1064,15 @@ namespace FluidProperties {
 		Array1D< Real64 > const & Array // Array of values in ascending order
 	);
 
+	int
+	FindGridIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsGridIndex const & Grid // Grid into the array
+	);
+
 	//*****************************************************************************
 
 	Real64
@@ -68,271 +68,6 @@ namespace General {
 
 	// Functions
 
-	void
-	SolveRegulaFalsi(
-		Real64 const Eps, // required absolute accuracy
-		int const MaxIte, // maximum number of allowed iterations
-		int & Flag, // integer storing exit status
-		Real64 & XRes, // value of x that solves f(x,Par) = 0
-		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
-		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
-	)
-	{
-
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Michael Wetter
-		//       DATE WRITTEN   March 1999
-		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Find the value of x between x0 and x1 such that f(x,Par)
-		// is equal to zero.
-
-		// METHODOLOGY EMPLOYED:
-		// Uses the Regula Falsi (false position) method (similar to secant method)
-
-		// REFERENCES:
-		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
-		// 2nd edition, 1992. Page 347 ff.
-
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// = -2: f(x0) and f(x1) have the same sign
-		// = -1: no convergence
-		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0, Par );
-		Y1 = f( X1, Par );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
-
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp, Par );
-
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
-
-	}
-
-	void
-	SolveRegulaFalsi(
-		Real64 const Eps, // required absolute accuracy
-		int const MaxIte, // maximum number of allowed iterations
-		int & Flag, // integer storing exit status
-		Real64 & XRes, // value of x that solves f(x) = 0
-		std::function< Real64( Real64 const ) > f,
-		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
-	)
-	{
-
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Michael Wetter
-		//       DATE WRITTEN   March 1999
-		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Find the value of x between x0 and x1 such that f(x)
-		// is equal to zero.
-
-		// METHODOLOGY EMPLOYED:
-		// Uses the Regula Falsi (false position) method (similar to secant method)
-
-		// REFERENCES:
-		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
-		// 2nd edition, 1992. Page 347 ff.
-
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// = -2: f(x0) and f(x1) have the same sign
-		// = -1: no convergence
-		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0 );
-		Y1 = f( X1 );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
-
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp );
-
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
-
-	}
-
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
@@ -393,7 +128,7 @@ namespace General {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   May 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, angle step as static constant and its inverse
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -419,7 +154,8 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		Real64 const DeltaAngRad( Pi / 36.0 ); // Profile angle increment (rad)
+		static Real64 const DeltaAngRad( Pi / 36.0 ); // Profile angle increment (rad)
+		static Real64 const DeltaAngRad_inv( 36.0 / Pi );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -434,8 +170,8 @@ namespace General {
 		if ( ProfAng > PiOvr2 || ProfAng < -PiOvr2 ) {
 			InterpBlind = 0.0;
 		} else {
-			IAlpha = 1 + int( ( ProfAng + PiOvr2 ) / DeltaAngRad );
-			InterpFac = ( ProfAng - ( -PiOvr2 + DeltaAngRad * ( IAlpha - 1 ) ) ) / DeltaAngRad;
+			IAlpha = 1 + int( ( ProfAng + PiOvr2 ) * DeltaAngRad_inv );
+			InterpFac = ( ProfAng - ( -PiOvr2 + DeltaAngRad * ( IAlpha - 1 ) ) ) * DeltaAngRad_inv;
 			InterpBlind = ( 1.0 - InterpFac ) * PropArray( IAlpha ) + InterpFac * PropArray( IAlpha + 1 );
 		}
 		return InterpBlind;
@@ -451,7 +187,7 @@ namespace General {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   May 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, angle step as static constant and its inverse
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -473,7 +209,8 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		Real64 const DeltaAngRad( Pi / 36.0 ); // Profile angle increment (rad)
+		static Real64 const DeltaAngRad( Pi / 36.0 ); // Profile angle increment (rad)
+		static Real64 const DeltaAngRad_inv( 36.0 / Pi );
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 InterpFac; // Interpolation factor
@@ -483,8 +220,8 @@ namespace General {
 		if ( ProfAng > PiOvr2 || ProfAng < -PiOvr2 ) {
 			InterpProfAng = 0.0;
 		} else {
-			IAlpha = 1 + int( ( ProfAng + PiOvr2 ) / DeltaAngRad );
-			InterpFac = ( ProfAng - ( -PiOvr2 + DeltaAngRad * ( IAlpha - 1 ) ) ) / DeltaAngRad;
+			IAlpha = 1 + int( ( ProfAng + PiOvr2 ) * DeltaAngRad_inv );
+			InterpFac = ( ProfAng - ( -PiOvr2 + DeltaAngRad * ( IAlpha - 1 ) ) ) * DeltaAngRad_inv;
 			InterpProfAng = ( 1.0 - InterpFac ) * PropArray( IAlpha ) + InterpFac * PropArray( IAlpha + 1 );
 		}
 		return InterpProfAng;
@@ -618,6 +355,47 @@ namespace General {
 		return InterpSlatAng;
 	}
 
+	Real64
+	InterpSlatAng(
+		Real64 const SlatAng, // Slat angle (rad)
+		bool const VarSlats, // True if slat angle is variable
+		Array1S< float > const PropArray // Array of daylight factors as function of slat angle
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Does slat-angle interpolation of the single precision daylight factors of windows with blinds
+
+		// METHODOLOGY EMPLOYED:
+		// Linear interpolation, as for the Real64 blind properties; the interpolation is done in Real64.
+
+		// REFERENCES:na
+
+		// Using/Aliasing
+		using DataGlobals::Pi;
+		using DataSurfaces::MaxSlatAngs;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static Real64 const DeltaAng( Pi / ( double( MaxSlatAngs ) - 1.0 ) );
+		static Real64 const DeltaAng_inv( ( double( MaxSlatAngs ) - 1.0 ) / Pi );
+
+		if ( VarSlats ) { // Variable-angle slats
+			Real64 const SlatAng1( min( max( SlatAng, 0.0 ), Pi ) );
+			int const IBeta( 1 + int( SlatAng1 * DeltaAng_inv ) );
+			Real64 const InterpFac( ( SlatAng1 - DeltaAng * ( IBeta - 1 ) ) * DeltaAng_inv );
+			Real64 const Prop1( PropArray( IBeta ) );
+			return Prop1 + InterpFac * ( PropArray( min( MaxSlatAngs, IBeta + 1 ) ) - Prop1 );
+		} else { // Fixed-angle slats or shade
+			return PropArray( 1 );
+		}
+	}
+
 	Real64
 	InterpProfSlatAng(
 		Real64 const ProfAng, // Profile angle (rad)
@@ -630,7 +408,7 @@ namespace General {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   Dec 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, angle steps as static constants and their inverses
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -657,8 +435,10 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		Real64 const DeltaProfAng( Pi / 36.0 );
-		Real64 const DeltaSlatAng( Pi / ( double( MaxSlatAngs ) - 1.0 ) );
+		static Real64 const DeltaProfAng( Pi / 36.0 );
+		static Real64 const DeltaProfAng_inv( 36.0 / Pi );
+		static Real64 const DeltaSlatAng( Pi / ( double( MaxSlatAngs ) - 1.0 ) );
+		static Real64 const DeltaSlatAng_inv( ( double( MaxSlatAngs ) - 1.0 ) / Pi );
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 ProfAngRatio; // Profile angle interpolation factor
@@ -687,12 +467,12 @@ namespace General {
 			ProfAng1 = ProfAng;
 		}
 
-		IAlpha = int( ( ProfAng1 + PiOvr2 ) / DeltaProfAng ) + 1;
-		ProfAngRatio = ( ProfAng1 + PiOvr2 - ( IAlpha - 1 ) * DeltaProfAng ) / DeltaProfAng;
+		IAlpha = int( ( ProfAng1 + PiOvr2 ) * DeltaProfAng_inv ) + 1;
+		ProfAngRatio = ( ProfAng1 + PiOvr2 - ( IAlpha - 1 ) * DeltaProfAng ) * DeltaProfAng_inv;
 
 		if ( VarSlats ) { // Variable-angle slats: interpolate in profile angle and slat angle
-			IBeta = int( SlatAng1 / DeltaSlatAng ) + 1;
-			SlatAngRatio = ( SlatAng1 - ( IBeta - 1 ) * DeltaSlatAng ) / DeltaSlatAng;
+			IBeta = int( SlatAng1 * DeltaSlatAng_inv ) + 1;
+			SlatAngRatio = ( SlatAng1 - ( IBeta - 1 ) * DeltaSlatAng ) * DeltaSlatAng_inv;
 			Val1 = PropArray( IBeta, IAlpha );
 			Val2 = PropArray( min( MaxSlatAngs, IBeta + 1 ), IAlpha );
 			Val3 = PropArray( IBeta, min( 37, IAlpha + 1 ) );
@@ -722,7 +502,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   Jan 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, sine of gamma evaluated once
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -767,8 +547,9 @@ namespace General {
 
 			fEdge = 0.0;
 			fEdge1 = 0.0;
-			if ( std::abs( std::sin( gamma ) ) > 0.01 ) {
-				if ( ( SlatAng > 0.0 && SlatAng <= PiOvr2 && ProfAng <= SlatAng ) || ( SlatAng > PiOvr2 && SlatAng <= Pi && ProfAng > -( Pi - SlatAng ) ) ) fEdge1 = SlatThickness * std::abs( std::sin( gamma ) ) / ( ( SlatSeparation + SlatThickness / std::abs( std::sin( SlatAng ) ) ) * CosProfAng );
+			Real64 const AbsSinGamma( std::abs( std::sin( gamma ) ) );
+			if ( AbsSinGamma > 0.01 ) {
+				if ( ( SlatAng > 0.0 && SlatAng <= PiOvr2 && ProfAng <= SlatAng ) || ( SlatAng > PiOvr2 && SlatAng <= Pi && ProfAng > -( Pi - SlatAng ) ) ) fEdge1 = SlatThickness * AbsSinGamma / ( ( SlatSeparation + SlatThickness / std::abs( std::sin( SlatAng ) ) ) * CosProfAng );
 				fEdge = min( 1.0, std::abs( fEdge1 ) );
 			}
 			BlindBeamBeamTrans *= ( 1.0 - fEdge );
@@ -833,40 +614,6 @@ namespace General {
 		return POLYF;
 	}
 
-	Real64
-	POLYF(
-		Real64 const X, // Cosine of angle of incidence
-		Array1< Real64 > const & A // Polynomial coefficients
-	)
-	{
-		// Return value
-		Real64 POLYF;
-
-		if ( X < 0.0 || X > 1.0 ) {
-			POLYF = 0.0;
-		} else {
-			POLYF = X * ( A( 1 ) + X * ( A( 2 ) + X * ( A( 3 ) + X * ( A( 4 ) + X * ( A( 5 ) + X * A( 6 ) ) ) ) ) );
-		}
-		return POLYF;
-	}
-
-	Real64
-	POLYF(
-		Real64 const X, // Cosine of angle of incidence
-		Array1S< Real64 > const & A // Polynomial coefficients
-	)
-	{
-		// Return value
-		Real64 POLYF;
-
-		if ( X < 0.0 || X > 1.0 ) {
-			POLYF = 0.0;
-		} else {
-			POLYF = X * ( A( 1 ) + X * ( A( 2 ) + X * ( A( 3 ) + X * ( A( 4 ) + X * ( A( 5 ) + X * A( 6 ) ) ) ) ) );
-		}
-		return POLYF;
-	}
-
 	Real64
 	POLY1F(
 		Real64 & X, // independent variable
@@ -2,7 +2,8 @@
 #define General_hh_INCLUDED
 
 // C++ Headers
-#include <functional>
+#include <algorithm>
+#include <cmath>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -40,28 +41,241 @@ namespace General {
 
 	// Functions
 
+	template< typename ResidualFunc >
 	void
 	SolveRegulaFalsi(
 		Real64 const Eps, // required absolute accuracy
 		int const MaxIte, // maximum number of allowed iterations
 		int & Flag, // integer storing exit status
-		Real64 & XRes, // value of x that solves f(x [,Par]) = 0
-		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
+		Real64 & XRes, // value of x that solves f(x) = 0
+		ResidualFunc && f, // f(x): function, function object or lambda
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
-	);
+		Real64 const X_1 // 2nd bound of interval that contains the solution
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Michael Wetter
+		//       DATE WRITTEN   March 1999
+		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
+		//                      Oct 2026, template on the residual function type
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the value of x between x0 and x1 such that f(x)
+		// is equal to zero.
+
+		// METHODOLOGY EMPLOYED:
+		// Uses the Regula Falsi (false position) method (similar to secant method)
+		// The residual is taken by its own type so calls are not made through std::function.
+
+		// REFERENCES:
+		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
+		// 2nd edition, 1992. Page 347 ff.
+
+		// USE STATEMENTS:
+		// na
+
+		// Argument array dimensioning
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// = -2: f(x0) and f(x1) have the same sign
+		// = -1: no convergence
+		// >  0: number of iterations performed
+		// optional
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const SMALL( 1.e-10 );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 X0; // present 1st bound
+		Real64 X1; // present 2nd bound
+		Real64 XTemp; // new estimate
+		Real64 Y0; // f at X0
+		Real64 Y1; // f at X1
+		Real64 YTemp; // f at XTemp
+		Real64 DY; // DY = Y0 - Y1
+		bool Conv; // flag, true if convergence is achieved
+		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
+		bool Cont; // flag, if true, continue searching
+		int NIte; // number of interations
+
+		X0 = X_0;
+		X1 = X_1;
+		Conv = false;
+		StopMaxIte = false;
+		Cont = true;
+		NIte = 0;
+
+		Y0 = f( X0 );
+		Y1 = f( X1 );
+		// check initial values
+		if ( Y0 * Y1 > 0 ) {
+			Flag = -2;
+			XRes = X0;
+			return;
+		}
+
+		while ( Cont ) {
+
+			DY = Y0 - Y1;
+			if ( std::abs( DY ) < SMALL ) DY = SMALL;
+			// new estimation
+			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+			YTemp = f( XTemp );
+
+			++NIte;
+
+			// check convergence
+			if ( std::abs( YTemp ) < Eps ) Conv = true;
+
+			if ( NIte > MaxIte ) StopMaxIte = true;
+
+			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
+				Cont = true;
+			} else {
+				Cont = false;
+			}
+
+			if ( Cont ) {
+
+				// reassign values (only if further iteration required)
+				if ( Y0 < 0.0 ) {
+					if ( YTemp < 0.0 ) {
+						X0 = XTemp;
+						Y0 = YTemp;
+					} else {
+						X1 = XTemp;
+						Y1 = YTemp;
+					}
+				} else {
+					if ( YTemp < 0.0 ) {
+						X1 = XTemp;
+						Y1 = YTemp;
+					} else {
+						X0 = XTemp;
+						Y0 = YTemp;
+					}
+				} // ( Y0 < 0 )
+
+			} // (Cont)
+
+		} // Cont
+
+		if ( Conv ) {
+			Flag = NIte;
+		} else {
+			Flag = -1;
+		}
+		XRes = XTemp;
 
+	}
+
+	template< typename ResidualFunc >
 	void
 	SolveRegulaFalsi(
 		Real64 const Eps, // required absolute accuracy
 		int const MaxIte, // maximum number of allowed iterations
 		int & Flag, // integer storing exit status
-		Real64 & XRes, // value of x that solves f(x) = 0
-		std::function< Real64( Real64 const ) > f,
+		Real64 & XRes, // value of x that solves f(x,Par) = 0
+		ResidualFunc && f, // f(x,Par): function, function object or lambda
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
-	);
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Michael Wetter
+		//       DATE WRITTEN   March 1999
+		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
+		//                      Oct 2026, template on the residual function type
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the value of x between x0 and x1 such that f(x,Par)
+		// is equal to zero.
+
+		// METHODOLOGY EMPLOYED:
+		// Binds Par to the residual and uses the single argument version.
+
+		SolveRegulaFalsi( Eps, MaxIte, Flag, XRes, [ &f, &Par ]( Real64 const X ) { return f( X, Par ); }, X_0, X_1 );
+
+	}
+
+	template< typename ResidualFunc >
+	bool
+	SolveResidualFromGuess(
+		ResidualFunc && f, // residual function f(x,Par)
+		Real64 const Eps, // required absolute accuracy of the residual
+		int const MaxIte, // maximum number of iterations for SolveRegulaFalsi on the small interval
+		Real64 const Guess, // previous solution, not used unless XMin < Guess <= XMax
+		Real64 const Step, // distance from Guess to the second point
+		Real64 const XMin, // lower limit of the solution
+		Real64 const XMax, // upper limit of the solution
+		Array1< Real64 > const & Par, // parameters passed on to f
+		Real64 & XRes // solution
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solves f(x) = 0 starting from a previous solution.  Returns false, leaving the solution to
+		// the caller, if the guess is not usable or no solution is found near it.
+
+		// METHODOLOGY EMPLOYED:
+		// f is evaluated at the guess and at a second point Step away, then secant steps kept within
+		// the limits follow.  As soon as two points bracket the solution, SolveRegulaFalsi finishes on
+		// that small interval.  f is last evaluated at the returned solution, so any state it sets
+		// (node conditions, component results) corresponds to it.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxSecantIte( 3 ); // Secant steps tried before giving up
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 X0; // previous point
+		Real64 Y0; // residual at X0
+		Real64 X1; // current point
+		Real64 Y1; // residual at X1
+		int SolFla; // SolveRegulaFalsi exit status
+
+		if ( Guess <= XMin || Guess > XMax || Step <= 0.0 ) return false;
+
+		X0 = Guess;
+		Y0 = f( X0, Par );
+		if ( std::abs( Y0 ) < Eps ) {
+			XRes = X0;
+			return true;
+		}
+		X1 = ( X0 + Step <= XMax ) ? X0 + Step : std::max( XMin, X0 - Step );
+		Y1 = f( X1, Par );
+		for ( int Ite = 0; ; ++Ite ) {
+			if ( std::abs( Y1 ) < Eps ) {
+				XRes = X1;
+				return true;
+			}
+			if ( Y0 * Y1 < 0.0 ) {
+				SolveRegulaFalsi( Eps, MaxIte, SolFla, XRes, f, X0, X1, Par );
+				return SolFla > 0;
+			}
+			if ( Ite == MaxSecantIte || Y1 == Y0 ) return false;
+			Real64 const X2( std::max( XMin, std::min( XMax, X1 - Y1 * ( X1 - X0 ) / ( Y1 - Y0 ) ) ) );
+			if ( X2 == X1 ) return false; // held at a limit that does not meet the target
+			X0 = X1;
+			Y0 = Y1;
+			X1 = X2;
+			Y1 = f( X1, Par );
+		}
+	}
 
 	Real64
 	InterpSw(
@@ -96,6 +310,13 @@ namespace General {
 		Array1S< Real64 > const PropArray // Array of blind properties as function of slat angle
 	);
 
+	Real64
+	InterpSlatAng(
+		Real64 const SlatAng, // Slat angle (rad)
+		bool const VarSlats, // True if slat angle is variable
+		Array1S< float > const PropArray // Array of daylight factors as function of slat angle
+	);
+
 	Real64
 	InterpProfSlatAng(
 		Real64 const ProfAng, // Profile angle (rad)
@@ -119,17 +340,34 @@ namespace General {
 		Array1A< Real64 > const A // Polynomial coefficients
 	);
 
+	// Inline: called for every window, layer and time step in the solar distribution
+	inline
 	Real64
 	POLYF(
 		Real64 const X, // Cosine of angle of incidence
 		Array1< Real64 > const & A // Polynomial coefficients
-	);
+	)
+	{
+		if ( X < 0.0 || X > 1.0 ) {
+			return 0.0;
+		} else {
+			return X * ( A( 1 ) + X * ( A( 2 ) + X * ( A( 3 ) + X * ( A( 4 ) + X * ( A( 5 ) + X * A( 6 ) ) ) ) ) );
+		}
+	}
 
+	inline
 	Real64
 	POLYF(
 		Real64 const X, // Cosine of angle of incidence
 		Array1S< Real64 > const & A // Polynomial coefficients
-	);
+	)
+	{
+		if ( X < 0.0 || X > 1.0 ) {
+			return 0.0;
+		} else {
+			return X * ( A( 1 ) + X * ( A( 2 ) + X * ( A( 3 ) + X * ( A( 4 ) + X * ( A( 5 ) + X * A( 6 ) ) ) ) ) );
+		}
+	}
 
 	Real64
 	POLY1F(
@@ -25,7 +25,7 @@ namespace GlobalNames {
 	// certain component names (esp. Chillers, Boilers)
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// Each list of names has a hashed index (e.g. ChillerNameIndex), so a check does not search the list.
 
 	// REFERENCES:
 	// na
@@ -62,6 +62,10 @@ namespace GlobalNames {
 	Array1D< ComponentNameData > BoilerNames;
 	Array1D< ComponentNameData > BaseboardNames;
 	Array1D< ComponentNameData > CoilNames;
+	std::unordered_map< std::string, int > ChillerNameIndex; // Index of each name in ChillerNames
+	std::unordered_map< std::string, int > BoilerNameIndex; // Index of each name in BoilerNames
+	std::unordered_map< std::string, int > BaseboardNameIndex; // Index of each name in BaseboardNames
+	std::unordered_map< std::string, int > CoilNameIndex; // Index of each name in CoilNames
 
 	// Functions
 
@@ -111,7 +115,7 @@ namespace GlobalNames {
 
 		ErrorFound = false;
 		int Found = 0;
-		if ( NumChillers > 0 ) Found = FindItemInList( NameToVerify, ChillerNames.CompName(), NumChillers );
+		if ( NumChillers > 0 ) Found = FindItemInList( NameToVerify, ChillerNameIndex );
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Chiller Type=\"" + ChillerNames( Found ).CompType + "\"." );
 			ShowContinueError( "...Current entry is Chiller Type=\"" + TypeToVerify + "\"." );
@@ -127,6 +131,7 @@ namespace GlobalNames {
 			++NumChillers;
 			ChillerNames( NumChillers ).CompType = MakeUPPERCase( TypeToVerify );
 			ChillerNames( NumChillers ).CompName = NameToVerify;
+			ChillerNameIndex.emplace( NameToVerify, NumChillers );
 		}
 	}
 
@@ -177,7 +182,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBaseboards > 0 ) Found = FindItemInList( NameToVerify, BaseboardNames.CompName(), NumBaseboards );
+		if ( NumBaseboards > 0 ) Found = FindItemInList( NameToVerify, BaseboardNameIndex );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Baseboard Type=\"" + BaseboardNames( Found ).CompType + "\"." );
@@ -194,6 +199,7 @@ namespace GlobalNames {
 			++NumBaseboards;
 			BaseboardNames( NumBaseboards ).CompType = TypeToVerify;
 			BaseboardNames( NumBaseboards ).CompName = NameToVerify;
+			BaseboardNameIndex.emplace( NameToVerify, NumBaseboards );
 		}
 
 	}
@@ -245,7 +251,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBoilers > 0 ) Found = FindItemInList( NameToVerify, BoilerNames.CompName(), NumBoilers );
+		if ( NumBoilers > 0 ) Found = FindItemInList( NameToVerify, BoilerNameIndex );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Boiler Type=\"" + BoilerNames( Found ).CompType + "\"." );
@@ -262,6 +268,7 @@ namespace GlobalNames {
 			++NumBoilers;
 			BoilerNames( NumBoilers ).CompType = TypeToVerify;
 			BoilerNames( NumBoilers ).CompName = NameToVerify;
+			BoilerNameIndex.emplace( NameToVerify, NumBoilers );
 		}
 
 	}
@@ -313,7 +320,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumCoils > 0 ) Found = FindItemInList( NameToVerify, CoilNames.CompName(), NumCoils );
+		if ( NumCoils > 0 ) Found = FindItemInList( NameToVerify, CoilNameIndex );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Coil Type=\"" + CoilNames( Found ).CompType + "\"" );
@@ -330,6 +337,7 @@ namespace GlobalNames {
 			++NumCoils;
 			CoilNames( NumCoils ).CompType = MakeUPPERCase( TypeToVerify );
 			CoilNames( NumCoils ).CompName = NameToVerify;
+			CoilNameIndex.emplace( NameToVerify, NumCoils );
 		}
 
 	}
@@ -1,6 +1,9 @@
 #ifndef GlobalNames_hh_INCLUDED
 #define GlobalNames_hh_INCLUDED
 
+// C++ Headers
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -60,6 +63,10 @@ namespace GlobalNames {
 	extern Array1D< ComponentNameData > BoilerNames;
 	extern Array1D< ComponentNameData > BaseboardNames;
 	extern Array1D< ComponentNameData > CoilNames;
+	extern std::unordered_map< std::string, int > ChillerNameIndex; // Index of each name in ChillerNames
+	extern std::unordered_map< std::string, int > BoilerNameIndex; // Index of each name in BoilerNames
+	extern std::unordered_map< std::string, int > BaseboardNameIndex; // Index of each name in BaseboardNames
+	extern std::unordered_map< std::string, int > CoilNameIndex; // Index of each name in CoilNames
 
 	// Functions
 
@@ -1,5 +1,14 @@
 // C++ Headers
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -14,6 +23,8 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -84,6 +95,8 @@ namespace GroundHeatExchangers {
 	Real64 const hrsPerDay( 24.0 ); // Number of hours in a day
 	Real64 const hrsPerMonth( 730.0 ); // Number of hours in month
 	int const maxTSinHr( 60 ); // Max number of time step in a hour
+	int const numAggBinsPerLevel( 8 ); // Number of bins in each level of the multi-level load aggregation
+	char const GFunctionCacheMagic[ 8 ] = { 'E', 'P', 'G', 'F', 'U', 'N', '0', '1' }; // Tag at the start of g-function cache files
 
 	// MODULE VARIABLE DECLARATIONS:
 	int numVerticalGLHEs( 0 );
@@ -268,19 +281,23 @@ namespace GroundHeatExchangers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR:          Matt Mitchell
 		//       DATE WRITTEN:    February, 2015
-		//       MODIFIED         na
+		//       MODIFIED         Oct 2026, reuse g-functions from the g-function cache
+		//                        Oct 2026, ring responses worked out once per offset for all times
 		//       RE-ENGINEERED    na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// calculates g-functions for the slinky ground heat exchanger model
 
+		// Using/Aliasing
+		using DataSystemVariables::GFunctionCacheFolder;
+		using DataSystemVariables::NumberGroundDomainThreads;
+
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 tLg_max( 0.0 );
 		Real64 tLg_min( -2 );
 		Real64 tLg_grid( 0.25 );
 		Real64 ts( 3600 );
 		Real64 tLg;
-		Real64 t;
 		Real64 convertYearsToSeconds( 356 * 24 * 60 * 60 );
 		int NT;
 		int numLC;
@@ -288,7 +305,13 @@ namespace GroundHeatExchangers {
 		int coil;
 		int trench;
 		Real64 fraction;
-		Array2D< Real64 > valStored( {0, numTrenches}, {0, numCoils}, -1.0 );
+		Array2D_int offsetIndex( {0, numTrenches}, {0, numCoils}, 0 ); // Index of each ring offset in offsetResponse
+		std::vector< int > offsetRings; // m, n, m1, n1 of the first ring pair found with each offset
+		int numOffsets( 0 );
+		int offset;
+		Array2D< Real64 > offsetResponse; // Near- or middle-field response by time and offset
+		RingPairPoints points;
+		Real64 responseVal;
 		Real64 gFunc;
 		Real64 gFuncin;
 		int m1;
@@ -299,10 +322,6 @@ namespace GroundHeatExchangers {
 		int nn1;
 		int i;
 		Real64 disRing;
-		int I0;
-		int J0;
-		Real64 doubleIntegralVal;
-		Real64 midFieldVal;
 
 		X0.allocate( numCoils );
 		Y0.allocate( numTrenches );
@@ -324,6 +343,10 @@ namespace GroundHeatExchangers {
 			LNTTS( i ) = 0.0;
 		}
 
+		// Reuse g-functions computed by an earlier run for the same field and soil
+		std::uint64_t const cacheKey( gFunctionCacheKey() );
+		if ( ! GFunctionCacheFolder.empty() && readGFunctionCache( cacheKey ) ) return;
+
 		// Calculate the number of loops (per trench) and number of trenchs to be involved
 			// Due to the symmetry of a slinky GHX field, we need only calculate about
 			// on quarter of the rings' tube wall temperature perturbation to get the
@@ -348,90 +371,90 @@ namespace GroundHeatExchangers {
 			fraction = 0.5;
 		}
 
+		// The response of one ring to another depends only on the offset between them, and the
+		// distances between their points do not change with time.  So the rings in the near and middle
+		// fields are first listed by offset (keeping the first ring pair found with each offset, as the
+		// sum below would), and the response for each offset is worked out for all times at once.
+		for ( m1 = 1; m1 <= numRC; ++m1 ) {
+			for ( n1 = 1; n1 <= numLC; ++n1 ) {
+				for ( m = 1; m <= numTrenches; ++m ) {
+					for ( n = 1; n <= numCoils; ++n ) {
+						if ( distToCenter( m, n, m1, n1 ) > ( 10 + coilDiameter ) ) continue;
+						mm1 = std::abs( m - m1 );
+						nn1 = std::abs( n - n1 );
+						if ( offsetIndex( mm1, nn1 ) > 0 ) continue;
+						offsetIndex( mm1, nn1 ) = ++numOffsets;
+						offsetRings.push_back( m );
+						offsetRings.push_back( n );
+						offsetRings.push_back( m1 );
+						offsetRings.push_back( n1 );
+					}
+				}
+			}
+		}
+
+		offsetResponse.allocate( NPairs, numOffsets );
+		for ( offset = 1; offset <= numOffsets; ++offset ) {
+			m = offsetRings[ 4 * offset - 4 ];
+			n = offsetRings[ 4 * offset - 3 ];
+			m1 = offsetRings[ 4 * offset - 2 ];
+			n1 = offsetRings[ 4 * offset - 1 ];
+
+			// if the ring(n1, m1) is the near-field ring of the ring(n,m), integrate over both rings
+			bool const nearField( distToCenter( m, n, m1, n1 ) <= 2.5 + coilDiameter );
+			if ( nearField ) {
+				// If we're calculating a ring's temperature response to itself as a ring source,
+				// then we nee some extra effort in calculating the double integral
+				if ( m1 == m && n1 == n ) {
+					setupRingPairPoints( m, n, m1, n1, 33, 1089, points );
+				} else {
+					setupRingPairPoints( m, n, m1, n1, 33, 561, points );
+				}
+			}
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberGroundDomainThreads ) if ( nearField && ( NumberGroundDomainThreads > 1 ) )
+#endif
+			for ( int timeNum = 1; timeNum <= NPairs; ++timeNum ) {
+				Real64 const time( std::pow( 10, tLg_min + tLg_grid * ( timeNum - 1 ) ) * ts );
+				if ( nearField ) {
+					offsetResponse( timeNum, offset ) = ringPairResponse( points, time );
+				} else {
+					offsetResponse( timeNum, offset ) = midFieldResponseFunction( m, n, m1, n1, time );
+				}
+			}
+		}
+
 		// Calculate the corresponding time of each temperature response factor
 		for ( NT = 1; NT <= NPairs; ++NT ) {
 			tLg = tLg_min + tLg_grid * ( NT - 1 );
-			t = std::pow( 10, tLg ) * ts;
 
 			// Set the average temperature resonse of the whole field to zero
 			gFunc = 0;
 
-			valStored = -1.0;
-
 			for ( m1 = 1; m1 <= numRC; ++m1 ) {
 				for ( n1 = 1; n1 <= numLC; ++n1 ) {
 					for ( m = 1; m <= numTrenches; ++m ) {
 						for ( n = 1; n <= numCoils; ++n ) {
 
-							// Zero out val after each iteration
-							doubleIntegralVal = 0.0;
-							midFieldVal = 0.0;
-
 							// Calculate the distance between ring centers
 							disRing = distToCenter( m, n, m1, n1 );
 
-							// Save mm1 and nn1
-							mm1 = std::abs( m - m1 );
-							nn1 = std::abs( n - n1 );
-
-							// If we're calculating a ring's temperature response to itself as a ring source,
-							// then we nee some extra effort in calculating the double integral
-							if ( m1 == m && n1 == n) {
-								I0 = 33;
-								J0 = 1089;
-							} else {
-								I0 = 33;
-								J0 = 561;
-							}
-
-							// if the ring(n1, m1) is the near-field ring of the ring(n,m)
-							if ( disRing <= 2.5 + coilDiameter ) {
-								// if no calculated value has been stored
-								if ( valStored( mm1, nn1 ) < 0 ) {
-									doubleIntegralVal = doubleIntegral( m, n, m1, n1, t, I0, J0 );
-									valStored( mm1, nn1 ) = doubleIntegralVal;
-								// else: if a stored value is found for the combination of (m, n, m1, n1)
-								} else {
-									doubleIntegralVal = valStored( mm1, nn1 );
-								}
-
-								// due to symmetry, the temperature response of ring(n1, m1) should be 0.25, 0.5, or 1 times its calculated value
-								if ( ! isEven( numTrenches ) && ! isEven( numCoils ) && m1 == numRC && n1 == numLC && numTrenches > 1.5 ) {
-									gFuncin = 0.25 * doubleIntegralVal;
-								} else if ( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 ) {
-									gFuncin = 0.5 * doubleIntegralVal;
-								} else if ( ! isEven( numCoils ) && n1 == numLC ) {
-									gFuncin = 0.5  * doubleIntegralVal;
-								} else {
-									gFuncin = doubleIntegralVal;
-								}
-
 							// if the ring(n1, m1) is in the far-field or the ring(n,m)
-							} else if ( disRing > (10 + coilDiameter ) ) {
-								gFuncin = 0;
-
-							// else the ring(n1, m1) is in the middle-field of the ring(n,m)
+							if ( disRing > ( 10 + coilDiameter ) ) continue;
+
+							// near- or middle-field response for this combination of (m, n, m1, n1)
+							responseVal = offsetResponse( NT, offsetIndex( std::abs( m - m1 ), std::abs( n - n1 ) ) );
+
+							// due to symmetry, the temperature response of ring(n1, m1) should be 0.25, 0.5, or 1 times its calculated value
+							if ( ! isEven( numTrenches ) && ! isEven( numCoils ) && m1 == numRC && n1 == numLC && numTrenches > 1.5 ) {
+								gFuncin = 0.25 * responseVal;
+							} else if ( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 ) {
+								gFuncin = 0.5 * responseVal;
+							} else if ( ! isEven( numCoils ) && n1 == numLC ) {
+								gFuncin = 0.5  * responseVal;
 							} else {
-								// if no calculated value have been stored
-								if ( valStored( mm1, nn1 ) < 0.0 ) {
-									midFieldVal = midFieldResponseFunction( m, n, m1, n1, t );
-									valStored( mm1, nn1 ) = midFieldVal;
-								// if a stored value is found for the comination of (m, n, m1, n1), then
-								} else {
-									midFieldVal = valStored( mm1, nn1 );
-								}
-
-								// due to symmetry, the temperature response of ring(n1, m1) should be 0.25, 0.5, or 1 times its calculated value
-								if ( ! isEven( numTrenches ) && ! isEven( numCoils ) && m1 == numRC && n1 == numLC && numTrenches > 1.5 ) {
-									gFuncin = 0.25 * midFieldVal;
-								} else if ( ! isEven( numTrenches ) && m1 == numRC && numTrenches > 1.5 ) {
-									gFuncin = 0.5 * midFieldVal;
-								} else if ( ! isEven( numCoils ) && n1 == numLC ) {
-									gFuncin = 0.5  * midFieldVal;
-								} else {
-									gFuncin = midFieldVal;
-								}
-
+								gFuncin = responseVal;
 							}
 
 							gFunc += gFuncin;
@@ -445,6 +468,248 @@ namespace GroundHeatExchangers {
 			LNTTS( NT ) = tLg;
 
 		} // NT time
+
+		if ( ! GFunctionCacheFolder.empty() ) writeGFunctionCache( cacheKey );
+	}
+
+	//******************************************************************************
+
+	std::uint64_t
+	GLHESlinky::gFunctionCacheKey()
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the key under which the g-functions of a slinky field are stored in the g-function cache.
+
+		// METHODOLOGY EMPLOYED:
+		// 64 bit FNV-1a hash over everything calcGFunctions depends on: the coil and trench
+		// geometry, the pipe diameter, the ground diffusivity and the simulation length.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::uint64_t const FNVOffsetBasis( 14695981039346656037ULL );
+		std::uint64_t const FNVPrime( 1099511628211ULL );
+		int const CacheVersion( 1 ); // Change when the g-function calculation or the cached data changes
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t key( FNVOffsetBasis );
+
+		auto mix = [ & ]( void const * const data, std::size_t const numBytes ) {
+			unsigned char const * const bytes( static_cast< unsigned char const * >( data ) );
+			for ( std::size_t i = 0; i < numBytes; ++i ) {
+				key ^= bytes[ i ];
+				key *= FNVPrime;
+			}
+		};
+		auto mixInt = [ & ]( int const value ) {
+			mix( &value, sizeof( value ) );
+		};
+		auto mixReal = [ & ]( Real64 const value ) {
+			mix( &value, sizeof( value ) );
+		};
+
+		mixInt( CacheVersion );
+		mixInt( NPairs );
+		mixInt( verticalConfig );
+		mixInt( numTrenches );
+		mixInt( numCoils );
+		mixReal( coilDiameter );
+		mixReal( coilPitch );
+		mixReal( coilDepth );
+		mixReal( trenchSpacing );
+		mixReal( pipeOutDia );
+		mixReal( diffusivityGround );
+		mixReal( maxSimYears );
+
+		return key;
+	}
+
+	//******************************************************************************
+
+	std::string
+	GFunctionCacheFileName(
+		std::uint64_t const key // g-function cache key of the ground heat exchanger
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the g-function cache file holding the g-functions for a key.
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataStringGlobals::altpathChar;
+		using DataSystemVariables::GFunctionCacheFolder;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char keyString[ 17 ];
+
+		std::snprintf( keyString, sizeof( keyString ), "%016llx", static_cast< unsigned long long >( key ) );
+		std::string fileName( GFunctionCacheFolder );
+		if ( fileName.back() != pathChar && fileName.back() != altpathChar ) fileName += pathChar;
+		return fileName + "eplusgfunc_" + keyString + ".bin";
+	}
+
+	//******************************************************************************
+
+	void
+	CheckpointState( SimulationCheckpoint::CheckpointArchive & ar )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the load histories of the ground heat exchangers to, or reads them from, a
+		// simulation checkpoint (see SimulationCheckpoint::CheckpointState).
+
+		ar.section( "Ground heat exchanger time steps", prevTimeSteps.isize() );
+		ar.value( N );
+		ar.value( currentSimTime );
+		ar.value( locHourOfDay );
+		ar.value( locDayOfSim );
+		ar.values( prevTimeSteps );
+
+		ar.section( "Ground heat exchangers", numVerticalGLHEs + numSlinkyGLHEs );
+		for ( int i = 1; i <= numVerticalGLHEs + numSlinkyGLHEs; ++i ) {
+			GLHEBase & thisGLHE( ( i <= numVerticalGLHEs ) ? static_cast< GLHEBase & >( verticalGLHE( i ) ) : static_cast< GLHEBase & >( slinkyGLHE( i - numVerticalGLHEs ) ) );
+			ar.values( thisGLHE.QnMonthlyAgg );
+			ar.values( thisGLHE.QnHr );
+			ar.values( thisGLHE.QnSubHr );
+			ar.values( thisGLHE.LastHourN );
+			ar.values( thisGLHE.QnAggBin );
+			ar.values( thisGLHE.aggBinAge );
+			ar.value( thisGLHE.prevHour );
+			ar.value( thisGLHE.lastQnSubHr );
+			ar.value( thisGLHE.boreholeTemp );
+			ar.value( thisGLHE.massFlowRate );
+			ar.value( thisGLHE.outletTemp );
+			ar.value( thisGLHE.inletTemp );
+			ar.value( thisGLHE.aveFluidTemp );
+			ar.value( thisGLHE.QGLHE );
+		}
+	}
+
+	//******************************************************************************
+
+	bool
+	GLHEBase::readGFunctionCache(
+		std::uint64_t const key // g-function cache key of the ground heat exchanger
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads LNTTS and GFNC from the g-function cache.  Returns false (and leaves the
+		// g-functions untouched) if there is no usable cache file for the key.
+
+		// METHODOLOGY EMPLOYED:
+		// A cache file is the GFunctionCacheMagic tag, the key and the number of pairs, followed
+		// by LNTTS and then GFNC.  The whole file is read and checked before anything is copied.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char magic[ sizeof( GFunctionCacheMagic ) ];
+		std::uint64_t fileKey( 0 );
+		std::int32_t numPairs( 0 );
+
+		std::ifstream cacheFile( GFunctionCacheFileName( key ), std::ios::binary );
+		if ( ! cacheFile ) return false;
+
+		cacheFile.read( magic, sizeof( magic ) );
+		cacheFile.read( reinterpret_cast< char * >( &fileKey ), sizeof( fileKey ) );
+		cacheFile.read( reinterpret_cast< char * >( &numPairs ), sizeof( numPairs ) );
+		if ( ! cacheFile || std::memcmp( magic, GFunctionCacheMagic, sizeof( magic ) ) != 0 || fileKey != key ) return false;
+		if ( numPairs != NPairs ) return false;
+
+		std::vector< Real64 > payload( 2 * NPairs );
+		if ( ! cacheFile.read( reinterpret_cast< char * >( payload.data() ), payload.size() * sizeof( Real64 ) ) ) return false;
+		if ( cacheFile.peek() != std::ifstream::traits_type::eof() ) return false;
+
+		for ( int i = 1; i <= NPairs; ++i ) {
+			LNTTS( i ) = payload[ i - 1 ];
+			GFNC( i ) = payload[ NPairs + i - 1 ];
+		}
+		return true;
+	}
+
+	//******************************************************************************
+
+	void
+	GLHEBase::writeGFunctionCache(
+		std::uint64_t const key // g-function cache key of the ground heat exchanger
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores LNTTS and GFNC in the g-function cache (see readGFunctionCache).
+
+		// METHODOLOGY EMPLOYED:
+		// As for the CTF cache, the file is written under a temporary name that includes the
+		// process id and then renamed, so runs sharing the cache folder never see a partially
+		// written file.  Failures are reported once as a warning.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool warningIssued( false );
+
+		std::int32_t const numPairs( NPairs );
+		std::vector< Real64 > payload;
+		payload.reserve( 2 * NPairs );
+		for ( int i = 1; i <= NPairs; ++i ) {
+			payload.push_back( LNTTS( i ) );
+		}
+		for ( int i = 1; i <= NPairs; ++i ) {
+			payload.push_back( GFNC( i ) );
+		}
+
+		std::string const fileName( GFunctionCacheFileName( key ) );
+#ifdef _WIN32
+		std::string const tempFileName( fileName + ".tmp" + std::to_string( _getpid() ) );
+#else
+		std::string const tempFileName( fileName + ".tmp" + std::to_string( getpid() ) );
+#endif
+		bool writeOK;
+		{
+			std::ofstream cacheFile( tempFileName, std::ios::binary | std::ios::trunc );
+			cacheFile.write( GFunctionCacheMagic, sizeof( GFunctionCacheMagic ) );
+			cacheFile.write( reinterpret_cast< char const * >( &key ), sizeof( key ) );
+			cacheFile.write( reinterpret_cast< char const * >( &numPairs ), sizeof( numPairs ) );
+			cacheFile.write( reinterpret_cast< char const * >( payload.data() ), payload.size() * sizeof( Real64 ) );
+			cacheFile.close();
+			writeOK = ! cacheFile.fail();
+		}
+		if ( writeOK ) {
+#ifdef _WIN32
+			std::remove( fileName.c_str() ); // Rename does not replace an existing file on Windows
+#endif
+			writeOK = ( std::rename( tempFileName.c_str(), fileName.c_str() ) == 0 );
+		}
+		if ( ! writeOK ) {
+			std::remove( tempFileName.c_str() );
+			if ( ! warningIssued ) {
+				ShowWarningError( "writeGFunctionCache: Could not write g-function cache file=\"" + fileName + "\"." );
+				ShowContinueError( "G-functions for GroundHeatExchanger: " + Name + " will be recalculated in later runs." );
+				warningIssued = true;
+			}
+		}
 	}
 	//******************************************************************************
 
@@ -696,6 +961,122 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	GLHESlinky::setupRingPairPoints(
+		int const m,
+		int const n,
+		int const m1,
+		int const n1,
+		int const I0,
+		int const J0,
+		RingPairPoints & points
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the quadrature points of the double integral over two near-field rings
+		// (see doubleIntegral) so that ringPairResponse can evaluate it for any time.
+
+		// METHODOLOGY EMPLOYED:
+		// The points and Simpson's 1/3 rule weights are those of doubleIntegral and integral.
+		// Everything that does not depend on time (the distances and the weights) is stored per
+		// point, in separate arrays so the time loop runs straight through them.
+		// For two rings in the same trench of a horizontal field, mirroring both points about the
+		// trench axis (eta, theta -> 2 Pi - eta, 2 Pi - theta) leaves the distances unchanged and maps
+		// the grid onto itself with the same weights, so only half of the points are kept, at
+		// twice the weight.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 const hEta( 2 * Pi / ( I0 - 1 ) );
+		Real64 const hTheta( 2 * Pi / ( J0 - 1 ) );
+		bool const mirrored( ! verticalConfig && m == m1 );
+		int const iMid( ( I0 + 1 ) / 2 );
+		int const jMid( ( J0 + 1 ) / 2 );
+		int i;
+		int j;
+		Real64 eta;
+		Real64 theta;
+		Real64 weightEta;
+		Real64 weight;
+		Real64 distance1;
+		Real64 distance2;
+
+		points.clear();
+		for ( i = 1; i <= ( mirrored ? iMid : I0 ); ++i ) {
+
+			eta = ( i - 1 ) * hEta;
+			if ( i == 1 || i == I0 ) {
+				weightEta = 1.0;
+			} else if ( isEven( i ) ) {
+				weightEta = 4.0;
+			} else {
+				weightEta = 2.0;
+			}
+
+			for ( j = 1; j <= ( ( mirrored && i == iMid ) ? jMid : J0 ); ++j ) {
+
+				theta = ( j - 1 ) * hTheta;
+				if ( j == 1 || j == J0 ) {
+					weight = weightEta;
+				} else if ( isEven( j ) ) {
+					weight = 4.0 * weightEta;
+				} else {
+					weight = 2.0 * weightEta;
+				}
+				weight *= ( hEta / 3 ) * ( hTheta / 3 );
+				if ( mirrored && ! ( i == iMid && j == jMid ) ) weight *= 2.0;
+
+				distance1 = distance( m, n, m1, n1, eta, theta );
+				if ( ! verticalConfig ) {
+					distance2 = std::sqrt( pow_2( distance1 ) + 4 * pow_2( coilDepth ) );
+				} else {
+					distance2 = distanceToFictRing( m, n, m1, n1, eta, theta );
+				}
+
+				points.weightOverDist1.push_back( weight / distance1 );
+				points.halfDist1.push_back( 0.5 * distance1 );
+				points.weightOverDist2.push_back( weight / distance2 );
+				points.halfDist2.push_back( 0.5 * distance2 );
+			}
+		}
+	}
+
+	//******************************************************************************
+
+	Real64
+	GLHESlinky::ringPairResponse(
+		RingPairPoints const & points,
+		Real64 const t
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED         na
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates the double integral over two near-field rings at time t from the points set
+		// up by setupRingPairPoints; the same value doubleIntegral returns.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 const invSqrtAlphaT( 1.0 / std::sqrt( diffusivityGround * t ) );
+		Real64 sumIntF( 0.0 );
+
+		for ( std::size_t k = 0, k_end = points.halfDist1.size(); k < k_end; ++k ) {
+			sumIntF += points.weightOverDist1[ k ] * std::erfc( points.halfDist1[ k ] * invSqrtAlphaT ) - points.weightOverDist2[ k ] * std::erfc( points.halfDist2[ k ] * invSqrtAlphaT );
+		}
+
+		return sumIntF;
+	}
+
+	//******************************************************************************
+
 	Real64
 	GLHESlinky::integral(
 		int const m,
@@ -852,6 +1233,7 @@ namespace GroundHeatExchangers {
 		//       AUTHOR:          Dan Fisher
 		//       DATE WRITTEN:    August, 2000
 		//       MODIFIED         Arun Murugappan
+		//                        Oct 2026, optional multi-level load aggregation
 		//       RE-ENGINEERED    na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -874,12 +1256,15 @@ namespace GroundHeatExchangers {
 		//   Dept. of Mathematical Physics, University of Lund, Sweden, June 1987.
 		// Yavuzturk, C., J.D. Spitler. 1999. 'A Short Time Step Response Factor Model
 		//   for Vertical Ground Loop Heat Exchangers.' ASHRAE Transactions. 105(2): 475-485.
+		// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+		//   Temperatures of Borehole Heat Exchangers.' ASHRAE Transactions. 118(1): 530-539.
 
 		// Using/Aliasing
 		using DataPlant::PlantLoop;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using FluidProperties::GetDensityGlycol;
 		using General::TrimSigDigits;
+		using DataSystemVariables::GLHEMultiLevelAggregation;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS
@@ -915,12 +1300,11 @@ namespace GroundHeatExchangers {
 		int IndexN; // Used to index the LastHourN array
 		static bool updateCurSimTime( true ); // Used to reset the CurSimTime to reset after WarmupFlag
 		static bool triggerDesignDayReset( false );
-		static bool firstTime( true );
 
 		// Calculate G-Functions
-		if ( firstTime ) {
+		if ( ! gFunctionsCalculated ) {
 			calcGFunctions();
-			firstTime = false;
+			gFunctionsCalculated = true;
 		}
 
 		inletTemp = Node( inletNodeNum ).Temp;
@@ -940,6 +1324,7 @@ namespace GroundHeatExchangers {
 			QnHr = 0.0;
 			QnMonthlyAgg = 0.0;
 			QnSubHr = 0.0;
+			QnAggBin = 0.0;
 			LastHourN = 1;
 			N = 1;
 			updateCurSimTime = false;
@@ -994,6 +1379,43 @@ namespace GroundHeatExchangers {
 				fluidAveTemp = tempGround - tmpQnSubHourly * HXResistance;
 				ToutNew = tempGround - tmpQnSubHourly * ( gFuncVal / ( kGroundFactor ) + HXResistance - C_1 );
 			}
+		} else if ( GLHEMultiLevelAggregation ) {
+			// Sub-hourly superposition over the time steps of the last two hours; everything
+			// older comes from the multi-level aggregation bins, whose second bin is the hour
+			// before last (the first bin, the last hour, is covered by the time steps)
+
+			subHourlyLimit = N - LastHourN( 2 );
+			sumQnSubHourly = 0.0;
+			for ( I = 1; I <= subHourlyLimit; ++I ) {
+				gFuncVal = getGFunc( ( currentSimTime - prevTimeSteps( I + 1 ) ) / ( timeSSFactor ) );
+				RQSubHr = gFuncVal / ( kGroundFactor );
+				if ( I == subHourlyLimit ) {
+					sumQnSubHourly += ( QnSubHr( I ) - QnAggBin( 2 ) ) * RQSubHr;
+					break;
+				}
+				sumQnSubHourly += ( QnSubHr( I ) - QnSubHr( I + 1 ) ) * RQSubHr;
+			}
+
+			sumTotal = sumQnSubHourly + calcMultiLevelHistory( currentSimTime - int( currentSimTime ) );
+
+			// Calulate the subhourly temperature due the Last Time steps Load
+			gFuncVal = getGFunc( ( currentSimTime - prevTimeSteps( 2 ) ) / ( timeSSFactor ) );
+			RQSubHr = gFuncVal / ( kGroundFactor );
+
+			if ( massFlowRate <= 0.0 ) {
+				tmpQnSubHourly = 0.0;
+				fluidAveTemp = tempGround - sumTotal; // Q(N)*RB = 0
+				ToutNew = inletTemp;
+			} else {
+				// Explicit set of equations to calculate the New Outlet Temperature of the U-Tube
+				C0 = RQSubHr;
+				C1 = tempGround - ( sumTotal - QnSubHr( 1 ) * RQSubHr );
+				C2 = totalTubeLength / ( 2 * massFlowRate * cpFluid );
+				C3 = massFlowRate * cpFluid / ( totalTubeLength );
+				tmpQnSubHourly = ( C1 - inletTemp ) / ( HXResistance + C0 - C2 + ( 1 / C3 ) );
+				fluidAveTemp = C1 - ( C0 + HXResistance ) * tmpQnSubHourly;
+				ToutNew = C1 + ( C2 - C0 - HXResistance ) * tmpQnSubHourly;
+			}
 		} else {
 			// no monthly super position
 			if ( currentSimTime < ( hrsPerMonth + AGG + SubAGG ) ) {
@@ -1209,7 +1631,7 @@ namespace GroundHeatExchangers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR:          Arun Murugappan
 		//       DATE WRITTEN:    August, 2000
-		//       MODIFIED:        na
+		//       MODIFIED:        Oct 2026, feed the multi-level load aggregation
 		//       RE-ENGINEERED:   na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1228,7 +1650,7 @@ namespace GroundHeatExchangers {
 		//   for Vertical Ground Loop Heat Exchangers. ASHRAE Transactions. 105(2): 475-485.
 
 		// USE STATEMENTS:
-		// na
+		using DataSystemVariables::GLHEMultiLevelAggregation;
 
 		// Locals
 		//LOCAL VARIABLES
@@ -1252,6 +1674,7 @@ namespace GroundHeatExchangers {
 			SumQnHr /= std::abs( prevTimeSteps( 1 ) - prevTimeSteps( J ) );
 			QnHr = eoshift( QnHr, -1, SumQnHr );
 			LastHourN = eoshift( LastHourN, -1, N );
+			if ( GLHEMultiLevelAggregation ) shiftMultiLevelAggregation( SumQnHr );
 		}
 
 		//CHECK IF A MONTH PASSES...
@@ -1271,6 +1694,117 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	GLHEBase::initMultiLevelAggregation(
+		Real64 const simYears // Length of simulation to be covered by the bins [years]
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED:        na
+		//       RE-ENGINEERED:   na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the bins of the multi-level load aggregation.
+
+		// METHODOLOGY EMPLOYED:
+		// Level p holds numAggBinsPerLevel bins of 2^(p-1) hours each.  Enough levels are used
+		// for the bins to span the whole simulation, so the number of bins grows only with the
+		// log of the simulation length.
+
+		int binNum;
+		Real64 binWidth;
+		Real64 const hoursToCover( max( simYears, 1.0 ) * 8760.0 );
+
+		numAggLevels = 1;
+		while ( numAggBinsPerLevel * ( std::pow( 2.0, numAggLevels ) - 1.0 ) < hoursToCover ) ++numAggLevels;
+
+		QnAggBin.dimension( numAggLevels * numAggBinsPerLevel, 0.0 );
+		aggBinAge.dimension( numAggLevels * numAggBinsPerLevel, 0.0 );
+		for ( binNum = 1; binNum <= isize( aggBinAge ); ++binNum ) {
+			binWidth = std::pow( 2.0, ( binNum - 1 ) / numAggBinsPerLevel );
+			aggBinAge( binNum ) = binWidth + ( binNum > 1 ? aggBinAge( binNum - 1 ) : 0.0 );
+		}
+	}
+
+	//******************************************************************************
+
+	void
+	GLHEBase::shiftMultiLevelAggregation(
+		Real64 const QnHour // Average normalized heat extraction/rejection rate of the hour just completed [W/m]
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED:        na
+		//       RE-ENGINEERED:   na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves one hour of load through the multi-level aggregation bins.
+
+		// METHODOLOGY EMPLOYED:
+		// Each bin hands one hour's worth of its load to the next older bin and takes one hour's
+		// worth from the next newer one, so a bin of width w moves 1/w of the way towards its
+		// newer neighbor.  The bins are updated oldest first so each sees its neighbor's load from
+		// before this hour.  Energy is conserved and the work per hour is fixed by the number of
+		// bins, instead of growing with the length of the history.
+
+		// REFERENCES:
+		// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+		//   Temperatures of Borehole Heat Exchangers.' ASHRAE Transactions. 118(1): 530-539.
+
+		int binNum;
+		Real64 newerQn;
+
+		for ( binNum = isize( QnAggBin ); binNum >= 1; --binNum ) {
+			newerQn = ( binNum > 1 ) ? QnAggBin( binNum - 1 ) : QnHour;
+			QnAggBin( binNum ) += ( newerQn - QnAggBin( binNum ) ) / std::pow( 2.0, ( binNum - 1 ) / numAggBinsPerLevel );
+		}
+	}
+
+	//******************************************************************************
+
+	Real64
+	GLHEBase::calcMultiLevelHistory(
+		Real64 const hourFraction // Time since the end of the last complete hour [hr]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR:          na
+		//       DATE WRITTEN:    Oct 2026
+		//       MODIFIED:        na
+		//       RE-ENGINEERED:   na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the borehole temperature difference due to the aggregated load history from
+		// the second bin on; the most recent hour is superposed from the time step loads.
+
+		// METHODOLOGY EMPLOYED:
+		// The bins are superposed as load steps at their older edges, as for the hourly and
+		// monthly blocks.  Steps with no change in load are skipped, which covers the empty bins
+		// early in the simulation.
+
+		int binNum;
+		Real64 olderQn;
+		Real64 const kGroundFactor( 2.0 * Pi * kGround );
+		Real64 sumQn( 0.0 );
+
+		for ( binNum = 2; binNum <= isize( QnAggBin ); ++binNum ) {
+			olderQn = ( binNum < isize( QnAggBin ) ) ? QnAggBin( binNum + 1 ) : 0.0;
+			if ( QnAggBin( binNum ) == olderQn ) continue;
+			sumQn += ( QnAggBin( binNum ) - olderQn ) * getGFunc( ( hourFraction + aggBinAge( binNum ) ) / timeSSFactor ) / kGroundFactor;
+		}
+
+		return sumQn;
+	}
+
+	//******************************************************************************
+
 	void
 	GetGroundHeatExchangerInput()
 	{
@@ -1447,6 +1981,7 @@ namespace GroundHeatExchangers {
 				verticalGLHE( GLHENum ).QnHr.dimension( 730 + verticalGLHE( GLHENum ).AGG + verticalGLHE( GLHENum ).SubAGG, 0.0 );
 				verticalGLHE( GLHENum ).QnSubHr.dimension( ( verticalGLHE( GLHENum ).SubAGG + 1 ) * maxTSinHr + 1, 0.0 );
 				verticalGLHE( GLHENum ).LastHourN.dimension( verticalGLHE( GLHENum ).SubAGG + 1, 0 );
+				verticalGLHE( GLHENum ).initMultiLevelAggregation( verticalGLHE( GLHENum ).maxSimYears );
 
 				if ( ! allocated ) {
 					prevTimeSteps.allocate( ( verticalGLHE( GLHENum ).SubAGG + 1 ) * maxTSinHr + 1 );
@@ -1563,6 +2098,7 @@ namespace GroundHeatExchangers {
 				// Get Gfunction data
 				slinkyGLHE( GLHENum ).SubAGG = 15;
 				slinkyGLHE( GLHENum ).AGG = 192;
+				slinkyGLHE( GLHENum ).initMultiLevelAggregation( slinkyGLHE( GLHENum ).maxSimYears );
 
 				// Farfield model parameters, validated min/max by IP
 				slinkyGLHE( GLHENum ).useGroundTempDataForKusuda = lNumericFieldBlanks( 16 ) || lNumericFieldBlanks( 17 ) || lNumericFieldBlanks( 18 );
@@ -1,12 +1,18 @@
 #ifndef GroundHeatExchangers_hh_INCLUDED
 #define GroundHeatExchangers_hh_INCLUDED
 
+// C++ Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <SimulationCheckpoint.hh>
 
 namespace EnergyPlus {
 
@@ -21,6 +27,8 @@ namespace GroundHeatExchangers {
 	extern Real64 const hrsPerDay; // Number of hours in a day
 	extern Real64 const hrsPerMonth; // Number of hours in month
 	extern int const maxTSinHr; // Max number of time step in a hour
+	extern int const numAggBinsPerLevel; // Number of bins in each level of the multi-level load aggregation
+	extern char const GFunctionCacheMagic[ 8 ]; // Tag at the start of g-function cache files
 
 	// MODULE VARIABLE DECLARATIONS:
 	//na
@@ -63,6 +71,10 @@ namespace GroundHeatExchangers {
 		int SubAGG; // Minimum subhourly History
 		Array1D_int LastHourN; // Stores the Previous hour's N for past hours
 		// until the minimum subhourly history
+		int numAggLevels; // Number of levels in the multi-level load aggregation
+		Array1D< Real64 > QnAggBin; // Multi-level aggregated normalized heat extraction/rejection rate, newest bin first [W/m]
+		Array1D< Real64 > aggBinAge; // Time from the end of the last complete hour back to the older edge of each bin [hr]
+		bool gFunctionsCalculated; // G-functions have been calculated (or loaded from the g-function cache)
 		//loop topology variables
 		Real64 boreholeTemp; // [C]
 		Real64 massFlowRate; // [kg/s]
@@ -103,6 +115,8 @@ namespace GroundHeatExchangers {
 			NPairs( 0 ),
 			AGG( 0 ),
 			SubAGG( 0 ),
+			numAggLevels( 0 ),
+			gFunctionsCalculated( false ),
 			boreholeTemp( 0.0 ),
 			massFlowRate( 0.0 ),
 			outletTemp( 0.0 ),
@@ -123,6 +137,31 @@ namespace GroundHeatExchangers {
 		void
 		calcAggregateLoad();
 
+		void
+		initMultiLevelAggregation(
+			Real64 const simYears
+		);
+
+		void
+		shiftMultiLevelAggregation(
+			Real64 const QnHour
+		);
+
+		Real64
+		calcMultiLevelHistory(
+			Real64 const hourFraction
+		);
+
+		bool
+		readGFunctionCache(
+			std::uint64_t const key
+		);
+
+		void
+		writeGFunctionCache(
+			std::uint64_t const key
+		);
+
 		void
 		updateGHX();
 
@@ -198,6 +237,25 @@ namespace GroundHeatExchangers {
 
 	};
 
+	struct RingPairPoints
+	{
+		// Members
+		std::vector< Real64 > weightOverDist1; // Quadrature weight over the distance to the ring [1/m]
+		std::vector< Real64 > halfDist1; // Half the distance to the ring [m]
+		std::vector< Real64 > weightOverDist2; // Quadrature weight over the distance to the image ring [1/m]
+		std::vector< Real64 > halfDist2; // Half the distance to the image ring [m]
+
+		void
+		clear()
+		{
+			weightOverDist1.clear();
+			halfDist1.clear();
+			weightOverDist2.clear();
+			halfDist2.clear();
+		}
+
+	};
+
 	struct GLHESlinky:GLHEBase
 	{
 		// Members
@@ -269,6 +327,23 @@ namespace GroundHeatExchangers {
 			int const J0
 		);
 
+		void
+		setupRingPairPoints(
+			int const m,
+			int const n,
+			int const m1,
+			int const n1,
+			int const I0,
+			int const J0,
+			RingPairPoints & points
+		);
+
+		Real64
+		ringPairResponse(
+			RingPairPoints const & points,
+			Real64 const t
+		);
+
 		Real64
 		integral(
 			int const m,
@@ -338,6 +413,9 @@ namespace GroundHeatExchangers {
 		Real64 const time
 		);
 
+		std::uint64_t
+		gFunctionCacheKey();
+
 	};
 
 	// Object Data
@@ -357,6 +435,14 @@ namespace GroundHeatExchangers {
 	void
 	GetGroundHeatExchangerInput();
 
+	std::string
+	GFunctionCacheFileName(
+		std::uint64_t const key
+	);
+
+	void
+	CheckpointState( SimulationCheckpoint::CheckpointArchive & ar );
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -17,6 +17,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -61,6 +62,10 @@ namespace HVACControllers {
 	//                      - Added speedup optimization scheme to reuse solution obtained
 	//                        at the previous HVAC iteration for this controller during the
 	//                        bracketing phase (see ReusePreviousSolutionFlag).
+	//       MODIFIED       Oct 2026
+	//                      - Warm start: an active controller starts from its solution at the previous
+	//                        HVAC iteration and takes its second iterate along the slope saved with that
+	//                        solution (see SolutionTrackers).
 	//       MODIFIED       May 2006, Dimitri Curtil (LBNL)
 	//                      - Added mechanism to monitor min/max bounds to ensure that they remain invariant
 	//                        between successive controller iterations.
@@ -542,6 +547,8 @@ namespace HVACControllers {
 		// These controllers are separate objects and loaded sequentially, but will
 		// be retrieved by name as they are needed.
 
+		DataTimings::ProfileTimer const profileTimer( "GetControllerInput" ); // Region of the timing profile
+
 		CurrentModuleObject = "Controller:WaterCoil";
 		NumSimpleControllers = GetNumObjectsFound( CurrentModuleObject );
 		NumControllers = NumSimpleControllers;
@@ -1098,6 +1105,9 @@ namespace HVACControllers {
 			ControllerProps( ControlNum ).SolutionTrackers.DefinedFlag() = false;
 			ControllerProps( ControlNum ).SolutionTrackers.Mode() = iModeNone;
 			ControllerProps( ControlNum ).SolutionTrackers.ActuatedValue() = 0.0;
+			for ( auto & SolutionTracker : ControllerProps( ControlNum ).SolutionTrackers ) {
+				SolutionTracker.Slope = 0.0;
+			}
 
 			MyEnvrnFlag( ControlNum ) = false;
 		}
@@ -1377,6 +1387,7 @@ namespace HVACControllers {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ActuatedNode;
 		int SensedNode;
+		int PreviousSolutionIndex;
 
 		// Increment counter
 		++ControllerProps( ControlNum ).NumCalcCalls;
@@ -1417,8 +1428,22 @@ namespace HVACControllers {
 				// we can compute the actual setpoint for the dual humidity ratio / temperature strategy.
 				{ auto const SELECT_CASE_var( ControllerProps( ControlNum ).ControlVar );
 				if ( ( SELECT_CASE_var == iTemperature ) || ( SELECT_CASE_var == iHumidityRatio ) || ( SELECT_CASE_var == iFlow ) ) {
-					// Always start with min point by default for the other control strategies
-					ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MinPoint.X;
+					if ( FirstHVACIteration ) {
+						PreviousSolutionIndex = 1;
+					} else {
+						PreviousSolutionIndex = 2;
+					}
+					auto const & PreviousSolution( ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ) );
+
+					// Warm start from the solution at the previous HVAC iteration if the controller was active,
+					// in which case it is not tried again during the bracketing phase
+					if ( ControllerProps( ControlNum ).ReusePreviousSolutionFlag && PreviousSolution.DefinedFlag && ( PreviousSolution.Mode == iModeActive ) && CheckRootFinderCandidate( RootFinders( ControlNum ), PreviousSolution.ActuatedValue ) ) {
+						ControllerProps( ControlNum ).NextActuatedValue = PreviousSolution.ActuatedValue;
+						ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+					} else {
+						// Otherwise start with min point by default for the other control strategies
+						ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MinPoint.X;
+					}
 
 				} else if ( SELECT_CASE_var == iTemperatureAndHumidityRatio ) {
 					if ( ! ControllerProps( ControlNum ).IsSetPointDefinedFlag ) {
@@ -1534,6 +1559,8 @@ namespace HVACControllers {
 		bool PreviousSolutionDefinedFlag;
 		int PreviousSolutionMode;
 		Real64 PreviousSolutionValue;
+		Real64 PreviousSolutionSlope;
+		Real64 XNewton; // Candidate along the slope saved with the previous solution
 
 		// Obtain actuated and sensed nodes
 		ActuatedNode = ControllerProps( ControlNum ).ActuatedNode;
@@ -1560,6 +1587,7 @@ namespace HVACControllers {
 			PreviousSolutionDefinedFlag = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag;
 			PreviousSolutionMode = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode;
 			PreviousSolutionValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue;
+			PreviousSolutionSlope = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Slope;
 
 			// Attempt to use root at previous HVAC step in place of the candidate produced by the
 			// root finder.
@@ -1580,6 +1608,16 @@ namespace HVACControllers {
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
+
+				// After the first iterate, step along the slope saved with the previous solution (Newton step)
+				// instead of trying the min or max point, provided that the slope is consistent with the
+				// root finder and the step stays within the current min/max range and lower/upper brackets
+				if ( ( RootFinders( ControlNum ).CurrentMethodType == iMethodBracket ) && ( RootFinders( ControlNum ).NumHistory == 1 ) && PreviousSolutionDefinedFlag && ( PreviousSolutionMode == iModeActive ) && ( PreviousSolutionSlope != 0.0 ) && ( ( PreviousSolutionSlope > 0.0 ) == ( RootFinders( ControlNum ).Controls.SlopeType == iSlopeIncreasing ) ) ) {
+					XNewton = RootFinders( ControlNum ).CurrentPoint.X - RootFinders( ControlNum ).CurrentPoint.Y / PreviousSolutionSlope;
+					if ( CheckRootFinderCandidate( RootFinders( ControlNum ), XNewton ) ) {
+						ControllerProps( ControlNum ).NextActuatedValue = XNewton;
+					}
+				}
 			}
 
 		} else if ( ( SELECT_CASE_var == iStatusOK ) || ( SELECT_CASE_var == iStatusOKRoundOff ) ) {
@@ -2070,6 +2108,10 @@ namespace HVACControllers {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = true;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue = ControllerProps( ControlNum ).NextActuatedValue;
+				// Keep the slope over the last increment for the warm start (else the previous slope)
+				if ( RootFinders( ControlNum ).Increment.DefinedFlag && ( RootFinders( ControlNum ).Increment.X != 0.0 ) ) {
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Slope = RootFinders( ControlNum ).Increment.Y / RootFinders( ControlNum ).Increment.X;
+				}
 			} else {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = false;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
@@ -92,23 +92,27 @@ namespace HVACControllers {
 		bool DefinedFlag; // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 		Real64 ActuatedValue; // Actuated value
 		int Mode; // Operational model of controller
+		Real64 Slope; // Slope of the residual function near the actuated value (0 if unknown)
 
 		// Default Constructor
 		SolutionTrackerType() :
 			DefinedFlag( true ),
 			ActuatedValue( 0.0 ),
-			Mode( iModeNone )
+			Mode( iModeNone ),
+			Slope( 0.0 )
 		{}
 
 		// Member Constructor
 		SolutionTrackerType(
 			bool const DefinedFlag, // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 			Real64 const ActuatedValue, // Actuated value
-			int const Mode // Operational model of controller
+			int const Mode, // Operational model of controller
+			Real64 const Slope // Slope of the residual function near the actuated value (0 if unknown)
 		) :
 			DefinedFlag( DefinedFlag ),
 			ActuatedValue( ActuatedValue ),
-			Mode( Mode )
+			Mode( Mode ),
+			Slope( Slope )
 		{}
 
 	};
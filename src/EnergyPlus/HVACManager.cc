@@ -29,11 +29,13 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
 //#include <EarthTube.hh>
 #include <EMSManager.hh>
+#include <FaultsManager.hh>
 #include <General.hh>
 #include <HVACStandAloneERV.hh>
 #include <IceThermalStorage.hh>
@@ -143,6 +145,11 @@ namespace HVACManager {
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	int RepIterAirLoops( 0 ); // HVAC iterations after which the air loops still needed resimulating
+	int RepIterZoneEquip( 0 ); // HVAC iterations after which the zone equipment still needed resimulating
+	int RepIterNonZoneEquip( 0 ); // HVAC iterations after which the non-zone equipment still needed resimulating
+	int RepIterPlantLoops( 0 ); // HVAC iterations after which the plant loops still needed resimulating
+	int RepIterElecCircuits( 0 ); // HVAC iterations after which the electric load centers still needed resimulating
 
 	//Array1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//Array1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -163,6 +170,9 @@ namespace HVACManager {
 		//       AUTHORS:  Russ Taylor, Dan Fisher
 		//       DATE WRITTEN:  Jan. 1998
 		//       MODIFIED       Jul 2003 (CC) added a subroutine call for air models
+		//                      Oct 2026, timed as a region of the timing profile
+		//                      Oct 2026, optionally shorten the system time step for the affected air loops only
+		//                      Oct 2026, evaluate the fault schedules once per zone time step
 		//       RE-ENGINEERED  May 2008, Brent Griffith, revised variable time step method and zone conditions history
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -180,6 +190,7 @@ namespace HVACManager {
 		// Using/Aliasing
 		using DataConvergParams::MinTimeStepSys; // =0.0166667     != 1 minute | 0.3 C = (1% OF 300 C) =max allowable diff between ZoneAirTemp at Time=T & T-1
 		using DataConvergParams::MaxZoneTempDiff;
+		using DataConvergParams::AirLoopSysTimeStepShortening;
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
@@ -196,6 +207,8 @@ namespace HVACManager {
 		using DemandManager::ManageDemand;
 		using DemandManager::UpdateDemandManagers;
 		using EMSManager::ManageEMS;
+		using FaultsManager::AnyFaultsInModel;
+		using FaultsManager::UpdateFaultsStatus;
 		using IceThermalStorage::UpdateIceFractions;
 		using OutAirNodeManager::SetOutAirNodes;
 		using AirflowNetworkBalanceManager::ManageAirflowNetworkBalance;
@@ -269,6 +282,8 @@ namespace HVACManager {
 		static gio::Fmt Format_20( "(1x,I3,1x,F8.2,2(2x,F8.3),2x,F8.2,4(1x,F13.2),2x,F8.0,2x,F11.2,2x,F9.5,2x,A)" );
 		static gio::Fmt Format_30( "(1x,I3,5x,A)" );
 
+		DataTimings::ProfileTimer const profileTimer( "ManageHVAC" ); // Region of the timing profile
+
 		//SYSTEM INITIALIZATION
 		if ( TriggerGetAFN ) {
 			TriggerGetAFN = false;
@@ -315,6 +330,8 @@ namespace HVACManager {
 
 		ManageEMS( emsCallFromBeginTimestepBeforePredictor ); //calling point
 
+		if ( AnyFaultsInModel ) UpdateFaultsStatus();
+
 		SetOutAirNodes();
 
 		ManageRefrigeratedCaseRacks();
@@ -372,6 +389,7 @@ namespace HVACManager {
 			TimeStepSys = max( TimeStepSys, MinTimeStepSys );
 			UseZoneTimeStepHistory = false;
 			ShortenTimeStepSys = true;
+			if ( AirLoopSysTimeStepShortening ) SetAirLoopsHeldOnSysSubSteps();
 		} else {
 			NumOfSysTimeSteps = 1;
 			UseZoneTimeStepHistory = true;
@@ -380,6 +398,9 @@ namespace HVACManager {
 		if ( UseZoneTimeStepHistory ) PreviousTimeStep = TimeStepZone;
 		for ( SysTimestepLoop = 1; SysTimestepLoop <= NumOfSysTimeSteps; ++SysTimestepLoop ) {
 
+			// All air loops are simulated on the first system time step; the held ones keep that solution
+			SysSubStepHold = ( AirLoopSysTimeStepShortening && SysTimestepLoop > 1 );
+
 			if ( TimeStepSys < TimeStepZone ) {
 
 				ManageHybridVentilation();
@@ -511,6 +532,7 @@ namespace HVACManager {
 
 			FirstTimeStepSysFlag = false;
 		} //system time step  loop (loops once if no downstepping)
+		SysSubStepHold = false;
 
 		ManageZoneAirUpdates( iPushZoneTimestepHistories, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iPushZoneTimestepHistories, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
@@ -550,6 +572,57 @@ namespace HVACManager {
 
 	}
 
+	void
+	SetAirLoopsHeldOnSysSubSteps()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// With ConvergenceLimits System Timestep Shortening = AirLoop, selects the air loops that are
+		// simulated on each of the shorter system time steps of the zone time step: those serving a
+		// zone whose air temperature changed by more than MaxZoneTempDiff over the zone time step.
+		// The other air loops are held, that is keep the solution of the first system time step,
+		// while the zones, zone equipment and plant are still simulated on every system time step.
+
+		// METHODOLOGY EMPLOYED:
+		// An air loop is held only if none of the zones it cools or heats needs the shorter step.
+		// A held air loop delivers the supply air conditions of the first system time step to its
+		// zones, and its component energy reported for that step is repeated for the later ones,
+		// so the results of the zone time step stay consistent; the conditions of all air loops are
+		// synchronized again on the first system time step of the next zone time step.
+
+		// Using/Aliasing
+		using DataConvergParams::MaxZoneTempDiff;
+		using DataHeatBalFanSys::ZoneAirTempChange;
+		using DataZoneEquipment::ZoneEquipConfig;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int AirLoopNum;
+		int ZoneInSysIndex;
+		bool Affected;
+
+		if ( NumPrimaryAirSys == 0 ) return;
+		if ( AirLoopHeldOnSysSubStep.size() != std::size_t( NumPrimaryAirSys ) ) AirLoopHeldOnSysSubStep.dimension( NumPrimaryAirSys, false );
+
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			auto const & airToZone( AirToZoneNodeInfo( AirLoopNum ) );
+			Affected = false;
+			for ( ZoneInSysIndex = 1; ZoneInSysIndex <= airToZone.NumZonesCooled && ! Affected; ++ZoneInSysIndex ) {
+				Affected = ( ZoneAirTempChange( ZoneEquipConfig( airToZone.CoolCtrlZoneNums( ZoneInSysIndex ) ).ActualZoneNum ) > MaxZoneTempDiff );
+			}
+			for ( ZoneInSysIndex = 1; ZoneInSysIndex <= airToZone.NumZonesHeated && ! Affected; ++ZoneInSysIndex ) {
+				Affected = ( ZoneAirTempChange( ZoneEquipConfig( airToZone.HeatCtrlZoneNums( ZoneInSysIndex ) ).ActualZoneNum ) > MaxZoneTempDiff );
+			}
+			AirLoopHeldOnSysSubStep( AirLoopNum ) = ! Affected;
+		}
+
+	}
+
 	void
 	SimHVAC()
 	{
@@ -558,6 +631,7 @@ namespace HVACManager {
 		//       AUTHOR:          Dan Fisher
 		//       DATE WRITTEN:    April 1997
 		//       DATE MODIFIED:   May 1998 (RKS,RDT)
+		//                        Oct 2026, report which managers keep the iteration going
 
 		// PURPOSE OF THIS SUBROUTINE: Selects and calls the HVAC loop managers
 
@@ -599,6 +673,7 @@ namespace HVACManager {
 		using DataPlant::TotNumLoops;
 		using DataPlant::PlantManageSubIterations;
 		using DataPlant::PlantManageHalfLoopCalls;
+		using DataPlant::PlantManageHalfLoopSkips;
 		using DataPlant::DemandSide;
 		using DataPlant::SupplySide;
 		using DataPlant::PlantLoop;
@@ -685,12 +760,23 @@ namespace HVACManager {
 		// The plant loop 'get inputs' and initialization are also done here in order to allow plant loop connected components
 		// simulated by managers other than the plant manager to run correctly.
 		HVACManageIteration = 0;
+		RepIterAirLoops = 0;
+		RepIterZoneEquip = 0;
+		RepIterNonZoneEquip = 0;
+		RepIterPlantLoops = 0;
+		RepIterElecCircuits = 0;
 		PlantManageSubIterations = 0;
 		PlantManageHalfLoopCalls = 0;
+		PlantManageHalfLoopSkips = 0;
 		SetAllPlantSimFlagsToValue( true );
 		if ( ! IterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
 			SetupOutputVariable( "Air System Solver Iteration Count []", RepIterAir, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Solver Air Loop Resimulation Count []", RepIterAirLoops, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Solver Zone Equipment Resimulation Count []", RepIterZoneEquip, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Solver Non Zone Equipment Resimulation Count []", RepIterNonZoneEquip, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Solver Plant Loop Resimulation Count []", RepIterPlantLoops, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Solver Electric Load Center Resimulation Count []", RepIterElecCircuits, "HVAC", "Sum", "SimHVAC" );
 			ManageSetPoints(); //need to call this before getting plant loop data so setpoint checks can complete okay
 			GetPlantLoopData();
 			GetPlantInput();
@@ -705,6 +791,7 @@ namespace HVACManager {
 			if ( TotNumLoops > 0 ) {
 				SetupOutputVariable( "Plant Solver Sub Iteration Count []", PlantManageSubIterations, "HVAC", "Sum", "SimHVAC" );
 				SetupOutputVariable( "Plant Solver Half Loop Calls Count []", PlantManageHalfLoopCalls, "HVAC", "Sum", "SimHVAC" );
+				SetupOutputVariable( "Plant Solver Half Loop Calls Skipped Count []", PlantManageHalfLoopSkips, "HVAC", "Sum", "SimHVAC" );
 				for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
 					// init plant sizing numbers in main plant data structure
 					InitOneTimePlantSizingInfo( LoopNum );
@@ -774,6 +861,13 @@ namespace HVACManager {
 
 			++HVACManageIteration; // Increment the iteration counter
 
+			// Record which managers asked for another iteration
+			if ( SimAirLoopsFlag ) ++RepIterAirLoops;
+			if ( SimZoneEquipmentFlag ) ++RepIterZoneEquip;
+			if ( SimNonZoneEquipmentFlag ) ++RepIterNonZoneEquip;
+			if ( SimPlantLoopsFlag ) ++RepIterPlantLoops;
+			if ( SimElecCircuitsFlag ) ++RepIterElecCircuits;
+
 		}
 		if ( AnyPlantInModel ) {
 			if ( AnyPlantSplitterMixerLacksContinuity() ) {
@@ -1953,7 +2047,7 @@ namespace HVACManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Apparently someone who doesn't believe in documenting.
 		//       DATE WRITTEN   ???
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, skip the sums when no zone list or group loads are used
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1986,8 +2080,17 @@ namespace HVACManager {
 		int ListNum;
 		int GroupNum;
 		int Mult;
+		static bool MyOneTimeFlag( true );
+		static bool ListLoadsUsed( true ); // zone list or zone group loads are reported or used by other objects
+		static Array1D_string const ListVarNames( 8, { "Zone List Sensible Heating Energy", "Zone List Sensible Cooling Energy", "Zone List Sensible Heating Rate", "Zone List Sensible Cooling Rate", "Zone Group Sensible Heating Energy", "Zone Group Sensible Cooling Energy", "Zone Group Sensible Heating Rate", "Zone Group Sensible Cooling Rate" } );
 
 		// FLOW:
+		if ( MyOneTimeFlag ) {
+			if ( NumOfZoneLists > 0 ) ListLoadsUsed = OutputVariablesUsed( ListVarNames );
+			MyOneTimeFlag = false;
+		}
+		if ( ! ListLoadsUsed ) return;
+
 		// Sum ZONE LIST and ZONE GROUP report variables
 		ListSNLoadHeatEnergy = 0.0;
 		ListSNLoadCoolEnergy = 0.0;
@@ -2022,6 +2125,7 @@ namespace HVACManager {
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   July 2000
 		//       MODIFIED       Shirey, Jan 2008 (MIXING/CROSS MIXING outputs)
+		//                      Oct 2026, reuse the outdoor air properties already evaluated for infiltration
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2166,7 +2270,6 @@ namespace HVACManager {
 			}
 
 			// first calculate mass flows using outside air heat capacity for consistency with input to heat balance
-			CpAir = PsyCpAirFnWTdb( OutHumRat, Zone( ZoneLoop ).OutDryBulbTemp );
 			ZnAirRpt( ZoneLoop ).InfilMass = ( MCPI( ZoneLoop ) / CpAir ) * TimeStepSys * SecInHour * ADSCorrectionFactor;
 			ZnAirRpt( ZoneLoop ).InfilMdot = ( MCPI( ZoneLoop ) / CpAir ) * ADSCorrectionFactor;
 			ZnAirRpt( ZoneLoop ).VentilMass = ( MCPV( ZoneLoop ) / CpAir ) * TimeStepSys * SecInHour * ADSCorrectionFactor;
@@ -2219,8 +2322,7 @@ namespace HVACManager {
 					++VentZoneNum;
 					if ( VentZoneNum > 1 ) continue;
 
-					// Report ventilation latent gains and losses
-					H2OHtOfVap = PsyHgAirFnWTdb( OutHumRat, Zone( ZoneLoop ).OutDryBulbTemp );
+					// Report ventilation latent gains and losses (H2OHtOfVap still holds the outdoor value from infiltration)
 					if ( ZoneAirHumRat( ZoneLoop ) > OutHumRat ) {
 						ZnAirRpt( ZoneLoop ).VentilLatentLoss = 0.001 * MCPV( ZoneLoop ) / CpAir * ( ZoneAirHumRat( ZoneLoop ) - OutHumRat ) * H2OHtOfVap * TimeStepSys * SecInHour * 1000.0 * ADSCorrectionFactor;
 						ZnAirRpt( ZoneLoop ).VentilLatentGain = 0.0;
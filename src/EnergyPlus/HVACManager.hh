@@ -19,6 +19,11 @@ namespace HVACManager {
 
 	extern int HVACManageIteration; // counts iterations to enforce maximum iteration limit
 	extern int RepIterAir;
+	extern int RepIterAirLoops; // HVAC iterations after which the air loops still needed resimulating
+	extern int RepIterZoneEquip; // HVAC iterations after which the zone equipment still needed resimulating
+	extern int RepIterNonZoneEquip; // HVAC iterations after which the non-zone equipment still needed resimulating
+	extern int RepIterPlantLoops; // HVAC iterations after which the plant loops still needed resimulating
+	extern int RepIterElecCircuits; // HVAC iterations after which the electric load centers still needed resimulating
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -28,6 +33,9 @@ namespace HVACManager {
 	void
 	ManageHVAC();
 
+	void
+	SetAirLoopsHeldOnSysSubSteps();
+
 	void
 	SimHVAC();
 
@@ -462,7 +462,7 @@ namespace HVACSingleDuctInduc {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   June 21 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, test the unit type number instead of the type name
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -479,7 +479,6 @@ namespace HVACSingleDuctInduc {
 		using DataZoneEquipment::ZoneEquipInputsFilled;
 		using DataZoneEquipment::CheckZoneEquipmentList;
 		using DataDefineEquip::AirDistUnit;
-		using InputProcessor::SameString;
 		using DataPlant::PlantLoop;
 		using DataPlant::ScanPlantLoopsForObject;
 		using DataPlant::TypeOf_CoilWaterSimpleHeating;
@@ -579,7 +578,7 @@ namespace HVACSingleDuctInduc {
 			OutletNode = IndUnit( IUNum ).OutAirNode;
 			IndRat = IndUnit( IUNum ).InducRatio;
 			// set the mass flow rates from the input volume flow rates
-			if ( SameString( IndUnit( IUNum ).UnitType, "AirTerminal:SingleDuct:ConstantVolume:FourPipeInduction" ) ) {
+			if ( IndUnit( IUNum ).UnitType_Num == SingleDuct_CV_FourPipeInduc ) {
 				IndUnit( IUNum ).MaxTotAirMassFlow = RhoAir * IndUnit( IUNum ).MaxTotAirVolFlow;
 				IndUnit( IUNum ).MaxPriAirMassFlow = IndUnit( IUNum ).MaxTotAirMassFlow / ( 1.0 + IndRat );
 				IndUnit( IUNum ).MaxSecAirMassFlow = IndRat * IndUnit( IUNum ).MaxTotAirMassFlow / ( 1.0 + IndRat );
@@ -625,7 +624,7 @@ namespace HVACSingleDuctInduc {
 		if ( FirstHVACIteration ) {
 			// check for upstream zero flow. If nonzero and schedule ON, set primary flow to max
 			if ( GetCurrentScheduleValue( IndUnit( IUNum ).SchedPtr ) > 0.0 && Node( PriNode ).MassFlowRate > 0.0 ) {
-				if ( SameString( IndUnit( IUNum ).UnitType, "AirTerminal:SingleDuct:ConstantVolume:FourPipeInduction" ) ) {
+				if ( IndUnit( IUNum ).UnitType_Num == SingleDuct_CV_FourPipeInduc ) {
 					Node( PriNode ).MassFlowRate = IndUnit( IUNum ).MaxPriAirMassFlow;
 					Node( SecNode ).MassFlowRate = IndUnit( IUNum ).MaxSecAirMassFlow;
 				}
@@ -635,7 +634,7 @@ namespace HVACSingleDuctInduc {
 			}
 			// reset the max and min avail flows
 			if ( GetCurrentScheduleValue( IndUnit( IUNum ).SchedPtr ) > 0.0 && Node( PriNode ).MassFlowRateMaxAvail > 0.0 ) {
-				if ( SameString( IndUnit( IUNum ).UnitType, "AirTerminal:SingleDuct:ConstantVolume:FourPipeInduction" ) ) {
+				if ( IndUnit( IUNum ).UnitType_Num == SingleDuct_CV_FourPipeInduc ) {
 					Node( PriNode ).MassFlowRateMaxAvail = IndUnit( IUNum ).MaxPriAirMassFlow;
 					Node( PriNode ).MassFlowRateMinAvail = IndUnit( IUNum ).MaxPriAirMassFlow;
 					Node( SecNode ).MassFlowRateMaxAvail = IndUnit( IUNum ).MaxSecAirMassFlow;
@@ -215,6 +215,7 @@ namespace HVACUnitarySystem {
 	Array1D_bool CheckEquipName;
 	Array1D_bool MultiOrVarSpeedHeatCoil;
 	Array1D_bool MultiOrVarSpeedCoolCoil;
+	Array1D_bool ReportLoadRates; // True if any of the unit's heating or cooling rates is stored for output
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -2702,6 +2703,10 @@ namespace HVACUnitarySystem {
 		int iMaxHROutletWaterTempNumericNum; // get input index to unitary system max HR outlet temp
 		int iHRWaterInletNodeAlphaNum; // get input index to unitary system HR water inlet node
 		int iHRWaterOutletNodeAlphaNum; // get input index to unitary system HR water outlet node
+		int iPLRCacheAlphaNum; // get input index to unitary system part load ratio cache
+		int iPLRCacheTempTolerNumericNum; // get input index to unitary system PLR cache temperature tolerance
+		int iPLRCacheHumRatTolerNumericNum; // get input index to unitary system PLR cache humidity ratio tolerance
+		int iPLRCacheBracketWidthNumericNum; // get input index to unitary system PLR cache bracket width
 
 		CurrentModuleObject = "AirloopHVAC:UnitarySystem";
 		NumUnitarySystem = GetNumObjectsFound( CurrentModuleObject );
@@ -2711,9 +2716,11 @@ namespace HVACUnitarySystem {
 		CheckEquipName.allocate( NumUnitarySystem );
 		MultiOrVarSpeedHeatCoil.allocate( NumUnitarySystem );
 		MultiOrVarSpeedCoolCoil.allocate( NumUnitarySystem );
+		ReportLoadRates.allocate( NumUnitarySystem );
 		CheckEquipName = true;
 		MultiOrVarSpeedHeatCoil = false;
 		MultiOrVarSpeedCoolCoil = false;
+		ReportLoadRates = true;
 
 		GetObjectDefMaxArgs( CurrentModuleObject, TotalArgs, NumAlphas, NumNumbers );
 		TempAlphas = NumAlphas;
@@ -2852,7 +2859,12 @@ namespace HVACUnitarySystem {
 		iHRWaterOutletNodeAlphaNum = 25; // A25, \field Heat Recovery Water Outlet Node Name
 
 		iDesignSpecMSHPTypeAlphaNum = 26; // A26, \field design Specification Multispeed Heat Pump Object Type
-		iDesignSpecMSHPNameAlphaNum = 27; // A27; \field design Specification Multispeed Heat Pump Object Name
+		iDesignSpecMSHPNameAlphaNum = 27; // A27, \field design Specification Multispeed Heat Pump Object Name
+
+		iPLRCacheAlphaNum = 28; // A28, \field Part Load Ratio Cache
+		iPLRCacheTempTolerNumericNum = 27; // N27, \field Part Load Ratio Cache Inlet Temperature Tolerance
+		iPLRCacheHumRatTolerNumericNum = 28; // N28, \field Part Load Ratio Cache Inlet Humidity Ratio Tolerance
+		iPLRCacheBracketWidthNumericNum = 29; // N29; \field Part Load Ratio Cache Bracket Width
 
 		// Get the data for the Unitary System
 		CurrentModuleObject = "AirloopHVAC:UnitarySystem";
@@ -5322,6 +5334,20 @@ namespace HVACUnitarySystem {
 				}
 			}
 
+			// Part load ratio cache, the defaults in UnitarySystemData are used for fields not included in the input
+			if ( NumAlphas >= iPLRCacheAlphaNum && ! lAlphaBlanks( iPLRCacheAlphaNum ) ) {
+				UnitarySystem( UnitarySysNum ).PLRCacheOn = SameString( Alphas( iPLRCacheAlphaNum ), "Yes" );
+			}
+			if ( NumNumbers >= iPLRCacheTempTolerNumericNum && ! lNumericBlanks( iPLRCacheTempTolerNumericNum ) ) {
+				UnitarySystem( UnitarySysNum ).PLRCacheTempToler = Numbers( iPLRCacheTempTolerNumericNum );
+			}
+			if ( NumNumbers >= iPLRCacheHumRatTolerNumericNum && ! lNumericBlanks( iPLRCacheHumRatTolerNumericNum ) ) {
+				UnitarySystem( UnitarySysNum ).PLRCacheHumRatToler = Numbers( iPLRCacheHumRatTolerNumericNum );
+			}
+			if ( NumNumbers >= iPLRCacheBracketWidthNumericNum && ! lNumericBlanks( iPLRCacheBracketWidthNumericNum ) ) {
+				UnitarySystem( UnitarySysNum ).PLRCacheBracketWidth = Numbers( iPLRCacheBracketWidthNumericNum );
+			}
+
 			if ( ! lAlphaBlanks( iDesignSpecMSHPTypeAlphaNum ) && ! lAlphaBlanks( iDesignSpecMSHPNameAlphaNum ) ) {
 				UnitarySystem( UnitarySysNum ).DesignSpecMultispeedHPType = Alphas( iDesignSpecMSHPTypeAlphaNum );
 				UnitarySystem( UnitarySysNum ).DesignSpecMultispeedHPName = Alphas( iDesignSpecMSHPNameAlphaNum );
@@ -5423,6 +5449,10 @@ namespace HVACUnitarySystem {
 			SetupOutputVariable( "Unitary System Total Heating Rate [W]", UnitarySystem( UnitarySysNum ).TotHeatEnergyRate, "System", "Average", UnitarySystem( UnitarySysNum ).Name );
 			SetupOutputVariable( "Unitary System Sensible Heating Rate [W]", UnitarySystem( UnitarySysNum ).SensHeatEnergyRate, "System", "Average", UnitarySystem( UnitarySysNum ).Name );
 			SetupOutputVariable( "Unitary System Latent Heating Rate [W]", UnitarySystem( UnitarySysNum ).LatHeatEnergyRate, "System", "Average", UnitarySystem( UnitarySysNum ).Name );
+			ReportLoadRates( UnitarySysNum ) = false;
+			for ( auto const & RateName : { "Unitary System Total Cooling Rate", "Unitary System Sensible Cooling Rate", "Unitary System Latent Cooling Rate", "Unitary System Total Heating Rate", "Unitary System Sensible Heating Rate", "Unitary System Latent Heating Rate" } ) {
+				if ( OutputVariableIsStored( UnitarySystem( UnitarySysNum ).Name, RateName ) ) ReportLoadRates( UnitarySysNum ) = true;
+			}
 			SetupOutputVariable( "Unitary System Ancillary Electric Power [W]", UnitarySystem( UnitarySysNum ).TotalAuxElecPower, "System", "Average", UnitarySystem( UnitarySysNum ).Name );
 
 			//        IF(UnitarySystem(UnitarySysNum)%DehumidControlType_Num .EQ. DehumidControl_CoolReheat)THEN
@@ -5824,7 +5854,7 @@ namespace HVACUnitarySystem {
 		Real64 LatOutputOn; // latent output at PLR = 1 [W]
 		Real64 CoolPLR; // cooing part load ratio
 		Real64 HeatPLR; // heating part load ratio
-		Array1D< Real64 > Par( 10 ); // parameters passed to RegulaFalsi function
+		static EP_THREAD_LOCAL Array1D< Real64 > Par( 10 ); // parameters passed to RegulaFalsi function //Tuned Made static
 		int SolFlag; // return flag from RegulaFalsi for sensible load
 		int SolFlagLat; // return flag from RegulaFalsi for latent load
 		Real64 TempLoad; // represents either a sensible or latent load [W]
@@ -5836,6 +5866,8 @@ namespace HVACUnitarySystem {
 		int SpeedNum; // multi-speed coil speed number
 		int CompressorONFlag; // 0= compressor off, 1= compressor on
 		Real64 CoolingOnlySensibleOutput; // use to calculate dehumidification induced heating [W]
+		int PLRCacheLoadType; // part load ratio cache entry, 1 for a heating load, 2 for a cooling load
+		Real64 CapFrac; // fraction of the capacity range (PLR = 0 to 1) needed to meet the load
 		Real64 CpAir; // specific heat of air [J/kg_C]
 
 		CompName = UnitarySystem( UnitarySysNum ).Name;
@@ -6236,7 +6268,22 @@ namespace HVACUnitarySystem {
 				Par( 9 ) = 0.0; // HXUnitOn is always false for HX
 				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
 				//     Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				if ( CoolingLoad ) {
+					PLRCacheLoadType = 2;
+				} else {
+					PLRCacheLoadType = 1;
+				}
+				CapFrac = ( ZoneLoad - SensOutputOff ) / ( SensOutputOn - SensOutputOff );
+				if ( UnitarySystem( UnitarySysNum ).PLRCacheOn && GetPLRCacheBracket( UnitarySysNum, PLRCacheLoadType, CapFrac, TempMinPLR, TempMaxPLR ) ) {
+					// Search the range around the cached solution first and the full range if the load is not met in it
+					SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+					if ( SolFlag == -2 ) {
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+					}
+				} else {
+					SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				}
+				if ( UnitarySystem( UnitarySysNum ).PLRCacheOn && SolFlag > 0 ) UpdatePLRCache( UnitarySysNum, PLRCacheLoadType, PartLoadRatio, CapFrac );
 
 				if ( SolFlag == -1 ) {
 					if ( HeatingLoad ) {
@@ -6625,6 +6672,142 @@ namespace HVACUnitarySystem {
 		}
 	}
 
+	bool
+	GetPLRCacheBracket(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const CapFrac, // Fraction of the capacity range (PLR = 0 to 1) needed to meet the load
+		Real64 & MinPLR, // Lower end of the seeded part load ratio range
+		Real64 & MaxPLR // Upper end of the seeded part load ratio range
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a narrow part load ratio range in which to search for the PLR that meets the load,
+		// estimated from the solution cached for the same inlet air conditions.
+		// Returns false if there is no such solution.
+
+		// METHODOLOGY EMPLOYED:
+		// The delivered capacity is interpolated as a function of PLR through (0,0), the cached
+		// (PLR, capacity fraction) and (1,1), and inverted for the capacity fraction of the load.
+		// The cache is cleared when the inlet air temperature or humidity ratio moves by more than
+		// the tolerances of the system since the cached solutions were found.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool GetPLRCacheBracket;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int InletNode; // unitary system inlet node number
+		Real64 CachePLR; // cached part load ratio
+		Real64 CacheCapFrac; // capacity fraction delivered at the cached part load ratio
+		Real64 PLREstimate; // interpolated part load ratio for the load
+
+		auto & ThisSys( UnitarySystem( UnitarySysNum ) );
+		InletNode = ThisSys.UnitarySystemInletNodeNum;
+
+		if ( std::abs( Node( InletNode ).Temp - ThisSys.PLRCacheInletTemp ) > ThisSys.PLRCacheTempToler || std::abs( Node( InletNode ).HumRat - ThisSys.PLRCacheInletHumRat ) > ThisSys.PLRCacheHumRatToler ) {
+			ThisSys.PLRCachePLR = -1.0;
+		}
+
+		CachePLR = ThisSys.PLRCachePLR( LoadType );
+		CacheCapFrac = ThisSys.PLRCacheCapFrac( LoadType );
+		if ( CachePLR <= 0.0 || CachePLR >= 1.0 || CacheCapFrac <= 0.0 || CacheCapFrac >= 1.0 || CapFrac <= 0.0 || CapFrac >= 1.0 ) {
+			GetPLRCacheBracket = false;
+			return GetPLRCacheBracket;
+		}
+
+		if ( CapFrac <= CacheCapFrac ) {
+			PLREstimate = CachePLR * CapFrac / CacheCapFrac;
+		} else {
+			PLREstimate = CachePLR + ( 1.0 - CachePLR ) * ( CapFrac - CacheCapFrac ) / ( 1.0 - CacheCapFrac );
+		}
+		MinPLR = max( 0.0, PLREstimate - ThisSys.PLRCacheBracketWidth );
+		MaxPLR = min( 1.0, PLREstimate + ThisSys.PLRCacheBracketWidth );
+
+		GetPLRCacheBracket = true;
+		return GetPLRCacheBracket;
+	}
+
+	void
+	UpdatePLRCache(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const PartLoadRatio, // Part load ratio that met the load
+		Real64 const CapFrac // Fraction of the capacity range delivered at this part load ratio
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the part load ratio that met the load in the part load ratio cache of the system.
+		// A solution for inlet conditions outside the tolerances of the cached ones replaces them all.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int InletNode; // unitary system inlet node number
+
+		auto & ThisSys( UnitarySystem( UnitarySysNum ) );
+		InletNode = ThisSys.UnitarySystemInletNodeNum;
+
+		if ( std::abs( Node( InletNode ).Temp - ThisSys.PLRCacheInletTemp ) > ThisSys.PLRCacheTempToler || std::abs( Node( InletNode ).HumRat - ThisSys.PLRCacheInletHumRat ) > ThisSys.PLRCacheHumRatToler ) {
+			ThisSys.PLRCachePLR = -1.0;
+			ThisSys.PLRCacheInletTemp = Node( InletNode ).Temp;
+			ThisSys.PLRCacheInletHumRat = Node( InletNode ).HumRat;
+		}
+		ThisSys.PLRCachePLR( LoadType ) = PartLoadRatio;
+		ThisSys.PLRCacheCapFrac( LoadType ) = CapFrac;
+
+	}
+
 	Real64
 	CalcUnitarySystemLoadResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
@@ -7341,7 +7524,7 @@ namespace HVACUnitarySystem {
 		Real64 SuppHeatCoilLoad; // load passed to supplemental heating coil (W)
 		Real64 QActual; // actual coil output (W)
 		Real64 mdot; // water coil water mass flow rate (kg/s)
-		Array1D< Real64 > Par( 5 ); // Parameter array passed to solver
+		static EP_THREAD_LOCAL Array1D< Real64 > Par( 5 ); // Parameter array passed to solver //Tuned Made static
 		int SolFla; // Flag of solver, num iterations if >0, else error index
 		Real64 PartLoadFrac; // temporary PLR variable
 
@@ -7558,7 +7741,7 @@ namespace HVACUnitarySystem {
 		Real64 OutletHumRatDXCoil; // Actual outlet humidity ratio of the DX cooling coil
 		int SolFla; // Flag of solver, num iterations if >0, else error index
 		int SolFlaLat; // Flag of solver for dehumid calculations
-		Array1D< Real64 > Par( 8 ); // Parameter array passed to solver
+		static EP_THREAD_LOCAL Array1D< Real64 > Par( 8 ); // Parameter array passed to solver //Tuned Made static
 		bool SensibleLoad; // True if there is a sensible cooling load on this system
 		bool LatentLoad; // True if there is a latent   cooling load on this system
 		int DehumidMode; // dehumidification mode (0=normal, 1=enhanced)
@@ -8470,7 +8653,7 @@ namespace HVACUnitarySystem {
 		Real64 DesOutTemp; // Desired outlet temperature of the DX cooling coil
 
 		int SolFla; // Flag of solver, num iterations if >0, else error index
-		Array1D< Real64 > Par( 8 ); // Parameter array passed to solver
+		static EP_THREAD_LOCAL Array1D< Real64 > Par( 8 ); // Parameter array passed to solver //Tuned Made static
 		bool SensibleLoad; // True if there is a sensible cooling load on this system
 		bool LatentLoad; // True if there is a latent   cooling load on this system
 		int FanOpMode; // Supply air fan operating mode
@@ -8896,7 +9079,7 @@ namespace HVACUnitarySystem {
 		Real64 QCoilActual; // Heating coil operating capacity [W]
 
 		int SolFla; // Flag of solver, num iterations if >0, else error index
-		Array1D< Real64 > Par( 5 ); // Parameter array passed to solver
+		static EP_THREAD_LOCAL Array1D< Real64 > Par( 5 ); // Parameter array passed to solver //Tuned Made static
 		bool SensibleLoad; // True if there is a sensible cooling load on this system
 		int FanOpMode; // Supply air fan operating mode
 		Real64 LoopHeatingCoilMaxRTFSave; // Used to find RTF of heating coils without overwriting globabl variable
@@ -9968,7 +10151,7 @@ namespace HVACUnitarySystem {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Chandan Sharma
 		//       DATE WRITTEN   July 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, skip the unit loads when its heating and cooling rates are not stored
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -10027,7 +10210,8 @@ namespace HVACUnitarySystem {
 
 		OutletNode = UnitarySystem( UnitarySysNum ).UnitarySystemOutletNodeNum;
 		AirMassFlow = Node( OutletNode ).MassFlowRate;
-		{ auto const SELECT_CASE_var( UnitarySystem( UnitarySysNum ).ControlType );
+		// The unit loads only feed the heating and cooling rate report variables
+		if ( ReportLoadRates( UnitarySysNum ) ) { auto const SELECT_CASE_var( UnitarySystem( UnitarySysNum ).ControlType );
 		if ( SELECT_CASE_var == SetPointBased ) {
 			InletNode = UnitarySystem( UnitarySysNum ).UnitarySystemInletNodeNum;
 			MinHumRatio = Node( InletNode ).HumRat;
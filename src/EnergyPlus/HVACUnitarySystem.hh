@@ -82,6 +82,7 @@ namespace HVACUnitarySystem {
 	extern Array1D_bool CheckEquipName;
 	extern Array1D_bool MultiOrVarSpeedHeatCoil;
 	extern Array1D_bool MultiOrVarSpeedCoolCoil;
+	extern Array1D_bool ReportLoadRates; // True if any of the unit's heating or cooling rates is stored for output
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -418,6 +419,15 @@ namespace HVACUnitarySystem {
 		int CoolIndexAvail; // Index used to minimize the occurrence of output warnings
 		int HeatCountAvail; // Counter used to minimize the occurrence of output warnings
 		int HeatIndexAvail; // Index used to minimize the occurrence of output warnings
+		// Part load ratio cache
+		bool PLRCacheOn; // If true, the sensible part load ratio search is seeded from the cache
+		Real64 PLRCacheTempToler; // Inlet temperature change that clears the cache [deltaC]
+		Real64 PLRCacheHumRatToler; // Inlet humidity ratio change that clears the cache [kgWater/kgDryAir]
+		Real64 PLRCacheBracketWidth; // Part load ratio searched on either side of the cached estimate
+		Real64 PLRCacheInletTemp; // Inlet temperature of the cached solutions [C]
+		Real64 PLRCacheInletHumRat; // Inlet humidity ratio of the cached solutions [kgWater/kgDryAir]
+		Array1D< Real64 > PLRCachePLR; // Cached part load ratio for heating (1) and cooling (2), < 0 if none
+		Array1D< Real64 > PLRCacheCapFrac; // Fraction of the capacity range delivered at the cached part load ratio
 
 		// Default Constructor
 		UnitarySystemData() :
@@ -663,7 +673,15 @@ namespace HVACUnitarySystem {
 			CoolCountAvail( 0 ),
 			CoolIndexAvail( 0 ),
 			HeatCountAvail( 0 ),
-			HeatIndexAvail( 0 )
+			HeatIndexAvail( 0 ),
+			PLRCacheOn( false ),
+			PLRCacheTempToler( 0.2 ),
+			PLRCacheHumRatToler( 0.0002 ),
+			PLRCacheBracketWidth( 0.05 ),
+			PLRCacheInletTemp( 0.0 ),
+			PLRCacheInletHumRat( 0.0 ),
+			PLRCachePLR( 2, -1.0 ),
+			PLRCacheCapFrac( 2, 0.0 )
 		{}
 
 		// Member Constructor
@@ -923,7 +941,15 @@ namespace HVACUnitarySystem {
 			int const CoolCountAvail, // Counter used to minimize the occurrence of output warnings
 			int const CoolIndexAvail, // Index used to minimize the occurrence of output warnings
 			int const HeatCountAvail, // Counter used to minimize the occurrence of output warnings
-			int const HeatIndexAvail // Index used to minimize the occurrence of output warnings
+			int const HeatIndexAvail, // Index used to minimize the occurrence of output warnings
+			bool const PLRCacheOn, // If true, the sensible part load ratio search is seeded from the cache
+			Real64 const PLRCacheTempToler, // Inlet temperature change that clears the cache [deltaC]
+			Real64 const PLRCacheHumRatToler, // Inlet humidity ratio change that clears the cache [kgWater/kgDryAir]
+			Real64 const PLRCacheBracketWidth, // Part load ratio searched on either side of the cached estimate
+			Real64 const PLRCacheInletTemp, // Inlet temperature of the cached solutions [C]
+			Real64 const PLRCacheInletHumRat, // Inlet humidity ratio of the cached solutions [kgWater/kgDryAir]
+			Array1< Real64 > const & PLRCachePLR, // Cached part load ratio for heating (1) and cooling (2), < 0 if none
+			Array1< Real64 > const & PLRCacheCapFrac // Fraction of the capacity range delivered at the cached part load ratio
 		) :
 			UnitarySystemType( UnitarySystemType ),
 			UnitarySystemType_Num( UnitarySystemType_Num ),
@@ -1180,7 +1206,15 @@ namespace HVACUnitarySystem {
 			CoolCountAvail( CoolCountAvail ),
 			CoolIndexAvail( CoolIndexAvail ),
 			HeatCountAvail( HeatCountAvail ),
-			HeatIndexAvail( HeatIndexAvail )
+			HeatIndexAvail( HeatIndexAvail ),
+			PLRCacheOn( PLRCacheOn ),
+			PLRCacheTempToler( PLRCacheTempToler ),
+			PLRCacheHumRatToler( PLRCacheHumRatToler ),
+			PLRCacheBracketWidth( PLRCacheBracketWidth ),
+			PLRCacheInletTemp( PLRCacheInletTemp ),
+			PLRCacheInletHumRat( PLRCacheInletHumRat ),
+			PLRCachePLR( 2, PLRCachePLR ),
+			PLRCacheCapFrac( 2, PLRCacheCapFrac )
 		{}
 
 	};
@@ -1324,6 +1358,23 @@ namespace HVACUnitarySystem {
 		Real64 const PartLoadRatio // operating PLR
 	);
 
+	bool
+	GetPLRCacheBracket(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const CapFrac, // Fraction of the capacity range (PLR = 0 to 1) needed to meet the load
+		Real64 & MinPLR, // Lower end of the seeded part load ratio range
+		Real64 & MaxPLR // Upper end of the seeded part load ratio range
+	);
+
+	void
+	UpdatePLRCache(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const PartLoadRatio, // Part load ratio that met the load
+		Real64 const CapFrac // Fraction of the capacity range delivered at this part load ratio
+	);
+
 	Real64
 	CalcUnitarySystemLoadResidual(
 		Real64 const PartLoadRatio, // DX cooling coil part load ratio
@@ -4653,7 +4653,7 @@ namespace HVACVariableRefrigerantFlow {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start the search from the last solution of the terminal unit
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4661,6 +4661,8 @@ namespace HVACVariableRefrigerantFlow {
 
 		// METHODOLOGY EMPLOYED:
 		// Use RegulaFalsi technique to iterate on part-load ratio until convergence is achieved.
+		// The search first looks in a narrow range around an estimate from the last part-load ratio
+		// found for the same kind of load, and over the full range if the load is not met in it.
 
 		// REFERENCES:
 		// na
@@ -4705,6 +4707,8 @@ namespace HVACVariableRefrigerantFlow {
 		bool VRFHeatingMode;
 		bool HRCoolingMode;
 		bool HRHeatingMode;
+		int PLRCacheLoadType; // part load ratio cache entry, 1 for a heating load, 2 for a cooling load
+		Real64 CapFrac; // fraction of the capacity range (PLR = 0 to 1) needed to meet the load
 
 		PartLoadRatio = 0.0;
 		LoopDXCoolCoilRTF = 0.0;
@@ -4763,6 +4767,7 @@ namespace HVACVariableRefrigerantFlow {
 				if ( VRFTU( VRFTUNum ).CoolingCoilPresent ) PartLoadRatio = 1.0;
 				return;
 			}
+			PLRCacheLoadType = 2;
 		} else if ( ( VRFHeatingMode && ! VRF( VRFCond ).HeatRecoveryUsed ) || ( VRF( VRFCond ).HeatRecoveryUsed && HRHeatingMode ) ) {
 			// Since we are heating, we expect FullOutput > NoCompOutput
 			// If the QZnReq >= FullOutput the unit needs to run full out
@@ -4771,6 +4776,7 @@ namespace HVACVariableRefrigerantFlow {
 				if ( VRFTU( VRFTUNum ).HeatingCoilPresent ) PartLoadRatio = 1.0;
 				return;
 			}
+			PLRCacheLoadType = 1;
 		} else {
 			// VRF terminal unit is off, PLR already set to 0 above
 			// shouldn't actually get here
@@ -4792,7 +4798,20 @@ namespace HVACVariableRefrigerantFlow {
 			//    Par(4) = OpMode
 			Par( 5 ) = QZnReq;
 			Par( 6 ) = OnOffAirFlowRatio;
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+			CapFrac = ( QZnReq - NoCompOutput ) / ( FullOutput - NoCompOutput );
+			if ( GetVRFTUPLRBracket( VRFTUNum, PLRCacheLoadType, CapFrac, TempMinPLR, TempMaxPLR ) ) {
+				// Search the range around the last solution first and the full range if the load is not met in it
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				if ( SolFla == -2 ) {
+					SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+				}
+			} else {
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+			}
+			if ( SolFla > 0 ) {
+				VRFTU( VRFTUNum ).PLRCachePLR( PLRCacheLoadType ) = PartLoadRatio;
+				VRFTU( VRFTUNum ).PLRCacheCapFrac( PLRCacheLoadType ) = CapFrac;
+			}
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -5315,6 +5334,77 @@ namespace HVACVariableRefrigerantFlow {
 
 	// Utility subroutines for the Module
 
+	bool
+	GetVRFTUPLRBracket(
+		int const VRFTUNum, // Index to VRF terminal unit
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const CapFrac, // Fraction of the capacity range (PLR = 0 to 1) needed to meet the load
+		Real64 & MinPLR, // Lower end of the seeded part load ratio range
+		Real64 & MaxPLR // Upper end of the seeded part load ratio range
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns a narrow part load ratio range in which to search for the PLR that meets the load,
+		// estimated from the last PLR found by the terminal unit for the same kind of load.
+		// Returns false if there is no such solution.
+
+		// METHODOLOGY EMPLOYED:
+		// The delivered capacity is interpolated as a function of PLR through (0,0), the cached
+		// (PLR, capacity fraction) and (1,1), and inverted for the capacity fraction of the load.
+		// The capacity fractions are relative to the outputs at PLR = 0 and 1 at the time, so the
+		// estimate follows changes in the capacity of the terminal unit.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		bool GetVRFTUPLRBracket;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const BracketWidth( 0.05 ); // part load ratio searched on either side of the estimate
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 CachePLR; // cached part load ratio
+		Real64 CacheCapFrac; // capacity fraction delivered at the cached part load ratio
+		Real64 PLREstimate; // interpolated part load ratio for the load
+
+		CachePLR = VRFTU( VRFTUNum ).PLRCachePLR( LoadType );
+		CacheCapFrac = VRFTU( VRFTUNum ).PLRCacheCapFrac( LoadType );
+		if ( CachePLR <= 0.0 || CachePLR >= 1.0 || CacheCapFrac <= 0.0 || CacheCapFrac >= 1.0 || CapFrac <= 0.0 || CapFrac >= 1.0 ) {
+			GetVRFTUPLRBracket = false;
+			return GetVRFTUPLRBracket;
+		}
+
+		if ( CapFrac <= CacheCapFrac ) {
+			PLREstimate = CachePLR * CapFrac / CacheCapFrac;
+		} else {
+			PLREstimate = CachePLR + ( 1.0 - CachePLR ) * ( CapFrac - CacheCapFrac ) / ( 1.0 - CacheCapFrac );
+		}
+		MinPLR = max( 0.0, PLREstimate - BracketWidth );
+		MaxPLR = min( 1.0, PLREstimate + BracketWidth );
+
+		GetVRFTUPLRBracket = true;
+		return GetVRFTUPLRBracket;
+	}
+
 	Real64
 	PLRResidual(
 		Real64 const PartLoadRatio, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
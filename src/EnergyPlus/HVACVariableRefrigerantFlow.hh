@@ -928,6 +928,8 @@ namespace HVACVariableRefrigerantFlow {
 		int FirstIterfailed; // index used for warning messages
 		int ZonePtr; // pointer to a zone served by a VRF terminal unit
 		int HVACSizingIndex; // index of a HVACSizing object for a VRF terminal
+		Array1D< Real64 > PLRCachePLR; // last converged part load ratio for a heating (1) and cooling (2) load, -1 if none
+		Array1D< Real64 > PLRCacheCapFrac; // fraction of the PLR = 0 to 1 capacity range delivered at PLRCachePLR
 		// Default Constructor
 		VRFTerminalUnitEquipment() :
 			VRFTUType_Num( 0 ),
@@ -999,7 +1001,9 @@ namespace HVACVariableRefrigerantFlow {
 			IterLimitExceeded( 0 ),
 			FirstIterfailed( 0 ),
 			ZonePtr( 0 ),
-			HVACSizingIndex( 0 )
+			HVACSizingIndex( 0 ),
+			PLRCachePLR( 2, -1.0 ),
+			PLRCacheCapFrac( 2, -1.0 )
 		{}
 
 		// Member Constructor
@@ -1150,7 +1154,9 @@ namespace HVACVariableRefrigerantFlow {
 			IterLimitExceeded( IterLimitExceeded ),
 			FirstIterfailed( FirstIterfailed ),
 			ZonePtr( ZonePtr ),
-			HVACSizingIndex( HVACSizingIndex )
+			HVACSizingIndex( HVACSizingIndex ),
+			PLRCachePLR( 2, -1.0 ),
+			PLRCacheCapFrac( 2, -1.0 )
 		{}
 
 	};
@@ -1303,6 +1309,15 @@ namespace HVACVariableRefrigerantFlow {
 	void
 	UpdateVRFCondenser( int const VRFCond ); // index to VRF condensing unit
 
+	bool
+	GetVRFTUPLRBracket(
+		int const VRFTUNum, // Index to VRF terminal unit
+		int const LoadType, // 1 for a heating load, 2 for a cooling load
+		Real64 const CapFrac, // Fraction of the capacity range (PLR = 0 to 1) needed to meet the load
+		Real64 & MinPLR, // Lower end of the seeded part load ratio range
+		Real64 & MaxPLR // Upper end of the seeded part load ratio range
+	);
+
 	Real64
 	PLRResidual(
 		Real64 const PartLoadRatio, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
@@ -157,6 +157,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	int CondFDSchemeType( FullyImplicitFirstOrder ); // solution scheme for CondFD - default
+	bool TridiagonalLayerSolve( false ); // TRUE if the interior nodes of each layer are solved directly (Thomas algorithm)
 	Real64 SpaceDescritConstant( 3.0 ); // spatial descritization constant,
 	Real64 MinTempLimit( -100.0 ); // lower limit check, degree C
 	Real64 MaxTempLimit( 100.0 ); // upper limit check, degree C
@@ -336,6 +337,21 @@ namespace HeatBalFiniteDiffManager {
 				MaxAllowedDelTempCondFD = rNumericArgs( 3 );
 			}
 
+			if ( NumAlphas >= 2 && ! lAlphaFieldBlanks( 2 ) ) {
+
+				{ auto const SELECT_CASE_var( cAlphaArgs( 2 ) );
+
+				if ( SELECT_CASE_var == "GAUSSSEIDEL" ) {
+					TridiagonalLayerSolve = false;
+				} else if ( SELECT_CASE_var == "TRIDIAGONAL" ) {
+					TridiagonalLayerSolve = true;
+				} else {
+					ShowSevereError( cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered=" + cAlphaArgs( 2 ) + ", must match GaussSeidel or Tridiagonal." );
+					ErrorsFound = true;
+				}}
+
+			}
+
 		} // settings object
 
 		pcMat = GetNumObjectsFound( "MaterialProperty:PhaseChange" );
@@ -940,6 +956,10 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).EnthOld.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).EnthNew.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).EnthLast.allocate( TotNodes + 1 );
+			if ( TridiagonalLayerSolve ) {
+				SurfaceFD( Surf ).TriDiagUpper.allocate( TotNodes + 1 );
+				SurfaceFD( Surf ).TriDiagRhs.allocate( TotNodes + 1 );
+			}
 
 			//Initialize the allocated arrays.
 			SurfaceFD( Surf ).T = TempInitValue;
@@ -1067,7 +1087,7 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
+		Real64 MaxDelTemp( 0.0 ); // Not static: surfaces may be solved in parallel
 
 		int const ConstrNum( Surface( Surf ).Construction );
 
@@ -1120,9 +1140,16 @@ namespace HeatBalFiniteDiffManager {
 					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
 
 					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+						int const ctr_end( ConstructFD( ConstrNum ).NodeNumPoint( Lay ) );
+						if ( TridiagonalLayerSolve && ( ctr_end >= 2 ) ) {
+							// All interior nodes of the layer at once, between the current values of the bounding nodes
+							InteriorNodesTridiagonal( Delt, i + 1, i + ctr_end - 1, Lay, Surf, TD, TDT, EnthOld, EnthNew, surfaceFD.TriDiagUpper, surfaceFD.TriDiagRhs );
+							i += ctr_end - 1;
+						} else {
+							for ( int ctr = 2; ctr <= ctr_end; ++ctr ) {
+								++i;
+								InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+							}
 						}
 					}
 
@@ -1259,8 +1286,8 @@ namespace HeatBalFiniteDiffManager {
 		static gio::Fmt Format_701( "(' Material CondFD Summary,',A,',',A,',',A,',',A,',',A,',',A)" );
 		static gio::Fmt Format_702( "(' ConductionFiniteDifference Node,',A,',',A,',',A,',',A,',',A)" );
 
-		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria";
-		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 );
+		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria,Layer Interior Node Solution";
+		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 ) + ',' + ( TridiagonalLayerSolve ? "Tridiagonal" : "GaussSeidel" );
 		ScanForReports( "Constructions", DoReport, "Constructions" );
 
 		if ( DoReport ) {
@@ -1723,13 +1750,77 @@ namespace HeatBalFiniteDiffManager {
 
 		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
 		auto const & mat( Material( MatLay ) );
-		auto const & matFD( MaterialFD( MatLay ) );
 
 		auto const TD_i( TD( i ) );
 
 		auto const TDT_m( TDT( i - 1 ) );
 		auto TDT_i( TDT( i ) );
 		auto const TDT_p( TDT( i + 1 ) );
+
+		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
+		Real64 ktA2; // Thermal Inner conductivity in temperature equation
+		Real64 Cp; // Cp used // Changed if PCM
+		InteriorNodeProperties( i, Lay, Surf, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+
+		Real64 const RhoS( mat.Density );
+		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
+			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
+		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
+			Real64 const invDelX( 1.0 / DelX );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
+		} else {
+			assert( false ); // Illegal CondFDSchemeType
+		}
+
+		// Limit clipping
+		if ( TDT_i < MinSurfaceTempLimit ) {
+			TDT_i = MinSurfaceTempLimit;
+		} else if ( TDT_i > MaxSurfaceTempLimit ) {
+			TDT_i = MaxSurfaceTempLimit;
+		}
+
+		TDT( i ) = TDT_i;
+	}
+
+	void
+	InteriorNodeProperties(
+		int const i, // Node Index
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // Node temperatures at the start of the time step
+		Array1< Real64 > const & TDT, // Node temperatures of the current iteration
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Thermal conductivity between node i and node i+1
+		Real64 & ktA2, // Thermal conductivity between node i-1 and node i
+		Real64 & Cp // Specific heat, from the enthalpy change for phase change materials
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Richard Liesen
+		//       DATE WRITTEN   November, 2003
+		//       MODIFIED       Oct 2026, moved out of InteriorNodeEqns for use by InteriorNodesTridiagonal
+		//       RE-ENGINEERED  C. O. Pedersen, 2006
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates the temperature dependent conductivities and specific heat of a layer interior node
+		// at the current iteration temperatures.
+
+		int const ConstrNum( Surface( Surf ).Construction );
+
+		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
+		auto const & mat( Material( MatLay ) );
+		auto const & matFD( MaterialFD( MatLay ) );
+
+		auto const TD_i( TD( i ) );
+
+		auto const TDT_m( TDT( i - 1 ) );
+		auto const TDT_i( TDT( i ) );
+		auto const TDT_p( TDT( i + 1 ) );
 		auto const TDT_mi( ( TDT_m + TDT_i ) / 2.0 );
 		auto const TDT_ip( ( TDT_i + TDT_p ) / 2.0 );
 
@@ -1737,8 +1828,6 @@ namespace HeatBalFiniteDiffManager {
 		auto const & matFD_TempCond( matFD.TempCond );
 		assert( matFD_TempCond.u2() >= 3 );
 		auto const lTC( matFD_TempCond.index( 2, 1 ) );
-		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
-		Real64 ktA2; // Thermal Inner conductivity in temperature equation
 		if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
 			ktA1 = terpld( matFD.TempCond, TDT_ip, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
 			ktA2 = terpld( matFD.TempCond, TDT_mi, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
@@ -1752,7 +1841,7 @@ namespace HeatBalFiniteDiffManager {
 		}
 
 		Real64 const Cpo( mat.SpecHeat ); // Const Cp from input
-		Real64 Cp( Cpo ); // Cp used // Will be changed if PCM
+		Cp = Cpo; // Will be changed if PCM
 		auto const & matFD_TempEnth( matFD.TempEnth );
 		assert( matFD_TempEnth.u2() >= 3 );
 		auto const lTE( matFD_TempEnth.index( 2, 1 ) );
@@ -1763,28 +1852,89 @@ namespace HeatBalFiniteDiffManager {
 				Cp = max( Cpo, ( EnthNew( i ) - EnthOld( i ) ) / ( TDT_i - TD_i ) );
 			}
 		} // Phase Change case
+	}
+
+	void
+	InteriorNodesTridiagonal(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // Node temperatures at the start of the time step
+		Array1< Real64 > & TDT, // Node temperatures of the current iteration
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Array1< Real64 > & Upper, // Work array for the eliminated upper diagonal
+		Array1< Real64 > & Rhs // Work array for the eliminated right hand side
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the InteriorNodeEqns of all interior nodes of one layer together, with the
+		// bounding exterior/interface/interior nodes held at their current values.
+
+		// METHODOLOGY EMPLOYED:
+		// The node equations are tridiagonal once the conductivities and the phase change specific heat
+		// are evaluated at the current iteration temperatures, so they are solved directly by the Thomas
+		// algorithm. The outer iteration in CalcHeatBalFiniteDiff still updates these properties and the
+		// bounding nodes, but heat no longer has to diffuse through the layer one node per iteration.
+		// TDT is only overwritten in the back substitution, so all properties see the previous iterate.
 
+		int const ConstrNum( Surface( Surf ).Construction );
+		auto const & mat( Material( Construct( ConstrNum ).LayerPoint( Lay ) ) );
 		Real64 const RhoS( mat.Density );
 		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
-		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
-		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
-			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
-		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
-			Real64 const invDelX( 1.0 / DelX );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
-		} else {
-			assert( false ); // Illegal CondFDSchemeType
+		bool const SecondOrder( CondFDSchemeType == CrankNicholsonSecondOrder );
+		Real64 const invDelX( SecondOrder ? 1.0 / ( 2.0 * DelX ) : 1.0 / DelX );
+
+		// Forward elimination
+		for ( int i = iFirst; i <= iLast; ++i ) {
+			Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
+			Real64 ktA2; // Thermal Inner conductivity in temperature equation
+			Real64 Cp; // Cp used // Changed if PCM
+			InteriorNodeProperties( i, Lay, Surf, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+
+			Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+			Real64 const west( ktA2 * invDelX ); // Coupling to node i-1
+			Real64 const east( ktA1 * invDelX ); // Coupling to node i+1
+			Real64 diag( west + east + Cp_DelX_RhoS_Delt );
+			Real64 rhs( Cp_DelX_RhoS_Delt * TD( i ) );
+			if ( SecondOrder ) { // Adams-Moulton second order
+				rhs += east * ( TD( i + 1 ) - TD( i ) ) + west * ( TD( i - 1 ) - TD( i ) );
+			}
+			if ( i == iFirst ) {
+				rhs += west * TDT( i - 1 );
+			} else {
+				diag -= west * Upper( i - 1 );
+				rhs += west * Rhs( i - 1 );
+			}
+			if ( i == iLast ) {
+				rhs += east * TDT( i + 1 );
+				Upper( i ) = 0.0;
+			} else {
+				Upper( i ) = east / diag;
+			}
+			Rhs( i ) = rhs / diag;
 		}
 
-		// Limit clipping
-		if ( TDT_i < MinSurfaceTempLimit ) {
-			TDT_i = MinSurfaceTempLimit;
-		} else if ( TDT_i > MaxSurfaceTempLimit ) {
-			TDT_i = MaxSurfaceTempLimit;
+		// Back substitution with limit clipping
+		for ( int i = iLast; i >= iFirst; --i ) {
+			Real64 TDT_i( Rhs( i ) );
+			if ( i < iLast ) TDT_i += Upper( i ) * TDT( i + 1 );
+			if ( TDT_i < MinSurfaceTempLimit ) {
+				TDT_i = MinSurfaceTempLimit;
+			} else if ( TDT_i > MaxSurfaceTempLimit ) {
+				TDT_i = MaxSurfaceTempLimit;
+			}
+			TDT( i ) = TDT_i;
 		}
-
-		TDT( i ) = TDT_i;
 	}
 
 	void
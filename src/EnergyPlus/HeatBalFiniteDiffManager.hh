@@ -58,6 +58,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	extern int CondFDSchemeType; // solution scheme for CondFD - default
+	extern bool TridiagonalLayerSolve; // TRUE if the interior nodes of each layer are solved directly (Thomas algorithm)
 	extern Real64 SpaceDescritConstant; // spatial descritization constant,
 	extern Real64 MinTempLimit; // lower limit check, degree C
 	extern Real64 MaxTempLimit; // upper limit check, degree C
@@ -143,6 +144,8 @@ namespace HeatBalFiniteDiffManager {
 		Array1D< Real64 > EnthOld; // Current node enthalpy
 		Array1D< Real64 > EnthNew; // Node enthalpy at new time
 		Array1D< Real64 > EnthLast;
+		Array1D< Real64 > TriDiagUpper; // Eliminated upper diagonal for the layer interior node solve
+		Array1D< Real64 > TriDiagRhs; // Eliminated right hand side for the layer interior node solve
 		int GSloopCounter; // count of inner loop iterations
 		int GSloopErrorCount; // recurring error counter
 		Real64 MaxNodeDelTemp; // largest change in node temps after calc
@@ -172,6 +175,8 @@ namespace HeatBalFiniteDiffManager {
 			Array1< Real64 > const & EnthOld, // Current node enthalpy
 			Array1< Real64 > const & EnthNew, // Node enthalpy at new time
 			Array1< Real64 > const & EnthLast,
+			Array1< Real64 > const & TriDiagUpper, // Eliminated upper diagonal for the layer interior node solve
+			Array1< Real64 > const & TriDiagRhs, // Eliminated right hand side for the layer interior node solve
 			int const GSloopCounter, // count of inner loop iterations
 			int const GSloopErrorCount, // recurring error counter
 			Real64 const MaxNodeDelTemp // largest change in node temps after calc
@@ -192,6 +197,8 @@ namespace HeatBalFiniteDiffManager {
 			EnthOld( EnthOld ),
 			EnthNew( EnthNew ),
 			EnthLast( EnthLast ),
+			TriDiagUpper( TriDiagUpper ),
+			TriDiagRhs( TriDiagRhs ),
 			GSloopCounter( GSloopCounter ),
 			GSloopErrorCount( GSloopErrorCount ),
 			MaxNodeDelTemp( MaxNodeDelTemp )
@@ -336,6 +343,35 @@ namespace HeatBalFiniteDiffManager {
 		Array1< Real64 > & EnthNew // New Nodal enthalpy
 	);
 
+	void
+	InteriorNodeProperties(
+		int const i, // Node Index
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // Node temperatures at the start of the time step
+		Array1< Real64 > const & TDT, // Node temperatures of the current iteration
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Thermal conductivity between node i and node i+1
+		Real64 & ktA2, // Thermal conductivity between node i-1 and node i
+		Real64 & Cp // Specific heat, from the enthalpy change for phase change materials
+	);
+
+	void
+	InteriorNodesTridiagonal(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // Node temperatures at the start of the time step
+		Array1< Real64 > & TDT, // Node temperatures of the current iteration
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Array1< Real64 > & Upper, // Work array for the eliminated upper diagonal
+		Array1< Real64 > & Rhs // Work array for the eliminated right hand side
+	);
+
 	void
 	IntInterfaceNodeEqns(
 		int const Delt, // Time Increment
@@ -18,6 +18,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneControls.hh>
 #include <EMSManager.hh>
 #include <General.hh>
@@ -192,6 +193,8 @@ namespace HeatBalanceAirManager {
 
 		// FLOW:
 
+		DataTimings::ProfileTimer const profileTimer( "GetAirHeatBalanceInput" ); // Region of the timing profile
+
 		CrossMixingFlag.dimension( NumOfZones, false );
 		GetAirFlowFlag( ErrorsFound );
 
@@ -16,6 +16,7 @@
 #include <DataHeatBalSurface.hh>
 #include <DataMoistureBalance.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -119,6 +120,15 @@ namespace HeatBalanceHAMTManager {
 	Array1D< Real64 > surftemp;
 	Array1D< Real64 > surfexttemp;
 	Array1D< Real64 > surfvp;
+	Array1D_int surfitter; // Iterations of the last cell solution of each surface (reporting)
+
+	// The solved cells of a surface (Extcell to Intcell) form a chain, so with HAMTDirectCellSolve their equations
+	// are assembled into these tridiagonal coefficients, indexed by cell, and solved together
+	Array1D_bool cellchain; // TRUE if each solved cell of a surface only connects to the cells before and after it
+	Array1D< Real64 > celllower; // Coefficient of the previous cell in the equation of each cell (direct solution)
+	Array1D< Real64 > celldiag; // Diagonal coefficient of the equation of each cell (direct solution)
+	Array1D< Real64 > cellupper; // Coefficient of the next cell in the equation of each cell (direct solution)
+	Array1D< Real64 > cellrhs; // Right hand side of the equation of each cell, replaced by the solution
 
 	Array1D< Real64 > extvtc; // External Surface vapor transfer coefficient
 	Array1D< Real64 > intvtc; // Internal Surface Vapor Transfer Coefficient
@@ -279,6 +289,10 @@ namespace HeatBalanceHAMTManager {
 		surftemp.allocate( TotSurfaces );
 		surfexttemp.allocate( TotSurfaces );
 		surfvp.allocate( TotSurfaces );
+		surfitter.allocate( TotSurfaces );
+		surfitter = 0;
+		cellchain.allocate( TotSurfaces );
+		cellchain = false;
 
 		firstcell.allocate( TotSurfaces );
 		lastcell.allocate( TotSurfaces );
@@ -765,6 +779,10 @@ namespace HeatBalanceHAMTManager {
 
 		// Make the cells and initialise
 		cells.allocate( TotCellsMax );
+		celllower.dimension( TotCellsMax, 0.0 );
+		celldiag.dimension( TotCellsMax, 0.0 );
+		cellupper.dimension( TotCellsMax, 0.0 );
+		cellrhs.dimension( TotCellsMax, 0.0 );
 		cells.adjs() = -1;
 		cells.adjsl() = -1;
 
@@ -930,6 +948,17 @@ namespace HeatBalanceHAMTManager {
 			SetupOutputVariable( "HAMT Surface Inside Face Vapor Pressure [Pa]", surfvp( sid ), "Zone", "State", Surface( sid ).Name );
 			SetupOutputVariable( "HAMT Surface Outside Face Temperature [C]", surfexttemp( sid ), "Zone", "State", Surface( sid ).Name );
 			SetupOutputVariable( "HAMT Surface Outside Face Relative Humidity [%]", surfextrh( sid ), "Zone", "State", Surface( sid ).Name );
+			SetupOutputVariable( "HAMT Surface Iteration Count []", surfitter( sid ), "Zone", "Sum", Surface( sid ).Name );
+
+			// The adjacency of the cells does not change, so check once whether the solved cells form a chain
+			cellchain( sid ) = true;
+			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+				for ( ii = 1; ii <= adjmax; ++ii ) {
+					int const adj( cells( cid ).adjs( ii ) );
+					if ( adj == -1 ) break;
+					if ( ( adj >= Extcell( sid ) ) && ( adj <= Intcell( sid ) ) && ( adj != cid - 1 ) && ( adj != cid + 1 ) ) cellchain( sid ) = false;
+				}
+			}
 
 			// write cell origins to initilisation output file
 			conid = Surface( sid ).Construction;
@@ -980,7 +1009,8 @@ namespace HeatBalanceHAMTManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Phillip Biddulph
 		//       DATE WRITTEN   June 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, temperature limits checked on this surface's cells only,
+		//                      warnings serialized so that surfaces can be solved in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -996,6 +1026,7 @@ namespace HeatBalanceHAMTManager {
 		using General::RoundSigDigits;
 		using DataSurfaces::OtherSideCondModeledExt;
 		using DataSurfaces::OSCM;
+		using DataSystemVariables::HAMTDirectCellSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1048,6 +1079,9 @@ namespace HeatBalanceHAMTManager {
 		static int qvpErrReport( 0 );
 		Real64 denominator;
 
+		// Solve the cells of the surface together when their equations form a tridiagonal system
+		bool const directsolve( HAMTDirectCellSolve && cellchain( sid ) );
+
 		if ( BeginEnvrnFlag && MyEnvrnFlag( sid ) ) {
 			cells( Extcell( sid ) ).rh = 0.0;
 			cells( Extcell( sid ) ).rhp1 = 0.0;
@@ -1194,6 +1228,8 @@ namespace HeatBalanceHAMTManager {
 				torsum = 0.0;
 				oorsum = 0.0;
 				vpdiff = 0.0;
+				celllower( cid ) = 0.0;
+				cellupper( cid ) = 0.0;
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
@@ -1233,7 +1269,13 @@ namespace HeatBalanceHAMTManager {
 
 					if ( thermr1 + thermr2 > 0 ) {
 						oorsum += 1.0 / ( thermr1 + thermr2 );
-						torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						if ( directsolve && ( adj == cid - 1 ) && ( adj >= Extcell( sid ) ) ) {
+							celllower( cid ) = -1.0 / ( thermr1 + thermr2 );
+						} else if ( directsolve && ( adj == cid + 1 ) && ( adj <= Intcell( sid ) ) ) {
+							cellupper( cid ) = -1.0 / ( thermr1 + thermr2 );
+						} else {
+							torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						}
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpdiff += ( cells( adj ).vp - cells( cid ).vp ) / ( vaporr1 + vaporr2 );
@@ -1250,6 +1292,9 @@ namespace HeatBalanceHAMTManager {
 					qvp = vpdiff * whv;
 				}
 				if ( std::abs( qvp ) > qvplim ) {
+#ifdef _OPENMP
+#pragma omp critical ( HAMTWarnings )
+#endif
 					if ( ! WarmupFlag ) {
 						++qvpErrCount;
 						if ( qvpErrCount < 16 ) {
@@ -1262,13 +1307,32 @@ namespace HeatBalanceHAMTManager {
 				}
 
 				// Calculate the temperature for the next time step
-				cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				if ( directsolve ) {
+					celldiag( cid ) = oorsum + ( tcap / deltat );
+					cellrhs( cid ) = torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat );
+				} else {
+					cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				}
+			}
+			if ( directsolve ) {
+				SolveCellChain( Extcell( sid ), Intcell( sid ) );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).tempp1 = cellrhs( cid );
+				}
 			}
 
 			//Check for silly temperatures
-			tempmax = maxval( cells.tempp1() );
-			tempmin = minval( cells.tempp1() );
+			// Only the cells of this surface, which may be solved on another thread than the other surfaces
+			tempmax = cells( firstcell( sid ) ).tempp1;
+			tempmin = cells( firstcell( sid ) ).tempp1;
+			for ( cid = firstcell( sid ) + 1; cid <= lastcell( sid ); ++cid ) {
+				tempmax = max( tempmax, cells( cid ).tempp1 );
+				tempmin = min( tempmin, cells( cid ).tempp1 );
+			}
 			if ( tempmax > MaxSurfaceTempLimit ) {
+#ifdef _OPENMP
+#pragma omp critical ( HAMTWarnings )
+#endif
 				if ( ! WarmupFlag ) {
 					if ( Surface( sid ).HighTempErrCount == 0 ) {
 						ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
@@ -1278,6 +1342,9 @@ namespace HeatBalanceHAMTManager {
 				}
 			}
 			if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
+#ifdef _OPENMP
+#pragma omp critical ( HAMTWarnings )
+#endif
 				if ( ! WarmupFlag ) {
 					ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
 					ShowContinueErrorTimeStamp( "" );
@@ -1285,6 +1352,9 @@ namespace HeatBalanceHAMTManager {
 				}
 			}
 			if ( tempmin < MinSurfaceTempLimit ) {
+#ifdef _OPENMP
+#pragma omp critical ( HAMTWarnings )
+#endif
 				if ( ! WarmupFlag ) {
 					if ( Surface( sid ).HighTempErrCount == 0 ) {
 						ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
@@ -1294,6 +1364,9 @@ namespace HeatBalanceHAMTManager {
 				}
 			}
 			if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
+#ifdef _OPENMP
+#pragma omp critical ( HAMTWarnings )
+#endif
 				if ( ! WarmupFlag ) {
 					ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
 					ShowContinueErrorTimeStamp( "" );
@@ -1307,6 +1380,8 @@ namespace HeatBalanceHAMTManager {
 				phiorsum = 0.0;
 				vpoosum = 0.0;
 				vporsum = 0.0;
+				celllower( cid ) = 0.0;
+				cellupper( cid ) = 0.0;
 
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
@@ -1347,7 +1422,13 @@ namespace HeatBalanceHAMTManager {
 					//             IF(rhr1+rhr2>0)THEN
 					if ( rhr1 * rhr2 > 0 ) {
 						phioosum += 1.0 / ( rhr1 + rhr2 );
-						phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						if ( directsolve && ( adj == cid - 1 ) && ( adj >= Extcell( sid ) ) ) {
+							celllower( cid ) = -1.0 / ( rhr1 + rhr2 );
+						} else if ( directsolve && ( adj == cid + 1 ) && ( adj <= Intcell( sid ) ) ) {
+							cellupper( cid ) = -1.0 / ( rhr1 + rhr2 );
+						} else {
+							phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						}
 					}
 
 				}
@@ -1362,6 +1443,11 @@ namespace HeatBalanceHAMTManager {
 				// Calculate the RH for the next time step
 				denominator = ( phioosum + vpoosum * cells( cid ).vpsat + wcap / deltat );
 				if ( denominator != 0.0 ) {
+					if ( directsolve ) {
+						celldiag( cid ) = denominator;
+						cellrhs( cid ) = phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat;
+						continue; // Limited below, after all cells are solved
+					}
 					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
 				} else {
 					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
@@ -1373,6 +1459,12 @@ namespace HeatBalanceHAMTManager {
 					cells( cid ).rhp1 = rhmax;
 				}
 			}
+			if ( directsolve ) {
+				SolveCellChain( Extcell( sid ), Intcell( sid ) );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).rhp1 = min( cellrhs( cid ), rhmax );
+				}
+			}
 
 			//Check for convergence or too many itterations
 			sumtp1 = 0.0;
@@ -1393,6 +1485,8 @@ namespace HeatBalanceHAMTManager {
 			}
 		}
 
+		surfitter( sid ) = itter;
+
 		// report back to CalcHeatBalanceInsideSurf
 		TempSurfOutTmp = cells( Extcell( sid ) ).tempp1;
 		TempSurfInTmp = cells( Intcell( sid ) ).tempp1;
@@ -1403,6 +1497,47 @@ namespace HeatBalanceHAMTManager {
 
 	}
 
+	void
+	SolveCellChain(
+		int const first,
+		int const last
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the equations of the cells first to last, assembled in celllower, celldiag,
+		// cellupper and cellrhs. The solution is returned in cellrhs.
+
+		// METHODOLOGY EMPLOYED:
+		// Tridiagonal (Thomas) algorithm. The system is diagonally dominant, since the diagonal of each
+		// cell holds all its conductances plus its capacitance, so no pivoting is needed.
+		// cellupper is overwritten with the eliminated coefficients.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int cid;
+		Real64 denom;
+
+		cellupper( first ) /= celldiag( first );
+		cellrhs( first ) /= celldiag( first );
+		for ( cid = first + 1; cid <= last; ++cid ) {
+			denom = celldiag( cid ) - celllower( cid ) * cellupper( cid - 1 );
+			cellupper( cid ) /= denom;
+			cellrhs( cid ) = ( cellrhs( cid ) - celllower( cid ) * cellrhs( cid - 1 ) ) / denom;
+		}
+		for ( cid = last - 1; cid >= first; --cid ) {
+			cellrhs( cid ) -= cellupper( cid ) * cellrhs( cid + 1 );
+		}
+
+	}
+
 	void
 	UpdateHeatBalHAMT( int const sid )
 	{
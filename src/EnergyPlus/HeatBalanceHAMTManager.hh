@@ -43,6 +43,13 @@ namespace HeatBalanceHAMTManager {
 	extern Array1D< Real64 > surftemp;
 	extern Array1D< Real64 > surfexttemp;
 	extern Array1D< Real64 > surfvp;
+	extern Array1D_int surfitter; // Iterations of the last cell solution of each surface (reporting)
+
+	extern Array1D_bool cellchain; // TRUE if each solved cell of a surface only connects to the cells before and after it
+	extern Array1D< Real64 > celllower; // Coefficient of the previous cell in the equation of each cell (direct solution)
+	extern Array1D< Real64 > celldiag; // Diagonal coefficient of the equation of each cell (direct solution)
+	extern Array1D< Real64 > cellupper; // Coefficient of the next cell in the equation of each cell (direct solution)
+	extern Array1D< Real64 > cellrhs; // Right hand side of the equation of each cell, replaced by the solution
 
 	extern Array1D< Real64 > extvtc; // External Surface vapor transfer coefficient
 	extern Array1D< Real64 > intvtc; // Internal Surface Vapor Transfer Coefficient
@@ -221,6 +228,12 @@ namespace HeatBalanceHAMTManager {
 		Real64 & TempSurfOutTmp
 	);
 
+	void
+	SolveCellChain(
+		int const first,
+		int const last
+	);
+
 	void
 	UpdateHeatBalHAMT( int const sid );
 
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -21,6 +22,7 @@
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <RecordOutput.hh>
 #include <UtilityRoutines.hh>
 #include <WindowEquivalentLayer.hh>
 #include <Timer.h>
@@ -29,6 +31,13 @@ namespace EnergyPlus {
 
 #define EP_HBIRE_SEQ
 
+// Per-thread scratch for the zone loop in CalcInteriorRadExchange
+#ifdef _OPENMP
+#define EP_HBIRE_THREAD_LOCAL thread_local
+#else
+#define EP_HBIRE_THREAD_LOCAL
+#endif
+
 namespace HeatBalanceIntRadExchange {
 	// Module containing the routines dealing with the interior radiant exchange
 	// between surfaces.
@@ -79,6 +88,8 @@ namespace HeatBalanceIntRadExchange {
 	// DERIVED TYPE DEFINITIONS
 	// na
 
+	int const MinSurfacesParallelViewFactors( 250 ); // Enclosure size from which view factors are fixed in parallel
+
 	// MODULE VARIABLE DECLARATIONS:
 	int MaxNumOfZoneSurfaces; // Max saved to get large enough space for user input view factors
 
@@ -159,7 +170,8 @@ namespace HeatBalanceIntRadExchange {
 		//variables added as part of strategy to reduce calculation time - Glazer 2011-04-22
 //		Real64 SendSurfTempInKTo4th; // Sending surface temperature in K to 4th power
 		Real64 RecSurfTempInKTo4th; // Receiving surface temperature in K to 4th power
-		static Array1D< Real64 > SendSurfaceTempInKto4thPrecalc;
+		static EP_HBIRE_THREAD_LOCAL Array1D< Real64 > SendSurfaceTempInKto4thPrecalc;
+		static Array1D_int ZoneOrder; // Zones in order of decreasing ScriptF work (N^2) for load balancing
 
 		// FLOW:
 
@@ -173,10 +185,19 @@ namespace HeatBalanceIntRadExchange {
 #else
 			SendSurfaceTempInKto4thPrecalc.allocate( TotSurfaces );
 #endif
+			// Handing out the largest enclosures first lets the dynamic schedule below fill in with the
+			// small ones, so no thread is left finishing one big zone after the others have gone idle
+			ZoneOrder.allocate( NumOfZones );
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) ZoneOrder( ZoneNum ) = ZoneNum;
+			std::stable_sort( ZoneOrder.begin(), ZoneOrder.end(), []( int const a, int const b ){ return ZoneInfo( a ).NumOfSurfaces > ZoneInfo( b ).NumOfSurfaces; } );
 			firstTime = false;
 			if ( DeveloperFlag ) {
 				std::string tdstring;
+#ifdef _OPENMP
+				gio::write( tdstring, fmtLD ) << " OMP turned on, HBIRE loop executed in parallel using" << NumberIntRadThreads << "threads";
+#else
 				gio::write( tdstring, fmtLD ) << " OMP turned off, HBIRE loop executed in serial";
+#endif
 				DisplayString( tdstring );
 			}
 		}
@@ -212,14 +233,30 @@ namespace HeatBalanceIntRadExchange {
 			SurfaceWindow.IRfromParentZone() = 0.0;
 		}
 
-		for ( int ZoneNum = ( PartialResimulate ? ZoneToResimulate() : 1 ), ZoneNum_end = ( PartialResimulate ? ZoneToResimulate() : NumOfZones ); ZoneNum <= ZoneNum_end; ++ZoneNum ) {
+		// Each zone only reads its own ScriptF and writes its own surfaces, so the zones can be spread over
+		// threads without any reduction and the results do not depend on the number of threads
+		int const NumZonesToCalc( PartialResimulate ? 1 : NumOfZones );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic, 1 ) num_threads( NumberIntRadThreads ) if ( NumberIntRadThreads > 1 && NumZonesToCalc > 1 ) private( RecSurfNum, SendSurfNum, ConstrNumRec, ConstrNumSend, RecSurfTemp, SendSurfTemp, RecSurfEmiss, SurfNum, ConstrNum, IntShadeOrBlindStatusChanged, ShadeFlag, ShadeFlagPrev, RecSurfTempInKTo4th )
+#endif
+		for ( int ZoneIndex = 1; ZoneIndex <= NumZonesToCalc; ++ZoneIndex ) {
 
+			int const ZoneNum( PartialResimulate ? int( ZoneToResimulate() ) : ZoneOrder( ZoneIndex ) );
 			auto const & zone( Zone( ZoneNum ) );
 			auto & zone_info( ZoneInfo( ZoneNum ) );
 			auto & zone_ScriptF( zone_info.ScriptF ); //Tuned Transposed
 			auto & zone_SurfacePtr( zone_info.SurfacePtr );
 			int const n_zone_Surfaces( zone_info.NumOfSurfaces );
 			size_type const s_zone_Surfaces( n_zone_Surfaces );
+#ifdef _OPENMP
+			if ( ! SendSurfaceTempInKto4thPrecalc.allocated() ) { // First use on a worker thread
+#ifdef EP_HBIRE_SEQ
+				SendSurfaceTempInKto4thPrecalc.allocate( MaxNumOfZoneSurfaces );
+#else
+				SendSurfaceTempInKto4thPrecalc.allocate( TotSurfaces );
+#endif
+			}
+#endif
 
 			// Calculate ScriptF if first time step in environment and surface heat-balance iterations not yet started;
 			// recalculate ScriptF if status of window interior shades or blinds has changed from
@@ -262,7 +299,7 @@ namespace HeatBalanceIntRadExchange {
 						}
 					}
 
-					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
+					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF, zone_info.BaseCinverse, zone_info.BaseEmissivity );
 					// precalc - multiply by StefanBoltzmannConstant
 					zone_ScriptF *= StefanBoltzmannConst;
 				}
@@ -397,7 +434,7 @@ namespace HeatBalanceIntRadExchange {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   September 2000
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, structured view factor records (RecordOutput)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -405,7 +442,9 @@ namespace HeatBalanceIntRadExchange {
 		// the grey interchange between surfaces in an enclosure.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The view factor report holds matrices of zone surfaces by zone surfaces; its rows are
+		// also written as records of eplusout.eiob (see RecordOutput).  The columns of a zone's
+		// matrices follow its View Factor - Surface Information records.
 
 		// REFERENCES:
 		// na
@@ -440,6 +479,11 @@ namespace HeatBalanceIntRadExchange {
 		int NumZonesWithUserFbyS; // Zones with user input,  used for flag here
 		bool NoUserInputF; // Logical flag signifying no input F's for zone
 		static bool ViewFactorReport; // Flag to output view factor report in eio file
+		static int const ZoneRecordClass( RecordOutput::RecordClass( "View Factor - Zone Information" ) );
+		static int const SurfaceRecordClass( RecordOutput::RecordClass( "View Factor - Surface Information" ) );
+		static int const ApproximateRecordClass( RecordOutput::RecordClass( "Approximate or User Input View Factor" ) );
+		static int const FinalRecordClass( RecordOutput::RecordClass( "Final View Factor" ) );
+		static int const ScriptFRecordClass( RecordOutput::RecordClass( "Script F Factor" ) );
 		static bool ErrorsFound( false );
 		Real64 CheckValue1;
 		Real64 CheckValue2;
@@ -549,69 +593,108 @@ namespace HeatBalanceIntRadExchange {
 			FixViewFactors( NumOfZoneSurfaces, ZoneInfo( ZoneNum ).Area, ZoneInfo( ZoneNum ).F, ZoneNum, CheckValue1, CheckValue2, FinalCheckValue, NumIterations, FixedRowSum );
 
 			// Calculate the script F factors
-			CalcScriptF( NumOfZoneSurfaces, ZoneInfo( ZoneNum ).Area, ZoneInfo( ZoneNum ).F, ZoneInfo( ZoneNum ).Emissivity, ZoneInfo( ZoneNum ).ScriptF );
+			CalcScriptF( NumOfZoneSurfaces, ZoneInfo( ZoneNum ).Area, ZoneInfo( ZoneNum ).F, ZoneInfo( ZoneNum ).Emissivity, ZoneInfo( ZoneNum ).ScriptF, ZoneInfo( ZoneNum ).BaseCinverse, ZoneInfo( ZoneNum ).BaseEmissivity );
 
 			if ( ViewFactorReport ) { // Write to SurfInfo File
 				// Zone Surface Information Output
-				gio::write( OutputFileInits, fmtA ) << "Surface View Factor - Zone Information," + ZoneInfo( ZoneNum ).Name + ',' + RoundSigDigits( NumOfZoneSurfaces );
-
-				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
-					gio::write( OutputFileInits, "(A,',',A,$)" )
-						<< "Surface View Factor - Surface Information,"
-						+ Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name + ','
-						+ cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Class )
-						<< RoundSigDigits( ZoneInfo( ZoneNum ).Area( SurfNum ), 4 ) + ','
-						+ RoundSigDigits( ZoneInfo( ZoneNum ).Azimuth( SurfNum ), 4 ) + ','
-						+ RoundSigDigits( ZoneInfo( ZoneNum ).Tilt( SurfNum ), 4 ) + ','
-						+ RoundSigDigits( ZoneInfo( ZoneNum ).Emissivity( SurfNum ), 4 ) + ','
-						+ RoundSigDigits( Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Sides );
-					for ( Vindex = 1; Vindex <= Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Sides; ++Vindex ) {
-						auto & Vertex = Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Vertex( Vindex );
-						gio::write( OutputFileInits, "(3(',',A),$)" )
-							<< RoundSigDigits( Vertex.x, 4 )
-							<< RoundSigDigits( Vertex.y, 4 )
-							<< RoundSigDigits( Vertex.z, 4 );
-					} gio::write( OutputFileInits );
+				if ( RecordOutput::WriteTextRecord( ZoneRecordClass ) ) {
+					gio::write( OutputFileInits, fmtA ) << "Surface View Factor - Zone Information," + ZoneInfo( ZoneNum ).Name + ',' + RoundSigDigits( NumOfZoneSurfaces );
+				}
+				if ( RecordOutput::WriteRecord( ZoneRecordClass ) ) {
+					RecordOutput::BeginRecord( ZoneRecordClass );
+					RecordOutput::RecordField( ZoneInfo( ZoneNum ).Name );
+					RecordOutput::RecordField( NumOfZoneSurfaces );
+					RecordOutput::EndRecord();
 				}
 
-				gio::write( OutputFileInits, "(A,A,$)" )
-					<< "Approximate or User Input ViewFactors"
-					<< ",To Surface,Surface Class,RowSum";
-				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
-					gio::write( OutputFileInits, "(',',A,$)" )
-						<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name;
-				} gio::write( OutputFileInits );
+				if ( RecordOutput::WriteTextRecord( SurfaceRecordClass ) ) {
+					for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+						gio::write( OutputFileInits, "(A,',',A,$)" )
+							<< "Surface View Factor - Surface Information,"
+							+ Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name + ','
+							+ cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Class )
+							<< RoundSigDigits( ZoneInfo( ZoneNum ).Area( SurfNum ), 4 ) + ','
+							+ RoundSigDigits( ZoneInfo( ZoneNum ).Azimuth( SurfNum ), 4 ) + ','
+							+ RoundSigDigits( ZoneInfo( ZoneNum ).Tilt( SurfNum ), 4 ) + ','
+							+ RoundSigDigits( ZoneInfo( ZoneNum ).Emissivity( SurfNum ), 4 ) + ','
+							+ RoundSigDigits( Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Sides );
+						for ( Vindex = 1; Vindex <= Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Sides; ++Vindex ) {
+							auto & Vertex = Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Vertex( Vindex );
+							gio::write( OutputFileInits, "(3(',',A),$)" )
+								<< RoundSigDigits( Vertex.x, 4 )
+								<< RoundSigDigits( Vertex.y, 4 )
+								<< RoundSigDigits( Vertex.z, 4 );
+						} gio::write( OutputFileInits );
+					}
+				}
+				if ( RecordOutput::WriteRecord( SurfaceRecordClass ) ) {
+					for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+						auto const & ThisSurf( Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ) );
+						RecordOutput::BeginRecord( SurfaceRecordClass );
+						RecordOutput::RecordField( ThisSurf.Name );
+						RecordOutput::RecordField( cSurfaceClass( ThisSurf.Class ) );
+						RecordOutput::RecordField( ZoneInfo( ZoneNum ).Area( SurfNum ) );
+						RecordOutput::RecordField( ZoneInfo( ZoneNum ).Azimuth( SurfNum ) );
+						RecordOutput::RecordField( ZoneInfo( ZoneNum ).Tilt( SurfNum ) );
+						RecordOutput::RecordField( ZoneInfo( ZoneNum ).Emissivity( SurfNum ) );
+						RecordOutput::RecordField( ThisSurf.Sides );
+						for ( Vindex = 1; Vindex <= ThisSurf.Sides; ++Vindex ) {
+							RecordOutput::RecordField( ThisSurf.Vertex( Vindex ).x );
+							RecordOutput::RecordField( ThisSurf.Vertex( Vindex ).y );
+							RecordOutput::RecordField( ThisSurf.Vertex( Vindex ).z );
+						}
+						RecordOutput::EndRecord();
+					}
+				}
 
-				for ( Findex = 1; Findex <= NumOfZoneSurfaces; ++Findex ) {
-					RowSum = sum( SaveApproximateViewFactors( _, Findex ) );
-					gio::write( OutputFileInits, "(A,3(',',A),$)" )
-						<< "View Factor"
-						<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Name
-						<< cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Class )
-						<< RoundSigDigits( RowSum, 4 );
+				if ( RecordOutput::WriteTextRecord( ApproximateRecordClass ) ) {
+					gio::write( OutputFileInits, "(A,A,$)" )
+						<< "Approximate or User Input ViewFactors"
+						<< ",To Surface,Surface Class,RowSum";
 					for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
 						gio::write( OutputFileInits, "(',',A,$)" )
-							<< RoundSigDigits( SaveApproximateViewFactors( SurfNum, Findex ), 4 );
+							<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name;
 					} gio::write( OutputFileInits );
+
+					for ( Findex = 1; Findex <= NumOfZoneSurfaces; ++Findex ) {
+						RowSum = sum( SaveApproximateViewFactors( _, Findex ) );
+						gio::write( OutputFileInits, "(A,3(',',A),$)" )
+							<< "View Factor"
+							<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Name
+							<< cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Class )
+							<< RoundSigDigits( RowSum, 4 );
+						for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+							gio::write( OutputFileInits, "(',',A,$)" )
+								<< RoundSigDigits( SaveApproximateViewFactors( SurfNum, Findex ), 4 );
+						} gio::write( OutputFileInits );
+					}
+				}
+				if ( RecordOutput::WriteRecord( ApproximateRecordClass ) ) {
+					WriteViewFactorRecords( ApproximateRecordClass, ZoneNum, SaveApproximateViewFactors, true );
 				}
 			}
 
 			if ( ViewFactorReport ) {
-				gio::write( OutputFileInits, "(A,A,$)" ) << "Final ViewFactors" << ",To Surface,Surface Class,RowSum";
-				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
-					gio::write( OutputFileInits, "(',',A,$)" ) << Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name;
-				} gio::write( OutputFileInits );
-
-				for ( Findex = 1; Findex <= NumOfZoneSurfaces; ++Findex ) {
-					RowSum = sum( ZoneInfo( ZoneNum ).F( _, Findex ) );
-					gio::write( OutputFileInits, "(A,3(',',A),$)" )
-						<< "View Factor"
-						<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Name
-						<< cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Class )
-						<< RoundSigDigits( RowSum, 4 );
+				if ( RecordOutput::WriteTextRecord( FinalRecordClass ) ) {
+					gio::write( OutputFileInits, "(A,A,$)" ) << "Final ViewFactors" << ",To Surface,Surface Class,RowSum";
 					for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
-						gio::write( OutputFileInits, "(',',A,$)" ) << RoundSigDigits( ZoneInfo( ZoneNum ).F( SurfNum, Findex ), 4 );
+						gio::write( OutputFileInits, "(',',A,$)" ) << Surface( ZoneInfo( ZoneNum ).SurfacePtr( SurfNum ) ).Name;
 					} gio::write( OutputFileInits );
+
+					for ( Findex = 1; Findex <= NumOfZoneSurfaces; ++Findex ) {
+						RowSum = sum( ZoneInfo( ZoneNum ).F( _, Findex ) );
+						gio::write( OutputFileInits, "(A,3(',',A),$)" )
+							<< "View Factor"
+							<< Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Name
+							<< cSurfaceClass( Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ).Class )
+							<< RoundSigDigits( RowSum, 4 );
+						for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+							gio::write( OutputFileInits, "(',',A,$)" ) << RoundSigDigits( ZoneInfo( ZoneNum ).F( SurfNum, Findex ), 4 );
+						} gio::write( OutputFileInits );
+					}
+				}
+				if ( RecordOutput::WriteRecord( FinalRecordClass ) ) {
+					WriteViewFactorRecords( FinalRecordClass, ZoneNum, ZoneInfo( ZoneNum ).F, true );
 				}
 
 				if ( Option1 == "IDF" ) {
@@ -644,7 +727,7 @@ namespace HeatBalanceIntRadExchange {
 
 			}
 
-			if ( ViewFactorReport ) {
+			if ( ViewFactorReport && RecordOutput::WriteTextRecord( ScriptFRecordClass ) ) {
 				gio::write( OutputFileInits, "(A,A,$)" )
 					<< "Script F Factors"
 					<< ",X Surface";
@@ -662,6 +745,9 @@ namespace HeatBalanceIntRadExchange {
 					} gio::write( OutputFileInits );
 				}
 			}
+			if ( ViewFactorReport && RecordOutput::WriteRecord( ScriptFRecordClass ) ) {
+				WriteViewFactorRecords( ScriptFRecordClass, ZoneNum, ZoneInfo( ZoneNum ).ScriptF, false );
+			}
 
 			if ( ViewFactorReport ) { // Deallocate saved approximate/user view factors
 				SaveApproximateViewFactors.deallocate();
@@ -693,6 +779,55 @@ namespace HeatBalanceIntRadExchange {
 
 	}
 
+	void
+	WriteViewFactorRecords(
+		int const RecordClassNum, // Record class of the rows (see RecordOutput)
+		int const ZoneNum, // Zone number
+		Array2S< Real64 > const Factors, // View factors or script F factors of the zone surfaces
+		bool const ViewFactorRows // True for view factor rows, false for script F factor rows
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the rows of a view factor or script F factor report matrix of a zone as records
+		// of eplusout.eiob, at full precision (the eio report rounds them to 4 digits).
+
+		// METHODOLOGY EMPLOYED:
+		// As in the eio report, a view factor row is the surface name, its class, the row sum and
+		// Factors( _, row ); a script F factor row is the surface name and Factors( row, _ ).
+
+		int const NumOfZoneSurfaces( ZoneInfo( ZoneNum ).NumOfSurfaces );
+
+		for ( int Findex = 1; Findex <= NumOfZoneSurfaces; ++Findex ) {
+			auto const & ThisSurf( Surface( ZoneInfo( ZoneNum ).SurfacePtr( Findex ) ) );
+			RecordOutput::BeginRecord( RecordClassNum );
+			RecordOutput::RecordField( ThisSurf.Name );
+			if ( ViewFactorRows ) {
+				Real64 RowSum( 0.0 );
+				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+					RowSum += Factors( SurfNum, Findex );
+				}
+				RecordOutput::RecordField( cSurfaceClass( ThisSurf.Class ) );
+				RecordOutput::RecordField( RowSum );
+				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+					RecordOutput::RecordField( Factors( SurfNum, Findex ) );
+				}
+			} else {
+				for ( int SurfNum = 1; SurfNum <= NumOfZoneSurfaces; ++SurfNum ) {
+					RecordOutput::RecordField( Factors( Findex, SurfNum ) );
+				}
+			}
+			RecordOutput::EndRecord();
+		}
+
+	}
+
 	void
 	GetInputViewFactors(
 		std::string const & ZoneName, // Needed to check for user input view factors.
@@ -894,6 +1029,7 @@ namespace HeatBalanceIntRadExchange {
 		//       DATE WRITTEN   July 2000
 		//       MODIFIED       March 2001 (RKS) to disallow surfaces facing the same direction to interact radiatively
 		//                      May 2002 (COP) to include INTMASS, FLOOR, ROOF and CEILING.
+		//                      Oct 2026, surface classes looked up once, view factor columns set in parallel
 		//       RE-ENGINEERED  September 2000 (RKS for EnergyPlus)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -941,8 +1077,13 @@ namespace HeatBalanceIntRadExchange {
 		int i; // DO loop counters for surfaces in the zone
 		int j;
 		Array1D< Real64 > ZoneArea; // Sum of the area of all zone surfaces seen
+		Array1D_int SurfClass( N ); // Class of the zone surfaces
 
 		// FLOW:
+		for ( i = 1; i <= N; ++i ) {
+			SurfClass( i ) = Surface( SPtr( i ) ).Class;
+		}
+
 		// Calculate the sum of the areas seen by all zone surfaces
 		ZoneArea.dimension( N, 0.0 );
 		for ( i = 1; i <= N; ++i ) {
@@ -955,7 +1096,7 @@ namespace HeatBalanceIntRadExchange {
 				if ( i == j ) continue;
 				//  Include INTMASS, FLOOR(for others), CEILING, ROOF  and different facing surfaces.
 				//  Roofs/ceilings always see floors
-				if ( ( Surface( SPtr( j ) ).Class == SurfaceClass_IntMass ) || ( Surface( SPtr( j ) ).Class == SurfaceClass_Floor ) || ( Surface( SPtr( j ) ).Class == SurfaceClass_Roof && Surface( SPtr( i ) ).Class == SurfaceClass_Floor ) || ( ( std::abs( Azimuth( i ) - Azimuth( j ) ) > SameAngleLimit ) || ( std::abs( Tilt( i ) - Tilt( j ) ) > SameAngleLimit ) ) ) { // Everything sees internal mass surfaces | Everything except other floors sees floors
+				if ( ( SurfClass( j ) == SurfaceClass_IntMass ) || ( SurfClass( j ) == SurfaceClass_Floor ) || ( SurfClass( j ) == SurfaceClass_Roof && SurfClass( i ) == SurfaceClass_Floor ) || ( ( std::abs( Azimuth( i ) - Azimuth( j ) ) > SameAngleLimit ) || ( std::abs( Tilt( i ) - Tilt( j ) ) > SameAngleLimit ) ) ) { // Everything sees internal mass surfaces | Everything except other floors sees floors
 
 					ZoneArea( i ) += A( j );
 
@@ -980,15 +1121,19 @@ namespace HeatBalanceIntRadExchange {
 		// The second IF statement is intended to avoid a divide by zero if
 		// there are no other surfaces in the zone that can be seen.
 		F = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberIntRadThreads ) if ( NumberIntRadThreads > 1 && N >= MinSurfacesParallelViewFactors ) private( j )
+#endif
 		for ( i = 1; i <= N; ++i ) {
+			if ( ZoneArea( i ) <= 0.0 ) continue;
 			for ( j = 1; j <= N; ++j ) {
 
 				//  Skip same surface
 
 				if ( i == j ) continue;
 				//  Include INTMASS, FLOOR(for others), CEILING/ROOF  and different facing surfaces.
-				if ( ( Surface( SPtr( j ) ).Class == SurfaceClass_IntMass ) || ( Surface( SPtr( j ) ).Class == SurfaceClass_Floor ) || ( Surface( SPtr( j ) ).Class == SurfaceClass_Roof ) || ( ( std::abs( Azimuth( i ) - Azimuth( j ) ) > SameAngleLimit ) || ( std::abs( Tilt( i ) - Tilt( j ) ) > SameAngleLimit ) ) ) {
-					if ( ZoneArea( i ) > 0.0 ) F( j, i ) = A( j ) / ( ZoneArea( i ) );
+				if ( ( SurfClass( j ) == SurfaceClass_IntMass ) || ( SurfClass( j ) == SurfaceClass_Floor ) || ( SurfClass( j ) == SurfaceClass_Roof ) || ( ( std::abs( Azimuth( i ) - Azimuth( j ) ) > SameAngleLimit ) || ( std::abs( Tilt( i ) - Tilt( j ) ) > SameAngleLimit ) ) ) {
+					F( j, i ) = A( j ) / ( ZoneArea( i ) );
 				}
 
 			}
@@ -1020,6 +1165,9 @@ namespace HeatBalanceIntRadExchange {
 		//                      surface larger than sum of all others (nonenclosure)
 		//                      by using a Fii view factor for that surface. Process is
 		//                      now much more robust and stable.
+		//                      Oct 2026, reciprocity enforced in place by blocks, closure sum formed with
+		//                      the fixed view factors, large enclosures fixed in parallel (OpenMP builds)
+		//                      Oct 2026, closure sum accumulated by rows so it does not depend on thread count
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1035,6 +1183,8 @@ namespace HeatBalanceIntRadExchange {
 		// not satisfied, the AF averaging and row modifications are repeated until
 		// completeness is within a preselected small deviation from 1.0
 		// The routine also checks the number of surfaces and if N<=3, just enforces reciprocity.
+		// Only the AF and F matrices are held, so the memory stays at two N x N matrices for the
+		// large enclosures (atria, open plan zones) where this routine dominates the start up.
 
 		// REFERENCES:
 		// na
@@ -1092,17 +1242,16 @@ namespace HeatBalanceIntRadExchange {
 		}
 
 		//  Set up AF matrix.
-		Array2D< Real64 > AF( N, N ); // = (AREA * DIRECT VIEW FACTOR) MATRIX
+		Array2D< Real64 >::size_type l( 0u );
 		for ( i = 1; i <= N; ++i ) {
-			for ( j = 1; j <= N; ++j ) {
-				AF( j, i ) = FixedAF( j, i ) * A( i );
+			Real64 const A_i( A( i ) );
+			for ( j = 1; j <= N; ++j, ++l ) {
+				FixedAF[ l ] *= A_i; // [ l ] == ( j, i )
 			}
 		}
 
 		//  Enforce reciprocity by averaging AiFij and AjFji
-		FixedAF = 0.5 * ( AF + transpose( AF ) ); //Performance Slow way to average with transpose (heap use)
-
-		AF.deallocate();
+		EnforceViewFactorReciprocity( N, FixedAF );
 
 		Array2D< Real64 > FixedF( N, N ); // CORRECTED MATRIX OF VIEW FACTORS (N X N)
 
@@ -1129,43 +1278,59 @@ namespace HeatBalanceIntRadExchange {
 		} //  N <= 3 Case
 
 		//  Regular fix cases
-		Array1D< Real64 > RowCoefficient( N );
+		bool const FixInParallel( NumberIntRadThreads > 1 && N >= MinSurfacesParallelViewFactors );
+		Array1D< Real64 > RowSumFixedF( N ); // Row sums of FixedF: Added together in row order so results don't depend on the thread count
 		Converged = false;
 		while ( ! Converged ) {
 			++NumIterations;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberIntRadThreads ) if ( FixInParallel ) private( j )
+#endif
 			for ( i = 1; i <= N; ++i ) {
 				// Determine row coefficients which will enforce closure.
-				Real64 const sum_FixedAF_i( sum( FixedAF( _, i ) ) );
-				if ( std::abs( sum_FixedAF_i ) > 1.0e-10 ) {
-					RowCoefficient( i ) = A( i ) / sum_FixedAF_i;
-				} else {
-					RowCoefficient( i ) = 1.0;
+				Array2D< Real64 >::size_type const l_i( ( i - 1 ) * N ); // [ l_i ] == ( 1, i )
+				Real64 sum_FixedAF_i( 0.0 );
+				for ( j = 0; j < N; ++j ) {
+					sum_FixedAF_i += FixedAF[ l_i + j ];
+				}
+				Real64 const RowCoefficient( std::abs( sum_FixedAF_i ) > 1.0e-10 ? A( i ) / sum_FixedAF_i : 1.0 );
+				for ( j = 0; j < N; ++j ) {
+					FixedAF[ l_i + j ] *= RowCoefficient;
 				}
-				FixedAF( _, i ) *= RowCoefficient( i );
 			}
 
 			//  Enforce reciprocity by averaging AiFij and AjFji
-			FixedAF = 0.5 * ( FixedAF + transpose( FixedAF ) );
+			EnforceViewFactorReciprocity( N, FixedAF, FixInParallel );
 
-			//  Form FixedF matrix
+			//  Form FixedF matrix and sum it for the closure check
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberIntRadThreads ) if ( FixInParallel ) private( j )
+#endif
 			for ( i = 1; i <= N; ++i ) {
-				for ( j = 1; j <= N; ++j ) {
-					FixedF( j, i ) = FixedAF( j, i ) / A( i );
-					if ( std::abs( FixedF( j, i ) ) < 1.e-10 ) {
-						FixedF( j, i ) = 0.0;
-						FixedAF( j, i ) = 0.0;
+				Array2D< Real64 >::size_type const l_i( ( i - 1 ) * N ); // [ l_i ] == ( 1, i )
+				Real64 const A_inv( 1.0 / A( i ) );
+				Real64 sum_FixedF_i( 0.0 );
+				for ( j = 0; j < N; ++j ) {
+					Real64 const FixedF_ji( FixedAF[ l_i + j ] * A_inv );
+					if ( std::abs( FixedF_ji ) < 1.e-10 ) {
+						FixedF[ l_i + j ] = 0.0;
+						FixedAF[ l_i + j ] = 0.0;
+					} else {
+						FixedF[ l_i + j ] = FixedF_ji;
+						sum_FixedF_i += FixedF_ji;
 					}
 				}
+				RowSumFixedF( i ) = sum_FixedF_i;
 			}
 
-			ConvrgNew = std::abs( sum( FixedF ) - N );
+			ConvrgNew = std::abs( sum( RowSumFixedF ) - N );
 			if ( std::abs( ConvrgOld - ConvrgNew ) < DifferenceConvergence || ConvrgNew <= PrimaryConvergence ) { //  Change in sum of Fs must be small.
 				Converged = true;
 			}
 			ConvrgOld = ConvrgNew;
 			if ( NumIterations > 400 ) { //  If everything goes bad,enforce reciprocity and go home.
 				//  Enforce reciprocity by averaging AiFij and AjFji
-				FixedAF = 0.5 * ( FixedAF + transpose( FixedAF ) );
+				EnforceViewFactorReciprocity( N, FixedAF, FixInParallel );
 
 				//  Form FixedF matrix
 				for ( i = 1; i <= N; ++i ) {
@@ -1205,13 +1370,60 @@ namespace HeatBalanceIntRadExchange {
 
 	}
 
+	void
+	EnforceViewFactorReciprocity(
+		int const N, // Number of surfaces
+		Array2< Real64 > & AF, // Area * view factor matrix (N X N)
+		bool const InParallel // Average the blocks in parallel (OpenMP builds)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Enforces reciprocity of an area * view factor matrix by replacing AiFij and AjFji by
+		// their average, i.e. AF = 0.5 * ( AF + transpose( AF ) ) without the temporaries.
+
+		// METHODOLOGY EMPLOYED:
+		// The upper triangle is walked in square blocks so that both the rows and the columns
+		// of a block pair stay in cache.  Each element pair belongs to one block, so the block
+		// rows are independent.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const BlockSize( 64 ); // Surfaces per block side
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic, 1 ) num_threads( NumberIntRadThreads ) if ( InParallel )
+#endif
+		for ( int iBlock = 1; iBlock <= N; iBlock += BlockSize ) {
+			int const iEnd( min( iBlock + BlockSize - 1, N ) );
+			for ( int jBlock = iBlock; jBlock <= N; jBlock += BlockSize ) {
+				int const jEnd( min( jBlock + BlockSize - 1, N ) );
+				for ( int i = iBlock; i <= iEnd; ++i ) {
+					for ( int j = max( jBlock, i + 1 ); j <= jEnd; ++j ) {
+						Real64 const AF_avg( 0.5 * ( AF( j, i ) + AF( i, j ) ) );
+						AF( j, i ) = AF_avg;
+						AF( i, j ) = AF_avg;
+					}
+				}
+			}
+		}
+
+	}
+
 	void
 	CalcScriptF(
 		int const N, // Number of surfaces
 		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
 		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
 		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
-		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+		Array2< Real64 > & ScriptF, // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+		Array2D< Real64 > & BaseCinverse, // Inverse of the coefficient matrix for BaseEMISS (N X N)
+		Array1D< Real64 > & BaseEMISS // Emissivities BaseCinverse was formed with
 	)
 	{
 
@@ -1221,6 +1433,7 @@ namespace HeatBalanceIntRadExchange {
 		//       MODIFIED       July 2000 (COP for the ASHRAE Loads Toolkit)
 		//       RE-ENGINEERED  September 2000 (RKS for EnergyPlus)
 		//       RE-ENGINEERED  June 2014 (Stuart Mentzer): Performance tuned
+		//       MODIFIED       Oct 2026: reuse the inverse when only a few emissivities changed
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Determines Hottel's ScriptF coefficients which account for the total
@@ -1228,6 +1441,12 @@ namespace HeatBalanceIntRadExchange {
 
 		// METHODOLOGY EMPLOYED:
 		// See reference
+		// The emissivities only enter the diagonal of the coefficient matrix. The inverse formed
+		// for BaseEMISS is kept, and when only a few emissivities differ from BaseEMISS (e.g.
+		// windows with interior shades or blinds deployed) the new inverse is obtained from it with
+		// the Sherman-Morrison-Woodbury formula at O(N^2 k) cost for k changed surfaces instead of a
+		// new O(N^3) inversion.  Updates are always applied to the base inverse so round-off does
+		// not accumulate.
 
 		// REFERENCES:
 		// Hottel, H. C. and A. F. Sarofim, Radiative Transfer, Ch 3, McGraw Hill, 1967.
@@ -1242,6 +1461,7 @@ namespace HeatBalanceIntRadExchange {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error
+		int const MaxUpdateFraction( 4 ); // Reinvert when more than 1/MaxUpdateFraction of the emissivities changed
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1265,36 +1485,117 @@ namespace HeatBalanceIntRadExchange {
 		++NumCalcScriptF_Calls;
 #endif
 
-		// Load Cmatrix with AF (AREA * DIRECT VIEW FACTOR) matrix
-		Array2D< Real64 > Cmatrix( N, N ); // = (AF - EMISS/REFLECTANCE) matrix (but plays other roles)
-		assert( equal_dimensions( Cmatrix, F ) ); // For linear indexing
-		Array2D< Real64 >::size_type l( 0u );
-		for ( int j = 1; j <= N; ++j ) {
-			for ( int i = 1; i <= N; ++i, ++l ) {
-				Cmatrix[ l ] = A( i ) * F[ l ]; // [ l ] == ( i, j )
+		// Limit EMISS to avoid divide by zero below
+		for ( int i = 1; i <= N; ++i ) {
+			if ( EMISS( i ) > MaxEmissLimit ) {
+				EMISS( i ) = MaxEmissLimit;
+#ifdef _OPENMP
+#pragma omp critical ( HBIREWarnings )
+#endif
+				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
 			}
 		}
 
-		// Load Cmatrix with (AF - EMISS/REFLECTANCE) matrix
-		Array1D< Real64 > Excite( N ); // Excitation vector = A*EMISS/REFLECTANCE
-		l = 0u;
-		for ( int i = 1; i <= N; ++i, l += N + 1 ) {
-			Real64 EMISS_i( EMISS( i ) );
-			if ( EMISS_i > MaxEmissLimit ) { // Check/limit EMISS for this surface to avoid divide by zero below
-				EMISS_i = EMISS( i ) = MaxEmissLimit;
-				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
+		// Excitation vector = A*EMISS/REFLECTANCE
+		Array1D< Real64 > Excite( N );
+		for ( int i = 1; i <= N; ++i ) {
+			Real64 const EMISS_i_fac( A( i ) / ( 1.0 - EMISS( i ) ) );
+			Excite( i ) = -EMISS( i ) * EMISS_i_fac; // Set up matrix columns for partial radiosity calculation
+		}
+
+		// Surfaces whose emissivity differs from the one the base inverse was formed with
+		Array1D_int Changed( N );
+		int NumChanged( N );
+		if ( BaseCinverse.size1() == static_cast< Array2D< Real64 >::size_type >( N ) && BaseEMISS.isize() == N ) {
+			NumChanged = 0;
+			for ( int i = 1; i <= N; ++i ) {
+				if ( EMISS( i ) != BaseEMISS( i ) ) Changed( ++NumChanged ) = i;
 			}
-			Real64 const EMISS_i_fac( A( i ) / ( 1.0 - EMISS_i ) );
-			Excite( i ) = -EMISS_i * EMISS_i_fac; // Set up matrix columns for partial radiosity calculation
-			Cmatrix[ l ] -= EMISS_i_fac; // Coefficient matrix for partial radiosity calculation // [ l ] == ( i, i )
 		}
 
 		Array2D< Real64 > Cinverse( N, N ); // Inverse of Cmatrix
-		CalcMatrixInverse( Cmatrix, Cinverse ); // SOLVE THE LINEAR SYSTEM
-		Cmatrix.clear(); // Release memory ASAP
+		if ( NumChanged * MaxUpdateFraction > N ) { // Form and invert the coefficient matrix, and make it the new base
+
+			// Load Cmatrix with AF (AREA * DIRECT VIEW FACTOR) matrix
+			Array2D< Real64 > Cmatrix( N, N ); // = (AF - EMISS/REFLECTANCE) matrix (but plays other roles)
+			assert( equal_dimensions( Cmatrix, F ) ); // For linear indexing
+			Array2D< Real64 >::size_type l( 0u );
+			for ( int j = 1; j <= N; ++j ) {
+				for ( int i = 1; i <= N; ++i, ++l ) {
+					Cmatrix[ l ] = A( i ) * F[ l ]; // [ l ] == ( i, j )
+				}
+			}
+
+			// Load Cmatrix with (AF - EMISS/REFLECTANCE) matrix
+			l = 0u;
+			for ( int i = 1; i <= N; ++i, l += N + 1 ) {
+				Cmatrix[ l ] -= A( i ) / ( 1.0 - EMISS( i ) ); // Coefficient matrix for partial radiosity calculation // [ l ] == ( i, i )
+			}
+
+			CalcMatrixInverse( Cmatrix, Cinverse ); // SOLVE THE LINEAR SYSTEM
+			Cmatrix.clear(); // Release memory ASAP
+
+			BaseCinverse = Cinverse;
+			BaseEMISS = EMISS;
+
+		} else if ( NumChanged == 0 ) {
+
+			Cinverse = BaseCinverse;
+
+		} else { // Low rank update of the base inverse B:  C = Cbase + U D U^T, with U the unit columns of the changed surfaces
+			// inv(C) = B - B U W U^T B, W = D inv( I + U^T B U D )
+
+			int const k( NumChanged );
+			Array1D< Real64 > D( k ); // Change of the diagonal coefficients
+			for ( int p = 1; p <= k; ++p ) {
+				int const i( Changed( p ) );
+				D( p ) = A( i ) / ( 1.0 - BaseEMISS( i ) ) - A( i ) / ( 1.0 - EMISS( i ) );
+			}
+
+			Array2D< Real64 > Mmatrix( k, k ); // I + U^T B U D
+			for ( int p = 1; p <= k; ++p ) {
+				for ( int q = 1; q <= k; ++q ) {
+					Mmatrix( p, q ) = BaseCinverse( Changed( p ), Changed( q ) ) * D( q );
+				}
+				Mmatrix( p, p ) += 1.0;
+			}
+			Array2D< Real64 > W( k, k );
+			CalcMatrixInverse( Mmatrix, W );
+			for ( int p = 1; p <= k; ++p ) {
+				Real64 const D_p( D( p ) );
+				for ( int q = 1; q <= k; ++q ) {
+					W( p, q ) *= D_p;
+				}
+			}
+
+			Array2D< Real64 > BUW( N, k ); // B U W
+			for ( int r = 1; r <= N; ++r ) {
+				for ( int q = 1; q <= k; ++q ) {
+					Real64 BUW_rq( 0.0 );
+					for ( int p = 1; p <= k; ++p ) {
+						BUW_rq += BaseCinverse( r, Changed( p ) ) * W( p, q );
+					}
+					BUW( r, q ) = BUW_rq;
+				}
+			}
+
+			Cinverse = BaseCinverse;
+			for ( int r = 1; r <= N; ++r ) {
+				for ( int q = 1; q <= k; ++q ) {
+					Real64 const BUW_rq( BUW( r, q ) );
+					if ( BUW_rq == 0.0 ) continue;
+					auto rc( Cinverse.index( r, 1 ) ); // [ rc ] == ( r, c )
+					auto sc( BaseCinverse.index( Changed( q ), 1 ) ); // [ sc ] == ( Changed( q ), c )
+					for ( int c = 1; c <= N; ++c, ++rc, ++sc ) {
+						Cinverse[ rc ] -= BUW_rq * BaseCinverse[ sc ];
+					}
+				}
+			}
+
+		}
 
 		// Scale Cinverse colums by excitation to get partial radiosity matrix
-		l = 0u;
+		Array2D< Real64 >::size_type l( 0u );
 		for ( int j = 1; j <= N; ++j ) {
 			Real64 const e_j( Excite( j ) );
 			for ( int i = 1; i <= N; ++i, ++l ) {
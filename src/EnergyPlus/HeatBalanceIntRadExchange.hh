@@ -3,8 +3,10 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -42,6 +44,14 @@ namespace HeatBalanceIntRadExchange {
 	void
 	InitInteriorRadExchange();
 
+	void
+	WriteViewFactorRecords(
+		int const RecordClassNum, // Record class of the rows (see RecordOutput)
+		int const ZoneNum, // Zone number
+		Array2S< Real64 > const Factors, // View factors or script F factors of the zone surfaces
+		bool const ViewFactorRows // True for view factor rows, false for script F factor rows
+	);
+
 	void
 	GetInputViewFactors(
 		std::string const & ZoneName, // Needed to check for user input view factors.
@@ -85,13 +95,22 @@ namespace HeatBalanceIntRadExchange {
 		Real64 & RowSum // RowSum of Fixed
 	);
 
+	void
+	EnforceViewFactorReciprocity(
+		int const N, // Number of surfaces
+		Array2< Real64 > & AF, // Area * view factor matrix (N X N)
+		bool const InParallel = false // Average the blocks in parallel (OpenMP builds)
+	);
+
 	void
 	CalcScriptF(
 		int const N, // Number of surfaces
 		Array1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
 		Array2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
 		Array1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
-		Array2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+		Array2< Real64 > & ScriptF, // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+		Array2D< Real64 > & BaseCinverse, // Inverse of the coefficient matrix for BaseEMISS (N X N)
+		Array1D< Real64 > & BaseEMISS // Emissivities BaseCinverse was formed with
 	);
 
 	void
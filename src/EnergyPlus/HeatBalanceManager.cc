@@ -1,4 +1,6 @@
 // C++ Headers
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <string>
 
@@ -29,6 +31,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DaylightingDevices.hh>
 #include <DisplayRoutines.hh>
@@ -44,6 +47,7 @@
 #include <OutputProcessor.hh>
 #include <OutputReportTabular.hh>
 #include <ScheduleManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <UtilityRoutines.hh>
@@ -131,6 +135,10 @@ namespace HeatBalanceManager {
 	static gio::Fmt fmtA( "(A)" );
 
 	Array1D_string const PassFail( 2, { "Fail", "Pass" } );
+	int const MinNumberOfSeededWarmupDays( 3 ); // Minimum warmup days of an environment started from an earlier one
+	Real64 const MaxWarmupSeedTempDifference( 5.0 ); // Largest difference of the mean outdoor temperature of the first
+	// warmup day from that of an earlier environment whose state a warmup is started from {deltaC}
+	Real64 const MaxWarmupContractionRate( 0.9 ); // Largest daily contraction rate of the warmup changes that is extrapolated
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -164,6 +172,14 @@ namespace HeatBalanceManager {
 	Array2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
 	int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
+	//Variables used to start the warmup from an earlier environment and to extrapolate it
+	bool WarmupSeeded( false ); // The warmup of the current environment was started from an earlier one
+	Real64 WarmupOutDryBulbSum( 0.0 ); // Sum of the outdoor dry-bulb temperature over the first warmup day
+	int WarmupOutDryBulbCount( 0 ); // Zone time steps of the first warmup day in WarmupOutDryBulbSum
+	int WarmupHistoryDays( 0 ); // Warmup days since the surface histories were last extrapolated (or the start)
+	int NumWarmupExtrapolations( 0 ); // Number of times the surface histories were extrapolated
+	Array3D< Real64 > WarmupTHChange; // Change of TH over the last warmup day
+
 	std::string CurrentModuleObject; // to assist in getting input
 
 	// Subroutine Specifications for the Heat Balance Module
@@ -179,10 +195,28 @@ namespace HeatBalanceManager {
 
 	// Object Data
 	Array1D< WarmupConvergence > WarmupConvergenceValues;
+	std::vector< WarmupStateData > WarmupSeeds; // Converged state of each environment, to start later ones from
+	WarmupStateData WarmupHistoryState; // Surface histories at the end of the last warmup day
 
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	// Add a multiple of the change from prev to the values of a history array
+	template< typename A >
+	inline
+	void
+	ExtrapolateWarmupHistory(
+		A & a,
+		A const & prev,
+		Real64 const Factor
+	)
+	{
+		assert( a.size() == prev.size() );
+		for ( typename A::size_type l = 0, e = a.size(); l < e; ++l ) {
+			a[ l ] += Factor * ( a[ l ] - prev[ l ] );
+		}
+	}
+
 	// Functions
 
 	void
@@ -193,6 +227,8 @@ namespace HeatBalanceManager {
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   January 1997
 		//       MODIFIED       February 1998 Richard Liesen
+		//                      Oct 2026, timed as a region of the timing profile
+		//                      Oct 2026, warmup starting state and extrapolation, checkpoint resume
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -233,6 +269,7 @@ namespace HeatBalanceManager {
 		static bool GetInputFlag( true );
 
 		// FLOW:
+		DataTimings::ProfileTimer const profileTimer( "ManageHeatBalance" ); // Region of the timing profile
 
 		// Get the heat balance input at the beginning of the simulation only
 		if ( GetInputFlag ) {
@@ -243,6 +280,17 @@ namespace HeatBalanceManager {
 		// These Inits will still have to be looked at as the routines are re-engineered further
 		InitHeatBalance(); // Initialize all heat balance related parameters
 
+		if ( BeginEnvrnFlag ) {
+			WarmupSeeded = false;
+			WarmupOutDryBulbSum = 0.0;
+			WarmupOutDryBulbCount = 0;
+			WarmupHistoryDays = 0;
+		}
+		if ( WarmupFromSimilarEnvironment && WarmupFlag && DayOfSim == 1 ) { // Mean outdoor temperature of the first day
+			WarmupOutDryBulbSum += OutDryBulbTemp;
+			++WarmupOutDryBulbCount;
+		}
+
 		// Solve the zone heat balance by first calling the Surface Heat Balance Manager
 		// and then the Air Heat Balance Manager is called by the Surface Heat Balance
 		// Manager.  The order of execution is still important and the zone cannot
@@ -267,6 +315,9 @@ namespace HeatBalanceManager {
 		if ( WarmupFlag && EndDayFlag ) {
 
 			CheckWarmupConvergence();
+			if ( WarmupFromSimilarEnvironment || WarmupExtrapolation ) UpdateWarmupState();
+			// A resumed run period takes its state from the checkpoint, so one warmup day is enough
+			if ( WarmupFlag && SimulationCheckpoint::ResumingEnvironment() ) WarmupFlag = false;
 			if ( ! WarmupFlag ) {
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
@@ -328,6 +379,8 @@ namespace HeatBalanceManager {
 
 		// FLOW:
 
+		DataTimings::ProfileTimer const profileTimer( "GetHeatBalanceInput" ); // Region of the timing profile
+
 		GetProjectControlData( ErrorsFound );
 
 		GetSiteAtmosphereData( ErrorsFound );
@@ -601,7 +654,7 @@ namespace HeatBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Array1D_string AlphaName( 4 );
+		Array1D_string AlphaName( 5 );
 		Array1D< Real64 > BuildingNumbers( 5 );
 		int NumAlpha;
 		int NumNumber;
@@ -746,6 +799,24 @@ namespace HeatBalanceManager {
 				ShowContinueError( "...Users should only alter this default if they are certain that less than " + RoundSigDigits( DefaultMinNumberOfWarmupDays ) + " warmup days is appropriate for a particular file. " );
 				ShowContinueError( "...Verify that convergence to desired results are achieved. You can report values during warmup days to ascertain convergence." );
 			}
+			// Warmup Starting State
+			if ( lAlphaFieldBlanks( 4 ) || AlphaName( 4 ) == "INITIAL" ) {
+				WarmupFromSimilarEnvironment = false;
+			} else if ( AlphaName( 4 ) == "SIMILARENVIRONMENT" ) {
+				WarmupFromSimilarEnvironment = true;
+			} else {
+				ShowSevereError( RoutineName + CurrentModuleObject + ": " + cAlphaFieldNames( 4 ) + " invalid=" + AlphaName( 4 ) );
+				ErrorsFound = true;
+			}
+			// Warmup Acceleration
+			if ( lAlphaFieldBlanks( 5 ) || AlphaName( 5 ) == "NONE" ) {
+				WarmupExtrapolation = false;
+			} else if ( AlphaName( 5 ) == "EXTRAPOLATE" ) {
+				WarmupExtrapolation = true;
+			} else {
+				ShowSevereError( RoutineName + CurrentModuleObject + ": " + cAlphaFieldNames( 5 ) + " invalid=" + AlphaName( 5 ) );
+				ErrorsFound = true;
+			}
 		} else {
 			ShowSevereError( RoutineName + " A " + CurrentModuleObject + " Object must be entered." );
 			ErrorsFound = true;
@@ -4724,6 +4795,7 @@ namespace HeatBalanceManager {
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   April 1997
 		//       MODIFIED       June 2011, Daeho Kang for individual zone comparison
+		//                      Oct 2026, fewer minimum days for a warmup started from an earlier environment
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4757,6 +4829,7 @@ namespace HeatBalanceManager {
 		static bool WarmupConvergenceWarning( false );
 		static bool SizingWarmupConvergenceWarning( false );
 		bool ConvergenceChecksFailed;
+		int MinWarmupDays( MinNumberOfWarmupDays ); // Minimum number of warmup days of this environment
 
 		// Convergence criteria for warmup days:
 		// Perform another warmup day unless both the % change in loads and
@@ -4863,10 +4936,12 @@ namespace HeatBalanceManager {
 			}
 
 			// Set warmup flag to true depending on value of ConvergenceChecksFailed (true=fail)
-			// and minimum number of warmup days
-			if ( ! ConvergenceChecksFailed && DayOfSim >= MinNumberOfWarmupDays ) {
+			// and minimum number of warmup days; an environment started from the converged state
+			// of an earlier one already has the temperature and flux history the minimum is for
+			if ( WarmupSeeded ) MinWarmupDays = min( MinNumberOfWarmupDays, MinNumberOfSeededWarmupDays );
+			if ( ! ConvergenceChecksFailed && DayOfSim >= MinWarmupDays ) {
 				WarmupFlag = false;
-			} else if ( ! ConvergenceChecksFailed && DayOfSim < MinNumberOfWarmupDays ) {
+			} else if ( ! ConvergenceChecksFailed && DayOfSim < MinWarmupDays ) {
 				WarmupFlag = true;
 			}
 
@@ -4880,6 +4955,225 @@ namespace HeatBalanceManager {
 
 	}
 
+	void
+	UpdateWarmupState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called at the end of each warmup day, after the convergence check.  Keeps the converged
+		// state of the environment for later ones (Warmup Starting State = SimilarEnvironment),
+		// starts the warmup from an earlier environment at the end of the first day, and
+		// extrapolates the surface histories (Warmup Acceleration = Extrapolate).
+
+		if ( ! WarmupFlag ) {
+			if ( WarmupFromSimilarEnvironment && WarmupOutDryBulbCount > 0 ) {
+				auto seed( std::find_if( WarmupSeeds.begin(), WarmupSeeds.end(), []( WarmupStateData const & s ) { return s.KindOfSim == KindOfSim && s.EnvironmentName == EnvironmentName; } ) );
+				if ( seed == WarmupSeeds.end() ) seed = WarmupSeeds.insert( WarmupSeeds.end(), WarmupStateData() );
+				seed->EnvironmentName = EnvironmentName;
+				seed->KindOfSim = KindOfSim;
+				seed->MeanOutDryBulbTemp = WarmupOutDryBulbSum / WarmupOutDryBulbCount;
+				SaveWarmupState( *seed );
+			}
+			return;
+		}
+
+		if ( WarmupFromSimilarEnvironment && DayOfSim == 1 ) StartWarmupFromSimilarEnvironment();
+		if ( WarmupExtrapolation ) ExtrapolateWarmupHistories();
+
+	}
+
+	void
+	SaveWarmupState( WarmupStateData & state )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the surface and zone air histories to a warmup state.
+
+		state.TH = TH;
+		state.QH = QH;
+		state.THM = THM;
+		state.QHM = QHM;
+		state.TempSurfIn = TempSurfIn;
+		state.TempSurfInTmp = TempSurfInTmp;
+		state.TempSurfOut = TempSurfOut;
+		state.MAT = MAT;
+		state.ZT = ZT;
+		state.ZTAV = ZTAV;
+		state.XMAT = XMAT;
+		state.XM2T = XM2T;
+		state.XM3T = XM3T;
+		state.XM4T = XM4T;
+		state.ZoneAirHumRat = ZoneAirHumRat;
+		state.ZoneAirHumRatAvg = ZoneAirHumRatAvg;
+		state.WZoneTimeMinus1 = WZoneTimeMinus1;
+		state.WZoneTimeMinus2 = WZoneTimeMinus2;
+		state.WZoneTimeMinus3 = WZoneTimeMinus3;
+		state.WZoneTimeMinus4 = WZoneTimeMinus4;
+
+	}
+
+	void
+	RestoreWarmupState( WarmupStateData const & state )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the surface and zone air histories from a warmup state of the same building.
+
+		TH = state.TH;
+		QH = state.QH;
+		THM = state.THM;
+		QHM = state.QHM;
+		TempSurfIn = state.TempSurfIn;
+		TempSurfInTmp = state.TempSurfInTmp;
+		TempSurfOut = state.TempSurfOut;
+		MAT = state.MAT;
+		ZT = state.ZT;
+		ZTAV = state.ZTAV;
+		XMAT = state.XMAT;
+		XM2T = state.XM2T;
+		XM3T = state.XM3T;
+		XM4T = state.XM4T;
+		ZoneAirHumRat = state.ZoneAirHumRat;
+		ZoneAirHumRatAvg = state.ZoneAirHumRatAvg;
+		WZoneTimeMinus1 = state.WZoneTimeMinus1;
+		WZoneTimeMinus2 = state.WZoneTimeMinus2;
+		WZoneTimeMinus3 = state.WZoneTimeMinus3;
+		WZoneTimeMinus4 = state.WZoneTimeMinus4;
+
+	}
+
+	void
+	StartWarmupFromSimilarEnvironment()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// At the end of the first warmup day, replaces the state reached with the converged state of
+		// an earlier environment of the same kind, so the rest of the warmup starts close to the
+		// state it converges to.  The first day has done the begin environment initializations.
+
+		// METHODOLOGY EMPLOYED:
+		// An earlier environment with the same name (design days are simulated again for sizing and
+		// for the results) is used if there is one, else the one whose first warmup day had the
+		// closest mean outdoor dry-bulb temperature, within MaxWarmupSeedTempDifference.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		WarmupStateData const * seed( nullptr );
+		Real64 MeanOutDryBulbTemp;
+		Real64 TempDifference;
+		Real64 MinTempDifference( MaxWarmupSeedTempDifference );
+
+		if ( WarmupOutDryBulbCount == 0 ) return;
+		MeanOutDryBulbTemp = WarmupOutDryBulbSum / WarmupOutDryBulbCount;
+		for ( auto const & s : WarmupSeeds ) {
+			if ( s.KindOfSim != KindOfSim || s.TH.size() != TH.size() || s.MAT.size() != MAT.size() ) continue;
+			if ( s.EnvironmentName == EnvironmentName ) {
+				seed = &s;
+				break;
+			}
+			TempDifference = std::abs( s.MeanOutDryBulbTemp - MeanOutDryBulbTemp );
+			if ( TempDifference <= MinTempDifference ) {
+				seed = &s;
+				MinTempDifference = TempDifference;
+			}
+		}
+		if ( seed == nullptr ) return;
+
+		RestoreWarmupState( *seed );
+		WarmupSeeded = true;
+
+	}
+
+	void
+	ExtrapolateWarmupHistories()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// At the end of a warmup day, moves the surface temperature and flux histories towards the
+		// state the warmup days converge to.
+
+		// METHODOLOGY EMPLOYED:
+		// Repeating the warmup day is a fixed point iteration of the state at the end of the day.
+		// Near convergence its error falls by a nearly constant rate r each day (the slowest mode,
+		// mostly the heavy constructions), which is estimated by projecting the change of TH over
+		// the last day on the change over the day before.  For 0 < r < MaxWarmupContractionRate,
+		// r/(1-r) times the last change is added to all surface histories, which is what is left
+		// of a geometric convergence (an Aitken extrapolation).  The two days after it are
+		// simulated before the next one.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 ChangeProduct( 0.0 ); // Last change of TH times the change of the day before
+		Real64 PrevChangeSquare( 0.0 ); // Square of the change of TH of the day before
+		Real64 Rate; // Estimated daily contraction rate
+		Real64 Factor; // Multiple of the last change added
+
+		if ( WarmupHistoryDays == 0 ) {
+			WarmupTHChange.dimension( TH, 0.0 );
+		} else {
+			for ( Array3D< Real64 >::size_type l = 0, e = TH.size(); l < e; ++l ) {
+				Real64 const Change( TH[ l ] - WarmupHistoryState.TH[ l ] );
+				ChangeProduct += Change * WarmupTHChange[ l ];
+				PrevChangeSquare += WarmupTHChange[ l ] * WarmupTHChange[ l ];
+				WarmupTHChange[ l ] = Change;
+			}
+			if ( WarmupHistoryDays >= 2 && PrevChangeSquare > 0.0 ) {
+				Rate = ChangeProduct / PrevChangeSquare;
+				if ( Rate > 0.0 && Rate < MaxWarmupContractionRate ) {
+					Factor = Rate / ( 1.0 - Rate );
+					ExtrapolateWarmupHistory( TH, WarmupHistoryState.TH, Factor );
+					ExtrapolateWarmupHistory( QH, WarmupHistoryState.QH, Factor );
+					ExtrapolateWarmupHistory( THM, WarmupHistoryState.THM, Factor );
+					ExtrapolateWarmupHistory( QHM, WarmupHistoryState.QHM, Factor );
+					ExtrapolateWarmupHistory( TempSurfIn, WarmupHistoryState.TempSurfIn, Factor );
+					ExtrapolateWarmupHistory( TempSurfInTmp, WarmupHistoryState.TempSurfInTmp, Factor );
+					ExtrapolateWarmupHistory( TempSurfOut, WarmupHistoryState.TempSurfOut, Factor );
+					++NumWarmupExtrapolations;
+					WarmupHistoryDays = 0; // The next change is measured from the extrapolated state
+					WarmupTHChange = 0.0;
+				}
+			}
+		}
+
+		WarmupHistoryState.TH = TH;
+		WarmupHistoryState.QH = QH;
+		WarmupHistoryState.THM = THM;
+		WarmupHistoryState.QHM = QHM;
+		WarmupHistoryState.TempSurfIn = TempSurfIn;
+		WarmupHistoryState.TempSurfInTmp = TempSurfInTmp;
+		WarmupHistoryState.TempSurfOut = TempSurfOut;
+		++WarmupHistoryDays;
+
+	}
+
 	void
 	ReportWarmupConvergence()
 	{
@@ -1,9 +1,14 @@
 #ifndef HeatBalanceManager_hh_INCLUDED
 #define HeatBalanceManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
+#include <ObjexxFCL/Array3D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -16,6 +21,10 @@ namespace HeatBalanceManager {
 	// MODULE PARAMETER DEFINITIONS
 
 	extern Array1D_string const PassFail;
+	extern int const MinNumberOfSeededWarmupDays; // Minimum warmup days of an environment started from an earlier one
+	extern Real64 const MaxWarmupSeedTempDifference; // Largest difference of the mean outdoor temperature of the first
+	// warmup day from that of an earlier environment whose state a warmup is started from {deltaC}
+	extern Real64 const MaxWarmupContractionRate; // Largest daily contraction rate of the warmup changes that is extrapolated
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -49,6 +58,14 @@ namespace HeatBalanceManager {
 	extern Array2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
 	extern int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
+	//Variables used to start the warmup from an earlier environment and to extrapolate it
+	extern bool WarmupSeeded; // The warmup of the current environment was started from an earlier one
+	extern Real64 WarmupOutDryBulbSum; // Sum of the outdoor dry-bulb temperature over the first warmup day
+	extern int WarmupOutDryBulbCount; // Zone time steps of the first warmup day in WarmupOutDryBulbSum
+	extern int WarmupHistoryDays; // Warmup days since the surface histories were last extrapolated (or the start)
+	extern int NumWarmupExtrapolations; // Number of times the surface histories were extrapolated
+	extern Array3D< Real64 > WarmupTHChange; // Change of TH over the last warmup day
+
 	extern std::string CurrentModuleObject; // to assist in getting input
 
 	// Subroutine Specifications for the Heat Balance Module
@@ -104,8 +121,47 @@ namespace HeatBalanceManager {
 
 	};
 
+	struct WarmupStateData
+	{
+		// Members
+		std::string EnvironmentName; // Environment the state converged in
+		int KindOfSim; // Kind of environment (ksDesignDay, ksRunPeriodDesign, ...)
+		Real64 MeanOutDryBulbTemp; // Mean outdoor dry-bulb temperature of the first warmup day {C}
+		// Surface temperature and flux histories
+		Array3D< Real64 > TH;
+		Array3D< Real64 > QH;
+		Array3D< Real64 > THM;
+		Array3D< Real64 > QHM;
+		Array1D< Real64 > TempSurfIn;
+		Array1D< Real64 > TempSurfInTmp;
+		Array1D< Real64 > TempSurfOut;
+		// Zone air temperature and humidity histories
+		Array1D< Real64 > MAT;
+		Array1D< Real64 > ZT;
+		Array1D< Real64 > ZTAV;
+		Array1D< Real64 > XMAT;
+		Array1D< Real64 > XM2T;
+		Array1D< Real64 > XM3T;
+		Array1D< Real64 > XM4T;
+		Array1D< Real64 > ZoneAirHumRat;
+		Array1D< Real64 > ZoneAirHumRatAvg;
+		Array1D< Real64 > WZoneTimeMinus1;
+		Array1D< Real64 > WZoneTimeMinus2;
+		Array1D< Real64 > WZoneTimeMinus3;
+		Array1D< Real64 > WZoneTimeMinus4;
+
+		// Default Constructor
+		WarmupStateData() :
+			KindOfSim( 0 ),
+			MeanOutDryBulbTemp( 0.0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< WarmupConvergence > WarmupConvergenceValues;
+	extern std::vector< WarmupStateData > WarmupSeeds; // Converged state of each environment, to start later ones from
+	extern WarmupStateData WarmupHistoryState; // Surface histories at the end of the last warmup day
 
 	// Functions
 
@@ -194,6 +250,21 @@ namespace HeatBalanceManager {
 	void
 	CheckWarmupConvergence();
 
+	void
+	UpdateWarmupState();
+
+	void
+	SaveWarmupState( WarmupStateData & state );
+
+	void
+	RestoreWarmupState( WarmupStateData const & state );
+
+	void
+	StartWarmupFromSimilarEnvironment();
+
+	void
+	ExtrapolateWarmupHistories();
+
 	void
 	ReportWarmupConvergence();
 
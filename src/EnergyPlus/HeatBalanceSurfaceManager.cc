@@ -597,7 +597,7 @@ namespace HeatBalanceSurfaceManager {
 				if ( ZoneDaylight( NZ ).TotalDaylRefPoints > 0 ) {
 					if ( Zone( NZ ).HasInterZoneWindow ) {
 						DayltgInterReflIllFrIntWins( NZ );
-						DayltgGlareWithIntWins( ZoneDaylight( NZ ).GlareIndexAtRefPt, NZ );
+						if ( ZoneDaylight( NZ ).GlareCalcNeeded ) DayltgGlareWithIntWins( ZoneDaylight( NZ ).GlareIndexAtRefPt, NZ );
 					}
 					DayltgElecLightingControl( NZ );
 				}
@@ -650,34 +650,48 @@ namespace HeatBalanceSurfaceManager {
 				auto l11( TH.index( 1, 2, SurfNum ) );
 				auto l12( TH.index( 2, 2, SurfNum ) );
 				auto const s3( TH.size3() );
-				for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
-
-					// Sign convention for the various terms in the following two equations
-					// is based on the form of the Conduction Transfer Function equation
-					// given by:
-					// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
-					// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
-					// In both equations, flux is positive from outside to inside.
-
-					//Tuned Aliases and linear indexing
-					Real64 const ctf_cross( construct.CTFCross( Term ) );
-					Real64 const TH11( TH[ l11 ] );
-					Real64 const TH12( TH[ l12 ] );
-
-					QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
+				int const numCTFTerms( construct.NumCTFTerms );
+
+				// Sign convention for the various terms in the following two equations
+				// is based on the form of the Conduction Transfer Function equation
+				// given by:
+				// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
+				// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
+				// In both equations, flux is positive from outside to inside.
+
+				if ( construct.SourceSinkPresent ) {
+					for ( Term = 1; Term <= numCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
+
+						//Tuned Aliases and linear indexing
+						Real64 const ctf_cross( construct.CTFCross( Term ) );
+						Real64 const TH11( TH[ l11 ] );
+						Real64 const TH12( TH[ l12 ] );
+						Real64 const QsrcHist1( QsrcHist( SurfNum, Term + 1 ) );
 
-					QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
+						QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
 
-					if ( construct.SourceSinkPresent ) {
-						Real64 const QsrcHist1( QsrcHist( SurfNum, Term + 1 ) );
+						QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
 
 						QIC += construct.CTFSourceIn( Term ) * QsrcHist1;
 
 						QOC += construct.CTFSourceOut( Term ) * QsrcHist1;
 
 						TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + construct.CTFFlux( Term ) * TsrcHist( SurfNum, Term + 1 );
-					}
 
+					}
+				} else { // Plain dot products over the history terms: no source/sink branch and no index arithmetic on the coefficients
+					Real64 const * const ctf_cross( &construct.CTFCross( 1 ) );
+					Real64 const * const ctf_inside( &construct.CTFInside( 1 ) );
+					Real64 const * const ctf_outside( &construct.CTFOutside( 1 ) );
+					Real64 const * const ctf_flux( &construct.CTFFlux( 1 ) );
+					for ( int iTerm = 0; iTerm < numCTFTerms; ++iTerm, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, iTerm + 2, SurfNum ), [ l12 ] == ( 2, iTerm + 2, SurfNum )
+						Real64 const TH11( TH[ l11 ] );
+						Real64 const TH12( TH[ l12 ] );
+
+						QIC += ctf_cross[ iTerm ] * TH11 - ctf_inside[ iTerm ] * TH12 + ctf_flux[ iTerm ] * QH[ l12 ];
+
+						QOC += ctf_outside[ iTerm ] * TH11 - ctf_cross[ iTerm ] * TH12 + ctf_flux[ iTerm ] * QH[ l11 ];
+					}
 				}
 
 				CTFConstOutPart( SurfNum ) = QOC;
@@ -4769,6 +4783,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	//                      May 2006 (RR  account for exterior window screen)
 	//                      Jul 2008 (P. Biddulph include calls to HAMT)
 	//                      Sep 2011 LKL/BG - resimulate only zones needing it for Radiant systems
+	//                      Oct 2026, keep the relevant surfaces of each zone and the CondFD/HAMT zones between calls
 	//       RE-ENGINEERED  Mar 1998 (RKS)
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -4820,7 +4835,10 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using ConvectionCoefficients::SetExtConvectionCoeff;
 	using ConvectionCoefficients::SetIntConvectionCoeff;
 	using HeatBalanceIntRadExchange::CalcInteriorRadExchange;
+	using DataSystemVariables::ZoneInsideSurfConvergence;
+	using DataSystemVariables::NumberSurfaceHBThreads;
 	using MoistureBalanceEMPDManager::CalcMoistureBalanceEMPD;
+	using MoistureBalanceEMPDManager::InitMoistureBalanceEMPDEnvrn;
 	using MoistureBalanceEMPDManager::UpdateMoistureBalanceEMPD;
 	using ScheduleManager::GetCurrentScheduleValue;
 	using General::RoundSigDigits;
@@ -4906,13 +4924,54 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
 	static int WarmupSurfTemp;
 	static int TimeStepInDay( 0 ); // time step number
+	static Array1D_bool FDSurfInParallel; // CondFD/HAMT surfaces that may be solved ahead of the surface loop in parallel
+	std::vector< int > FDSurfToCalc; // Relevant CondFD/HAMT surfaces solved in parallel in this iteration
+	static Array1D_bool EMPDSurfSolvedAhead; // EMPD surfaces solved ahead of the surface loop in this iteration
+	static Array1D< Real64 > TempSurfInSatEMPD; // Surface dew point temperatures of the EMPD surfaces solved ahead
+	std::vector< int > EMPDSurfToCalc; // Relevant EMPD surfaces solved in parallel in this iteration
+	static std::vector< int > AllSurfToResimulate; // All surfaces, for a full heat balance
+	static std::vector< std::vector< int > > ZoneSurfToResimulate; // Surfaces in or adjacent to each zone, for a partial heat balance
+	static Array1D_bool any_surface_ConFD_or_HAMT; // Zones with CondFD or HAMT surfaces, whose CTF temperatures are limited
 
 	// FLOW:
 	if ( firstTime ) {
 		TempInsOld.allocate( TotSurfaces );
 		RefAirTemp.allocate( TotSurfaces );
+		AllSurfToResimulate.reserve( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			AllSurfToResimulate.push_back( SurfNum );
+		}
+		//Tuned Precompute whether CTF temperature limits will be needed
+		any_surface_ConFD_or_HAMT.dimension( NumOfZones, false );
+		for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			auto const & zone( Zone( iZone ) );
+			for ( int iSurf = zone.SurfaceFirst, eSurf = zone.SurfaceLast; iSurf <= eSurf; ++iSurf ) { //Tuned Replaced any_eq and array slicing and member array usage
+				auto const alg( Surface( iSurf ).HeatTransferAlgorithm );
+				if ( ( alg == HeatTransferModel_CondFD ) || ( alg == HeatTransferModel_HAMT ) ) {
+					any_surface_ConFD_or_HAMT( iZone ) = true;
+					break;
+				}
+			}
+		}
+		// A CondFD or HAMT surface only reads boundary conditions that are fixed during one pass of the surface
+		// loop and writes its own node (or cell) states. CondFD interzone partitions are the exception, since
+		// they also update the inside face nodes of the other side, and surfaces with interior movable
+		// insulation are not solved by CondFD/HAMT every iteration.
+		FDSurfInParallel.dimension( TotSurfaces, false );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf || ( surface.Zone == 0 ) ) continue;
+			if ( ( surface.Class == SurfaceClass_Window ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) continue;
+			if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				FDSurfInParallel( SurfNum ) = ( surface.ExtBoundCond == SurfNum ) || ( surface.MaterialMovInsulInt == 0 );
+			} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+				FDSurfInParallel( SurfNum ) = ( surface.ExtBoundCond == SurfNum ) || ( ( surface.MaterialMovInsulInt == 0 ) && ( surface.ExtBoundCond <= 0 ) );
+			}
+		}
 		if ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
 			MinIterations = MinEMPDIterations;
+			EMPDSurfSolvedAhead.dimension( TotSurfaces, false );
+			TempSurfInSatEMPD.dimension( TotSurfaces, 0.0 );
 		} else {
 			MinIterations = 1;
 		}
@@ -4933,24 +4992,26 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 	bool const PartialResimulate( present( ZoneToResimulate ) );
 
-	//Tuned Relevant surfaces (set below) for performance/scalability //Do Store this once for all relevant Zones at higher level
-	std::vector< int > SurfToResimulate;
-	if ( ! PartialResimulate ) SurfToResimulate.reserve( TotSurfaces ); // Avoid resizing
+	// The surfaces relevant to each zone are found once, on the first partial heat balance (radiant systems)
+	if ( PartialResimulate && ZoneSurfToResimulate.empty() ) {
+		ZoneSurfToResimulate.resize( NumOfZones );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			ZoneNum = Surface( SurfNum ).Zone;
+			if ( ZoneNum > 0 ) ZoneSurfToResimulate[ ZoneNum - 1 ].push_back( SurfNum );
+			OtherSideZoneNum = AdjacentZoneToSurface( SurfNum );
+			if ( ( OtherSideZoneNum > 0 ) && ( OtherSideZoneNum != ZoneNum ) ) ZoneSurfToResimulate[ OtherSideZoneNum - 1 ].push_back( SurfNum );
+		}
+	}
+
+	//Tuned Relevant surfaces for performance/scalability
+	std::vector< int > const & SurfToResimulate( PartialResimulate ? ZoneSurfToResimulate[ ZoneToResimulate - 1 ] : AllSurfToResimulate );
+	auto const nSurfToResimulate( SurfToResimulate.size() );
 
 	// determine reference air temperatures
-	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+	for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+		SurfNum = SurfToResimulate[ iSurfToResimulate ];
 		ZoneNum = Surface( SurfNum ).Zone;
 
-		if ( PartialResimulate ) {
-			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) { // Surface not relevant
-				continue; // skip surfaces that are not associated with this zone
-			} else { // Surface is relevant for ZoneToResimulate
-				SurfToResimulate.push_back( SurfNum );
-			}
-		} else {
-			SurfToResimulate.push_back( SurfNum );
-		}
-
 		// These conditions are not used in every SurfNum loop here so we don't use them to skip surfaces
 		if ( ( ZoneNum == 0 ) || ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 		if ( Surface( SurfNum ).Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
@@ -5010,8 +5071,6 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			TempEffBulkAir( SurfNum ) = MAT( ZoneNum ); // for reporting surf adjacent air temp
 		}}
 	}
-	auto const nSurfToResimulate( SurfToResimulate.size() );
-
 	InsideSurfIterations = 0;
 	// Following variables must be reset due to possible recall of this routine by radiant and Resimulate routines.
 	// CalcWindowHeatBalance is called, then, multiple times and these need to be initialized before each call to
@@ -5034,26 +5093,57 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		SurfaceWindow.DividerQRadInAbs() = 0.0;
 	}
 
-	//Tuned Precompute whether CTF temperature limits will be needed //? Can we do this just once in the FirstTime block to save a little more time (with static array)
-	Array1D_bool any_surface_ConFD_or_HAMT( NumOfZones, false );
-	for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
-		auto const & zone( Zone( iZone ) );
-		for ( int iSurf = zone.SurfaceFirst, eSurf = zone.SurfaceLast; iSurf <= eSurf; ++iSurf ) { //Tuned Replaced any_eq and array slicing and member array usage
-			auto const alg( Surface( iSurf ).HeatTransferAlgorithm );
-			if ( ( alg == HeatTransferModel_CondFD ) || ( alg == HeatTransferModel_HAMT ) ) {
-				any_surface_ConFD_or_HAMT( iZone ) = true;
-				break;
-			}
-		}
+	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+
+	// The first call is kept serial so that the CondFD and HAMT input and initialization happen on one thread
+	bool const SolveFDSurfacesInParallel( ( NumberSurfaceHBThreads > 1 ) && ! firstTime && ( useCondFDHTalg || any_eq( HeatTransferAlgosUsed, UseHAMT ) ) );
+	if ( SolveFDSurfacesInParallel ) FDSurfToCalc.reserve( nSurfToResimulate );
+	bool const SolveEMPDSurfacesInParallel( ( NumberSurfaceHBThreads > 1 ) && ! firstTime && any_eq( HeatTransferAlgosUsed, UseEMPD ) );
+	if ( SolveEMPDSurfacesInParallel ) EMPDSurfToCalc.reserve( nSurfToResimulate );
+
+	// Zone-partitioned convergence: each zone drops out of the iteration once its own surfaces have
+	// converged, instead of being recomputed until the slowest zone in the building has converged
+	bool const ZonePartitioned( ZoneInsideSurfConvergence && ! PartialResimulate && ( NumOfZones > 1 ) );
+	Real64 const AllowedDelTemp( useCondFDHTalg ? MaxAllowedDelTempCondFD : MaxAllowedDelTemp );
+	Array1D_bool ZoneIterActive; // Zones still iterating
+	Array1D< Real64 > ZoneMaxDelTemp; // Maximum change in surface temperature for each zone
+	std::vector< int > SurfToIterate; // Relevant surfaces in the zones still iterating
+	if ( ZonePartitioned ) {
+		ZoneIterActive.dimension( NumOfZones, true );
+		ZoneMaxDelTemp.dimension( NumOfZones, 0.0 );
+		SurfToIterate.reserve( nSurfToResimulate );
 	}
 
-	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
 		TempInsOld = TempSurfIn; // Keep track of last iteration's temperature values
 
-		CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		// Every 30 iterations the convection coefficients of all zones are re-evaluated below, so
+		// every zone has to take part in that iteration
+		if ( ZonePartitioned && ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) ) {
+			ZoneIterActive = true;
+		}
+		int NumZonesActive( NumOfZones );
+		if ( ZonePartitioned ) {
+			NumZonesActive = count( ZoneIterActive );
+			SurfToIterate.clear();
+			for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+				SurfNum = SurfToResimulate[ iSurfToResimulate ];
+				ZoneNum = Surface( SurfNum ).Zone;
+				if ( ( ZoneNum > 0 ) && ZoneIterActive( ZoneNum ) ) SurfToIterate.push_back( SurfNum );
+			}
+		}
+		std::vector< int > const & SurfToCalc( ZonePartitioned ? SurfToIterate : SurfToResimulate );
+		auto const nSurfToCalc( SurfToCalc.size() );
+
+		if ( NumZonesActive < NumOfZones ) { // Leave the radiant exchange of converged zones as it was
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				if ( ZoneIterActive( ZoneNum ) ) CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneNum, Inside );
+			}
+		} else {
+			CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		}
 
 		// Every 30 iterations, recalculate the inside convection coefficients in case
 		// there has been a significant drift in the surface temperatures predicted.
@@ -5065,8 +5155,64 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
 		}
 
-		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
-			SurfNum = SurfToResimulate[ iSurfToResimulate ];
+		// Solve the CondFD and HAMT surfaces that do not depend on each other ahead of the surface loop, spread
+		// over threads. Each one gets the same inputs as in the loop below, so the results do not depend on
+		// the number of threads.
+		if ( SolveFDSurfacesInParallel ) {
+			FDSurfToCalc.clear();
+			for ( std::vector< int >::size_type iSurfToCalc = 0u; iSurfToCalc < nSurfToCalc; ++iSurfToCalc ) {
+				if ( FDSurfInParallel( SurfToCalc[ iSurfToCalc ] ) ) FDSurfToCalc.push_back( SurfToCalc[ iSurfToCalc ] );
+			}
+			int const nFDSurfToCalc( FDSurfToCalc.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberSurfaceHBThreads ) if ( nFDSurfToCalc > 1 )
+#endif
+			for ( int iFDSurf = 0; iFDSurf < nFDSurfToCalc; ++iFDSurf ) {
+				int const FDSurfNum( FDSurfToCalc[ iFDSurf ] );
+				auto const & surface( Surface( FDSurfNum ) );
+				int const FDZoneNum( surface.Zone );
+				Real64 const MAT_zone( MAT( FDZoneNum ) );
+				Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( FDZoneNum ), 1.0e-5 ) );
+				Real64 const HConvIn_surf( HConvInFD( FDSurfNum ) = HConvIn( FDSurfNum ) );
+				RhoVaporAirIn( FDSurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( FDSurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( FDSurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+				if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( ( surface.ExtBoundCond > 0 ) && ( surface.ExtBoundCond != FDSurfNum ) ) { // HAMT other side zone air temperature
+						TempOutsideAirFD( FDSurfNum ) = MAT( Surface( surface.ExtBoundCond ).Zone );
+					}
+					ManageHeatBalHAMT( FDSurfNum, TempSurfInTmp( FDSurfNum ), TH( 1, 1, FDSurfNum ) );
+				} else {
+					ManageHeatBalFiniteDiff( FDSurfNum, TempSurfInTmp( FDSurfNum ), TH( 1, 1, FDSurfNum ) );
+				}
+			}
+		}
+
+		// Solve the moisture balances of the EMPD surfaces ahead of the surface loop in the same way. One only reads
+		// its own surface temperatures and the zone air, and gives the moisture flux and dew point used below.
+		// Surfaces with interior movable insulation, or no EMPD properties on the inside layer, stay in the loop.
+		if ( SolveEMPDSurfacesInParallel ) {
+			InitMoistureBalanceEMPDEnvrn(); // Not left to the first surface solved on some thread
+			EMPDSurfToCalc.clear();
+			for ( std::vector< int >::size_type iSurfToCalc = 0u; iSurfToCalc < nSurfToCalc; ++iSurfToCalc ) {
+				int const EMPDSurfNum( SurfToCalc[ iSurfToCalc ] );
+				auto const & surface( Surface( EMPDSurfNum ) );
+				if ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
+				auto const & construct( Construct( surface.Construction ) );
+				EMPDSurfSolvedAhead( EMPDSurfNum ) = surface.HeatTransSurf && ( surface.Zone > 0 ) && ( surface.Class != SurfaceClass_Window ) && ( surface.Class != SurfaceClass_TDD_Dome ) && ( ( surface.ExtBoundCond == EMPDSurfNum ) || ( surface.MaterialMovInsulInt == 0 ) ) && ( Material( construct.LayerPoint( construct.TotLayers ) ).EMPDVALUE > 0.0 );
+				if ( EMPDSurfSolvedAhead( EMPDSurfNum ) ) EMPDSurfToCalc.push_back( EMPDSurfNum );
+			}
+			int const nEMPDSurfToCalc( EMPDSurfToCalc.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberSurfaceHBThreads ) if ( nEMPDSurfToCalc > 1 )
+#endif
+			for ( int iEMPDSurf = 0; iEMPDSurf < nEMPDSurfToCalc; ++iEMPDSurf ) {
+				int const EMPDSurfNum( EMPDSurfToCalc[ iEMPDSurf ] );
+				CalcMoistureBalanceEMPD( EMPDSurfNum, TempSurfInTmp( EMPDSurfNum ), TH( 2, 2, EMPDSurfNum ), MAT( Surface( EMPDSurfNum ).Zone ), TempSurfInSatEMPD( EMPDSurfNum ) );
+			}
+		}
+
+		for ( std::vector< int >::size_type iSurfToCalc = 0u; iSurfToCalc < nSurfToCalc; ++iSurfToCalc ) { // Perform a heat balance on all of the relevant inside surfaces...
+			SurfNum = SurfToCalc[ iSurfToCalc ];
 			auto & surface( Surface( SurfNum ) );
 			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
@@ -5080,13 +5226,18 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			auto const & construct( Construct( ConstrNum ) );
 			Real64 const MAT_zone( MAT( ZoneNum ) );
 			Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( ZoneNum ), 1.0e-5 ) );
+			bool const SolvedAhead( SolveFDSurfacesInParallel && FDSurfInParallel( SurfNum ) ); // CondFD/HAMT solved above
+			bool const EMPDSolvedAhead( SolveEMPDSurfacesInParallel && ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) && EMPDSurfSolvedAhead( SurfNum ) ); // EMPD solved above
 
 			// Calculate the inside surface moisture quantities
 			// calculate the inside surface moisture transfer conditions
 			// check for saturation conditions of air
-			Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
-			RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
-			HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			Real64 const HConvIn_surf( HConvIn( SurfNum ) );
+			if ( ! SolvedAhead ) { // HAMT may have changed HMassConvInFD already
+				HConvInFD( SurfNum ) = HConvIn_surf;
+				RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			}
 
 			// Perform heat balance on the inside face of the surface ...
 			// The following are possibilities here:
@@ -5108,7 +5259,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 				// Surface is a partition
 				if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+					if ( EMPDSolvedAhead ) {
+						TempSurfInSat = TempSurfInSatEMPD( SurfNum );
+					} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
 						CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
 					}
 					//Pre-calculate a few terms
@@ -5139,7 +5292,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 					}
 
-				} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				} else if ( ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) && ! SolvedAhead ) {
 
 					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
@@ -5162,7 +5315,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 						if ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF || surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) { // Regular CTF Surface and/or EMPD surface
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+							if ( EMPDSolvedAhead ) {
+								TempSurfInSat = TempSurfInSatEMPD( SurfNum );
+							} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
 								CalcMoistureBalanceEMPD( SurfNum, TempSurfInTmp( SurfNum ), TH22, MAT_zone, TempSurfInSat );
 							}
 							//Pre-calculate a few terms
@@ -5209,7 +5364,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 							}
 
-						} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+						} else if ( ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) && ! SolvedAhead ) {
 
 							if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 								if ( surface.ExtBoundCond > 0 ) {
@@ -5543,22 +5698,40 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		// Convergence check
 		MaxDelTemp = 0.0;
-		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Loop through all relevant surfaces to check for convergence...
-			SurfNum = SurfToResimulate[ iSurfToResimulate ];
+		if ( ZonePartitioned ) ZoneMaxDelTemp = 0.0;
+		for ( std::vector< int >::size_type iSurfToCalc = 0u; iSurfToCalc < nSurfToCalc; ++iSurfToCalc ) { // Loop through all relevant surfaces to check for convergence...
+			SurfNum = SurfToCalc[ iSurfToCalc ];
 
 			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 
 			ConstrNum = Surface( SurfNum ).Construction;
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
-				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
+				Real64 SurfDelTemp( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ) );
 				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
 					// also check all internal nodes as well as surface faces
-					MaxDelTemp = max( MaxDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
+					SurfDelTemp = max( SurfDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
+				}
+				MaxDelTemp = max( SurfDelTemp, MaxDelTemp );
+				if ( ZonePartitioned ) {
+					ZoneNum = Surface( SurfNum ).Zone;
+					ZoneMaxDelTemp( ZoneNum ) = max( SurfDelTemp, ZoneMaxDelTemp( ZoneNum ) );
+					// The other side of an interzone surface sees this change as a new outside temperature
+					int const surfExtBoundCond( Surface( SurfNum ).ExtBoundCond );
+					if ( ( surfExtBoundCond > 0 ) && ( surfExtBoundCond != SurfNum ) ) {
+						int const AdjZoneNum( Surface( surfExtBoundCond ).Zone );
+						if ( AdjZoneNum > 0 ) ZoneMaxDelTemp( AdjZoneNum ) = max( SurfDelTemp, ZoneMaxDelTemp( AdjZoneNum ) );
+					}
 				}
 			}
 
 		} // ...end of loop to check for convergence
 
+		if ( ZonePartitioned ) { // MaxAllowedDelTemp applies to each zone on its own
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				ZoneIterActive( ZoneNum ) = ( ZoneMaxDelTemp( ZoneNum ) > AllowedDelTemp ) || ( InsideSurfIterations < MinIterations );
+			}
+		}
+
 		if ( ! useCondFDHTalg ) {
 			if ( MaxDelTemp <= MaxAllowedDelTemp ) Converged = true;
 		} else {
@@ -1439,7 +1439,12 @@ namespace IceThermalStorage {
 			// Calculate QiceMin by UAIceDisCh*deltaTlm
 			//   with UAIceDisCh(function of XCurIceFrac), ITSInletTemp and ITSOutletTemp(=Node(OutletNodeNum)%TempSetPoint by E+[C])
 			// QiceMin is REAL(r64) ITS capacity.
-			CalcQiceDischageMax( QiceMin );
+			// With no ice left to melt Umin is zero whatever QiceMin is, so skip the LMTD
+			if ( XCurIceFrac <= EpsLimitForX ) {
+				QiceMin = 0.0;
+			} else {
+				CalcQiceDischageMax( QiceMin );
+			}
 
 			// At the first call of ITS model, MyLoad is 0. After that proper MyLoad will be provided by E+.
 			// Therefore, Umin is decided between input U and ITS REAL(r64) capacity.
@@ -1608,17 +1613,22 @@ namespace IceThermalStorage {
 			//--------------------------------------------------------
 			// Calcualte QiceMax with QiceMaxByChiller, QiceMaxByITS, QchillerMax
 			//--------------------------------------------------------
-			// Calculate Qice charge max by Chiller with Twb and UAIceCh
-			CalcQiceChargeMaxByChiller( IceNum, QiceMaxByChiller ); //[W]
-
 			// Chiller is remote now, so chiller out is inlet node temp
 			ChillerOutletTemp = Node( IceStorage( IceNum ).PltInletNodeNum ).Temp;
-			// Calculate Qice charge max by ITS with ChillerOutletTemp
-			CalcQiceChargeMaxByITS( IceNum, ChillerOutletTemp, QiceMaxByITS ); //[W]
+			if ( XCurIceFrac >= 1.0 - EpsLimitForX ) {
+				// Fully charged: Umax below is zero whatever QiceMax is, so skip the capacity limits
+				QiceMax = 0.0;
+			} else {
+				// Calculate Qice charge max by Chiller with Twb and UAIceCh
+				CalcQiceChargeMaxByChiller( IceNum, QiceMaxByChiller ); //[W]
 
-			// Select minimum as QiceMax
-			// Because It is uncertain that QiceMax by chiller is same as QiceMax by ITS.
-			QiceMax = min( QiceMaxByChiller, QiceMaxByITS );
+				// Calculate Qice charge max by ITS with ChillerOutletTemp
+				CalcQiceChargeMaxByITS( IceNum, ChillerOutletTemp, QiceMaxByITS ); //[W]
+
+				// Select minimum as QiceMax
+				// Because It is uncertain that QiceMax by chiller is same as QiceMax by ITS.
+				QiceMax = min( QiceMaxByChiller, QiceMaxByITS );
+			}
 
 			//--------------------------------------------------------
 			// Calculate Umin,Umax,Uact
@@ -2022,13 +2032,15 @@ namespace IceThermalStorage {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR
 		//       DATE WRITTEN
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, reuse the UA values while the ice fraction is unchanged
 		//       RE-ENGINEERED
 
 		// PURPOSE OF THIS SUBROUTINE:
 
 		// METHODOLOGY EMPLOYED:
 		// This routine is funtion of XCurIceFrac, and UA vaule is based on 1 hour.
+		// The ice fraction only changes once per system timestep, so the values are kept for the
+		// plant iterations that follow.
 
 		// REFERENCES:
 
@@ -2049,6 +2061,12 @@ namespace IceThermalStorage {
 		//  REAL(r64)  :: Tfr     ! IP freezing temperature
 
 		// Flow
+		if ( XCurIceFrac == IceStorage( IceNum ).UAIceFrac ) {
+			UAIceCh = IceStorage( IceNum ).UAIceChLast;
+			UAIceDisCh = IceStorage( IceNum ).UAIceDisChLast;
+			HLoss = 0.0;
+			return;
+		}
 
 		{ auto const SELECT_CASE_var( IceStorage( IceNum ).ITSType_Num );
 		if ( SELECT_CASE_var == ITSType_IceOnCoilInternal ) {
@@ -2066,6 +2084,10 @@ namespace IceThermalStorage {
 
 		}}
 
+		IceStorage( IceNum ).UAIceFrac = XCurIceFrac;
+		IceStorage( IceNum ).UAIceChLast = UAIceCh;
+		IceStorage( IceNum ).UAIceDisChLast = UAIceDisCh;
+
 	}
 
 	Real64
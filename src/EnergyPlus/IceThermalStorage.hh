@@ -151,6 +151,9 @@ namespace IceThermalStorage {
 		int BranchNum;
 		int CompNum;
 		Real64 DesignMassFlowRate;
+		Real64 UAIceFrac; // Ice fraction the UA values below were calculated for (-1 when not calculated yet)
+		Real64 UAIceChLast; // Charging UA at UAIceFrac [W/C]
+		Real64 UAIceDisChLast; // Discharging UA at UAIceFrac [W/C]
 
 		// Default Constructor
 		IceStorageSpecs() :
@@ -164,7 +167,10 @@ namespace IceThermalStorage {
 			LoopSideNum( 0 ),
 			BranchNum( 0 ),
 			CompNum( 0 ),
-			DesignMassFlowRate( 0.0 )
+			DesignMassFlowRate( 0.0 ),
+			UAIceFrac( -1.0 ),
+			UAIceChLast( 0.0 ),
+			UAIceDisChLast( 0.0 )
 		{}
 
 		// Member Constructor
@@ -195,7 +201,10 @@ namespace IceThermalStorage {
 			LoopSideNum( LoopSideNum ),
 			BranchNum( BranchNum ),
 			CompNum( CompNum ),
-			DesignMassFlowRate( DesignMassFlowRate )
+			DesignMassFlowRate( DesignMassFlowRate ),
+			UAIceFrac( -1.0 ),
+			UAIceChLast( 0.0 ),
+			UAIceDisChLast( 0.0 )
 		{}
 
 	};
@@ -1,6 +1,18 @@
 // C++ Headers
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <istream>
+#include <iterator>
+#include <string>
+#include <utility>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Backspace.hh>
@@ -19,7 +31,9 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
+#include <MappedFile.hh>
 #include <SortAndStringUtilities.hh>
 
 namespace EnergyPlus {
@@ -65,6 +79,7 @@ namespace InputProcessor {
 	using DataSizing::AutoSize;
 	using namespace DataIPShortCuts;
 	using DataSystemVariables::SortedIDD;
+	using DataSystemVariables::IDDCacheFolder;
 	using DataSystemVariables::iASCII_CR;
 	using DataSystemVariables::iUnicode_end;
 	using DataGlobals::DisplayInputInAudit;
@@ -92,6 +107,7 @@ namespace InputProcessor {
 	static std::string const AlphaNum( "ANan" ); // Valid indicators for Alpha or Numeric fields (A or N)
 	Real64 const DefAutoSizeValue( AutoSize );
 	Real64 const DefAutoCalculateValue( AutoCalculate );
+	char const IDDSnapshotMagic[ 8 ] = { 'E', 'P', 'I', 'D', 'D', 'S', '0', '1' }; // Tag at the start of IDD snapshot files
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
 
@@ -130,6 +146,7 @@ namespace InputProcessor {
 	int TotalAuditErrors( 0 ); // Counting some warnings that go onto only the audit file
 	int NumSecretObjects( 0 ); // Number of objects in "Secret Mode"
 	bool ProcessingIDD( false ); // True when processing IDD, false when processing IDF
+	bool IDDPreloaded( false ); // True when the data dictionary was read ahead of ProcessInput (server mode)
 	std::ostream * echo_stream( nullptr ); // Internal stream used for input file echoing (used for performance)
 
 	//Real Variables for Module
@@ -142,6 +159,12 @@ namespace InputProcessor {
 	Array1D_int iListOfObjects;
 	Array1D_int ObjectGotCount;
 	Array1D_int ObjectStartRecord;
+	std::unordered_map< std::string, int > ObjectDefIndex; // Object definition of each (uppercase) object type
+	Array1D< std::vector< int > > ObjectRecords; // IDF records of each object definition, in input order
+	Array1D< std::unordered_map< std::string, int > > ObjectItemNums; // Item number of each object name, by object definition
+	int NumObjectRecordsSet( -1 ); // Number of IDF records in ObjectRecords (-1 if not set)
+	std::unordered_map< std::string, int > InternedNameIDs; // ID of each interned (uppercase) name
+	std::vector< std::string > InternedNames; // Interned (uppercase) names, InternedNames[ ID - 1 ]
 	std::string CurrentFieldName; // Current Field Name (IDD)
 	Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	std::string ReplacementName;
@@ -183,7 +206,7 @@ namespace InputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   August 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, skip the data dictionary when it was preloaded
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -232,6 +255,8 @@ namespace InputProcessor {
 		int write_stat;
 		int read_stat;
 
+		DataTimings::ProfileTimer const profileTimer( "ProcessInput" ); // Region of the timing profile
+
 		InitSecretObjects();
 
 		EchoInputFile = GetNewUnitNumber();
@@ -258,23 +283,11 @@ namespace InputProcessor {
 			ShowFatalError( "ProcessInput: Could not open file " + outputIperrFileName + " for output (write)." );
 		}
 
-		std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idd_stream ) {
-			if ( idd_stream.is_open() ) idd_stream.close();
-			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
-				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
-			} else {
-				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
-			}
-		}
-		NumLines = 0;
-
 		DoingInputProcessing = true;
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
 		DisplayString( "Processing Data Dictionary" );
 		ProcessingIDD = true;
-		ProcessDataDicFile( idd_stream, ErrorsInIDD );
-		idd_stream.close();
+		if ( ! IDDPreloaded ) ReadDataDictionary( ErrorsInIDD );
 
 		ListOfObjects.allocate( NumObjectDefs );
 		ListOfObjects = ObjectDef( {1,NumObjectDefs} ).Name();
@@ -284,6 +297,12 @@ namespace InputProcessor {
 		}
 		ObjectStartRecord.dimension( NumObjectDefs, 0 );
 		ObjectGotCount.dimension( NumObjectDefs, 0 );
+		ObjectDefIndex.clear();
+		ObjectDefIndex.reserve( NumObjectDefs );
+		for ( Loop = 1; Loop <= NumObjectDefs; ++Loop ) {
+			ObjectDefIndex.emplace( MakeUPPERCase( ObjectDef( Loop ).Name ), Loop );
+		}
+		NumObjectRecordsSet = -1;
 
 		if ( NumObjectDefs == 0 ) {
 			ShowFatalError( "ProcessInput: No objects found in IDD.  Program will terminate." );
@@ -310,16 +329,16 @@ namespace InputProcessor {
 			gio::write( EchoInputFile, fmtLD ) << " Echo of input lines is off. May be activated by setting the environmental variable DISPLAYINPUTINAUDIT=YES";
 		}
 
-		std::ifstream idf_stream( inputIdfFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idf_stream ) {
-			if ( idf_stream.is_open() ) idf_stream.close();
+		MappedFileBuf idf_buf( inputIdfFileName ); // IDF is read straight from the mapped file
+		std::istream idf_stream( &idf_buf );
+		if ( ! idf_buf.is_open() ) {
 			ShowFatalError( "ProcessInput: Could not open file \"" + inputIdfFileName + "\" for input (read)." );
 		}
 		NumLines = 0;
 		EchoInputLine = true;
 		DisplayString( "Processing Input File" );
 		ProcessInputDataFile( idf_stream );
-		idf_stream.close();
+		idf_buf.close();
 
 		ListOfSections.allocate( NumSectionDefs );
 		ListOfSections = SectionDef( {1,NumSectionDefs} ).Name();
@@ -357,12 +376,7 @@ namespace InputProcessor {
 			++CountErr;
 			Which = SectionsOnFile( Loop ).FirstRecord;
 			if ( Which > 0 ) {
-				if ( SortedIDD ) {
-					Num1 = FindItemInSortedList( IDFRecords( Which ).Name, ListOfObjects, NumObjectDefs );
-					if ( Num1 != 0 ) Num1 = iListOfObjects( Num1 );
-				} else {
-					Num1 = FindItemInList( IDFRecords( Which ).Name, ListOfObjects, NumObjectDefs );
-				}
+				Num1 = FindObjectDefinition( IDFRecords( Which ).Name );
 				if ( ObjectDef( Num1 ).NameAlpha1 && IDFRecords( Which ).NumAlphas > 0 ) {
 					gio::write( EchoInputFile, fmtA ) << " Potential \"semi-colon\" misplacement=" + SectionsOnFile( Loop ).Name + ", at about line number=[" + IPTrimSigDigits( SectionsOnFile( Loop ).FirstLineNo ) + "], Object Type Preceding=" + IDFRecords( Which ).Name + ", Object Name=" + IDFRecords( Which ).Alphas( 1 );
 				} else {
@@ -425,6 +439,98 @@ namespace InputProcessor {
 
 	}
 
+	void
+	ReadDataDictionary( bool & ErrorsInIDD ) // set to true if any errors flagged during IDD processing
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the object and section definitions of the data dictionary (inputIddFileName).
+
+		// METHODOLOGY EMPLOYED:
+		// The IDD is mapped and parsed, or its definitions are taken from the pre-parsed IDD
+		// snapshot when an IDD cache folder is set.  Moved here from ProcessInput so that the
+		// server mode can read the dictionary once ahead of its jobs.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t IDDKey( 0 ); // IDD snapshot key of the data dictionary
+		std::string IDDVersion; // Version string of the data dictionary
+		std::string IDDSnapshotFile; // Pre-parsed IDD snapshot file
+		bool IDDSnapshotRead( false ); // True when the definitions came from a pre-parsed IDD snapshot
+
+		MappedFileBuf idd_buf( inputIddFileName ); // IDD is read straight from the mapped file
+		std::istream idd_stream( &idd_buf );
+		if ( ! idd_buf.is_open() ) {
+			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
+				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
+			} else {
+				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
+			}
+		}
+		NumLines = 0;
+
+		if ( ! IDDCacheFolder.empty() ) {
+			IDDKey = IDDSnapshotKey( idd_stream, IDDVersion );
+			IDDSnapshotFile = IDDSnapshotFileName( IDDKey );
+			IDDSnapshotRead = ReadIDDSnapshot( IDDSnapshotFile, IDDKey, IDDVersion );
+		}
+		if ( ! IDDSnapshotRead ) {
+			ProcessDataDicFile( idd_stream, ErrorsInIDD );
+			if ( ! IDDCacheFolder.empty() && ! ErrorsInIDD && NumObjectDefs > 0 ) WriteIDDSnapshot( IDDSnapshotFile, IDDKey );
+		}
+		idd_buf.close();
+
+	}
+
+	void
+	PreloadDataDictionary()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the data dictionary ahead of ProcessInput, which then only processes the input
+		// file.  Used by the server mode, whose jobs all start from the preloaded dictionary.
+
+		// METHODOLOGY EMPLOYED:
+		// The dictionary echo goes to the audit file as in ProcessInput; the file is removed
+		// again when the dictionary has no errors.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		bool ErrorsInIDD( false ); // to check for any errors flagged during data dictionary processing
+		int write_stat;
+
+		EchoInputFile = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( EchoInputFile, outputAuditFileName, flags ); write_stat = flags.ios(); }
+		if ( write_stat != 0 ) {
+			DisplayString( "Could not open (write) "+ outputAuditFileName + " ." );
+			ShowFatalError( "PreloadDataDictionary: Could not open file " + outputAuditFileName + " for output (write)." );
+		}
+		echo_stream = gio::out_stream( EchoInputFile );
+
+		DisplayString( "Processing Data Dictionary" );
+		ProcessingIDD = true;
+		ReadDataDictionary( ErrorsInIDD );
+		ProcessingIDD = false;
+
+		if ( ErrorsInIDD || NumObjectDefs == 0 ) {
+			ShowFatalError( "PreloadDataDictionary: Errors found in the data dictionary " + inputIddFileName + ", see " + outputAuditFileName + "." );
+		}
+		{ IOFlags flags; flags.DISPOSE( "delete" ); gio::close( EchoInputFile, flags ); }
+		echo_stream = nullptr;
+		IDDPreloaded = true;
+
+	}
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
@@ -516,6 +622,431 @@ namespace InputProcessor {
 
 	}
 
+	std::uint64_t
+	IDDSnapshotKey(
+		std::istream & idd_stream,
+		std::string & IDDVersion // Version string from the first line of the IDD (blank if none)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the key of the pre-parsed IDD snapshot for the data dictionary on idd_stream and
+		// gets its version string the way ProcessDataDicFile does.  The stream is rewound.
+
+		// METHODOLOGY EMPLOYED:
+		// The key is the 64 bit FNV-1a hash of the whole file, so any edit of the IDD gives a new
+		// snapshot.  Reading the bytes is a small part of the time taken to parse them.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Key( 14695981039346656037ULL ); // FNV-1a offset basis
+		char Buffer[ 65536 ];
+
+		idd_stream.clear();
+		idd_stream.seekg( 0, std::ios::beg );
+		while ( idd_stream.read( Buffer, sizeof( Buffer ) ) || idd_stream.gcount() > 0 ) {
+			std::streamsize const n( idd_stream.gcount() );
+			for ( std::streamsize i = 0; i < n; ++i ) {
+				Key = ( Key ^ static_cast< unsigned char >( Buffer[ i ] ) ) * 1099511628211ULL; // FNV-1a prime
+			}
+		}
+
+		IDDVersion.clear();
+		idd_stream.clear();
+		idd_stream.seekg( 0, std::ios::beg );
+		cross_platform_get_line( idd_stream, InputLine );
+		if ( idd_stream && has( InputLine, "!IDD_Version" ) ) IDDVersion = InputLine.substr( 1, len( InputLine ) - 1 );
+		idd_stream.clear();
+		idd_stream.seekg( 0, std::ios::beg );
+
+		return Key;
+
+	}
+
+	std::string
+	IDDSnapshotFileName( std::uint64_t const Key ) // IDD snapshot key
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the pre-parsed IDD snapshot file for a key.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char KeyString[ 17 ];
+
+		std::snprintf( KeyString, sizeof( KeyString ), "%016llx", static_cast< unsigned long long >( Key ) );
+		std::string FileName( IDDCacheFolder );
+		if ( ! FileName.empty() && FileName.back() != pathChar && FileName.back() != altpathChar ) FileName += pathChar;
+		return FileName + "eplusidd_" + KeyString + ".bin";
+
+	}
+
+	// Writers and readers of the items in an IDD snapshot.  Readers return false once the
+	// snapshot runs out, so a truncated file is never taken for a good one.
+
+	inline
+	void
+	PutSnapshotInt( std::string & Snapshot, int const Value )
+	{
+		std::int32_t const Item( Value );
+		Snapshot.append( reinterpret_cast< char const * >( &Item ), sizeof( Item ) );
+	}
+
+	inline
+	void
+	PutSnapshotReal( std::string & Snapshot, Real64 const Value )
+	{
+		Snapshot.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+	}
+
+	inline
+	void
+	PutSnapshotString( std::string & Snapshot, std::string const & Value )
+	{
+		PutSnapshotInt( Snapshot, static_cast< int >( Value.size() ) );
+		Snapshot.append( Value );
+	}
+
+	inline
+	void
+	PutSnapshotBools( std::string & Snapshot, Array1D_bool const & Values )
+	{
+		PutSnapshotInt( Snapshot, Values.isize() );
+		for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) {
+			Snapshot.push_back( Values( Loop ) ? '\1' : '\0' );
+		}
+	}
+
+	inline
+	void
+	PutSnapshotStrings( std::string & Snapshot, Array1D_string const & Values )
+	{
+		PutSnapshotInt( Snapshot, Values.isize() );
+		for ( int Loop = 1, e = Values.isize(); Loop <= e; ++Loop ) {
+			PutSnapshotString( Snapshot, Values( Loop ) );
+		}
+	}
+
+	inline
+	bool
+	GetSnapshotInt( std::string const & Snapshot, std::string::size_type & Pos, int & Value )
+	{
+		std::int32_t Item;
+		if ( Snapshot.size() - Pos < sizeof( Item ) ) return false;
+		std::memcpy( &Item, Snapshot.data() + Pos, sizeof( Item ) );
+		Pos += sizeof( Item );
+		Value = Item;
+		return true;
+	}
+
+	inline
+	bool
+	GetSnapshotCount( std::string const & Snapshot, std::string::size_type & Pos, int & Value )
+	{
+		return GetSnapshotInt( Snapshot, Pos, Value ) && Value >= 0 && std::string::size_type( Value ) <= Snapshot.size() - Pos;
+	}
+
+	inline
+	bool
+	GetSnapshotReal( std::string const & Snapshot, std::string::size_type & Pos, Real64 & Value )
+	{
+		if ( Snapshot.size() - Pos < sizeof( Value ) ) return false;
+		std::memcpy( &Value, Snapshot.data() + Pos, sizeof( Value ) );
+		Pos += sizeof( Value );
+		return true;
+	}
+
+	inline
+	bool
+	GetSnapshotBool( std::string const & Snapshot, std::string::size_type & Pos, bool & Value )
+	{
+		if ( Pos >= Snapshot.size() ) return false;
+		Value = ( Snapshot[ Pos++ ] != '\0' );
+		return true;
+	}
+
+	inline
+	bool
+	GetSnapshotString( std::string const & Snapshot, std::string::size_type & Pos, std::string & Value )
+	{
+		int Size;
+		if ( ! GetSnapshotCount( Snapshot, Pos, Size ) ) return false;
+		Value.assign( Snapshot, Pos, Size );
+		Pos += Size;
+		return true;
+	}
+
+	inline
+	bool
+	GetSnapshotBools( std::string const & Snapshot, std::string::size_type & Pos, Array1D_bool & Values )
+	{
+		int Size;
+		if ( ! GetSnapshotCount( Snapshot, Pos, Size ) ) return false;
+		Values.allocate( Size );
+		for ( int Loop = 1; Loop <= Size; ++Loop ) {
+			Values( Loop ) = ( Snapshot[ Pos++ ] != '\0' );
+		}
+		return true;
+	}
+
+	inline
+	bool
+	GetSnapshotStrings( std::string const & Snapshot, std::string::size_type & Pos, Array1D_string & Values )
+	{
+		int Size;
+		if ( ! GetSnapshotCount( Snapshot, Pos, Size ) ) return false;
+		Values.allocate( Size );
+		for ( int Loop = 1; Loop <= Size; ++Loop ) {
+			if ( ! GetSnapshotString( Snapshot, Pos, Values( Loop ) ) ) return false;
+		}
+		return true;
+	}
+
+	bool
+	ReadIDDSnapshot(
+		std::string const & FileName, // IDD snapshot file
+		std::uint64_t const Key, // IDD snapshot key of the data dictionary
+		std::string const & IDDVersion // Version string of the data dictionary
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the section and object definitions from a pre-parsed IDD snapshot, leaving the
+		// module in the state ProcessDataDicFile leaves it in for the same data dictionary.
+		// Returns false (and leaves the definitions untouched) if the file is missing, damaged, or
+		// was written for another data dictionary or IDD version.
+
+		// METHODOLOGY EMPLOYED:
+		// A snapshot is the IDDSnapshotMagic tag, the key, the IDD version string and the counts
+		// found in the IDD, followed by the section names, each object definition and the names of
+		// the replacements of obsolete objects (see WriteIDDSnapshot).  The whole file is read and
+		// checked before anything is moved into the module arrays.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string Snapshot;
+		std::string::size_type Pos( sizeof( IDDSnapshotMagic ) );
+		std::uint64_t FileKey( 0 );
+		std::string FileVersion;
+		int NumSections;
+		int NumObjects;
+		int MaxSections;
+		int MaxObjects;
+		int NumObsolete;
+		int MaxAlphas;
+		int MaxNumerics;
+		int NumAlphas;
+		int NumNumerics;
+		Array1D< SectionsDefinition > Sections;
+		Array1D< ObjectsDefinition > Objects;
+		Array1D_string ObsoleteRepNames;
+
+		{
+			std::ifstream SnapshotFile( FileName, std::ios::binary );
+			if ( ! SnapshotFile ) return false;
+			Snapshot.assign( std::istreambuf_iterator< char >( SnapshotFile ), std::istreambuf_iterator< char >() );
+			if ( SnapshotFile.bad() ) return false;
+		}
+
+		if ( Snapshot.size() < sizeof( IDDSnapshotMagic ) + sizeof( FileKey ) ) return false;
+		if ( std::memcmp( Snapshot.data(), IDDSnapshotMagic, sizeof( IDDSnapshotMagic ) ) != 0 ) return false;
+		std::memcpy( &FileKey, Snapshot.data() + Pos, sizeof( FileKey ) );
+		Pos += sizeof( FileKey );
+		if ( FileKey != Key ) return false;
+		if ( ! GetSnapshotString( Snapshot, Pos, FileVersion ) || FileVersion != IDDVersion ) return false;
+
+		if ( ! GetSnapshotCount( Snapshot, Pos, NumSections ) || ! GetSnapshotCount( Snapshot, Pos, NumObjects ) ) return false;
+		if ( ! GetSnapshotInt( Snapshot, Pos, MaxSections ) || ! GetSnapshotInt( Snapshot, Pos, MaxObjects ) ) return false;
+		if ( ! GetSnapshotCount( Snapshot, Pos, NumObsolete ) ) return false;
+		if ( ! GetSnapshotInt( Snapshot, Pos, MaxAlphas ) || ! GetSnapshotInt( Snapshot, Pos, MaxNumerics ) ) return false;
+		if ( ! GetSnapshotInt( Snapshot, Pos, NumAlphas ) || ! GetSnapshotInt( Snapshot, Pos, NumNumerics ) ) return false;
+		if ( NumObjects == 0 || MaxSections < NumSections || MaxObjects < NumObjects ) return false;
+
+		Sections.allocate( MaxSections );
+		for ( int Loop = 1; Loop <= NumSections; ++Loop ) {
+			if ( ! GetSnapshotString( Snapshot, Pos, Sections( Loop ).Name ) ) return false;
+		}
+
+		Objects.allocate( MaxObjects );
+		for ( int Loop = 1; Loop <= NumObjects; ++Loop ) {
+			auto & Object( Objects( Loop ) );
+			if ( ! GetSnapshotString( Snapshot, Pos, Object.Name ) ) return false;
+			if ( ! GetSnapshotInt( Snapshot, Pos, Object.NumParams ) || ! GetSnapshotInt( Snapshot, Pos, Object.NumAlpha ) ) return false;
+			if ( ! GetSnapshotInt( Snapshot, Pos, Object.NumNumeric ) || ! GetSnapshotInt( Snapshot, Pos, Object.MinNumFields ) ) return false;
+			if ( ! GetSnapshotBool( Snapshot, Pos, Object.NameAlpha1 ) || ! GetSnapshotBool( Snapshot, Pos, Object.UniqueObject ) ) return false;
+			if ( ! GetSnapshotBool( Snapshot, Pos, Object.RequiredObject ) || ! GetSnapshotBool( Snapshot, Pos, Object.ExtensibleObject ) ) return false;
+			if ( ! GetSnapshotInt( Snapshot, Pos, Object.ExtensibleNum ) || ! GetSnapshotInt( Snapshot, Pos, Object.LastExtendAlpha ) ) return false;
+			if ( ! GetSnapshotInt( Snapshot, Pos, Object.LastExtendNum ) || ! GetSnapshotInt( Snapshot, Pos, Object.ObsPtr ) ) return false;
+			if ( Object.ObsPtr < 0 || Object.ObsPtr > NumObsolete ) return false;
+			if ( ! GetSnapshotBools( Snapshot, Pos, Object.AlphaOrNumeric ) || ! GetSnapshotBools( Snapshot, Pos, Object.ReqField ) ) return false;
+			if ( ! GetSnapshotBools( Snapshot, Pos, Object.AlphRetainCase ) ) return false;
+			if ( ! GetSnapshotStrings( Snapshot, Pos, Object.AlphFieldChks ) || ! GetSnapshotStrings( Snapshot, Pos, Object.AlphFieldDefs ) ) return false;
+			int NumRangeChks;
+			if ( ! GetSnapshotCount( Snapshot, Pos, NumRangeChks ) ) return false;
+			Object.NumRangeChks.allocate( NumRangeChks );
+			for ( int Item = 1; Item <= NumRangeChks; ++Item ) {
+				auto & RangeChk( Object.NumRangeChks( Item ) );
+				if ( ! GetSnapshotBool( Snapshot, Pos, RangeChk.MinMaxChk ) || ! GetSnapshotInt( Snapshot, Pos, RangeChk.FieldNumber ) ) return false;
+				if ( ! GetSnapshotString( Snapshot, Pos, RangeChk.FieldName ) ) return false;
+				for ( int MinMax = 1; MinMax <= 2; ++MinMax ) {
+					if ( ! GetSnapshotString( Snapshot, Pos, RangeChk.MinMaxString( MinMax ) ) ) return false;
+					if ( ! GetSnapshotReal( Snapshot, Pos, RangeChk.MinMaxValue( MinMax ) ) ) return false;
+					if ( ! GetSnapshotInt( Snapshot, Pos, RangeChk.WhichMinMax( MinMax ) ) ) return false;
+				}
+				if ( ! GetSnapshotBool( Snapshot, Pos, RangeChk.DefaultChk ) || ! GetSnapshotReal( Snapshot, Pos, RangeChk.Default ) ) return false;
+				if ( ! GetSnapshotBool( Snapshot, Pos, RangeChk.DefAutoSize ) || ! GetSnapshotBool( Snapshot, Pos, RangeChk.AutoSizable ) ) return false;
+				if ( ! GetSnapshotReal( Snapshot, Pos, RangeChk.AutoSizeValue ) ) return false;
+				if ( ! GetSnapshotBool( Snapshot, Pos, RangeChk.DefAutoCalculate ) || ! GetSnapshotBool( Snapshot, Pos, RangeChk.AutoCalculatable ) ) return false;
+				if ( ! GetSnapshotReal( Snapshot, Pos, RangeChk.AutoCalculateValue ) ) return false;
+			}
+		}
+
+		if ( ! GetSnapshotStrings( Snapshot, Pos, ObsoleteRepNames ) || ObsoleteRepNames.isize() != NumObsolete ) return false;
+		if ( Pos != Snapshot.size() ) return false;
+
+		SectionDef = std::move( Sections );
+		ObjectDef = std::move( Objects );
+		ObsoleteObjectsRepNames = std::move( ObsoleteRepNames );
+		NumSectionDefs = NumSections;
+		NumObjectDefs = NumObjects;
+		MaxSectionDefs = MaxSections;
+		MaxObjectDefs = MaxObjects;
+		NumObsoleteObjects = NumObsolete;
+		MaxAlphaArgsFound = MaxAlphas;
+		MaxNumericArgsFound = MaxNumerics;
+		NumAlphaArgsFound = NumAlphas;
+		NumNumericArgsFound = NumNumerics;
+		IDDVerString = FileVersion;
+		return true;
+
+	}
+
+	void
+	WriteIDDSnapshot(
+		std::string const & FileName, // IDD snapshot file
+		std::uint64_t const Key // IDD snapshot key of the data dictionary
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the section and object definitions just read from the data dictionary in a
+		// pre-parsed IDD snapshot (see ReadIDDSnapshot).
+
+		// METHODOLOGY EMPLOYED:
+		// As for the CTF cache, the file is written under a temporary name that includes the
+		// process id and then renamed, so runs sharing the cache folder never see a partially
+		// written snapshot.  Failures are reported as a warning.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Snapshot( IDDSnapshotMagic, sizeof( IDDSnapshotMagic ) );
+
+		Snapshot.append( reinterpret_cast< char const * >( &Key ), sizeof( Key ) );
+		PutSnapshotString( Snapshot, IDDVerString );
+		PutSnapshotInt( Snapshot, NumSectionDefs );
+		PutSnapshotInt( Snapshot, NumObjectDefs );
+		PutSnapshotInt( Snapshot, MaxSectionDefs );
+		PutSnapshotInt( Snapshot, MaxObjectDefs );
+		PutSnapshotInt( Snapshot, NumObsoleteObjects );
+		PutSnapshotInt( Snapshot, MaxAlphaArgsFound );
+		PutSnapshotInt( Snapshot, MaxNumericArgsFound );
+		PutSnapshotInt( Snapshot, NumAlphaArgsFound );
+		PutSnapshotInt( Snapshot, NumNumericArgsFound );
+
+		for ( int Loop = 1; Loop <= NumSectionDefs; ++Loop ) {
+			PutSnapshotString( Snapshot, SectionDef( Loop ).Name );
+		}
+
+		for ( int Loop = 1; Loop <= NumObjectDefs; ++Loop ) {
+			auto const & Object( ObjectDef( Loop ) );
+			PutSnapshotString( Snapshot, Object.Name );
+			PutSnapshotInt( Snapshot, Object.NumParams );
+			PutSnapshotInt( Snapshot, Object.NumAlpha );
+			PutSnapshotInt( Snapshot, Object.NumNumeric );
+			PutSnapshotInt( Snapshot, Object.MinNumFields );
+			Snapshot.push_back( Object.NameAlpha1 ? '\1' : '\0' );
+			Snapshot.push_back( Object.UniqueObject ? '\1' : '\0' );
+			Snapshot.push_back( Object.RequiredObject ? '\1' : '\0' );
+			Snapshot.push_back( Object.ExtensibleObject ? '\1' : '\0' );
+			PutSnapshotInt( Snapshot, Object.ExtensibleNum );
+			PutSnapshotInt( Snapshot, Object.LastExtendAlpha );
+			PutSnapshotInt( Snapshot, Object.LastExtendNum );
+			PutSnapshotInt( Snapshot, Object.ObsPtr );
+			PutSnapshotBools( Snapshot, Object.AlphaOrNumeric );
+			PutSnapshotBools( Snapshot, Object.ReqField );
+			PutSnapshotBools( Snapshot, Object.AlphRetainCase );
+			PutSnapshotStrings( Snapshot, Object.AlphFieldChks );
+			PutSnapshotStrings( Snapshot, Object.AlphFieldDefs );
+			PutSnapshotInt( Snapshot, Object.NumRangeChks.isize() );
+			for ( int Item = 1, e = Object.NumRangeChks.isize(); Item <= e; ++Item ) {
+				auto const & RangeChk( Object.NumRangeChks( Item ) );
+				Snapshot.push_back( RangeChk.MinMaxChk ? '\1' : '\0' );
+				PutSnapshotInt( Snapshot, RangeChk.FieldNumber );
+				PutSnapshotString( Snapshot, RangeChk.FieldName );
+				for ( int MinMax = 1; MinMax <= 2; ++MinMax ) {
+					PutSnapshotString( Snapshot, RangeChk.MinMaxString( MinMax ) );
+					PutSnapshotReal( Snapshot, RangeChk.MinMaxValue( MinMax ) );
+					PutSnapshotInt( Snapshot, RangeChk.WhichMinMax( MinMax ) );
+				}
+				Snapshot.push_back( RangeChk.DefaultChk ? '\1' : '\0' );
+				PutSnapshotReal( Snapshot, RangeChk.Default );
+				Snapshot.push_back( RangeChk.DefAutoSize ? '\1' : '\0' );
+				Snapshot.push_back( RangeChk.AutoSizable ? '\1' : '\0' );
+				PutSnapshotReal( Snapshot, RangeChk.AutoSizeValue );
+				Snapshot.push_back( RangeChk.DefAutoCalculate ? '\1' : '\0' );
+				Snapshot.push_back( RangeChk.AutoCalculatable ? '\1' : '\0' );
+				PutSnapshotReal( Snapshot, RangeChk.AutoCalculateValue );
+			}
+		}
+
+		PutSnapshotStrings( Snapshot, ObsoleteObjectsRepNames );
+
+#ifdef _WIN32
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( _getpid() ) );
+#else
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( getpid() ) );
+#endif
+		bool WriteOK;
+		{
+			std::ofstream SnapshotFile( TempFileName, std::ios::binary | std::ios::trunc );
+			SnapshotFile.write( Snapshot.data(), Snapshot.size() );
+			SnapshotFile.close();
+			WriteOK = ! SnapshotFile.fail();
+		}
+		if ( WriteOK ) {
+#ifdef _WIN32
+			std::remove( FileName.c_str() ); // Rename does not replace an existing file on Windows
+#endif
+			WriteOK = ( std::rename( TempFileName.c_str(), FileName.c_str() ) == 0 );
+		}
+		if ( ! WriteOK ) {
+			std::remove( TempFileName.c_str() );
+			ShowWarningError( "WriteIDDSnapshot: Could not write IDD snapshot file=\"" + FileName + "\"." );
+			ShowContinueError( "The data dictionary will be processed again in later runs." );
+		}
+
+	}
+
 	void
 	AddSectionDef(
 		std::string const & ProposedSection, // Proposed Section to be added
@@ -1176,6 +1707,124 @@ namespace InputProcessor {
 			}
 		}
 
+		SetObjectRecords();
+
+	}
+
+	void
+	SetObjectRecords()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the IDF records of each object definition and indexes them by object name, so
+		// GetObjectItem and GetObjectItemNum do not search the IDF records.
+
+		// METHODOLOGY EMPLOYED:
+		// The records of an object are the ones GetObjectItem would count: those with its name
+		// from its start record on.  The name index keeps the first item with a name (first field),
+		// as the search in GetObjectItemNum did.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Record;
+		int Which;
+
+		ObjectRecords.deallocate();
+		ObjectRecords.allocate( NumObjectDefs );
+		ObjectItemNums.deallocate();
+		ObjectItemNums.allocate( NumObjectDefs );
+		for ( Record = 1; Record <= NumIDFRecords; ++Record ) {
+			Which = FindObjectDefinition( IDFRecords( Record ).Name );
+			if ( Which == 0 || ObjectStartRecord( Which ) == 0 || Record < ObjectStartRecord( Which ) ) continue;
+			if ( IDFRecords( Record ).Name != ObjectDef( Which ).Name ) continue;
+			ObjectRecords( Which ).push_back( Record );
+			if ( IDFRecords( Record ).NumAlphas > 0 ) {
+				ObjectItemNums( Which ).emplace( IDFRecords( Record ).Alphas( 1 ), int( ObjectRecords( Which ).size() ) );
+			}
+		}
+		NumObjectRecordsSet = NumIDFRecords;
+
+	}
+
+	int
+	FindObjectDefinition( std::string const & ObjectWord ) // Object type (case insensitive)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the object definition (ObjectDef index) of an object type, 0 if not found.
+
+		// METHODOLOGY EMPLOYED:
+		// Hashed lookup of the uppercase object type; the list of objects is searched when the
+		// index has not been set up for the current definitions.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int Found;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		if ( ObjectDefIndex.size() == std::size_t( NumObjectDefs ) && NumObjectDefs > 0 ) {
+			auto Item( ObjectDefIndex.find( ObjectWord ) );
+			if ( Item == ObjectDefIndex.end() ) Item = ObjectDefIndex.find( MakeUPPERCase( ObjectWord ) );
+			return ( Item != ObjectDefIndex.end() ) ? Item->second : 0;
+		}
+
+		if ( SortedIDD ) {
+			Found = FindItemInSortedList( ObjectWord, ListOfObjects, NumObjectDefs );
+			if ( Found != 0 ) Found = iListOfObjects( Found );
+		} else {
+			Found = FindItemInList( ObjectWord, ListOfObjects, NumObjectDefs );
+		}
+		return Found;
+
 	}
 
 	void
@@ -1231,12 +1880,7 @@ namespace InputProcessor {
 			Found = FindItemInList( SqueezedSection, SectionDef.Name(), NumSectionDefs );
 			if ( Found == 0 ) {
 				// Make sure this Section not an object name
-				if ( SortedIDD ) {
-					OFound = FindItemInSortedList( SqueezedSection, ListOfObjects, NumObjectDefs );
-					if ( OFound != 0 ) OFound = iListOfObjects( OFound );
-				} else {
-					OFound = FindItemInList( SqueezedSection, ListOfObjects, NumObjectDefs );
-				}
+				OFound = FindObjectDefinition( SqueezedSection );
 				if ( OFound != 0 ) {
 					AddRecordFromSection( OFound );
 				} else if ( NumSectionDefs == MaxSectionDefs ) {
@@ -1361,12 +2005,7 @@ namespace InputProcessor {
 		while ( TestingObject ) {
 			errFlag = false;
 			IDidntMeanIt = false;
-			if ( SortedIDD ) {
-				Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-				if ( Found != 0 ) Found = iListOfObjects( Found );
-			} else {
-				Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-			}
+			Found = FindObjectDefinition( SqueezedObject );
 			if ( Found != 0 ) {
 				if ( ObjectDef( Found ).ObsPtr > 0 ) {
 					TFound = FindItemInList( SqueezedObject, RepObjects.OldName(), NumSecretObjects );
@@ -1374,21 +2013,11 @@ namespace InputProcessor {
 						if ( RepObjects( TFound ).Transitioned ) {
 							if ( ! RepObjects( TFound ).Used ) ShowWarningError( "IP: Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( TFound ).NewName + "\"" );
 							RepObjects( TFound ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 						} else if ( RepObjects( TFound ).TransitionDefer ) {
 							if ( ! RepObjects( TFound ).Used ) ShowWarningError( "IP: Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( TFound ).NewName + "\"" );
 							RepObjects( TFound ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 							TransitionDefer = true;
 						} else {
 							Found = 0; // being handled differently for this obsolete object
@@ -1425,23 +2054,13 @@ namespace InputProcessor {
 						} else {
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Objects=\"" + stripped( ProposedObject ) + "\" are being transitioned to this object=\"" + RepObjects( Found ).NewName + "\"" );
 							RepObjects( Found ).Used = true;
-							if ( SortedIDD ) {
-								Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-								if ( Found != 0 ) Found = iListOfObjects( Found );
-							} else {
-								Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							}
+							Found = FindObjectDefinition( SqueezedObject );
 						}
 					} else if ( ! RepObjects( Found ).Transitioned ) {
 						SqueezedObject = RepObjects( Found ).NewName;
 						TestingObject = true;
 					} else {
-						if ( SortedIDD ) {
-							Found = FindItemInSortedList( SqueezedObject, ListOfObjects, NumObjectDefs );
-							if ( Found != 0 ) Found = iListOfObjects( Found );
-						} else {
-							Found = FindItemInList( SqueezedObject, ListOfObjects, NumObjectDefs );
-						}
+						Found = FindObjectDefinition( SqueezedObject );
 					}
 				}
 			} else {
@@ -2044,12 +2663,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Found;
 
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( MakeUPPERCase( ObjectWord ) );
 
 		if ( Found != 0 ) {
 			GetNumObjectsFound = ObjectDef( Found ).NumFound;
@@ -2161,6 +2775,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Count;
 		int LoopIndex;
+		int RecordNum; // IDF record of the requested object
 		std::string ObjectWord;
 		std::string UCObject;
 		static Array1D_string AlphaArgs;
@@ -2196,12 +2811,7 @@ namespace InputProcessor {
 		Count = 0;
 		Status = -1;
 		UCObject = MakeUPPERCase( Object );
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObject, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObject, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObject );
 		if ( Found == 0 ) { //  This is more of a developer problem
 			ShowFatalError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in Object Definitions -- incorrect IDD attached." );
 		}
@@ -2235,45 +2845,56 @@ namespace InputProcessor {
 		}
 		++ObjectGotCount( Found );
 
-		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
-				++Count;
-				if ( Count == Number ) {
-					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
-					if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
-						ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
-					}
-					NumAlphas = min( MaxAlphas, NumAlphas );
-					NumNumbers = min( MaxNumbers, NumNumbers );
-					GoodItem = true;
-					if ( NumAlphas > 0 ) {
-						Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
-					}
-					if ( NumNumbers > 0 ) {
-						Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
-					}
-					if ( present( NumBlank ) ) {
-						NumBlank = true;
-						if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
-					}
-					if ( present( AlphaBlank ) ) {
-						AlphaBlank = true;
-						if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
-					}
-					if ( present( AlphaFieldNames ) ) {
-						AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
-					}
-					if ( present( NumericFieldNames ) ) {
-						NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
+		RecordNum = 0;
+		if ( NumObjectRecordsSet == NumIDFRecords && ObjectRecords.isize() == NumObjectDefs ) {
+			if ( StartRecord <= NumIDFRecords && Number >= 1 && Number <= int( ObjectRecords( Found ).size() ) ) {
+				RecordNum = ObjectRecords( Found )[ Number - 1 ];
+			}
+		} else {
+			for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
+				if ( IDFRecords( LoopIndex ).Name == UCObject ) {
+					++Count;
+					if ( Count == Number ) {
+						RecordNum = LoopIndex;
+						break;
 					}
-					Status = 1;
-					break;
 				}
 			}
 		}
 
+		if ( RecordNum > 0 ) {
+			IDFRecordsGotten( RecordNum ) = true; // only object level "gets" recorded
+			// Read this one
+			GetObjectItemfromFile( RecordNum, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
+			if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
+				ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
+			}
+			NumAlphas = min( MaxAlphas, NumAlphas );
+			NumNumbers = min( MaxNumbers, NumNumbers );
+			GoodItem = true;
+			if ( NumAlphas > 0 ) {
+				Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
+			}
+			if ( NumNumbers > 0 ) {
+				Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
+			}
+			if ( present( NumBlank ) ) {
+				NumBlank = true;
+				if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
+			}
+			if ( present( AlphaBlank ) ) {
+				AlphaBlank = true;
+				if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
+			}
+			if ( present( AlphaFieldNames ) ) {
+				AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
+			}
+			if ( present( NumericFieldNames ) ) {
+				NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
+			}
+			Status = 1;
+		}
+
 #ifdef IDDTEST
 		// This checks various principles of the IDD (e.g. required fields, defaults) to see what happens in the GetInput
 		// This can only work for "good" objects. (Found=object def)
@@ -2382,12 +3003,7 @@ namespace InputProcessor {
 		ItemFound = false;
 		ObjectFound = false;
 		UCObjType = MakeUPPERCase( ObjType );
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObjType, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObjType, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObjType );
 
 		if ( Found != 0 ) {
 
@@ -2396,7 +3012,13 @@ namespace InputProcessor {
 			ItemNum = 0;
 			StartRecord = ObjectStartRecord( Found );
 
-			if ( StartRecord > 0 ) {
+			if ( NumObjectRecordsSet == NumIDFRecords && ObjectItemNums.isize() == NumObjectDefs ) {
+				auto const Item( ObjectItemNums( Found ).find( ObjName ) );
+				if ( Item != ObjectItemNums( Found ).end() && Item->second <= NumObjOfType ) {
+					ItemNum = Item->second;
+					ItemFound = true;
+				}
+			} else if ( StartRecord > 0 ) {
 				for ( ObjNum = StartRecord; ObjNum <= NumIDFRecords; ++ObjNum ) {
 					if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
 					++ItemNum;
@@ -3562,6 +4184,55 @@ namespace InputProcessor {
 
 	}
 
+	int
+	InternName( std::string const & Name ) // Name to intern
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the integer ID of a name, adding the name to the table of
+		// interned names if it is not there yet.  Names are compared without regard to case,
+		// so two names have the same ID exactly when SameString would find them equal.
+
+		// METHODOLOGY EMPLOYED:
+		// Get input routines intern the names that are matched during the simulation and keep
+		// the IDs with the objects; the run time comparison is then an integer comparison.
+		// IDs start at 1 and are never reused, so 0 can be used for "no name".
+
+		std::string UCName( MakeUPPERCase( Name ) );
+		auto const Found( InternedNameIDs.find( UCName ) );
+		if ( Found != InternedNameIDs.end() ) return Found->second;
+		InternedNames.push_back( UCName );
+		int const ID( static_cast< int >( InternedNames.size() ) );
+		InternedNameIDs.emplace( std::move( UCName ), ID );
+		return ID;
+
+	}
+
+	int
+	FindInternedName( std::string const & Name ) // Name to look up
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the ID of a name interned by InternName, or 0 if the name
+		// has not been interned.  The table is not changed.
+
+		auto const Found( InternedNameIDs.find( MakeUPPERCase( Name ) ) );
+		return ( Found != InternedNameIDs.end() ) ? Found->second : 0;
+
+	}
+
 	void
 	VerifyName(
 		std::string const & NameToVerify,
@@ -4099,12 +4770,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Which; // to determine which object definition to use
 
-		if ( SortedIDD ) {
-			Which = FindItemInSortedList( ObjectWord, ListOfObjects, NumObjectDefs );
-			if ( Which != 0 ) Which = iListOfObjects( Which );
-		} else {
-			Which = FindItemInList( ObjectWord, ListOfObjects, NumObjectDefs );
-		}
+		Which = FindObjectDefinition( ObjectWord );
 		NumArgs = ObjectDef( Which ).NumParams;
 		AlphaOrNumeric( {1,NumArgs} ) = ObjectDef( Which ).AlphaOrNumeric( {1,NumArgs} );
 		RequiredFields( {1,NumArgs} ) = ObjectDef( Which ).ReqField( {1,NumArgs} );
@@ -4156,12 +4822,7 @@ namespace InputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Which; // to determine which object definition to use
 
-		if ( SortedIDD ) {
-			Which = FindItemInSortedList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-			if ( Which != 0 ) Which = iListOfObjects( Which );
-		} else {
-			Which = FindItemInList( MakeUPPERCase( ObjectWord ), ListOfObjects, NumObjectDefs );
-		}
+		Which = FindObjectDefinition( MakeUPPERCase( ObjectWord ) );
 
 		if ( Which > 0 ) {
 			NumArgs = ObjectDef( Which ).NumParams;
@@ -4305,12 +4966,7 @@ namespace InputProcessor {
 			//  This one not gotten
 			Found = FindItemInList( IDFRecords( Count ).Name, OrphanObjectNames, NumOrphObjNames );
 			if ( Found == 0 ) {
-				if ( SortedIDD ) {
-					ObjFound = FindItemInSortedList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-					if ( ObjFound != 0 ) ObjFound = iListOfObjects( ObjFound );
-				} else {
-					ObjFound = FindItemInList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-				}
+				ObjFound = FindObjectDefinition( IDFRecords( Count ).Name );
 				if ( ObjFound > 0 ) {
 					if ( ObjectDef( ObjFound ).ObsPtr > 0 ) continue; // Obsolete object, don't report "orphan"
 					++NumOrphObjNames;
@@ -4327,12 +4983,7 @@ namespace InputProcessor {
 					ShowWarningError( "object not found=" + IDFRecords( Count ).Name );
 				}
 			} else if ( DisplayAllWarnings ) {
-				if ( SortedIDD ) {
-					ObjFound = FindItemInSortedList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-					if ( ObjFound != 0 ) ObjFound = iListOfObjects( ObjFound );
-				} else {
-					ObjFound = FindItemInList( IDFRecords( Count ).Name, ListOfObjects, NumObjectDefs );
-				}
+				ObjFound = FindObjectDefinition( IDFRecords( Count ).Name );
 				if ( ObjFound > 0 ) {
 					if ( ObjectDef( ObjFound ).ObsPtr > 0 ) continue; // Obsolete object, don't report "orphan"
 					++NumOrphObjNames;
@@ -4570,8 +5221,7 @@ namespace InputProcessor {
 		}}
 
 		--ObjectDef( ObjPtr ).NumFound;
-		ObjPtr = FindItemInList( LineItem.Name, ListOfObjects, NumObjectDefs );
-		ObjPtr = iListOfObjects( ObjPtr );
+		ObjPtr = FindObjectDefinition( LineItem.Name );
 
 		if ( ObjPtr == 0 ) ShowFatalError( "No Object Def for " + LineItem.Name );
 		++ObjectDef( ObjPtr ).NumFound;
@@ -5533,12 +6183,7 @@ namespace InputProcessor {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
 		int Found;
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObjType, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObjType, ListOfObjects, NumObjectDefs );
-		}
+		Found = FindObjectDefinition( UCObjType );
 
 		int StartPointer;
 		if ( Found != 0 ) {
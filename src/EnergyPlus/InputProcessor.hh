@@ -2,7 +2,10 @@
 #define InputProcessor_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <iosfwd>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -77,6 +80,7 @@ namespace InputProcessor {
 	extern int TotalAuditErrors; // Counting some warnings that go onto only the audit file
 	extern int NumSecretObjects; // Number of objects in "Secret Mode"
 	extern bool ProcessingIDD; // True when processing IDD, false when processing IDF
+	extern bool IDDPreloaded; // True when the data dictionary was read ahead of ProcessInput (server mode)
 	extern std::ostream * echo_stream; // Internal stream used for input file echoing (used for performance)
 
 	//Real Variables for Module
@@ -89,6 +93,12 @@ namespace InputProcessor {
 	extern Array1D_int iListOfObjects;
 	extern Array1D_int ObjectGotCount;
 	extern Array1D_int ObjectStartRecord;
+	extern std::unordered_map< std::string, int > ObjectDefIndex; // Object definition of each (uppercase) object type
+	extern Array1D< std::vector< int > > ObjectRecords; // IDF records of each object definition, in input order
+	extern Array1D< std::unordered_map< std::string, int > > ObjectItemNums; // Item number of each object name, by object definition
+	extern int NumObjectRecordsSet; // Number of IDF records in ObjectRecords (-1 if not set)
+	extern std::unordered_map< std::string, int > InternedNameIDs; // ID of each interned (uppercase) name
+	extern std::vector< std::string > InternedNames; // Interned (uppercase) names, InternedNames[ ID - 1 ]
 	extern std::string CurrentFieldName; // Current Field Name (IDD)
 	extern Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	extern std::string ReplacementName;
@@ -415,12 +425,40 @@ namespace InputProcessor {
 	void
 	ProcessInput();
 
+	void
+	ReadDataDictionary( bool & ErrorsInIDD ); // set to true if any errors flagged during IDD processing
+
+	void
+	PreloadDataDictionary();
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
 		bool & ErrorsFound // set to true if any errors flagged during IDD processing
 	);
 
+	std::uint64_t
+	IDDSnapshotKey(
+		std::istream & idd_stream,
+		std::string & IDDVersion // Version string from the first line of the IDD (blank if none)
+	);
+
+	std::string
+	IDDSnapshotFileName( std::uint64_t const Key ); // IDD snapshot key
+
+	bool
+	ReadIDDSnapshot(
+		std::string const & FileName, // IDD snapshot file
+		std::uint64_t const Key, // IDD snapshot key of the data dictionary
+		std::string const & IDDVersion // Version string of the data dictionary
+	);
+
+	void
+	WriteIDDSnapshot(
+		std::string const & FileName, // IDD snapshot file
+		std::uint64_t const Key // IDD snapshot key of the data dictionary
+	);
+
 	void
 	AddSectionDef(
 		std::string const & ProposedSection, // Proposed Section to be added
@@ -439,6 +477,12 @@ namespace InputProcessor {
 	void
 	ProcessInputDataFile( std::istream & idf_stream );
 
+	void
+	SetObjectRecords();
+
+	int
+	FindObjectDefinition( std::string const & ObjectWord );
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -592,6 +636,18 @@ namespace InputProcessor {
 		return 0; // Not found
 	}
 
+	inline
+	int
+	FindItemInList(
+		std::string const & String,
+		std::unordered_map< std::string, int > const & ItemIndexes // Index of each item in a list
+	)
+	{
+		// Hashed lookup for long lists (e.g. unique name checks); the caller keeps ItemIndexes with the list.
+		auto const Item( ItemIndexes.find( String ) );
+		return ( Item != ItemIndexes.end() ) ? Item->second : 0; // 0 if not found
+	}
+
 	int
 	FindItemInSortedList(
 		std::string const & String,
@@ -655,6 +711,12 @@ namespace InputProcessor {
 	std::string
 	MakeUPPERCase( std::string const & InputString ); // Input String
 
+	int
+	InternName( std::string const & Name ); // Name to intern
+
+	int
+	FindInternedName( std::string const & Name ); // Name to look up
+
 	typedef char const * c_cstring;
 
 	inline
@@ -22,6 +22,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSizing.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DaylightingDevices.hh>
 #include <EMSManager.hh>
@@ -95,6 +96,7 @@ namespace InternalHeatGains {
 	bool GetInternalHeatGainsInputFlag( true ); // Controls the GET routine calling (limited to first time)
 
 	static std::string const BlankString;
+	static Array1D_bool GainTypeMask; // True for the gain types being summed by the Sum...ByTypes routines
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE InternalHeatGains
 	//PUBLIC  SumInternalConvectionGainsByIndices
@@ -267,6 +269,8 @@ namespace InternalHeatGains {
 		static gio::Fmt Format_724( "(' ',A,', ',A)" );
 
 		// FLOW:
+		DataTimings::ProfileTimer const profileTimer( "GetInternalHeatGainsInput" ); // Region of the timing profile
+
 		ZoneIntGain.allocate( NumOfZones );
 		ZnRpt.allocate( NumOfZones );
 		ZoneIntEEuse.allocate( NumOfZones );
@@ -4381,14 +4385,15 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, keep the zone sums of the stored gain rates
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// <description>
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sums of each gain rate are updated here, once per update of the device values, so that the
+		// SumAll... routines called from the zone and room air models do not loop over the devices.
 
 		// REFERENCES:
 		// na
@@ -4438,6 +4443,25 @@ namespace InternalHeatGains {
 				ZoneIntGain( NZ ).Device( Loop ).CarbonDioxideGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrCarbonDioxideGainRate;
 				ZoneIntGain( NZ ).Device( Loop ).GenericContamGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrGenericContamGainRate;
 			}
+			// zone sums of the stored values, returned by the SumAll... routines
+			auto & zoneIntGain( ZoneIntGain( NZ ) );
+			zoneIntGain.SumConvectGainRate = 0.0;
+			zoneIntGain.SumReturnAirConvGainRate = 0.0;
+			zoneIntGain.SumRadiantGainRate = 0.0;
+			zoneIntGain.SumLatentGainRate = 0.0;
+			zoneIntGain.SumReturnAirLatentGainRate = 0.0;
+			zoneIntGain.SumCarbonDioxideGainRate = 0.0;
+			zoneIntGain.SumGenericContamGainRate = 0.0;
+			for ( Loop = 1; Loop <= zoneIntGain.NumberOfDevices; ++Loop ) {
+				auto const & device( zoneIntGain.Device( Loop ) );
+				zoneIntGain.SumConvectGainRate += device.ConvectGainRate;
+				zoneIntGain.SumReturnAirConvGainRate += device.ReturnAirConvGainRate;
+				zoneIntGain.SumRadiantGainRate += device.RadiantGainRate;
+				zoneIntGain.SumLatentGainRate += device.LatentGainRate;
+				zoneIntGain.SumReturnAirLatentGainRate += device.ReturnAirLatentGainRate;
+				zoneIntGain.SumCarbonDioxideGainRate += device.CarbonDioxideGainRate;
+				zoneIntGain.SumGenericContamGainRate += device.GenericContamGainRate;
+			}
 			if ( ReSumLatentGains ) {
 				SumAllInternalLatentGains( NZ, ZoneLatentGain( NZ ) );
 			}
@@ -4452,6 +4476,35 @@ namespace InternalHeatGains {
 
 	}
 
+	void
+	SetGainTypeMask( Array1S_int const GainTypeARR ) // variable length 1-d array of integer valued gain types
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets GainTypeMask to true for the gain types in GainTypeARR and false for all others.
+
+		// METHODOLOGY EMPLOYED:
+		// The Sum...ByTypes routines then test each device's type with one lookup instead of a loop over
+		// the requested types.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumberOfTypes( size( GainTypeARR ) );
+		int TypeNum;
+
+		if ( ! allocated( GainTypeMask ) ) GainTypeMask.allocate( NumZoneIntGainDeviceTypes );
+		GainTypeMask = false;
+		for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+			GainTypeMask( GainTypeARR( TypeNum ) ) = true;
+		}
+
+	}
+
 	void
 	SumAllInternalConvectionGains(
 		int const ZoneNum, // zone index pointer for which zone to sum gains for
@@ -4462,14 +4515,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -4489,22 +4542,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumConvGainRate;
-		int DeviceNum;
-
-		tmpSumConvGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumConvGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ConvectGainRate;
-		}
-
-		SumConvGainRate = tmpSumConvGainRate;
+		// FLOW:
+		SumConvGainRate = ZoneIntGain( ZoneNum ).SumConvectGainRate;
 
 	}
 
@@ -4519,7 +4558,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one pass over the devices with a gain type mask
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4549,12 +4588,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumberOfTypes;
 		Real64 tmpSumConvGainRate;
 		int DeviceNum;
-		int TypeNum;
 
-		NumberOfTypes = size( GainTypeARR );
 		tmpSumConvGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4562,13 +4598,10 @@ namespace InternalHeatGains {
 			return;
 		}
 
+		SetGainTypeMask( GainTypeARR );
 		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
-
-				if ( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum == GainTypeARR( TypeNum ) ) {
-					tmpSumConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ConvectGainRate;
-				}
-
+			if ( GainTypeMask( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum ) ) {
+				tmpSumConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ConvectGainRate;
 			}
 		}
 
@@ -4586,14 +4619,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -4613,22 +4646,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRetAirGainRate;
-		int DeviceNum;
-
-		tmpSumRetAirGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumReturnAirGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRetAirGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirConvGainRate;
-		}
-
-		SumReturnAirGainRate = tmpSumRetAirGainRate;
+		// FLOW:
+		SumReturnAirGainRate = ZoneIntGain( ZoneNum ).SumReturnAirConvGainRate;
 
 	}
 
@@ -4643,7 +4662,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one pass over the devices with a gain type mask
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4673,12 +4692,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumberOfTypes;
 		Real64 tmpSumRetAirConvGainRate;
 		int DeviceNum;
-		int TypeNum;
 
-		NumberOfTypes = size( GainTypeARR );
 		tmpSumRetAirConvGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4686,13 +4702,10 @@ namespace InternalHeatGains {
 			return;
 		}
 
+		SetGainTypeMask( GainTypeARR );
 		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
-
-				if ( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum == GainTypeARR( TypeNum ) ) {
-					tmpSumRetAirConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirConvGainRate;
-				}
-
+			if ( GainTypeMask( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum ) ) {
+				tmpSumRetAirConvGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirConvGainRate;
 			}
 		}
 
@@ -4710,14 +4723,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -4737,22 +4750,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumRadGainRate;
-		int DeviceNum;
-
-		tmpSumRadGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRadGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumRadGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).RadiantGainRate;
-		}
-
-		SumRadGainRate = tmpSumRadGainRate;
+		// FLOW:
+		SumRadGainRate = ZoneIntGain( ZoneNum ).SumRadiantGainRate;
 
 	}
 
@@ -4767,7 +4766,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one pass over the devices with a gain type mask
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4797,12 +4796,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumberOfTypes;
 		Real64 tmpSumRadiationGainRate;
 		int DeviceNum;
-		int TypeNum;
 
-		NumberOfTypes = size( GainTypeARR );
 		tmpSumRadiationGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4810,13 +4806,10 @@ namespace InternalHeatGains {
 			return;
 		}
 
+		SetGainTypeMask( GainTypeARR );
 		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
-
-				if ( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum == GainTypeARR( TypeNum ) ) {
-					tmpSumRadiationGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).RadiantGainRate;
-				}
-
+			if ( GainTypeMask( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum ) ) {
+				tmpSumRadiationGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).RadiantGainRate;
 			}
 		}
 
@@ -4834,14 +4827,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -4861,22 +4854,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).LatentGainRate;
-		}
-
-		SumLatentGainRate = tmpSumLatentGainRate;
+		// FLOW:
+		SumLatentGainRate = ZoneIntGain( ZoneNum ).SumLatentGainRate;
 
 	}
 
@@ -4891,7 +4870,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one pass over the devices with a gain type mask
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4921,12 +4900,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumberOfTypes;
 		Real64 tmpSumLatentGainRate;
 		int DeviceNum;
-		int TypeNum;
 
-		NumberOfTypes = size( GainTypeARR );
 		tmpSumLatentGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4934,13 +4910,10 @@ namespace InternalHeatGains {
 			return;
 		}
 
+		SetGainTypeMask( GainTypeARR );
 		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
-
-				if ( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum == GainTypeARR( TypeNum ) ) {
-					tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).LatentGainRate;
-				}
-
+			if ( GainTypeMask( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum ) ) {
+				tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).LatentGainRate;
 			}
 		}
 
@@ -4958,14 +4931,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -4985,22 +4958,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumLatentGainRate;
-		int DeviceNum;
-
-		tmpSumLatentGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumRetAirLatentGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumLatentGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).ReturnAirLatentGainRate;
-		}
-
-		SumRetAirLatentGainRate = tmpSumLatentGainRate;
+		// FLOW:
+		SumRetAirLatentGainRate = ZoneIntGain( ZoneNum ).SumReturnAirLatentGainRate;
 
 	}
 
@@ -5014,14 +4973,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -5041,22 +5000,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumCO2GainRate;
-		int DeviceNum;
-
-		tmpSumCO2GainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumCO2GainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumCO2GainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).CarbonDioxideGainRate;
-		}
-
-		SumCO2GainRate = tmpSumCO2GainRate;
+		// FLOW:
+		SumCO2GainRate = ZoneIntGain( ZoneNum ).SumCarbonDioxideGainRate;
 
 	}
 
@@ -5071,7 +5016,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one pass over the devices with a gain type mask
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5101,12 +5046,9 @@ namespace InternalHeatGains {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NumberOfTypes;
 		Real64 tmpSumCO2GainRate;
 		int DeviceNum;
-		int TypeNum;
 
-		NumberOfTypes = size( GainTypeARR );
 		tmpSumCO2GainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -5114,13 +5056,10 @@ namespace InternalHeatGains {
 			return;
 		}
 
+		SetGainTypeMask( GainTypeARR );
 		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
-
-				if ( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum == GainTypeARR( TypeNum ) ) {
-					tmpSumCO2GainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).CarbonDioxideGainRate;
-				}
-
+			if ( GainTypeMask( ZoneIntGain( ZoneNum ).Device( DeviceNum ).CompTypeOfNum ) ) {
+				tmpSumCO2GainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).CarbonDioxideGainRate;
 			}
 		}
 
@@ -5138,14 +5077,14 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         L. Gu
 		//       DATE WRITTEN   Feb. 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return the sum kept by UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// worker routine for summing all the internal gain types based on the existing subrotine SumAllInternalCO2Gains
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The zone sum is updated whenever the device gain rates are, so no loop over the devices is needed.
 
 		// REFERENCES:
 		// na
@@ -5165,22 +5104,8 @@ namespace InternalHeatGains {
 		// DERIVED TYPE DEFINITIONS:
 		// na
 
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 tmpSumGCGainRate;
-		int DeviceNum;
-
-		tmpSumGCGainRate = 0.0;
-
-		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
-			SumGCGainRate = 0.0;
-			return;
-		}
-
-		for ( DeviceNum = 1; DeviceNum <= ZoneIntGain( ZoneNum ).NumberOfDevices; ++DeviceNum ) {
-			tmpSumGCGainRate += ZoneIntGain( ZoneNum ).Device( DeviceNum ).GenericContamGainRate;
-		}
-
-		SumGCGainRate = tmpSumGCGainRate;
+		// FLOW:
+		SumGCGainRate = ZoneIntGain( ZoneNum ).SumGenericContamGainRate;
 
 	}
 
@@ -55,6 +55,9 @@ namespace InternalHeatGains {
 		Optional_bool_const SumLatentGains = _
 	);
 
+	void
+	SetGainTypeMask( Array1S_int const GainTypeARR ); // variable length 1-d array of integer valued gain types
+
 	void
 	SumAllInternalConvectionGains(
 		int const ZoneNum, // zone index pointer for which zone to sum gains for
@@ -131,8 +131,8 @@ namespace ManageElectricPower {
 	int ElecProducedPVIndex( 0 );
 	int ElecProducedWTIndex( 0 );
 
-	int MaxRainflowArrayBounds( 100 );
-	int MaxRainflowArrayInc( 100 );
+	int MaxRainflowArrayBounds( 100 ); // Initial size of the rainflow point arrays of each battery
+	int MaxRainflowArrayInc( 100 ); // Growth of the rainflow point arrays of a battery when they are full
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 
@@ -2748,17 +2748,16 @@ namespace ManageElectricPower {
 					//     Because we cannot determine whehter "ThisTimeStep" is a peak or valley (next time step is unknown yet), we
 					//     use the "LastTimeStep" value for battery life calculation.
 					Input0 = ( ElecStorage( ElecStorNum ).LastTimeStepAvailable + ElecStorage( ElecStorNum ).LastTimeStepBound ) / ElecStorage( ElecStorNum ).MaxAhCapacity;
-					ElecStorage( ElecStorNum ).B10( ElecStorage( ElecStorNum ).count0 ) = Input0;
 
-					//        The arrary size needs to be increased when count = MaxRainflowArrayBounds. Please note that (MaxRainflowArrayBounds +1)
-					//        is the index used in the subroutine RainFlow. So we cannot reallocate array size until count = MaxRainflowArrayBounds +1.
-					if ( ElecStorage( ElecStorNum ).count0 == MaxRainflowArrayBounds ) {
-						ElecStorage( ElecStorNum ).B10.redimension( MaxRainflowArrayBounds + 1 + MaxRainflowArrayInc, 0.0 );
-						ElecStorage( ElecStorNum ).X0.redimension( MaxRainflowArrayBounds + 1 + MaxRainflowArrayInc, 0.0 );
-						MaxRainflowArrayBounds += MaxRainflowArrayInc;
+					//        The arrays only hold the peaks and valleys not yet counted in a cycle, so they rarely grow. They
+					//        are grown for this battery alone when the new point does not fit.
+					if ( ElecStorage( ElecStorNum ).count0 > isize( ElecStorage( ElecStorNum ).B10 ) ) {
+						ElecStorage( ElecStorNum ).B10.redimension( isize( ElecStorage( ElecStorNum ).B10 ) + MaxRainflowArrayInc, 0.0 );
+						ElecStorage( ElecStorNum ).X0.redimension( isize( ElecStorage( ElecStorNum ).B10 ), 0.0 );
 					}
+					ElecStorage( ElecStorNum ).B10( ElecStorage( ElecStorNum ).count0 ) = Input0;
 
-					Rainflow( ElecStorage( ElecStorNum ).CycleBinNum, Input0, ElecStorage( ElecStorNum ).B10, ElecStorage( ElecStorNum ).X0, ElecStorage( ElecStorNum ).count0, ElecStorage( ElecStorNum ).Nmb0, ElecStorage( ElecStorNum ).OneNmb0, MaxRainflowArrayBounds + 1 );
+					Rainflow( ElecStorage( ElecStorNum ).CycleBinNum, Input0, ElecStorage( ElecStorNum ).B10, ElecStorage( ElecStorNum ).X0, ElecStorage( ElecStorNum ).count0, ElecStorage( ElecStorNum ).Nmb0, ElecStorage( ElecStorNum ).OneNmb0, isize( ElecStorage( ElecStorNum ).B10 ) );
 
 					ElecStorage( ElecStorNum ).BatteryDamage = 0.0;
 
@@ -3586,14 +3585,17 @@ namespace ManageElectricPower {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Y. KyungTae & W. Wang
 		//       DATE WRITTEN   July-August, 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, points removed in place at the end of the arrays
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Rainflow cycle counting for battery life calculation
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The arrays hold the peaks and valleys that have not been counted in a cycle yet, as a stack: each new point
+		// is added at the end, and counting a cycle or a half cycle removes points next to the end (or the three
+		// points left at the start).  Only the points up to count are used, so each point costs constant time on
+		// average however long the simulation is.
 
 		// REFERENCES:
 		// Ariduru S. 2004. Fatigue life calculation by rainflow cycle counting method.
@@ -3632,8 +3634,7 @@ namespace ManageElectricPower {
 			//  upper-level subroutine. However, it does not hurt to leave it here.
 			if ( X( count ) * X( count - 1 ) >= 0 ) {
 				X( count - 1 ) = B1( count ) - B1( count - 2 );
-				shift( B1, count - 1, count, B1, MaxRainflowArrayBounds + 1 ); // Get rid of (count-1) row in B1
-				shift( X, count, count, X, MaxRainflowArrayBounds + 1 );
+				B1( count - 1 ) = B1( count ); // Get rid of (count-1) row in B1
 				--count; // If the value keep increasing or decreasing, get rid of the middle point.
 			} // Only valley and peak will be stored in the matrix, B1
 
@@ -3642,8 +3643,10 @@ namespace ManageElectricPower {
 				//  algorithm specified in the reference (Ariduru S. 2004)
 				num = nint( ( std::abs( X( 2 ) ) * numbin * 10 + 5 ) / 10 ); // Count half cycle
 				Nmb( num ) += 0.5;
-				B1 = eoshift( B1, 1 ); // Once counting a half cycle, get rid of the value.
-				X = eoshift( X, 1 );
+				B1( 1 ) = B1( 2 ); // Once counting a half cycle, get rid of the value.
+				B1( 2 ) = B1( 3 );
+				X( 1 ) = X( 2 );
+				X( 2 ) = X( 3 );
 				--count; // The number of matrix, B1 and X1 decrease.
 			}
 		} // Counting cyle end
@@ -3657,13 +3660,9 @@ namespace ManageElectricPower {
 				++Nmb( num );
 
 				//     X(count-2) = ABS(X(count))-ABS(X(count-1))+ABS(X(count-2))
-				X( count - 2 ) = B1( count ) - B1( count - 3 ); // Updating X needs to be done before shift operation below
-
-				shift( B1, count - 1, count, B1, MaxRainflowArrayBounds + 1 ); // Get rid of two data points one by one
-				shift( B1, count - 2, count, B1, MaxRainflowArrayBounds + 1 ); // Delete one point
+				X( count - 2 ) = B1( count ) - B1( count - 3 ); // Updating X needs to be done before the points are deleted below
 
-				shift( X, count, count, X, MaxRainflowArrayBounds ); // Get rid of two data points one by one
-				shift( X, count - 1, count, X, MaxRainflowArrayBounds ); // Delete one point
+				B1( count - 2 ) = B1( count ); // Get rid of the two points of the cycle
 
 				count -= 2; // If one cycle is counted, two data points are deleted.
 				if ( count < 4 ) break; // When only three data points exists, one cycle cannot be counted.
@@ -3684,62 +3683,6 @@ namespace ManageElectricPower {
 		//   ENDDO
 	}
 
-	void
-	shift(
-		Array1A< Real64 > A,
-		int const m,
-		int const n,
-		Array1A< Real64 > B,
-		int const dim // end dimension of arrays
-	)
-	{
-
-		// SUBROUTINE INFORMATION:
-		//       AUTHOR         Y. KyungTae & W. Wang
-		//       DATE WRITTEN   July-August, 2011
-		//       MODIFIED       na
-		//       RE-ENGINEERED  na
-
-		// PURPOSE OF THIS SUBROUTINE:
-		// Utility subroutine for rainflow cycle counting
-
-		// METHODOLOGY EMPLOYED:
-		// na
-
-		// REFERENCES:
-		// na
-
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-		A.dim( {1,dim} );
-		B.dim( {1,dim} );
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
-
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
-
-		// DERIVED TYPE DEFINITIONS:
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int ShiftNum; // Loop variable
-
-		for ( ShiftNum = 1; ShiftNum <= m - 1; ++ShiftNum ) {
-			B( ShiftNum ) = A( ShiftNum );
-		}
-
-		for ( ShiftNum = m; ShiftNum <= n; ++ShiftNum ) {
-			B( ShiftNum ) = A( ShiftNum + 1 );
-		}
-	}
-
 	//******************************************************************************************************
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -62,8 +62,8 @@ namespace ManageElectricPower {
 	extern int ElecProducedPVIndex;
 	extern int ElecProducedWTIndex;
 
-	extern int MaxRainflowArrayBounds;
-	extern int MaxRainflowArrayInc;
+	extern int MaxRainflowArrayBounds; // Initial size of the rainflow point arrays of each battery
+	extern int MaxRainflowArrayInc; // Growth of the rainflow point arrays of a battery when they are full
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 
@@ -1065,15 +1065,6 @@ namespace ManageElectricPower {
 		int const dim // end dimension of array
 	);
 
-	void
-	shift(
-		Array1A< Real64 > A,
-		int const m,
-		int const n,
-		Array1A< Real64 > B,
-		int const dim // end dimension of arrays
-	);
-
 	//******************************************************************************************************
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
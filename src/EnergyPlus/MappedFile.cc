@@ -0,0 +1,135 @@
+// C++ Headers
+#include <fstream>
+#include <iterator>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <MappedFile.hh>
+
+namespace EnergyPlus {
+
+	// MappedFileBuf:
+	// AUTHOR         na
+	// DATE WRITTEN   Oct 2026
+	// MODIFIED       na
+	// RE-ENGINEERED  na
+	// Maps the whole of an input file (in.idf, Energy+.idd) so the line reads of the input
+	// processor come straight from the page cache instead of going through a file stream.
+
+	MappedFileBuf::MappedFileBuf( std::string const & file_name ) :
+		open_( false ),
+		mapped_( false ),
+		data_( nullptr ),
+		size_( 0u )
+#ifdef _WIN32
+		, mapping_( nullptr )
+#endif
+	{
+#ifdef _WIN32
+		HANDLE const file( CreateFileA( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+		if ( file != INVALID_HANDLE_VALUE ) {
+			LARGE_INTEGER file_size;
+			if ( GetFileSizeEx( file, &file_size ) && ( file_size.QuadPart > 0 ) ) {
+				mapping_ = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+				if ( mapping_ ) {
+					data_ = static_cast< char * >( MapViewOfFile( mapping_, FILE_MAP_READ, 0, 0, 0 ) );
+					if ( data_ ) {
+						size_ = static_cast< std::size_t >( file_size.QuadPart );
+						open_ = mapped_ = true;
+					} else {
+						CloseHandle( mapping_ );
+						mapping_ = nullptr;
+					}
+				}
+			}
+			CloseHandle( file );
+		}
+#else
+		int const fd( ::open( file_name.c_str(), O_RDONLY ) );
+		if ( fd != -1 ) {
+			struct stat file_stat;
+			if ( ( ::fstat( fd, &file_stat ) == 0 ) && S_ISREG( file_stat.st_mode ) && ( file_stat.st_size > 0 ) ) {
+				void * const p( ::mmap( nullptr, static_cast< std::size_t >( file_stat.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 ) );
+				if ( p != MAP_FAILED ) {
+					::madvise( p, static_cast< std::size_t >( file_stat.st_size ), MADV_SEQUENTIAL );
+					data_ = static_cast< char * >( p );
+					size_ = static_cast< std::size_t >( file_stat.st_size );
+					open_ = mapped_ = true;
+				}
+			}
+			::close( fd );
+		}
+#endif
+		if ( ! open_ ) { // Empty, special or unmappable file: Read it instead
+			std::ifstream file( file_name, std::ios_base::in | std::ios_base::binary );
+			if ( file ) {
+				copy_.assign( std::istreambuf_iterator< char >( file ), std::istreambuf_iterator< char >() );
+				if ( ! file.bad() ) {
+					data_ = &copy_[ 0 ];
+					size_ = copy_.size();
+					open_ = true;
+				}
+			}
+		}
+		if ( open_ ) setg( data_, data_, data_ + size_ );
+	}
+
+	MappedFileBuf::~MappedFileBuf()
+	{
+		close();
+	}
+
+	void
+	MappedFileBuf::close()
+	{
+		if ( mapped_ ) {
+#ifdef _WIN32
+			UnmapViewOfFile( data_ );
+			CloseHandle( mapping_ );
+			mapping_ = nullptr;
+#else
+			::munmap( data_, size_ );
+#endif
+		}
+		std::string().swap( copy_ );
+		open_ = mapped_ = false;
+		data_ = nullptr;
+		size_ = 0u;
+		setg( nullptr, nullptr, nullptr );
+	}
+
+	MappedFileBuf::pos_type
+	MappedFileBuf::seekoff( off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which )
+	{
+		if ( ! open_ || ! ( which & std::ios_base::in ) ) return pos_type( off_type( -1 ) );
+		off_type base;
+		if ( dir == std::ios_base::beg ) {
+			base = 0;
+		} else if ( dir == std::ios_base::cur ) {
+			base = gptr() - eback();
+		} else {
+			base = static_cast< off_type >( size_ );
+		}
+		return seekpos( pos_type( base + off ), which );
+	}
+
+	MappedFileBuf::pos_type
+	MappedFileBuf::seekpos( pos_type pos, std::ios_base::openmode which )
+	{
+		off_type const off( pos );
+		if ( ! open_ || ! ( which & std::ios_base::in ) || ( off < 0 ) || ( off > static_cast< off_type >( size_ ) ) ) return pos_type( off_type( -1 ) );
+		setg( data_, data_ + off, data_ + size_ );
+		return pos;
+	}
+
+} // EnergyPlus
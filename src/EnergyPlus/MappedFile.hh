@@ -0,0 +1,87 @@
+#ifndef MappedFile_hh_INCLUDED
+#define MappedFile_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <streambuf>
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+// Read-only stream buffer over a file mapped into memory
+//
+// The whole file is the get area of the stream buffer, so the characters read from a stream
+// attached to it are taken straight from the mapped pages: there is no read buffer to fill
+// and no copy of the file is made.  Where mapping is not available (or the file is empty)
+// the file is read into memory once instead.
+class MappedFileBuf : public std::streambuf
+{
+
+public: // Creation
+
+	explicit
+	MappedFileBuf( std::string const & file_name );
+
+	~MappedFileBuf();
+
+	MappedFileBuf( MappedFileBuf const & ) = delete;
+
+	MappedFileBuf &
+	operator =( MappedFileBuf const & ) = delete;
+
+public: // Properties
+
+	// File opened?
+	bool
+	is_open() const
+	{
+		return open_;
+	}
+
+	// Characters in the file
+	std::size_t
+	size() const
+	{
+		return size_;
+	}
+
+	// Start of the file contents
+	char const *
+	data() const
+	{
+		return data_;
+	}
+
+public: // Methods
+
+	// Unmap the file
+	void
+	close();
+
+protected: // std::streambuf
+
+	pos_type
+	seekoff( off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in ) override;
+
+	pos_type
+	seekpos( pos_type pos, std::ios_base::openmode which = std::ios_base::in ) override;
+
+private: // Data
+
+	bool open_; // File opened
+	bool mapped_; // Contents are a mapping (else they are in copy_)
+	char * data_; // Start of the file contents
+	std::size_t size_; // Characters in the file
+	std::string copy_; // Contents when the file is not mapped
+#ifdef _WIN32
+	void * mapping_; // File mapping handle
+#endif
+
+}; // MappedFileBuf
+
+} // EnergyPlus
+
+#endif
@@ -0,0 +1,188 @@
+// C++ Headers
+#include <map>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <MemoryAccounting.hh>
+#include <DataDaylighting.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <General.hh>
+#include <OutputProcessor.hh>
+#include <SolarShading.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryAccounting {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Accounts for the storage of the large arrays of the simulation by the module owning
+	// them, so that the modules behind a large resident memory can be found.  The accounting
+	// is written to the eio file at the end of the run when the timing profile is collected
+	// (ProfileTimings) or a memory budget is given (MemoryBudget).
+
+	// METHODOLOGY EMPLOYED:
+	// The arrays are sized where they are reported rather than tracked as they are allocated:
+	// the arrays listed are allocated once from the input and keep their size for the run.
+	// Only the storage of the array elements is counted; strings and arrays held inside
+	// elements of arrays of structures are not, except for the daylighting factors, which
+	// are summed over the zones and illuminance maps holding them.
+
+	// Using/Aliasing
+	using DataSystemVariables::MemoryBudget;
+	using General::RoundSigDigits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	Real64 const BytesPerMB( 1024.0 * 1024.0 ); // Bytes in a megabyte
+
+	// Functions
+
+	void
+	GatherMemoryUsage( std::vector< MemoryUsageEntry > & Entries )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the storage of the large arrays of the simulation, by owning module.
+
+		// METHODOLOGY EMPLOYED:
+		// Arrays that are not allocated are listed with no storage.  The polygon clipping
+		// arrays of SolarShading are thread-local, so only the calling thread's copies count.
+
+		// Using/Aliasing
+		using DataDaylighting::ZoneDaylight;
+		using DataDaylighting::IllumMapCalc;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 ZoneFactors( 0.0 ); // Daylighting factors of the zones {MB}
+		Real64 MapFactors( 0.0 ); // Daylighting factors of the illuminance maps {MB}
+
+		Entries.clear();
+
+		Entries.emplace_back( "DataHeatBalance", "SunlitFracHR", ArrayMegabytes( DataHeatBalance::SunlitFracHR ) );
+		Entries.emplace_back( "DataHeatBalance", "CosIncAngHR", ArrayMegabytes( DataHeatBalance::CosIncAngHR ) );
+		Entries.emplace_back( "DataHeatBalance", "SunlitFrac", ArrayMegabytes( DataHeatBalance::SunlitFrac ) );
+		Entries.emplace_back( "DataHeatBalance", "SunlitFracWithoutReveal", ArrayMegabytes( DataHeatBalance::SunlitFracWithoutReveal ) );
+		Entries.emplace_back( "DataHeatBalance", "CosIncAng", ArrayMegabytes( DataHeatBalance::CosIncAng ) );
+		Entries.emplace_back( "DataHeatBalance", "BackSurfaces", ArrayMegabytes( DataHeatBalance::BackSurfaces ) );
+		Entries.emplace_back( "DataHeatBalance", "OverlapAreas", ArrayMegabytes( DataHeatBalance::OverlapAreas ) );
+		Entries.emplace_back( "DataHeatBalance", "DifShdgRatioIsoSkyHRTS", ArrayMegabytes( DataHeatBalance::DifShdgRatioIsoSkyHRTS ) );
+		Entries.emplace_back( "DataHeatBalance", "DifShdgRatioHorizHRTS", ArrayMegabytes( DataHeatBalance::DifShdgRatioHorizHRTS ) );
+		Entries.emplace_back( "DataHeatBalance", "QRadSWwinAbs", ArrayMegabytes( DataHeatBalance::QRadSWwinAbs ) );
+		Entries.emplace_back( "DataHeatBalance", "Construct", ArrayMegabytes( DataHeatBalance::Construct ) );
+
+		Entries.emplace_back( "DataHeatBalSurface", "TH", ArrayMegabytes( DataHeatBalSurface::TH ) );
+		Entries.emplace_back( "DataHeatBalSurface", "QH", ArrayMegabytes( DataHeatBalSurface::QH ) );
+		Entries.emplace_back( "DataHeatBalSurface", "THM", ArrayMegabytes( DataHeatBalSurface::THM ) );
+		Entries.emplace_back( "DataHeatBalSurface", "QHM", ArrayMegabytes( DataHeatBalSurface::QHM ) );
+
+		Entries.emplace_back( "DataSurfaces", "Surface", ArrayMegabytes( DataSurfaces::Surface ) );
+		Entries.emplace_back( "DataSurfaces", "SurfaceWindow", ArrayMegabytes( DataSurfaces::SurfaceWindow ) );
+		Entries.emplace_back( "DataSurfaces", "AWinSurf", ArrayMegabytes( DataSurfaces::AWinSurf ) );
+		Entries.emplace_back( "DataSurfaces", "SUNCOSHR", ArrayMegabytes( DataSurfaces::SUNCOSHR ) );
+		Entries.emplace_back( "DataSurfaces", "ReflFacBmToDiffSolObs", ArrayMegabytes( DataSurfaces::ReflFacBmToDiffSolObs ) );
+		Entries.emplace_back( "DataSurfaces", "ReflFacBmToDiffSolGnd", ArrayMegabytes( DataSurfaces::ReflFacBmToDiffSolGnd ) );
+		Entries.emplace_back( "DataSurfaces", "ReflFacBmToBmSolObs", ArrayMegabytes( DataSurfaces::ReflFacBmToBmSolObs ) );
+		Entries.emplace_back( "DataSurfaces", "CosIncAveBmToBmSolObs", ArrayMegabytes( DataSurfaces::CosIncAveBmToBmSolObs ) );
+
+		for ( auto const & zone : ZoneDaylight ) {
+			ZoneFactors += ArrayMegabytes( zone.DaylIllFacSky ) + ArrayMegabytes( zone.DaylSourceFacSky ) + ArrayMegabytes( zone.DaylBackFacSky );
+			ZoneFactors += ArrayMegabytes( zone.DaylIllFacSun ) + ArrayMegabytes( zone.DaylIllFacSunDisk ) + ArrayMegabytes( zone.DaylSourceFacSun ) + ArrayMegabytes( zone.DaylSourceFacSunDisk ) + ArrayMegabytes( zone.DaylBackFacSun ) + ArrayMegabytes( zone.DaylBackFacSunDisk );
+		}
+		for ( auto const & map : IllumMapCalc ) {
+			MapFactors += ArrayMegabytes( map.DaylIllFacSky ) + ArrayMegabytes( map.DaylSourceFacSky ) + ArrayMegabytes( map.DaylBackFacSky );
+			MapFactors += ArrayMegabytes( map.DaylIllFacSun ) + ArrayMegabytes( map.DaylIllFacSunDisk ) + ArrayMegabytes( map.DaylSourceFacSun ) + ArrayMegabytes( map.DaylSourceFacSunDisk ) + ArrayMegabytes( map.DaylBackFacSun ) + ArrayMegabytes( map.DaylBackFacSunDisk );
+		}
+		Entries.emplace_back( "DataDaylighting", "ZoneDaylight daylighting factors", ZoneFactors );
+		Entries.emplace_back( "DataDaylighting", "IllumMapCalc daylighting factors", MapFactors );
+
+		Entries.emplace_back( "SolarShading", "WindowRevealStatus", ArrayMegabytes( SolarShading::WindowRevealStatus ) );
+		Entries.emplace_back( "SolarShading", "HCX", ArrayMegabytes( SolarShading::HCX ) );
+		Entries.emplace_back( "SolarShading", "HCY", ArrayMegabytes( SolarShading::HCY ) );
+		Entries.emplace_back( "SolarShading", "HCA", ArrayMegabytes( SolarShading::HCA ) );
+		Entries.emplace_back( "SolarShading", "HCB", ArrayMegabytes( SolarShading::HCB ) );
+		Entries.emplace_back( "SolarShading", "HCC", ArrayMegabytes( SolarShading::HCC ) );
+
+		Entries.emplace_back( "OutputProcessor", "RVariableTypes", ArrayMegabytes( OutputProcessor::RVariableTypes ) );
+		Entries.emplace_back( "OutputProcessor", "IVariableTypes", ArrayMegabytes( OutputProcessor::IVariableTypes ) );
+		Entries.emplace_back( "OutputProcessor", "DDVariableTypes", ArrayMegabytes( OutputProcessor::DDVariableTypes ) );
+		Entries.emplace_back( "OutputProcessor", "ReqRepVars", ArrayMegabytes( OutputProcessor::ReqRepVars ) );
+		Entries.emplace_back( "OutputProcessor", "VarMeterArrays", ArrayMegabytes( OutputProcessor::VarMeterArrays ) );
+		Entries.emplace_back( "OutputProcessor", "EnergyMeters", ArrayMegabytes( OutputProcessor::EnergyMeters ) );
+
+	}
+
+	void
+	ReportMemoryUsage()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the storage of the large arrays, their totals by module and the peak resident
+		// memory of the run to the eio file, and warns when the peak exceeds the memory budget.
+
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+		using DataTimings::epPeakMemoryUsage;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< MemoryUsageEntry > Entries;
+		std::map< std::string, Real64 > ModuleTotals; // By module name
+		Real64 PeakMemory; // Peak resident memory of the run {MB}
+
+		if ( ! DataSystemVariables::ProfileTimings && MemoryBudget <= 0.0 ) return;
+
+		GatherMemoryUsage( Entries );
+
+		gio::write( OutputFileInits, fmtA ) << "! <Memory Usage>, Module, Array, Size {MB}";
+		for ( auto const & entry : Entries ) {
+			gio::write( OutputFileInits, fmtA ) << " Memory Usage, " + entry.Module + ", " + entry.Array + ", " + RoundSigDigits( entry.Size, 3 );
+			ModuleTotals[ entry.Module ] += entry.Size;
+		}
+
+		gio::write( OutputFileInits, fmtA ) << "! <Memory Usage Total>, Module, Size {MB}";
+		for ( auto const & total : ModuleTotals ) {
+			gio::write( OutputFileInits, fmtA ) << " Memory Usage Total, " + total.first + ", " + RoundSigDigits( total.second, 3 );
+		}
+
+		PeakMemory = epPeakMemoryUsage();
+		gio::write( OutputFileInits, fmtA ) << "! <Memory Usage Peak>, Peak Resident Memory {MB}, Memory Budget {MB}";
+		gio::write( OutputFileInits, fmtA ) << " Memory Usage Peak, " + RoundSigDigits( PeakMemory, 1 ) + ", " + RoundSigDigits( MemoryBudget, 1 );
+
+		if ( MemoryBudget > 0.0 && PeakMemory > MemoryBudget ) {
+			ShowWarningError( "The peak resident memory of the run, " + RoundSigDigits( PeakMemory, 1 ) + " MB, exceeded the memory budget of " + RoundSigDigits( MemoryBudget, 1 ) + " MB." );
+			ShowContinueError( "The storage of the large arrays by module is listed in the eio file (Memory Usage)." );
+		}
+
+	}
+
+} // MemoryAccounting
+
+} // EnergyPlus
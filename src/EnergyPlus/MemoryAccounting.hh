@@ -0,0 +1,67 @@
+#ifndef MemoryAccounting_hh_INCLUDED
+#define MemoryAccounting_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryAccounting {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern Real64 const BytesPerMB; // Bytes in a megabyte
+
+	// Types
+
+	struct MemoryUsageEntry // Storage of one large array
+	{
+		// Members
+		std::string Module; // Module owning the array
+		std::string Array; // Name of the array
+		Real64 Size; // Storage of the array elements {MB}
+
+		// Default Constructor
+		MemoryUsageEntry() :
+			Size( 0.0 )
+		{}
+
+		// Member Constructor
+		MemoryUsageEntry(
+			std::string const & Module, // Module owning the array
+			std::string const & Array, // Name of the array
+			Real64 const Size // Storage of the array elements {MB}
+		) :
+			Module( Module ),
+			Array( Array ),
+			Size( Size )
+		{}
+
+	};
+
+	// Functions
+
+	// Storage of the elements of an array {MB}; memory held by the elements themselves is not counted
+	template< typename A >
+	inline
+	Real64
+	ArrayMegabytes( A const & a )
+	{
+		return a.size() * sizeof( typename A::value_type ) / BytesPerMB;
+	}
+
+	void
+	GatherMemoryUsage( std::vector< MemoryUsageEntry > & Entries );
+
+	void
+	ReportMemoryUsage();
+
+} // MemoryAccounting
+
+} // EnergyPlus
+
+#endif
@@ -2577,6 +2577,8 @@ namespace MixedAir {
 		//       MODIFIED       Shirey/Raustad FSEC, June/Aug 2003, Feb 2004
 		//                      Tianzhen Hong, Feb 2009 for DCV
 		//                      Tianzhen Hong, Aug 2013 for economizer faults
+		//                      Oct 2026, read the fault status set once per zone time step
+		//                      Oct 2026, set the fixed zone OA flow rates of the mechanical ventilation zones
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE
@@ -2982,6 +2984,24 @@ namespace MixedAir {
 					}
 				}
 
+				// The zone OA flow rates that do not depend on occupancy are fixed: set them once for CalcOAController
+				vent_mech.ZoneOAPeopleDes.dimension( vent_mech.NumofVentMechZones, 0.0 );
+				vent_mech.ZoneOAAreaDes.dimension( vent_mech.NumofVentMechZones, 0.0 );
+				vent_mech.ZoneOAFlowDes.dimension( vent_mech.NumofVentMechZones, 0.0 );
+				vent_mech.ZoneOAACHDes.dimension( vent_mech.NumofVentMechZones, 0.0 );
+				for ( NumMechVentZone = 1; NumMechVentZone <= vent_mech.NumofVentMechZones; ++NumMechVentZone ) {
+					ZoneNum = vent_mech.Zone( NumMechVentZone );
+					auto const & zone( Zone( ZoneNum ) );
+					for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
+						if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
+						vent_mech.ZoneOAPeopleDes( NumMechVentZone ) += People( PeopleNum ).NumberOfPeople * zone.Multiplier * zone.ListMultiplier * vent_mech.ZoneOAPeopleRate( NumMechVentZone );
+					}
+					vent_mech.ZoneOAAreaDes( NumMechVentZone ) = zone.FloorArea * zone.Multiplier * zone.ListMultiplier * vent_mech.ZoneOAAreaRate( NumMechVentZone );
+					vent_mech.ZoneOAFlowDes( NumMechVentZone ) = zone.Multiplier * zone.ListMultiplier * vent_mech.ZoneOAFlow( NumMechVentZone );
+					// note the volume is taken from the zone numbered by the position in the list, as CalcOAController always has
+					vent_mech.ZoneOAACHDes( NumMechVentZone ) = zone.Multiplier * zone.ListMultiplier * ( vent_mech.ZoneOAACH( NumMechVentZone ) * Zone( NumMechVentZone ).Volume ) / 3600.0;
+				}
+
 			}
 
 			MechVentCheckFlag( OAControllerNum ) = false;
@@ -3161,11 +3181,9 @@ namespace MixedAir {
 			for ( i = 1; i <= NumFaults; ++i ) {
 				if ( ( Faults( i ).ControllerTypeEnum == iController_AirEconomizer ) && ( Faults( i ).ControllerID == OAControllerNum ) ) {
 
-					if ( GetCurrentScheduleValue( Faults( i ).AvaiSchedPtr ) > 0.0 ) {
-						rSchVal = 1.0;
-						if ( Faults( i ).SeveritySchedPtr > 0 ) {
-							rSchVal = GetCurrentScheduleValue( Faults( i ).SeveritySchedPtr );
-						}
+					// schedules are evaluated once per zone time step by UpdateFaultsStatus
+					if ( Faults( i ).Status ) {
+						rSchVal = Faults( i ).SeverityValue;
 					} else {
 						// no fault
 						continue;
@@ -3332,6 +3350,7 @@ namespace MixedAir {
 		//                           to enhance CO2 based DCV control
 		//                      Tianzhen Hong, March 2012, zone maximum OA fraction - a TRACE feature
 		//                      Tianzhen Hong, March 2012, multi-path VRP based on ASHRAE 62.1-2010
+		//                      Oct 2026, use the fixed zone OA flow rates set in InitOAController
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE
@@ -3357,8 +3376,6 @@ namespace MixedAir {
 		using InputProcessor::GetNumObjectsFound;
 		using DataHeatBalance::ZoneIntGain;
 		using DataHeatBalance::Zone;
-		using DataHeatBalance::People;
-		using DataHeatBalance::TotPeople;
 		using DataZoneEquipment::ZoneEquipConfig;
 		using DataHeatBalFanSys::ZoneAirHumRat;
 		using DataContaminantBalance::ZoneSysContDemand;
@@ -3437,7 +3454,6 @@ namespace MixedAir {
 		Real64 RecircMassFlowRateAtMinOAFlow; // recirc air mass flow rate at min OA, used for custom economizer control calculation
 		Real64 ReliefMassFlowAtMinOA; // relief air mass flow rate at min OA, used for custom economizer control calculation
 		int OAIndex; // index to design specification outdoor air objects
-		int PeopleNum;
 		Real64 ZoneMaxCO2; // Breathing-zone CO2 concentartion
 		Real64 ZoneMinCO2; // Minimum CO2 concentration in zone
 		Real64 ZoneContamControllerSched; // Schedule value for ZoneControl:ContaminantController
@@ -3580,17 +3596,13 @@ namespace MixedAir {
 						if ( VentilationMechanical( VentMechObjectNum ).DCVFlag ) {
 							ZoneOAPeople = ZoneIntGain( ZoneNum ).NOFOCC * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
 						} else {
-							ZoneOAPeople = 0.0;
-							for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
-								if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
-								ZoneOAPeople += People( PeopleNum ).NumberOfPeople * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
-							}
+							ZoneOAPeople = VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleDes( ZoneIndex );
 						}
 
 						// Calc the zone OA flow rate based on the floor area component
-						ZoneOAArea = Zone( ZoneNum ).FloorArea * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAAreaRate( ZoneIndex );
-						ZoneOAFlow = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAFlow( ZoneIndex );
-						ZoneOAACH = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * ( VentilationMechanical( VentMechObjectNum ).ZoneOAACH( ZoneIndex ) * Zone( ZoneIndex ).Volume ) / 3600.0;
+						ZoneOAArea = VentilationMechanical( VentMechObjectNum ).ZoneOAAreaDes( ZoneIndex );
+						ZoneOAFlow = VentilationMechanical( VentMechObjectNum ).ZoneOAFlowDes( ZoneIndex );
+						ZoneOAACH = VentilationMechanical( VentMechObjectNum ).ZoneOAACHDes( ZoneIndex );
 
 						// Calc the breathing-zone OA flow rate
 						OAIndex = VentilationMechanical( VentMechObjectNum ).ZoneDesignSpecOAObjIndex( ZoneIndex );
@@ -3659,17 +3671,13 @@ namespace MixedAir {
 							if ( VentilationMechanical( VentMechObjectNum ).DCVFlag ) {
 								ZoneOAPeople = ZoneIntGain( ZoneNum ).NOFOCC * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
 							} else {
-								ZoneOAPeople = 0.0;
-								for ( PeopleNum = 1; PeopleNum <= TotPeople; ++PeopleNum ) {
-									if ( People( PeopleNum ).ZonePtr != ZoneNum ) continue;
-									ZoneOAPeople += People( PeopleNum ).NumberOfPeople * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleRate( ZoneIndex );
-								}
+								ZoneOAPeople = VentilationMechanical( VentMechObjectNum ).ZoneOAPeopleDes( ZoneIndex );
 							}
 
 							// Calc the zone OA flow rate based on the floor area component
-							ZoneOAArea = Zone( ZoneNum ).FloorArea * Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAAreaRate( ZoneIndex );
-							ZoneOAFlow = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * VentilationMechanical( VentMechObjectNum ).ZoneOAFlow( ZoneIndex );
-							ZoneOAACH = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier * ( VentilationMechanical( VentMechObjectNum ).ZoneOAACH( ZoneIndex ) * Zone( ZoneIndex ).Volume ) / 3600.0;
+							ZoneOAArea = VentilationMechanical( VentMechObjectNum ).ZoneOAAreaDes( ZoneIndex );
+							ZoneOAFlow = VentilationMechanical( VentMechObjectNum ).ZoneOAFlowDes( ZoneIndex );
+							ZoneOAACH = VentilationMechanical( VentMechObjectNum ).ZoneOAACHDes( ZoneIndex );
 
 							// Calc the breathing-zone OA flow rate
 							OAIndex = VentilationMechanical( VentMechObjectNum ).ZoneDesignSpecOAObjIndex( ZoneIndex );
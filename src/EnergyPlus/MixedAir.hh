@@ -462,6 +462,10 @@ namespace MixedAir {
 		Array1D_string ZoneDesignSpecADObjName; // name of the design specification zone air
 		// distribution object for each zone in the zone list
 		Array1D< Real64 > ZoneSecondaryRecirculation; // zone air secondary recirculation ratio
+		Array1D< Real64 > ZoneOAPeopleDes; // OA flow rate for the design number of people, with zone multipliers (m3/s) for each zone
+		Array1D< Real64 > ZoneOAAreaDes; // OA flow rate for the floor area, with zone multipliers (m3/s) for each zone
+		Array1D< Real64 > ZoneOAFlowDes; // OA flow rate per zone, with zone multipliers (m3/s) for each zone
+		Array1D< Real64 > ZoneOAACHDes; // OA flow rate for the air changes, with zone multipliers (m3/s) for each zone
 
 		// Default Constructor
 		VentilationMechanicalProps() :
@@ -331,6 +331,37 @@ namespace MoistureBalanceEMPDManager {
 
 	}
 
+	void
+	InitMoistureBalanceEMPDEnvrn()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Initialize the surface moisture once at the beginning of each environment.
+
+		// METHODOLOGY EMPLOYED:
+		// Called by CalcMoistureBalanceEMPD, and by the inside surface heat balance before it solves
+		// surfaces in parallel so that the initialization and the flag are only changed on one thread.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool OneTimeFlag( true );
+
+		if ( BeginEnvrnFlag ) {
+			if ( OneTimeFlag ) {
+				InitMoistureBalanceEMPD();
+				OneTimeFlag = false;
+			}
+		} else if ( ! OneTimeFlag ) {
+			OneTimeFlag = true;
+		}
+
+	}
+
 	void
 	CalcMoistureBalanceEMPD(
 		int const SurfNum,
@@ -344,7 +375,7 @@ namespace MoistureBalanceEMPDManager {
 		// SUBROUTINE INFORMATION:
 		//   Authors:        Muthusamy Swami and Lixing Gu
 		//   Date written:   August, 1999
-		//   Modified:       na
+		//   Modified:       Oct 2026, air properties evaluated once per call; may run for several surfaces at once
 		//   Re-engineered:  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -394,23 +425,10 @@ namespace MoistureBalanceEMPDManager {
 		Real64 CC; // Coefficient for ODE
 		Real64 ErrorM; // Percent error
 		int Flag; // Convergence flag (0 - converged)
-		static bool OneTimeFlag( true );
 		Real64 Wsurf; // Surface moisture flux
 		Real64 PVsurf; // Surface vapor pressure
 
-		//    if (OneTimeFlag) then
-		//       Call InitMoistureBalanceEMPD
-		//       OneTimeFlag = .False.
-		//    end if
-
-		if ( BeginEnvrnFlag && OneTimeFlag ) {
-			InitMoistureBalanceEMPD();
-			OneTimeFlag = false;
-		}
-
-		if ( ! BeginEnvrnFlag ) {
-			OneTimeFlag = true;
-		}
+		InitMoistureBalanceEMPDEnvrn();
 
 		MoistEMPDFlux( SurfNum ) = 0.0;
 		Flag = 1;
@@ -433,6 +451,12 @@ namespace MoistureBalanceEMPDManager {
 		Real64 const RHaver_fac( 461.52 * ( Taver + KelvinConv ) * std::exp( -23.7093 + 4111.0 / Taver_237 ) );
 		Real64 const BR_fac( ( 4111.0 / pow_2( Taver_237 ) ) - ( 1.0 / ( Taver + KelvinConv ) ) );
 
+		// Zone air properties do not change during the iterations
+		Real64 const RhoAirZone( PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) );
+		HM = HConvIn( SurfNum ) / ( RhoAirZone * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), TempZone ) );
+		RALPHA = ZoneAirHumRat( ZoneNum ) * OutBaroPress / ( 461.52 * ( TempZone + KelvinConv ) * ( ZoneAirHumRat( ZoneNum ) + 0.62198 ) );
+		RHOBULK = material.Density;
+
 		while ( Flag > 0 ) {
 			RVaver = ( MoistEMPDNew( SurfNum ) + MoistEMPDOld( SurfNum ) ) / 2.0;
 			RHaver = RVaver * RHaver_fac;
@@ -444,10 +468,6 @@ namespace MoistureBalanceEMPDManager {
 
 			AT = ( material.MoistACoeff * material.MoistBCoeff * std::pow( RHaver, material.MoistBCoeff ) + material.MoistCCoeff * material.MoistDCoeff * std::pow( RHaver, material.MoistDCoeff ) ) / RVaver;
 			BR = BR_fac * AT * RVaver;
-			RHOBULK = material.Density;
-			HM = HConvIn( SurfNum ) / ( PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), TempZone ) );
-			ZoneNum = Surface( SurfNum ).Zone;
-			RALPHA = ZoneAirHumRat( ZoneNum ) * OutBaroPress / ( 461.52 * ( TempZone + KelvinConv ) * ( ZoneAirHumRat( ZoneNum ) + 0.62198 ) );
 			BB = HM / ( RHOBULK * material.EMPDVALUE * AT );
 			CC = BB * RALPHA + BR / AT * ( TempSurfIn - TempSurfInOld ) / TimeStepZoneSec;
 			SolverMoistureBalanceEMPD( MoistEMPDNew( SurfNum ), MoistEMPDOld( SurfNum ), 1.0, BB, CC );
@@ -458,6 +478,9 @@ namespace MoistureBalanceEMPDManager {
 
 			++NOFITR;
 			if ( NOFITR > 500 ) {
+#ifdef _OPENMP
+#pragma omp critical ( EMPDMessages )
+#endif
 				ShowFatalError( "Iteration limit exceeded in EMPD model, program terminated." );
 			}
 
@@ -470,7 +493,7 @@ namespace MoistureBalanceEMPDManager {
 		// Calculate latent load
 		PVsurf = RHaver * std::exp( 23.7093 - 4111.0 / Taver_237 );
 		Wsurf = 0.62198 * RHaver / ( std::exp( -23.7093 + 4111.0 / Taver_237 ) * OutBaroPress - RHaver );
-		MoistEMPDFlux( SurfNum ) = HM * ( MoistEMPDNew( SurfNum ) - PsyRhoAirFnPbTdbW( OutBaroPress, TempZone, ZoneAirHumRat( ZoneNum ), RoutineName ) * ZoneAirHumRat( ZoneNum ) ) * Lam;
+		MoistEMPDFlux( SurfNum ) = HM * ( MoistEMPDNew( SurfNum ) - RhoAirZone * ZoneAirHumRat( ZoneNum ) ) * Lam;
 		// Calculate surface dew point temperature based on surface vapor density
 		TempSat = 4111.0 / ( 23.7093 - std::log( PVsurf ) ) + 35.45 - KelvinConv;
 
@@ -27,6 +27,9 @@ namespace MoistureBalanceEMPDManager {
 	void
 	InitMoistureBalanceEMPD();
 
+	void
+	InitMoistureBalanceEMPDEnvrn();
+
 	void
 	CalcMoistureBalanceEMPD(
 		int const SurfNum,
@@ -1,5 +1,6 @@
 // C++ Headers
 #include <string>
+#include <unordered_map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -13,6 +14,7 @@
 #include <DataEnvironment.hh>
 #include <DataErrorTracking.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataTimings.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -75,6 +77,7 @@ namespace NodeInputManager {
 	bool GetNodeInputFlag( true ); // Flag to Get Node Input(s)
 	Array1D_string TmpNodeID; // Used to "reallocate" name arrays
 	Array1D_int NodeRef; // Number of times a Node is "referenced"
+	std::unordered_map< std::string, int > NodeIDIndex; // Node number of each unique node name
 	std::string CurCheckContextName; // Used in Uniqueness checks
 	Array1D_string UniqueNodeNames; // used in uniqueness checks
 	int NumCheckNodes( 0 ); // Num of Unique nodes in check
@@ -494,6 +497,8 @@ namespace NodeInputManager {
 		Array1D_string cAlphas;
 		Array1D< Real64 > rNumbers;
 
+		DataTimings::ProfileTimer const profileTimer( "GetNodeListsInput" ); // Region of the timing profile
+
 		ErrorsFound = false;
 		GetObjectDefMaxArgs( CurrentModuleObject, NCount, NumAlphas, NumNumbers );
 		cAlphas.allocate( NumAlphas );
@@ -600,7 +605,7 @@ namespace NodeInputManager {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   September 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, look up names in a hashed index instead of searching NodeID
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -608,7 +613,8 @@ namespace NodeInputManager {
 
 		// METHODOLOGY EMPLOYED:
 		// Look to see if a name has already been entered.  Use the index of
-		// the array as the node number, if there.
+		// the array as the node number, if there.  Names are found through
+		// NodeIDIndex, which is kept alongside NodeID.
 
 		// REFERENCES:
 		// na
@@ -645,7 +651,7 @@ namespace NodeInputManager {
 
 		NumNode = 0;
 		if ( NumOfUniqueNodeNames > 0 ) {
-			NumNode = FindItemInList( Name, NodeID( {1,NumOfUniqueNodeNames} ), NumOfUniqueNodeNames );
+			NumNode = FindItemInList( Name, NodeIDIndex );
 			if ( NumNode > 0 ) {
 				AssignNodeNumber = NumNode;
 				++NodeRef( NumNode );
@@ -671,6 +677,7 @@ namespace NodeInputManager {
 				Node( NumOfNodes ).FluidType = NodeFluidType;
 				NodeRef( NumOfNodes ) = 0;
 				NodeID( NumOfUniqueNodeNames ) = Name;
+				NodeIDIndex.emplace( Name, NumOfUniqueNodeNames );
 
 				AssignNodeNumber = NumOfUniqueNodeNames;
 			}
@@ -686,6 +693,8 @@ namespace NodeInputManager {
 			NumOfUniqueNodeNames = 1;
 			NodeID( 0 ) = "Undefined";
 			NodeID( NumOfUniqueNodeNames ) = Name;
+			NodeIDIndex.clear();
+			NodeIDIndex.emplace( Name, 1 );
 			AssignNodeNumber = 1;
 			NodeRef( 1 ) = 0;
 		}
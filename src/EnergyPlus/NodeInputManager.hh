@@ -1,6 +1,10 @@
 #ifndef NodeInputManager_hh_INCLUDED
 #define NodeInputManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -35,6 +39,7 @@ namespace NodeInputManager {
 	// this module that may need to get the Node Inputs.
 	extern bool GetNodeInputFlag; // Flag to Get Node Input(s)
 	extern Array1D_int NodeRef; // Number of times a Node is "referenced"
+	extern std::unordered_map< std::string, int > NodeIDIndex; // Node number of each unique node name
 	extern std::string CurCheckContextName; // Used in Uniqueness checks
 	extern Array1D_string UniqueNodeNames; // used in uniqueness checks
 	extern int NumCheckNodes; // Num of Unique nodes in check
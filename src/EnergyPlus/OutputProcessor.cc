@@ -2,11 +2,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -16,6 +20,7 @@
 
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
+#include <CompressedOutput.hh>
 #include <OutputProcessor.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobalConstants.hh>
@@ -25,6 +30,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
@@ -125,6 +131,54 @@ namespace OutputProcessor {
 	static std::string const BlankString;
 	int const UnitsStringLength( 16 );
 
+	// Binary time-series output (see OpenBinaryOutput)
+	struct BinaryOutputColumn // Buffered records of one report ID
+	{
+		int Width; // Values per record
+		std::vector< Real64 > Values; // Records not yet written
+
+		BinaryOutputColumn() :
+			Width( 0 )
+		{}
+	};
+	static char const BinaryOutputMagic[ 8 ] = { 'E', 'P', 'E', 'S', 'O', 'B', '0', '1' };
+	static std::size_t const BinaryOutputBlockValues( 131072 ); // Buffered values that trigger a write to the file (1 MiB)
+	static std::ofstream BinaryOutputFile; // eplusout.esob
+	static std::vector< BinaryOutputColumn > BinaryOutputColumns; // Buffered records by report ID
+	static std::size_t BinaryOutputValuesBuffered( 0 ); // Values buffered in all columns
+	static int BinaryOutputStampCount( 0 ); // Time stamp records written to eplusout.eso so far
+
+	// Report value streaming to a library caller (see SetReportValueStreaming)
+	static std::vector< char > ReportValueStreaming; // Streaming of each report ID: 0 none, 1 values, 2 values only (no file output)
+
+	// Direct CSV output (see OpenCsvOutput)
+	struct CsvOutputFileData // Columns and current row of one reporting frequency
+	{
+		std::string FileName;
+		std::ofstream File;
+		std::vector< std::string > Headings; // Column headings, in eso dictionary order
+		std::size_t NumColumnsWritten; // Columns in the heading line of the file (0 until it is written)
+		std::vector< std::string > Cells; // Values of the current row
+		std::string TimeStamp; // Date/Time of the current row
+		int StampEnvironment; // Environment of the current row
+		int StampDayOfSim; // Day of simulation of the current row
+		bool RowPending; // A value of the current row has been set
+		std::string Buffer; // Lines not yet written to the file
+
+		CsvOutputFileData() :
+			NumColumnsWritten( 0 ),
+			StampEnvironment( 0 ),
+			StampDayOfSim( 0 ),
+			RowPending( false )
+		{}
+	};
+	static int const NumCsvOutputFiles( 5 );
+	static std::string const CsvOutputFileSuffix[ NumCsvOutputFiles ] = { "-timestep", "-hourly", "-daily", "-monthly", "-runperiod" };
+	static std::size_t const CsvOutputBlockSize( 1048576 ); // Buffered characters that trigger a write to the file (1 MiB)
+	static CsvOutputFileData CsvOutputFiles[ NumCsvOutputFiles ]; // Each call and time step, hourly, daily, monthly, run period
+	static std::vector< std::pair< int, int > > CsvOutputColumns; // File and column of each report ID (file -1 if not written)
+	static bool CsvOutputOpen( false );
+
 	int const RVarAllocInc( 1000 );
 	int const LVarAllocInc( 1000 );
 	int const IVarAllocInc( 10 );
@@ -183,6 +237,11 @@ namespace OutputProcessor {
 
 	int NumEnergyMeters( 0 ); // Current number of Energy Meters
 	Array1D< Real64 > MeterValue; // This holds the current timestep value for each meter.
+	bool MeterScatterCompiled( false ); // True when the variable to meter scatter matrix matches VarMeterArrays
+	std::vector< int > MeterScatterRowStart; // Start of each meter's row in MeterScatterVarMeter (0-based, NumEnergyMeters+1)
+	std::vector< int > MeterScatterVarMeter; // VarMeterArrays index of each variable contributing to a meter
+	std::vector< Real64 > VarMeterValue; // Time step value of each metered variable, by VarMeterArrays index
+	int const MinMeterScatterEntriesForThreads( 20000 ); // Smallest scatter matrix worth splitting across threads
 
 	int TimeStepStampReportNbr; // TimeStep and Hourly Report number
 	std::string TimeStepStampReportChr; // TimeStep and Hourly Report number (character -- for printing)
@@ -216,6 +275,7 @@ namespace OutputProcessor {
 	Reference< RealVariables > RVar;
 	Reference< IntegerVariables > IVar;
 	Array1D< ReqReportVariables > ReqRepVars;
+	std::unordered_map< std::string, ReqReportVariablesIndex > ReqRepVarsIndex; // Requests for each (uppercase) variable name
 	Array1D< MeterArrayType > VarMeterArrays;
 	Array1D< MeterType > EnergyMeters;
 	Array1D< EndUseCategoryType > EndUseCategory;
@@ -420,7 +480,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   December 1998
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, look up the requests in ReqRepVarsIndex
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -441,13 +501,14 @@ namespace OutputProcessor {
 		// This instance being requested will always have a key associated with it.  Matching
 		// instances (from input) may or may not have keys, but only one instance of a reporting
 		// frequency per variable is allowed.  ReportList will be populated with ReqRepVars indices
-		// of those extra things from input that satisfy this condition.
+		// of those extra things from input that satisfy this condition.  The requests for this
+		// variable, and for this key of it, are found by hash rather than by searching ReqRepVars.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::FindItem;
+		using InputProcessor::MakeUPPERCase;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -463,11 +524,6 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool GetInputFlag( true );
-		int Item;
-		int Loop;
-		int Pos;
-		int MinLook;
-		int MaxLook;
 
 		if ( GetInputFlag ) {
 			GetReportVariableInput();
@@ -475,55 +531,36 @@ namespace OutputProcessor {
 		}
 
 		if ( NumOfReqVariables > 0 ) {
-			// Do a quick check
-			Item = FindItem( VarName, ReqRepVars( {1,NumOfReqVariables} ).VarName(), NumOfReqVariables );
-
 			NumExtraVars = 0;
 			ReportList = 0;
-			MinLook = 999999999;
-			MaxLook = -999999999;
-
-			if ( Item != 0 ) {
-				Loop = Item;
-				Pos = Item;
-				MinLook = min( MinLook, Pos );
-				MaxLook = max( MaxLook, Pos );
-				while ( Loop <= NumOfReqVariables && Pos != 0 ) {
-					//  Mark all with blank keys as used
-					if ( ReqRepVars( Loop ).Key.empty() ) {
-						ReqRepVars( Loop ).Used = true;
-					}
-					if ( Loop < NumOfReqVariables ) {
-						Pos = FindItem( VarName, ReqRepVars( {Loop + 1,NumOfReqVariables} ).VarName(), NumOfReqVariables - Loop );
-						if ( Pos != 0 ) {
-							MinLook = min( MinLook, Loop + Pos );
-							MaxLook = max( MaxLook, Loop + Pos );
-						}
-					} else {
-						Pos = 1;
-					}
-					Loop += Pos;
+
+			auto const found( ReqRepVarsIndex.find( MakeUPPERCase( VarName ) ) );
+			if ( found != ReqRepVarsIndex.end() ) {
+				ReqReportVariablesIndex const & Requests( found->second );
+				//  Mark all with blank keys as used
+				for ( int const Loop : Requests.AllKeys ) {
+					ReqRepVars( Loop ).Used = true;
+				}
+				if ( KeyedValue.empty() ) {
+					BuildKeyVarList( Requests.AllKeys );
+				} else {
+					auto const keyed( Requests.Keys.find( MakeUPPERCase( KeyedValue ) ) );
+					if ( keyed != Requests.Keys.end() ) BuildKeyVarList( keyed->second );
 				}
-				BuildKeyVarList( KeyedValue, VarName, MinLook, MaxLook );
-				AddBlankKeys( VarName, MinLook, MaxLook );
+				AddBlankKeys( Requests.AllKeys );
 			}
 		}
 
 	}
 
 	void
-	BuildKeyVarList(
-		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	)
+	BuildKeyVarList( std::vector< int > const & Requests ) // ReqRepVars indices matching this key and variable
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, given the matching requests from ReqRepVarsIndex
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -531,15 +568,12 @@ namespace OutputProcessor {
 		// pointers to that data structure for this KeyedValue and VariableName.
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the matching requests (in input order) and add those
+		// that dont duplicate ones already in the list.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::SameString;
-
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -553,14 +587,10 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		Array1D_int TmpReportList;
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).Key, KeyedValue ) ) continue;
+		for ( int const Loop : Requests ) {
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -589,17 +619,13 @@ namespace OutputProcessor {
 	}
 
 	void
-	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	)
+	AddBlankKeys( std::vector< int > const & Requests ) // ReqRepVars indices of this variable for all keys
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, given the blank key requests from ReqRepVarsIndex
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -608,15 +634,12 @@ namespace OutputProcessor {
 		// a frequency already on the list).
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the blank key requests (in input order) and add those
+		// that dont duplicate ones already in the list.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::SameString;
-
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -630,14 +653,10 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		Array1D_int TmpReportList;
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! ReqRepVars( Loop ).Key.empty() ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
+		for ( int const Loop : Requests ) {
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -672,7 +691,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   December 1998
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, index the requests by variable name and key
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -697,7 +716,8 @@ namespace OutputProcessor {
 		//        \object-list ScheduleNames
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The requests are indexed (ReqRepVarsIndex) by uppercase variable name and then by
+		// uppercase key, keeping input order, so that CheckReportVariable need not search them.
 
 		// REFERENCES:
 		// na
@@ -753,6 +773,7 @@ namespace OutputProcessor {
 		cCurrentModuleObject = "Output:Variable";
 		NumOfReqVariables = GetNumObjectsFound( cCurrentModuleObject );
 		ReqRepVars.allocate( NumOfReqVariables );
+		ReqRepVarsIndex.clear();
 
 		for ( Loop = 1; Loop <= NumOfReqVariables; ++Loop ) {
 
@@ -787,6 +808,13 @@ namespace OutputProcessor {
 
 			ReqRepVars( Loop ).Used = false;
 
+			ReqReportVariablesIndex & Requests( ReqRepVarsIndex[ MakeUPPERCase( ReqRepVars( Loop ).VarName ) ] );
+			if ( ReqRepVars( Loop ).Key.empty() ) {
+				Requests.AllKeys.push_back( Loop );
+			} else {
+				Requests.Keys[ MakeUPPERCase( ReqRepVars( Loop ).Key ) ].push_back( Loop );
+			}
+
 		}
 
 		if ( ErrorsFound ) {
@@ -2270,6 +2298,7 @@ namespace OutputProcessor {
 			ValidateNStandardizeMeterTitles( MtrUnits, ResourceType, EndUse, EndUseSub, Group, ErrorsFound );
 		}
 
+		MeterScatterCompiled = false;
 		VarMeterArrays.redimension( ++NumVarMeterArrays );
 		MeterArrayPtr = NumVarMeterArrays;
 		VarMeterArrays( NumVarMeterArrays ).NumOnMeters = 0;
@@ -2375,6 +2404,7 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		MeterScatterCompiled = false;
 		if ( MeterArrayPtr == 0 ) {
 			VarMeterArrays.redimension( ++NumVarMeterArrays );
 			MeterArrayPtr = NumVarMeterArrays;
@@ -2819,6 +2849,143 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	CompileMeterScatter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine builds the variable to meter scatter matrix used by ScatterMeterValues
+		// from the meter lists in VarMeterArrays.
+
+		// METHODOLOGY EMPLOYED:
+		// The matrix is stored by meter (compressed rows): row Meter lists the VarMeterArrays
+		// index of every variable that adds into that meter.  Entries are collected in the same
+		// order UpdateDataandReport walks the variables (zone variables, then HVAC variables, and
+		// for each variable its meters, then its custom meters) and placed with a stable counting
+		// sort, so each meter sums its variables in the same order as UpdateMeterValues did and the
+		// results are unchanged.  The matrix is rebuilt whenever AttachMeters or AttachCustomMeters
+		// changes the meter lists.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::pair< int, int > > Entries; // (meter, VarMeterArrays index) in accumulation order
+
+		for ( int IndexType = 1; IndexType <= 2; ++IndexType ) {
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+				int const MeterArrayPtr( RVariableTypes( Loop ).VarPtr().MeterArrayPtr );
+				if ( MeterArrayPtr == 0 ) continue;
+				auto const & varMeters( VarMeterArrays( MeterArrayPtr ) );
+				for ( int Meter = 1; Meter <= varMeters.NumOnMeters; ++Meter ) {
+					Entries.emplace_back( varMeters.OnMeters( Meter ), MeterArrayPtr );
+				}
+				for ( int Meter = 1; Meter <= varMeters.NumOnCustomMeters; ++Meter ) {
+					Entries.emplace_back( varMeters.OnCustomMeters( Meter ), MeterArrayPtr );
+				}
+			}
+		}
+
+		MeterScatterRowStart.assign( NumEnergyMeters + 1, 0 );
+		for ( auto const & Entry : Entries ) {
+			++MeterScatterRowStart[ Entry.first ];
+		}
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			MeterScatterRowStart[ Meter ] += MeterScatterRowStart[ Meter - 1 ];
+		}
+		MeterScatterVarMeter.resize( Entries.size() );
+		std::vector< int > Next( MeterScatterRowStart.begin(), MeterScatterRowStart.end() - 1 );
+		for ( auto const & Entry : Entries ) {
+			MeterScatterVarMeter[ Next[ Entry.first - 1 ]++ ] = Entry.second;
+		}
+
+		VarMeterValue.assign( NumVarMeterArrays + 1, 0.0 );
+		MeterScatterCompiled = true;
+
+	}
+
+	void
+	ScatterMeterValues()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds the time step values of the metered variables (VarMeterValue)
+		// into the meter values, using the scatter matrix from CompileMeterScatter.
+
+		// METHODOLOGY EMPLOYED:
+		// Each meter is one row of the matrix, so the meters are independent of each other and
+		// large matrices are split across threads by meter.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		using DataSystemVariables::MaxNumberOfThreads;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumEntries( static_cast< int >( MeterScatterVarMeter.size() ) );
+		if ( NumEntries == 0 ) return;
+		int const * const RowStart( MeterScatterRowStart.data() );
+		int const * const VarMeter( MeterScatterVarMeter.data() );
+		Real64 const * const VarValue( VarMeterValue.data() );
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( static ) num_threads( MaxNumberOfThreads ) if ( MaxNumberOfThreads > 1 && NumEntries >= MinMeterScatterEntriesForThreads )
+#endif
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			int const RowEnd( RowStart[ Meter ] );
+			if ( RowStart[ Meter - 1 ] == RowEnd ) continue;
+			Real64 Sum( MeterValue( Meter ) );
+			for ( int Entry = RowStart[ Meter - 1 ]; Entry < RowEnd; ++Entry ) {
+				Sum += VarValue[ VarMeter[ Entry ] ];
+			}
+			MeterValue( Meter ) = Sum;
+		}
+
+	}
+
 	void
 	UpdateMeters( int const TimeStamp ) // Current TimeStamp (for max/min)
 	{
@@ -3766,7 +3933,15 @@ namespace OutputProcessor {
 		static char stamp[ N ];
 		assert( reportIDString.length() + DayOfSimChr.length() + ( DayType.present() ? DayType().length() : 0u ) + 26 < N ); // Check will fit in stamp size
 
+		if ( DataGlobals::fReportTimeStampPtr ) {
+			Real64 const StampEndMinute( ( reportingInterval == ReportHourly ) ? 60.0 : ( EndMinute.present() ? Real64( EndMinute() ) : 0.0 ) );
+			StreamReportTimeStamp( reportingInterval, DayOfSim, Month.present() ? Month() : 0, DayOfMonth.present() ? DayOfMonth() : 0, Hour.present() ? Hour() : 0, StampEndMinute );
+		}
 		if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return; // Stream
+		if ( out_stream_p == DataGlobals::eso_stream ) {
+			++BinaryOutputStampCount; // Binary output values refer to these
+			if ( CsvOutputOpen ) StartCsvOutputRow( reportingInterval, DayOfSim, Month.present() ? Month() : 0, DayOfMonth.present() ? DayOfMonth() : 0, Hour.present() ? Hour() : 0, ( reportingInterval == ReportHourly ) ? 60.0 : ( EndMinute.present() ? Real64( EndMinute() ) : 0.0 ) );
+		}
 
 		std::ostream & out_stream( *out_stream_p );
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
@@ -3874,6 +4049,10 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValue, variableName, indexType, UnitsString, reportingInterval, false, ScheduleName );
 		}
 
+		if ( eso_stream && CsvOutputOpen ) AddCsvOutputColumn( reportID, reportingInterval, keyedValue + ':' + variableName, UnitsString );
+
+		SetReportValueStreaming( reportID, reportingInterval, keyedValue, variableName, UnitsString );
+
 	}
 
 	void
@@ -4004,6 +4183,10 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValueString, meterName, 1, UnitsString, reportingInterval, true );
 		}
 
+		if ( eso_stream && CsvOutputOpen && ! meterFileOnlyFlag ) AddCsvOutputColumn( reportID, reportingInterval, keyedValueString + meterName, UnitsString );
+
+		SetReportValueStreaming( reportID, reportingInterval, keyedValueString, meterName, UnitsString );
+
 	}
 
 	void
@@ -4101,6 +4284,8 @@ namespace OutputProcessor {
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using DataSystemVariables::BinaryOutput;
+		using DataSystemVariables::BinaryOutputOnly;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4123,6 +4308,23 @@ namespace OutputProcessor {
 
 		repVal = repValue;
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
+
+		if ( StreamReportValue( reportID, repVal ) ) return; // Streamed only
+
+		if ( BinaryOutput ) {
+			if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) {
+				WriteBinaryOutputValue( reportID, repVal, minValue, minValueDate, MaxValue, maxValueDate );
+			} else {
+				WriteBinaryOutputValue( reportID, repVal );
+			}
+			if ( BinaryOutputOnly ) { // Skip the text formatting
+				if ( sqlite ) {
+					sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
+				}
+				return;
+			}
+		}
+
 		if ( repVal == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
@@ -4152,6 +4354,8 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
 		}
 
+		if ( CsvOutputOpen ) SetCsvOutputValue( reportID, NumberOut );
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 
@@ -4210,6 +4414,8 @@ namespace OutputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string NumberOut; // Character for producing "number out"
 
+		if ( StreamReportValue( reportID, repValue ) ) return; // Streamed only
+
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
@@ -4227,6 +4433,7 @@ namespace OutputProcessor {
 		if ( ! meterOnlyFlag ) {
 			if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 			++StdOutputRecordCount;
+			if ( CsvOutputOpen ) SetCsvOutputValue( reportID, NumberOut );
 		}
 
 	}
@@ -4287,6 +4494,8 @@ namespace OutputProcessor {
 		std::string MaxOut; // Character for Max out string
 		std::string MinOut; // Character for Min out string
 
+		if ( StreamReportValue( reportID, repValue ) ) return; // Streamed only
+
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
@@ -4329,6 +4538,7 @@ namespace OutputProcessor {
 		}
 
 		if ( ! meterOnlyFlag ) {
+			if ( CsvOutputOpen ) SetCsvOutputValue( reportID, NumberOut );
 			if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 				if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 				++StdOutputRecordCount;
@@ -4411,6 +4621,8 @@ namespace OutputProcessor {
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
+		using DataSystemVariables::BinaryOutput;
+		using DataSystemVariables::BinaryOutputOnly;
 		using DataSystemVariables::ReportDuringWarmup;
 		using DataSystemVariables::UpdateDataDuringWarmupExternalInterface;
 
@@ -4431,6 +4643,18 @@ namespace OutputProcessor {
 
 		if ( UpdateDataDuringWarmupExternalInterface && ! ReportDuringWarmup ) return;
 
+		if ( StreamReportValue( reportID, repValue ) ) return; // Streamed only
+
+		if ( BinaryOutput ) {
+			WriteBinaryOutputValue( reportID, repValue );
+			if ( BinaryOutputOnly ) { // Skip the text formatting
+				if ( sqlite ) {
+					sqlite->createSQLiteReportDataRecord( reportID, repValue );
+				}
+				return;
+			}
+		}
+
 		if ( repValue == 0.0 ) {
 			std::strcpy( s, "0.0" );
 		} else {
@@ -4499,6 +4723,8 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
+		if ( CsvOutputOpen ) SetCsvOutputValue( reportID, s );
+
 		if ( eso_stream ) *eso_stream << creportID << ',' << s << NL;
 
 	}
@@ -4602,6 +4828,8 @@ namespace OutputProcessor {
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using DataSystemVariables::BinaryOutput;
+		using DataSystemVariables::BinaryOutputOnly;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4626,6 +4854,24 @@ namespace OutputProcessor {
 
 		repVal = repValue;
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
+		rminValue = minValue;
+		rmaxValue = MaxValue;
+
+		if ( StreamReportValue( reportID, repVal ) ) return; // Streamed only
+
+		if ( BinaryOutput ) {
+			if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) {
+				WriteBinaryOutputValue( reportID, repVal, rminValue, minValueDate, rmaxValue, maxValueDate );
+			} else {
+				WriteBinaryOutputValue( reportID, repVal );
+			}
+			if ( BinaryOutputOnly ) { // Skip the text formatting
+				if ( sqlite ) {
+					sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
+				}
+				return;
+			}
+		}
 		if ( repValue == 0.0 ) {
 			NumberOut = "0.0";
 		} else {
@@ -4639,12 +4885,12 @@ namespace OutputProcessor {
 		ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
 		ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
 
-		rminValue = minValue;
-		rmaxValue = MaxValue;
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
 		}
 
+		if ( CsvOutputOpen ) SetCsvOutputValue( reportID, NumberOut );
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
@@ -4684,6 +4930,8 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using DataSystemVariables::BinaryOutput;
+		using DataSystemVariables::BinaryOutputOnly;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4693,6 +4941,20 @@ namespace OutputProcessor {
 		std::string NumberOut; // Character for producing "number out"
 		Real64 repValue( 0.0 ); // for SQLite
 
+		if ( present( IntegerValue ) ) repValue = IntegerValue;
+		if ( present( RealValue ) ) repValue = RealValue;
+		if ( StreamReportValue( reportID, repValue ) ) return; // Streamed only
+
+		if ( BinaryOutput ) {
+			WriteBinaryOutputValue( reportID, repValue );
+			if ( BinaryOutputOnly ) { // Skip the text formatting
+				if ( sqlite ) {
+					sqlite->createSQLiteReportDataRecord( reportID, repValue );
+				}
+				return;
+			}
+		}
+
 		if ( present( IntegerValue ) ) {
 			gio::write( NumberOut, fmtLD ) << IntegerValue;
 			strip( NumberOut );
@@ -4712,120 +4974,664 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
+		if ( CsvOutputOpen ) SetCsvOutputValue( reportID, NumberOut );
+
 		if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
 
 	}
 
-	int
-	DetermineIndexGroupKeyFromMeterName( std::string const & meterName ) // the meter name
+	void
+	OpenBinaryOutput()
 	{
 
-		// FUNCTION INFORMATION:
-		//       AUTHOR         Greg Stark
-		//       DATE WRITTEN   May 2009
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
-		// PURPOSE OF THIS FUNCTION:
-		// This function attemps to guess determine how a meter variable should be
-		// grouped.  It does this by parsing the meter name and then assigns a
-		// indexGroupKey based on the name
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine opens the binary time-series output file (eplusout.esob) when the
+		// BinaryOutput environment variable is set.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The file holds the report variable values by report ID so they can be read back without
+		// parsing text; the variable dictionary and the time stamps stay in eplusout.eso.  After an
+		// 8 character identifier the file is a sequence of blocks, each holding
+		//   int32 report ID, int32 values per record, int32 number of records, records (float64)
+		// Each record starts with the number of time stamp records written to eplusout.eso before
+		// the value (the value belongs to the last of these), then the value and, for daily, monthly
+		// and run period reporting, the minimum, its date, the maximum and its date.  Records are
+		// buffered and written in large blocks (WriteBinaryOutputValue).
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
-
-		// Return value
-		int DetermineIndexGroupKeyFromMeterName;
-
-		// Locals
-		// FUNCTION ARGUMENT DEFINITIONS:
-
-		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int indexGroupKey( -1 );
-
-		// Facility indices are in the 100s
-		if ( has( meterName, "Electricity:Facility" ) ) {
-			indexGroupKey = 100;
-		} else if ( has( meterName, "Gas:Facility" ) ) {
-			indexGroupKey = 101;
-		} else if ( has( meterName, "DistricHeating:Facility" ) ) {
-			indexGroupKey = 102;
-		} else if ( has( meterName, "DistricCooling:Facility" ) ) {
-			indexGroupKey = 103;
-		} else if ( has( meterName, "ElectricityNet:Facility" ) ) {
-			indexGroupKey = 104;
-
-			// Building indices are in the 200s
-		} else if ( has( meterName, "Electricity:Building" ) ) {
-			indexGroupKey = 201;
-		} else if ( has( meterName, "Gas:Building" ) ) {
-			indexGroupKey = 202;
-
-			// HVAC indices are in the 300s
-		} else if ( has( meterName, "Electricity:HVAC" ) ) {
-			indexGroupKey = 301;
-
-			// InteriorLights:Electricity indices are in the 400s
-		} else if ( has( meterName, "InteriorLights:Electricity" ) ) {
-			indexGroupKey = 401;
+		// Using/Aliasing
+		using DataSystemVariables::BinaryOutput;
 
-			// InteriorLights:Electricity:Zone indices are in the 500s
-		} else if ( has( meterName, "InteriorLights:Electricity:Zone" ) ) {
-			indexGroupKey = 501;
+		if ( ! BinaryOutput ) return;
 
-			// Unknown items have negative indices
-		} else {
-			indexGroupKey = -11;
+		std::string const FileName( DataStringGlobals::outputEsoFileName + 'b' );
+		BinaryOutputFile.open( FileName, std::ios::binary | std::ios::trunc );
+		if ( ! BinaryOutputFile ) {
+			ShowFatalError( "OpenBinaryOutput: Could not open file " + FileName + " for output (write)." );
 		}
-
-		DetermineIndexGroupKeyFromMeterName = indexGroupKey;
-
-		return DetermineIndexGroupKeyFromMeterName;
+		BinaryOutputFile.write( BinaryOutputMagic, sizeof( BinaryOutputMagic ) );
+		BinaryOutputColumns.clear();
+		BinaryOutputValuesBuffered = 0;
+		BinaryOutputStampCount = 0;
 
 	}
 
-	std::string
-	DetermineIndexGroupFromMeterGroup( MeterType const & meter ) // the meter
+	static
+	std::vector< Real64 > &
+	BinaryOutputColumnValues(
+		int const reportID, // The variable's report ID
+		int const Width // Values per record
+	)
 	{
 
 		// FUNCTION INFORMATION:
-		//       AUTHOR         Greg Stark
-		//       DATE WRITTEN   May 2009
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
-		// This function attemps to determine how a meter variable should be
-		// grouped.  It does this by parsing the meter group
+		// Returns the buffer of binary output records for a report ID.
 
-		// METHODOLOGY EMPLOYED:
-		// na
+		if ( reportID >= static_cast< int >( BinaryOutputColumns.size() ) ) BinaryOutputColumns.resize( reportID + 1 );
+		BinaryOutputColumn & Column( BinaryOutputColumns[ reportID ] );
+		if ( Column.Width == 0 ) Column.Width = Width;
+		assert( Column.Width == Width ); // A report ID has one reporting interval
+		return Column.Values;
 
-		// REFERENCES:
-		// na
+	}
 
-		// USE STATEMENTS:
-		// na
+	void
+	WriteBinaryOutputValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue // The variable's value
+	)
+	{
 
-		// Return value
-		std::string indexGroup;
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-		// Locals
-		// FUNCTION ARGUMENT DEFINITIONS:
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds a timestep or hourly value to the binary output buffers.
 
-		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		if ( ! BinaryOutputFile.is_open() ) return;
 
-		if ( len( meter.Group ) > 0 ) {
-			indexGroup = meter.Group;
-		} else {
-			indexGroup = "Facility";
-		}
+		std::vector< Real64 > & Values( BinaryOutputColumnValues( reportID, 2 ) );
+		Values.push_back( BinaryOutputStampCount );
+		Values.push_back( repValue );
+		BinaryOutputValuesBuffered += 2;
+		if ( BinaryOutputValuesBuffered >= BinaryOutputBlockValues ) FlushBinaryOutput();
+
+	}
+
+	void
+	WriteBinaryOutputValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue, // The variable's value
+		Real64 const minValue, // The variable's minimum value during the reporting interval
+		int const minValueDate, // The date the minimum value occurred
+		Real64 const MaxValue, // The variable's maximum value during the reporting interval
+		int const maxValueDate // The date the maximum value occurred
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds a daily, monthly or run period value with its minimum and maximum
+		// to the binary output buffers.
+
+		if ( ! BinaryOutputFile.is_open() ) return;
+
+		std::vector< Real64 > & Values( BinaryOutputColumnValues( reportID, 6 ) );
+		Values.push_back( BinaryOutputStampCount );
+		Values.push_back( repValue );
+		Values.push_back( minValue );
+		Values.push_back( minValueDate );
+		Values.push_back( MaxValue );
+		Values.push_back( maxValueDate );
+		BinaryOutputValuesBuffered += 6;
+		if ( BinaryOutputValuesBuffered >= BinaryOutputBlockValues ) FlushBinaryOutput();
+
+	}
+
+	void
+	FlushBinaryOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the buffered binary output records, one block per report ID.
+
+		if ( ! BinaryOutputFile.is_open() ) return;
+
+		for ( int reportID = 0, e = BinaryOutputColumns.size(); reportID < e; ++reportID ) {
+			BinaryOutputColumn & Column( BinaryOutputColumns[ reportID ] );
+			if ( Column.Values.empty() ) continue;
+			std::int32_t const Header[ 3 ] = { reportID, Column.Width, static_cast< std::int32_t >( Column.Values.size() / Column.Width ) };
+			BinaryOutputFile.write( reinterpret_cast< char const * >( Header ), sizeof( Header ) );
+			BinaryOutputFile.write( reinterpret_cast< char const * >( Column.Values.data() ), Column.Values.size() * sizeof( Real64 ) );
+			Column.Values.clear();
+		}
+		BinaryOutputValuesBuffered = 0;
+
+	}
+
+	void
+	CloseBinaryOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the remaining binary output records and closes eplusout.esob.
+
+		if ( ! BinaryOutputFile.is_open() ) return;
+
+		FlushBinaryOutput();
+		BinaryOutputFile.close();
+		if ( BinaryOutputFile.fail() ) {
+			ShowWarningError( "CloseBinaryOutput: Errors writing file " + DataStringGlobals::outputEsoFileName + "b; it is incomplete." );
+		}
+		BinaryOutputColumns.clear();
+		BinaryOutputValuesBuffered = 0;
+
+	}
+
+	void
+	SetReportValueStreaming(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & keyedValue, // The key name for the data (blank for meters)
+		std::string const & variableName, // The variable's or meter's name
+		std::string const & UnitsString // The variables units
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine asks the library caller (StoreReportDictionaryCallback) whether the
+		// values of a new report variable or meter are to be streamed to it.
+
+		// Using/Aliasing
+		using DataGlobals::fReportDictionaryPtr;
+
+		if ( ! fReportDictionaryPtr || reportID < 0 ) return;
+
+		int const Streaming( fReportDictionaryPtr( reportID, reportingInterval, keyedValue, variableName, UnitsString ) );
+		if ( Streaming <= 0 ) return;
+		if ( reportID >= static_cast< int >( ReportValueStreaming.size() ) ) ReportValueStreaming.resize( reportID + 1, 0 );
+		ReportValueStreaming[ reportID ] = ( Streaming >= 2 ? 2 : 1 );
+
+	}
+
+	bool
+	StreamReportValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue // The variable's value
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function passes a reported value to the library caller if it streams the report ID,
+		// and returns true if the value is to be left out of the output files.
+
+		// Using/Aliasing
+		using DataGlobals::fReportValuePtr;
+
+		if ( reportID < 0 || reportID >= static_cast< int >( ReportValueStreaming.size() ) ) return false;
+		char const Streaming( ReportValueStreaming[ reportID ] );
+		if ( Streaming == 0 ) return false;
+		if ( fReportValuePtr ) fReportValuePtr( reportID, repValue );
+		return ( Streaming == 2 );
+
+	}
+
+	void
+	StreamReportTimeStamp(
+		int const reportingInterval, // See Module Parameter Definitons for ReportEach, ReportTimeStep, ReportHourly, etc.
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 if not defined)
+		int const DayOfMonth, // The day of the reporting interval (0 if not defined)
+		int const Hour, // The hour of the reporting interval (0 if not defined)
+		Real64 const EndMinute // The last minute in the reporting interval (0 if not defined)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine passes a reporting time stamp to the library caller.
+
+		// METHODOLOGY EMPLOYED:
+		// The same stamp is written to eplusout.eso and eplusout.mtr; it is passed on once.
+
+		// Using/Aliasing
+		using DataGlobals::fReportTimeStampPtr;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static int LastStamp[ 6 ] = { -2, 0, 0, 0, 0, 0 }; // reporting interval, environment, day of simulation, month, day, hour
+		static Real64 LastEndMinute( 0.0 );
+
+		if ( ! fReportTimeStampPtr || ReportValueStreaming.empty() ) return;
+
+		int const Stamp[ 6 ] = { reportingInterval, DataEnvironment::CurEnvirNum, DayOfSim, Month, DayOfMonth, Hour };
+		if ( std::equal( Stamp, Stamp + 6, LastStamp ) && ( EndMinute == LastEndMinute ) ) return;
+		std::copy( Stamp, Stamp + 6, LastStamp );
+		LastEndMinute = EndMinute;
+		fReportTimeStampPtr( reportingInterval, DataEnvironment::CurEnvirNum, DayOfSim, Month, DayOfMonth, Hour, EndMinute );
+
+	}
+
+	static
+	void
+	WriteCsvOutputRow( CsvOutputFileData & Csv )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds the current row of a CSV output file to its buffer, creating the file
+		// with its heading line for the first row, and writes the buffer once it is large.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char const Separator( DataSystemVariables::CsvOutputTabs ? '\t' : ',' );
+
+		if ( ! Csv.File.is_open() ) {
+			if ( DataGlobals::CompressOutput ) {
+				Csv.FileName += ".gz";
+				Csv.File.open( Csv.FileName, std::ios::trunc | std::ios::binary );
+			} else {
+				Csv.File.open( Csv.FileName, std::ios::trunc );
+			}
+			if ( ! Csv.File ) {
+				ShowFatalError( "WriteCsvOutputRow: Could not open file " + Csv.FileName + " for output (write)." );
+			}
+			if ( DataGlobals::CompressOutput ) CompressedOutput::StartCompressedOutput( &Csv.File );
+			Csv.Buffer += "Date/Time";
+			for ( std::string const & Heading : Csv.Headings ) {
+				Csv.Buffer += Separator;
+				Csv.Buffer += Heading;
+			}
+			Csv.Buffer += '\n';
+			Csv.NumColumnsWritten = Csv.Headings.size(); // Columns added later are not written
+		}
+
+		Csv.Buffer += Csv.TimeStamp;
+		for ( std::size_t Column = 0; Column < Csv.NumColumnsWritten; ++Column ) {
+			Csv.Buffer += Separator;
+			Csv.Buffer += Csv.Cells[ Column ];
+		}
+		Csv.Buffer += '\n';
+		for ( std::string & Cell : Csv.Cells ) Cell.clear();
+		Csv.RowPending = false;
+
+		if ( Csv.Buffer.size() >= CsvOutputBlockSize ) {
+			Csv.File.write( Csv.Buffer.data(), Csv.Buffer.size() );
+			Csv.Buffer.clear();
+		}
+
+	}
+
+	void
+	OpenCsvOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets up the direct CSV output files when the CsvOutput environment
+		// variable is set.
+
+		// METHODOLOGY EMPLOYED:
+		// The report variables and meters written to eplusout.eso are also written as rows, one
+		// file per reporting frequency, in the layout of the ReadVarsESO csv file: a Date/Time column
+		// and a column headed "Key:Variable [Units](Frequency)" ("Meter [Units](Frequency)" for meters)
+		// for each variable in eso dictionary order, holding the values as written to eplusout.eso.
+		// Each call and time step values share the time step file, as they share its time stamps.
+		// Each eso time stamp starts a row (StartCsvOutputRow), which is written once a later stamp
+		// of its frequency starts another.  Lines are collected and written in large blocks, and a
+		// file is only created when it has a row to write.  With CsvOutput=TSV the values are tab
+		// separated and the files are named .tab instead of .csv.  With --compress-output the files
+		// are gzip compressed (.gz, see CompressedOutput).
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::CsvOutput;
+		using DataSystemVariables::CsvOutputTabs;
+
+		if ( ! CsvOutput ) return;
+
+		std::string Stem( DataStringGlobals::outputCsvFileName );
+		if ( has_suffix( Stem, ".csv", false ) ) Stem.erase( Stem.length() - 4 );
+		for ( int File = 0; File < NumCsvOutputFiles; ++File ) {
+			CsvOutputFileData & Csv( CsvOutputFiles[ File ] );
+			Csv.FileName = Stem + CsvOutputFileSuffix[ File ] + ( CsvOutputTabs ? ".tab" : ".csv" );
+			Csv.Headings.clear();
+			Csv.NumColumnsWritten = 0;
+			Csv.Cells.clear();
+			Csv.TimeStamp.clear();
+			Csv.RowPending = false;
+			Csv.Buffer.clear();
+		}
+		CsvOutputColumns.clear();
+		CsvOutputOpen = true;
+
+	}
+
+	void
+	AddCsvOutputColumn(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & Name, // Key:Variable for report variables, the meter name for meters
+		std::string const & UnitsString // The variables units
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds the column of an eso dictionary item to the CSV output file of its
+		// reporting frequency.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const FrequencyLabels[ 6 ] = { "Each Call", "TimeStep", "Hourly", "Daily", "Monthly", "RunPeriod" };
+
+		if ( ! CsvOutputOpen || reportID < 0 ) return;
+
+		int const File( std::max( reportingInterval, ReportTimeStep ) );
+		CsvOutputFileData & Csv( CsvOutputFiles[ File ] );
+		if ( reportID >= static_cast< int >( CsvOutputColumns.size() ) ) CsvOutputColumns.resize( reportID + 1, std::make_pair( -1, 0 ) );
+		CsvOutputColumns[ reportID ] = std::make_pair( File, static_cast< int >( Csv.Headings.size() ) );
+		Csv.Headings.push_back( Name + " [" + UnitsString + "](" + FrequencyLabels[ reportingInterval - ReportEach ] + ')' );
+		Csv.Cells.emplace_back();
+
+	}
+
+	void
+	StartCsvOutputRow(
+		int const reportingInterval, // See Module Parameter Definitons for ReportEach, ReportTimeStep, ReportHourly, etc.
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 if not defined)
+		int const DayOfMonth, // The day of the reporting interval (0 if not defined)
+		int const Hour, // The hour of the reporting interval (0 if not defined)
+		Real64 const EndMinute // The last minute in the reporting interval (0 if not defined)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine starts a row of the CSV output file of a reporting frequency for an eso
+		// time stamp, writing the previous row.
+
+		// METHODOLOGY EMPLOYED:
+		// The Date/Time is written as ReadVarsESO does: " MM/DD  hh:mm:ss" for each call, time step
+		// and hourly rows, " MM/DD" for daily rows, the month name for monthly rows.  A stamp equal
+		// to the one of the current row (e.g. the zone and the system time step stamps at the end of
+		// a zone time step) continues that row.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const MonthNames[ 12 ] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char Stamp[ 32 ];
+
+		if ( ! CsvOutputOpen ) return;
+
+		CsvOutputFileData & Csv( CsvOutputFiles[ std::max( reportingInterval, ReportTimeStep ) ] );
+		if ( Csv.Headings.empty() ) return; // Nothing reported at this frequency
+
+		if ( reportingInterval <= ReportHourly ) {
+			int const Minutes( ( Hour - 1 ) * 60 + nint( EndMinute ) );
+			std::sprintf( Stamp, " %02d/%02d  %02d:%02d:00", Month, DayOfMonth, Minutes / 60, Minutes % 60 );
+		} else if ( reportingInterval == ReportDaily ) {
+			std::sprintf( Stamp, " %02d/%02d", Month, DayOfMonth );
+		} else if ( ( reportingInterval == ReportMonthly ) && ( Month >= 1 ) && ( Month <= 12 ) ) {
+			std::strcpy( Stamp, MonthNames[ Month - 1 ].c_str() );
+		} else {
+			std::strcpy( Stamp, "simulation" );
+		}
+
+		if ( Csv.RowPending ) {
+			if ( ( Csv.StampEnvironment == DataEnvironment::CurEnvirNum ) && ( Csv.StampDayOfSim == DayOfSim ) && ( Csv.TimeStamp == Stamp ) ) return; // Same row
+			WriteCsvOutputRow( Csv );
+		}
+		Csv.TimeStamp = Stamp;
+		Csv.StampEnvironment = DataEnvironment::CurEnvirNum;
+		Csv.StampDayOfSim = DayOfSim;
+
+	}
+
+	void
+	SetCsvOutputValue(
+		int const reportID, // The variable's report ID
+		std::string const & Value // The value as written to eplusout.eso
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets the value of a report ID in the current row of its CSV output file.
+
+		if ( ! CsvOutputOpen || reportID < 0 || reportID >= static_cast< int >( CsvOutputColumns.size() ) ) return;
+
+		std::pair< int, int > const & Column( CsvOutputColumns[ reportID ] );
+		if ( Column.first < 0 ) return; // Not in eplusout.eso
+		CsvOutputFileData & Csv( CsvOutputFiles[ Column.first ] );
+		Csv.Cells[ Column.second ] = Value;
+		Csv.RowPending = true;
+
+	}
+
+	void
+	CloseCsvOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the remaining CSV output rows and closes the CSV output files.
+
+		if ( ! CsvOutputOpen ) return;
+
+		for ( int File = 0; File < NumCsvOutputFiles; ++File ) {
+			CsvOutputFileData & Csv( CsvOutputFiles[ File ] );
+			if ( Csv.RowPending ) WriteCsvOutputRow( Csv );
+			if ( Csv.File.is_open() ) {
+				Csv.File.write( Csv.Buffer.data(), Csv.Buffer.size() );
+				CompressedOutput::StopCompressedOutput( &Csv.File );
+				Csv.File.close();
+				if ( Csv.File.fail() ) {
+					ShowWarningError( "CloseCsvOutput: Errors writing file " + Csv.FileName + "; it is incomplete." );
+				}
+			}
+			Csv.Headings.clear();
+			Csv.NumColumnsWritten = 0;
+			Csv.Cells.clear();
+			Csv.Buffer.clear();
+		}
+		CsvOutputColumns.clear();
+		CsvOutputOpen = false;
+
+	}
+
+	int
+	DetermineIndexGroupKeyFromMeterName( std::string const & meterName ) // the meter name
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Greg Stark
+		//       DATE WRITTEN   May 2009
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function attemps to guess determine how a meter variable should be
+		// grouped.  It does this by parsing the meter name and then assigns a
+		// indexGroupKey based on the name
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int DetermineIndexGroupKeyFromMeterName;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static int indexGroupKey( -1 );
+
+		// Facility indices are in the 100s
+		if ( has( meterName, "Electricity:Facility" ) ) {
+			indexGroupKey = 100;
+		} else if ( has( meterName, "Gas:Facility" ) ) {
+			indexGroupKey = 101;
+		} else if ( has( meterName, "DistricHeating:Facility" ) ) {
+			indexGroupKey = 102;
+		} else if ( has( meterName, "DistricCooling:Facility" ) ) {
+			indexGroupKey = 103;
+		} else if ( has( meterName, "ElectricityNet:Facility" ) ) {
+			indexGroupKey = 104;
+
+			// Building indices are in the 200s
+		} else if ( has( meterName, "Electricity:Building" ) ) {
+			indexGroupKey = 201;
+		} else if ( has( meterName, "Gas:Building" ) ) {
+			indexGroupKey = 202;
+
+			// HVAC indices are in the 300s
+		} else if ( has( meterName, "Electricity:HVAC" ) ) {
+			indexGroupKey = 301;
+
+			// InteriorLights:Electricity indices are in the 400s
+		} else if ( has( meterName, "InteriorLights:Electricity" ) ) {
+			indexGroupKey = 401;
+
+			// InteriorLights:Electricity:Zone indices are in the 500s
+		} else if ( has( meterName, "InteriorLights:Electricity:Zone" ) ) {
+			indexGroupKey = 501;
+
+			// Unknown items have negative indices
+		} else {
+			indexGroupKey = -11;
+		}
+
+		DetermineIndexGroupKeyFromMeterName = indexGroupKey;
+
+		return DetermineIndexGroupKeyFromMeterName;
+
+	}
+
+	std::string
+	DetermineIndexGroupFromMeterGroup( MeterType const & meter ) // the meter
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         Greg Stark
+		//       DATE WRITTEN   May 2009
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function attemps to determine how a meter variable should be
+		// grouped.  It does this by parsing the meter group
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		std::string indexGroup;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+
+		if ( len( meter.Group ) > 0 ) {
+			indexGroup = meter.Group;
+		} else {
+			indexGroup = "Facility";
+		}
 
 		if ( len( meter.ResourceType ) > 0 ) {
 			indexGroup += ":" + meter.ResourceType;
@@ -5456,6 +6262,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	//       DATE WRITTEN   December 1998
 	//       MODIFIED       January 2001; Resolution integrated at the Zone TimeStep intervals
 	//       MODIFIED       August 2008; Added SQL output capability
+	//       MODIFIED       Oct 2026; Meter values added through the compiled meter scatter matrix
+	//       MODIFIED       Oct 2026; Timed as a region of the timing profile
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -5510,6 +6318,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	static bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
 	Real64 rxTime; // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
 
+	DataTimings::ProfileTimer const profileTimer( "UpdateDataandReport" ); // Region of the timing profile
+
 	IndexType = IndexTypeKey;
 	if ( IndexType != ZoneTSReporting && IndexType != HVACTSReporting ) {
 		ShowFatalError( "Invalid reporting requested -- UpdateDataAndReport" );
@@ -5675,18 +6485,16 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 	if ( EndTimeStepFlag ) {
 
+		if ( ! MeterScatterCompiled || MeterScatterRowStart.size() != std::size_t( NumEnergyMeters + 1 ) || VarMeterValue.size() != std::size_t( NumVarMeterArrays + 1 ) ) CompileMeterScatter();
+
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
 			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
 				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
 				RVar >>= RVariableTypes( Loop ).VarPtr;
 				auto & rVar( RVar() );
-				// Update meters on the TimeStep  (Zone)
+				// Update meters on the TimeStep  (Zone) -- gathered here, added by ScatterMeterValues
 				if ( rVar.MeterArrayPtr != 0 ) {
-					if ( VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters <= 0 ) {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters );
-					} else {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters, VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnCustomMeters );
-					}
+					VarMeterValue[ rVar.MeterArrayPtr ] = rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult;
 				}
 				ReportNow = true;
 				if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); //SetReportNow(RVar%SchedPtr)
@@ -5763,6 +6571,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			} // Number of I Variables
 		} // Index Type (Zone or HVAC)
 
+		ScatterMeterValues();
+
 		UpdateMeters( MDHM );
 
 		ReportTSMeters( StartMinute, TimeValue( 1 ).CurMinute, TimePrint );
@@ -7631,6 +8441,129 @@ ReportingThisVariable( std::string const & RepVarName )
 
 }
 
+bool
+OutputVariablesUsed( Array1D_string const & VarNames ) // Output variable names, without units
+{
+
+	// FUNCTION INFORMATION:
+	//     AUTHOR         na
+	//     DATE WRITTEN   Oct 2026
+	//     MODIFIED       na
+	//     RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Determines whether any of the given output variables is reported or may be read by another
+	// object, so that calculations whose results nothing looks at can be skipped.
+
+	// METHODOLOGY EMPLOYED:
+	// A variable is used if it is requested for reporting, or if it is named in a field of an
+	// object that reads output variables during the run (EMS sensors, monthly and binned tables,
+	// FMU exchange).  Variables exchanged with the BCVTB are listed outside the input file, so
+	// any external interface counts as using every variable.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using InputProcessor::GetNumObjectsFound;
+	using InputProcessor::GetObjectItem;
+	using InputProcessor::SameString;
+	using namespace DataIPShortCuts;
+
+	// Return value
+	bool OutputsUsed;
+
+	// Locals
+	// FUNCTION ARGUMENT DEFINITIONS:
+
+	// FUNCTION PARAMETER DEFINITIONS:
+	static Array1D_string const ReadingObjects( 5, { "EnergyManagementSystem:Sensor", "Output:Table:Monthly", "Output:Table:TimeBins", "ExternalInterface:FunctionalMockupUnitImport:From:Variable", "ExternalInterface:FunctionalMockupUnitExport:From:Variable" } );
+
+	// FUNCTION LOCAL VARIABLE DECLARATIONS:
+	int NumAlphas; // Number of Alphas from InputProcessor
+	int NumNumbers; // Number of Numbers from InputProcessor
+	int IOStatus;
+
+	OutputsUsed = false;
+	if ( GetNumObjectsFound( "ExternalInterface" ) > 0 ) OutputsUsed = true;
+
+	for ( int VarLoop = 1, VarLoop_end = VarNames.size(); VarLoop <= VarLoop_end && ! OutputsUsed; ++VarLoop ) {
+		if ( ReportingThisVariable( VarNames( VarLoop ) ) ) OutputsUsed = true;
+	}
+
+	for ( int ObjLoop = 1, ObjLoop_end = ReadingObjects.size(); ObjLoop <= ObjLoop_end && ! OutputsUsed; ++ObjLoop ) {
+		for ( int Item = 1, Item_end = GetNumObjectsFound( ReadingObjects( ObjLoop ) ); Item <= Item_end && ! OutputsUsed; ++Item ) {
+			GetObjectItem( ReadingObjects( ObjLoop ), Item, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, IOStatus );
+			for ( int AlphaLoop = 1; AlphaLoop <= NumAlphas && ! OutputsUsed; ++AlphaLoop ) {
+				for ( int VarLoop = 1, VarLoop_end = VarNames.size(); VarLoop <= VarLoop_end; ++VarLoop ) {
+					if ( SameString( cAlphaArgs( AlphaLoop ), VarNames( VarLoop ) ) ) {
+						OutputsUsed = true;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	return OutputsUsed;
+
+}
+
+bool
+OutputVariableIsStored(
+	std::string const & KeyedValue, // Associated Key for this variable
+	std::string const & VariableName // String Name of variable (units are ignored)
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// This function reports back if SetupOutputVariable keeps (or would keep) the variable
+	// with this key and name, that is, if it is requested for output, tabular reports,
+	// custom meters or EMS sensors.  Modules can call it once after setting up their report
+	// variables and skip computing report-only quantities that nobody will read.
+
+	// METHODOLOGY EMPLOYED:
+	// Same test as SetupOutputVariable: the pre-scanned list of variables for the simulation.
+	// Variables on meters are always kept; callers must not skip anything that feeds a meter.
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using DataOutputs::FindItemInVariableList;
+
+	// Return value
+	// na
+
+	// Locals
+	// FUNCTION ARGUMENT DEFINITIONS:
+
+	// FUNCTION PARAMETER DEFINITIONS:
+	// na
+
+	// INTERFACE BLOCK SPECIFICATIONS:
+	// na
+
+	// DERIVED TYPE DEFINITIONS:
+	// na
+
+	// FUNCTION LOCAL VARIABLE DECLARATIONS:
+	std::string::size_type const Item( index( VariableName, '[' ) );
+
+	if ( Item != std::string::npos ) {
+		return FindItemInVariableList( KeyedValue, stripped( VariableName.substr( 0, Item ) ) );
+	} else {
+		return FindItemInVariableList( KeyedValue, stripped( VariableName ) );
+	}
+
+}
+
 void
 InitPollutionMeterReporting( std::string const & ReportFreqName )
 {
@@ -3,6 +3,9 @@
 
 // C++ Headers
 #include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -119,6 +122,10 @@ namespace OutputProcessor {
 
 	extern int NumEnergyMeters; // Current number of Energy Meters
 	extern Array1D< Real64 > MeterValue; // This holds the current timestep value for each meter.
+	extern bool MeterScatterCompiled; // True when the variable to meter scatter matrix matches VarMeterArrays
+	extern std::vector< int > MeterScatterRowStart; // Start of each meter's row in MeterScatterVarMeter (0-based, NumEnergyMeters+1)
+	extern std::vector< int > MeterScatterVarMeter; // VarMeterArrays index of each variable contributing to a meter
+	extern std::vector< Real64 > VarMeterValue; // Time step value of each metered variable, by VarMeterArrays index
 
 	extern int TimeStepStampReportNbr; // TimeStep and Hourly Report number
 	extern std::string TimeStepStampReportChr; // TimeStep and Hourly Report number (character -- for printing)
@@ -529,6 +536,18 @@ namespace OutputProcessor {
 
 	};
 
+	struct ReqReportVariablesIndex // Requested Report Variables for one variable name
+	{
+		// Members
+		std::vector< int > AllKeys; // ReqRepVars indices of requests for all keys (blank or "*")
+		std::unordered_map< std::string, std::vector< int > > Keys; // ReqRepVars indices of requests for each (uppercase) key
+
+		// Default Constructor
+		ReqReportVariablesIndex()
+		{}
+
+	};
+
 	struct MeterArrayType
 	{
 		// Members
@@ -897,6 +916,7 @@ namespace OutputProcessor {
 	extern Reference< RealVariables > RVar;
 	extern Reference< IntegerVariables > IVar;
 	extern Array1D< ReqReportVariables > ReqRepVars;
+	extern std::unordered_map< std::string, ReqReportVariablesIndex > ReqRepVarsIndex; // Requests for each (uppercase) variable name
 	extern Array1D< MeterArrayType > VarMeterArrays;
 	extern Array1D< MeterType > EnergyMeters;
 	extern Array1D< EndUseCategoryType > EndUseCategory;
@@ -919,19 +939,10 @@ namespace OutputProcessor {
 	);
 
 	void
-	BuildKeyVarList(
-		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	);
+	BuildKeyVarList( std::vector< int > const & Requests ); // ReqRepVars indices matching this key and variable
 
 	void
-	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	);
+	AddBlankKeys( std::vector< int > const & Requests ); // ReqRepVars indices of this variable for all keys
 
 	void
 	GetReportVariableInput();
@@ -1076,6 +1087,12 @@ namespace OutputProcessor {
 		Optional< Array1S_int const > OnCustomMeters = _ // Which custom meters this variable is on (index values)
 	);
 
+	void
+	CompileMeterScatter();
+
+	void
+	ScatterMeterValues();
+
 	void
 	UpdateMeters( int const TimeStamp ); // Current TimeStamp (for max/min)
 
@@ -1249,6 +1266,86 @@ namespace OutputProcessor {
 		Optional< Real64 const > RealValue = _ // the value of the data
 	);
 
+	void
+	OpenBinaryOutput();
+
+	void
+	WriteBinaryOutputValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue // The variable's value
+	);
+
+	void
+	WriteBinaryOutputValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue, // The variable's value
+		Real64 const minValue, // The variable's minimum value during the reporting interval
+		int const minValueDate, // The date the minimum value occurred
+		Real64 const MaxValue, // The variable's maximum value during the reporting interval
+		int const maxValueDate // The date the maximum value occurred
+	);
+
+	void
+	FlushBinaryOutput();
+
+	void
+	CloseBinaryOutput();
+
+	void
+	OpenCsvOutput();
+
+	void
+	AddCsvOutputColumn(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & Name, // Key:Variable for report variables, the meter name for meters
+		std::string const & UnitsString // The variables units
+	);
+
+	void
+	StartCsvOutputRow(
+		int const reportingInterval, // See Module Parameter Definitons for ReportEach, ReportTimeStep, ReportHourly, etc.
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 if not defined)
+		int const DayOfMonth, // The day of the reporting interval (0 if not defined)
+		int const Hour, // The hour of the reporting interval (0 if not defined)
+		Real64 const EndMinute // The last minute in the reporting interval (0 if not defined)
+	);
+
+	void
+	SetCsvOutputValue(
+		int const reportID, // The variable's report ID
+		std::string const & Value // The value as written to eplusout.eso
+	);
+
+	void
+	CloseCsvOutput();
+
+	void
+	SetReportValueStreaming(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & keyedValue, // The key name for the data (blank for meters)
+		std::string const & variableName, // The variable's or meter's name
+		std::string const & UnitsString // The variables units
+	);
+
+	bool
+	StreamReportValue(
+		int const reportID, // The variable's report ID
+		Real64 const repValue // The variable's value
+	);
+
+	void
+	StreamReportTimeStamp(
+		int const reportingInterval, // See Module Parameter Definitons for ReportEach, ReportTimeStep, ReportHourly, etc.
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 if not defined)
+		int const DayOfMonth, // The day of the reporting interval (0 if not defined)
+		int const Hour, // The hour of the reporting interval (0 if not defined)
+		Real64 const EndMinute // The last minute in the reporting interval (0 if not defined)
+	);
+
 	int
 	DetermineIndexGroupKeyFromMeterName( std::string const & meterName ); // the meter name
 
@@ -1413,6 +1510,15 @@ GetVariableKeys(
 bool
 ReportingThisVariable( std::string const & RepVarName );
 
+bool
+OutputVariablesUsed( Array1D_string const & VarNames ); // Output variable names, without units
+
+bool
+OutputVariableIsStored(
+	std::string const & KeyedValue, // Associated Key for this variable
+	std::string const & VariableName // String Name of variable (units are ignored)
+);
+
 void
 InitPollutionMeterReporting( std::string const & ReportFreqName );
 
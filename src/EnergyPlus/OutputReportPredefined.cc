@@ -5,6 +5,7 @@
 // EnergyPlus Headers
 #include <OutputReportPredefined.hh>
 #include <DataPrecisionGlobals.hh>
+#include <InputProcessor.hh>
 
 namespace EnergyPlus {
 
@@ -656,6 +657,7 @@ namespace OutputReportPredefined {
 	Array1D< ColumnTagType > columnTag;
 	Array1D< TableEntryType > tableEntry;
 	Array1D< CompSizeTableEntryType > CompSizeTableEntry;
+	std::unordered_map< CompSizeTableKey, int, CompSizeTableKeyHash > CompSizeTableEntryIndex; // CompSizeTableEntry index of each type, name and description
 	Array1D< ShadowRelateType > ShadowRelate;
 
 	// Functions
@@ -1463,7 +1465,7 @@ namespace OutputReportPredefined {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, keep the value and format it when written
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1471,7 +1473,8 @@ namespace OutputReportPredefined {
 		//   is a real variable
 
 		// METHODOLOGY EMPLOYED:
-		//   Simple assignments to public variables.
+		//   Simple assignments to public variables.  The value is
+		//   kept as a number and formatted by TableEntryString.
 
 		// REFERENCES:
 		// na
@@ -1482,7 +1485,7 @@ namespace OutputReportPredefined {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static gio::Fmt fmtI1( "(I1)" );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1492,10 +1495,6 @@ namespace OutputReportPredefined {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int sigDigitCount;
-		std::string digitString;
-		std::string formatConvert;
-		std::string stringEntry;
-		int IOS;
 
 		incrementTableEntry();
 		//check for number of significant digits
@@ -1508,17 +1507,8 @@ namespace OutputReportPredefined {
 		} else {
 			sigDigitCount = 2;
 		}
-		// convert the integer to a string for the number of digits
-		gio::write( digitString, fmtI1 ) << sigDigitCount;
-		// build up the format string
-		if ( tableEntryReal < 1e10 ) {
-			formatConvert = "(F12." + digitString + ')';
-		} else {
-			formatConvert = "(E12." + digitString + ')';
-		}
-		{ IOFlags flags; gio::write( stringEntry, formatConvert, flags ) << tableEntryReal; IOS = flags.ios(); }
-		if ( IOS != 0 ) stringEntry = "  Too Big";
-		tableEntry( numTableEntry ).charEntry = stringEntry;
+		// the text of the entry is only formatted when the tables are written
+		tableEntry( numTableEntry ).charEntry.clear();
 		tableEntry( numTableEntry ).objectName = objName;
 		tableEntry( numTableEntry ).indexColumn = columnIndex;
 		tableEntry( numTableEntry ).origRealEntry = tableEntryReal;
@@ -1581,7 +1571,7 @@ namespace OutputReportPredefined {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, keep the value and format it when written
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1589,7 +1579,8 @@ namespace OutputReportPredefined {
 		//   is a integer variable
 
 		// METHODOLOGY EMPLOYED:
-		//   Simple assignments to public variables.
+		//   Simple assignments to public variables.  The value is
+		//   kept as a number and formatted by TableEntryString.
 
 		// REFERENCES:
 		// na
@@ -1600,7 +1591,7 @@ namespace OutputReportPredefined {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static gio::Fmt fmtLD( "*" );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1609,14 +1600,15 @@ namespace OutputReportPredefined {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		std::string stringEntry;
+		// na
 
 		incrementTableEntry();
-		// convert the integer to a string
-		gio::write( stringEntry, fmtLD ) << tableEntryInt;
-		tableEntry( numTableEntry ).charEntry = stringEntry;
+		// the text of the entry is only formatted when the tables are written
+		tableEntry( numTableEntry ).charEntry.clear();
 		tableEntry( numTableEntry ).objectName = objName;
 		tableEntry( numTableEntry ).indexColumn = columnIndex;
+		tableEntry( numTableEntry ).origIntEntry = tableEntryInt;
+		tableEntry( numTableEntry ).origEntryIsInt = true;
 	}
 
 	void
@@ -1665,6 +1657,54 @@ namespace OutputReportPredefined {
 		}
 	}
 
+	std::string const &
+	TableEntryString( int const iEntry )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		//   Returns the text of a table entry.
+
+		// METHODOLOGY EMPLOYED:
+		//   Real and integer entries are stored as numbers and only
+		//   formatted here, the first time their text is needed, with
+		//   the formats PreDefTableEntry used to apply when the entry
+		//   was made.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static gio::Fmt fmtI1( "(I1)" );
+		static gio::Fmt fmtLD( "*" );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string digitString;
+		std::string formatConvert;
+		int IOS;
+
+		TableEntryType & entry( tableEntry( iEntry ) );
+		if ( entry.charEntry.empty() ) {
+			if ( entry.origEntryIsReal ) {
+				// convert the integer to a string for the number of digits
+				gio::write( digitString, fmtI1 ) << entry.significantDigits;
+				// build up the format string
+				if ( entry.origRealEntry < 1e10 ) {
+					formatConvert = "(F12." + digitString + ')';
+				} else {
+					formatConvert = "(E12." + digitString + ')';
+				}
+				{ IOFlags flags; gio::write( entry.charEntry, formatConvert, flags ) << entry.origRealEntry; IOS = flags.ios(); }
+				if ( IOS != 0 ) entry.charEntry = "  Too Big";
+			} else if ( entry.origEntryIsInt ) {
+				// convert the integer to a string
+				gio::write( entry.charEntry, fmtLD ) << entry.origIntEntry;
+			}
+		}
+		return entry.charEntry;
+	}
+
 	void
 	AddCompSizeTableEntry(
 		std::string const & FieldType,
@@ -1676,20 +1716,26 @@ namespace OutputReportPredefined {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   July 2007
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, one entry per component type, name and description
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		//   Creates an entry for component size tables.
 
 		// METHODOLOGY EMPLOYED:
-		//   Simple assignments to public variables.
+		//   Simple assignments to public variables.  A component that is sized again (for example in
+		//   the HVAC sizing simulations) updates the value of its existing entry.  WriteComponentSizing
+		//   puts all entries with the same type, name and description (compared without regard to case)
+		//   in one table cell holding the last value, so the tables are unchanged by this.
 
 		// REFERENCES:
 		// na
 
 		// USE STATEMENTS:
 
+		// Using/Aliasing
+		using InputProcessor::InternName;
+
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -1703,12 +1749,19 @@ namespace OutputReportPredefined {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		CompSizeTableKey const Key{ InternName( FieldType ), InternName( FieldName ), InternName( FieldDescription ) };
 
 		if ( ! allocated( CompSizeTableEntry ) ) {
 			CompSizeTableEntry.allocate( sizeIncrement );
 			sizeCompSizeTableEntry = sizeIncrement;
 			numCompSizeTableEntry = 1;
+			CompSizeTableEntryIndex.clear();
 		} else {
+			auto const Found( CompSizeTableEntryIndex.find( Key ) );
+			if ( Found != CompSizeTableEntryIndex.end() ) {
+				CompSizeTableEntry( Found->second ).valField = FieldValue;
+				return;
+			}
 			++numCompSizeTableEntry;
 			// if larger than current size grow the array
 			if ( numCompSizeTableEntry > sizeCompSizeTableEntry ) {
@@ -1719,6 +1772,7 @@ namespace OutputReportPredefined {
 		CompSizeTableEntry( numCompSizeTableEntry ).nameField = FieldName;
 		CompSizeTableEntry( numCompSizeTableEntry ).description = FieldDescription;
 		CompSizeTableEntry( numCompSizeTableEntry ).valField = FieldValue;
+		CompSizeTableEntryIndex.emplace( Key, numCompSizeTableEntry );
 	}
 
 	void
@@ -1,6 +1,10 @@
 #ifndef OutputReportPredefined_hh_INCLUDED
 #define OutputReportPredefined_hh_INCLUDED
 
+// C++ Headers
+#include <cstddef>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -721,7 +725,7 @@ namespace OutputReportPredefined {
 	struct TableEntryType
 	{
 		// Members
-		std::string charEntry;
+		std::string charEntry; // Text of the entry; for a numeric entry, empty until TableEntryString formats it
 		std::string objectName;
 		int indexColumn;
 		int subTableIndex;
@@ -729,6 +733,8 @@ namespace OutputReportPredefined {
 		Real64 origRealEntry;
 		int significantDigits;
 		bool origEntryIsReal;
+		int origIntEntry;
+		bool origEntryIsInt;
 
 		// Default Constructor
 		TableEntryType() :
@@ -737,7 +743,9 @@ namespace OutputReportPredefined {
 			uniqueObjName( 0 ),
 			origRealEntry( 0.0 ),
 			significantDigits( 0 ),
-			origEntryIsReal( false )
+			origEntryIsReal( false ),
+			origIntEntry( 0 ),
+			origEntryIsInt( false )
 		{}
 
 		// Member Constructor
@@ -749,7 +757,9 @@ namespace OutputReportPredefined {
 			int const uniqueObjName,
 			Real64 const origRealEntry,
 			int const significantDigits,
-			bool const origEntryIsReal
+			bool const origEntryIsReal,
+			int const origIntEntry = 0,
+			bool const origEntryIsInt = false
 		) :
 			charEntry( charEntry ),
 			objectName( objectName ),
@@ -758,7 +768,9 @@ namespace OutputReportPredefined {
 			uniqueObjName( uniqueObjName ),
 			origRealEntry( origRealEntry ),
 			significantDigits( significantDigits ),
-			origEntryIsReal( origEntryIsReal )
+			origEntryIsReal( origEntryIsReal ),
+			origIntEntry( origIntEntry ),
+			origEntryIsInt( origEntryIsInt )
 		{}
 
 	};
@@ -799,6 +811,31 @@ namespace OutputReportPredefined {
 
 	};
 
+	struct CompSizeTableKey // Interned component type, name and description of a component size table entry
+	{
+		// Members
+		int typeID;
+		int nameID;
+		int descriptionID;
+
+		bool
+		operator ==( CompSizeTableKey const & other ) const
+		{
+			return ( typeID == other.typeID ) && ( nameID == other.nameID ) && ( descriptionID == other.descriptionID );
+		}
+
+	};
+
+	struct CompSizeTableKeyHash
+	{
+		std::size_t
+		operator ()( CompSizeTableKey const & key ) const
+		{
+			return ( static_cast< std::size_t >( key.typeID ) * 1000003u + static_cast< std::size_t >( key.nameID ) ) * 1000003u + static_cast< std::size_t >( key.descriptionID );
+		}
+
+	};
+
 	struct ShadowRelateType
 	{
 		// Members
@@ -834,6 +871,7 @@ namespace OutputReportPredefined {
 	extern Array1D< ColumnTagType > columnTag;
 	extern Array1D< TableEntryType > tableEntry;
 	extern Array1D< CompSizeTableEntryType > CompSizeTableEntry;
+	extern std::unordered_map< CompSizeTableKey, int, CompSizeTableKeyHash > CompSizeTableEntryIndex; // CompSizeTableEntry index of each type, name and description
 	extern Array1D< ShadowRelateType > ShadowRelate;
 
 	// Functions
@@ -866,6 +904,9 @@ namespace OutputReportPredefined {
 	void
 	incrementTableEntry();
 
+	std::string const &
+	TableEntryString( int const iEntry );
+
 	void
 	AddCompSizeTableEntry(
 		std::string const & FieldType,
@@ -17,6 +17,7 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <OutputReportTabular.hh>
+#include <AsyncOutput.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataCostEstimate.hh>
 #include <DataEnvironment.hh>
@@ -31,6 +32,8 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
@@ -407,6 +410,10 @@ namespace OutputReportTabular {
 	Array1D< MonthlyColumnsType > MonthlyColumns;
 	Array1D< TOCEntriesType > TOCEntries;
 	Array1D< UnitConvType > UnitConv;
+	Array1D< GatherFieldType > MonthlyColumnsField; // value of each monthly column
+	Array1D< GatherFieldType > BinObjField; // value of each binned table
+	std::vector< MonthlySumFieldType > MonthlySumFieldsZone; // sum or average columns of zone time step variables
+	std::vector< MonthlySumFieldType > MonthlySumFieldsHVAC; // sum or average columns of system time step variables
 
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
@@ -461,6 +468,7 @@ namespace OutputReportTabular {
 			GetInputTabularPredefined();
 			// noel -- noticed this was called once and very slow -- sped up a little by caching keys
 			InitializeTabularMonthly();
+			CompileTabularGatherFields();
 			GetInputFuelAndPollutionFactors();
 			SetupUnitConversions();
 			AddTOCZoneLoadComponentTable();
@@ -543,6 +551,8 @@ namespace OutputReportTabular {
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
+		DataTimings::ProfileTimer const profileTimer( "GetInputTabularMonthly" ); // Region of the timing profile
+
 		MonthlyInputCount = GetNumObjectsFound( CurrentModuleObject );
 		if ( MonthlyInputCount > 0 ) {
 			WriteTabularFiles = true;
@@ -1161,6 +1171,112 @@ namespace OutputReportTabular {
 		//#endif
 	}
 
+	void
+	CompileTabularGatherFields()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Resolves once what the gather routines would otherwise look up each
+		//   time step: the report variable each monthly column and binned table
+		//   reads, and the list of sum or average columns for each time step type.
+
+		// METHODOLOGY EMPLOYED:
+		//   Sum or average columns do not interact with the other columns of their
+		//   table (unlike the maximum, minimum and hours columns, which drive the
+		//   value-when and during-hours-shown columns that follow them), so they
+		//   are gathered in a separate flat loop.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iCol;
+		int iInObj;
+		int jTable;
+		int repIndex;
+		MonthlySumFieldType sumField;
+
+		MonthlyColumnsField.allocate( MonthlyColumnsCount );
+		MonthlySumFieldsZone.clear();
+		MonthlySumFieldsHVAC.clear();
+		for ( iCol = 1; iCol <= MonthlyColumnsCount; ++iCol ) {
+			BindGatherField( MonthlyColumnsField( iCol ), MonthlyColumns( iCol ).typeOfVar, MonthlyColumns( iCol ).varNum );
+			if ( MonthlyColumns( iCol ).aggType != aggTypeSumOrAvg ) continue;
+			sumField.value = MonthlyColumnsField( iCol );
+			sumField.column = iCol;
+			sumField.isSum = ( MonthlyColumns( iCol ).avgSum == isSum );
+			if ( MonthlyColumns( iCol ).stepType == stepTypeZone ) {
+				MonthlySumFieldsZone.push_back( sumField );
+			} else if ( MonthlyColumns( iCol ).stepType == stepTypeHVAC ) {
+				MonthlySumFieldsHVAC.push_back( sumField );
+			}
+		}
+
+		BinObjField.allocate( BinResultsTableCount );
+		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			for ( jTable = 1; jTable <= OutputTableBinned( iInObj ).numTables; ++jTable ) {
+				repIndex = OutputTableBinned( iInObj ).resIndex + ( jTable - 1 );
+				BindGatherField( BinObjField( repIndex ), OutputTableBinned( iInObj ).typeOfVar, BinObjVarID( repIndex ).varMeterNum );
+			}
+		}
+	}
+
+	void
+	BindGatherField(
+		GatherFieldType & field,
+		int const typeOfVar, // 0=not found, 1=integer, 2=real, 3=meter, 4=schedule
+		int const varNum // variable, meter or schedule number
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Binds a field to the real or integer variable behind a report variable.
+		//   Meters, schedules and anything out of range are left unbound and read
+		//   through GetInternalVariableValue.
+
+		// Using/Aliasing
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::IVariableTypes;
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::NumOfIVariable;
+
+		field.realValue = nullptr;
+		field.intValue = nullptr;
+		field.typeOfVar = typeOfVar;
+		field.varNum = varNum;
+		if ( varNum < 1 ) return;
+		if ( typeOfVar == 2 && varNum <= NumOfRVariable ) {
+			// the variable itself, as GetInternalVariableValue uses Which rather than Value
+			field.realValue = &RVariableTypes( varNum ).VarPtr().Which();
+		} else if ( typeOfVar == 1 && varNum <= NumOfIVariable ) {
+			field.intValue = &IVariableTypes( varNum ).VarPtr().Which();
+		}
+	}
+
+	Real64
+	GatherFieldValue( GatherFieldType const & field )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		//   Returns the current value of a field bound by BindGatherField.
+
+		if ( field.realValue != nullptr ) return *field.realValue;
+		if ( field.intValue != nullptr ) return double( *field.intValue );
+		return GetInternalVariableValue( field.typeOfVar, field.varNum );
+	}
+
 	void
 	GetInputTabularTimeBins()
 	{
@@ -3028,7 +3144,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   July 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, writer thread for each style with WriteOutputAsync
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3173,6 +3289,7 @@ namespace OutputReportTabular {
 					}
 					tbl_stream << '\n';
 				}
+				if ( DataSystemVariables::WriteOutputAsync ) AsyncOutput::StartAsyncOutput( TabularOutputFile( iStyle ) );
 			}
 		}
 	}
@@ -3183,7 +3300,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   July 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, stop the writer threads before closing
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3227,6 +3344,7 @@ namespace OutputReportTabular {
 					}
 					tbl_stream << "</EnergyPlusTabularReports>\n";
 				}
+				AsyncOutput::StopAsyncOutput( &tbl_stream );
 				tbl_stream.close();
 			}
 		}
@@ -3389,7 +3507,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, read values through the fields bound in CompileTabularGatherFields
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3423,7 +3541,6 @@ namespace OutputReportTabular {
 		int curIntervalCount;
 		int curResIndex;
 		int curNumTables;
-		int curTypeOfVar;
 		int curScheduleIndex;
 		Real64 elapsedTime;
 		bool gatherThisTime;
@@ -3437,7 +3554,15 @@ namespace OutputReportTabular {
 		if ( ! DoWeathSim ) return;
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
+		// per MJW when a summed variable is used divide it by the length of the time step
+		if ( IndexTypeKey == HVACTSReporting ) {
+			elapsedTime = TimeStepSys;
+		} else {
+			elapsedTime = TimeStepZone;
+		}
 		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			curStepType = OutputTableBinned( iInObj ).stepType;
+			if ( ! ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) ) continue;
 			// get values of array for current object being referenced
 			curIntervalStart = OutputTableBinned( iInObj ).intervalStart;
 			curIntervalSize = OutputTableBinned( iInObj ).intervalSize;
@@ -3445,8 +3570,6 @@ namespace OutputReportTabular {
 			curResIndex = OutputTableBinned( iInObj ).resIndex;
 			curNumTables = OutputTableBinned( iInObj ).numTables;
 			topValue = curIntervalStart + curIntervalSize * curIntervalCount;
-			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
-			curStepType = OutputTableBinned( iInObj ).stepType;
 			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
 			//if a schedule was used, check if it was non-zero value
 			if ( curScheduleIndex != 0 ) {
@@ -3461,42 +3584,34 @@ namespace OutputReportTabular {
 			if ( gatherThisTime ) {
 				for ( jTable = 1; jTable <= curNumTables; ++jTable ) {
 					repIndex = curResIndex + ( jTable - 1 );
-					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-						// put actual value from OutputProcesser arrays
-						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( IndexTypeKey == HVACTSReporting ) {
-							elapsedTime = TimeStepSys;
-						} else {
-							elapsedTime = TimeStepZone;
-						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
-							BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
-						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
-						}
+					// put actual value from OutputProcesser arrays
+					curValue = GatherFieldValue( BinObjField( repIndex ) );
+					if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
+						curValue /= ( elapsedTime * SecInHour );
+					}
+					// check if the value is above the maximum or below the minimum value
+					// first before binning the value within the range.
+					if ( curValue < curIntervalStart ) {
+						BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else if ( curValue >= topValue ) {
+						BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+						BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
+					} else {
+						// determine which bin the results are in
+						binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
+						BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
+						BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
+					}
+					// add to statistics array
+					++BinStatistics( repIndex ).n;
+					BinStatistics( repIndex ).sum += curValue;
+					BinStatistics( repIndex ).sum2 += curValue * curValue;
+					if ( curValue < BinStatistics( repIndex ).minimum ) {
+						BinStatistics( repIndex ).minimum = curValue;
+					}
+					if ( curValue > BinStatistics( repIndex ).maximum ) {
+						BinStatistics( repIndex ).maximum = curValue;
 					}
 				}
 			}
@@ -3509,13 +3624,18 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, read values through the fields bound in CompileTabularGatherFields
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		//   Gathers the data each timestep and updates the arrays
 		//   holding the data that will be reported later.
 
+		// METHODOLOGY EMPLOYED:
+		//   The sum or average columns are gathered first in one flat loop
+		//   (see CompileTabularGatherFields), the other columns in the table
+		//   by table loop since they depend on the columns before them.
+
 		// Using/Aliasing
 		using DataHVACGlobals::TimeStepSys;
 		using DataEnvironment::Month;
@@ -3540,8 +3660,6 @@ namespace OutputReportTabular {
 		int jColumn; // loop variable for monthlyColumns
 		int curCol;
 		Real64 curValue;
-		int curTypeOfVar;
-		int curVarNum;
 		Real64 elapsedTime;
 		Real64 oldResultValue;
 		int oldTimeStamp;
@@ -3559,16 +3677,12 @@ namespace OutputReportTabular {
 		int kOtherColumn; // variable used in loop to scan through additional columns
 		int scanColumn;
 		Real64 scanValue;
-		int scanTypeOfVar;
-		int scanVarNum;
 		Real64 oldScanValue;
 		// local copies of some of the MonthlyColumns array references since
 		// profiling showed that they were slow.
 		static bool RunOnce( true );
-		static Array1D_int MonthlyColumnsTypeOfVar;
 		static Array1D_int MonthlyColumnsStepType;
 		static Array1D_int MonthlyColumnsAggType;
-		static Array1D_int MonthlyColumnsVarNum;
 		static Array1D_int MonthlyTablesNumColumns;
 		static int curFirstColumn( 0 );
 
@@ -3577,10 +3691,8 @@ namespace OutputReportTabular {
 		//create temporary arrays to speed processing of these arrays
 		if ( RunOnce ) {
 			//MonthlyColumns
-			MonthlyColumnsTypeOfVar = MonthlyColumns.typeOfVar();
 			MonthlyColumnsStepType = MonthlyColumns.stepType();
 			MonthlyColumnsAggType = MonthlyColumns.aggType();
-			MonthlyColumnsVarNum = MonthlyColumns.varNum();
 			//MonthlyTables
 			MonthlyTablesNumColumns = MonthlyTables.numColumns();
 
@@ -3595,19 +3707,37 @@ namespace OutputReportTabular {
 			elapsedTime = TimeStepZone;
 		}
 		IsMonthGathered( Month ) = true;
+		// the current timestamp
+		minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+		//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
+		//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
+		//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
+		EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
+		// sum or average columns
+		for ( auto const & sumField : ( IndexTypeKey == HVACTSReporting ) ? MonthlySumFieldsHVAC : MonthlySumFieldsZone ) {
+			curValue = GatherFieldValue( sumField.value );
+			auto & sumColumn( MonthlyColumns( sumField.column ) );
+			if ( sumField.isSum ) { // if it is a summed variable
+				sumColumn.reslt( Month ) += curValue;
+			} else {
+				sumColumn.reslt( Month ) += curValue * elapsedTime; //for averaging - weight by elapsed time
+			}
+			sumColumn.timeStamp( Month ) = 0;
+			sumColumn.duration( Month ) += elapsedTime;
+		}
 		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
 			activeMinMax = false; //at the beginning of the new timestep
 			activeHoursShown = false; //fix by JG addressing CR6482
 			curFirstColumn = MonthlyTables( iTable ).firstColumn;
 			for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
 				curCol = jColumn + curFirstColumn - 1;
-				curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
+				// sum or average columns were gathered above, and leave the scans below unchanged
+				if ( MonthlyColumnsAggType( curCol ) == aggTypeSumOrAvg ) continue;
 				curStepType = MonthlyColumnsStepType( curCol );
 				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
 					//  the above condition used to include the following prior to new scan method
 					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-					curVarNum = MonthlyColumnsVarNum( curCol );
-					curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
+					curValue = GatherFieldValue( MonthlyColumnsField( curCol ) );
 					// Get the value from the result array
 					oldResultValue = MonthlyColumns( curCol ).reslt( Month );
 					oldTimeStamp = MonthlyColumns( curCol ).timeStamp( Month );
@@ -3617,24 +3747,10 @@ namespace OutputReportTabular {
 					newTimeStamp = 0;
 					newDuration = 0.0;
 					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
 					// perform the selected aggregation type
 					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
 					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
-					if ( SELECT_CASE_var == aggTypeSumOrAvg ) {
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							newResultValue = oldResultValue + curValue;
-						} else {
-							newResultValue = oldResultValue + curValue * elapsedTime; //for averaging - weight by elapsed time
-						}
-						newDuration = oldDuration + elapsedTime;
-						activeNewValue = true;
-					} else if ( SELECT_CASE_var == aggTypeMaximum ) {
+					if ( SELECT_CASE_var == aggTypeMaximum ) {
 						// per MJW when a summed variable is used divide it by the length of the time step
 						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
 							if ( IndexTypeKey == HVACTSReporting ) {
@@ -3744,9 +3860,7 @@ namespace OutputReportTabular {
 								break; //do
 							} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
 								// this case is when the value should be set
-								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-								scanVarNum = MonthlyColumns( scanColumn ).varNum;
-								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+								scanValue = GatherFieldValue( MonthlyColumnsField( scanColumn ) );
 								// When a summed variable is used divide it by the length of the time step
 								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
 									if ( IndexTypeKey == HVACTSReporting ) {
@@ -3766,9 +3880,7 @@ namespace OutputReportTabular {
 					if ( activeHoursShown ) {
 						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
 							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-							scanVarNum = MonthlyColumns( scanColumn ).varNum;
-							scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+							scanValue = GatherFieldValue( MonthlyColumnsField( scanColumn ) );
 							oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
 							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
 							if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
@@ -4757,7 +4869,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, release the predefined entries once written
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4765,6 +4877,13 @@ namespace OutputReportTabular {
 		//   types of tabular reports are each created. If another type of
 		//   report is added it can be added to the list here.
 
+		// METHODOLOGY EMPLOYED:
+		//   The predefined, component sizing and shadowing entries are released
+		//   as soon as their tables are written since nothing reads them later.
+		//   With WriteOutputAsync each tabular file has its own writer thread
+		//   (see OpenOutputTabularFile), so the tables go to disk while the
+		//   following ones are formatted.
+
 		// Locals
 		int EchoInputFile; // found unit number for 'eplusout.audit'
 
@@ -4778,8 +4897,11 @@ namespace OutputReportTabular {
 			WriteDemandEndUseSummary();
 			WriteSourceEnergyEndUseSummary();
 			WritePredefinedTables();
+			tableEntry.deallocate();
 			WriteComponentSizing();
+			CompSizeTableEntry.deallocate();
 			WriteSurfaceShadowing();
+			ShadowRelate.deallocate();
 			WriteCompCostTable();
 			WriteAdaptiveComfortTable();
 			WriteZoneLoadComponentTable();
@@ -9909,7 +10031,7 @@ namespace OutputReportTabular {
 									columnUnitConv = colUnitConv( colCurrent );
 									if ( SameString( subTable( jSubTable ).name, "SizingPeriod:DesignDay" ) ) {
 										if ( SameString( columnHead( colCurrent ), "Humidity Value" ) ) {
-											LookupSItoIP( tableEntry( lTableEntry + 1 ).charEntry, columnUnitConv, repTableTag );
+											LookupSItoIP( TableEntryString( lTableEntry + 1 ), columnUnitConv, repTableTag );
 											tableEntry( lTableEntry + 1 ).charEntry = repTableTag;
 										}
 									}
@@ -9917,10 +10039,10 @@ namespace OutputReportTabular {
 										IPvalue = ConvertIP( columnUnitConv, tableEntry( lTableEntry ).origRealEntry );
 										tableBody( colCurrent, rowCurrent ) = RealToStr( IPvalue, tableEntry( lTableEntry ).significantDigits );
 									} else {
-										tableBody( colCurrent, rowCurrent ) = tableEntry( lTableEntry ).charEntry;
+										tableBody( colCurrent, rowCurrent ) = TableEntryString( lTableEntry );
 									}
 								} else {
-									tableBody( colCurrent, rowCurrent ) = tableEntry( lTableEntry ).charEntry;
+									tableBody( colCurrent, rowCurrent ) = TableEntryString( lTableEntry );
 								}
 							}
 						}
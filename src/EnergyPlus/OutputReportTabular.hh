@@ -4,6 +4,7 @@
 // C++ Headers
 #include <fstream>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -647,6 +648,39 @@ namespace OutputReportTabular {
 
 	};
 
+	struct GatherFieldType
+	{
+		// Members
+		Real64 const * realValue; // real report variable read by the field (null if not bound)
+		int const * intValue; // integer report variable read by the field (null if not bound)
+		int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter, 4=schedule
+		int varNum; // variable, meter or schedule number
+
+		// Default Constructor
+		GatherFieldType() :
+			realValue( nullptr ),
+			intValue( nullptr ),
+			typeOfVar( 0 ),
+			varNum( 0 )
+		{}
+
+	};
+
+	struct MonthlySumFieldType
+	{
+		// Members
+		GatherFieldType value; // value of the column
+		int column; // index into MonthlyColumns
+		bool isSum; // summed variable (otherwise averaged and weighted by the time step)
+
+		// Default Constructor
+		MonthlySumFieldType() :
+			column( 0 ),
+			isSum( false )
+		{}
+
+	};
+
 	struct TOCEntriesType
 	{
 		// Members
@@ -726,6 +760,10 @@ namespace OutputReportTabular {
 	extern Array1D< MonthlyColumnsType > MonthlyColumns;
 	extern Array1D< TOCEntriesType > TOCEntries;
 	extern Array1D< UnitConvType > UnitConv;
+	extern Array1D< GatherFieldType > MonthlyColumnsField; // value of each monthly column
+	extern Array1D< GatherFieldType > BinObjField; // value of each binned table
+	extern std::vector< MonthlySumFieldType > MonthlySumFieldsZone; // sum or average columns of zone time step variables
+	extern std::vector< MonthlySumFieldType > MonthlySumFieldsHVAC; // sum or average columns of system time step variables
 
 	// Functions
 
@@ -760,6 +798,19 @@ namespace OutputReportTabular {
 	void
 	InitializeTabularMonthly();
 
+	void
+	CompileTabularGatherFields();
+
+	void
+	BindGatherField(
+		GatherFieldType & field,
+		int const typeOfVar,
+		int const varNum
+	);
+
+	Real64
+	GatherFieldValue( GatherFieldType const & field );
+
 	void
 	GetInputTabularTimeBins();
 
@@ -584,7 +584,7 @@ DXFOut(
 				}
 				gio::write( unit, Format_717 ) << ShadeType;
 			} else {
-				ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, Surface( surf ).Class );
+				ntri = TriangulateSurface( surf, Surface( surf ).Class, mytriangles );
 				for ( svert = 1; svert <= ntri; ++svert ) {
 					vv0 = mytriangles( svert ).vv0;
 					vv1 = mytriangles( svert ).vv1;
@@ -658,7 +658,7 @@ DXFOut(
 					}
 					gio::write( unit, Format_717 ) << TempZoneName;
 				} else {
-					ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, Surface( surf ).Class );
+					ntri = TriangulateSurface( surf, Surface( surf ).Class, mytriangles );
 					for ( svert = 1; svert <= ntri; ++svert ) {
 						vv0 = mytriangles( svert ).vv0;
 						vv1 = mytriangles( svert ).vv1;
@@ -713,9 +713,9 @@ DXFOut(
 					gio::write( unit, Format_717 ) << TempZoneName;
 				} else {
 					if ( Surface( surf ).Shape == RectangularOverhang ) {
-						ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, SurfaceClass_Overhang );
+						ntri = TriangulateSurface( surf, SurfaceClass_Overhang, mytriangles );
 					} else {
-						ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, SurfaceClass_Fin );
+						ntri = TriangulateSurface( surf, SurfaceClass_Fin, mytriangles );
 					}
 					for ( svert = 1; svert <= ntri; ++svert ) {
 						vv0 = mytriangles( svert ).vv0;
@@ -2314,7 +2314,7 @@ VRMLOut(
 			}
 			gio::write( unit, Format_805 );
 		} else { // will be >4 sided polygon with triangulate option
-			ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, Surface( surf ).Class );
+			ntri = TriangulateSurface( surf, Surface( surf ).Class, mytriangles );
 			for ( svert = 1; svert <= ntri; ++svert ) {
 				vv0 = mytriangles( svert ).vv0;
 				gio::write( csidenumber, fmtLD ) << vv0 - 1;
@@ -2373,7 +2373,7 @@ VRMLOut(
 				}
 				gio::write( unit, Format_805 );
 			} else { // will be >4 sided polygon with triangulate option
-				ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, Surface( surf ).Class );
+				ntri = TriangulateSurface( surf, Surface( surf ).Class, mytriangles );
 				for ( svert = 1; svert <= ntri; ++svert ) {
 					vv0 = mytriangles( svert ).vv0;
 					gio::write( csidenumber, fmtLD ) << vv0 - 1;
@@ -2415,7 +2415,7 @@ VRMLOut(
 				}
 				gio::write( unit, Format_805 );
 			} else { // will be >4 sided polygon with triangulate option
-				ntri = Triangulate( Surface( surf ).Sides, Surface( surf ).Vertex, mytriangles, Surface( surf ).Azimuth, Surface( surf ).Tilt, Surface( surf ).Name, Surface( surf ).Class );
+				ntri = TriangulateSurface( surf, Surface( surf ).Class, mytriangles );
 				for ( svert = 1; svert <= ntri; ++svert ) {
 					vv0 = mytriangles( svert ).vv0;
 					gio::write( csidenumber, fmtLD ) << vv0 - 1;
@@ -3957,7 +3957,7 @@ namespace PackagedTerminalHeatPump {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad
 		//       DATE WRITTEN   July 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, start the PLR solution from the last one
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3965,12 +3965,15 @@ namespace PackagedTerminalHeatPump {
 
 		// METHODOLOGY EMPLOYED:
 		// Use RegulaFalsi technique to iterate on part-load ratio until convergence is achieved.
+		// The search starts from the last converged part-load ratio of the unit and only falls
+		// back to the full 0 to 1 interval when no solution is found near it.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::SolveResidualFromGuess;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using DataGlobals::WarmupFlag;
@@ -4088,7 +4091,11 @@ namespace PackagedTerminalHeatPump {
 			} else {
 				Par( 8 ) = 0.0;
 			}
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, Par );
+			if ( SolveResidualFromGuess( PLRResidual, ErrorToler, MaxIte, PTUnit( PTUnitNum ).PartLoadFracLast, 0.05, 0.0, 1.0, Par, PartLoadFrac ) ) {
+				SolFla = 1;
+			} else {
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, Par );
+			}
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -4142,6 +4149,7 @@ namespace PackagedTerminalHeatPump {
 				}
 				PartLoadFrac = max( MinPLF, std::abs( QZnReq - NoCompOutput ) / std::abs( FullOutput - NoCompOutput ) );
 			}
+			if ( SolFla > 0 ) PTUnit( PTUnitNum ).PartLoadFracLast = PartLoadFrac;
 
 		}
 
@@ -5543,7 +5551,8 @@ namespace PackagedTerminalHeatPump {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bo Shen, based on HVACMultiSpeedHeatPump:ControlMSHPOutput
 		//       DATE WRITTEN   March,  2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, speed search starts from the coil speed level capacities
+		//                      Oct 2026, cycling and speed ratio solutions start from the last ones
 		//       RE-ENGINEERED
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5551,15 +5560,21 @@ namespace PackagedTerminalHeatPump {
 
 		// METHODOLOGY EMPLOYED:
 		// Use RegulaFalsi technique to iterate on part-load ratio until convergence is achieved.
+		// The speed that meets a sensible load is searched from the speed the coil's speed level
+		// capacities point to, so the unit is simulated at a few speeds rather than at every speed.
+		// The cycling ratio, and the speed ratio when the speed is unchanged, are first sought near
+		// the unit's last converged values.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::SolveRegulaFalsi;
+		using General::SolveResidualFromGuess;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using DataGlobals::WarmupFlag;
+		using VariableSpeedCoils::EstimateVarSpeedCoilSpeed;
 		using HeatingCoils::SimulateHeatingCoilComponents;
 		using Psychrometrics::PsyCpAirFnWTdb;
 		using SteamCoils::SimulateSteamCoilComponents;
@@ -5715,7 +5730,12 @@ namespace PackagedTerminalHeatPump {
 					Par( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, Par );
+				if ( SolveResidualFromGuess( VSHPCyclingResidual, ErrorToler, MaxIte, PTUnit( PTUnitNum ).PartLoadFracLast, 0.05, 0.0, 1.0, Par, PartLoadFrac ) ) {
+					SolFla = 1;
+				} else {
+					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, Par );
+				}
+				if ( SolFla > 0 ) PTUnit( PTUnitNum ).PartLoadFracLast = PartLoadFrac;
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountCyc == 0 ) {
@@ -5736,19 +5756,61 @@ namespace PackagedTerminalHeatPump {
 				SpeedRatio = 1.0;
 				// Cooling
 				if ( ( ( QZnReq < ( -1.0 * SmallLoad ) ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) && ! CurDeadBandOrSetback( ZoneNum ) ) {
-					for ( i = 2; i <= PTUnit( PTUnitNum ).NumOfSpeedCooling; ++i ) {
+					if ( QLatReq >= 0.0 && PTUnit( PTUnitNum ).NumOfSpeedCooling > 2 && PTUnit( PTUnitNum ).DXCoolCoilIndexNum > 0 ) {
+						// Start at the speed the coil capacities point to and step to the lowest speed that meets the load
+						i = max( 2, min( PTUnit( PTUnitNum ).NumOfSpeedCooling, EstimateVarSpeedCoilSpeed( PTUnit( PTUnitNum ).DXCoolCoilIndexNum, ( QZnReq - NoCompOutput ) / ( FullOutput - NoCompOutput ) ) ) );
 						CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+						if ( QZnReq >= TempOutput ) {
+							SpeedNum = i;
+							while ( SpeedNum > 2 ) {
+								CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, SpeedNum - 1, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+								if ( QZnReq < TempOutput ) break;
+								--SpeedNum;
+							}
+						} else {
+							for ( ++i; i <= PTUnit( PTUnitNum ).NumOfSpeedCooling; ++i ) {
+								CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+								if ( QZnReq >= TempOutput ) {
+									SpeedNum = i;
+									break;
+								}
+							}
+						}
+					} else {
+						for ( i = 2; i <= PTUnit( PTUnitNum ).NumOfSpeedCooling; ++i ) {
+							CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+
+							if ( QLatReq < 0.0 ) {
+								if ( QLatReq > LatOutput ) {
+									SpeedNum = i;
+									break;
+								}
+							} else if ( QZnReq >= TempOutput ) {
+								SpeedNum = i;
+								break;
+							}
 
-						if ( QLatReq < 0.0 ) {
-							if ( QLatReq > LatOutput ) {
+						}
+					}
+				} else if ( PTUnit( PTUnitNum ).NumOfSpeedHeating > 2 && PTUnit( PTUnitNum ).DXHeatCoilIndex > 0 ) {
+					// Start at the speed the coil capacities point to and step to the lowest speed that meets the load
+					i = max( 2, min( PTUnit( PTUnitNum ).NumOfSpeedHeating, EstimateVarSpeedCoilSpeed( PTUnit( PTUnitNum ).DXHeatCoilIndex, ( QZnReq - NoCompOutput ) / ( FullOutput - NoCompOutput ) ) ) );
+					CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+					if ( QZnReq <= TempOutput ) {
+						SpeedNum = i;
+						while ( SpeedNum > 2 ) {
+							CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, SpeedNum - 1, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+							if ( QZnReq > TempOutput ) break;
+							--SpeedNum;
+						}
+					} else {
+						for ( ++i; i <= PTUnit( PTUnitNum ).NumOfSpeedHeating; ++i ) {
+							CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, i, SpeedRatio, PartLoadFrac, TempOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+							if ( QZnReq <= TempOutput ) {
 								SpeedNum = i;
 								break;
 							}
-						} else if ( QZnReq >= TempOutput ) {
-							SpeedNum = i;
-							break;
 						}
-
 					}
 				} else {
 					for ( i = 2; i <= PTUnit( PTUnitNum ).NumOfSpeedHeating; ++i ) {
@@ -5766,7 +5828,15 @@ namespace PackagedTerminalHeatPump {
 					Par( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, Par );
+				if ( SpeedNum == PTUnit( PTUnitNum ).SpeedNumLast && SolveResidualFromGuess( VSHPSpeedResidual, ErrorToler, MaxIte, PTUnit( PTUnitNum ).SpeedRatioLast, 0.05, 1.0e-10, 1.0, Par, SpeedRatio ) ) {
+					SolFla = 1;
+				} else {
+					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, Par );
+				}
+				if ( SolFla > 0 ) {
+					PTUnit( PTUnitNum ).SpeedNumLast = SpeedNum;
+					PTUnit( PTUnitNum ).SpeedRatioLast = SpeedRatio;
+				}
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountVar == 0 ) {
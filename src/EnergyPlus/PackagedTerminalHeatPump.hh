@@ -212,6 +212,9 @@ namespace PackagedTerminalHeatPump {
 		Real64 CompSpeedRatio;
 		int ErrIndexCyc;
 		int ErrIndexVar;
+		Real64 PartLoadFracLast; // part load fraction of the last converged solution
+		int SpeedNumLast; // speed number of the last converged speed ratio solution
+		Real64 SpeedRatioLast; // speed ratio of the last converged solution
 		int ZonePtr; // pointer to a zone served by a fancoil unit
 		int HVACSizingIndex; // index of a HVACSizing object for a fancoil unit
 
@@ -336,6 +339,9 @@ namespace PackagedTerminalHeatPump {
 			CompSpeedRatio( 0.0 ),
 			ErrIndexCyc( 0 ),
 			ErrIndexVar( 0 ),
+			PartLoadFracLast( 0.0 ),
+			SpeedNumLast( 0 ),
+			SpeedRatioLast( 0.0 ),
 			ZonePtr(0),
 			HVACSizingIndex(0)
 		{}
@@ -611,6 +617,9 @@ namespace PackagedTerminalHeatPump {
 			CompSpeedRatio( CompSpeedRatio ),
 			ErrIndexCyc( ErrIndexCyc ),
 			ErrIndexVar( ErrIndexVar ),
+			PartLoadFracLast( 0.0 ),
+			SpeedNumLast( 0 ),
+			SpeedRatioLast( 0.0 ),
 			ZonePtr( ZonePtr ),
 			HVACSizingIndex( HVACSizingIndex )
 		{}
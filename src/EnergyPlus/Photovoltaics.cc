@@ -1168,6 +1168,7 @@ namespace Photovoltaics {
 		//       MODIFIED       B. Griffith, February 2008-- added support for inverter
 		//                      multipliers, and building integrated heat transfer
 		//                      B. Griffith, Aug. 2008 reworked for new, single-PV-generator data structure
+		//                      Oct 2026, reference parameters computed once outside the efficiency iteration
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1237,6 +1238,7 @@ namespace Photovoltaics {
 		int K;
 		Real64 CellTemp( 0.0 ); // cell temperature in Kelvin
 		Real64 CellTempC; // cell temperature in degrees C
+		Real64 CapacityDecay; // decay of the cell temperature difference over the timestep, dynamic cell temperature mode
 		static bool firstTime( true );
 		//unused1208  INTEGER :: thisZone
 
@@ -1259,6 +1261,22 @@ namespace Photovoltaics {
 			CC = 1;
 			EtaOld = EtaIni;
 
+			// the heat loss coefficient and the reference parameters do not change with the efficiency,
+			// so compute them once rather than on every pass of the iteration
+			if ( PVarray( PVnum ).CellIntegrationMode == iDecoupledCellIntegration ) {
+				PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef = PVarray( PVnum ).TRNSYSPVModule.TauAlpha * PVarray( PVnum ).TRNSYSPVModule.NOCTInsolation / ( PVarray( PVnum ).TRNSYSPVModule.NOCTCellTemp - PVarray( PVnum ).TRNSYSPVModule.NOCTAmbTemp );
+			} else if ( PVarray( PVnum ).CellIntegrationMode == iDecoupledUllebergDynamicCellIntegration ) {
+				CapacityDecay = std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep );
+			}
+
+			//  reference parameters
+			ILRef = PVarray( PVnum ).TRNSYSPVModule.RefIsc;
+			AARef = ( PVarray( PVnum ).TRNSYSPVModule.TempCoefVoc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature - PVarray( PVnum ).TRNSYSPVModule.RefVoc + PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries ) / ( PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature / ILRef - 3.0 );
+			IORef = ILRef * std::exp( -PVarray( PVnum ).TRNSYSPVModule.RefVoc / AARef );
+
+			//  series resistance
+			SeriesResistance = ( AARef * std::log( 1.0 - PVarray( PVnum ).TRNSYSPVModule.Imp / ILRef ) - PVarray( PVnum ).TRNSYSPVModule.Vmp + PVarray( PVnum ).TRNSYSPVModule.RefVoc ) / PVarray( PVnum ).TRNSYSPVModule.Imp;
+
 			// Begin DO WHILE loop - until the error tolerance is reached.
 			ETA = 0.0;
 			while ( DummyErr > ERR ) {
@@ -1266,11 +1284,10 @@ namespace Photovoltaics {
 				{ auto const SELECT_CASE_var( PVarray( PVnum ).CellIntegrationMode );
 				if ( SELECT_CASE_var == iDecoupledCellIntegration ) {
 					//  cell temperature based on energy balance
-					PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef = PVarray( PVnum ).TRNSYSPVModule.TauAlpha * PVarray( PVnum ).TRNSYSPVModule.NOCTInsolation / ( PVarray( PVnum ).TRNSYSPVModule.NOCTCellTemp - PVarray( PVnum ).TRNSYSPVModule.NOCTAmbTemp );
 					CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.Insolation * PVarray( PVnum ).TRNSYSPVModule.TauAlpha / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef ) * ( 1.0 - ETA / PVarray( PVnum ).TRNSYSPVModule.TauAlpha );
 				} else if ( SELECT_CASE_var == iDecoupledUllebergDynamicCellIntegration ) {
 					//  cell temperature based on energy balance with thermal capacity effects
-					CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.LastCellTempK - Tambient ) * std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) + ( PVarray( PVnum ).TRNSYSPVModule.TauAlpha - ETA ) * PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef * ( 1.0 - std::exp( -PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef / PVarray( PVnum ).TRNSYSPVModule.HeatCapacity * PVTimeStep ) );
+					CellTemp = Tambient + ( PVarray( PVnum ).TRNSYSPVcalc.LastCellTempK - Tambient ) * CapacityDecay + ( PVarray( PVnum ).TRNSYSPVModule.TauAlpha - ETA ) * PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.HeatLossCoef * ( 1.0 - CapacityDecay );
 				} else if ( SELECT_CASE_var == iSurfaceOutsideFaceCellIntegration ) {
 					CellTemp = TempSurfOut( PVarray( PVnum ).SurfacePtr ) + KelvinConv;
 				} else if ( SELECT_CASE_var == iTranspiredCollectorCellIntegration ) {
@@ -1283,14 +1300,6 @@ namespace Photovoltaics {
 					// get PVT model result for cell temp..
 				}}
 
-				//  reference parameters
-				ILRef = PVarray( PVnum ).TRNSYSPVModule.RefIsc;
-				AARef = ( PVarray( PVnum ).TRNSYSPVModule.TempCoefVoc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature - PVarray( PVnum ).TRNSYSPVModule.RefVoc + PVarray( PVnum ).TRNSYSPVModule.SemiConductorBandgap * PVarray( PVnum ).TRNSYSPVModule.CellsInSeries ) / ( PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * PVarray( PVnum ).TRNSYSPVModule.RefTemperature / ILRef - 3.0 );
-				IORef = ILRef * std::exp( -PVarray( PVnum ).TRNSYSPVModule.RefVoc / AARef );
-
-				//  series resistance
-				SeriesResistance = ( AARef * std::log( 1.0 - PVarray( PVnum ).TRNSYSPVModule.Imp / ILRef ) - PVarray( PVnum ).TRNSYSPVModule.Vmp + PVarray( PVnum ).TRNSYSPVModule.RefVoc ) / PVarray( PVnum ).TRNSYSPVModule.Imp;
-
 				//  temperature depencence
 				IL = PVarray( PVnum ).TRNSYSPVcalc.Insolation / PVarray( PVnum ).TRNSYSPVModule.RefInsolation * ( ILRef + PVarray( PVnum ).TRNSYSPVModule.TempCoefIsc * ( CellTemp - PVarray( PVnum ).TRNSYSPVModule.RefTemperature ) );
 				Real64 const cell_temp_ratio( CellTemp / PVarray( PVnum ).TRNSYSPVModule.RefTemperature );
@@ -1443,8 +1452,8 @@ namespace Photovoltaics {
 	void
 	NEWTON(
 		Real64 & XX,
-		std::function< Real64( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ) > FXX,
-		std::function< Real64( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ) > DER,
+		Real64 ( *FXX )( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ),
+		Real64 ( *DER )( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ),
 		Real64 const & II, //Autodesk Aliased to XX in some calls
 		Real64 const & VV, //Autodesk Aliased to XX in some calls
 		Real64 const IO,
@@ -1460,6 +1469,7 @@ namespace Photovoltaics {
 		//       AUTHOR         . Ulleberg, IFE Norway for Hydrogems
 		//       DATE WRITTEN   March 2001
 		//       MODIFIED       D. Bradley for use with EnergyPlus
+		//                      Oct 2026, plain function pointers for the function and its derivative
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1,9 +1,6 @@
 #ifndef Photovoltaics_hh_INCLUDED
 #define Photovoltaics_hh_INCLUDED
 
-// C++ Headers
-#include <functional>
-
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -107,8 +104,8 @@ namespace Photovoltaics {
 	void
 	NEWTON(
 		Real64 & XX,
-		std::function< Real64( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ) > FXX,
-		std::function< Real64( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ) > DER,
+		Real64 ( *FXX )( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ),
+		Real64 ( *DER )( Real64 const, Real64 const, Real64 const, Real64 const, Real64 const ),
 		Real64 const & II, //Autodesk Aliased to XX in some calls
 		Real64 const & VV, //Autodesk Aliased to XX in some calls
 		Real64 const IO,
@@ -1,5 +1,7 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -19,6 +21,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <HeatBalanceInternalHeatGains.hh>
@@ -53,6 +56,10 @@ namespace PipeHeatTransfer {
 	// pipe:underground calculations are from Piechowski's thesis.  In Piechowski, the near-pipe
 	// region is solved with a detailed finite difference grid, this current model makes use of
 	// the Hanby model to simulate the actual pipe.
+	// The pipe and soil are solved once per system time step.  The temperatures at the end of the
+	// time step are solved for in the tentative arrays, which are swapped with the accepted ones
+	// when the simulation time moves on.  With BuriedPipeImplicitSolve the soil nodes of each
+	// pipe section are solved together as one banded system (SolveBuriedPipeSoil).
 
 	// Kusuda, T. & Achenbach, P. (1965), Earth temperature and thermal diffusivity at
 	//     selected stations in the united states, ASHRAE Transactions 71(1), 61-75.
@@ -79,12 +86,6 @@ namespace PipeHeatTransfer {
 	int const OutsideAirEnv( 3 );
 	int const GroundEnv( 4 );
 
-	int const PreviousTimeIndex( 1 );
-	int const CurrentTimeIndex( 2 );
-	int const TentativeTimeIndex( 3 );
-
-	Real64 const InnerDeltaTime( 60.0 ); // one minute time step in seconds
-
 	// DERIVED TYPE DEFINITIONS
 
 	// the model data structures
@@ -103,7 +104,6 @@ namespace PipeHeatTransfer {
 	Real64 EnvHeatLossRate( 0.0 ); // heat loss rate from pipe to the environment
 	Real64 FluidHeatLossRate( 0.0 ); // overall heat loss from fluid to pipe
 	bool GetPipeInputFlag( true ); // First time, input is "gotten"
-	int NumInnerTimeSteps( 0 ); // the number of "inner" time steps for our model
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -128,7 +128,7 @@ namespace PipeHeatTransfer {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   July 2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, one solution per system time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -144,6 +144,7 @@ namespace PipeHeatTransfer {
 		// Using/Aliasing
 		using InputProcessor::FindItemInList;
 		using General::TrimSigDigits;
+		using DataSystemVariables::BuriedPipeImplicitSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -158,7 +159,7 @@ namespace PipeHeatTransfer {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int InnerTimeStepCtr;
+		// na
 
 		// check for input
 		if ( GetPipeInputFlag ) {
@@ -189,15 +190,18 @@ namespace PipeHeatTransfer {
 		// initialize
 		InitPipesHeatTransfer( EquipType, PipeHTNum, FirstHVACIteration );
 		// make the calculations
-		for ( InnerTimeStepCtr = 1; InnerTimeStepCtr <= NumInnerTimeSteps; ++InnerTimeStepCtr ) {
-			{ auto const SELECT_CASE_var( PipeHT( PipeHTNum ).EnvironmentPtr );
-			if ( SELECT_CASE_var == GroundEnv ) {
-				CalcBuriedPipeSoil( PipeHTNum );
+		// (the equations only use the accepted temperatures, so repeating them for shorter
+		//  "inner" time steps gave the same temperatures)
+		{ auto const SELECT_CASE_var( PipeHT( PipeHTNum ).EnvironmentPtr );
+		if ( SELECT_CASE_var == GroundEnv ) {
+			if ( BuriedPipeImplicitSolve ) {
+				SolveBuriedPipeSoil( PipeHTNum );
 			} else {
-				CalcPipesHeatTransfer( PipeHTNum );
-			}}
-			PushInnerTimeStepArrays( PipeHTNum );
-		}
+				CalcBuriedPipeSoil( PipeHTNum );
+			}
+		} else {
+			CalcPipesHeatTransfer( PipeHTNum );
+		}}
 		// update vaiables
 		UpdatePipesHeatTransfer();
 		// update report variables
@@ -207,33 +211,6 @@ namespace PipeHeatTransfer {
 
 	//==============================================================================
 
-	void
-	PushInnerTimeStepArrays( int const PipeHTNum )
-	{
-
-		// Locals
-		int LengthIndex;
-		int DepthIndex;
-		int WidthIndex;
-
-		if ( PipeHT( PipeHTNum ).EnvironmentPtr == GroundEnv ) {
-			for ( LengthIndex = 2; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-				for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes; ++DepthIndex ) {
-					for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-						//This will store the old 'current' values as the new 'previous values'  This allows
-						// us to use the previous time array as history terms in the equations
-						PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, PreviousTimeIndex ) = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex );
-					}
-				}
-			}
-		}
-
-		//Then update the Hanby near pipe model temperatures
-		PipeHT( PipeHTNum ).PreviousFluidTemp = PipeHT( PipeHTNum ).FluidTemp;
-		PipeHT( PipeHTNum ).PreviousPipeTemp = PipeHT( PipeHTNum ).PipeTemp;
-
-	}
-
 	void
 	GetPipesHeatTransfer()
 	{
@@ -695,8 +672,10 @@ namespace PipeHeatTransfer {
 			PipeHT( Item ).NumSections = NumPipeSections;
 
 			// For buried pipes, we need to allocate the cartesian finite difference array
-			PipeHT( Item ).T.allocate( PipeHT( Item ).PipeNodeWidth, PipeHT( Item ).NumDepthNodes, PipeHT( Item ).NumSections, TentativeTimeIndex );
+			PipeHT( Item ).T.allocate( PipeHT( Item ).PipeNodeWidth, PipeHT( Item ).NumDepthNodes, PipeHT( Item ).NumSections );
 			PipeHT( Item ).T = 0.0;
+			PipeHT( Item ).TentativeT.allocate( PipeHT( Item ).PipeNodeWidth, PipeHT( Item ).NumDepthNodes, PipeHT( Item ).NumSections );
+			PipeHT( Item ).TentativeT = 0.0;
 
 		} // PipeUG input loop
 
@@ -709,16 +688,12 @@ namespace PipeHeatTransfer {
 			PipeHT( Item ).TentativeFluidTemp.allocate( {0,NumSections} );
 			PipeHT( Item ).TentativePipeTemp.allocate( {0,NumSections} );
 			PipeHT( Item ).FluidTemp.allocate( {0,NumSections} );
-			PipeHT( Item ).PreviousFluidTemp.allocate( {0,NumSections} );
 			PipeHT( Item ).PipeTemp.allocate( {0,NumSections} );
-			PipeHT( Item ).PreviousPipeTemp.allocate( {0,NumSections} );
 
 			PipeHT( Item ).TentativeFluidTemp = 0.0;
 			PipeHT( Item ).FluidTemp = 0.0;
-			PipeHT( Item ).PreviousFluidTemp = 0.0;
 			PipeHT( Item ).TentativePipeTemp = 0.0;
 			PipeHT( Item ).PipeTemp = 0.0;
-			PipeHT( Item ).PreviousPipeTemp = 0.0;
 
 			// work out heat transfer areas (area per section)
 			PipeHT( Item ).InsideArea = Pi * PipeHT( Item ).PipeID * PipeHT( Item ).Length / NumSections;
@@ -869,6 +844,7 @@ namespace PipeHeatTransfer {
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   July 2007
 		//       MODIFIED       L. Gu, 6/19/08, pipe wall heat capacity has metal layer only
+		//                      Oct 2026, accepted and tentative arrays swapped instead of copied
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -931,7 +907,6 @@ namespace PipeHeatTransfer {
 		Real64 FirstTemperatures; // initial temperature of every node in pipe (set to inlet temp) [C]
 		int PipeNum; // number of pipes
 		int MonthIndex;
-		int TimeIndex;
 		int LengthIndex;
 		int DepthIndex;
 		int WidthIndex;
@@ -1029,17 +1004,16 @@ namespace PipeHeatTransfer {
 			// For underground pipes, we need to re-init the cartesian array each environment
 			for ( PipeNum = 1; PipeNum <= NumOfPipeHT; ++PipeNum ) {
 				if ( PipeHT( PipeNum ).EnvironmentPtr == GroundEnv ) {
-					for ( TimeIndex = PreviousTimeIndex; TimeIndex <= TentativeTimeIndex; ++TimeIndex ) {
-						//Loop through all length, depth, and width of pipe to init soil temperature
-						for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeNum ).NumSections; ++LengthIndex ) {
-							for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeNum ).NumDepthNodes; ++DepthIndex ) {
-								for ( WidthIndex = 1; WidthIndex <= PipeHT( PipeNum ).PipeNodeWidth; ++WidthIndex ) {
-									CurrentDepth = ( DepthIndex - 1 ) * PipeHT( PipeNum ).dSregular;
-									PipeHT( PipeNum ).T( WidthIndex, DepthIndex, LengthIndex, TimeIndex ) = TBND( CurrentDepth, CurSimDay, PipeNum );
-								}
+					//Loop through all length, depth, and width of pipe to init soil temperature
+					for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeNum ).NumSections; ++LengthIndex ) {
+						for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeNum ).NumDepthNodes; ++DepthIndex ) {
+							for ( WidthIndex = 1; WidthIndex <= PipeHT( PipeNum ).PipeNodeWidth; ++WidthIndex ) {
+								CurrentDepth = ( DepthIndex - 1 ) * PipeHT( PipeNum ).dSregular;
+								PipeHT( PipeNum ).T( WidthIndex, DepthIndex, LengthIndex ) = TBND( CurrentDepth, CurSimDay, PipeNum );
 							}
 						}
 					}
+					PipeHT( PipeNum ).TentativeT = PipeHT( PipeNum ).T;
 				}
 			}
 
@@ -1047,10 +1021,8 @@ namespace PipeHeatTransfer {
 			FirstTemperatures = 21.0; //Node(InletNodeNum)%Temp
 			PipeHT( PipeHTNum ).TentativeFluidTemp = FirstTemperatures;
 			PipeHT( PipeHTNum ).FluidTemp = FirstTemperatures;
-			PipeHT( PipeHTNum ).PreviousFluidTemp = FirstTemperatures;
 			PipeHT( PipeHTNum ).TentativePipeTemp = FirstTemperatures;
 			PipeHT( PipeHTNum ).PipeTemp = FirstTemperatures;
-			PipeHT( PipeHTNum ).PreviousPipeTemp = FirstTemperatures;
 			PipeHT( PipeHTNum ).PreviousSimTime = 0.0;
 			DeltaTime = 0.0;
 			OutletTemp = 0.0;
@@ -1068,7 +1040,6 @@ namespace PipeHeatTransfer {
 
 		// time step in seconds
 		DeltaTime = TimeStepSys * SecInHour;
-		NumInnerTimeSteps = int( DeltaTime / InnerDeltaTime );
 
 		// previous temps are updated if necessary at start of timestep rather than end
 		if ( ( FirstHVACIteration && PipeHT( PipeHTNum ).FirstHVACupdateFlag ) || ( BeginEnvrnFlag && PipeHT( PipeHTNum ).BeginEnvrnupdateFlag ) ) {
@@ -1076,21 +1047,21 @@ namespace PipeHeatTransfer {
 			//We need to update boundary conditions here, as well as updating the arrays
 			if ( PipeHT( PipeHTNum ).EnvironmentPtr == GroundEnv ) {
 
-				// And then update Ground Boundary Conditions
-				for ( TimeIndex = 1; TimeIndex <= TentativeTimeIndex; ++TimeIndex ) {
-					for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-						for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes; ++DepthIndex ) {
-							//Farfield boundary
-							CurrentDepth = ( DepthIndex - 1 ) * PipeHT( PipeHTNum ).dSregular;
-							CurTemp = TBND( CurrentDepth, CurSimDay, PipeHTNum );
-							PipeHT( PipeHTNum ).T( 1, DepthIndex, LengthIndex, TimeIndex ) = CurTemp;
-						}
-						for ( WidthIndex = 1; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-							//Bottom side of boundary
-							CurrentDepth = PipeHT( PipeHTNum ).DomainDepth;
-							CurTemp = TBND( CurrentDepth, CurSimDay, PipeHTNum );
-							PipeHT( PipeHTNum ).T( WidthIndex, PipeHT( PipeHTNum ).NumDepthNodes, LengthIndex, TimeIndex ) = CurTemp;
-						}
+				// And then update Ground Boundary Conditions (in the accepted and tentative arrays)
+				for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
+					for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes; ++DepthIndex ) {
+						//Farfield boundary
+						CurrentDepth = ( DepthIndex - 1 ) * PipeHT( PipeHTNum ).dSregular;
+						CurTemp = TBND( CurrentDepth, CurSimDay, PipeHTNum );
+						PipeHT( PipeHTNum ).T( 1, DepthIndex, LengthIndex ) = CurTemp;
+						PipeHT( PipeHTNum ).TentativeT( 1, DepthIndex, LengthIndex ) = CurTemp;
+					}
+					for ( WidthIndex = 1; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
+						//Bottom side of boundary
+						CurrentDepth = PipeHT( PipeHTNum ).DomainDepth;
+						CurTemp = TBND( CurrentDepth, CurSimDay, PipeHTNum );
+						PipeHT( PipeHTNum ).T( WidthIndex, PipeHT( PipeHTNum ).NumDepthNodes, LengthIndex ) = CurTemp;
+						PipeHT( PipeHTNum ).TentativeT( WidthIndex, PipeHT( PipeHTNum ).NumDepthNodes, LengthIndex ) = CurTemp;
 					}
 				}
 			}
@@ -1129,39 +1100,21 @@ namespace PipeHeatTransfer {
 		if ( PushArrays ) {
 
 			//If sim time has changed all values from previous runs should have been acceptable.
-			// Thus we will now shift the arrays from 2>1 and 3>2 so we can then begin
-			// to update 2 and 3 again.
+			// Thus the tentative arrays become the accepted ones; the old accepted arrays are
+			// reused for the next tentative values, which are all recalculated.
 			if ( PipeHT( PipeHTNum ).EnvironmentPtr == GroundEnv ) {
-				for ( LengthIndex = 2; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-					for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes; ++DepthIndex ) {
-						for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-							//This will essentially 'accept' the tentative values that were calculated last iteration
-							// as the new officially 'current' values
-							PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex ) = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex );
-						}
-					}
-				}
+				PipeHT( PipeHTNum ).T.swap( PipeHT( PipeHTNum ).TentativeT );
 			}
 
 			//Then update the Hanby near pipe model temperatures
-			PipeHT( PipeHTNum ).FluidTemp = PipeHT( PipeHTNum ).TentativeFluidTemp;
-			PipeHT( PipeHTNum ).PipeTemp = PipeHT( PipeHTNum ).TentativePipeTemp;
+			PipeHT( PipeHTNum ).FluidTemp.swap( PipeHT( PipeHTNum ).TentativeFluidTemp );
+			PipeHT( PipeHTNum ).PipeTemp.swap( PipeHT( PipeHTNum ).TentativePipeTemp );
 
 		} else { //  IF(.NOT. FirstHVACIteration)THEN
 
 			//If we don't have FirstHVAC, the last iteration values were not accepted, and we should
-			// not step through time.  Thus we will revert our T(3,:,:,:) array back to T(2,:,:,:) to
-			// start over with the same values as last time.
-			for ( LengthIndex = 2; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-				for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes; ++DepthIndex ) {
-					for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-						//This will essentially erase the past iterations and revert back to the correct values
-						PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex );
-					}
-				}
-			}
-
-			//Similarly for Hanby model arrays
+			// not step through time.  The tentative soil temperatures are all recalculated from the
+			// accepted ones, so only the Hanby model arrays are reverted.
 			PipeHT( PipeHTNum ).TentativeFluidTemp = PipeHT( PipeHTNum ).FluidTemp;
 			PipeHT( PipeHTNum ).TentativePipeTemp = PipeHT( PipeHTNum ).PipeTemp;
 
@@ -1267,7 +1220,7 @@ namespace PipeHeatTransfer {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   July 2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, history terms from the accepted arrays
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1391,14 +1344,14 @@ namespace PipeHeatTransfer {
 
 			PipeDepth = PipeHT( PipeHTNum ).PipeNodeDepth;
 			PipeWidth = PipeHT( PipeHTNum ).PipeNodeWidth;
-			TempBelow = PipeHT( PipeHTNum ).T( PipeWidth, PipeDepth + 1, LengthIndex, CurrentTimeIndex );
-			TempBeside = PipeHT( PipeHTNum ).T( PipeWidth - 1, PipeDepth, LengthIndex, CurrentTimeIndex );
-			TempAbove = PipeHT( PipeHTNum ).T( PipeWidth, PipeDepth - 1, LengthIndex, CurrentTimeIndex );
+			TempBelow = PipeHT( PipeHTNum ).T( PipeWidth, PipeDepth + 1, LengthIndex );
+			TempBeside = PipeHT( PipeHTNum ).T( PipeWidth - 1, PipeDepth, LengthIndex );
+			TempAbove = PipeHT( PipeHTNum ).T( PipeWidth, PipeDepth - 1, LengthIndex );
 			EnvironmentTemp = ( TempBelow + TempBeside + TempAbove ) / 3.0;
 
-			PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex ) = ( A2 * PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex - 1 ) + A3 / B1 * ( B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PreviousPipeTemp( LengthIndex ) ) + A4 * PipeHT( PipeHTNum ).PreviousFluidTemp( LengthIndex ) ) / ( A1 - A3 * B2 / B1 );
+			PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex ) = ( A2 * PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex - 1 ) + A3 / B1 * ( B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PipeTemp( LengthIndex ) ) + A4 * PipeHT( PipeHTNum ).FluidTemp( LengthIndex ) ) / ( A1 - A3 * B2 / B1 );
 
-			PipeHT( PipeHTNum ).TentativePipeTemp( LengthIndex ) = ( B2 * PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex ) + B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PreviousPipeTemp( LengthIndex ) ) / B1;
+			PipeHT( PipeHTNum ).TentativePipeTemp( LengthIndex ) = ( B2 * PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex ) + B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PipeTemp( LengthIndex ) ) / B1;
 
 			// Get exterior surface temperature from energy balance at the surface
 			Numerator = EnvironmentTemp - PipeHT( PipeHTNum ).TentativeFluidTemp( LengthIndex );
@@ -1413,9 +1366,9 @@ namespace PipeHeatTransfer {
 			// start loop along pipe
 			// b1 must not be zero but this should have been checked on input
 			for ( curnode = 1; curnode <= PipeHT( PipeHTNum ).NumSections; ++curnode ) {
-				PipeHT( PipeHTNum ).TentativeFluidTemp( curnode ) = ( A2 * PipeHT( PipeHTNum ).TentativeFluidTemp( curnode - 1 ) + A3 / B1 * ( B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PreviousPipeTemp( curnode ) ) + A4 * PipeHT( PipeHTNum ).PreviousFluidTemp( curnode ) ) / ( A1 - A3 * B2 / B1 );
+				PipeHT( PipeHTNum ).TentativeFluidTemp( curnode ) = ( A2 * PipeHT( PipeHTNum ).TentativeFluidTemp( curnode - 1 ) + A3 / B1 * ( B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PipeTemp( curnode ) ) + A4 * PipeHT( PipeHTNum ).FluidTemp( curnode ) ) / ( A1 - A3 * B2 / B1 );
 
-				PipeHT( PipeHTNum ).TentativePipeTemp( curnode ) = ( B2 * PipeHT( PipeHTNum ).TentativeFluidTemp( curnode ) + B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PreviousPipeTemp( curnode ) ) / B1;
+				PipeHT( PipeHTNum ).TentativePipeTemp( curnode ) = ( B2 * PipeHT( PipeHTNum ).TentativeFluidTemp( curnode ) + B3 * EnvironmentTemp + B4 * PipeHT( PipeHTNum ).PipeTemp( curnode ) ) / B1;
 
 				// Get exterior surface temperature from energy balance at the surface
 				Numerator = EnvironmentTemp - PipeHT( PipeHTNum ).TentativeFluidTemp( curnode );
@@ -1443,7 +1396,7 @@ namespace PipeHeatTransfer {
 
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   May 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, single sweep
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1454,6 +1407,8 @@ namespace PipeHeatTransfer {
 		// An implicit pseudo 3D finite difference grid
 		// is set up, which simulates transient behavior in the soil.
 		// This then interfaces with the Hanby model for near-pipe region
+		// The neighbour temperatures are the accepted ones, so the nodes are updated in one sweep
+		// (repeating the sweep gave the same temperatures).
 
 		// REFERENCES: See Module Level Description
 
@@ -1476,20 +1431,15 @@ namespace PipeHeatTransfer {
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const NumSections( 20 );
-		Real64 const ConvCrit( 0.05 );
-		int const MaxIterations( 200 );
 		Real64 const StefBoltzmann( 5.6697e-08 ); // Stefan-Boltzmann constant
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int IterationIndex( 0 ); // Index when stepping through equations
 		static int LengthIndex( 0 ); // Index for nodes along length of pipe
 		static int DepthIndex( 0 ); // Index for nodes in the depth direction
 		static int WidthIndex( 0 ); // Index for nodes in the width direction
 		static Real64 ConvCoef( 0.0 ); // Current convection coefficient = f(Wind Speed,Roughness)
 		static Real64 RadCoef( 0.0 ); // Current radiation coefficient
 		static Real64 QSolAbsorbed( 0.0 ); // Current total solar energy absorbed
-		Array3D< Real64 > T_O( PipeHT( PipeHTNum ).PipeNodeWidth, PipeHT( PipeHTNum ).NumDepthNodes, NumSections );
 
 		//Local variable placeholders for code readability
 		static Real64 A1( 0.0 ); // Placeholder for CoefA1
@@ -1500,7 +1450,6 @@ namespace PipeHeatTransfer {
 		static Real64 NodeLeft( 0.0 ); // Placeholder for Node temp to the left of current node
 		static Real64 NodePast( 0.0 ); // Placeholder for Node temp at current node but previous time step
 		static Real64 PastNodeTempAbs( 0.0 ); // Placeholder for absolute temperature (K) version of NodePast
-		static Real64 Ttemp( 0.0 ); // Placeholder for a current temperature node in convergence check
 		static Real64 SkyTempAbs( 0.0 ); // Placeholder for current sky temperature in Kelvin
 		static int TopRoughness( 0 ); // Placeholder for soil surface roughness
 		static Real64 TopThermAbs( 0.0 ); // Placeholder for soil thermal radiation absorptivity
@@ -1515,143 +1464,266 @@ namespace PipeHeatTransfer {
 		PipeHT( PipeHTNum ).CoefA1 = PipeHT( PipeHTNum ).FourierDS / ( 1 + 4 * PipeHT( PipeHTNum ).FourierDS ); //Eq. D2
 		PipeHT( PipeHTNum ).CoefA2 = 1 / ( 1 + 4 * PipeHT( PipeHTNum ).FourierDS ); //Eq. D3
 
-		for ( IterationIndex = 1; IterationIndex <= MaxIterations; ++IterationIndex ) {
-			if ( IterationIndex == MaxIterations ) {
-				ShowWarningError( "BuriedPipeHeatTransfer: Large number of iterations detected in object: " + PipeHT( PipeHTNum ).Name );
-			}
+		//Loop along entire length of pipe, analyzing cross sects
+		for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
+			for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes - 1; ++DepthIndex ) {
+				for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
+
+					if ( DepthIndex == 1 ) { //Soil Surface Boundary
+
+						//If on soil boundary, load up local variables and perform calculations
+						NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex );
+						PastNodeTempAbs = NodePast + KelvinConv;
+						SkyTempAbs = SkyTemp + KelvinConv;
+						TopRoughness = PipeHT( PipeHTNum ).SoilRoughness;
+						TopThermAbs = PipeHT( PipeHTNum ).SoilThermAbs;
+						TopSolarAbs = PipeHT( PipeHTNum ).SoilSolarAbs;
+						kSoil = PipeHT( PipeHTNum ).SoilConductivity;
+						dS = PipeHT( PipeHTNum ).dSregular;
+						rho = PipeHT( PipeHTNum ).SoilDensity;
+						Cp = PipeHT( PipeHTNum ).SoilCp;
+
+						// ASHRAE simple convection coefficient model for external surfaces.
+						PipeHT( PipeHTNum ).OutdoorConvCoef = CalcASHRAESimpExtConvectCoeff( TopRoughness, WindSpeed );
+						ConvCoef = PipeHT( PipeHTNum ).OutdoorConvCoef;
+
+						// thermal radiation coefficient using surf temp from past time step
+						if ( std::abs( PastNodeTempAbs - SkyTempAbs ) > rTinyValue ) {
+							RadCoef = StefBoltzmann * TopThermAbs * ( pow_4( PastNodeTempAbs ) - pow_4( SkyTempAbs ) ) / ( PastNodeTempAbs - SkyTempAbs );
+						} else {
+							RadCoef = 0.0;
+						}
 
-			//Store computed values in T_O array
-			for ( LengthIndex = 2; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-				for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes - 1; ++DepthIndex ) {
-					for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-						T_O( WidthIndex, DepthIndex, LengthIndex ) = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex );
-					}
-				}
-			}
+						// total absorbed solar - no ground solar
+						QSolAbsorbed = TopSolarAbs * ( max( SOLCOS( 3 ), 0.0 ) * BeamSolarRad + DifSolarRad );
 
-			//Loop along entire length of pipe, analyzing cross sects
-			for ( LengthIndex = 1; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-				for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes - 1; ++DepthIndex ) {
-					for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-
-						if ( DepthIndex == 1 ) { //Soil Surface Boundary
-
-							//If on soil boundary, load up local variables and perform calculations
-							NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, PreviousTimeIndex );
-							PastNodeTempAbs = NodePast + KelvinConv;
-							SkyTempAbs = SkyTemp + KelvinConv;
-							TopRoughness = PipeHT( PipeHTNum ).SoilRoughness;
-							TopThermAbs = PipeHT( PipeHTNum ).SoilThermAbs;
-							TopSolarAbs = PipeHT( PipeHTNum ).SoilSolarAbs;
-							kSoil = PipeHT( PipeHTNum ).SoilConductivity;
-							dS = PipeHT( PipeHTNum ).dSregular;
-							rho = PipeHT( PipeHTNum ).SoilDensity;
-							Cp = PipeHT( PipeHTNum ).SoilCp;
-
-							// ASHRAE simple convection coefficient model for external surfaces.
-							PipeHT( PipeHTNum ).OutdoorConvCoef = CalcASHRAESimpExtConvectCoeff( TopRoughness, WindSpeed );
-							ConvCoef = PipeHT( PipeHTNum ).OutdoorConvCoef;
-
-							// thermal radiation coefficient using surf temp from past time step
-							if ( std::abs( PastNodeTempAbs - SkyTempAbs ) > rTinyValue ) {
-								RadCoef = StefBoltzmann * TopThermAbs * ( pow_4( PastNodeTempAbs ) - pow_4( SkyTempAbs ) ) / ( PastNodeTempAbs - SkyTempAbs );
-							} else {
-								RadCoef = 0.0;
-							}
+						// If sun is not exposed, then turn off both solar and thermal radiation
+						if ( ! PipeHT( PipeHTNum ).SolarExposed ) {
+							RadCoef = 0.0;
+							QSolAbsorbed = 0.0;
+						}
 
-							// total absorbed solar - no ground solar
-							QSolAbsorbed = TopSolarAbs * ( max( SOLCOS( 3 ), 0.0 ) * BeamSolarRad + DifSolarRad );
+						if ( WidthIndex == PipeHT( PipeHTNum ).PipeNodeWidth ) { //Symmetric centerline boundary
 
-							// If sun is not exposed, then turn off both solar and thermal radiation
-							if ( ! PipeHT( PipeHTNum ).SolarExposed ) {
-								RadCoef = 0.0;
-								QSolAbsorbed = 0.0;
-							}
+							//-Coefficients and Temperatures
+							NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex );
+							NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex );
+
+							//-Update Equation, basically a detailed energy balance at the surface
+							PipeHT( PipeHTNum ).TentativeT( WidthIndex, DepthIndex, LengthIndex ) = ( QSolAbsorbed + RadCoef * SkyTemp + ConvCoef * OutDryBulbTemp + ( kSoil / dS ) * ( NodeBelow + 2 * NodeLeft ) + ( rho * Cp / DeltaTime ) * NodePast ) / ( RadCoef + ConvCoef + 3 * ( kSoil / dS ) + ( rho * Cp / DeltaTime ) );
+
+						} else { //Soil surface, but not on centerline
 
-							if ( WidthIndex == PipeHT( PipeHTNum ).PipeNodeWidth ) { //Symmetric centerline boundary
+							//-Coefficients and Temperatures
+							NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex );
+							NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex );
+							NodeRight = PipeHT( PipeHTNum ).T( WidthIndex + 1, DepthIndex, LengthIndex );
 
-								//-Coefficients and Temperatures
-								NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
-								NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex, CurrentTimeIndex );
+							//-Update Equation
+							PipeHT( PipeHTNum ).TentativeT( WidthIndex, DepthIndex, LengthIndex ) = ( QSolAbsorbed + RadCoef * SkyTemp + ConvCoef * OutDryBulbTemp + ( kSoil / dS ) * ( NodeBelow + NodeLeft + NodeRight ) + ( rho * Cp / DeltaTime ) * NodePast ) / ( RadCoef + ConvCoef + 3 * ( kSoil / dS ) + ( rho * Cp / DeltaTime ) );
 
-								//-Update Equation, basically a detailed energy balance at the surface
-								PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = ( QSolAbsorbed + RadCoef * SkyTemp + ConvCoef * OutDryBulbTemp + ( kSoil / dS ) * ( NodeBelow + 2 * NodeLeft ) + ( rho * Cp / DeltaTime ) * NodePast ) / ( RadCoef + ConvCoef + 3 * ( kSoil / dS ) + ( rho * Cp / DeltaTime ) );
+						} //Soil-to-air surface node structure
 
-							} else { //Soil surface, but not on centerline
+					} else if ( WidthIndex == PipeHT( PipeHTNum ).PipeNodeWidth ) { //On Symmetric centerline boundary
 
-								//-Coefficients and Temperatures
-								NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
-								NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex, CurrentTimeIndex );
-								NodeRight = PipeHT( PipeHTNum ).T( WidthIndex + 1, DepthIndex, LengthIndex, CurrentTimeIndex );
+						if ( DepthIndex == PipeHT( PipeHTNum ).PipeNodeDepth ) { //On the node containing the pipe
 
-								//-Update Equation
-								PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = ( QSolAbsorbed + RadCoef * SkyTemp + ConvCoef * OutDryBulbTemp + ( kSoil / dS ) * ( NodeBelow + NodeLeft + NodeRight ) + ( rho * Cp / DeltaTime ) * NodePast ) / ( RadCoef + ConvCoef + 3 * ( kSoil / dS ) + ( rho * Cp / DeltaTime ) );
+							//-Call to simulate a single pipe segment (by passing OPTIONAL LengthIndex argument)
+							CalcPipesHeatTransfer( PipeHTNum, LengthIndex );
 
-							} //Soil-to-air surface node structure
+							//-Update node for cartesian system
+							PipeHT( PipeHTNum ).TentativeT( WidthIndex, DepthIndex, LengthIndex ) = PipeHT( PipeHTNum ).PipeTemp( LengthIndex );
 
-						} else if ( WidthIndex == PipeHT( PipeHTNum ).PipeNodeWidth ) { //On Symmetric centerline boundary
+						} else if ( DepthIndex != 1 ) { //Not surface node
 
-							if ( DepthIndex == PipeHT( PipeHTNum ).PipeNodeDepth ) { //On the node containing the pipe
+							//-Coefficients and Temperatures
+							NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex );
+							NodeAbove = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex - 1, LengthIndex );
+							NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex );
+							NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex );
+							A1 = PipeHT( PipeHTNum ).CoefA1;
+							A2 = PipeHT( PipeHTNum ).CoefA2;
 
-								//-Call to simulate a single pipe segment (by passing OPTIONAL LengthIndex argument)
-								CalcPipesHeatTransfer( PipeHTNum, LengthIndex );
+							//-Update Equation
+							PipeHT( PipeHTNum ).TentativeT( WidthIndex, DepthIndex, LengthIndex ) = A1 * ( NodeBelow + NodeAbove + 2 * NodeLeft ) + A2 * NodePast;
 
-								//-Update node for cartesian system
-								PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = PipeHT( PipeHTNum ).PipeTemp( LengthIndex );
+						} //Symmetric centerline node structure
 
-							} else if ( DepthIndex != 1 ) { //Not surface node
+					} else { //All Normal Interior Nodes
 
-								//-Coefficients and Temperatures
-								NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex, CurrentTimeIndex );
-								NodeAbove = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex - 1, LengthIndex, CurrentTimeIndex );
-								NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
-								NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex - 1 );
-								A1 = PipeHT( PipeHTNum ).CoefA1;
-								A2 = PipeHT( PipeHTNum ).CoefA2;
+						//-Coefficients and Temperatures
+						A1 = PipeHT( PipeHTNum ).CoefA1;
+						A2 = PipeHT( PipeHTNum ).CoefA2;
+						NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex );
+						NodeAbove = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex - 1, LengthIndex );
+						NodeRight = PipeHT( PipeHTNum ).T( WidthIndex + 1, DepthIndex, LengthIndex );
+						NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex );
+						NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex );
 
-								//-Update Equation
-								PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = A1 * ( NodeBelow + NodeAbove + 2 * NodeLeft ) + A2 * NodePast;
+						//-Update Equation
+						PipeHT( PipeHTNum ).TentativeT( WidthIndex, DepthIndex, LengthIndex ) = A1 * ( NodeBelow + NodeAbove + NodeRight + NodeLeft ) + A2 * NodePast; //Eq. D1
 
-							} //Symmetric centerline node structure
+					}
+				}
+			}
+		}
 
-						} else { //All Normal Interior Nodes
+		gio::close( 112 );
 
-							//-Coefficients and Temperatures
-							A1 = PipeHT( PipeHTNum ).CoefA1;
-							A2 = PipeHT( PipeHTNum ).CoefA2;
-							NodeBelow = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
-							NodeAbove = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex - 1, LengthIndex, CurrentTimeIndex );
-							NodeRight = PipeHT( PipeHTNum ).T( WidthIndex + 1, DepthIndex, LengthIndex, CurrentTimeIndex );
-							NodeLeft = PipeHT( PipeHTNum ).T( WidthIndex - 1, DepthIndex, LengthIndex, CurrentTimeIndex );
-							NodePast = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex - 1 );
+	}
 
-							//-Update Equation
-							PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = A1 * ( NodeBelow + NodeAbove + NodeRight + NodeLeft ) + A2 * NodePast; //Eq. D1
+	//==============================================================================
+
+	void
+	SolveBuriedPipeSoil( int const PipeHTNum ) // Current Simulation Pipe Number
+	{
+
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Alternative to CalcBuriedPipeSoil (BuriedPipeImplicitSolve environment variable) in which
+		// the soil nodes of each pipe section are fully implicit in time.
+
+		// METHODOLOGY EMPLOYED:
+		// The node equations are those of CalcBuriedPipeSoil with the neighbour temperatures taken at
+		// the end of the time step.  The pipe node is set from the Hanby model as there.  The soil
+		// nodes of a section (widths 2 to PipeNodeWidth, depths 1 to NumDepthNodes-1) are numbered
+		// a depth row at a time, so each equation only couples nodes less than a row apart, and the
+		// banded system is solved by Gaussian elimination.  The equations are diagonally dominant,
+		// so no pivoting is needed.
+
+		// REFERENCES: See Module Level Description
+
+		// Using/Aliasing
+		using DataEnvironment::OutDryBulbTemp;
+		using DataEnvironment::SkyTemp;
+		using DataEnvironment::WindSpeed;
+		using DataEnvironment::BeamSolarRad;
+		using DataEnvironment::DifSolarRad;
+		using DataEnvironment::SOLCOS;
+		using DataGlobals::KelvinConv;
+		using DataGlobals::rTinyValue;
+		using ConvectionCoefficients::CalcASHRAESimpExtConvectCoeff;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const StefBoltzmann( 5.6697e-08 ); // Stefan-Boltzmann constant
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< Real64 > Band; // Band of the section matrix, a row at a time
+		static std::vector< Real64 > RHS; // Right hand sides, then the solution
+		auto & ThisPipe( PipeHT( PipeHTNum ) );
+		int const NumWidth( ThisPipe.PipeNodeWidth - 1 ); // Unknown nodes in a depth row
+		int const NumDepth( ThisPipe.NumDepthNodes - 1 ); // Depth rows of unknown nodes
+		int const NumNodes( NumWidth * NumDepth ); // Unknown nodes in a section
+		int const HalfBand( NumWidth ); // Half bandwidth
+		int const BandWidth( 2 * HalfBand + 1 );
+		Real64 const Fourier( ThisPipe.SoilDiffusivity * DeltaTime / pow_2( ThisPipe.dSregular ) ); //Eq. D4
+		Real64 const kdS( ThisPipe.SoilConductivity / ThisPipe.dSregular ); // Surface node conductance
+		Real64 const rhoCpdt( ThisPipe.SoilDensity * ThisPipe.SoilCp / DeltaTime ); // Surface node capacitance term
+		Real64 ConvCoef; // Current convection coefficient = f(Wind Speed,Roughness)
+		Real64 QSolAbsorbed; // Current total solar energy absorbed
+		Real64 SkyTempAbs; // Current sky temperature in Kelvin
+
+		if ( NumNodes <= 0 ) return;
+
+		ThisPipe.FourierDS = Fourier;
+		ThisPipe.CoefA1 = Fourier / ( 1 + 4 * Fourier ); //Eq. D2
+		ThisPipe.CoefA2 = 1 / ( 1 + 4 * Fourier ); //Eq. D3
+
+		// Surface conditions, the same for the whole surface
+		ThisPipe.OutdoorConvCoef = CalcASHRAESimpExtConvectCoeff( ThisPipe.SoilRoughness, WindSpeed );
+		ConvCoef = ThisPipe.OutdoorConvCoef;
+		QSolAbsorbed = ThisPipe.SolarExposed ? ThisPipe.SoilSolarAbs * ( max( SOLCOS( 3 ), 0.0 ) * BeamSolarRad + DifSolarRad ) : 0.0;
+		SkyTempAbs = SkyTemp + KelvinConv;
+
+		Band.resize( NumNodes * BandWidth );
+		RHS.resize( NumNodes );
+
+		for ( int LengthIndex = 1; LengthIndex <= ThisPipe.NumSections; ++LengthIndex ) {
+
+			// The pipe node: the Hanby model for this section
+			CalcPipesHeatTransfer( PipeHTNum, LengthIndex );
+
+			std::fill( Band.begin(), Band.end(), 0.0 );
+			for ( int DepthIndex = 1; DepthIndex <= NumDepth; ++DepthIndex ) {
+				for ( int WidthIndex = 2; WidthIndex <= ThisPipe.PipeNodeWidth; ++WidthIndex ) {
+					int const Row( ( DepthIndex - 1 ) * NumWidth + WidthIndex - 2 );
+					Real64 * const A( &Band[ Row * BandWidth + HalfBand ] ); // A[ Col - Row ] is the coefficient of node Col
+					Real64 const NodePast( ThisPipe.T( WidthIndex, DepthIndex, LengthIndex ) );
+					bool const Centerline( WidthIndex == ThisPipe.PipeNodeWidth );
+
+					if ( Centerline && DepthIndex == ThisPipe.PipeNodeDepth ) { // The pipe node
+						A[ 0 ] = 1.0;
+						RHS[ Row ] = ThisPipe.PipeTemp( LengthIndex );
+						continue;
+					}
 
+					// Neighbour conductance (per unit of the node's own coefficient) and the right hand side
+					Real64 Cond;
+					if ( DepthIndex == 1 ) { //Soil Surface Boundary
+						Real64 const PastNodeTempAbs( NodePast + KelvinConv );
+						Real64 RadCoef( 0.0 );
+						if ( ThisPipe.SolarExposed && std::abs( PastNodeTempAbs - SkyTempAbs ) > rTinyValue ) {
+							RadCoef = StefBoltzmann * ThisPipe.SoilThermAbs * ( pow_4( PastNodeTempAbs ) - pow_4( SkyTempAbs ) ) / ( PastNodeTempAbs - SkyTempAbs );
 						}
+						Cond = kdS;
+						A[ 0 ] = RadCoef + ConvCoef + 3 * kdS + rhoCpdt;
+						RHS[ Row ] = QSolAbsorbed + RadCoef * SkyTemp + ConvCoef * OutDryBulbTemp + rhoCpdt * NodePast;
+					} else {
+						Cond = Fourier;
+						A[ 0 ] = 1 + 4 * Fourier;
+						RHS[ Row ] = NodePast;
 					}
-				}
-			}
 
-			//Check for convergence
-			for ( LengthIndex = 2; LengthIndex <= PipeHT( PipeHTNum ).NumSections; ++LengthIndex ) {
-				for ( DepthIndex = 1; DepthIndex <= PipeHT( PipeHTNum ).NumDepthNodes - 1; ++DepthIndex ) {
-					for ( WidthIndex = 2; WidthIndex <= PipeHT( PipeHTNum ).PipeNodeWidth; ++WidthIndex ) {
-						Ttemp = PipeHT( PipeHTNum ).T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex );
-						if ( std::abs( T_O( WidthIndex, DepthIndex, LengthIndex ) - Ttemp ) > ConvCrit ) goto IterationLoop_loop;
+					// Left neighbour (twice on the symmetric centerline); width 1 is the farfield boundary
+					Real64 const LeftCond( Centerline ? 2 * Cond : Cond );
+					if ( WidthIndex == 2 ) {
+						RHS[ Row ] += LeftCond * ThisPipe.T( 1, DepthIndex, LengthIndex );
+					} else {
+						A[ -1 ] -= LeftCond;
+					}
+					if ( ! Centerline ) A[ 1 ] -= Cond;
+					// Node below; the last depth is the bottom boundary
+					if ( DepthIndex == NumDepth ) {
+						RHS[ Row ] += Cond * ThisPipe.T( WidthIndex, ThisPipe.NumDepthNodes, LengthIndex );
+					} else {
+						A[ HalfBand ] -= Cond;
 					}
+					// Node above (none for surface nodes)
+					if ( DepthIndex > 1 ) A[ -HalfBand ] -= Cond;
 				}
 			}
 
-			//If we didn't cycle back, then the system is converged
-			//PipeHTReport(PipeHTNum)%PipeUGIters=IterationIndex
-			goto IterationLoop_exit;
+			// Forward elimination
+			for ( int k = 0; k < NumNodes; ++k ) {
+				Real64 const Pivot( Band[ k * BandWidth + HalfBand ] );
+				int const LastRow( min( k + HalfBand, NumNodes - 1 ) );
+				for ( int i = k + 1; i <= LastRow; ++i ) {
+					Real64 * const Ai( &Band[ i * BandWidth + HalfBand - i ] ); // Ai[ j ] is the coefficient of node j in row i
+					if ( Ai[ k ] == 0.0 ) continue;
+					Real64 const Factor( Ai[ k ] / Pivot );
+					Real64 const * const Ak( &Band[ k * BandWidth + HalfBand - k ] );
+					for ( int j = k; j <= LastRow; ++j ) Ai[ j ] -= Factor * Ak[ j ];
+					RHS[ i ] -= Factor * RHS[ k ];
+				}
+			}
+			// Back substitution
+			for ( int i = NumNodes - 1; i >= 0; --i ) {
+				Real64 const * const Ai( &Band[ i * BandWidth + HalfBand - i ] );
+				Real64 Sum( RHS[ i ] );
+				for ( int j = i + 1, e = min( i + HalfBand, NumNodes - 1 ); j <= e; ++j ) Sum -= Ai[ j ] * RHS[ j ];
+				RHS[ i ] = Sum / Ai[ i ];
+			}
 
-			IterationLoop_loop: ;
+			for ( int DepthIndex = 1; DepthIndex <= NumDepth; ++DepthIndex ) {
+				for ( int WidthIndex = 2; WidthIndex <= ThisPipe.PipeNodeWidth; ++WidthIndex ) {
+					ThisPipe.TentativeT( WidthIndex, DepthIndex, LengthIndex ) = RHS[ ( DepthIndex - 1 ) * NumWidth + WidthIndex - 2 ];
+				}
+			}
 		}
-		IterationLoop_exit: ;
-
-		gio::close( 112 );
 
 	}
 
@@ -1765,11 +1837,10 @@ namespace PipeHeatTransfer {
 		PipeHTReport( PipeHTNum ).PipeInletTemp = PipeHT( PipeHTNum ).PipeTemp( 1 );
 		PipeHTReport( PipeHTNum ).PipeOutletTemp = PipeHT( PipeHTNum ).PipeTemp( PipeHT( PipeHTNum ).NumSections );
 
-		// need to average the heat rate because it is now summing over multiple inner time steps
-		PipeHTReport( PipeHTNum ).EnvironmentHeatLossRate = EnvHeatLossRate / NumInnerTimeSteps;
+		PipeHTReport( PipeHTNum ).EnvironmentHeatLossRate = EnvHeatLossRate;
 		PipeHTReport( PipeHTNum ).EnvHeatLossEnergy = PipeHTReport( PipeHTNum ).EnvironmentHeatLossRate * DeltaTime;
 
-		// for zone heat gains, we assign the averaged heat rate over all inner time steps
+		// for zone heat gains, we assign the heat rate over the time step
 		if ( PipeHT( PipeHTNum ).EnvironmentPtr == ZoneEnv ) {
 			PipeHT( PipeHTNum ).ZoneHeatGainRate = PipeHTReport( PipeHTNum ).EnvironmentHeatLossRate;
 		}
@@ -3,7 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
-#include <ObjexxFCL/Array4D.hh>
+#include <ObjexxFCL/Array3D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -25,12 +25,6 @@ namespace PipeHeatTransfer {
 	extern int const OutsideAirEnv;
 	extern int const GroundEnv;
 
-	extern int const PreviousTimeIndex;
-	extern int const CurrentTimeIndex;
-	extern int const TentativeTimeIndex;
-
-	extern Real64 const InnerDeltaTime; // one minute time step in seconds
-
 	// DERIVED TYPE DEFINITIONS
 
 	// the model data structures
@@ -49,7 +43,6 @@ namespace PipeHeatTransfer {
 	extern Real64 EnvHeatLossRate; // heat loss rate from pipe to the environment
 	extern Real64 FluidHeatLossRate; // overall heat loss from fluid to pipe
 	extern bool GetPipeInputFlag; // First time, input is "gotten"
-	extern int NumInnerTimeSteps; // the number of "inner" time steps for our model
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -103,10 +96,8 @@ namespace PipeHeatTransfer {
 		Real64 PreviousSimTime; // simulation time the report data was last updated
 		Array1D< Real64 > TentativeFluidTemp;
 		Array1D< Real64 > FluidTemp; // arrays for fluid and pipe temperatures at each node
-		Array1D< Real64 > PreviousFluidTemp;
 		Array1D< Real64 > TentativePipeTemp;
 		Array1D< Real64 > PipeTemp;
-		Array1D< Real64 > PreviousPipeTemp;
 		int NumDepthNodes; // number of soil grid points in the depth direction
 		int PipeNodeDepth; // soil depth grid point where pipe is located
 		int PipeNodeWidth; // soil width grid point where pipe is located
@@ -136,7 +127,8 @@ namespace PipeHeatTransfer {
 		Real64 SoilDiffusivity; // soil thermal diffusivity [m2/s]
 		Real64 SoilDiffusivityPerDay; // soil thermal diffusivity [m2/day]
 		int AvgAnnualManualInput; // flag for method of bringing in annual avg data yes-1 no-0
-		Array4D< Real64 > T; // soil temperature array
+		Array3D< Real64 > T; // soil temperature array (accepted values, at the start of the time step)
+		Array3D< Real64 > TentativeT; // soil temperatures at the end of the time step being solved for
 		bool BeginSimInit; // begin sim and begin environment flag
 		bool BeginSimEnvrn; // begin sim and begin environment flag
 		bool FirstHVACupdateFlag;
@@ -271,10 +263,8 @@ namespace PipeHeatTransfer {
 			Real64 const PreviousSimTime, // simulation time the report data was last updated
 			Array1< Real64 > const & TentativeFluidTemp,
 			Array1< Real64 > const & FluidTemp, // arrays for fluid and pipe temperatures at each node
-			Array1< Real64 > const & PreviousFluidTemp,
 			Array1< Real64 > const & TentativePipeTemp,
 			Array1< Real64 > const & PipeTemp,
-			Array1< Real64 > const & PreviousPipeTemp,
 			int const NumDepthNodes, // number of soil grid points in the depth direction
 			int const PipeNodeDepth, // soil depth grid point where pipe is located
 			int const PipeNodeWidth, // soil width grid point where pipe is located
@@ -304,7 +294,8 @@ namespace PipeHeatTransfer {
 			Real64 const SoilDiffusivity, // soil thermal diffusivity [m2/s]
 			Real64 const SoilDiffusivityPerDay, // soil thermal diffusivity [m2/day]
 			int const AvgAnnualManualInput, // flag for method of bringing in annual avg data yes-1 no-0
-			Array4< Real64 > const & T, // soil temperature array
+			Array3< Real64 > const & T, // soil temperature array (accepted values, at the start of the time step)
+			Array3< Real64 > const & TentativeT, // soil temperatures at the end of the time step being solved for
 			bool const BeginSimInit, // begin sim and begin environment flag
 			bool const BeginSimEnvrn, // begin sim and begin environment flag
 			bool const FirstHVACupdateFlag,
@@ -361,10 +352,8 @@ namespace PipeHeatTransfer {
 			PreviousSimTime( PreviousSimTime ),
 			TentativeFluidTemp( TentativeFluidTemp ),
 			FluidTemp( FluidTemp ),
-			PreviousFluidTemp( PreviousFluidTemp ),
 			TentativePipeTemp( TentativePipeTemp ),
 			PipeTemp( PipeTemp ),
-			PreviousPipeTemp( PreviousPipeTemp ),
 			NumDepthNodes( NumDepthNodes ),
 			PipeNodeDepth( PipeNodeDepth ),
 			PipeNodeWidth( PipeNodeWidth ),
@@ -395,6 +384,7 @@ namespace PipeHeatTransfer {
 			SoilDiffusivityPerDay( SoilDiffusivityPerDay ),
 			AvgAnnualManualInput( AvgAnnualManualInput ),
 			T( T ),
+			TentativeT( TentativeT ),
 			BeginSimInit( BeginSimInit ),
 			BeginSimEnvrn( BeginSimEnvrn ),
 			FirstHVACupdateFlag( FirstHVACupdateFlag ),
@@ -484,9 +474,6 @@ namespace PipeHeatTransfer {
 
 	//==============================================================================
 
-	void
-	PushInnerTimeStepArrays( int const PipeHTNum );
-
 	void
 	GetPipesHeatTransfer();
 
@@ -531,6 +518,9 @@ namespace PipeHeatTransfer {
 	void
 	CalcBuriedPipeSoil( int const PipeHTNum ); // Current Simulation Pipe Number
 
+	void
+	SolveBuriedPipeSoil( int const PipeHTNum ); // Current Simulation Pipe Number
+
 	//==============================================================================
 
 	void
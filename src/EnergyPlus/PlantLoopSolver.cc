@@ -1866,6 +1866,7 @@ namespace PlantLoopSolver {
 		//       AUTHOR         Brandon Anderson, Dan Fisher
 		//       DATE WRITTEN   October 1999
 		//       MODIFIED       May 2005 Sankaranarayanan K P, Rich Liesen
+		//                      Oct 2026, check plant convergence once and reuse the branch requests
 		//       RE-ENGINEERED  Sept 2010 Dan Fisher, Brent Griffith for demand side update
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1895,6 +1896,7 @@ namespace PlantLoopSolver {
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
 		using General::RoundSigDigits;
+		using PlantUtilities::CheckPlantConvergence;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1939,6 +1941,7 @@ namespace PlantLoopSolver {
 		int CompCounter;
 		int CompInletNode;
 		int CompOutletNode;
+		bool PlantIsRigid; // Loop side has converged, so the pushed flows also lock the min/max avails
 
 		auto & this_loopside( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
 
@@ -1980,6 +1983,9 @@ namespace PlantLoopSolver {
 				ShowFatalError( "Invalid plant topology causes program termination." );
 			}
 
+			// Pushing the resolved flows down the branches does not change the convergence history
+			PlantIsRigid = CheckPlantConvergence( LoopNum, LoopSideNum, FirstHVACIteration );
+
 			NumActiveBranches = 0;
 			ParallelBranchMaxAvail = 0.0;
 			ParallelBranchMinAvail = 0.0;
@@ -2066,7 +2072,7 @@ namespace PlantLoopSolver {
 				FirstNodeOnBranch = this_loopside.Branch( SplitterBranchOut ).NodeNumIn;
 				if ( this_loopside.Branch( SplitterBranchOut ).ControlType != ControlType_Active && this_loopside.Branch( SplitterBranchOut ).ControlType != ControlType_SeriesActive ) {
 					Node( FirstNodeOnBranch ).MassFlowRate = 0.0;
-					PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+					PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 				}
 			}
 
@@ -2096,7 +2102,7 @@ namespace PlantLoopSolver {
 						// branch flow is min of requested flow and remaining flow
 						Node( FirstNodeOnBranch ).MassFlowRate = min( Node( FirstNodeOnBranch ).MassFlowRate, FlowRemaining );
 						if ( Node( FirstNodeOnBranch ).MassFlowRate < MassFlowTolerance ) Node( FirstNodeOnBranch ).MassFlowRate = 0.0;
-						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 						FlowRemaining -= Node( FirstNodeOnBranch ).MassFlowRate;
 						if ( FlowRemaining < MassFlowTolerance ) FlowRemaining = 0.0;
 					}
@@ -2133,7 +2139,7 @@ namespace PlantLoopSolver {
 								Node( FirstNodeOnBranch ).MassFlowRate = min( Node( FirstNodeOnBranch ).MassFlowRateMaxAvail, FlowRemaining );
 								FlowRemaining -= Node( FirstNodeOnBranch ).MassFlowRate;
 							}
-							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 						}
 					}
 				} //totalMax <=0 and flow should be assigned to active branches
@@ -2146,7 +2152,7 @@ namespace PlantLoopSolver {
 					FirstNodeOnBranch = this_loopside.Branch( SplitterBranchOut ).NodeNumIn;
 					if ( this_loopside.Branch( SplitterBranchOut ).ControlType == ControlType_Bypass ) {
 						Node( FirstNodeOnBranch ).MassFlowRate = min( FlowRemaining, Node( FirstNodeOnBranch ).MassFlowRateMaxAvail );
-						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 						FlowRemaining -= Node( FirstNodeOnBranch ).MassFlowRate;
 					}
 				}
@@ -2165,7 +2171,7 @@ namespace PlantLoopSolver {
 							//set the flow rate to the MIN((MassFlowRate+AvtiveFlowRate), MaxAvail)
 							StartingFlowRate = Node( FirstNodeOnBranch ).MassFlowRate;
 							Node( FirstNodeOnBranch ).MassFlowRate = min( ( Node( FirstNodeOnBranch ).MassFlowRate + ActiveFlowRate ), Node( FirstNodeOnBranch ).MassFlowRateMaxAvail );
-							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 							//adjust the remaining flow
 							FlowRemaining -= ( Node( FirstNodeOnBranch ).MassFlowRate - StartingFlowRate );
 						}
@@ -2183,7 +2189,7 @@ namespace PlantLoopSolver {
 							ActiveFlowRate = min( FlowRemaining, ( Node( FirstNodeOnBranch ).MassFlowRateMaxAvail - StartingFlowRate ) );
 							FlowRemaining -= ActiveFlowRate;
 							Node( FirstNodeOnBranch ).MassFlowRate = StartingFlowRate + ActiveFlowRate;
-							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+							PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 						}
 					}
 				}
@@ -2203,12 +2209,12 @@ namespace PlantLoopSolver {
 				SplitterBranchIn = this_loopside.Splitter( SplitNum ).BranchNumIn;
 				FirstNodeOnBranchIn = this_loopside.Branch( SplitterBranchIn ).NodeNumIn;
 				Node( FirstNodeOnBranchIn ).MassFlowRate = TotParallelBranchFlowReq;
-				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchIn, Node( FirstNodeOnBranchIn ).MassFlowRate, FirstHVACIteration );
+				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchIn, Node( FirstNodeOnBranchIn ).MassFlowRate, PlantIsRigid );
 				// Reset the flow on the Mixer outlet branch
 				MixerBranchOut = this_loopside.Mixer( SplitNum ).BranchNumOut;
 				FirstNodeOnBranchOut = this_loopside.Branch( MixerBranchOut ).NodeNumIn;
 				Node( FirstNodeOnBranchOut ).MassFlowRate = TotParallelBranchFlowReq;
-				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, MixerBranchOut, Node( FirstNodeOnBranchOut ).MassFlowRate, FirstHVACIteration );
+				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, MixerBranchOut, Node( FirstNodeOnBranchOut ).MassFlowRate, PlantIsRigid );
 				return;
 
 				//IF INSUFFICIENT FLOW TO MEET ALL PARALLEL BRANCH FLOW REQUESTS
@@ -2219,33 +2225,21 @@ namespace PlantLoopSolver {
 				for ( OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum ) {
 
 					SplitterBranchOut = this_loopside.Splitter( SplitNum ).BranchNumOut( OutletNum );
-					ThisBranchRequest = DetermineBranchFlowRequest( LoopNum, LoopSideNum, SplitterBranchOut );
 					FirstNodeOnBranch = this_loopside.Branch( SplitterBranchOut ).NodeNumIn;
 					auto & this_splitter_outlet_branch( this_loopside.Branch( SplitterBranchOut ) );
 
 					if ( ( this_splitter_outlet_branch.ControlType == ControlType_Active ) || ( this_splitter_outlet_branch.ControlType == ControlType_SeriesActive ) ) {
 
-						// since we are calculating this fraction based on the total parallel request calculated above, we must mimic the logic to make sure the math works every time
-						// that means we must make the variable speed pump correction here as well.
-						for ( CompCounter = 1; CompCounter <= this_splitter_outlet_branch.TotalComponents; ++CompCounter ) {
-
-							auto & this_comp( this_splitter_outlet_branch.Comp( CompCounter ) );
-
-							//if this isn't a variable speed pump then just keep cycling
-							if ( ( this_comp.TypeOf_Num != TypeOf_PumpVariableSpeed ) && ( this_comp.TypeOf_Num != TypeOf_PumpBankVariableSpeed ) ) {
-								continue;
-							}
-
-							CompInletNode = this_comp.NodeNumIn;
-							ThisBranchRequest = max( ThisBranchRequest, Node( CompInletNode ).MassFlowRateRequest );
-
-						}
+						// since we are calculating this fraction based on the total parallel request calculated above, we must use the same request,
+						// including the variable speed pump correction; it was left on the branch inlet node, and only the non-active
+						// branches have been pushed since
+						ThisBranchRequest = Node( FirstNodeOnBranch ).MassFlowRate;
 
 						ThisBranchRequestFrac = ThisBranchRequest / TotParallelBranchFlowReq;
 						//    FracFlow = Node(FirstNodeOnBranch)%MassFlowRate/TotParallelBranchFlowReq
 						//    Node(FirstNodeOnBranch)%MassFlowRate = MIN((FracFlow * Node(FirstNodeOnBranch)%MassFlowRate),FlowRemaining)
 						Node( FirstNodeOnBranch ).MassFlowRate = ThisBranchRequestFrac * ThisLoopSideFlow;
-						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+						PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 						FlowRemaining -= Node( FirstNodeOnBranch ).MassFlowRate;
 
 					}
@@ -2266,7 +2260,7 @@ namespace PlantLoopSolver {
 				MixerBranchOut = this_loopside.Mixer( SplitNum ).BranchNumOut;
 				FirstNodeOnBranchOut = this_loopside.Branch( MixerBranchOut ).NodeNumIn;
 				Node( FirstNodeOnBranchOut ).MassFlowRate = TotParallelBranchFlowReq;
-				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, MixerBranchOut, Node( FirstNodeOnBranchOut ).MassFlowRate, FirstHVACIteration );
+				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, MixerBranchOut, Node( FirstNodeOnBranchOut ).MassFlowRate, PlantIsRigid );
 
 			} // Total flow requested >= or < Total parallel request
 
@@ -2289,6 +2283,7 @@ namespace PlantLoopSolver {
 		// Using/Aliasing
 		using DataLoopNode::Node;
 		using DataPlant::PlantLoop;
+		using PlantUtilities::CheckPlantConvergence;
 
 		// Locals
 		int const SplitNum( 1 );
@@ -2297,14 +2292,16 @@ namespace PlantLoopSolver {
 		int NumSplitOutlets;
 		int SplitterBranchOut;
 		int FirstNodeOnBranch;
+		bool PlantIsRigid;
 
 		if ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SplitterExists && PlantLoop( LoopNum ).LoopSide( LoopSideNum ).MixerExists ) {
 
+			PlantIsRigid = CheckPlantConvergence( LoopNum, LoopSideNum, FirstHVACIteration );
 			NumSplitOutlets = PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Splitter( SplitNum ).TotalOutletNodes;
 			for ( OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum ) {
 				SplitterBranchOut = PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Splitter( SplitNum ).BranchNumOut( OutletNum );
 				FirstNodeOnBranch = PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( SplitterBranchOut ).NodeNumIn;
-				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, FirstHVACIteration );
+				PushBranchFlowCharacteristics( LoopNum, LoopSideNum, SplitterBranchOut, Node( FirstNodeOnBranch ).MassFlowRate, PlantIsRigid );
 			}
 
 		}
@@ -2439,14 +2436,14 @@ namespace PlantLoopSolver {
 		int const LoopSideNum,
 		int const BranchNum,
 		Real64 const ValueToPush,
-		bool const FirstHVACIteration // TRUE if First HVAC iteration of Time step
+		bool const PlantIsRigid // TRUE if the loop side has converged, see CheckPlantConvergence
 	)
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   September 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, convergence check is done once by the caller
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2477,7 +2474,6 @@ namespace PlantLoopSolver {
 		using namespace DataPlant; // Use the entire module to allow all TypeOf's, would be a huge ONLY list
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
-		using PlantUtilities::CheckPlantConvergence;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2500,7 +2496,6 @@ namespace PlantLoopSolver {
 		int ComponentTypeOfNum;
 		Real64 MassFlowRateFound;
 		Real64 MassFlow;
-		bool PlantIsRigid;
 
 		auto & this_loopside( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
 		auto & this_branch( this_loopside.Branch( BranchNum ) );
@@ -2518,8 +2513,6 @@ namespace PlantLoopSolver {
 		//MinAvail = ValueToPush
 		// MaxAvail = ValueToPush
 
-		PlantIsRigid = CheckPlantConvergence( LoopNum, LoopSideNum, FirstHVACIteration );
-
 		//~ Loop across all component outlet nodes and update their mass flow and max avail
 		for ( CompCounter = 1; CompCounter <= this_branch.TotalComponents; ++CompCounter ) {
 
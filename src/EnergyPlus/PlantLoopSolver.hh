@@ -268,7 +268,7 @@ namespace PlantLoopSolver {
 		int const LoopSideNum,
 		int const BranchNum,
 		Real64 const ValueToPush,
-		bool const FirstHVACIteration // TRUE if First HVAC iteration of Time step
+		bool const PlantIsRigid // TRUE if the loop side has converged, see CheckPlantConvergence
 	);
 
 	//==================================================================!
@@ -18,6 +18,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -95,6 +96,7 @@ namespace PlantManager {
 	Array1D_int SupplySideInletNode; // Node number for the supply side inlet
 	Array1D_int SupplySideOutletNode; // Node number for the supply side outlet
 	Array1D_int DemandSideInletNode; // Inlet node on the demand side
+	Array1D_int LoopMinPlantSubIterations; // Minimum number of plant subiterations of each loop
 
 	// SUBROUTINE SPECIFICATIONS:
 	//The following public routines are called from HVAC Manager
@@ -122,7 +124,7 @@ namespace PlantManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Sankaranarayanan K P
 		//       DATE WRITTEN   Apr 2005
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, timed as a region of the timing profile
 		//       RE-ENGINEERED  B. Griffith, Feb. 2010
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -132,6 +134,9 @@ namespace PlantManager {
 		// Set up the while iteration block for the plant loop simulation.
 		// Calls half loop sides to be simulated in predetermined order.
 		// Reset the flags as necessary
+		// Half loops are simulated at least the minimum number of subiterations of their loop,
+		// which is larger for the loops interconnected with a common pipe (see
+		// SetLoopMinPlantSubIterations).  After that only half loops that need it are simulated.
 
 		// REFERENCES:
 		// na
@@ -158,6 +163,8 @@ namespace PlantManager {
 		int HalfLoopNum;
 		int CurntMinPlantSubIterations;
 
+		DataTimings::ProfileTimer const profileTimer( "ManagePlantLoops" ); // Region of the timing profile
+
 		if ( any_eq( PlantLoop.CommonPipeType(), CommonPipe_Single ) || any_eq( PlantLoop.CommonPipeType(), CommonPipe_TwoWay ) ) {
 			CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
 		} else {
@@ -169,6 +176,8 @@ namespace PlantManager {
 			return;
 		}
 
+		SetLoopMinPlantSubIterations( CurntMinPlantSubIterations );
+
 		IterPlant = 0;
 		InitializeLoops( FirstHVACIteration );
 
@@ -186,7 +195,7 @@ namespace PlantManager {
 
 				SimHalfLoopFlag = this_loop_side.SimLoopSideNeeded; //set half loop sim flag
 
-				if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
+				if ( SimHalfLoopFlag || IterPlant <= LoopMinPlantSubIterations( LoopNum ) ) {
 
 					PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
 
@@ -204,6 +213,8 @@ namespace PlantManager {
 					PlantReport( LoopNum ).LastLoopSideSimulated = LoopSide;
 
 					++PlantManageHalfLoopCalls;
+				} else {
+					++PlantManageHalfLoopSkips;
 				}
 
 			} // half loop based calling order...
@@ -242,6 +253,95 @@ namespace PlantManager {
 
 	}
 
+	void
+	SetLoopMinPlantSubIterations( int const CommonPipeMinSubIterations ) // Minimum subiterations for loops with a common pipe
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets the minimum number of plant subiterations of each loop.  Common pipes
+		// need more subiterations to settle, but only the loops that exchange flow or heat with a
+		// loop that has a common pipe are affected by it: Loops that are not interconnected with
+		// such a loop (directly or through other loops) keep MinPlantSubIterations.
+
+		// METHODOLOGY EMPLOYED:
+		// The loop interconnections (from InterConnectTwoPlantLoopSides) are the edges of a graph
+		// of the loops.  Each connected group of loops is found by a breadth first search and gets
+		// the larger minimum if any of its loops has a common pipe.  The interconnections are only
+		// set up as components are first simulated, so the groups are found on every call.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataConvergParams::MinPlantSubIterations;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int LoopNum;
+		int LoopSide;
+		int ConnectNum;
+		int OtherLoopNum;
+		int NumInGroup; // Number of loops found in the group
+		int GroupLoopNum; // Loop of the group being searched
+		bool HasCommonPipe; // Some loop of the group has a common pipe
+		static Array1D_int GroupLoops; // Loops of the group in search order
+
+		if ( LoopMinPlantSubIterations.isize() != TotNumLoops ) {
+			LoopMinPlantSubIterations.dimension( TotNumLoops, 0 );
+			GroupLoops.dimension( TotNumLoops, 0 );
+		}
+
+		if ( CommonPipeMinSubIterations <= MinPlantSubIterations ) {
+			LoopMinPlantSubIterations = MinPlantSubIterations;
+			return;
+		}
+
+		LoopMinPlantSubIterations = 0; // Loop not yet in a group
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			if ( LoopMinPlantSubIterations( LoopNum ) != 0 ) continue;
+			NumInGroup = 1;
+			GroupLoops( 1 ) = LoopNum;
+			LoopMinPlantSubIterations( LoopNum ) = -1;
+			HasCommonPipe = false;
+			for ( GroupLoopNum = 1; GroupLoopNum <= NumInGroup; ++GroupLoopNum ) {
+				auto const & this_loop( PlantLoop( GroupLoops( GroupLoopNum ) ) );
+				if ( this_loop.CommonPipeType == CommonPipe_Single || this_loop.CommonPipeType == CommonPipe_TwoWay ) HasCommonPipe = true;
+				for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
+					auto const & this_loop_side( this_loop.LoopSide( LoopSide ) );
+					for ( ConnectNum = 1; ConnectNum <= this_loop_side.TotalConnected; ++ConnectNum ) {
+						OtherLoopNum = this_loop_side.Connected( ConnectNum ).LoopNum;
+						if ( OtherLoopNum < 1 || OtherLoopNum > TotNumLoops ) continue;
+						if ( LoopMinPlantSubIterations( OtherLoopNum ) != 0 ) continue;
+						LoopMinPlantSubIterations( OtherLoopNum ) = -1;
+						++NumInGroup;
+						GroupLoops( NumInGroup ) = OtherLoopNum;
+					}
+				}
+			}
+			for ( GroupLoopNum = 1; GroupLoopNum <= NumInGroup; ++GroupLoopNum ) {
+				LoopMinPlantSubIterations( GroupLoops( GroupLoopNum ) ) = ( HasCommonPipe ? CommonPipeMinSubIterations : MinPlantSubIterations );
+			}
+		}
+
+	}
+
 	void
 	GetPlantLoopData()
 	{
@@ -317,6 +417,8 @@ namespace PlantManager {
 		//  INTEGER :: OpSchemeFound
 
 		// FLOW:
+		DataTimings::ProfileTimer const profileTimer( "GetPlantLoopData" ); // Region of the timing profile
+
 		CurrentModuleObject = "PlantLoop";
 		NumPlantLoops = GetNumObjectsFound( CurrentModuleObject ); // Get the number of primary plant loops
 		CurrentModuleObject = "CondenserLoop";
@@ -735,6 +837,8 @@ namespace PlantManager {
 		int TypeOfNum;
 		int LoopNumInArray;
 
+		DataTimings::ProfileTimer const profileTimer( "GetPlantInput" ); // Region of the timing profile
+
 		GetObjectDefMaxArgs( "Connector:Splitter", NumParams, NumAlphas, NumNumbers );
 		MaxNumAlphas = NumAlphas;
 		MaxNumNumbers = NumNumbers;
@@ -40,6 +40,7 @@ namespace PlantManager {
 	extern Array1D_int SupplySideInletNode; // Node number for the supply side inlet
 	extern Array1D_int SupplySideOutletNode; // Node number for the supply side outlet
 	extern Array1D_int DemandSideInletNode; // Inlet node on the demand side
+	extern Array1D_int LoopMinPlantSubIterations; // Minimum number of plant subiterations of each loop
 
 	// SUBROUTINE SPECIFICATIONS:
 	//The following public routines are called from HVAC Manager
@@ -139,6 +140,9 @@ namespace PlantManager {
 		bool & SimElecCircuits // True when electic circuits need to be (re)simulated
 	);
 
+	void
+	SetLoopMinPlantSubIterations( int const CommonPipeMinSubIterations ); // Minimum subiterations for loops with a common pipe
+
 	void
 	GetPlantLoopData();
 
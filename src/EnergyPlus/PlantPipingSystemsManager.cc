@@ -24,6 +24,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -6494,7 +6495,7 @@ namespace PlantPipingSystemsManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   Summer 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, optional column line solve for the field cells
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -6510,12 +6511,17 @@ namespace PlantPipingSystemsManager {
 		// na
 		using DataGlobals::TimeStep;
 		using DataEnvironment::CurMnDyHr;
+		using DataSystemVariables::GroundDomainLineSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		// With the line solve, all field cells are updated first, a vertical column at a time;
+		// the boundary cells below then see the new field temperatures
+		if ( GroundDomainLineSolve ) PerformFieldCellColumnSweeps( DomainNum );
+
 		auto & cells( PipingSystemDomains( DomainNum ).Cells );
 		for ( int X = cells.l1(), X_end = cells.u1(); X <= X_end; ++X ) {
 			for ( int Y = cells.l2(), Y_end = cells.u2(); Y <= Y_end; ++Y ) {
@@ -6526,7 +6532,7 @@ namespace PlantPipingSystemsManager {
 					if ( SELECT_CASE_var == CellType_Pipe ) {
 						//'pipes are simulated separately
 					} else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
-						cell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, cell );
+						if ( ! GroundDomainLineSolve ) cell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, cell );
 					} else if ( SELECT_CASE_var == CellType_GroundSurface ) {
 						cell.MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, cell );
 					} else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
@@ -6553,6 +6559,162 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	bool
+	IsFieldCellType( int const CellType )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true for the cell types that are updated by EvaluateFieldCellTemperature
+
+		return ( ( CellType == CellType_GeneralField ) || ( CellType == CellType_Slab ) || ( CellType == CellType_HorizInsulation ) || ( CellType == CellType_VertInsulation ) );
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	PerformFieldCellColumnSweeps( int const DomainNum )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Updates all field cells of the domain with a line (column) Gauss-Seidel sweep instead of
+		// the cell by cell update in PerformTemperatureFieldUpdate.
+
+		// METHODOLOGY EMPLOYED:
+		// Each unbroken vertical run of field cells at a given X, Z is solved together: the Y neighbors
+		// inside the run are implicit, which makes the run a tridiagonal system solved with the Thomas
+		// algorithm, while the X and Z neighbors and the cells just outside the run take their current
+		// values.  The cell equations are the same as in EvaluateFieldCellTemperature, so the converged
+		// field is unchanged; the vertical coupling, which dominates for slabs and basements, just
+		// converges in far fewer outer iterations.
+		// The columns are visited in two passes by the parity of X + Z.  Columns of one parity only
+		// neighbor columns of the other, so each pass can be spread over threads and still give the
+		// same result for any thread count.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		using DataSystemVariables::NumberGroundDomainThreads;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static Array1D_int const Directions( 6, { Direction_PositiveX, Direction_NegativeX, Direction_PositiveY, Direction_NegativeY, Direction_PositiveZ, Direction_NegativeZ } );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		auto & cells( PipingSystemDomains( DomainNum ).Cells );
+		int const X_beg( cells.l1() );
+		int const X_end( cells.u1() );
+		int const Y_beg( cells.l2() );
+		int const Y_end( cells.u2() );
+		int const Z_beg( cells.l3() );
+		int const Z_end( cells.u3() );
+		int const NumY( Y_end - Y_beg + 1 );
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads( NumberGroundDomainThreads ) if ( ( NumberGroundDomainThreads > 1 ) && ( X_end > X_beg ) )
+#endif
+		{
+			// Tridiagonal coefficients of one run, private to each thread
+			Array1D< Real64 > Lower( NumY );
+			Array1D< Real64 > Diag( NumY );
+			Array1D< Real64 > Upper( NumY );
+			Array1D< Real64 > RHS( NumY );
+
+			for ( int Parity = 0; Parity <= 1; ++Parity ) {
+#ifdef _OPENMP
+#pragma omp for schedule( dynamic )
+#endif
+				for ( int X = X_beg; X <= X_end; ++X ) {
+					int const Z_first( ( std::abs( X + Z_beg ) % 2 == Parity ) ? Z_beg : Z_beg + 1 );
+					for ( int Z = Z_first; Z <= Z_end; Z += 2 ) {
+						int Y = Y_beg;
+						while ( Y <= Y_end ) {
+							if ( ! IsFieldCellType( cells( X, Y, Z ).CellType ) ) {
+								++Y;
+								continue;
+							}
+
+							// Find the run of field cells starting here
+							int const Y_first( Y );
+							while ( ( Y <= Y_end ) && IsFieldCellType( cells( X, Y, Z ).CellType ) ) ++Y;
+							int const Y_last( Y - 1 );
+
+							// Assemble the run
+							for ( int YRun = Y_first; YRun <= Y_last; ++YRun ) {
+								auto const & cell( cells( X, YRun, Z ) );
+								int const Index( YRun - Y_first + 1 );
+								Real64 const Beta( cell.MyBase.Beta );
+								Lower( Index ) = 0.0;
+								Upper( Index ) = 0.0;
+								Diag( Index ) = 1.0;
+								RHS( Index ) = cell.MyBase.Temperature_PrevTimeStep;
+								for ( int DirectionCounter = 1; DirectionCounter <= 6; ++DirectionCounter ) {
+									int const CurDirection( Directions( DirectionCounter ) );
+									// skip the directions that leave the domain, as in EvaluateCellNeighborDirections
+									if ( ( CurDirection == Direction_PositiveX ) && ( X == X_end ) ) continue;
+									if ( ( CurDirection == Direction_NegativeX ) && ( X == X_beg ) ) continue;
+									if ( ( CurDirection == Direction_PositiveY ) && ( YRun == Y_end ) ) continue;
+									if ( ( CurDirection == Direction_NegativeY ) && ( YRun == Y_beg ) ) continue;
+									if ( ( CurDirection == Direction_PositiveZ ) && ( Z == Z_end ) ) continue;
+									if ( ( CurDirection == Direction_NegativeZ ) && ( Z == Z_beg ) ) continue;
+									Real64 NeighborTemp;
+									Real64 Resistance;
+									EvaluateNeighborCharacteristics( DomainNum, cell, CurDirection, NeighborTemp, Resistance );
+									Real64 const Coefficient( Beta / Resistance );
+									Diag( Index ) += Coefficient;
+									if ( ( CurDirection == Direction_NegativeY ) && ( YRun > Y_first ) ) {
+										Lower( Index ) = -Coefficient;
+									} else if ( ( CurDirection == Direction_PositiveY ) && ( YRun < Y_last ) ) {
+										Upper( Index ) = -Coefficient;
+									} else {
+										RHS( Index ) += Coefficient * NeighborTemp;
+									}
+								}
+							}
+
+							// Thomas algorithm; the system is diagonally dominant so no pivoting is needed
+							int const NumRun( Y_last - Y_first + 1 );
+							for ( int Index = 2; Index <= NumRun; ++Index ) {
+								Real64 const Factor( Lower( Index ) / Diag( Index - 1 ) );
+								Diag( Index ) -= Factor * Upper( Index - 1 );
+								RHS( Index ) -= Factor * RHS( Index - 1 );
+							}
+							RHS( NumRun ) /= Diag( NumRun );
+							for ( int Index = NumRun - 1; Index >= 1; --Index ) {
+								RHS( Index ) = ( RHS( Index ) - Upper( Index ) * RHS( Index + 1 ) ) / Diag( Index );
+							}
+							for ( int YRun = Y_first; YRun <= Y_last; ++YRun ) {
+								cells( X, YRun, Z ).MyBase.Temperature = RHS( YRun - Y_first + 1 );
+							}
+						}
+					}
+				}
+			}
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateFieldCellTemperature(
 		int const DomainNum,
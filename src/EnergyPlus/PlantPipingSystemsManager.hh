@@ -785,6 +785,20 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	bool
+	IsFieldCellType( int const CellType );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	PerformFieldCellColumnSweeps( int const DomainNum );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateFieldCellTemperature(
 		int const DomainNum,
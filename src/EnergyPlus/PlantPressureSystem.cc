@@ -686,7 +686,7 @@ namespace PlantPressureSystem {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   August 2009
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, track the parallel branch maxima without temporary arrays
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -726,9 +726,8 @@ namespace PlantPressureSystem {
 		Real64 BranchPressureDrop;
 		Real64 LoopSidePressureDrop;
 		Real64 LoopPressureDrop;
-		Array1D< Real64 > ParallelBranchPressureDrops;
-		Array1D< Real64 > ParallelBranchInletPressures;
-		int ParallelBranchCounter;
+		Real64 ParallelBranchPressureDrop;
+		Real64 ParallelBranchInletPressure;
 		Real64 SplitterInletPressure;
 		Real64 MixerPressure;
 		bool FoundAPumpOnBranch;
@@ -773,21 +772,20 @@ namespace PlantPressureSystem {
 				//**********************!
 
 				//***PARALLEL BRANCHES***!
-				if ( allocated( ParallelBranchPressureDrops ) ) ParallelBranchPressureDrops.deallocate();
-				ParallelBranchPressureDrops.allocate( NumBranches - 2 );
-				if ( allocated( ParallelBranchInletPressures ) ) ParallelBranchInletPressures.deallocate();
-				ParallelBranchInletPressures.allocate( NumBranches - 2 );
-				ParallelBranchCounter = 0;
+				//Keep the max inlet pressure to pass across splitter and max branch pressure for bookkeeping
+				SplitterInletPressure = 0.0;
+				BranchPressureDrop = 0.0;
 				for ( BranchNum = NumBranches - 1; BranchNum >= 2; --BranchNum ) { //Working backward (not necessary, but consistent)
-					++ParallelBranchCounter;
-					DistributePressureOnBranch( LoopNum, LoopSideNum, BranchNum, ParallelBranchPressureDrops( ParallelBranchCounter ), FoundAPumpOnBranch );
-					//Store the branch inlet pressure so we can pass it properly across the splitter
-					ParallelBranchInletPressures( ParallelBranchCounter ) = Node( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).NodeNumIn ).Press;
+					DistributePressureOnBranch( LoopNum, LoopSideNum, BranchNum, ParallelBranchPressureDrop, FoundAPumpOnBranch );
+					ParallelBranchInletPressure = Node( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).NodeNumIn ).Press;
+					if ( BranchNum == NumBranches - 1 ) {
+						SplitterInletPressure = ParallelBranchInletPressure;
+						BranchPressureDrop = ParallelBranchPressureDrop;
+					} else {
+						SplitterInletPressure = max( SplitterInletPressure, ParallelBranchInletPressure );
+						BranchPressureDrop = max( BranchPressureDrop, ParallelBranchPressureDrop );
+					}
 				}
-
-				//Now take max inlet pressure to pass across splitter and max branch pressure for bookkeeping
-				SplitterInletPressure = maxval( ParallelBranchInletPressures );
-				BranchPressureDrop = maxval( ParallelBranchPressureDrops );
 				LoopSidePressureDrop += BranchPressureDrop;
 				LoopPressureDrop += BranchPressureDrop;
 				//**********************!
@@ -1275,7 +1273,7 @@ namespace PlantPressureSystem {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Kaustubh Phalak
 		//       DATE WRITTEN   Feb 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, keep the mass flow history in scalars
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1336,7 +1334,10 @@ namespace PlantPressureSystem {
 		bool Converged;
 		static int ZeroKWarningCounter( 0 );
 		static int MaxIterWarningCounter( 0 );
-		Array1D< Real64 > MassFlowIterativeHistory( 3 );
+		Real64 MassFlowLatest; // Mass flow rate of this iteration [kg/s]
+		Real64 MassFlowPrevious; // Mass flow rate of the previous iteration [kg/s]
+		Real64 MassFlowBeforePrevious; // Mass flow rate of the iteration before that [kg/s]
+		Real64 PhiDenominator; // Converts the mass flow rate to the non-dimensional flow phi
 		Real64 MdotDeltaLatest;
 		Real64 MdotDeltaPrevious;
 		Real64 DampingFactor;
@@ -1371,8 +1372,10 @@ namespace PlantPressureSystem {
 		Converged = false;
 
 		//Initialize the mass flow history array and damping factor
-		MassFlowIterativeHistory = LocalSystemMassFlow;
+		MassFlowLatest = LocalSystemMassFlow;
+		MassFlowPrevious = LocalSystemMassFlow;
 		DampingFactor = 0.9;
+		PhiDenominator = NodeDensity * PumpSpeed * PumpImpellerDia;
 
 		//Start Convergence Loop
 		for ( Iteration = 1; Iteration <= MaxIters; ++Iteration ) {
@@ -1380,9 +1383,11 @@ namespace PlantPressureSystem {
 			//Calculate System Mass Flow Rate
 			LocalSystemMassFlow = std::sqrt( SystemPressureDrop / LoopEffectiveK );
 
-			MassFlowIterativeHistory = eoshift( MassFlowIterativeHistory, -1, LocalSystemMassFlow );
+			MassFlowBeforePrevious = MassFlowPrevious;
+			MassFlowPrevious = MassFlowLatest;
+			MassFlowLatest = LocalSystemMassFlow;
 
-			PhiSystem = LocalSystemMassFlow / ( NodeDensity * PumpSpeed * PumpImpellerDia );
+			PhiSystem = LocalSystemMassFlow / PhiDenominator;
 
 			//4th order polynomial for non-dimensional pump curve
 			PhiPump = PhiSystem;
@@ -1407,8 +1412,8 @@ namespace PlantPressureSystem {
 			if ( Iteration < 2 ) {
 				//Don't do anything?
 			} else {
-				MdotDeltaLatest = std::abs( MassFlowIterativeHistory( 1 ) - MassFlowIterativeHistory( 2 ) );
-				MdotDeltaPrevious = std::abs( MassFlowIterativeHistory( 2 ) - MassFlowIterativeHistory( 3 ) );
+				MdotDeltaLatest = std::abs( MassFlowLatest - MassFlowPrevious );
+				MdotDeltaPrevious = std::abs( MassFlowPrevious - MassFlowBeforePrevious );
 				if ( MdotDeltaLatest < MdotDeltaPrevious ) {
 					//we are converging
 					//DampingFactor = MIN(DampingFactor * 1.1, 0.9d0)
@@ -9,6 +9,7 @@
 // EnergyPlus Headers
 #include <PlantUtilities.hh>
 #include <DataBranchAirLoopPlant.hh>
+#include <DataConvergParams.hh>
 #include <DataGlobals.hh>
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
@@ -1495,6 +1496,8 @@ namespace PlantUtilities {
 		// METHODOLOGY EMPLOYED:
 		// check if anything changed or doesn't agree and set simulation flags.
 		// update outlet conditions if needed or possible
+		// the loop sides are only flagged for simulation when the change is larger than the
+		// plant convergence tolerances, so round-off changes do not cause half loop calls
 
 		// REFERENCES:
 		// na
@@ -1504,6 +1507,8 @@ namespace PlantUtilities {
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
 		using FluidProperties::GetSpecificHeatGlycol;
+		using DataConvergParams::PlantFlowRateToler;
+		using DataConvergParams::PlantTemperatureToler;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1519,12 +1524,14 @@ namespace PlantUtilities {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool DidAnythingChange( false ); // set to true if conditions changed
+		bool SimNeeded; // set to true if conditions changed by more than the convergence tolerances
 		int OtherLoopNum; // local loop pointer for remote connected loop
 		int OtherLoopSide; // local loop side pointer for remote connected loop
 		int ConnectLoopNum; // local do loop counter
 		Real64 Cp;
 
 		DidAnythingChange = false;
+		SimNeeded = false;
 
 		//check if any conditions have changed
 		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
@@ -1535,6 +1542,14 @@ namespace PlantUtilities {
 
 		if ( Node( OutletNodeNum ).Temp != ModelOutletTemp ) DidAnythingChange = true;
 
+		if ( std::abs( Node( InletNodeNum ).MassFlowRate - ModelMassFlowRate ) > PlantFlowRateToler ) SimNeeded = true;
+
+		if ( std::abs( Node( OutletNodeNum ).MassFlowRate - ModelMassFlowRate ) > PlantFlowRateToler ) SimNeeded = true;
+
+		if ( std::abs( Node( InletNodeNum ).Temp - ModelInletTemp ) > PlantTemperatureToler ) SimNeeded = true;
+
+		if ( std::abs( Node( OutletNodeNum ).Temp - ModelOutletTemp ) > PlantTemperatureToler ) SimNeeded = true;
+
 		// could also check heat rate agains McDeltaT from node data
 
 		if ( ( Node( InletNodeNum ).MassFlowRate == 0.0 ) && ( ModelCondenserHeatRate > 0.0 ) ) {
@@ -1542,6 +1557,7 @@ namespace PlantUtilities {
 			// DSU3 TODO also send a request that condenser loop be made available, interlock message infrastructure??
 
 			DidAnythingChange = true;
+			SimNeeded = true;
 
 		}
 
@@ -1553,7 +1569,9 @@ namespace PlantUtilities {
 				Node( OutletNodeNum ).Temp = Node( InletNodeNum ).Temp + ModelCondenserHeatRate / ( Node( InletNodeNum ).MassFlowRate * Cp );
 
 			}
+		}
 
+		if ( SimNeeded || FirstHVACIteration ) {
 			// set sim flag for this loop
 			PlantLoop( LoopNum ).LoopSide( LoopSide ).SimLoopSideNeeded = true;
 
@@ -1602,6 +1620,8 @@ namespace PlantUtilities {
 		// METHODOLOGY EMPLOYED:
 		// check if anything changed or doesn't agree and set simulation flags.
 		// update outlet conditions if needed or possible
+		// the loop sides are only flagged for simulation when the change is larger than the
+		// plant convergence tolerances, so round-off changes do not cause half loop calls
 
 		// REFERENCES:
 		// na
@@ -1611,6 +1631,8 @@ namespace PlantUtilities {
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
 		using FluidProperties::GetSpecificHeatGlycol;
+		using DataConvergParams::PlantFlowRateToler;
+		using DataConvergParams::PlantTemperatureToler;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1626,6 +1648,7 @@ namespace PlantUtilities {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool DidAnythingChange( false ); // set to true if conditions changed
+		bool SimNeeded; // set to true if conditions changed by more than the convergence tolerances
 		int OtherLoopNum; // local loop pointer for remote connected loop
 		int OtherLoopSide; // local loop side pointer for remote connected loop
 		//  INTEGER :: CountConnectedLoops ! local total number of connected loops
@@ -1633,6 +1656,7 @@ namespace PlantUtilities {
 		Real64 Cp; // local fluid specific heat
 
 		DidAnythingChange = false;
+		SimNeeded = false;
 
 		//check if any conditions have changed
 		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
@@ -1643,12 +1667,21 @@ namespace PlantUtilities {
 
 		if ( Node( OutletNodeNum ).Temp != ModelOutletTemp ) DidAnythingChange = true;
 
+		if ( std::abs( Node( InletNodeNum ).MassFlowRate - ModelMassFlowRate ) > PlantFlowRateToler ) SimNeeded = true;
+
+		if ( std::abs( Node( OutletNodeNum ).MassFlowRate - ModelMassFlowRate ) > PlantFlowRateToler ) SimNeeded = true;
+
+		if ( std::abs( Node( InletNodeNum ).Temp - ModelInletTemp ) > PlantTemperatureToler ) SimNeeded = true;
+
+		if ( std::abs( Node( OutletNodeNum ).Temp - ModelOutletTemp ) > PlantTemperatureToler ) SimNeeded = true;
+
 		// could also check heat rate agains McDeltaT from node data
 
 		if ( ( Node( InletNodeNum ).MassFlowRate == 0.0 ) && ( ModelRecoveryHeatRate > 0.0 ) ) {
 			//no flow but trying to move heat to this loop problem!
 
 			DidAnythingChange = true;
+			SimNeeded = true;
 
 		}
 
@@ -1660,7 +1693,9 @@ namespace PlantUtilities {
 				Node( OutletNodeNum ).Temp = Node( InletNodeNum ).Temp + ModelRecoveryHeatRate / ( Node( InletNodeNum ).MassFlowRate * Cp );
 
 			}
+		}
 
+		if ( SimNeeded || FirstHVACIteration ) {
 			// set sim flag for this loop
 			PlantLoop( LoopNum ).LoopSide( LoopSide ).SimLoopSideNeeded = true;
 
@@ -1708,6 +1743,8 @@ namespace PlantUtilities {
 		// METHODOLOGY EMPLOYED:
 		// check if anything changed or doesn't agree and set simulation flags.
 		// update outlet conditions if needed or possible
+		// the loop sides are only flagged for simulation when the change is larger than the
+		// plant convergence tolerances, so round-off changes do not cause half loop calls
 
 		// REFERENCES:
 		// na
@@ -1717,6 +1754,7 @@ namespace PlantUtilities {
 		using DataLoopNode::Node;
 		using DataLoopNode::NodeType_Water;
 		using DataLoopNode::NodeType_Steam;
+		using DataConvergParams::PlantFlowRateToler;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1749,7 +1787,7 @@ namespace PlantUtilities {
 		}
 
 		//check if any conditions have changed
-		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
+		if ( std::abs( Node( InletNodeNum ).MassFlowRate - ModelMassFlowRate ) > PlantFlowRateToler ) DidAnythingChange = true;
 
 		if ( ( Node( InletNodeNum ).MassFlowRate == 0.0 ) && ( ModelGeneratorHeatRate > 0.0 ) ) {
 
@@ -112,6 +112,15 @@ namespace PondGroundHeatExchanger {
 	int WaterIndex( 0 ); // Fluid index for pond water
 	bool NoDeepGroundTempObjWarning( true ); // This will cause a warning to be issued if no "deep" ground
 	// temperature object was input.
+	// Boundary terms that do not depend on the pond temperature - evaluated once per step
+	Real64 PondExternalTemp( 0.0 ); // external environmental temp - drybulb or wetbulb
+	Real64 PondConvCoef( 0.0 ); // convection coefficient
+	Real64 PondSolarFlux( 0.0 ); // absorbed solar flux
+	Real64 PondFluidSpecHeat( 0.0 ); // loop fluid specific heat at the inlet temp
+	Real64 PondHumRatioAir( 0.0 ); // humidity ratio of outdoor air
+	Real64 PondSpecHeatAir( 0.0 ); // outdoor air specific heat
+	Real64 PondLatentHeatAir( 0.0 ); // outdoor air latent heat
+	Real64 PondUvalueGround( 0.0 ); // ground heat transfer coefficient
 	Array1D_bool CheckEquipName;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PlantPondGroundHeatExchangers
@@ -579,7 +588,7 @@ namespace PondGroundHeatExchanger {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   August 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, evaluate boundary terms once per step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -592,6 +601,8 @@ namespace PondGroundHeatExchanger {
 		// a fourth order Runge-Kutta numerical integration method. The differential
 		// equation is:
 		//            Mdot*Cp*dT/dt = Sum of fluxes.
+		// The flux terms that do not depend on the pond temperature are the same for
+		// all four stages and are calculated once beforehand.
 
 		// REFERENCES:
 		// Chiasson, A. Advances in Modeling of Ground-Source Heat Pump Systems.
@@ -636,6 +647,8 @@ namespace PondGroundHeatExchanger {
 
 		SpecificHeat = GetSpecificHeatGlycol( fluidNameWater, max( PondTemp, constant_zero ), WaterIndex, RoutineName ); //DSU bug fix here, was using working fluid index
 
+		CalcPondBoundaryTerms( PondGHENum );
+
 		Flux = CalcTotalFLux( PondTemp, PondGHENum );
 		PondTempStar = PastPondTemp + 0.5 * SecInHour * TimeStepSys * Flux / ( SpecificHeat * PondMass );
 
@@ -653,6 +666,96 @@ namespace PondGroundHeatExchanger {
 
 	//==============================================================================
 
+	void
+	CalcPondBoundaryTerms( int const PondGHENum ) // Number of the Pond GHE
+	{
+
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This calculates the parts of the pond heat balance that do not depend
+		// on the pond temperature, so they can be shared by all of the flux
+		// evaluations made in one step.
+
+		// METHODOLOGY EMPLOYED:
+		// The weather dependent terms (external temperature, convection coefficient,
+		// absorbed solar and outdoor air properties), the loop fluid specific heat
+		// and the ground heat transfer coefficient are stored in module variables
+		// used by CalcTotalFLux.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::OutDryBulbTempAt;
+		using DataEnvironment::OutWetBulbTempAt;
+		using DataEnvironment::WindSpeedAt;
+		using DataEnvironment::IsSnow;
+		using DataEnvironment::IsRain;
+		using DataEnvironment::OutBaroPress;
+		using FluidProperties::GetSpecificHeatGlycol;
+		using ConvectionCoefficients::CalcASHRAESimpExtConvectCoeff;
+		using DataHeatBalance::VeryRough;
+		using Psychrometrics::PsyCpAirFnWTdb;
+		using Psychrometrics::PsyWFnTdbTwbPb;
+		using Psychrometrics::PsyHfgAirFnWTdb;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const PondHeight( 0.0 ); // for now
+		static std::string const RoutineName( "PondGroundHeatExchanger:CalcTotalFlux" );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 Perimeter; // pond perimeter
+		Real64 OutDryBulb; // drybulb at pond height
+		Real64 OutWetBulb; // wetbulb at pond height
+
+		// set appropriate external temp
+		// use height dependency --  if there was a height for this unit, it could be inserted.
+		// parameter PondHeight=0.0 is used.
+		OutDryBulb = OutDryBulbTempAt( PondHeight );
+		OutWetBulb = OutWetBulbTempAt( PondHeight );
+		if ( IsSnow ) {
+			PondExternalTemp = OutWetBulb;
+		} else if ( IsRain ) {
+			PondExternalTemp = OutWetBulb;
+		} else { // normal dry conditions
+			PondExternalTemp = OutDryBulb;
+		}
+
+		// ASHRAE simple convection coefficient model for external surfaces.
+		PondConvCoef = CalcASHRAESimpExtConvectCoeff( VeryRough, WindSpeedAt( PondHeight ) );
+
+		// total absorbed solar using function - no ground solar
+		PondSolarFlux = CalcSolarFlux();
+
+		// specific heat from fluid prop routines
+		PondFluidSpecHeat = GetSpecificHeatGlycol( PlantLoop( PondGHE( PondGHENum ).LoopNum ).FluidName, max( InletTemp, 0.0 ), PlantLoop( PondGHE( PondGHENum ).LoopNum ).FluidIndex, RoutineName );
+
+		// get air properties
+		PondHumRatioAir = PsyWFnTdbTwbPb( OutDryBulb, OutWetBulb, OutBaroPress );
+		PondSpecHeatAir = PsyCpAirFnWTdb( PondHumRatioAir, OutDryBulb );
+		PondLatentHeatAir = PsyHfgAirFnWTdb( PondHumRatioAir, OutDryBulb );
+
+		// ground heat transfer coefficient
+		Perimeter = 4.0 * std::sqrt( PondArea ); // square assumption
+		PondUvalueGround = 0.999 * ( GrndConductivity / PondDepth ) + 1.37 * ( GrndConductivity * Perimeter / PondArea );
+
+	}
+
+	//==============================================================================
+
 	Real64
 	CalcTotalFLux(
 		Real64 const PondBulkTemp, // pond temp for this flux calculation
@@ -662,7 +765,7 @@ namespace PondGroundHeatExchanger {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   August 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, use boundary terms from CalcPondBoundaryTerms
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -695,21 +798,11 @@ namespace PondGroundHeatExchanger {
 		//   Insulation Calculated and Experimental Results. Solar Energy,33(1):25-33.
 
 		// Using/Aliasing
-		using DataEnvironment::OutDryBulbTempAt;
-		using DataEnvironment::OutWetBulbTempAt;
-		using DataEnvironment::WindSpeedAt;
-		using DataEnvironment::IsSnow;
-		using DataEnvironment::IsRain;
 		using DataEnvironment::SkyTemp;
 		using DataEnvironment::OutBaroPress;
 		using DataEnvironment::GroundTemp_Deep;
-		using FluidProperties::GetSpecificHeatGlycol;
-		using ConvectionCoefficients::CalcASHRAESimpExtConvectCoeff;
 		using namespace DataGlobals;
-		using DataHeatBalance::VeryRough;
-		using Psychrometrics::PsyCpAirFnWTdb;
 		using Psychrometrics::PsyWFnTdbTwbPb;
-		using Psychrometrics::PsyHfgAirFnWTdb;
 
 		// Return value
 		Real64 CalcTotalFLux; // function return variable
@@ -720,8 +813,6 @@ namespace PondGroundHeatExchanger {
 		// FUNCTION PARAMETER DEFINITIONS:
 		Real64 const PrantlAir( 0.71 ); // Prantl number for air - assumed constant
 		Real64 const SchmidtAir( 0.6 ); // Schmidt number for air - assumed constant
-		Real64 const PondHeight( 0.0 ); // for now
-		static std::string const RoutineName( "PondGroundHeatExchanger:CalcTotalFlux" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -730,9 +821,6 @@ namespace PondGroundHeatExchanger {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		Real64 ConvCoef; // convection coefficient
-		Real64 ExternalTemp; // external environmental temp - drybulb or wetbulb
-		Real64 FluxSolAbsorbed; // absorbed solar flux
 		Real64 FluxLongwave; // absorbed longwave flux
 		Real64 FluxConvect; // convective flux
 		Real64 FluxEvap; // evaporative heat flux
@@ -741,69 +829,35 @@ namespace PondGroundHeatExchanger {
 		Real64 SurfTempAbs; // absolute value of surface temp
 		Real64 SkyTempAbs; // absolute value of sky temp
 		Real64 ThermalAbs; // thermal absorptivity
-		Real64 SpecHeat; // specific heat capacity
 		Real64 HumRatioFilm; // humidity ratio at pond surface/film temperature
-		Real64 HumRatioAir; // humidity ratio of air
-		Real64 SpecHeatAir; // air specific heat
-		Real64 LatentHeatAir; // latent heat of air
-		Real64 UvalueGround; // ground heat transfer coefficient
-		Real64 Perimeter; // pond perimeter
-		Real64 OutDryBulb; // drybulb at pond height
-		Real64 OutWetBulb; // wetbulb at pond height
 
 		// make a surface heat balance and solve for temperature
 		ThermalAbs = 0.9;
 
-		// set appropriate external temp
-		// use height dependency --  if there was a height for this unit, it could be inserted.
-		// parameter PondHeight=0.0 is used.
-		OutDryBulb = OutDryBulbTempAt( PondHeight );
-		OutWetBulb = OutWetBulbTempAt( PondHeight );
-		if ( IsSnow ) {
-			ExternalTemp = OutWetBulb;
-		} else if ( IsRain ) {
-			ExternalTemp = OutWetBulb;
-		} else { // normal dry conditions
-			ExternalTemp = OutDryBulb;
-		}
-
 		// absolute temperatures
 		SurfTempAbs = PondBulkTemp + KelvinConv;
 		SkyTempAbs = SkyTemp + KelvinConv;
 
-		// ASHRAE simple convection coefficient model for external surfaces.
-		ConvCoef = CalcASHRAESimpExtConvectCoeff( VeryRough, WindSpeedAt( PondHeight ) );
 		// convective flux
-		FluxConvect = ConvCoef * ( PondBulkTemp - ExternalTemp );
+		FluxConvect = PondConvCoef * ( PondBulkTemp - PondExternalTemp );
 
 		// long-wave radiation between pond and sky.
 		FluxLongwave = StefBoltzmann * ThermalAbs * ( pow_4( SurfTempAbs ) - pow_4( SkyTempAbs ) );
 
-		// total absorbed solar using function - no ground solar
-		FluxSolAbsorbed = CalcSolarFlux();
-
-		// specific heat from fluid prop routines
-		SpecHeat = GetSpecificHeatGlycol( PlantLoop( PondGHE( PondGHENum ).LoopNum ).FluidName, max( InletTemp, 0.0 ), PlantLoop( PondGHE( PondGHENum ).LoopNum ).FluidIndex, RoutineName );
 		// heat transfer with fluid - heat exchanger analogy.
-		Qfluid = FlowRate * SpecHeat * CalcEffectiveness( InletTemp, PondBulkTemp, FlowRate, PondGHENum ) * ( InletTemp - PondBulkTemp );
+		Qfluid = FlowRate * PondFluidSpecHeat * CalcEffectiveness( InletTemp, PondBulkTemp, FlowRate, PondGHENum ) * ( InletTemp - PondBulkTemp );
 
 		HeatTransRate = Qfluid;
 
 		// evaporation flux
-		// get air properties
-		HumRatioAir = PsyWFnTdbTwbPb( OutDryBulb, OutWetBulb, OutBaroPress );
 		HumRatioFilm = PsyWFnTdbTwbPb( PondBulkTemp, PondBulkTemp, OutBaroPress );
-		SpecHeatAir = PsyCpAirFnWTdb( HumRatioAir, OutDryBulb );
-		LatentHeatAir = PsyHfgAirFnWTdb( HumRatioAir, OutDryBulb );
 
-		FluxEvap = pow_2( PrantlAir / SchmidtAir ) / 3.0 * ConvCoef / SpecHeatAir * ( HumRatioFilm - HumRatioAir ) * LatentHeatAir;
+		FluxEvap = pow_2( PrantlAir / SchmidtAir ) / 3.0 * PondConvCoef / PondSpecHeatAir * ( HumRatioFilm - PondHumRatioAir ) * PondLatentHeatAir;
 
 		// ground heat transfer flux
-		Perimeter = 4.0 * std::sqrt( PondArea ); // square assumption
-		UvalueGround = 0.999 * ( GrndConductivity / PondDepth ) + 1.37 * ( GrndConductivity * Perimeter / PondArea );
-		FluxGround = UvalueGround * ( PondBulkTemp - GroundTemp_Deep );
+		FluxGround = PondUvalueGround * ( PondBulkTemp - GroundTemp_Deep );
 
-		CalcTotalFLux = Qfluid + PondArea * ( FluxSolAbsorbed - FluxConvect - FluxLongwave - FluxEvap - FluxGround );
+		CalcTotalFLux = Qfluid + PondArea * ( PondSolarFlux - FluxConvect - FluxLongwave - FluxEvap - FluxGround );
 		if ( BeginTimeStepFlag ) {
 
 		}
@@ -46,6 +46,15 @@ namespace PondGroundHeatExchanger {
 	extern int WaterIndex; // Fluid index for pond water
 	extern bool NoDeepGroundTempObjWarning; // This will cause a warning to be issued if no "deep" ground
 	// temperature object was input.
+	// Boundary terms that do not depend on the pond temperature - evaluated once per step
+	extern Real64 PondExternalTemp; // external environmental temp - drybulb or wetbulb
+	extern Real64 PondConvCoef; // convection coefficient
+	extern Real64 PondSolarFlux; // absorbed solar flux
+	extern Real64 PondFluidSpecHeat; // loop fluid specific heat at the inlet temp
+	extern Real64 PondHumRatioAir; // humidity ratio of outdoor air
+	extern Real64 PondSpecHeatAir; // outdoor air specific heat
+	extern Real64 PondLatentHeatAir; // outdoor air latent heat
+	extern Real64 PondUvalueGround; // ground heat transfer coefficient
 	extern Array1D_bool CheckEquipName;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PlantPondGroundHeatExchangers
@@ -231,6 +240,11 @@ namespace PondGroundHeatExchanger {
 
 	//==============================================================================
 
+	void
+	CalcPondBoundaryTerms( int const PondGHENum ); // Number of the Pond GHE
+
+	//==============================================================================
+
 	Real64
 	CalcTotalFLux(
 		Real64 const PondBulkTemp, // pond temp for this flux calculation
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
 
@@ -13,6 +14,7 @@
 #include <Psychrometrics.hh>
 #include <DataEnvironment.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 
@@ -21,9 +23,13 @@ namespace EnergyPlus {
 #ifdef EP_nocache_Psychrometrics
 #undef EP_cache_PsyTwbFnTdbWPb
 #undef EP_cache_PsyPsatFnTemp
+#undef EP_cache_PsyTsatFnHPb
+#undef EP_cache_PsyTsatFnPb
 #else
 #define EP_cache_PsyTwbFnTdbWPb
 #define EP_cache_PsyPsatFnTemp
+#define EP_cache_PsyTsatFnHPb
+#define EP_cache_PsyTsatFnPb
 #endif
 #define EP_psych_errors
 
@@ -85,12 +91,14 @@ namespace Psychrometrics {
 	int const iPsyRhFnTdbRhovLBnd0C( 13 );
 	int const iPsyTwbFnTdbWPb_cache( 18 );
 	int const iPsyPsatFnTemp_cache( 19 );
-	int const NumPsychMonitors( 19 ); // Parameterization of Number of psychrometric routines that
+	int const iPsyTsatFnHPb_cache( 20 );
+	int const iPsyTsatFnPb_cache( 21 );
+	int const NumPsychMonitors( 21 ); // Parameterization of Number of psychrometric routines that
 	std::string const blank_string;
 #ifdef EP_psych_stats
-	Array1D_string const PsyRoutineNames( NumPsychMonitors, { "PsyTdpFnTdbTwbPb", "PsyRhFnTdbWPb", "PsyTwbFnTdbWPb", "PsyVFnTdbWPb", "PsyWFnTdpPb", "PsyWFnTdbH", "PsyWFnTdbTwbPb", "PsyWFnTdbRhPb", "PsyPsatFnTemp", "PsyTsatFnHPb", "PsyTsatFnPb", "PsyRhFnTdbRhov", "PsyRhFnTdbRhovLBnd0C", "PsyTwbFnTdbWPb", "PsyTwbFnTdbWPb", "PsyWFnTdbTwbPb", "PsyTsatFnPb", "PsyTwbFnTdbWPb_cache", "PsyPsatFnTemp_cache" } ); // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc)
+	Array1D_string const PsyRoutineNames( NumPsychMonitors, { "PsyTdpFnTdbTwbPb", "PsyRhFnTdbWPb", "PsyTwbFnTdbWPb", "PsyVFnTdbWPb", "PsyWFnTdpPb", "PsyWFnTdbH", "PsyWFnTdbTwbPb", "PsyWFnTdbRhPb", "PsyPsatFnTemp", "PsyTsatFnHPb", "PsyTsatFnPb", "PsyRhFnTdbRhov", "PsyRhFnTdbRhovLBnd0C", "PsyTwbFnTdbWPb", "PsyTwbFnTdbWPb", "PsyWFnTdbTwbPb", "PsyTsatFnPb", "PsyTwbFnTdbWPb_cache", "PsyPsatFnTemp_cache", "PsyTsatFnHPb_cache", "PsyTsatFnPb_cache" } ); // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc) | 20 - PsyTsatFnHPb_raw (raw calc) | 21 - PsyTsatFnPb_raw (raw calc)
 
-	Array1D_bool const PsyReportIt( NumPsychMonitors, { true, true, true, true, true, true, true, true, true, true, true, true, true, false, false, false, false, true, true } ); // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
+	Array1D_bool const PsyReportIt( NumPsychMonitors, { true, true, true, true, true, true, true, true, true, true, true, true, true, false, false, false, false, true, true, true, true } ); // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc) | PsyTsatFnHPb_cache   20 - PsyTsatFnHPb_raw (raw calc) | PsyTsatFnPb_cache    21 - PsyTsatFnPb_raw (raw calc)
 #endif
 
 #ifndef EP_psych_errors
@@ -106,6 +114,14 @@ namespace Psychrometrics {
 	int const psatprecision_bits( 24 ); // 28  // 24  // 32
 	Int64 const psatcache_mask( psatcache_size - 1 );
 #endif
+#ifdef EP_cache_PsyTsatFnHPb
+	int const tsathpbcache_bits( 16 );
+	int const tsathpbcache_size( 1 << tsathpbcache_bits );
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+	int const tsatpbcache_bits( 14 );
+	int const tsatpbcache_size( 1 << tsatpbcache_bits );
+#endif
 
 	// MODULE VARIABLE DECLARATIONS:
 	// na
@@ -121,10 +137,16 @@ namespace Psychrometrics {
 
 	// Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
+	EP_PSYCH_THREAD_LOCAL Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+	EP_PSYCH_THREAD_LOCAL Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	EP_PSYCH_THREAD_LOCAL Array1D< cached_tsat_h_pb_t > cached_TsatHPb; // DIMENSION(0:tsathpbcache_size-1)
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+	EP_PSYCH_THREAD_LOCAL Array1D< cached_tsat_pb_t > cached_TsatPb; // DIMENSION(0:tsatpbcache_size-1)
 #endif
 
 	// Subroutine Specifications for the Module
@@ -174,6 +196,12 @@ namespace Psychrometrics {
 #ifdef EP_cache_PsyPsatFnTemp
 		cached_Psat.allocate( {0,psatcache_size} );
 #endif
+#ifdef EP_cache_PsyTsatFnHPb
+		cached_TsatHPb.allocate( {0,tsathpbcache_size-1} );
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+		cached_TsatPb.allocate( {0,tsatpbcache_size-1} );
+#endif
 
 	}
 
@@ -221,7 +249,7 @@ namespace Psychrometrics {
 		Real64 AverageIterations;
 		std::string istring;
 
-		EchoInputFile = FindUnitNumber( outputAuditFile );
+		EchoInputFile = FindUnitNumber( DataStringGlobals::outputAuditFileName );
 		if ( EchoInputFile == 0 ) return;
 		if ( any_gt( NumTimesCalled, 0 ) ) {
 			gio::write( EchoInputFile, fmtA ) << "RoutineName,#times Called,Avg Iterations";
@@ -236,11 +264,64 @@ namespace Psychrometrics {
 					gio::write( EchoInputFile, fmtA ) << PsyRoutineNames( Loop ) + ',' + istring;
 				}
 			}
+			gio::write( EchoInputFile, fmtA ) << "CacheName,#times Called,#hits,#misses";
+#ifdef EP_cache_PsyTwbFnTdbWPb
+			ShowPsychCacheSummary( EchoInputFile, iPsyTwbFnTdbWPb_cache, iPsyTwbFnTdbWPb );
+#endif
+#ifdef EP_cache_PsyPsatFnTemp
+			ShowPsychCacheSummary( EchoInputFile, iPsyPsatFnTemp_cache, iPsyPsatFnTemp );
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+			ShowPsychCacheSummary( EchoInputFile, iPsyTsatFnHPb_cache, iPsyTsatFnHPb );
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+			ShowPsychCacheSummary( EchoInputFile, iPsyTsatFnPb_cache, iPsyTsatFnPb );
+#endif
 		}
 #endif
 
 	}
 
+#ifdef EP_psych_stats
+	void
+	ShowPsychCacheSummary(
+		int const EchoInputFile, // unit number for "eplusout.audit"
+		int const iCache, // monitor index of the cached function
+		int const iRaw // monitor index of its raw calculation (counts the misses)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the calls, hits and misses of one psychrometric cache to the audit file.
+
+		// METHODOLOGY EMPLOYED:
+		// Every call of a cached function is counted for the cache and every miss calls the
+		// raw calculation, which counts itself.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtLD( "*" );
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string CallString;
+		std::string HitString;
+		std::string MissString;
+
+		if ( NumTimesCalled( iCache ) == 0 ) return;
+		gio::write( CallString, fmtLD ) << NumTimesCalled( iCache );
+		gio::write( HitString, fmtLD ) << NumTimesCalled( iCache ) - NumTimesCalled( iRaw );
+		gio::write( MissString, fmtLD ) << NumTimesCalled( iRaw );
+		gio::write( EchoInputFile, fmtA ) << PsyRoutineNames( iCache ) + ',' + stripped( CallString ) + ',' + stripped( HitString ) + ',' + stripped( MissString );
+
+	}
+#endif
+
 #ifdef EP_psych_errors
 	void
 	PsyRhoAirFnPbTdbW_error(
@@ -367,6 +448,9 @@ namespace Psychrometrics {
 #ifdef EP_psych_stats
 		++NumTimesCalled( iPsyTwbFnTdbWPb_cache );
 #endif
+#ifdef _OPENMP
+		if ( ! cached_Twb.allocated() ) cached_Twb.allocate( {0,twbcache_size} ); // First call on this thread
+#endif
 
 		Tdb_tag = TRANSFER( Tdb, Tdb_tag );
 		W_tag = TRANSFER( W, W_tag );
@@ -893,12 +977,82 @@ namespace Psychrometrics {
 	}
 #endif
 
+#ifdef EP_cache_PsyTsatFnHPb
+
+	Real64
+	PsyTsatFnHPb(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Provide a "cache" of results for the given arguments and saturation temperature output result.
+
+		// METHODOLOGY EMPLOYED:
+		// Unlike the wetbulb and saturation pressure caches the arguments are not moved to a grid:
+		// their bits are the tags, so a cached result is exactly the calculated one.  Enthalpies out of
+		// the range of the correlations always go to the calculation so their warnings are not lost.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 H_tag;
+		Int64 Pb_tag;
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyTsatFnHPb_cache );
+#endif
+
+		Real64 const HH( H + 1.78637e4 ); // Same range check as the calculation
+		if ( HH <= -4.24E4 || HH >= 4.5866E7 ) return PsyTsatFnHPb_raw( H, PB, CalledFrom );
+
+#ifdef _OPENMP
+		if ( ! cached_TsatHPb.allocated() ) cached_TsatHPb.allocate( {0,tsathpbcache_size-1} ); // First call on this thread
+#endif
+
+		H_tag = TRANSFER( H, H_tag );
+		Pb_tag = TRANSFER( PB, Pb_tag );
+		Int64 const hash( ( ( std::uint64_t( H_tag ) ^ ( std::uint64_t( Pb_tag ) * 0x9E3779B97F4A7C15ull ) ) * 0x9E3779B97F4A7C15ull ) >> ( 64 - tsathpbcache_bits ) ); // Fibonacci hashing: mixes the low bits in
+		auto & cTsat( cached_TsatHPb( hash ) );
+
+		if ( cTsat.iH != H_tag || cTsat.iPb != Pb_tag ) {
+			cTsat.iH = H_tag;
+			cTsat.iPb = Pb_tag;
+			cTsat.Tsat = PsyTsatFnHPb_raw( H, PB, CalledFrom );
+		}
+
+		return cTsat.Tsat; // saturation temperature {C}
+
+	}
+
+	Real64
+	PsyTsatFnHPb_raw(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+
+#else
+
 	Real64
 	PsyTsatFnHPb(
 		Real64 const H, // enthalpy {J/kg}
 		Real64 const PB, // barometric pressure {Pascals}
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
+#endif
 	{
 
 		// FUNCTION INFORMATION:
@@ -1229,11 +1383,74 @@ Label170: ;
 	}
 #endif
 
+#ifdef EP_cache_PsyTsatFnPb
+
 	Real64
 	PsyTsatFnPb(
 		Real64 const Press, // barometric pressure {Pascals}
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Provide a "cache" of results for the given argument (Press) and saturation temperature output result.
+
+		// METHODOLOGY EMPLOYED:
+		// As for PsyTsatFnHPb: the bits of the pressure are the tag, so a cached result is exactly the
+		// calculated one, and pressures out of range always go to the calculation for their warnings.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Int64 Pb_tag;
+
+#ifdef EP_psych_stats
+		++NumTimesCalled( iPsyTsatFnPb_cache );
+#endif
+
+		if ( Press <= 0.0017 || Press >= 1555000.0 ) return PsyTsatFnPb_raw( Press, CalledFrom ); // Same range check as the calculation
+
+#ifdef _OPENMP
+		if ( ! cached_TsatPb.allocated() ) cached_TsatPb.allocate( {0,tsatpbcache_size-1} ); // First call on this thread
+#endif
+
+		Pb_tag = TRANSFER( Press, Pb_tag );
+		Int64 const hash( ( std::uint64_t( Pb_tag ) * 0x9E3779B97F4A7C15ull ) >> ( 64 - tsatpbcache_bits ) ); // Fibonacci hashing: mixes the low bits in
+		auto & cTsat( cached_TsatPb( hash ) );
+
+		if ( cTsat.iPb != Pb_tag ) {
+			cTsat.iPb = Pb_tag;
+			cTsat.Tsat = PsyTsatFnPb_raw( Press, CalledFrom );
+		}
+
+		return cTsat.Tsat; // saturation temperature {C}
+
+	}
+
+	Real64
+	PsyTsatFnPb_raw(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+
+#else
+
+	Real64
+	PsyTsatFnPb(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom // routine this function was called from (error messages)
+	)
+#endif
 	{
 
 		// FUNCTION INFORMATION:
@@ -1273,8 +1490,8 @@ Label170: ;
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		bool FlagError; // set when errors should be flagged
-		static Real64 Press_Save( -99999.0 );
-		static Real64 tSat_Save( -99999.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 Press_Save( -99999.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 tSat_Save( -99999.0 );
 		Real64 tSat; // Water temperature guess
 		int iter; // Iteration counter
 
@@ -1394,6 +1611,182 @@ Label170: ;
 
 	}
 
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		Array1D< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		Array1D< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		Array1D< Real64 > & rhoair // densities of air
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyRhoAirFnPbTdbW for arrays of dry bulb temperatures and humidity ratios.
+
+		// METHODOLOGY EMPLOYED:
+		// The scalar function is applied in a simple loop over the raw array data, with no branches
+		// or caching, which the compiler can vectorize for the target instruction set.
+
+		assert( equal_dimensions( tdb, dw ) && equal_dimensions( tdb, rhoair ) );
+		Real64 const * const t( tdb.data() );
+		Real64 const * const w( dw.data() );
+		Real64 * const r( rhoair.data() );
+		for ( std::size_t i = 0, e = rhoair.size(); i < e; ++i ) {
+			r[ i ] = pb / ( 287.0 * ( t[ i ] + KelvinConv ) * ( 1.0 + 1.6077687 * max( w[ i ], 1.0e-5 ) ) );
+		}
+#ifdef EP_psych_errors
+		for ( std::size_t i = 0, e = rhoair.size(); i < e; ++i ) {
+			if ( r[ i ] < 0.0 ) PsyRhoAirFnPbTdbW_error( pb, t[ i ], w[ i ], r[ i ], BlankString );
+		}
+#endif
+	}
+
+	void
+	PsyHFnTdbW(
+		Array1D< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1D< Real64 > const & dW, // humidity ratios
+		Array1D< Real64 > & H // enthalpies {J/kg}
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyHFnTdbW for arrays of dry-bulb temperatures and humidity ratios.
+
+		// METHODOLOGY EMPLOYED:
+		// The scalar function is applied in a simple loop over the raw array data, with no branches
+		// or caching, which the compiler can vectorize for the target instruction set.
+
+		assert( equal_dimensions( TDB, dW ) && equal_dimensions( TDB, H ) );
+		Real64 const * const t( TDB.data() );
+		Real64 const * const w( dW.data() );
+		Real64 * const h( H.data() );
+		for ( std::size_t i = 0, e = H.size(); i < e; ++i ) {
+			h[ i ] = PsyHFnTdbW_fast( t[ i ], max( w[ i ], 1.0e-5 ) );
+		}
+	}
+
+	void
+	PsyCpAirFnWTdb(
+		Array1D< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		Array1D< Real64 > const & T, // temperatures {Celsius}
+		Array1D< Real64 > & cpa // heat capacities of air {J/kg-C}
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyCpAirFnWTdb for arrays of humidity ratios and temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// The scalar function is applied in a simple loop over the raw array data, with no branches
+		// or saved last result, which the compiler can vectorize for the target instruction set.  The same numerical derivative of
+		// PsyHFnTdbW is taken, so the results equal those of the scalar function.
+
+		assert( equal_dimensions( dw, T ) && equal_dimensions( dw, cpa ) );
+		Real64 const * const w( dw.data() );
+		Real64 const * const t( T.data() );
+		Real64 * const c( cpa.data() );
+		for ( std::size_t i = 0, e = cpa.size(); i < e; ++i ) {
+			Real64 const wi( max( w[ i ], 1.0e-5 ) );
+			c[ i ] = ( PsyHFnTdbW_fast( t[ i ] + 0.1, wi ) - PsyHFnTdbW_fast( t[ i ], wi ) ) * 10.0;
+		}
+	}
+
+	void
+	PsyTdbFnHW(
+		Array1D< Real64 > const & H, // enthalpies {J/kg}
+		Array1D< Real64 > const & dW, // humidity ratios
+		Array1D< Real64 > & TDB // dry-bulb temperatures {C}
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyTdbFnHW for arrays of enthalpies and humidity ratios.
+
+		// METHODOLOGY EMPLOYED:
+		// The scalar function is applied in a simple loop over the raw array data, with no branches
+		// or caching, which the compiler can vectorize for the target instruction set.
+
+		assert( equal_dimensions( H, dW ) && equal_dimensions( H, TDB ) );
+		Real64 const * const h( H.data() );
+		Real64 const * const w( dW.data() );
+		Real64 * const t( TDB.data() );
+		for ( std::size_t i = 0, e = TDB.size(); i < e; ++i ) {
+			Real64 const W( max( w[ i ], 1.0e-5 ) );
+			t[ i ] = ( h[ i ] - 2.50094e6 * W ) / ( 1.00484e3 + 1.85895e3 * W );
+		}
+	}
+
+	void
+	PsyPsatFnTemp(
+		Array1D< Real64 > const & T, // dry-bulb temperatures {C}
+		Array1D< Real64 > & Psat // saturation pressures {Pascals}
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyPsatFnTemp for an array of temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// Each element is evaluated by the scalar function, so that it uses (and fills) the same
+		// cache of results; the piecewise curve fit behind it is not suited to vectorization.
+
+		assert( equal_dimensions( T, Psat ) );
+		for ( std::size_t i = 0, e = Psat.size(); i < e; ++i ) {
+			Psat[ i ] = PsyPsatFnTemp( T[ i ] );
+		}
+	}
+
+	void
+	PsyTsatFnHPb(
+		Array1D< Real64 > const & H, // enthalpies {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		Array1D< Real64 > & Tsat // saturation temperatures {C}
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Batch version of PsyTsatFnHPb for an array of enthalpies at one barometric pressure.
+
+		// METHODOLOGY EMPLOYED:
+		// Each element is evaluated by the scalar function, so that it uses (and fills) the same
+		// cache of results; the iteration behind it is not suited to vectorization.
+
+		assert( equal_dimensions( H, Tsat ) );
+		for ( std::size_t i = 0, e = Tsat.size(); i < e; ++i ) {
+			Tsat[ i ] = PsyTsatFnHPb( H[ i ], PB );
+		}
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
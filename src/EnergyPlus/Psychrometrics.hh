@@ -20,12 +20,23 @@ namespace EnergyPlus {
 #ifdef EP_nocache_Psychrometrics
 #undef EP_cache_PsyTwbFnTdbWPb
 #undef EP_cache_PsyPsatFnTemp
+#undef EP_cache_PsyTsatFnHPb
+#undef EP_cache_PsyTsatFnPb
 #else
 #define EP_cache_PsyTwbFnTdbWPb
 #define EP_cache_PsyPsatFnTemp
+#define EP_cache_PsyTsatFnHPb
+#define EP_cache_PsyTsatFnPb
 #endif
 #define EP_psych_errors
 
+// Each thread keeps its own caches (and allocates them on first use) so cached entries are never shared between threads
+#ifdef _OPENMP
+#define EP_PSYCH_THREAD_LOCAL thread_local
+#else
+#define EP_PSYCH_THREAD_LOCAL
+#endif
+
 namespace Psychrometrics {
 
 #ifdef EP_psych_errors
@@ -54,12 +65,14 @@ namespace Psychrometrics {
 	extern int const iPsyRhFnTdbRhovLBnd0C;
 	extern int const iPsyTwbFnTdbWPb_cache;
 	extern int const iPsyPsatFnTemp_cache;
+	extern int const iPsyTsatFnHPb_cache;
+	extern int const iPsyTsatFnPb_cache;
 	extern int const NumPsychMonitors; // Parameterization of Number of psychrometric routines that
 	extern std::string const blank_string;
 #ifdef EP_psych_stats
-	extern Array1D_string const PsyRoutineNames; // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc)
+	extern Array1D_string const PsyRoutineNames; // 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | 10 | 11 | 12 | 13 | 14 - HR | 15 - max iter | 16 - HR | 17 - max iter | 18 - PsyTwbFnTdbWPb_raw (raw calc) | 19 - PsyPsatFnTemp_raw (raw calc) | 20 - PsyTsatFnHPb_raw (raw calc) | 21 - PsyTsatFnPb_raw (raw calc)
 
-	extern Array1D_bool const PsyReportIt; // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc)
+	extern Array1D_bool const PsyReportIt; // PsyTdpFnTdbTwbPb     1 | PsyRhFnTdbWPb        2 | PsyTwbFnTdbWPb       3 | PsyVFnTdbWPb         4 | PsyWFnTdpPb          5 | PsyWFnTdbH           6 | PsyWFnTdbTwbPb       7 | PsyWFnTdbRhPb        8 | PsyPsatFnTemp        9 | PsyTsatFnHPb         10 | PsyTsatFnPb          11 | PsyRhFnTdbRhov       12 | PsyRhFnTdbRhovLBnd0C 13 | PsyTwbFnTdbWPb       14 - HR | PsyTwbFnTdbWPb       15 - max iter | PsyWFnTdbTwbPb       16 - HR | PsyTsatFnPb          17 - max iter | PsyTwbFnTdbWPb_cache 18 - PsyTwbFnTdbWPb_raw (raw calc) | PsyPsatFnTemp_cache  19 - PsyPsatFnTemp_raw (raw calc) | PsyTsatFnHPb_cache   20 - PsyTsatFnHPb_raw (raw calc) | PsyTsatFnPb_cache    21 - PsyTsatFnPb_raw (raw calc)
 #endif
 
 #ifndef EP_psych_errors
@@ -75,6 +88,14 @@ namespace Psychrometrics {
 	extern int const psatprecision_bits; // 28  //24  //32
 	extern Int64 const psatcache_mask;
 #endif
+#ifdef EP_cache_PsyTsatFnHPb
+	extern int const tsathpbcache_bits;
+	extern int const tsathpbcache_size;
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+	extern int const tsatpbcache_bits;
+	extern int const tsatpbcache_size;
+#endif
 
 	// MODULE VARIABLE DECLARATIONS:
 	// na
@@ -150,12 +171,72 @@ namespace Psychrometrics {
 	};
 #endif
 
+#ifdef EP_cache_PsyTsatFnHPb
+	struct cached_tsat_h_pb_t
+	{
+		// Members
+		Int64 iH; // Bits of the enthalpy (exact: no grid shifting)
+		Int64 iPb; // Bits of the barometric pressure
+		Real64 Tsat;
+
+		// Default Constructor
+		cached_tsat_h_pb_t() :
+			iH( -1 ), // A NaN: never matches an argument
+			iPb( -1 ),
+			Tsat( 0.0 )
+		{}
+
+		// Member Constructor
+		cached_tsat_h_pb_t(
+			Int64 const iH,
+			Int64 const iPb,
+			Real64 const Tsat
+		) :
+			iH( iH ),
+			iPb( iPb ),
+			Tsat( Tsat )
+		{}
+
+	};
+#endif
+
+#ifdef EP_cache_PsyTsatFnPb
+	struct cached_tsat_pb_t
+	{
+		// Members
+		Int64 iPb; // Bits of the pressure (exact: no grid shifting)
+		Real64 Tsat;
+
+		// Default Constructor
+		cached_tsat_pb_t() :
+			iPb( -1 ), // A NaN: never matches an argument
+			Tsat( 0.0 )
+		{}
+
+		// Member Constructor
+		cached_tsat_pb_t(
+			Int64 const iPb,
+			Real64 const Tsat
+		) :
+			iPb( iPb ),
+			Tsat( Tsat )
+		{}
+
+	};
+#endif
+
 	// Object Data
 #ifdef EP_cache_PsyTwbFnTdbWPb
-	extern Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
+	extern EP_PSYCH_THREAD_LOCAL Array1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
-	extern Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+	extern EP_PSYCH_THREAD_LOCAL Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+#endif
+#ifdef EP_cache_PsyTsatFnHPb
+	extern EP_PSYCH_THREAD_LOCAL Array1D< cached_tsat_h_pb_t > cached_TsatHPb; // DIMENSION(0:tsathpbcache_size-1)
+#endif
+#ifdef EP_cache_PsyTsatFnPb
+	extern EP_PSYCH_THREAD_LOCAL Array1D< cached_tsat_pb_t > cached_TsatPb; // DIMENSION(0:tsatpbcache_size-1)
 #endif
 
 	// Subroutine Specifications for the Module
@@ -168,6 +249,15 @@ namespace Psychrometrics {
 	void
 	ShowPsychrometricSummary();
 
+#ifdef EP_psych_stats
+	void
+	ShowPsychCacheSummary(
+		int const EchoInputFile, // unit number for "eplusout.audit"
+		int const iCache, // monitor index of the cached function
+		int const iRaw // monitor index of its raw calculation (counts the misses)
+	);
+#endif
+
 #ifdef EP_psych_errors
 	void
 	PsyRhoAirFnPbTdbW_error(
@@ -353,9 +443,9 @@ namespace Psychrometrics {
 		// USAGE:  cpa = PsyCpAirFnWTdb(w,T)
 
 		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 dwSave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 Tsave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -383,9 +473,9 @@ namespace Psychrometrics {
 		assert( dw >= 1.0e-5 );
 
 		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 dwSave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 Tsave( -100.0 );
+		static EP_PSYCH_THREAD_LOCAL Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -715,6 +805,9 @@ namespace Psychrometrics {
 #ifdef EP_psych_stats
 		++NumTimesCalled( iPsyPsatFnTemp_cache );
 #endif
+#ifdef _OPENMP
+		if ( ! cached_Psat.allocated() ) cached_Psat.allocate( {0,psatcache_size} ); // First call on this thread
+#endif
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
@@ -750,6 +843,17 @@ namespace Psychrometrics {
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+#ifdef EP_cache_PsyTsatFnHPb
+
+	Real64
+	PsyTsatFnHPb_raw(
+		Real64 const H, // enthalpy {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
+#endif
+
 	inline
 	Real64
 	PsyRhovFnTdbRh(
@@ -1122,6 +1226,16 @@ namespace Psychrometrics {
 		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
 	);
 
+#ifdef EP_cache_PsyTsatFnPb
+
+	Real64
+	PsyTsatFnPb_raw(
+		Real64 const Press, // barometric pressure {Pascals}
+		std::string const & CalledFrom = blank_string // routine this function was called from (error messages)
+	);
+
+#endif
+
 	inline
 	Real64
 	PsyTdpFnWPb(
@@ -1281,6 +1395,50 @@ namespace Psychrometrics {
 		return 1000.1207 + 8.3215874e-04 * TB - 4.929976e-03 * pow_2( TB ) + 8.4791863e-06 * pow_3( TB );
 	}
 
+	// Batch versions: evaluate the function above element by element for arrays of the same size
+
+	void
+	PsyRhoAirFnPbTdbW(
+		Real64 const pb, // barometric pressure (Pascals)
+		Array1D< Real64 > const & tdb, // dry bulb temperatures (Celsius)
+		Array1D< Real64 > const & dw, // humidity ratios (kgWater/kgDryAir)
+		Array1D< Real64 > & rhoair // densities of air
+	);
+
+	void
+	PsyHFnTdbW(
+		Array1D< Real64 > const & TDB, // dry-bulb temperatures {C}
+		Array1D< Real64 > const & dW, // humidity ratios
+		Array1D< Real64 > & H // enthalpies {J/kg}
+	);
+
+	void
+	PsyCpAirFnWTdb(
+		Array1D< Real64 > const & dw, // humidity ratios {kgWater/kgDryAir}
+		Array1D< Real64 > const & T, // temperatures {Celsius}
+		Array1D< Real64 > & cpa // heat capacities of air {J/kg-C}
+	);
+
+	void
+	PsyTdbFnHW(
+		Array1D< Real64 > const & H, // enthalpies {J/kg}
+		Array1D< Real64 > const & dW, // humidity ratios
+		Array1D< Real64 > & TDB // dry-bulb temperatures {C}
+	);
+
+	void
+	PsyPsatFnTemp(
+		Array1D< Real64 > const & T, // dry-bulb temperatures {C}
+		Array1D< Real64 > & Psat // saturation pressures {Pascals}
+	);
+
+	void
+	PsyTsatFnHPb(
+		Array1D< Real64 > const & H, // enthalpies {J/kg}
+		Real64 const PB, // barometric pressure {Pascals}
+		Array1D< Real64 > & Tsat // saturation temperatures {C}
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -0,0 +1,348 @@
+// C++ Headers
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <RecordOutput.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <InputProcessor.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace RecordOutput {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// This module writes the large initialization reports as typed binary records to eplusout.eiob
+	// (EioRecords environment variable), and lets whole record classes be left out of eplusout.eio
+	// and eplusout.eiob (EioSuppress environment variable).
+
+	// METHODOLOGY EMPLOYED:
+	// A record class is named as in its eio header line (e.g. "Component Sizing Information").
+	// A report routine asks WriteTextRecord before formatting its eio line, and WriteRecord before
+	// writing the same values as a record.  The values of a record are stored as they are, so
+	// nothing is formatted while the simulation runs; the records are buffered and written in
+	// large blocks.  With EioRecords=Only the eio lines of these record classes are not written.
+	// After an 8 character identifier the file is a sequence of entries, each starting with a tag:
+	//   'C' int32 class number, int32 name length, name      (before the first record of a class)
+	//   'R' int32 class number, int32 number of fields, fields
+	// and each field starts with its type: 'd' float64, 'i' int32, or 's' int32 length, characters.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// The numbers are in the byte order of the machine that ran the simulation, as for eplusout.esob.
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::size_t const BlockSize( 1048576 ); // Buffered characters that trigger a write to the file
+	static char const RecordOutputMagic[ 8 ] = { 'E', 'P', 'E', 'I', 'O', 'B', '0', '1' };
+
+	// DERIVED TYPE DEFINITIONS:
+	struct RecordClassData
+	{
+		// Members
+		std::string Name; // Name, as in the eio header line
+		bool Suppressed; // Left out of eplusout.eio and eplusout.eiob (EioSuppress)
+		bool Defined; // Class definition written to eplusout.eiob
+
+		// Default Constructor
+		RecordClassData() :
+			Suppressed( false ),
+			Defined( false )
+		{}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	static std::vector< RecordClassData > RecordClasses; // Record classes by number (from 0)
+	static std::ofstream RecordOutputFile; // eplusout.eiob
+	static std::string RecordBuffer; // Entries not yet written to the file
+	static std::string::size_type FieldCountPos( std::string::npos ); // Buffer position of the field count of the open record
+	static std::int32_t FieldCount( 0 ); // Fields in the open record
+
+	// Functions
+
+	static
+	void
+	PutInt32( std::int32_t const Value ) // Value to buffer
+	{
+		RecordBuffer.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+	}
+
+	static
+	bool
+	ClassSuppressed( std::string const & ClassName ) // Record class name
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if a record class is listed in EioSuppress (semicolon separated, case insensitive).
+
+		// Using/Aliasing
+		using DataSystemVariables::EioSuppress;
+		using InputProcessor::MakeUPPERCase;
+
+		if ( EioSuppress.empty() ) return false;
+
+		std::string const UpperName( MakeUPPERCase( ClassName ) );
+		std::string::size_type Start( 0 );
+		while ( Start <= EioSuppress.size() ) {
+			std::string::size_type End( EioSuppress.find( ';', Start ) );
+			if ( End == std::string::npos ) End = EioSuppress.size();
+			std::string::size_type const First( EioSuppress.find_first_not_of( ' ', Start ) );
+			std::string::size_type const Last( EioSuppress.find_last_not_of( ' ', End - 1 ) );
+			if ( First < End && Last != std::string::npos && Last >= First ) {
+				if ( MakeUPPERCase( EioSuppress.substr( First, Last - First + 1 ) ) == UpperName ) return true;
+			}
+			Start = End + 1;
+		}
+		return false;
+
+	}
+
+	void
+	OpenRecordOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine opens eplusout.eiob when the EioRecords environment variable is set.
+
+		// Using/Aliasing
+		using DataSystemVariables::EioRecords;
+
+		for ( auto & Class : RecordClasses ) {
+			Class.Suppressed = ClassSuppressed( Class.Name );
+			Class.Defined = false;
+		}
+		RecordBuffer.clear();
+		FieldCountPos = std::string::npos;
+
+		if ( ! EioRecords ) return;
+
+		std::string const FileName( DataStringGlobals::outputEioFileName + 'b' );
+		RecordOutputFile.open( FileName, std::ios::binary | std::ios::trunc );
+		if ( ! RecordOutputFile ) {
+			ShowFatalError( "OpenRecordOutput: Could not open file " + FileName + " for output (write)." );
+		}
+		RecordOutputFile.write( RecordOutputMagic, sizeof( RecordOutputMagic ) );
+
+	}
+
+	int
+	RecordClass( std::string const & ClassName ) // Record class name, as in its eio header line
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of a record class, adding the class the first time it is named.
+		// Report routines look their classes up once and keep the numbers.
+
+		for ( int ClassNum = 0, e = RecordClasses.size(); ClassNum < e; ++ClassNum ) {
+			if ( RecordClasses[ ClassNum ].Name == ClassName ) return ClassNum;
+		}
+		RecordClasses.emplace_back();
+		RecordClasses.back().Name = ClassName;
+		RecordClasses.back().Suppressed = ClassSuppressed( ClassName );
+		return RecordClasses.size() - 1;
+
+	}
+
+	bool
+	WriteTextRecord( int const ClassNum ) // Record class number
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the eio lines of a record class are to be formatted and written.
+
+		// Using/Aliasing
+		using DataSystemVariables::EioRecordsOnly;
+
+		assert( ClassNum >= 0 && ClassNum < int( RecordClasses.size() ) );
+		return ! RecordClasses[ ClassNum ].Suppressed && ! ( EioRecordsOnly && RecordOutputFile.is_open() );
+
+	}
+
+	bool
+	WriteRecord( int const ClassNum ) // Record class number
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the records of a record class are to be written to eplusout.eiob.
+
+		assert( ClassNum >= 0 && ClassNum < int( RecordClasses.size() ) );
+		return RecordOutputFile.is_open() && ! RecordClasses[ ClassNum ].Suppressed;
+
+	}
+
+	void
+	BeginRecord( int const ClassNum ) // Record class number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts a record; its fields follow (RecordField) and EndRecord completes it.
+
+		// METHODOLOGY EMPLOYED:
+		// The class definition is buffered before the first record of a class.  The field count
+		// is buffered as zero and filled in by EndRecord.
+
+		assert( WriteRecord( ClassNum ) );
+		assert( FieldCountPos == std::string::npos ); // Records are not nested
+
+		RecordClassData & Class( RecordClasses[ ClassNum ] );
+		if ( ! Class.Defined ) {
+			RecordBuffer += 'C';
+			PutInt32( ClassNum );
+			PutInt32( Class.Name.size() );
+			RecordBuffer += Class.Name;
+			Class.Defined = true;
+		}
+		RecordBuffer += 'R';
+		PutInt32( ClassNum );
+		FieldCountPos = RecordBuffer.size();
+		FieldCount = 0;
+		PutInt32( FieldCount );
+
+	}
+
+	void
+	RecordField( std::string const & Value ) // Field value
+	{
+		assert( FieldCountPos != std::string::npos );
+		RecordBuffer += 's';
+		PutInt32( Value.size() );
+		RecordBuffer += Value;
+		++FieldCount;
+	}
+
+	void
+	RecordField( Real64 const Value ) // Field value
+	{
+		assert( FieldCountPos != std::string::npos );
+		RecordBuffer += 'd';
+		RecordBuffer.append( reinterpret_cast< char const * >( &Value ), sizeof( Value ) );
+		++FieldCount;
+	}
+
+	void
+	RecordField( int const Value ) // Field value
+	{
+		assert( FieldCountPos != std::string::npos );
+		RecordBuffer += 'i';
+		PutInt32( Value );
+		++FieldCount;
+	}
+
+	void
+	EndRecord()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Completes the record started by BeginRecord, writing the buffer when a block is full.
+
+		assert( FieldCountPos != std::string::npos );
+		std::memcpy( &RecordBuffer[ FieldCountPos ], &FieldCount, sizeof( FieldCount ) );
+		FieldCountPos = std::string::npos;
+		if ( RecordBuffer.size() >= BlockSize ) FlushRecordOutput();
+
+	}
+
+	void
+	FlushRecordOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the buffered records to eplusout.eiob.
+
+		if ( ! RecordOutputFile.is_open() || RecordBuffer.empty() ) return;
+
+		RecordOutputFile.write( RecordBuffer.data(), RecordBuffer.size() );
+		RecordBuffer.clear();
+
+	}
+
+	void
+	CloseRecordOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the remaining records and closes eplusout.eiob.
+
+		if ( ! RecordOutputFile.is_open() ) return;
+
+		FlushRecordOutput();
+		RecordOutputFile.close();
+		if ( RecordOutputFile.fail() ) {
+			ShowWarningError( "CloseRecordOutput: Errors writing file " + DataStringGlobals::outputEioFileName + "b; it is incomplete." );
+		}
+		RecordOutputFile.clear();
+
+	}
+
+} // RecordOutput
+
+} // EnergyPlus
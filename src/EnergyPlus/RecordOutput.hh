@@ -0,0 +1,57 @@
+#ifndef RecordOutput_hh_INCLUDED
+#define RecordOutput_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace RecordOutput {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern std::size_t const BlockSize; // Buffered characters that trigger a write to the file
+
+	// Functions
+
+	void
+	OpenRecordOutput();
+
+	int
+	RecordClass( std::string const & ClassName ); // Record class name, as in its eio header line
+
+	bool
+	WriteTextRecord( int const ClassNum ); // Record class number
+
+	bool
+	WriteRecord( int const ClassNum ); // Record class number
+
+	void
+	BeginRecord( int const ClassNum ); // Record class number
+
+	void
+	RecordField( std::string const & Value ); // Field value
+
+	void
+	RecordField( Real64 const Value ); // Field value
+
+	void
+	RecordField( int const Value ); // Field value
+
+	void
+	EndRecord();
+
+	void
+	FlushRecordOutput();
+
+	void
+	CloseRecordOutput();
+
+} // RecordOutput
+
+} // EnergyPlus
+
+#endif
@@ -438,6 +438,7 @@ namespace RefrigeratedCase {
 	Array1D< AirChillerSetData > AirChillerSet;
 	Array1D< CoilCreditData > CoilSysCredit;
 	Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	Array1D< CaseWIZoneAirData > CaseWIZoneAir;
 
 	// Functions
 
@@ -882,6 +883,7 @@ namespace RefrigeratedCase {
 		}
 		if ( ( NumSimulationWalkIns > 0 ) || ( NumSimulationCases > 0 ) ) {
 			CaseWIZoneReport.allocate( NumOfZones );
+			CaseWIZoneAir.allocate( NumOfZones );
 		} else {
 			UseSysTimeStep = true;
 			//needed to avoid accessing unallocated caseWIZoneReport on early call to SumZones
@@ -7467,8 +7469,16 @@ namespace RefrigeratedCase {
 		//Set local subroutine variables for convenience
 		ActualZoneNum = RefrigCase( CaseID ).ActualZoneNum;
 		ZoneNodeNum = RefrigCase( CaseID ).ZoneNodeNum;
-		ZoneRHPercent = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress ) * 100.0;
-		ZoneDewPoint = PsyTdpFnWPb( Node( ZoneNodeNum ).HumRat, OutBaroPress );
+		// Cases in the same zone share the zone air properties
+		auto & ZoneAir( CaseWIZoneAir( ActualZoneNum ) );
+		ZoneAir.update( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress );
+		if ( ! ZoneAir.CaseValid ) {
+			ZoneAir.RHPercent = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress ) * 100.0;
+			ZoneAir.DewPoint = PsyTdpFnWPb( Node( ZoneNodeNum ).HumRat, OutBaroPress );
+			ZoneAir.CaseValid = true;
+		}
+		ZoneRHPercent = ZoneAir.RHPercent;
+		ZoneDewPoint = ZoneAir.DewPoint;
 		Length = RefrigCase( CaseID ).Length;
 		TCase = RefrigCase( CaseID ).Temperature;
 		DesignRatedCap = RefrigCase( CaseID ).DesignRatedCap;
@@ -11192,10 +11202,20 @@ namespace RefrigeratedCase {
 
 			//Get infiltration loads if either type of door is present in this zone
 			if ( StockDoorArea > 0.0 || GlassDoorArea > 0.0 ) {
-				ZoneRHFrac = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress, RoutineName );
-				EnthalpyZoneAir = PsyHFnTdbRhPb( ZoneDryBulb, ZoneRHFrac, OutBaroPress, RoutineName );
-				HumRatioZoneAir = PsyWFnTdbH( ZoneDryBulb, EnthalpyZoneAir, RoutineName );
-				DensityZoneAir = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneDryBulb, HumRatioZoneAir, RoutineName );
+				// Walk-ins in the same zone share the zone air properties
+				auto & ZoneAir( CaseWIZoneAir( ZoneNum ) );
+				ZoneAir.update( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress );
+				if ( ! ZoneAir.WalkInValid ) {
+					ZoneAir.RHFrac = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress, RoutineName );
+					ZoneAir.Enthalpy = PsyHFnTdbRhPb( ZoneDryBulb, ZoneAir.RHFrac, OutBaroPress, RoutineName );
+					ZoneAir.HumRatio = PsyWFnTdbH( ZoneDryBulb, ZoneAir.Enthalpy, RoutineName );
+					ZoneAir.Density = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneDryBulb, ZoneAir.HumRatio, RoutineName );
+					ZoneAir.WalkInValid = true;
+				}
+				ZoneRHFrac = ZoneAir.RHFrac;
+				EnthalpyZoneAir = ZoneAir.Enthalpy;
+				HumRatioZoneAir = ZoneAir.HumRatio;
+				DensityZoneAir = ZoneAir.Density;
 				if ( DensityZoneAir < DensityAirWalkIn ) { //usual case when walk in is colder than zone
 					DensitySqRtFactor = std::sqrt( 1.0 - DensityZoneAir / DensityAirWalkIn );
 					DensityFactorFm = std::pow( 2.0 / ( 1.0 + std::pow( DensityAirWalkIn / DensityZoneAir, 0.333 ) ), 1.5 );
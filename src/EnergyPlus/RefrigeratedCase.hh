@@ -3393,6 +3393,55 @@ namespace RefrigeratedCase {
 
 	};
 
+	struct CaseWIZoneAirData // Zone air properties shared by the cases and walk-ins in a zone
+	{
+		// Members
+		Real64 Temp; // Zone air node temperature the properties are for (C)
+		Real64 HumRat; // Zone air node humidity ratio the properties are for (kg/kg)
+		Real64 BaroPress; // Barometric pressure the properties are for (Pa)
+		bool CaseValid; // Case properties are current
+		Real64 RHPercent; // Zone relative humidity used by the cases (%)
+		Real64 DewPoint; // Zone dew point used by the cases (C)
+		bool WalkInValid; // Walk-in properties are current
+		Real64 RHFrac; // Zone relative humidity used by the walk-ins (fraction)
+		Real64 Enthalpy; // Zone air enthalpy used by the walk-ins (J/kg)
+		Real64 HumRatio; // Zone air humidity ratio at that enthalpy (kg/kg)
+		Real64 Density; // Zone air density used by the walk-ins (kg/m3)
+
+		// Default Constructor
+		CaseWIZoneAirData() :
+			Temp( 0.0 ),
+			HumRat( 0.0 ),
+			BaroPress( 0.0 ),
+			CaseValid( false ),
+			RHPercent( 0.0 ),
+			DewPoint( 0.0 ),
+			WalkInValid( false ),
+			RHFrac( 0.0 ),
+			Enthalpy( 0.0 ),
+			HumRatio( 0.0 ),
+			Density( 0.0 )
+		{}
+
+		// Forget the properties when the zone air conditions have changed
+		void
+		update(
+			Real64 const ZoneTemp,
+			Real64 const ZoneHumRat,
+			Real64 const ZoneBaroPress
+		)
+		{
+			if ( ( ZoneTemp != Temp ) || ( ZoneHumRat != HumRat ) || ( ZoneBaroPress != BaroPress ) ) {
+				Temp = ZoneTemp;
+				HumRat = ZoneHumRat;
+				BaroPress = ZoneBaroPress;
+				CaseValid = false;
+				WalkInValid = false;
+			}
+		}
+
+	};
+
 	struct WarehouseCoilData
 	{
 		// Members
@@ -3911,6 +3960,7 @@ namespace RefrigeratedCase {
 	extern Array1D< AirChillerSetData > AirChillerSet;
 	extern Array1D< CoilCreditData > CoilSysCredit;
 	extern Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	extern Array1D< CaseWIZoneAirData > CaseWIZoneAir;
 
 	// Functions
 
@@ -20,6 +20,7 @@
 #include <InputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <Psychrometrics.hh>
+#include <RecordOutput.hh>
 #include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
 #include <FluidProperties.hh>
@@ -82,13 +83,14 @@ namespace ReportSizingManager {
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   Decenber 2001
 		//       MODIFIED       August 2008, Greg Stark
+		//                      Oct 2026, structured records (RecordOutput)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This subroutine writes one item of sizing data to the "eio" file..
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The items are also Component Sizing Information records of eplusout.eiob (see RecordOutput).
 
 		// REFERENCES:
 		// na
@@ -113,22 +115,42 @@ namespace ReportSizingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool MyOneTimeFlag( true );
+		static int const SizingRecordClass( RecordOutput::RecordClass( "Component Sizing Information" ) );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <Component Sizing Information>, Component Type, Component Name, ','Input Field Description, Value')" );
 		static gio::Fmt Format_991( "(' Component Sizing Information, ',A,', ',A,', ',A,', ',A)" );
 
-		if ( MyOneTimeFlag ) {
+		bool const WriteText( RecordOutput::WriteTextRecord( SizingRecordClass ) );
+		bool const WriteRecord( RecordOutput::WriteRecord( SizingRecordClass ) );
+
+		if ( MyOneTimeFlag && WriteText ) {
 			gio::write( OutputFileInits, Format_990 );
 			MyOneTimeFlag = false;
 		}
 
-		gio::write( OutputFileInits, Format_991 ) << CompType << CompName << VarDesc << RoundSigDigits( VarValue, 5 );
+		if ( WriteText ) gio::write( OutputFileInits, Format_991 ) << CompType << CompName << VarDesc << RoundSigDigits( VarValue, 5 );
+		if ( WriteRecord ) {
+			RecordOutput::BeginRecord( SizingRecordClass );
+			RecordOutput::RecordField( CompType );
+			RecordOutput::RecordField( CompName );
+			RecordOutput::RecordField( VarDesc );
+			RecordOutput::RecordField( VarValue );
+			RecordOutput::EndRecord();
+		}
 		//add to tabular output reports
 		AddCompSizeTableEntry( CompType, CompName, VarDesc, VarValue );
 
 		if ( present( UsrDesc ) && present( UsrValue ) ) {
-			gio::write( OutputFileInits, Format_991 ) << CompType << CompName << UsrDesc << RoundSigDigits( UsrValue, 5 );
+			if ( WriteText ) gio::write( OutputFileInits, Format_991 ) << CompType << CompName << UsrDesc << RoundSigDigits( UsrValue, 5 );
+			if ( WriteRecord ) {
+				RecordOutput::BeginRecord( SizingRecordClass );
+				RecordOutput::RecordField( CompType );
+				RecordOutput::RecordField( CompName );
+				RecordOutput::RecordField( UsrDesc() );
+				RecordOutput::RecordField( UsrValue() );
+				RecordOutput::EndRecord();
+			}
 			AddCompSizeTableEntry( CompType, CompName, UsrDesc, UsrValue );
 		} else if ( present( UsrDesc ) || present( UsrValue ) ) {
 			ShowFatalError( "ReportSizingOutput: (Developer Error) - called with user-specified description or value but not both." );
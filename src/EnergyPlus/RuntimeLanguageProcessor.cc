@@ -116,6 +116,8 @@ namespace RuntimeLanguageProcessor {
 	int ActualTimeNum( 0 );
 	int WarmUpFlagNum( 0 );
 
+	std::vector< Real64 > ErlBytecodeStack; // operand stack for evaluating compiled Erl expressions
+
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
 
@@ -1941,6 +1943,7 @@ namespace RuntimeLanguageProcessor {
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   June 2006
 		//       MODIFIED       Brent Griffith, May 2009
+		//                      Oct 2026, use the compiled form of the expression when there is one
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1989,6 +1992,13 @@ namespace RuntimeLanguageProcessor {
 		ReturnValue.Number = 0.0;
 
 		if ( ExpressionNum > 0 ) {
+			// numeric expression trees are evaluated from their bytecode, the interpreter below remains the
+			// fallback for everything else and for any case where the compiled form cannot produce a number
+			if ( ! ErlExpression( ExpressionNum ).Bytecode.empty() ) {
+				Real64 CompiledValue;
+				if ( EvaluateCompiledExpression( ExpressionNum, CompiledValue ) ) return SetErlValueNumber( CompiledValue );
+			}
+
 			// is there a way to keep these and not allocate and deallocate all the time?
 			Operand.allocate( ErlExpression( ExpressionNum ).NumOperands );
 			// Reduce operands down to literals
@@ -2430,6 +2440,343 @@ namespace RuntimeLanguageProcessor {
 
 	}
 
+	void
+	CompileExpressions()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compiles the parsed Erl expressions into bytecode so that EvaluateExpression can evaluate a
+		// numeric expression tree in a single loop rather than by recursing through it.
+
+		// METHODOLOGY EMPLOYED:
+		// Every expression tree made only of numeric literals, Erl variables, the arithmetic, comparison
+		// and logical operators and the simple math functions is flattened into a postfix instruction list
+		// with its variable indices resolved.  Trees holding strings, trend or curve functions,
+		// psychrometric functions or random numbers keep an empty bytecode and stay interpreted.
+		// A bare literal is also left to the interpreter since it returns its operand unchanged.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ExpressionNum;
+		int StackDepth; // operand stack depth at the end of the instructions
+		int MaxStackDepth; // largest operand stack depth of one expression
+		int MaxOverallStackDepth( 0 ); // largest operand stack depth of all expressions
+		std::vector< ErlBytecodeType > Bytecode;
+
+		for ( ExpressionNum = 1; ExpressionNum <= NumExpressions; ++ExpressionNum ) {
+			auto & thisExpression( ErlExpression( ExpressionNum ) );
+			thisExpression.Bytecode.clear();
+			if ( thisExpression.Operator == OperatorLiteral ) continue;
+
+			Bytecode.clear();
+			StackDepth = 0;
+			MaxStackDepth = 0;
+			if ( CompileExpressionTree( ExpressionNum, Bytecode, StackDepth, MaxStackDepth ) ) {
+				assert( StackDepth == 1 );
+				thisExpression.Bytecode = Bytecode;
+				MaxOverallStackDepth = max( MaxOverallStackDepth, MaxStackDepth );
+			}
+		}
+
+		ErlBytecodeStack.resize( MaxOverallStackDepth );
+
+	}
+
+	bool
+	CompileExpressionTree(
+		int const ExpressionNum, // index of expression in structure
+		std::vector< ErlBytecodeType > & Bytecode, // compiled instructions, appended to
+		int & StackDepth, // operand stack depth at the end of the instructions
+		int & MaxStackDepth // largest operand stack depth reached
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Appends the postfix bytecode of an expression and its subexpressions.  Returns false if some
+		// part of the tree cannot be compiled, in which case the whole expression is interpreted.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int OpCode( ErlOpPushNumber ); // opcode of the operator, not used for a literal
+		int NumArgs; // number of operands taken by the operator
+		int OperandNum;
+
+		auto const & thisExpression( ErlExpression( ExpressionNum ) );
+		int const Operator( thisExpression.Operator );
+
+		if ( Operator == OperatorLiteral ) {
+			NumArgs = 1;
+		} else if ( Operator == OperatorNegative ) {
+			OpCode = ErlOpNegative;
+			NumArgs = 1;
+		} else if ( Operator == OperatorDivide ) {
+			OpCode = ErlOpDivide;
+			NumArgs = 2;
+		} else if ( Operator == OperatorMultiply ) {
+			OpCode = ErlOpMultiply;
+			NumArgs = 2;
+		} else if ( Operator == OperatorSubtract ) {
+			OpCode = ErlOpSubtract;
+			NumArgs = 2;
+		} else if ( Operator == OperatorAdd ) {
+			OpCode = ErlOpAdd;
+			NumArgs = 2;
+		} else if ( Operator == OperatorEqual ) {
+			OpCode = ErlOpEqual;
+			NumArgs = 2;
+		} else if ( Operator == OperatorNotEqual ) {
+			OpCode = ErlOpNotEqual;
+			NumArgs = 2;
+		} else if ( Operator == OperatorLessOrEqual ) {
+			OpCode = ErlOpLessOrEqual;
+			NumArgs = 2;
+		} else if ( Operator == OperatorGreaterOrEqual ) {
+			OpCode = ErlOpGreaterOrEqual;
+			NumArgs = 2;
+		} else if ( Operator == OperatorLessThan ) {
+			OpCode = ErlOpLessThan;
+			NumArgs = 2;
+		} else if ( Operator == OperatorGreaterThan ) {
+			OpCode = ErlOpGreaterThan;
+			NumArgs = 2;
+		} else if ( Operator == OperatorRaiseToPower ) {
+			OpCode = ErlOpRaiseToPower;
+			NumArgs = 2;
+		} else if ( Operator == OperatorLogicalAND ) {
+			OpCode = ErlOpLogicalAND;
+			NumArgs = 2;
+		} else if ( Operator == OperatiorLogicalOR ) {
+			OpCode = ErlOpLogicalOR;
+			NumArgs = 2;
+		} else if ( Operator == FuncRound ) {
+			OpCode = ErlOpRound;
+			NumArgs = 1;
+		} else if ( Operator == FuncMod ) {
+			OpCode = ErlOpMod;
+			NumArgs = 2;
+		} else if ( Operator == FuncSin ) {
+			OpCode = ErlOpSin;
+			NumArgs = 1;
+		} else if ( Operator == FuncCos ) {
+			OpCode = ErlOpCos;
+			NumArgs = 1;
+		} else if ( Operator == FuncArcSin ) {
+			OpCode = ErlOpArcSin;
+			NumArgs = 1;
+		} else if ( Operator == FuncArcCos ) {
+			OpCode = ErlOpArcCos;
+			NumArgs = 1;
+		} else if ( Operator == FuncDegToRad ) {
+			OpCode = ErlOpDegToRad;
+			NumArgs = 1;
+		} else if ( Operator == FuncRadToDeg ) {
+			OpCode = ErlOpRadToDeg;
+			NumArgs = 1;
+		} else if ( Operator == FuncExp ) {
+			OpCode = ErlOpExp;
+			NumArgs = 1;
+		} else if ( Operator == FuncLn ) {
+			OpCode = ErlOpLn;
+			NumArgs = 1;
+		} else if ( Operator == FuncMax ) {
+			OpCode = ErlOpMax;
+			NumArgs = 2;
+		} else if ( Operator == FuncMin ) {
+			OpCode = ErlOpMin;
+			NumArgs = 2;
+		} else if ( Operator == FuncABS ) {
+			OpCode = ErlOpABS;
+			NumArgs = 1;
+		} else {
+			return false;
+		}
+		if ( thisExpression.NumOperands != NumArgs ) return false;
+
+		for ( OperandNum = 1; OperandNum <= NumArgs; ++OperandNum ) {
+			auto const & thisOperand( thisExpression.Operand( OperandNum ) );
+			if ( thisOperand.Type == ValueNumber ) {
+				Bytecode.emplace_back( ErlOpPushNumber, 0, thisOperand.Number );
+				MaxStackDepth = max( MaxStackDepth, ++StackDepth );
+			} else if ( thisOperand.Type == ValueVariable ) {
+				Bytecode.emplace_back( ErlOpPushVariable, thisOperand.Variable, 0.0 );
+				MaxStackDepth = max( MaxStackDepth, ++StackDepth );
+			} else if ( thisOperand.Type == ValueExpression ) {
+				if ( ! CompileExpressionTree( thisOperand.Expression, Bytecode, StackDepth, MaxStackDepth ) ) return false;
+			} else {
+				return false;
+			}
+		}
+
+		// a literal just passes its operand through
+		if ( Operator != OperatorLiteral ) Bytecode.emplace_back( OpCode, 0, 0.0 );
+		StackDepth -= NumArgs - 1;
+
+		return true;
+
+	}
+
+	bool
+	EvaluateCompiledExpression(
+		int const ExpressionNum, // index of expression in structure
+		Real64 & Result // value of the expression
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Evaluates the compiled bytecode of an expression on a stack of plain numbers.
+
+		// METHODOLOGY EMPLOYED:
+		// Returns false, without side effects, wherever the interpreter would not end up with the plain
+		// number computed here: a variable that does not hold a number, divide by zero, raising to a
+		// power giving NaN, exponential overflow and the log of zero or less.  The caller then
+		// reevaluates the expression with the interpreter, which produces the same result and errors
+		// as before.
+
+		// Using/Aliasing
+		using DataGlobals::DegToRadians;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 * const Stack( ErlBytecodeStack.data() );
+		int Top( -1 ); // index of the top of the operand stack
+
+		for ( auto const & Instruction : ErlExpression( ExpressionNum ).Bytecode ) {
+			switch ( Instruction.OpCode ) {
+			case ErlOpPushNumber:
+				Stack[ ++Top ] = Instruction.Number;
+				break;
+			case ErlOpPushVariable: {
+				auto const & thisValue( ErlVariable( Instruction.Variable ).Value );
+				if ( thisValue.Type != ValueNumber ) return false;
+				Stack[ ++Top ] = thisValue.Number;
+				break;
+			}
+			case ErlOpNegative:
+				Stack[ Top ] = -1.0 * Stack[ Top ];
+				break;
+			case ErlOpDivide:
+				if ( Stack[ Top ] == 0.0 ) return false;
+				--Top;
+				Stack[ Top ] /= Stack[ Top + 1 ];
+				break;
+			case ErlOpMultiply:
+				--Top;
+				Stack[ Top ] *= Stack[ Top + 1 ];
+				break;
+			case ErlOpSubtract:
+				--Top;
+				Stack[ Top ] -= Stack[ Top + 1 ];
+				break;
+			case ErlOpAdd:
+				--Top;
+				Stack[ Top ] += Stack[ Top + 1 ];
+				break;
+			case ErlOpEqual:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] == Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpNotEqual:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] != Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpLessOrEqual:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] <= Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpGreaterOrEqual:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] >= Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpLessThan:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] < Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpGreaterThan:
+				--Top;
+				Stack[ Top ] = ( Stack[ Top ] > Stack[ Top + 1 ] ) ? True.Number : False.Number;
+				break;
+			case ErlOpRaiseToPower:
+				--Top;
+				Stack[ Top ] = std::pow( Stack[ Top ], Stack[ Top + 1 ] );
+				if ( std::isnan( Stack[ Top ] ) ) return false;
+				break;
+			case ErlOpLogicalAND:
+				--Top;
+				Stack[ Top ] = ( ( Stack[ Top ] == True.Number ) && ( Stack[ Top + 1 ] == True.Number ) ) ? True.Number : False.Number;
+				break;
+			case ErlOpLogicalOR:
+				--Top;
+				Stack[ Top ] = ( ( Stack[ Top ] == True.Number ) || ( Stack[ Top + 1 ] == True.Number ) ) ? True.Number : False.Number;
+				break;
+			case ErlOpRound:
+				Stack[ Top ] = nint( Stack[ Top ] );
+				break;
+			case ErlOpMod:
+				--Top;
+				Stack[ Top ] = mod( Stack[ Top ], Stack[ Top + 1 ] );
+				break;
+			case ErlOpSin:
+				Stack[ Top ] = std::sin( Stack[ Top ] );
+				break;
+			case ErlOpCos:
+				Stack[ Top ] = std::cos( Stack[ Top ] );
+				break;
+			case ErlOpArcSin:
+				Stack[ Top ] = std::asin( Stack[ Top ] );
+				break;
+			case ErlOpArcCos:
+				Stack[ Top ] = std::acos( Stack[ Top ] );
+				break;
+			case ErlOpDegToRad:
+				Stack[ Top ] *= DegToRadians;
+				break;
+			case ErlOpRadToDeg:
+				Stack[ Top ] /= DegToRadians;
+				break;
+			case ErlOpExp:
+				if ( ! ( Stack[ Top ] < 700.0 ) ) return false;
+				Stack[ Top ] = std::exp( Stack[ Top ] );
+				break;
+			case ErlOpLn:
+				if ( ! ( Stack[ Top ] > 0.0 ) ) return false;
+				Stack[ Top ] = std::log( Stack[ Top ] );
+				break;
+			case ErlOpMax:
+				--Top;
+				Stack[ Top ] = max( Stack[ Top ], Stack[ Top + 1 ] );
+				break;
+			case ErlOpMin:
+				--Top;
+				Stack[ Top ] = min( Stack[ Top ], Stack[ Top + 1 ] );
+				break;
+			case ErlOpABS:
+				Stack[ Top ] = std::abs( Stack[ Top ] );
+				break;
+			default:
+				return false;
+			}
+		}
+
+		Result = Stack[ Top ];
+		return true;
+
+	}
+
 	void
 	GetRuntimeLanguageUserInput()
 	{
@@ -2860,6 +3207,9 @@ namespace RuntimeLanguageProcessor {
 				ShowFatalError( "Errors found in parsing EMS Runtime Language input. Preceding condition causes termination." );
 			}
 
+			// Compile the parsed expressions, the interpreter stays in use for anything not compiled
+			CompileExpressions();
+
 			if ( ( NumEMSOutputVariables > 0 ) || ( NumEMSMeteredOutputVariables > 0 ) ) {
 				RuntimeReportVar.allocate( NumEMSOutputVariables + NumEMSMeteredOutputVariables );
 			}
@@ -1,6 +1,9 @@
 #ifndef RuntimeLanguageProcessor_hh_INCLUDED
 #define RuntimeLanguageProcessor_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -17,6 +20,7 @@ namespace RuntimeLanguageProcessor {
 
 	// Using/Aliasing
 	using DataRuntimeLanguage::ErlValueType;
+	using DataRuntimeLanguage::ErlBytecodeType;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
@@ -85,6 +89,7 @@ namespace RuntimeLanguageProcessor {
 	extern int ActualDateAndTimeNum;
 	extern int ActualTimeNum;
 	extern int WarmUpFlagNum;
+	extern std::vector< Real64 > ErlBytecodeStack; // operand stack for evaluating compiled Erl expressions
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -230,6 +235,23 @@ namespace RuntimeLanguageProcessor {
 	ErlValueType
 	EvaluateExpression( int const ExpressionNum );
 
+	void
+	CompileExpressions();
+
+	bool
+	CompileExpressionTree(
+		int const ExpressionNum, // index of expression in structure
+		std::vector< ErlBytecodeType > & Bytecode, // compiled instructions, appended to
+		int & StackDepth, // operand stack depth at the end of the instructions
+		int & MaxStackDepth // largest operand stack depth reached
+	);
+
+	bool
+	EvaluateCompiledExpression(
+		int const ExpressionNum, // index of expression in structure
+		Real64 & Result // value of the expression
+	);
+
 	void
 	GetRuntimeLanguageUserInput();
 
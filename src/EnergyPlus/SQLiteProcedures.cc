@@ -18,6 +18,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <map>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -27,6 +28,7 @@ const int SQLite::LocalReportHourly   =  1;   // Write out at 'EndHourFlag'
 const int SQLite::LocalReportDaily    =  2;   // Write out at 'EndDayFlag'
 const int SQLite::LocalReportMonthly  =  3;   // Write out at end of month (must be determined)
 const int SQLite::LocalReportSim      =  4;   // Write out once per environment 'EndEnvrnFlag'
+const int SQLite::ReportDataBatchRows = 200; // 4 parameters per row, sqlite allows 999 per statement
 const int SQLite::ReportNameId        =  1;
 const int SQLite::ReportForStringId   =  2;
 const int SQLite::TableNameId         =  3;
@@ -144,6 +146,7 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 	m_writeTabularDataToSQLite(writeTabularDataToSQLite),
 	m_sqlDBTimeIndex(0),
 	m_reportDataInsertStmt(nullptr),
+	m_reportDataBatchInsertStmt(nullptr),
 	m_reportExtendedDataInsertStmt(nullptr),
 	m_reportDictionaryInsertStmt(nullptr),
 	m_timeIndexInsertStmt(nullptr),
@@ -182,6 +185,7 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 	m_stringsLookUpStmt(nullptr),
 	m_errorInsertStmt(nullptr),
 	m_errorUpdateStmt(nullptr),
+	m_timingsInsertStmt(nullptr),
 	m_simulationUpdateStmt(nullptr),
 	m_simulationDataUpdateStmt(nullptr)
 {
@@ -198,6 +202,7 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 		initializeSimulationsTable();
 		initializeEnvironmentPeriodsTable();
 		initializeErrorsTable();
+		initializeTimingsTable();
 		initializeTimeIndicesTable();
 		initializeZoneInfoTable();
 		initializeZoneListTable();
@@ -235,7 +240,9 @@ SQLite::SQLite( std::shared_ptr<std::ostream> errorStream, std::string const & d
 
 SQLite::~SQLite()
 {
+	if ( m_writeOutputToSQLite ) flushReportDataBatch();
 	sqlite3_finalize(m_reportDataInsertStmt);
+	sqlite3_finalize(m_reportDataBatchInsertStmt);
 	sqlite3_finalize(m_reportExtendedDataInsertStmt);
 	sqlite3_finalize(m_reportDictionaryInsertStmt);
 	sqlite3_finalize(m_timeIndexInsertStmt);
@@ -274,6 +281,7 @@ SQLite::~SQLite()
 	sqlite3_finalize(m_stringsLookUpStmt);
 	sqlite3_finalize(m_errorInsertStmt);
 	sqlite3_finalize(m_errorUpdateStmt);
+	sqlite3_finalize(m_timingsInsertStmt);
 	sqlite3_finalize(m_simulationUpdateStmt);
 	sqlite3_finalize(m_simulationDataUpdateStmt);
 }
@@ -298,6 +306,7 @@ void SQLite::sqliteBegin()
 void SQLite::sqliteCommit()
 {
 	if ( m_writeOutputToSQLite ) {
+		flushReportDataBatch();
 		sqliteExecuteCommand("COMMIT;");
 	}
 }
@@ -369,6 +378,21 @@ void SQLite::initializeReportDataTables()
 
 	sqlitePrepareStatement(m_reportDataInsertStmt,reportDataInsertSQL);
 
+	std::string reportDataBatchInsertSQL =
+		"INSERT INTO ReportData ("
+		"ReportDataIndex, "
+		"TimeIndex, "
+		"ReportDataDictionaryIndex, "
+		"Value) "
+		"VALUES(?,?,?,?)";
+	for ( int row = 2; row <= ReportDataBatchRows; ++row ) {
+		reportDataBatchInsertSQL += ",(?,?,?,?)";
+	}
+	reportDataBatchInsertSQL += ";";
+
+	sqlitePrepareStatement(m_reportDataBatchInsertStmt,reportDataBatchInsertSQL);
+	m_reportDataBatch.reserve(ReportDataBatchRows);
+
 	const std::string reportExtendedDataTableSQL =
 		"CREATE TABLE ReportExtendedData ("
 		"ReportExtendedDataIndex INTEGER PRIMARY KEY, "
@@ -1144,6 +1168,25 @@ void SQLite::initializeErrorsTable()
 	sqlitePrepareStatement(m_errorUpdateStmt,errorUpdateSQL);
 }
 
+void SQLite::initializeTimingsTable()
+{
+	const std::string timingsTableSQL =
+		"CREATE TABLE Timings ( "
+		"TimingIndex INTEGER PRIMARY KEY, ThreadIndex INTEGER, ParentTimingIndex INTEGER, "
+		"RegionName TEXT, RegionPath TEXT, Calls INTEGER, "
+		"InclusiveTime REAL, ExclusiveTime REAL, "
+		"FOREIGN KEY(ParentTimingIndex) REFERENCES Timings(TimingIndex) "
+		"ON DELETE CASCADE ON UPDATE CASCADE "
+		");";
+
+	sqliteExecuteCommand(timingsTableSQL);
+
+	const std::string timingsInsertSQL =
+		"INSERT INTO Timings VALUES(?,?,?,?,?,?,?,?);";
+
+	sqlitePrepareStatement(m_timingsInsertStmt,timingsInsertSQL);
+}
+
 void SQLite::initializeEnvironmentPeriodsTable()
 {
 	const std::string environmentPeriodsTableSQL =
@@ -1261,6 +1304,7 @@ void SQLite::initializeTabularDataView()
 void SQLite::initializeIndexes()
 {
 	if ( m_writeOutputToSQLite ) {
+		flushReportDataBatch();
 		sqliteExecuteCommand("CREATE INDEX rddMTR ON ReportDataDictionary (IsMeter);");
 		sqliteExecuteCommand("CREATE INDEX redRD ON ReportExtendedData (ReportDataIndex);");
 
@@ -1424,15 +1468,13 @@ void SQLite::createSQLiteReportDataRecord(
 
 		++dataIndex;
 
-		sqliteBindInteger(m_reportDataInsertStmt, 1, dataIndex);
-		sqliteBindForeignKey(m_reportDataInsertStmt, 2, m_sqlDBTimeIndex);
-		sqliteBindForeignKey(m_reportDataInsertStmt, 3, recordIndex);
-		sqliteBindDouble(m_reportDataInsertStmt, 4, value);
-
-		sqliteStepCommand(m_reportDataInsertStmt);
-		sqliteResetCommand(m_reportDataInsertStmt);
+		// Rows are written in batches, at the latest when the transaction is committed
+		m_reportDataBatch.push_back( { dataIndex, m_sqlDBTimeIndex, recordIndex, value } );
+		if ( m_reportDataBatch.size() >= std::size_t( ReportDataBatchRows ) ) flushReportDataBatch();
 
 		if (reportingInterval.present() && minValueDate != 0 && maxValueDate != 0) {
+			flushReportDataBatch(); // ReportExtendedData rows refer to the ReportData row
+
 			int minMonth;
 			int minDay;
 			int minHour;
@@ -1524,6 +1566,37 @@ void SQLite::createSQLiteReportDataRecord(
 	}
 }
 
+void SQLite::flushReportDataBatch()
+{
+	std::size_t const numRows = m_reportDataBatch.size();
+	std::size_t row = 0;
+
+	for ( ; row + ReportDataBatchRows <= numRows; row += ReportDataBatchRows ) {
+		for ( int batchRow = 0; batchRow < ReportDataBatchRows; ++batchRow ) {
+			ReportDataRow const & reportDataRow = m_reportDataBatch[row + batchRow];
+			int const firstParameter = 4 * batchRow;
+			sqliteBindInteger(m_reportDataBatchInsertStmt, firstParameter + 1, reportDataRow.dataIndex);
+			sqliteBindForeignKey(m_reportDataBatchInsertStmt, firstParameter + 2, reportDataRow.timeIndex);
+			sqliteBindForeignKey(m_reportDataBatchInsertStmt, firstParameter + 3, reportDataRow.recordIndex);
+			sqliteBindDouble(m_reportDataBatchInsertStmt, firstParameter + 4, reportDataRow.value);
+		}
+		sqliteStepCommand(m_reportDataBatchInsertStmt);
+		sqliteResetCommand(m_reportDataBatchInsertStmt);
+	}
+
+	for ( ; row < numRows; ++row ) { // Rest of the rows one at a time
+		ReportDataRow const & reportDataRow = m_reportDataBatch[row];
+		sqliteBindInteger(m_reportDataInsertStmt, 1, reportDataRow.dataIndex);
+		sqliteBindForeignKey(m_reportDataInsertStmt, 2, reportDataRow.timeIndex);
+		sqliteBindForeignKey(m_reportDataInsertStmt, 3, reportDataRow.recordIndex);
+		sqliteBindDouble(m_reportDataInsertStmt, 4, reportDataRow.value);
+		sqliteStepCommand(m_reportDataInsertStmt);
+		sqliteResetCommand(m_reportDataInsertStmt);
+	}
+
+	m_reportDataBatch.clear();
+}
+
 void SQLite::createSQLiteTimeIndexRecord(
 	int const reportingInterval,
 	int const EP_UNUSED( recordIndex ),
@@ -1857,6 +1930,17 @@ void SQLite::createSQLiteTabularDataRecords(
 		int const tableNameIndex = createSQLiteStringTableRecord(tableName, TableNameId);
 		int unitsIndex;
 
+		// Row labels are the same for every column so parse them once and keep their string
+		// indexes as they are first used (0 = not yet looked up) so the Strings rows are
+		// still created in the same order
+		std::vector< std::string > rowUnits(sizeRowLabels);
+		std::vector< std::string > rowDescriptions(sizeRowLabels);
+		std::vector< int > rowLabelIndexes(sizeRowLabels, 0);
+		std::vector< int > rowUnitsIndexes(sizeRowLabels, 0);
+		for ( size_t iRow = 0; iRow < sizeRowLabels; ++iRow ) {
+			parseUnitsAndDescription(rowLabels[iRow], rowUnits[iRow], rowDescriptions[iRow]);
+		}
+
 		for ( size_t iCol = 0, k = body.index(1,1); iCol < sizeColumnLabels; ++iCol ) {
 			std::string colUnits;
 			std::string colDescription;
@@ -1870,14 +1954,17 @@ void SQLite::createSQLiteTabularDataRecords(
 
 			for ( size_t iRow = 0; iRow < sizeRowLabels; ++iRow ) {
 				++tabularDataIndex;
-				std::string rowUnits;
-				std::string rowDescription;
-				parseUnitsAndDescription(rowLabels[iRow], rowUnits, rowDescription);
 
-				int const rowLabelIndex = createSQLiteStringTableRecord(rowDescription, RowNameId);
+				if ( rowLabelIndexes[iRow] == 0 ) {
+					rowLabelIndexes[iRow] = createSQLiteStringTableRecord(rowDescriptions[iRow], RowNameId);
+				}
+				int const rowLabelIndex = rowLabelIndexes[iRow];
 
 				if ( colUnits.empty() ) {
-					unitsIndex = createSQLiteStringTableRecord(rowUnits, UnitsId);
+					if ( rowUnitsIndexes[iRow] == 0 ) {
+						rowUnitsIndexes[iRow] = createSQLiteStringTableRecord(rowUnits[iRow], UnitsId);
+					}
+					unitsIndex = rowUnitsIndexes[iRow];
 				}
 
 				sqliteBindInteger(m_tabularDataInsertStmt,1,tabularDataIndex);
@@ -1971,6 +2058,32 @@ void SQLite::createSQLiteErrorRecord(
 	}
 }
 
+void SQLite::createSQLiteTimingsRecord(
+	int const timingIndex,
+	int const threadIndex,
+	int const parentIndex,
+	std::string const & regionName,
+	std::string const & regionPath,
+	Int64 const calls,
+	double const inclusiveTime,
+	double const exclusiveTime
+)
+{
+	if ( m_writeOutputToSQLite ) {
+		sqliteBindInteger(m_timingsInsertStmt, 1, timingIndex);
+		sqliteBindInteger(m_timingsInsertStmt, 2, threadIndex);
+		sqliteBindForeignKey(m_timingsInsertStmt, 3, parentIndex);
+		sqliteBindText(m_timingsInsertStmt, 4, regionName);
+		sqliteBindText(m_timingsInsertStmt, 5, regionPath);
+		sqlite3_bind_int64(m_timingsInsertStmt, 6, calls);
+		sqliteBindDouble(m_timingsInsertStmt, 7, inclusiveTime);
+		sqliteBindDouble(m_timingsInsertStmt, 8, exclusiveTime);
+
+		sqliteStepCommand(m_timingsInsertStmt);
+		sqliteResetCommand(m_timingsInsertStmt);
+	}
+}
+
 void SQLite::updateSQLiteErrorRecord( std::string const & errorMessage )
 {
 	if ( m_writeOutputToSQLite ) {
@@ -16,6 +16,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace EnergyPlus {
 
@@ -199,6 +200,17 @@ public:
 
 	void updateSQLiteErrorRecord( std::string const & errorMessage );
 
+	void createSQLiteTimingsRecord(
+		int const timingIndex,
+		int const threadIndex,
+		int const parentIndex,
+		std::string const & regionName,
+		std::string const & regionPath,
+		Int64 const calls,
+		double const inclusiveTime,
+		double const exclusiveTime
+	);
+
 	void updateSQLiteSimulationRecord( bool const completed, bool const completedSuccessfully, int const id = 1 );
 
 	void updateSQLiteSimulationRecord( int const id, int const numOfTimeStepInHour );
@@ -256,12 +268,27 @@ private:
 	void initializeSimulationsTable();
 	void initializeEnvironmentPeriodsTable();
 	void initializeErrorsTable();
+	void initializeTimingsTable();
 	void initializeTabularDataTable();
 	void initializeTabularDataView();
 
+	// Writes the buffered ReportData rows, ReportDataBatchRows at a time
+	void flushReportDataBatch();
+
+	// ReportData row waiting to be written (see createSQLiteReportDataRecord)
+	struct ReportDataRow
+	{
+		int dataIndex;
+		int timeIndex;
+		int recordIndex;
+		double value;
+	};
+
 	bool m_writeTabularDataToSQLite;
 	int m_sqlDBTimeIndex;
 	sqlite3_stmt * m_reportDataInsertStmt;
+	sqlite3_stmt * m_reportDataBatchInsertStmt;
+	std::vector< ReportDataRow > m_reportDataBatch;
 	sqlite3_stmt * m_reportExtendedDataInsertStmt;
 	sqlite3_stmt * m_reportDictionaryInsertStmt;
 	sqlite3_stmt * m_timeIndexInsertStmt;
@@ -300,6 +327,7 @@ private:
 	sqlite3_stmt * m_stringsLookUpStmt;
 	sqlite3_stmt * m_errorInsertStmt;
 	sqlite3_stmt * m_errorUpdateStmt;
+	sqlite3_stmt * m_timingsInsertStmt;
 	sqlite3_stmt * m_simulationUpdateStmt;
 	sqlite3_stmt * m_simulationDataUpdateStmt;
 
@@ -309,6 +337,7 @@ private:
 	static const int LocalReportDaily;     //  Write out at 'EndDayFlag'
 	static const int LocalReportMonthly;   //  Write out at end of month (must be determined)
 	static const int LocalReportSim;       //  Write out once per environment 'EndEnvrnFlag'
+	static const int ReportDataBatchRows;  //  ReportData rows written by one insert statement
 	static const int ReportNameId;
 	static const int ReportForStringId;
 	static const int TableNameId;
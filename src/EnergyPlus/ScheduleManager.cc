@@ -1,3 +1,10 @@
+// C++ Headers
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -12,10 +19,12 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <MappedFile.hh>
 #include <OutputProcessor.hh>
 #include <UtilityRoutines.hh>
 
@@ -102,10 +111,36 @@ namespace ScheduleManager {
 	Array1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	Array1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	Array1D< ScheduleData > Schedule; // Schedule Storage
+	Array1D_bool ScheduleValueChanged; // True for schedules whose value changed at the last UpdateScheduleValues
+
+	// Schedule value updates (SetScheduleValues)
+	static Array1D_int CurrentDaySchedule; // Day schedule of each schedule on the current day
+	static Array1D_int ScheduleChangeStart; // First ScheduleChangeList entry of each timestep of the day (one extra at the end)
+	static Array1D_int ScheduleChangeList; // Schedules whose value changes, by timestep of the current day
+	static std::vector< int > ChangedSchedules; // Schedules flagged in ScheduleValueChanged
+	static std::vector< int > PendingChangedSchedules; // Schedules changed between zone timesteps, flagged at the next one
+	static std::vector< int > EMSOverriddenSchedules; // Schedules whose CurrentValue holds the EMS value for reporting
+	static bool ScheduleValuesSet( false ); // CurrentDaySchedule and ScheduleChangeList are set for the day below
+	static int ValuesDayOfYear( 0 ); // Day of year (schedule) the schedule values are set for
+	static int ValuesDayOfWeek( 0 ); // Day of week the schedule values are set for
+	static int ValuesHolidayIndex( 0 ); // Holiday index the schedule values are set for
+	static int ValuesDSTIndicator( 0 ); // Daylight saving time indicator the schedule values are set for
+	static int ValuesSlot( 0 ); // Timestep of the day the schedule values are set for
 
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
 
+	// Schedule:File contents, mapped once and shared by all the schedules that read columns of the file
+	struct ScheduleFileData
+	{
+		std::unique_ptr< MappedFileBuf > Buf; // Mapped file
+		std::vector< std::string::size_type > LineStart; // Start of each line
+		std::vector< std::string::size_type > LineEnd; // End of each line (less the line terminator)
+		char Sep; // Column separator the column cursors were set for
+		std::vector< int > CursorCol; // Column whose field start is held for each line (0 if none)
+		std::vector< std::string::size_type > Cursor; // Start of that field on each line
+	};
+
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
@@ -119,6 +154,7 @@ namespace ScheduleManager {
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   September 1997
 		//       MODIFIED       Rui Zhang February 2010
+		//                      Oct 2026, map each Schedule:File once and share it between schedules
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -248,16 +284,15 @@ namespace ScheduleManager {
 		bool FileExists;
 		// for SCHEDULE:FILE
 		Array1D< Real64 > hourlyFileValues;
-		int SchdFile;
+		std::map< std::string, ScheduleFileData > ScheduleFiles; // Files read so far, by full file name
 		int colCnt;
 		int rowCnt;
-		int wordStart;
-		int wordEnd;
+		std::string::size_type wordStart;
 		std::string::size_type sepPos;
-		std::string LineIn;
+		std::string::size_type lineEnd;
+		std::string::size_type iLine;
 		std::string subString;
 		Real64 columnValue;
-		int read_stat;
 		int iDay;
 		int hDay;
 		int jHour;
@@ -267,7 +302,6 @@ namespace ScheduleManager {
 		std::string::size_type sPos;
 		std::string CurrentModuleObject; // for ease in getting objects
 		int MaxNums1;
-		std::string::size_type endLine;
 		std::string ColumnSep;
 		bool firstLine;
 		bool FileIntervalInterpolated;
@@ -279,6 +313,8 @@ namespace ScheduleManager {
 		int ifld;
 		int hrLimitCount;
 
+		DataTimings::ProfileTimer const profileTimer( "ProcessScheduleInput" ); // Region of the timing profile
+
 		MaxNums = 1; // Need at least 1 number because it's used as a local variable in the Schedule Types loop
 		MaxAlps = 0;
 
@@ -1391,73 +1427,92 @@ namespace ScheduleManager {
 				ShowContinueError( "Try again with putting full path and file name in the field." );
 				ErrorsFound = true;
 			} else {
-				SchdFile = GetNewUnitNumber();
-				{ IOFlags flags; flags.ACTION( "read" ); gio::open( SchdFile, TempFullFileName, flags ); read_stat = flags.ios(); }
-				if ( read_stat != 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
-					ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
-					ShowFatalError( "Program terminates due to previous condition." );
+				// Map each file once: schedules reading other columns of the same file reuse the mapping and line index
+				auto iFile( ScheduleFiles.find( TempFullFileName ) );
+				if ( iFile == ScheduleFiles.end() ) {
+					iFile = ScheduleFiles.emplace( TempFullFileName, ScheduleFileData() ).first;
+					ScheduleFileData & newFile( iFile->second );
+					newFile.Buf.reset( new MappedFileBuf( TempFullFileName ) );
+					if ( ! newFile.Buf->is_open() ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
+						ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
+						ShowFatalError( "Program terminates due to previous condition." );
+					}
+					// Index the lines: the text after the last newline is a (possibly empty) final line, as a line read would see it
+					char const * const fileData( newFile.Buf->data() );
+					std::string::size_type const fileSize( newFile.Buf->size() );
+					std::string::size_type lineStart( 0 );
+					while ( true ) {
+						char const * const newLine( lineStart < fileSize ? static_cast< char const * >( std::memchr( fileData + lineStart, '\n', fileSize - lineStart ) ) : nullptr );
+						lineEnd = ( newLine != nullptr ? newLine - fileData : fileSize );
+						newFile.LineStart.push_back( lineStart );
+						newFile.LineEnd.push_back( ( lineEnd > lineStart && fileData[ lineEnd - 1 ] == '\r' ) ? lineEnd - 1 : lineEnd );
+						if ( newLine == nullptr ) break;
+						lineStart = lineEnd + 1;
+					}
+					newFile.Sep = '\0';
+					newFile.CursorCol.assign( newFile.LineStart.size(), 0 );
+					newFile.Cursor.assign( newFile.LineStart.size(), 0 );
+				}
+				ScheduleFileData & schdFile( iFile->second );
+				char const * const fileData( schdFile.Buf->data() );
+				std::string::size_type const numLines( schdFile.LineStart.size() );
+				char const sep( ColumnSep[ 0 ] );
+				if ( schdFile.Sep != sep ) { // Cursors are only good for the separator they were found with
+					schdFile.Sep = sep;
+					schdFile.CursorCol.assign( numLines, 0 );
 				}
+
 				// check for stripping
-				{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-				endLine = len( LineIn );
-				if ( endLine > 0 ) {
-					if ( int( LineIn[ endLine - 1 ] ) == iUnicode_end ) {
-						gio::close( SchdFile );
+				if ( schdFile.LineEnd[ 0 ] > schdFile.LineStart[ 0 ] ) {
+					if ( int( fileData[ schdFile.LineEnd[ 0 ] - 1 ] ) == iUnicode_end ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
 						ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
 						ShowFatalError( "Program terminates due to previous condition." );
 					}
 				}
-				gio::backspace( SchdFile );
 
-				// skip lines if any need to be skipped.
+				// skip lines if any need to be skipped: reaching the last line while skipping leaves nothing to read
 				numerrors = 0;
-				rowCnt = 0;
-				read_stat = 0;
-				if ( skiprowCount > 0 ) { // Numbers(2) has number of rows to skip
-					while ( read_stat == 0 ) { //end of file
-						{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-						++rowCnt;
-						if ( rowCnt == skiprowCount ) {
-							break;
-						}
-					}
-				}
+				iLine = ( skiprowCount > 0 ? skiprowCount : 0 );
 
 				//  proper number of lines are skipped.  read the file
 				// for the rest of the lines read from the file
 				rowCnt = 0;
 				firstLine = true;
-				while ( read_stat == 0 ) { //end of file
-					{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
+				for ( ; iLine < numLines; ++iLine ) {
 					++rowCnt;
-					colCnt = 0;
-					wordStart = 0;
-					columnValue = 0.0;
-					//scan through the line looking for a specific column
+					lineEnd = schdFile.LineEnd[ iLine ];
+					// scan through the line looking for a specific column, starting from the field found for an
+					// earlier schedule on this line when that is not past the column wanted
+					if ( schdFile.CursorCol[ iLine ] > 0 && schdFile.CursorCol[ iLine ] <= curcolCount ) {
+						colCnt = schdFile.CursorCol[ iLine ] - 1;
+						wordStart = schdFile.Cursor[ iLine ];
+						if ( colCnt > 0 ) firstLine = false; // a separator was passed on this line to get to the cursor
+					} else {
+						colCnt = 0;
+						wordStart = schdFile.LineStart[ iLine ];
+					}
 					while ( true ) {
-						sepPos = index( LineIn, ColumnSep );
+						char const * const sepChar( wordStart < lineEnd ? static_cast< char const * >( std::memchr( fileData + wordStart, sep, lineEnd - wordStart ) ) : nullptr );
 						++colCnt;
-						if ( sepPos != std::string::npos ) {
-							if ( sepPos > 0 ) {
-								wordEnd = sepPos - 1;
-							} else {
-								wordEnd = wordStart;
-							}
-							subString = LineIn.substr( wordStart, wordEnd - wordStart + 1 );
-							//the next word will start after the comma
+						if ( colCnt == curcolCount ) {
+							schdFile.CursorCol[ iLine ] = colCnt;
+							schdFile.Cursor[ iLine ] = wordStart;
+						}
+						if ( sepChar != nullptr ) {
+							sepPos = sepChar - fileData;
+							// an empty field gives the separator itself, which is read as an error
+							subString.assign( fileData + wordStart, sepPos > wordStart ? sepPos - wordStart : 1 );
+							//the next word will start after the separator
 							wordStart = sepPos + 1;
-							//get rid of separator so next INDEX will find next separator
-							LineIn.erase( 0, wordStart );
 							firstLine = false;
-							wordStart = 0;
 						} else {
-							//no more commas
-							subString = LineIn.substr( wordStart );
+							//no more separators
+							subString.assign( fileData + wordStart, lineEnd - std::min( wordStart, lineEnd ) );
 							if ( firstLine && subString == BlankString ) {
 								ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\" first line does not contain the indicated column separator=" + Alphas( 4 ) + '.' );
-								ShowContinueError( "...first 40 characters of line=[" + LineIn.substr( 0, 40 ) + ']' );
+								ShowContinueError( "...first 40 characters of line=[" + subString.substr( 0, 40 ) + ']' );
 								firstLine = false;
 							}
 							break;
@@ -1476,7 +1531,6 @@ namespace ScheduleManager {
 					hourlyFileValues( rowCnt ) = columnValue;
 					if ( rowCnt == rowLimitCount ) break;
 				}
-				gio::close( SchdFile );
 
 				// schedule values have been filled into the hourlyFileValues array.
 
@@ -2253,7 +2307,7 @@ namespace ScheduleManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   August 2011; adapted from Autodesk (time reduction)
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; only schedules whose value changes are set
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2263,7 +2317,92 @@ namespace ScheduleManager {
 		// METHODOLOGY EMPLOYED:
 		// Use internal Schedule data structure to calculate current value.  Note that missing values in
 		// input will equate to 0 indices in arrays -- which has been set up to return legally with
-		// 0.0 values.
+		// 0.0 values.  The work is done in SetScheduleValues, which also flags the schedules whose
+		// value changed in ScheduleValueChanged.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		if ( ! ScheduleInputProcessed ) {
+			ProcessScheduleInput();
+			ScheduleInputProcessed = true;
+		}
+
+		SetScheduleValues( true );
+
+	}
+
+	inline
+	Real64
+	DaySlotValue(
+		int const DaySchedulePointer, // Day schedule
+		int const Slot, // Timestep of the day (1 = first timestep after midnight)
+		int const DST // Daylight saving time indicator (0 or 1)
+	)
+	{
+		// Value of a day schedule at a timestep of the day; with daylight saving time the last hour
+		// of the day uses the first hour, as in LookUpScheduleValue.
+		int WhichHour( ( Slot - 1 ) / NumOfTimeStepInHour + 1 + DST );
+		if ( WhichHour > 24 ) WhichHour -= 24;
+		return DaySchedule( DaySchedulePointer ).TSValue( Slot - ( ( Slot - 1 ) / NumOfTimeStepInHour ) * NumOfTimeStepInHour, WhichHour );
+	}
+
+	inline
+	void
+	FlagScheduleValueChange(
+		int const ScheduleIndex,
+		bool const NewTimeStep // True at the start of a zone timestep
+	)
+	{
+		// Flags a changed schedule in ScheduleValueChanged, or keeps it for the next zone timestep.
+		if ( ! NewTimeStep ) {
+			PendingChangedSchedules.push_back( ScheduleIndex );
+		} else if ( ! ScheduleValueChanged( ScheduleIndex ) ) {
+			ScheduleValueChanged( ScheduleIndex ) = true;
+			ChangedSchedules.push_back( ScheduleIndex );
+		}
+	}
+
+	void
+	SetScheduleValues( bool const NewTimeStep ) // True at the start of a zone timestep (UpdateScheduleValues)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the CurrentValue of the schedules for the current time, touching only the schedules
+		// whose value changes, and flags those schedules in ScheduleValueChanged.
+
+		// METHODOLOGY EMPLOYED:
+		// The day schedule of each schedule is found once a day (the day of year, day of week,
+		// holiday and daylight saving time indicator change).  At the same time the schedules are
+		// listed by the timesteps of the day at which their value changes, from the change timesteps
+		// of their day schedules (SetDayScheduleChanges).  The next timestep of the day then only
+		// sets the schedules listed for it; any other timestep of the same day sets all schedules
+		// from their day schedules.  Times that do not fall on a timestep of the day use the
+		// original lookup for all schedules.
+		// Changes found between zone timesteps (NewTimeStep false, from ReportScheduleValues) are
+		// flagged at the start of the next zone timestep, so they are not cleared before they are seen.
 
 		// REFERENCES:
 		// na
@@ -2273,7 +2412,6 @@ namespace ScheduleManager {
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// na
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		// na
@@ -2289,40 +2427,232 @@ namespace ScheduleManager {
 		int WhichHour;
 		int WeekSchedulePointer;
 		int DaySchedulePointer;
+		int Slot; // Timestep of the day
+		int NumSlots; // Timesteps in a day
+		int Loop;
+		Real64 Value;
+		bool FlagAll( false ); // All schedules are flagged as changed (new schedule data)
+		static Array1D_int NextChange; // Next free ScheduleChangeList entry of each timestep of the day
+
+		if ( ScheduleValueChanged.isize() != NumSchedules || CurrentDaySchedule.isize() != NumSchedules ) {
+			ScheduleValueChanged.dimension( NumSchedules, false );
+			CurrentDaySchedule.dimension( NumSchedules, 0 );
+			ChangedSchedules.clear();
+			PendingChangedSchedules.clear();
+			EMSOverriddenSchedules.clear();
+			ScheduleValuesSet = false;
+			FlagAll = true;
+		}
 
-		if ( ! ScheduleInputProcessed ) {
-			ProcessScheduleInput();
-			ScheduleInputProcessed = true;
+		if ( NewTimeStep ) {
+			for ( int const Index : ChangedSchedules ) {
+				ScheduleValueChanged( Index ) = false;
+			}
+			ChangedSchedules.clear();
+			for ( int const Index : PendingChangedSchedules ) {
+				FlagScheduleValueChange( Index, true );
+			}
+			PendingChangedSchedules.clear();
+		}
+
+		// Values set for reporting under EMS go back to the scheduled values
+		if ( ScheduleValuesSet ) {
+			for ( int const Index : EMSOverriddenSchedules ) {
+				Schedule( Index ).CurrentValue = DaySlotValue( CurrentDaySchedule( Index ), ValuesSlot, ValuesDSTIndicator );
+			}
 		}
+		EMSOverriddenSchedules.clear();
 
-		WhichHour = HourOfDay + DSTIndicator;
+		if ( HourOfDay < 1 || HourOfDay > 24 || TimeStep < 1 || TimeStep > NumOfTimeStepInHour || DSTIndicator < 0 || DSTIndicator > 1 ) {
+			// Not a timestep of the day: original lookup
+			WhichHour = HourOfDay + DSTIndicator;
 
-		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
 
-			// Determine which Week Schedule is used
-			//  Cant use stored day of year because of leap year inconsistency
-			WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+				// Determine which Week Schedule is used
+				//  Cant use stored day of year because of leap year inconsistency
+				WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+
+				// Now, which day?
+				if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
+					DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
+				} else {
+					DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+				}
+
+				// Hourly Value
+				if ( WhichHour <= 24 ) {
+					Value = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour );
+				} else if ( TimeStep <= NumOfTimeStepInHour ) {
+					Value = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour - 24 );
+				} else {
+					Value = DaySchedule( DaySchedulePointer ).TSValue( NumOfTimeStepInHour, WhichHour - 24 );
+				}
+				if ( FlagAll || Value != Schedule( ScheduleIndex ).CurrentValue ) FlagScheduleValueChange( ScheduleIndex, NewTimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = Value;
 
-			// Now, which day?
-			if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
-			} else {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
 			}
 
-			// Hourly Value
-			if ( WhichHour <= 24 ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour );
-			} else if ( TimeStep <= NumOfTimeStepInHour ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour - 24 );
-			} else {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( NumOfTimeStepInHour, WhichHour - 24 );
+			ScheduleValuesSet = false;
+			return;
+		}
+
+		NumSlots = 24 * NumOfTimeStepInHour;
+		Slot = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+
+		if ( ! ScheduleValuesSet || DayOfYear_Schedule != ValuesDayOfYear || DayOfWeek != ValuesDayOfWeek || HolidayIndex != ValuesHolidayIndex || DSTIndicator != ValuesDSTIndicator ) {
+			// New day: find the day schedules and list the schedules by the timesteps their values change
+			ScheduleChangeStart.dimension( NumSlots + 1, 0 );
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+
+				// Determine which Week Schedule is used
+				//  Cant use stored day of year because of leap year inconsistency
+				WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+
+				// Now, which day?
+				if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
+					DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
+				} else {
+					DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+				}
+				CurrentDaySchedule( ScheduleIndex ) = DaySchedulePointer;
+
+				Value = DaySlotValue( DaySchedulePointer, Slot, DSTIndicator );
+				if ( FlagAll || Value != Schedule( ScheduleIndex ).CurrentValue ) FlagScheduleValueChange( ScheduleIndex, NewTimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = Value;
+
+				if ( ! DaySchedule( DaySchedulePointer ).ChangesSet ) SetDayScheduleChanges( DaySchedulePointer );
+				auto const & ChangeSlot( DSTIndicator == 0 ? DaySchedule( DaySchedulePointer ).ChangeSlot : DaySchedule( DaySchedulePointer ).DSTChangeSlot );
+				for ( Loop = 1; Loop <= ChangeSlot.isize(); ++Loop ) {
+					++ScheduleChangeStart( ChangeSlot( Loop ) + 1 );
+				}
+
+			}
+
+			ScheduleChangeStart( 1 ) = 1;
+			for ( Loop = 1; Loop <= NumSlots; ++Loop ) {
+				ScheduleChangeStart( Loop + 1 ) += ScheduleChangeStart( Loop );
+			}
+			ScheduleChangeList.dimension( ScheduleChangeStart( NumSlots + 1 ) - 1, 0 );
+			NextChange = ScheduleChangeStart;
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+				DaySchedulePointer = CurrentDaySchedule( ScheduleIndex );
+				auto const & ChangeSlot( DSTIndicator == 0 ? DaySchedule( DaySchedulePointer ).ChangeSlot : DaySchedule( DaySchedulePointer ).DSTChangeSlot );
+				for ( Loop = 1; Loop <= ChangeSlot.isize(); ++Loop ) {
+					ScheduleChangeList( NextChange( ChangeSlot( Loop ) )++ ) = ScheduleIndex;
+				}
 			}
 
+			ValuesDayOfYear = DayOfYear_Schedule;
+			ValuesDayOfWeek = DayOfWeek;
+			ValuesHolidayIndex = HolidayIndex;
+			ValuesDSTIndicator = DSTIndicator;
+			ScheduleValuesSet = true;
+
+		} else if ( Slot == ValuesSlot + 1 ) {
+			// Next timestep of the day: only the schedules that change
+			for ( Loop = ScheduleChangeStart( Slot ); Loop < ScheduleChangeStart( Slot + 1 ); ++Loop ) {
+				ScheduleIndex = ScheduleChangeList( Loop );
+				Value = DaySlotValue( CurrentDaySchedule( ScheduleIndex ), Slot, DSTIndicator );
+				if ( Value != Schedule( ScheduleIndex ).CurrentValue ) FlagScheduleValueChange( ScheduleIndex, NewTimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = Value;
+			}
+
+		} else if ( Slot != ValuesSlot ) {
+			// Another timestep of the same day (e.g. a repeated warmup day)
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+				Value = DaySlotValue( CurrentDaySchedule( ScheduleIndex ), Slot, DSTIndicator );
+				if ( Value != Schedule( ScheduleIndex ).CurrentValue ) FlagScheduleValueChange( ScheduleIndex, NewTimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = Value;
+			}
+
+		}
+
+		ValuesSlot = Slot;
+
+	}
+
+	void
+	SetDayScheduleChanges( int const DayScheduleIndex )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the timesteps of the day at which the value of a day schedule differs from the
+		// previous timestep, without and with daylight saving time in effect.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumSlots; // Timesteps in a day
+		int NumChanges;
+		int Slot;
+		int DST;
+
+		NumSlots = 24 * NumOfTimeStepInHour;
+		for ( DST = 0; DST <= 1; ++DST ) {
+			auto & ChangeSlot( DST == 0 ? DaySchedule( DayScheduleIndex ).ChangeSlot : DaySchedule( DayScheduleIndex ).DSTChangeSlot );
+			NumChanges = 0;
+			for ( Slot = 2; Slot <= NumSlots; ++Slot ) {
+				if ( DaySlotValue( DayScheduleIndex, Slot, DST ) != DaySlotValue( DayScheduleIndex, Slot - 1, DST ) ) ++NumChanges;
+			}
+			ChangeSlot.dimension( NumChanges );
+			NumChanges = 0;
+			for ( Slot = 2; Slot <= NumSlots; ++Slot ) {
+				if ( DaySlotValue( DayScheduleIndex, Slot, DST ) != DaySlotValue( DayScheduleIndex, Slot - 1, DST ) ) ChangeSlot( ++NumChanges ) = Slot;
+			}
 		}
+		DaySchedule( DayScheduleIndex ).ChangesSet = true;
 
 	}
 
+	bool
+	GetScheduleValueChanged( int const ScheduleIndex )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Tells whether the value of a schedule may differ from the one of the previous zone timestep,
+		// so calculations that depend only on it can be skipped when it did not change.
+
+		// METHODOLOGY EMPLOYED:
+		// Schedules under EMS control and schedules not yet set are always reported as changed.
+
+		if ( ScheduleIndex == -1 || ScheduleIndex == 0 ) {
+			return false;
+		} else if ( Schedule( ScheduleIndex ).EMSActuatedOn || ScheduleIndex > ScheduleValueChanged.isize() ) {
+			return true;
+		} else {
+			return ScheduleValueChanged( ScheduleIndex );
+		}
+	}
+
 	Real64
 	LookUpScheduleValue(
 		int const ScheduleIndex,
@@ -2836,6 +3166,8 @@ namespace ScheduleManager {
 				DaySchedule( ScheduleIndex ).TSValue( TS, Hr ) = Value;
 			}
 		}
+		DaySchedule( ScheduleIndex ).ChangesSet = false;
+		ScheduleValuesSet = false; // Schedules using this day schedule are set again
 	}
 
 	void
@@ -4412,7 +4744,7 @@ namespace ScheduleManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   February 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; values are set by SetScheduleValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4420,13 +4752,13 @@ namespace ScheduleManager {
 		// slot for later reporting.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// EMS values replace the scheduled values until the next SetScheduleValues.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using DataEnvironment::DayOfYear_Schedule;
+		using DataGlobals::AnyEnergyManagementSystemInModel;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4443,10 +4775,7 @@ namespace ScheduleManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ScheduleIndex;
-		int WhichHour;
 		static bool DoScheduleReportingSetup( true );
-		int WeekSchedulePointer;
-		int DaySchedulePointer;
 
 		if ( ! ScheduleInputProcessed ) {
 			ProcessScheduleInput();
@@ -4461,32 +4790,16 @@ namespace ScheduleManager {
 			DoScheduleReportingSetup = false;
 		}
 
-		WhichHour = HourOfDay + DSTIndicator;
-		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
-			// Determine which Week Schedule is used
-			//  Cant use stored day of year because of leap year inconsistency
-			WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+		// Schedule values only need setting if they changed since UpdateScheduleValues (e.g. ExternalInterface)
+		SetScheduleValues( false );
 
-			// Now, which day?
-			if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
-			} else {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
-			}
-
-			// Hourly Value
-			if ( WhichHour <= 24 ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour );
-			} else if ( TimeStep <= NumOfTimeStepInHour ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( TimeStep, WhichHour - 24 );
-			} else {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( NumOfTimeStepInHour, WhichHour - 24 );
-			}
-
-			if ( Schedule( ScheduleIndex ).EMSActuatedOn ) {
-				Schedule( ScheduleIndex ).CurrentValue = Schedule( ScheduleIndex ).EMSValue;
+		if ( AnyEnergyManagementSystemInModel ) {
+			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+				if ( Schedule( ScheduleIndex ).EMSActuatedOn ) {
+					Schedule( ScheduleIndex ).CurrentValue = Schedule( ScheduleIndex ).EMSValue;
+					EMSOverriddenSchedules.push_back( ScheduleIndex );
+				}
 			}
-
 		}
 
 	}
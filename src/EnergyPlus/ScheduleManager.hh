@@ -102,6 +102,9 @@ namespace ScheduleManager {
 		Array2D< Real64 > TSValue; // Value array by simulation timestep
 		Real64 TSValMax; // maximum of all TSValue's
 		Real64 TSValMin; // minimum of all TSValue's
+		bool ChangesSet; // ChangeSlot and DSTChangeSlot have been set
+		Array1D_int ChangeSlot; // Timesteps of the day (1 = first timestep after midnight) at which the value changes
+		Array1D_int DSTChangeSlot; // Timesteps of the day at which the value changes with daylight saving time in effect
 
 		// Default Constructor
 		DayScheduleData() :
@@ -109,7 +112,8 @@ namespace ScheduleManager {
 			IntervalInterpolated( false ),
 			Used( false ),
 			TSValMax( 0.0 ),
-			TSValMin( 0.0 )
+			TSValMin( 0.0 ),
+			ChangesSet( false )
 		{}
 
 		// Member Constructor
@@ -128,7 +132,8 @@ namespace ScheduleManager {
 			Used( Used ),
 			TSValue( TSValue ),
 			TSValMax( TSValMax ),
-			TSValMin( TSValMin )
+			TSValMin( TSValMin ),
+			ChangesSet( false )
 		{}
 
 	};
@@ -222,6 +227,7 @@ namespace ScheduleManager {
 	extern Array1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	extern Array1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	extern Array1D< ScheduleData > Schedule; // Schedule Storage
+	extern Array1D_bool ScheduleValueChanged; // True for schedules whose value changed at the last UpdateScheduleValues
 
 	// Functions
 
@@ -237,6 +243,15 @@ namespace ScheduleManager {
 	void
 	UpdateScheduleValues();
 
+	void
+	SetScheduleValues( bool const NewTimeStep ); // True at the start of a zone timestep (UpdateScheduleValues)
+
+	void
+	SetDayScheduleChanges( int const DayScheduleIndex );
+
+	bool
+	GetScheduleValueChanged( int const ScheduleIndex );
+
 	Real64
 	LookUpScheduleValue(
 		int const ScheduleIndex,
@@ -17,6 +17,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataTimings.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -249,6 +250,7 @@ namespace SetPointManager {
 	
 	bool ManagerOn( false );
 	bool GetInputFlag( true ); // First time, input is "gotten"
+	bool TimeStepSetPtsCalculated( false ); // Setpoints that only depend on schedules and weather have been calculated
 
 	// temperature-based flow control manager
 	// Average Cooling Set Pt Mgr
@@ -461,6 +463,8 @@ namespace SetPointManager {
 		static bool NoFCGroundTempObjWarning( true ); // This will cause a warning to be issued if no ground
 		// temperature object was input for FC Factor method
 
+		DataTimings::ProfileTimer const profileTimer( "GetSetPointManagerInputs" ); // Region of the timing profile
+
 		NumNodesCtrld = 0;
 		CtrldNodeNum = 0;
 		NumZones = 0;
@@ -4198,6 +4202,7 @@ namespace SetPointManager {
 		//                        Added new setpoint managers:
 		//                          SetpointManager:MultiZone:Humidity:Minimum
 		//                          SetpointManager:MultiZone:Humidity:Maximum
+		//                      Oct 2026, calculate the schedule and weather based managers once per zone time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE
@@ -4205,11 +4210,18 @@ namespace SetPointManager {
 		// Setpoint Manager algorithm.
 
 		// METHODOLOGY EMPLOYED:
+		// The Scheduled, Scheduled Dual, Outdoor Air, Follow Outdoor Air Temperature and Follow Ground
+		// Temperature managers only depend on schedule values, weather and ground temperatures, which
+		// do not change within a zone time step.  They are calculated on the first pass through the
+		// HVAC simulation of each zone time step and keep their setpoints for the later system time
+		// steps, unless EMS is in the model (it can override schedules and weather at any calling point).
 
 		// REFERENCES:
 		// na
 
 		// USE STATEMENTS:
+		using DataGlobals::BeginTimeStepFlag;
+		using DataGlobals::AnyEnergyManagementSystemInModel;
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
@@ -4226,28 +4238,48 @@ namespace SetPointManager {
 
 		// Execute all the Setpoint Managers
 
-		// The Scheduled Setpoint Managers
+		// The Setpoint Managers that only change from one zone time step to the next
+		if ( BeginTimeStepFlag || ! TimeStepSetPtsCalculated || AnyEnergyManagementSystemInModel ) {
 
-		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumSchSetPtMgrs; ++SetPtMgrNum ) {
+			// The Scheduled Setpoint Managers
 
-			CalcScheduledSetPoint( SetPtMgrNum );
+			for ( SetPtMgrNum = 1; SetPtMgrNum <= NumSchSetPtMgrs; ++SetPtMgrNum ) {
 
-		}
+				CalcScheduledSetPoint( SetPtMgrNum );
 
-		// The Scheduled Dual Setpoint Managers
+			}
 
-		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumDualSchSetPtMgrs; ++SetPtMgrNum ) {
+			// The Scheduled Dual Setpoint Managers
 
-			CalcScheduledDualSetPoint( SetPtMgrNum );
+			for ( SetPtMgrNum = 1; SetPtMgrNum <= NumDualSchSetPtMgrs; ++SetPtMgrNum ) {
 
-		}
+				CalcScheduledDualSetPoint( SetPtMgrNum );
 
-		// The Outside Air Setpoint Managers
+			}
 
-		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumOutAirSetPtMgrs; ++SetPtMgrNum ) {
+			// The Outside Air Setpoint Managers
+
+			for ( SetPtMgrNum = 1; SetPtMgrNum <= NumOutAirSetPtMgrs; ++SetPtMgrNum ) {
+
+				CalcOutsideAirSetPoint( SetPtMgrNum );
+
+			}
+
+			// The Follow Outdoor Air  Temperature Setpoint Managers
+			for ( SetPtMgrNum = 1; SetPtMgrNum <= NumFollowOATempSetPtMgrs; ++SetPtMgrNum ) {
 
-			CalcOutsideAirSetPoint( SetPtMgrNum );
+				CalcFollowOATempSetPoint( SetPtMgrNum );
 
+			}
+
+			// The Ground Temp Setpoint Managers
+			for ( SetPtMgrNum = 1; SetPtMgrNum <= NumGroundTempSetPtMgrs; ++SetPtMgrNum ) {
+
+				CalcGroundTempSetPoint( SetPtMgrNum );
+
+			}
+
+			TimeStepSetPtsCalculated = true;
 		}
 
 		// The Single Zone Reheat Setpoint Managers
@@ -4368,13 +4400,6 @@ namespace SetPointManager {
 
 		}
 
-		// The Follow Outdoor Air  Temperature Setpoint Managers
-		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumFollowOATempSetPtMgrs; ++SetPtMgrNum ) {
-
-			CalcFollowOATempSetPoint( SetPtMgrNum );
-
-		}
-
 		// The Follow System Node Temp Setpoint Managers
 		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumFollowSysNodeTempSetPtMgrs; ++SetPtMgrNum ) {
 
@@ -4382,13 +4407,6 @@ namespace SetPointManager {
 
 		}
 
-		// The Ground Temp Setpoint Managers
-		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumGroundTempSetPtMgrs; ++SetPtMgrNum ) {
-
-			CalcGroundTempSetPoint( SetPtMgrNum );
-
-		}
-
 		// The Condenser Entering Water Temperature Set Point Managers
 		for ( SetPtMgrNum = 1; SetPtMgrNum <= NumCondEntSetPtMgrs; ++SetPtMgrNum ) {
 
@@ -115,6 +115,7 @@ namespace SetPointManager {
 
 	extern bool ManagerOn;
 	extern bool GetInputFlag; // First time, input is "gotten"
+	extern bool TimeStepSetPtsCalculated; // Setpoints that only depend on schedules and weather have been calculated
 
 	// temperature-based flow control manager
 	// Average Cooling Set Pt Mgr
@@ -25,6 +25,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DesiccantDehumidifiers.hh>
 #include <EMSManager.hh>
@@ -174,6 +175,7 @@ namespace SimAirServingZones {
 		//             AUTHOR:  Russ Taylor, Dan Fisher, Fred Buhl
 		//       DATE WRITTEN:  Oct 1997
 		//           MODIFIED:  Dec 1997 Fred Buhl
+		//                      Oct 2026, timed as a region of the timing profile
 		//      RE-ENGINEERED:  This is new code, not reengineered
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -204,6 +206,7 @@ namespace SimAirServingZones {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS: none
 
 		// FLOW:
+		DataTimings::ProfileTimer const profileTimer( "ManageAirLoops" ); // Region of the timing profile
 
 		if ( GetAirLoopInputFlag ) { //First time subroutine has been entered
 			GetAirPathData(); // Get air loop descriptions from input file
@@ -440,6 +443,8 @@ namespace SimAirServingZones {
 		// Object Data
 		Array1D< AirUniqueNodes > TestUniqueNodes;
 
+		DataTimings::ProfileTimer const profileTimer( "GetAirPathData" ); // Region of the timing profile
+
 		GetObjectDefMaxArgs( "AirLoopHVAC", NumParams, MaxAlphas, MaxNumbers );
 		GetObjectDefMaxArgs( "ConnectorList", NumParams, NumAlphas, NumNumbers );
 		MaxAlphas = max( MaxAlphas, NumAlphas );
@@ -2026,6 +2031,7 @@ namespace SimAirServingZones {
 		//           MODIFIED:  Dec 1999 Fred Buhl
 		//           MODIFIED:  Feb 2006 Dimitri Curtil (LBNL)
 		//                      - Moved air loop simulation to SimAirLoop() routine.
+		//                      Oct 2026 - Skip air loops held on a shortened system time step.
 		//      RE-ENGINEERED:  This is new code, not reengineered
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2140,6 +2146,10 @@ namespace SimAirServingZones {
 				NightVentOn = true;
 			}
 
+			// On the later system time steps of a zone time step that was shortened for other air
+			// loops, this one keeps the solution (and outlet conditions) of the first system time step
+			if ( SysSubStepHold && AirLoopHeldOnSysSubStep( AirLoopNum ) ) continue;
+
 			//   Set current system number for sizing routines
 			CurSysNum = AirLoopNum;
 
@@ -2662,7 +2672,7 @@ namespace SimAirServingZones {
 		// SUBROUTINE INFORMATION
 		//             AUTHOR:  Dimitri Curtil (LBNL)
 		//       DATE WRITTEN:  Feb 2006
-		//           MODIFIED:
+		//           MODIFIED:  Oct 2026, look up each branch and component once
 		//      RE-ENGINEERED:
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2697,23 +2707,22 @@ namespace SimAirServingZones {
 		int CompNum; // Component DO loop index
 		// std::string CompType; // Component type
 		// std::string CompName; // Component name
-		int CompType_Num; // Numeric equivalent for CompType
 
-		for ( BranchNum = 1; BranchNum <= PrimaryAirSystem( AirLoopNum ).NumBranches; ++BranchNum ) { // loop over all branches in air system
+		auto & primaryAirSystem( PrimaryAirSystem( AirLoopNum ) );
+		for ( BranchNum = 1; BranchNum <= primaryAirSystem.NumBranches; ++BranchNum ) { // loop over all branches in air system
+			auto & branch( primaryAirSystem.Branch( BranchNum ) );
 
 			UpdateBranchConnections( AirLoopNum, BranchNum, BeforeBranchSim );
 
 			CurBranchNum = BranchNum;
-			CurDuctType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).DuctType;
+			CurDuctType = branch.DuctType;
 
 			// Loop over components in branch
-			for ( CompNum = 1; CompNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).TotalComponents; ++CompNum ) {
-				// CompType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).TypeOf;
-				// CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name;
-				CompType_Num = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompType_Num;
+			for ( CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+				auto & comp( branch.Comp( CompNum ) );
 
 				// Simulate each component on PrimaryAirSystem(AirLoopNum)%Branch(BranchNum)%Name
-				SimAirLoopComponent( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name, CompType_Num, FirstHVACIteration, AirLoopNum, PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompIndex );
+				SimAirLoopComponent( comp.Name, comp.CompType_Num, FirstHVACIteration, AirLoopNum, comp.CompIndex );
 			} // End of component loop
 
 			// Enforce continuity through the splitter
@@ -2740,6 +2749,7 @@ namespace SimAirServingZones {
 		//             AUTHOR:  Russ Taylor, Dan Fisher, Fred Buhl
 		//       DATE WRITTEN:  Oct 1997
 		//           MODIFIED:  Dec 1997 Fred Buhl, Richard Raustad,FSEC Sept 2003
+		//                      Oct 2026, dispatch on the component type with a switch
 		//      RE-ENGINEERED:  This is new code, not reengineered
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2789,110 +2799,134 @@ namespace SimAirServingZones {
 		CoolingActive = false;
 		HeatingActive = false;
 
-		{ auto const SELECT_CASE_var( CompType_Num );
-
-		if ( SELECT_CASE_var == OAMixer_Num ) { // 'OUTSIDE AIR SYSTEM'
+		switch ( CompType_Num ) {
+		case OAMixer_Num: // 'OUTSIDE AIR SYSTEM'
 			ManageOutsideAirSystem( CompName, FirstHVACIteration, AirLoopNum, CompIndex );
+			break;
 
 			// Fan Types for the air sys simulation
-		} else if ( SELECT_CASE_var == Fan_Simple_CV ) { // 'Fan:ConstantVolume'
+		case Fan_Simple_CV: // 'Fan:ConstantVolume'
 			SimulateFanComponents( CompName, FirstHVACIteration, CompIndex );
+			break;
 
-		} else if ( SELECT_CASE_var == Fan_Simple_VAV ) { // 'Fan:VariableVolume'
+		case Fan_Simple_VAV: // 'Fan:VariableVolume'
 			SimulateFanComponents( CompName, FirstHVACIteration, CompIndex );
+			break;
 
 			// cpw22Aug2010 Add Fan:ComponentModel (new)
-		} else if ( SELECT_CASE_var == Fan_ComponentModel ) { // 'Fan:ComponentModel'
+		case Fan_ComponentModel: // 'Fan:ComponentModel'
 			SimulateFanComponents( CompName, FirstHVACIteration, CompIndex );
+			break;
 
 			// Coil Types for the air sys simulation
 			//  Currently no control for HX Assisted coils
 			//  CASE(DXCoil_CoolingHXAsst)  ! 'CoilSystem:Cooling:DX:HeatExchangerAssisted'
 			//    CALL SimHXAssistedCoolingCoil(CompName,FirstHVACIteration,CoilOn,0.0,CompIndex,ContFanCycCoil)
-		} else if ( SELECT_CASE_var == WaterCoil_CoolingHXAsst ) { // 'CoilSystem:Cooling:Water:HeatExchangerAssisted'
+		case WaterCoil_CoolingHXAsst: // 'CoilSystem:Cooling:Water:HeatExchangerAssisted'
 			SimHXAssistedCoolingCoil( CompName, FirstHVACIteration, CoilOn, constant_zero, CompIndex, ContFanCycCoil, _, _, _, QActual );
 			if ( QActual > 0.0 ) CoolingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == WaterCoil_SimpleHeat ) { // 'Coil:Heating:Water'
+		case WaterCoil_SimpleHeat: // 'Coil:Heating:Water'
 			SimulateWaterCoilComponents( CompName, FirstHVACIteration, CompIndex, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == SteamCoil_AirHeat ) { // 'Coil:Heating:Steam'
+		case SteamCoil_AirHeat: // 'Coil:Heating:Steam'
 			SimulateSteamCoilComponents( CompName, FirstHVACIteration, CompIndex, constant_zero, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == WaterCoil_DetailedCool ) { // 'Coil:Cooling:Water:DetailedGeometry'
+		case WaterCoil_DetailedCool: // 'Coil:Cooling:Water:DetailedGeometry'
 			SimulateWaterCoilComponents( CompName, FirstHVACIteration, CompIndex, QActual );
 			if ( QActual > 0.0 ) CoolingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == WaterCoil_Cooling ) { // 'Coil:Cooling:Water'
+		case WaterCoil_Cooling: // 'Coil:Cooling:Water'
 			SimulateWaterCoilComponents( CompName, FirstHVACIteration, CompIndex, QActual );
 			if ( QActual > 0.0 ) CoolingActive = true; // determine if coil is ON
+			break;
 
 			// stand-alone coils are temperature controlled (do not pass QCoilReq in argument list, QCoilReq overrides temp SP)
-		} else if ( SELECT_CASE_var == Coil_ElectricHeat ) { // 'Coil:Heating:Electric'
+		case Coil_ElectricHeat: // 'Coil:Heating:Electric'
 			SimulateHeatingCoilComponents( CompName, FirstHVACIteration, _, CompIndex, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
 
 			// stand-alone coils are temperature controlled (do not pass QCoilReq in argument list, QCoilReq overrides temp SP)
-		} else if ( SELECT_CASE_var == Coil_GasHeat ) { // 'Coil:Heating:Gas'
+		case Coil_GasHeat: // 'Coil:Heating:Gas'
 			SimulateHeatingCoilComponents( CompName, FirstHVACIteration, _, CompIndex, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
+
 			// stand-alone coils are temperature controlled (do not pass QCoilReq in argument list, QCoilReq overrides temp SP)
-		} else if ( SELECT_CASE_var == Coil_DeSuperHeat ) { // 'Coil:Heating:Desuperheater' - heat reclaim
+		case Coil_DeSuperHeat: // 'Coil:Heating:Desuperheater' - heat reclaim
 			SimulateHeatingCoilComponents( CompName, FirstHVACIteration, _, CompIndex, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == DXSystem ) { // CoilSystem:Cooling:DX  old 'AirLoopHVAC:UnitaryCoolOnly'
+		case DXSystem: // CoilSystem:Cooling:DX  old 'AirLoopHVAC:UnitaryCoolOnly'
 			SimDXCoolingSystem( CompName, FirstHVACIteration, AirLoopNum, CompIndex, _, _, QActual );
 			if ( QActual > 0.0 ) CoolingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == DXHeatPumpSystem ) { // 'CoilSystem:Heating:DX'
+		case DXHeatPumpSystem: // 'CoilSystem:Heating:DX'
 			SimDXHeatPumpSystem( CompName, FirstHVACIteration, AirLoopNum, CompIndex, _, _, QActual );
 			if ( QActual > 0.0 ) HeatingActive = true; // determine if coil is ON
+			break;
 
-		} else if ( SELECT_CASE_var == CoilUserDefined ) { // Coil:UserDefined
+		case CoilUserDefined: // Coil:UserDefined
 			SimCoilUserDefined( CompName, CompIndex, AirLoopNum, HeatingActive, CoolingActive );
+			break;
 
-		} else if ( SELECT_CASE_var == UnitarySystem ) { // 'AirLoopHVAC:UnitarySystem'
+		case UnitarySystem: // 'AirLoopHVAC:UnitarySystem'
 			SimUnitarySystem( CompName, FirstHVACIteration, AirLoopNum, CompIndex, HeatingActive, CoolingActive );
+			break;
 
-		} else if ( SELECT_CASE_var == Furnace_UnitarySys ) { // 'AirLoopHVAC:Unitary:Furnace:HeatOnly', 'AirLoopHVAC:Unitary:Furnace:HeatCool',
+		case Furnace_UnitarySys: // 'AirLoopHVAC:Unitary:Furnace:HeatOnly', 'AirLoopHVAC:Unitary:Furnace:HeatCool',
 			// 'AirLoopHVAC:UnitaryHeatOnly', 'AirLoopHVAC:UnitaryHeatCool'
 			// 'AirLoopHVAC:UnitaryHeatPump:AirToAir', 'AirLoopHVAC:UnitaryHeatPump:WaterToAir'
 			SimFurnace( CompName, FirstHVACIteration, AirLoopNum, CompIndex );
+			break;
 
-		} else if ( SELECT_CASE_var == UnitarySystem_BypassVAVSys ) { // 'AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass'
+		case UnitarySystem_BypassVAVSys: // 'AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass'
 			SimUnitaryBypassVAV( CompName, FirstHVACIteration, AirLoopNum, CompIndex );
+			break;
 
-		} else if ( SELECT_CASE_var == UnitarySystem_MSHeatPump ) { // 'AirLoopHVAC:UnitaryHeatPump:AirToAir:Multispeed'
+		case UnitarySystem_MSHeatPump: // 'AirLoopHVAC:UnitaryHeatPump:AirToAir:Multispeed'
 			SimMSHeatPump( CompName, FirstHVACIteration, AirLoopNum, CompIndex );
+			break;
 
 			// Humidifier Types for the air system simulation
-		} else if ( SELECT_CASE_var == Humidifier ) { // 'Humidifier:Steam:Electric' and 'Humidifier:Steam:Gas'
+		case Humidifier: // 'Humidifier:Steam:Electric' and 'Humidifier:Steam:Gas'
 			SimHumidifier( CompName, FirstHVACIteration, CompIndex );
+			break;
 
 			// Evap Cooler Types for the air system simulation
-		} else if ( SELECT_CASE_var == EvapCooler ) { // 'EvaporativeCooler:Direct:CelDekPad', 'EvaporativeCooler:Indirect:CelDekPad'
+		case EvapCooler: // 'EvaporativeCooler:Direct:CelDekPad', 'EvaporativeCooler:Indirect:CelDekPad'
 			// 'EvaporativeCooler:Indirect:WetCoil', 'EvaporativeCooler:Indirect:ResearchSpecial'
 			SimEvapCooler( CompName, CompIndex );
+			break;
 
 			// Desiccant Dehumidifier Types for the air system simulation
-		} else if ( SELECT_CASE_var == Desiccant ) { // 'Dehumidifier:Desiccant:NoFans', 'Dehumidifier:Desiccant:System'
+		case Desiccant: // 'Dehumidifier:Desiccant:NoFans', 'Dehumidifier:Desiccant:System'
 			SimDesiccantDehumidifier( CompName, FirstHVACIteration, CompIndex );
+			break;
 
 			// Heat recovery
-		} else if ( SELECT_CASE_var == HeatXchngr ) { // 'HeatExchanger:AirToAir:FlatPlate', 'HeatExchanger:AirToAir:SensibleAndLatent'
+		case HeatXchngr: // 'HeatExchanger:AirToAir:FlatPlate', 'HeatExchanger:AirToAir:SensibleAndLatent'
 			// 'HeatExchanger:Desiccant:BalancedFlow'
 			SimHeatRecovery( CompName, FirstHVACIteration, CompIndex, ContFanCycCoil, _, _, _, _, AirLoopControlInfo( AirLoopNum ).EconoActive, AirLoopControlInfo( AirLoopNum ).HighHumCtrlActive );
+			break;
 
 			// Ducts
-		} else if ( SELECT_CASE_var == Duct ) { // 'Duct'
+		case Duct: // 'Duct'
 			SimDuct( CompName, FirstHVACIteration, CompIndex );
+			break;
 
-		} else {
-
-		}}
+		default:
+			break;
+		}
 
 		// Set AirLoopControlInfo flag to identify coil operation for "Air Loop Coils"
 		// Any coil operation from multiple coils causes flag to be TRUE
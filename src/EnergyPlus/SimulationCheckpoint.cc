@@ -0,0 +1,451 @@
+// C++ Headers
+#include <cstring>
+
+// EnergyPlus Headers
+#include <SimulationCheckpoint.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
+#include <DataStringGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DisplayRoutines.hh>
+#include <General.hh>
+#include <GroundHeatExchangers.hh>
+#include <UtilityRoutines.hh>
+#include <WaterThermalTanks.hh>
+#include <WeatherManager.hh>
+#include <ZoneTempPredictorCorrector.hh>
+
+namespace EnergyPlus {
+
+namespace SimulationCheckpoint {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Saves the state of a simulation at the end of a day of a weather file run period
+	// (--checkpoint-at) and restarts a later run from it (--resume-from).  A resumed run skips
+	// the days before the checkpoint and needs only one warmup day, which is spent on the
+	// initializations done at the beginning of an environment; the checkpointed state then
+	// replaces the warmed up one.  Repeated runs from a common state (what-if variations of
+	// operation, model predictive control) and time segments of a run period started from the
+	// state of the previous segment are the intended uses.
+
+	// METHODOLOGY EMPLOYED:
+	// The state carried from one time step to the next is the zone air temperature and humidity
+	// histories, the surface temperatures and conduction transfer function histories, the node
+	// states, the interface temperatures of the plant loops, the water heater tank temperatures
+	// and the load histories of the ground heat exchangers.  Values computed afresh each time
+	// step (schedules, weather, internal gains) are not saved, nor are the output accumulators:
+	// the outputs of a resumed run cover the days after the checkpoint only.
+
+	// Using/Aliasing
+	using namespace DataGlobals;
+	using DataEnvironment::CurEnvirNum;
+	using DataEnvironment::CurMnDy;
+	using DataEnvironment::EnvironmentName;
+	using DataEnvironment::TotDesDays;
+	using General::TrimSigDigits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	char const CheckpointMagic[ 8 ] = { 'E', 'P', 'C', 'K', 'P', 'T', '0', '1' }; // Tag at the start of checkpoint files
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool RestorePending( false ); // A checkpoint given with --resume-from has not been restored yet
+	int ResumeRunPeriod( 0 ); // Weather file run period (RunPeriodInput) the checkpoint was written in
+	int ResumeDayOfSim( 0 ); // Days of the run period simulated before the checkpoint was written
+	bool CheckpointWritten( false ); // The checkpoint asked for with --checkpoint-at has been written
+
+	// CheckpointArchive:
+
+	CheckpointArchive::CheckpointArchive(
+		std::string const & fileName, // Checkpoint file
+		bool const writing // Write the state (else read it)
+	) :
+		writing_( writing ),
+		fileName_( fileName ),
+		section_( "File header" )
+	{
+		char magic[ sizeof( CheckpointMagic ) ];
+
+		if ( writing_ ) {
+			file_.open( fileName_, std::ios::out | std::ios::binary | std::ios::trunc );
+			if ( ! file_ ) ShowFatalError( "Could not open checkpoint file=\"" + fileName_ + "\" for writing." );
+			std::memcpy( magic, CheckpointMagic, sizeof( magic ) );
+		} else {
+			file_.open( fileName_, std::ios::in | std::ios::binary );
+			if ( ! file_ ) ShowFatalError( "Could not open checkpoint file=\"" + fileName_ + "\" given with --resume-from." );
+		}
+		transfer( magic, sizeof( magic ) );
+		if ( std::memcmp( magic, CheckpointMagic, sizeof( magic ) ) != 0 ) {
+			ShowFatalError( "File=\"" + fileName_ + "\" given with --resume-from is not an EnergyPlus checkpoint file." );
+		}
+	}
+
+	void
+	CheckpointArchive::section(
+		std::string const & name,
+		int const count
+	)
+	{
+		std::string fileName( name );
+		std::int32_t fileCount( count );
+
+		section_ = name;
+		value( fileName );
+		transfer( &fileCount, sizeof( fileCount ) );
+		if ( fileName != name || fileCount != count ) mismatch();
+	}
+
+	void
+	CheckpointArchive::value( Real64 & x )
+	{
+		transfer( &x, sizeof( x ) );
+	}
+
+	void
+	CheckpointArchive::value( int & x )
+	{
+		std::int32_t fileValue( x );
+		transfer( &fileValue, sizeof( fileValue ) );
+		x = fileValue;
+	}
+
+	void
+	CheckpointArchive::value( bool & x )
+	{
+		char fileValue( x ? 1 : 0 );
+		transfer( &fileValue, sizeof( fileValue ) );
+		x = ( fileValue != 0 );
+	}
+
+	void
+	CheckpointArchive::value( std::string & s )
+	{
+		std::int32_t length( s.length() );
+		transfer( &length, sizeof( length ) );
+		if ( ! writing_ ) {
+			if ( length < 0 || length > 100000 ) mismatch();
+			s.resize( length );
+		}
+		if ( length > 0 ) transfer( &s[ 0 ], length );
+	}
+
+	void
+	CheckpointArchive::close()
+	{
+		file_.close();
+		if ( writing_ && file_.fail() ) ShowFatalError( "Could not write checkpoint file=\"" + fileName_ + "\"." );
+	}
+
+	void
+	CheckpointArchive::transfer(
+		void * data,
+		std::size_t const size
+	)
+	{
+		if ( writing_ ) {
+			file_.write( static_cast< char const * >( data ), size );
+		} else if ( ! file_.read( static_cast< char * >( data ), size ) ) {
+			mismatch();
+		}
+	}
+
+	void
+	CheckpointArchive::mismatch()
+	{
+		ShowSevereError( "Checkpoint file=\"" + fileName_ + "\" does not match this simulation." );
+		ShowContinueError( "The file ends early or differs at \"" + section_ + "\"; a checkpoint can only be resumed with the input and the program version that wrote it." );
+		ShowFatalError( "Program terminates due to preceding condition." );
+	}
+
+	// Functions
+
+	void
+	CheckpointState( CheckpointArchive & ar )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the simulation state to, or reads it from, a checkpoint archive.  New state is
+		// added here (or in a CheckpointState routine of its module, as for the ground heat
+		// exchangers) in the same order for both directions.
+
+		// Using/Aliasing
+		using namespace DataHeatBalFanSys;
+		using namespace DataHeatBalSurface;
+		using DataLoopNode::Node;
+		using DataLoopNode::NumOfNodes;
+		using DataPlant::PlantLoop;
+		using DataPlant::TotNumLoops;
+		using WaterThermalTanks::NumWaterThermalTank;
+		using WaterThermalTanks::WaterThermalTank;
+		using ZoneTempPredictorCorrector::ZoneAirRelHum;
+
+		// Zone air temperature and humidity ratio histories (see PushZoneTimestepHistories)
+		ar.section( "Zone air histories", NumOfZones );
+		ar.values( ZT );
+		ar.values( ZTAV );
+		ar.values( MAT );
+		ar.values( XMAT );
+		ar.values( XM2T );
+		ar.values( XM3T );
+		ar.values( XM4T );
+		ar.values( XMPT );
+		ar.values( DSXMAT );
+		ar.values( DSXM2T );
+		ar.values( DSXM3T );
+		ar.values( DSXM4T );
+		ar.values( ZTM1 );
+		ar.values( ZTM2 );
+		ar.values( ZTM3 );
+		ar.values( ZoneTMX );
+		ar.values( ZoneTM2 );
+		ar.values( ZoneT1 );
+		ar.values( ZoneAirHumRat );
+		ar.values( ZoneAirHumRatAvg );
+		ar.values( ZoneAirHumRatTemp );
+		ar.values( WZoneTimeMinus1 );
+		ar.values( WZoneTimeMinus2 );
+		ar.values( WZoneTimeMinus3 );
+		ar.values( WZoneTimeMinus4 );
+		ar.values( WZoneTimeMinusP );
+		ar.values( DSWZoneTimeMinus1 );
+		ar.values( ZoneWMX );
+		ar.values( ZoneWM2 );
+		ar.values( ZoneW1 );
+		ar.values( ZoneAirRelHum );
+
+		// Surface temperatures and conduction transfer function histories
+		ar.section( "Surface histories", DataSurfaces::TotSurfaces );
+		ar.values( TempSurfIn );
+		ar.values( TempSurfInTmp );
+		ar.values( TempSurfOut );
+		ar.values( TempSource );
+		ar.values( TH );
+		ar.values( QH );
+		ar.values( THM );
+		ar.values( QHM );
+		ar.values( TsrcHist );
+		ar.values( QsrcHist );
+		ar.values( TsrcHistM );
+		ar.values( QsrcHistM );
+		ar.values( SUMH );
+
+		// Node states; the outdoor air conditions of nodes are set from the weather each time step
+		ar.section( "Nodes", NumOfNodes );
+		for ( auto & node : Node ) {
+			ar.value( node.Temp );
+			ar.value( node.MassFlowRate );
+			ar.value( node.HumRat );
+			ar.value( node.Enthalpy );
+			ar.value( node.Press );
+			ar.value( node.Quality );
+			ar.value( node.MassFlowRateMinAvail );
+			ar.value( node.MassFlowRateMaxAvail );
+			ar.value( node.MassFlowRateRequest );
+			ar.value( node.MassFlowRateMin );
+			ar.value( node.MassFlowRateMax );
+			ar.value( node.MassFlowRateSetPoint );
+			ar.value( node.TempSetPoint );
+			ar.value( node.HumRatSetPoint );
+			ar.value( node.TempMin );
+			ar.value( node.TempMax );
+			ar.value( node.HumRatMin );
+			ar.value( node.HumRatMax );
+			ar.value( node.TempSetPointHi );
+			ar.value( node.TempSetPointLo );
+			ar.value( node.TempLastTimestep );
+			ar.value( node.EnthalpyLastTimestep );
+			ar.value( node.CO2 );
+			ar.value( node.CO2SetPoint );
+			ar.value( node.GenContam );
+			ar.value( node.GenContamSetPoint );
+		}
+
+		// Interface (common pipe and half loop) temperatures of the plant and condenser loops
+		ar.section( "Plant loops", TotNumLoops );
+		for ( auto & loop : PlantLoop ) {
+			for ( auto & loopSide : loop.LoopSide ) {
+				ar.value( loopSide.TempInterfaceTankOutlet );
+				ar.value( loopSide.LastTempInterfaceTankOutlet );
+			}
+		}
+
+		// Water heater and chilled water storage tanks
+		ar.section( "Water thermal tanks", NumWaterThermalTank );
+		for ( auto & tank : WaterThermalTank ) {
+			ar.value( tank.TankTemp );
+			ar.value( tank.SavedTankTemp );
+			ar.value( tank.TankTempAvg );
+			ar.value( tank.UseOutletTemp );
+			ar.value( tank.SavedUseOutletTemp );
+			ar.value( tank.SourceOutletTemp );
+			ar.value( tank.SavedSourceOutletTemp );
+			ar.value( tank.Mode );
+			ar.value( tank.SavedMode );
+			ar.value( tank.HeaterOn1 );
+			ar.value( tank.SavedHeaterOn1 );
+			ar.value( tank.HeaterOn2 );
+			ar.value( tank.SavedHeaterOn2 );
+			ar.section( "Water thermal tank nodes", tank.Node.isize() );
+			for ( auto & tankNode : tank.Node ) {
+				ar.value( tankNode.Temp );
+				ar.value( tankNode.SavedTemp );
+			}
+		}
+
+		GroundHeatExchangers::CheckpointState( ar );
+
+	}
+
+	void
+	WriteCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the state at the end of the current day of a weather file run period to the
+		// checkpoint file.  The header records the program version, the run period and the
+		// days of it simulated, which the resumed run needs before it reads the rest.
+
+		// Using/Aliasing
+		using DataStringGlobals::outputCheckpointFileName;
+		using DataStringGlobals::VerString;
+		using WeatherManager::TotRunDesPers;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Version( VerString );
+		int RunPeriodNum( CurEnvirNum - TotDesDays - TotRunDesPers );
+		int DaysDone( DayOfSim );
+
+		CheckpointArchive ar( outputCheckpointFileName, true );
+		ar.value( Version );
+		ar.value( RunPeriodNum );
+		ar.value( DaysDone );
+		CheckpointState( ar );
+		ar.close();
+		CheckpointWritten = true;
+
+		ShowMessage( "Checkpoint written at the end of " + CurMnDy + " (day " + TrimSigDigits( DayOfSim ) + " of " + EnvironmentName + ") to " + outputCheckpointFileName );
+
+	}
+
+	void
+	ReadCheckpointHeader()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the run period and the days simulated from the checkpoint given with --resume-from,
+		// so the weather manager can start the run period on the day after the checkpoint.
+
+		// Using/Aliasing
+		using DataStringGlobals::inputCheckpointFileName;
+		using DataStringGlobals::VerString;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Version;
+
+		CheckpointArchive ar( inputCheckpointFileName, false );
+		ar.value( Version );
+		if ( Version != VerString ) {
+			ShowFatalError( "Checkpoint file=\"" + inputCheckpointFileName + "\" was written by " + Version + " and cannot be resumed by " + VerString + '.' );
+		}
+		ar.value( ResumeRunPeriod );
+		ar.value( ResumeDayOfSim );
+		RestorePending = true;
+
+	}
+
+	bool
+	ResumingEnvironment()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true while simulating the run period of the checkpoint given with --resume-from
+		// before the checkpoint has been restored, i.e. during its warmup.
+
+		// Using/Aliasing
+		using WeatherManager::TotRunDesPers;
+
+		return RestorePending && KindOfSim == ksRunPeriodWeather && CurEnvirNum - TotDesDays - TotRunDesPers == ResumeRunPeriod;
+
+	}
+
+	void
+	RestoreCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the warmed up state with the state of the checkpoint at the start of the first
+		// day after warmup.
+
+		// METHODOLOGY EMPLOYED:
+		// The day count of the run period carries on from the checkpoint, so the run period ends
+		// on the same day as an uninterrupted run and the time based histories (of the ground heat
+		// exchangers) line up with the restored values.
+
+		// Using/Aliasing
+		using DataStringGlobals::inputCheckpointFileName;
+		using WeatherManager::curSimDayForEndOfRunPeriod;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string Version;
+		int RunPeriodNum;
+		int DaysDone;
+
+		CheckpointArchive ar( inputCheckpointFileName, false );
+		ar.value( Version );
+		ar.value( RunPeriodNum );
+		ar.value( DaysDone );
+		CheckpointState( ar );
+		ar.close();
+
+		DayOfSim = ResumeDayOfSim;
+		NumOfDayInEnvrn += ResumeDayOfSim;
+		curSimDayForEndOfRunPeriod += ResumeDayOfSim;
+		RestorePending = false;
+
+		DisplayString( "Resuming Simulation at " + CurMnDy + " for " + EnvironmentName + " from checkpoint " + inputCheckpointFileName );
+
+	}
+
+} // SimulationCheckpoint
+
+} // EnergyPlus
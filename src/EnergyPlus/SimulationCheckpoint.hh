@@ -0,0 +1,137 @@
+#ifndef SimulationCheckpoint_hh_INCLUDED
+#define SimulationCheckpoint_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace SimulationCheckpoint {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern char const CheckpointMagic[ 8 ]; // Tag at the start of checkpoint files
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool RestorePending; // A checkpoint given with --resume-from has not been restored yet
+	extern int ResumeRunPeriod; // Weather file run period (RunPeriodInput) the checkpoint was written in
+	extern int ResumeDayOfSim; // Days of the run period simulated before the checkpoint was written
+	extern bool CheckpointWritten; // The checkpoint asked for with --checkpoint-at has been written
+
+	// Types
+
+	// Binary file holding the state of a simulation at the end of a day of a run period
+	//
+	// The state is described once, by CheckpointState, for both directions: an archive opened for
+	// writing stores every value it is given and one opened for reading overwrites it with the
+	// stored value.  Each group of values starts with a section (a name and a count) that is
+	// checked when reading, so a checkpoint can only be restored by the input, and the version
+	// of the program, that wrote it.  Values are stored in the byte order of the machine.
+	class CheckpointArchive
+	{
+
+	public: // Creation
+
+		CheckpointArchive(
+			std::string const & fileName, // Checkpoint file
+			bool const writing // Write the state (else read it)
+		);
+
+		CheckpointArchive( CheckpointArchive const & ) = delete;
+
+		CheckpointArchive &
+		operator =( CheckpointArchive const & ) = delete;
+
+	public: // Properties
+
+		// Writing the state?
+		bool
+		writing() const
+		{
+			return writing_;
+		}
+
+	public: // Methods
+
+		// Start a group of count values
+		void
+		section(
+			std::string const & name,
+			int const count
+		);
+
+		void
+		value( Real64 & x );
+
+		void
+		value( int & x );
+
+		void
+		value( bool & x );
+
+		void
+		value( std::string & s );
+
+		// Values of an array, which must have the same size when reading
+		template< typename A >
+		void
+		values( A & a )
+		{
+			std::int32_t size( a.size() );
+			transfer( &size, sizeof( size ) );
+			if ( ! writing_ && size != std::int32_t( a.size() ) ) mismatch();
+			if ( size > 0 ) transfer( a.data(), a.size() * sizeof( typename A::value_type ) );
+		}
+
+		// Close the file, reporting a failure to write it
+		void
+		close();
+
+	private: // Methods
+
+		void
+		transfer(
+			void * data,
+			std::size_t const size
+		);
+
+		void
+		mismatch();
+
+	private: // Data
+
+		bool writing_; // Writing the state (else reading it)
+		std::string fileName_; // Checkpoint file
+		std::string section_; // Name of the current section, for messages
+		std::fstream file_;
+
+	}; // CheckpointArchive
+
+	// Functions
+
+	void
+	CheckpointState( CheckpointArchive & ar );
+
+	void
+	WriteCheckpoint();
+
+	void
+	ReadCheckpointHeader();
+
+	bool
+	ResumingEnvironment();
+
+	void
+	RestoreCheckpoint();
+
+} // SimulationCheckpoint
+
+} // EnergyPlus
+
+#endif
@@ -18,8 +18,10 @@ extern "C" {
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <SimulationManager.hh>
+#include <AsyncOutput.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <CompressedOutput.hh>
 #include <CostEstimateManager.hh>
 #include <CurveManager.hh>
 #include <DataAirLoop.hh>
@@ -66,6 +68,7 @@ extern "C" {
 #include <HVACSizingSimulationManager.hh>
 #include <InputProcessor.hh>
 #include <ManageElectricPower.hh>
+#include <MemoryAccounting.hh>
 #include <MixedAir.hh>
 #include <NodeInputManager.hh>
 #include <OutAirNodeManager.hh>
@@ -77,8 +80,10 @@ extern "C" {
 #include <PollutionModule.hh>
 #include <PlantPipingSystemsManager.hh>
 #include <Psychrometrics.hh>
+#include <RecordOutput.hh>
 #include <RefrigeratedCase.hh>
 #include <SetPointManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
@@ -90,6 +95,10 @@ extern "C" {
 #include <ZoneEquipmentManager.hh>
 #include <Timer.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace EnergyPlus {
 
 // HBIRE_USE_OMP defined, then openMP instructions are used.  Compiler may have to have switch for openmp
@@ -164,7 +173,9 @@ namespace SimulationManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   January 1997
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, write the timing profile at closeout
+		//                      Oct 2026, simulate a single selected run period (--run-period)
+		//                      Oct 2026, write and resume from simulation checkpoints
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -251,6 +262,7 @@ namespace SimulationManager {
 		static bool TerminalError( false );
 		bool SimsDone;
 		bool ErrFound;
+		int RunPeriodCount; // Weather file run periods reached in the environment loop
 		//  REAL(r64) :: t0,t1,st0,st1
 
 		//  CHARACTER(len=70) :: tdstring
@@ -314,7 +326,7 @@ namespace SimulationManager {
 		}
 		DoingSizing = false;
 
-		if ( ( DoZoneSizing || DoSystemSizing || DoPlantSizing ) && ! ( DoDesDaySim || ( DoWeathSim && RunPeriodsInInput ) ) ) {
+		if ( ( DoZoneSizing || DoSystemSizing || DoPlantSizing ) && ! ( DoDesDaySim || ( DoWeathSim && RunPeriodsInInput ) ) && ! CheckInputOnly ) {
 			ShowWarningError( "ManageSimulation: Input file has requested Sizing Calculations but no Simulations are requested (in SimulationControl object). Succeeding warnings/errors may be confusing." );
 		}
 		Available = true;
@@ -337,7 +349,7 @@ namespace SimulationManager {
 
 		//  Note:  All the inputs have been 'gotten' by the time we get here.
 		ErrFound = false;
-		if ( DoOutputReporting ) {
+		if ( DoOutputReporting || CheckInputOnly ) {
 			DisplayString( "Reporting Surfaces" );
 
 			ReportSurfaces();
@@ -392,17 +404,27 @@ namespace SimulationManager {
 
 		GetInputForLifeCycleCost(); //must be prior to WriteTabularReports -- do here before big simulation stuff.
 
+		// With --check-input all the input has been read and cross-checked by now; the simulation is skipped.
+		if ( CheckInputOnly ) {
+			ShowMessage( "Input check complete (--check-input); simulation skipped" );
+			DisplayString( "Input check complete" );
+			Available = false;
+		}
+
 		// if user requested HVAC Sizing Simulation, call HVAC sizing simulation manager
 		if ( DoHVACSizingSimulation ) {
 			ManageHVACSizingSimulation( ErrorsFound );
 		}
 
-		ShowMessage( "Beginning Simulation" );
-		DisplayString( "Beginning Primary Simulation" );
+		if ( ! CheckInputOnly ) {
+			ShowMessage( "Beginning Simulation" );
+			DisplayString( "Beginning Primary Simulation" );
+		}
 
 		ResetEnvironmentCounter();
 
 		EnvCount = 0;
+		RunPeriodCount = 0;
 		WarmupFlag = true;
 
 		while ( Available ) {
@@ -417,6 +439,13 @@ namespace SimulationManager {
 
 			if (KindOfSim == ksHVACSizeRunPeriodDesign) continue; // don't run these here, only for sizing simulations
 
+			// With --run-period only the selected weather file run period is simulated, so that
+			// the run periods of one input can be simulated by separate processes in parallel
+			if ( SelectedRunPeriod > 0 ) {
+				if ( KindOfSim != ksRunPeriodWeather ) continue;
+				if ( ++RunPeriodCount != SelectedRunPeriod ) continue;
+			}
+
 			++EnvCount;
 
 			if ( sqlite ) {
@@ -443,6 +472,10 @@ namespace SimulationManager {
 
 				if ( sqlite ) sqlite->sqliteBegin(); // setup for one transaction per day
 
+				if ( ! WarmupFlag && DayOfSim == 0 && SimulationCheckpoint::ResumingEnvironment() ) {
+					SimulationCheckpoint::RestoreCheckpoint(); // Continues DayOfSim from the checkpoint
+				}
+
 				++DayOfSim;
 				gio::write( DayOfSimChr, fmtLD ) << DayOfSim;
 				strip( DayOfSimChr );
@@ -522,6 +555,10 @@ namespace SimulationManager {
 
 				} // ... End hour loop.
 
+				if ( CheckpointDay > 0 && DayOfSim == CheckpointDay && ! WarmupFlag && KindOfSim == ksRunPeriodWeather && ! SimulationCheckpoint::CheckpointWritten ) {
+					SimulationCheckpoint::WriteCheckpoint();
+				}
+
 				if ( sqlite ) sqlite->sqliteCommit(); // one transaction per day
 
 			} // ... End day loop.
@@ -544,6 +581,12 @@ namespace SimulationManager {
 			}
 		}
 
+		if ( SelectedRunPeriod > 0 && RunPeriodCount < SelectedRunPeriod ) {
+			ShowSevereError( "ManageSimulation: Run period " + TrimSigDigits( SelectedRunPeriod ) + " was selected with --run-period, but only " + TrimSigDigits( RunPeriodCount ) + " weather file run periods were simulated." );
+			ShowContinueError( "...Check that weather file simulation is requested in SimulationControl and that a weather file is given." );
+			ShowFatalError( "Program terminates because the selected run period was not found." );
+		}
+
 		if ( sqlite ) sqlite->sqliteBegin(); // for final data to write
 
 #ifdef EP_Detailed_Timings
@@ -570,6 +613,9 @@ namespace SimulationManager {
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
+		epProfileReport(); // Timing profile to the eio file and the Timings table
+		MemoryAccounting::ReportMemoryUsage(); // Storage of the large arrays to the eio file
+
 		CloseOutputFiles();
 
 		// sqlite->createZoneExtendedOutput();
@@ -661,6 +707,8 @@ namespace SimulationManager {
 		static gio::Fmt Format_741_1( "(', ',A,$)" );
 		static gio::Fmt Format_751( "(' Output Reporting Tolerances',5(', ',A))" );
 
+		DataTimings::ProfileTimer const profileTimer( "GetProjectData" ); // Region of the timing profile
+
 		ErrorsFound = false;
 
 		CurrentModuleObject = "Version";
@@ -820,6 +868,14 @@ namespace SimulationManager {
 			if ( MinPlantSubIterations < 1 ) MinPlantSubIterations = 1;
 			if ( MaxPlantSubIterations < 3 ) MaxPlantSubIterations = 3;
 			if ( MinPlantSubIterations > MaxPlantSubIterations ) MaxPlantSubIterations = MinPlantSubIterations + 1;
+			if ( lAlphaFieldBlanks( 1 ) || Alphas( 1 ) == "BUILDING" ) {
+				AirLoopSysTimeStepShortening = false;
+			} else if ( Alphas( 1 ) == "AIRLOOP" ) {
+				AirLoopSysTimeStepShortening = true;
+			} else {
+				ShowSevereError( CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
+				ErrorsFound = true;
+			}
 
 		} else if ( Num == 0 ) {
 			MinTimeStepSys = 1.0 / 60.0;
@@ -952,6 +1008,11 @@ namespace SimulationManager {
 			DoDesDaySim = false;
 			DoWeathSim = true;
 		}
+		if ( CheckInputOnly ) { // --check-input: sizing is still done as requested, since components need their sizes
+			DoDesDaySim = false;
+			DoWeathSim = false;
+			DoHVACSizingSimulation = false;
+		}
 
 		if ( ErrorsFound ) {
 			ShowFatalError( "Errors found getting Project Input" );
@@ -1247,12 +1308,17 @@ namespace SimulationManager {
 		// FLOW:
 		OutputFileStandard = GetNewUnitNumber();
 		StdOutputRecordCount = 0;
-		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileStandard, DataStringGlobals::outputEsoFileName, flags ); write_stat = flags.ios(); }
+		std::string const EsoFileName( DataStringGlobals::outputEsoFileName + ( CompressOutput ? ".gz" : "" ) );
+		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileStandard, EsoFileName, flags ); write_stat = flags.ios(); }
 		if ( write_stat != 0 ) {
-			ShowFatalError( "OpenOutputFiles: Could not open file "+DataStringGlobals::outputEsoFileName+" for output (write)." );
+			ShowFatalError( "OpenOutputFiles: Could not open file "+EsoFileName+" for output (write)." );
 		}
 		eso_stream = gio::out_stream( OutputFileStandard );
+		if ( CompressOutput ) CompressedOutput::StartCompressedOutput( eso_stream );
+		if ( WriteOutputAsync ) AsyncOutput::StartAsyncOutput( eso_stream );
 		gio::write( OutputFileStandard, fmtA ) << "Program Version," + VerString;
+		OutputProcessor::OpenBinaryOutput();
+		OutputProcessor::OpenCsvOutput();
 
 		// Open the Initialization Output File
 		OutputFileInits = GetNewUnitNumber();
@@ -1261,15 +1327,19 @@ namespace SimulationManager {
 			ShowFatalError( "OpenOutputFiles: Could not open file "+DataStringGlobals::outputEioFileName+" for output (write)." );
 		}
 		gio::write( OutputFileInits, fmtA ) << "Program Version," + VerString;
+		RecordOutput::OpenRecordOutput();
 
 		// Open the Meters Output File
 		OutputFileMeters = GetNewUnitNumber();
 		StdMeterRecordCount = 0;
-		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileMeters, DataStringGlobals::outputMtrFileName, flags ); write_stat = flags.ios(); }
+		std::string const MtrFileName( DataStringGlobals::outputMtrFileName + ( CompressOutput ? ".gz" : "" ) );
+		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileMeters, MtrFileName, flags ); write_stat = flags.ios(); }
 		if ( write_stat != 0 ) {
-			ShowFatalError( "OpenOutputFiles: Could not open file "+DataStringGlobals::outputMtrFileName+" for output (write)." );
+			ShowFatalError( "OpenOutputFiles: Could not open file "+MtrFileName+" for output (write)." );
 		}
 		mtr_stream = gio::out_stream( OutputFileMeters );
+		if ( CompressOutput ) CompressedOutput::StartCompressedOutput( mtr_stream );
+		if ( WriteOutputAsync ) AsyncOutput::StartAsyncOutput( mtr_stream );
 		gio::write( OutputFileMeters, fmtA ) << "Program Version," + VerString;
 
 		// Open the Branch-Node Details Output File
@@ -1342,7 +1412,7 @@ namespace SimulationManager {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		static gio::Fmt EndOfDataFormat( "(\"End of Data\")" ); // Signifies the end of the data block in the output file
-		static std::string const ThreadingHeader( "! <Program Control Information:Threads/Parallel Sims>, Threading Supported,Maximum Number of Threads, Env Set Threads (OMP_NUM_THREADS), EP Env Set Threads (EP_OMP_NUM_THREADS), IDF Set Threads, Number of Threads Used (Interior Radiant Exchange), Number Nominal Surfaces, Number Parallel Sims" );
+		static std::string const ThreadingHeader( "! <Program Control Information:Threads/Parallel Sims>, Threading Supported,Maximum Number of Threads, Env Set Threads (OMP_NUM_THREADS), EP Env Set Threads (EP_OMP_NUM_THREADS), IDF Set Threads, Number of Threads Used (Interior Radiant Exchange), Number of Threads Used (Shading), Number of Threads Used (Surface Heat Balance), Number of Threads Used (Ground Domains), Number of Threads Used (FMU Import), Number of Threads Used (Room Air Models), Number Nominal Surfaces, Number Parallel Sims" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1414,8 +1484,12 @@ namespace SimulationManager {
 		gio::write( EchoInputFile, fmtLD ) << "NumCalcScriptF_Calls=" << NumCalcScriptF_Calls;
 #endif
 
+		OutputProcessor::CloseBinaryOutput();
+		OutputProcessor::CloseCsvOutput();
 		gio::write( OutputFileStandard, EndOfDataFormat );
 		gio::write( OutputFileStandard, fmtLD ) << "Number of Records Written=" << StdOutputRecordCount;
+		AsyncOutput::StopAsyncOutput( eso_stream );
+		CompressedOutput::StopCompressedOutput( eso_stream );
 		if ( StdOutputRecordCount > 0 ) {
 			gio::close( OutputFileStandard );
 		} else {
@@ -1446,18 +1520,18 @@ namespace SimulationManager {
 			}
 			if ( lnumActiveSims ) {
 				gio::write( OutputFileInits, fmtA ) << ThreadingHeader;
-				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, Yes," + RoundSigDigits( MaxNumberOfThreads ) + ", " + cEnvSetThreads + ", " + cepEnvSetThreads + ", " + cIDFSetThreads + ", " + RoundSigDigits( NumberIntRadThreads ) + ", " + RoundSigDigits( iNominalTotSurfaces ) + ", " + RoundSigDigits( inumActiveSims );
+				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, Yes," + RoundSigDigits( MaxNumberOfThreads ) + ", " + cEnvSetThreads + ", " + cepEnvSetThreads + ", " + cIDFSetThreads + ", " + RoundSigDigits( NumberIntRadThreads ) + ", " + RoundSigDigits( NumberShadingThreads ) + ", " + RoundSigDigits( NumberSurfaceHBThreads ) + ", " + RoundSigDigits( NumberGroundDomainThreads ) + ", " + RoundSigDigits( NumberFMUThreads ) + ", " + RoundSigDigits( NumberRoomAirThreads ) + ", " + RoundSigDigits( iNominalTotSurfaces ) + ", " + RoundSigDigits( inumActiveSims );
 			} else {
 				gio::write( OutputFileInits, fmtA ) << ThreadingHeader;
-				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, Yes," + RoundSigDigits( MaxNumberOfThreads ) + ", " + cEnvSetThreads + ", " + cepEnvSetThreads + ", " + cIDFSetThreads + ", " + RoundSigDigits( NumberIntRadThreads ) + ", " + RoundSigDigits( iNominalTotSurfaces ) + ", N/A";
+				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, Yes," + RoundSigDigits( MaxNumberOfThreads ) + ", " + cEnvSetThreads + ", " + cepEnvSetThreads + ", " + cIDFSetThreads + ", " + RoundSigDigits( NumberIntRadThreads ) + ", " + RoundSigDigits( NumberShadingThreads ) + ", " + RoundSigDigits( NumberSurfaceHBThreads ) + ", " + RoundSigDigits( NumberGroundDomainThreads ) + ", " + RoundSigDigits( NumberFMUThreads ) + ", " + RoundSigDigits( NumberRoomAirThreads ) + ", " + RoundSigDigits( iNominalTotSurfaces ) + ", N/A";
 			}
 		} else { // no threading
 			if ( lnumActiveSims ) {
 				gio::write( OutputFileInits, fmtA ) << ThreadingHeader;
-				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, No," + RoundSigDigits( MaxNumberOfThreads ) + ", N/A, N/A, N/A, N/A, N/A, " + RoundSigDigits( inumActiveSims );
+				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, No," + RoundSigDigits( MaxNumberOfThreads ) + ", N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, " + RoundSigDigits( inumActiveSims );
 			} else {
 				gio::write( OutputFileInits, fmtA ) << ThreadingHeader;
-				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, No," + RoundSigDigits( MaxNumberOfThreads ) + ", N/A, N/A, N/A, N/A, N/A, N/A";
+				gio::write( OutputFileInits, fmtA ) << "Program Control:Threads/Parallel Sims, No," + RoundSigDigits( MaxNumberOfThreads ) + ", N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A, N/A";
 			}
 		}
 
@@ -1468,6 +1542,8 @@ namespace SimulationManager {
 		// Close the Meters Output File
 		gio::write( OutputFileMeters, EndOfDataFormat );
 		gio::write( OutputFileMeters, fmtLD ) << "Number of Records Written=" << StdMeterRecordCount;
+		AsyncOutput::StopAsyncOutput( mtr_stream );
+		CompressedOutput::StopCompressedOutput( mtr_stream );
 		if ( StdMeterRecordCount > 0 ) {
 			gio::close( OutputFileMeters );
 		} else {
@@ -1527,6 +1603,8 @@ namespace SimulationManager {
 
 		//  return  ! remove comment to do 'old way'
 
+		DataTimings::ProfileTimer const profileTimer( "SetupSimulation" ); // Region of the timing profile
+
 		Available = true;
 
 		while ( Available ) { // do for each environment
@@ -2381,6 +2459,8 @@ namespace SimulationManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool PreP_Fatal( false ); // True if a preprocessor flags a fatal error
 
+		DataTimings::ProfileTimer const profileTimer( "PostIPProcessing" ); // Region of the timing profile
+
 		DoingInputProcessing = false;
 
 		PreProcessorCheck( PreP_Fatal ); // Check Preprocessor objects for warning, severe, etc errors.
@@ -2479,6 +2559,8 @@ namespace SimulationManager {
 		int iostatus;
 		std::string ErrorMessage;
 
+		DataTimings::ProfileTimer const profileTimer( "CheckCachedIPErrors" ); // Region of the timing profile
+
 		gio::close( CacheIPErrorFile );
 		gio::open( CacheIPErrorFile, "eplusout.iperr" );
 		iostatus = 0;
@@ -2523,6 +2605,10 @@ namespace SimulationManager {
 		// Check EP Max Threads (EP_OMP_NUM_THREADS) = iepEnvSetThreads
 		// Check if IDF input (ProgramControl) = iIDFSetThreads
 		// Check # active sims (cntActv) = inumActiveSims [report only?]
+		// The same thread request also sizes the parallel shading loop and TDD transmittance integrals (NumberShadingThreads)
+		// the parallel CondFD/HAMT surface loop (NumberSurfaceHBThreads)
+		// the ground domain column sweeps and slinky g-function integration (NumberGroundDomainThreads)
+		// and the displacement ventilation and underfloor air distribution room air models (NumberRoomAirThreads)
 
 		// REFERENCES:
 		// na
@@ -2533,11 +2619,6 @@ namespace SimulationManager {
 		using InputProcessor::GetObjectItem;
 		using namespace DataIPShortCuts;
 		using General::RoundSigDigits;
-#if defined(_OPENMP) && defined(HBIRE_USE_OMP)
-		using omp_lib::omp_get_max_threads;
-		using omp_lib::omp_get_num_threads;
-		using omp_lib::omp_set_num_threads;
-#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2607,8 +2688,8 @@ namespace SimulationManager {
 
 		iNominalTotSurfaces = TotHTSurfs + TotDetailedWalls + TotDetailedRoofs + TotDetailedFloors + TotHTSubs + TotIntMass + TotRectWindows + TotRectDoors + TotRectGlazedDoors + TotRectIZWindows + TotRectIZDoors + TotRectIZGlazedDoors + TotRectExtWalls + TotRectIntWalls + TotRectIZWalls + TotRectUGWalls + TotRectRoofs + TotRectCeilings + TotRectIZCeilings + TotRectGCFloors + TotRectIntFloors + TotRectIZFloors;
 
-#ifdef HBIRE_USE_OMP
-		MaxNumberOfThreads = MAXTHREADS();
+#ifdef _OPENMP
+		MaxNumberOfThreads = omp_get_max_threads();
 		Threading = true;
 
 		get_environment_variable( cNumThreads, cEnvValue );
@@ -2631,7 +2712,7 @@ namespace SimulationManager {
 		if ( GetNumObjectsFound( cCurrentModuleObject ) > 0 ) {
 			GetObjectItem( cCurrentModuleObject, 1, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, ios, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			iIDFSetThreads = int( rNumericArgs( 1 ) );
-			lIDFsetThreadsInput = true;
+			lIDFSetThreadsInput = true;
 			if ( iIDFSetThreads <= 0 ) {
 				iIDFSetThreads = MaxNumberOfThreads;
 				if ( lEnvSetThreadsInput ) iIDFSetThreads = iEnvSetThreads;
@@ -2654,6 +2735,48 @@ namespace SimulationManager {
 			if ( lepSetThreadsInput ) NumberIntRadThreads = iepEnvSetThreads;
 			if ( lIDFSetThreadsInput ) NumberIntRadThreads = iIDFSetThreads;
 		}
+		NumberIntRadThreads = max( 1, NumberIntRadThreads );
+
+		// Shading is only worth splitting when there are enough receiving surfaces to keep the threads busy
+		if ( iNominalTotSurfaces <= 30 ) {
+			NumberShadingThreads = 1;
+		} else {
+			NumberShadingThreads = MaxNumberOfThreads;
+		}
+		if ( lEnvSetThreadsInput ) NumberShadingThreads = iEnvSetThreads;
+		if ( lepSetThreadsInput ) NumberShadingThreads = iepEnvSetThreads;
+		if ( lIDFSetThreadsInput ) NumberShadingThreads = iIDFSetThreads;
+		NumberShadingThreads = max( 1, NumberShadingThreads );
+
+		// Only CondFD and HAMT surfaces are spread over these threads; their per-surface solves are costly
+		// enough that it pays to split them whenever more than one thread is available
+		NumberSurfaceHBThreads = MaxNumberOfThreads;
+		if ( lEnvSetThreadsInput ) NumberSurfaceHBThreads = iEnvSetThreads;
+		if ( lepSetThreadsInput ) NumberSurfaceHBThreads = iepEnvSetThreads;
+		if ( lIDFSetThreadsInput ) NumberSurfaceHBThreads = iIDFSetThreads;
+		NumberSurfaceHBThreads = max( 1, NumberSurfaceHBThreads );
+
+		// Ground domain columns are only split when GroundDomainLineSolve is on; the point-by-point sweep stays serial.
+		// The slinky ground heat exchanger g-function integration is split over the same threads
+		NumberGroundDomainThreads = MaxNumberOfThreads;
+		if ( lEnvSetThreadsInput ) NumberGroundDomainThreads = iEnvSetThreads;
+		if ( lepSetThreadsInput ) NumberGroundDomainThreads = iepEnvSetThreads;
+		if ( lIDFSetThreadsInput ) NumberGroundDomainThreads = iIDFSetThreads;
+		NumberGroundDomainThreads = max( 1, NumberGroundDomainThreads );
+
+		// Separate imported FMUs are only stepped on these threads when ParallelFMUImport is on
+		NumberFMUThreads = MaxNumberOfThreads;
+		if ( lEnvSetThreadsInput ) NumberFMUThreads = iEnvSetThreads;
+		if ( lepSetThreadsInput ) NumberFMUThreads = iepEnvSetThreads;
+		if ( lIDFSetThreadsInput ) NumberFMUThreads = iIDFSetThreads;
+		NumberFMUThreads = max( 1, NumberFMUThreads );
+
+		// Zones with displacement ventilation or underfloor air distribution room air models are spread over these threads
+		NumberRoomAirThreads = MaxNumberOfThreads;
+		if ( lEnvSetThreadsInput ) NumberRoomAirThreads = iEnvSetThreads;
+		if ( lepSetThreadsInput ) NumberRoomAirThreads = iepEnvSetThreads;
+		if ( lIDFSetThreadsInput ) NumberRoomAirThreads = iIDFSetThreads;
+		NumberRoomAirThreads = max( 1, NumberRoomAirThreads );
 #else
 		Threading = false;
 		cCurrentModuleObject = "ProgramControl";
@@ -2666,6 +2789,12 @@ namespace SimulationManager {
 			}
 		}
 		MaxNumberOfThreads = 1;
+		NumberIntRadThreads = 1;
+		NumberShadingThreads = 1;
+		NumberSurfaceHBThreads = 1;
+		NumberGroundDomainThreads = 1;
+		NumberFMUThreads = 1;
+		NumberRoomAirThreads = 1;
 #endif
 		// just reporting
 		get_environment_variable( cNumActiveSims, cEnvValue );
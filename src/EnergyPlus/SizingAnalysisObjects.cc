@@ -75,31 +75,32 @@ namespace EnergyPlus {
 	{}
 
 	int SizingLog::GetZtStepIndex (
-		const ZoneTimestepObject tmpztStepStamp )
+		ZoneTimestepObject const & tmpztStepStamp )
 	{
 
 		int vecIndex;
+		int const seedEnvrnNum = newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ];
+		int const envrnStartIndex = envrnStartZtStepIndexMap[ seedEnvrnNum ];
 
 		if ( tmpztStepStamp.ztStepsIntoPeriod > 0 ) { // discard any negative value for safety
-			vecIndex = envrnStartZtStepIndexMap[ newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ] ] + tmpztStepStamp.ztStepsIntoPeriod;
+			vecIndex = envrnStartIndex + tmpztStepStamp.ztStepsIntoPeriod;
 		} else {
-			vecIndex = envrnStartZtStepIndexMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ];
+			vecIndex = envrnStartIndex;
 		}
 
 		// next for safety sake, constrain index to lie inside correct envronment
-		if ( vecIndex < envrnStartZtStepIndexMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ] ) {
-			vecIndex = envrnStartZtStepIndexMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ]; // first step in environment
+		if ( vecIndex < envrnStartIndex ) {
+			vecIndex = envrnStartIndex; // first step in environment
 		}
-		if (vecIndex > ( envrnStartZtStepIndexMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ]
-				+ ztStepCountByEnvrnMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ]) ) {
-			vecIndex = envrnStartZtStepIndexMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ]
-				+ ztStepCountByEnvrnMap[  newEnvrnToSeedEnvrnMap[ tmpztStepStamp.envrnNum ]  ]; // last step in environment
+		int const envrnEndIndex = envrnStartIndex + ztStepCountByEnvrnMap[ seedEnvrnNum ];
+		if ( vecIndex > envrnEndIndex ) {
+			vecIndex = envrnEndIndex; // last step in environment
 		}
 		return vecIndex;
 	}
 
 	void SizingLog::FillZoneStep(
-		ZoneTimestepObject tmpztStepStamp )
+		ZoneTimestepObject const & tmpztStepStamp )
 	{
 		int index =  GetZtStepIndex( tmpztStepStamp );
 
@@ -117,7 +118,7 @@ namespace EnergyPlus {
 	}
 
 	int SizingLog::GetSysStepZtStepIndex(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	)
 	{
 	// this method finds a zone timestep for the system timestep update to use
@@ -150,7 +151,7 @@ namespace EnergyPlus {
 	}
 
 	void SizingLog::FillSysStep(
-		ZoneTimestepObject tmpztStepStamp ,
+		ZoneTimestepObject const & tmpztStepStamp ,
 		SystemTimestepObject tmpSysStepStamp
 	)
 	{
@@ -227,18 +228,19 @@ namespace EnergyPlus {
 //		for (int k = 0; k < NumOfEnvironmentsInLogSet; k++) { // outer loop over environments in log set
 
 //			for ( int i = 0; i < ztStepCountByEnvrn[ k ]; ++i ) { // next inner loop over zone timestep steps
+			int const envrnStartIndex = envrnStartZtStepIndexMap[ itr->first ];
 			for ( int i = 0; i < itr->second; ++i ) { // next inner loop over zone timestep steps
 
 				if ( timeStepsInAverage > 0 ) {
 					RunningSum = 0.0;
 					for ( int j = 0; j < timeStepsInAverage; ++j ) { //
 						if ( (i - j) < 0) {
-							RunningSum += ztStepObj[ envrnStartZtStepIndexMap[ itr->first ] ].logDataValue; //just use first value to fill early steps
+							RunningSum += ztStepObj[ envrnStartIndex ].logDataValue; //just use first value to fill early steps
 						} else {
-							RunningSum += ztStepObj[ ( (i - j) + envrnStartZtStepIndexMap[ itr->first ] ) ].logDataValue;
+							RunningSum += ztStepObj[ ( (i - j) + envrnStartIndex ) ].logDataValue;
 						}
 					}
-					ztStepObj[ (i + envrnStartZtStepIndexMap[ itr->first ] ) ].runningAvgDataValue = RunningSum / divisor;
+					ztStepObj[ (i + envrnStartIndex ) ].runningAvgDataValue = RunningSum / divisor;
 				}
 			}
 		}
@@ -250,22 +252,27 @@ namespace EnergyPlus {
 		ZoneTimestepObject tmpztStepStamp;
 		MaxVal = 0.0;
 
+		// find the step first and copy it (with its system substeps) only once
+		int maxIndex = -1;
 		if ( ! ztStepObj.empty() ) {
-			tmpztStepStamp = ztStepObj[ 1 ];
+			maxIndex = 1;
 		}
 
-		for ( auto &Zt : ztStepObj ) {
+		for ( int i = 0; i < int( ztStepObj.size() ); ++i ) {
 
-			if ( Zt.runningAvgDataValue > MaxVal) {
-				MaxVal = Zt.runningAvgDataValue;
-				tmpztStepStamp = Zt;
+			if ( ztStepObj[ i ].runningAvgDataValue > MaxVal) {
+				MaxVal = ztStepObj[ i ].runningAvgDataValue;
+				maxIndex = i;
 				}
 		}
+		if ( maxIndex >= 0 ) {
+			tmpztStepStamp = ztStepObj[ maxIndex ];
+		}
 	return tmpztStepStamp;
 	}
 
 	Real64 SizingLog::GetLogVariableDataAtTimestamp(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	)
 	{
 		int const index =  GetZtStepIndex( tmpztStepStamp );
@@ -277,10 +284,21 @@ namespace EnergyPlus {
 
 	void SizingLog::ReInitLogForIteration()
 	{
-		ZoneTimestepObject tmpNullztStepObj;
-
+		// reset each step in place, keeping the storage of its system substeps for the next pass
 		for ( auto &Zt : ztStepObj ) {
-			Zt = tmpNullztStepObj;
+			Zt.kindOfSim = 0;
+			Zt.envrnNum = 0;
+			Zt.dayOfSim = 0;
+			Zt.hourOfDay = 0;
+			Zt.ztStepsIntoPeriod = 0;
+			Zt.stepStartMinute = 0.0;
+			Zt.stepEndMinute = 0.0;
+			Zt.timeStepDuration = 0.0;
+			Zt.logDataValue = 0.0;
+			Zt.runningAvgDataValue = 0.0;
+			Zt.hasSystemSubSteps = false;
+			Zt.numSubSteps = 0;
+			Zt.subSteps.clear();
 		}
 	}
 
@@ -634,7 +652,7 @@ namespace EnergyPlus {
 	}
 
 	bool PlantCoinicidentAnalysis::CheckTimeStampForNull(
-		ZoneTimestepObject testStamp
+		ZoneTimestepObject const & testStamp
 	)
 	{
 
@@ -72,11 +72,11 @@ public:
 	std::vector< ZoneTimestepObject > ztStepObj; //will be sized to the sum of all steps, eg. timesteps in hour * 24 hours * 2 design days.
 
 	void FillZoneStep(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 	void FillSysStep(
-		ZoneTimestepObject tmpztStepStamp ,
+		ZoneTimestepObject const & tmpztStepStamp ,
 		SystemTimestepObject tmpSysStepStamp
 	);
 
@@ -87,7 +87,7 @@ public:
 	ZoneTimestepObject GetLogVariableDataMax();
 
 	Real64 GetLogVariableDataAtTimestamp(
-		ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 	void ReInitLogForIteration();
@@ -100,10 +100,10 @@ public:
 private:
 
 	int GetSysStepZtStepIndex(
-		const ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 	int GetZtStepIndex(
-		const ZoneTimestepObject tmpztStepStamp
+		ZoneTimestepObject const & tmpztStepStamp
 	);
 
 };
@@ -180,7 +180,7 @@ private:
 	Real64 newVolDesignFlowRate = 0.0;
 
 	bool CheckTimeStampForNull(
-		ZoneTimestepObject testStamp
+		ZoneTimestepObject const & testStamp
 	);
 };
 
@@ -18,6 +18,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -167,6 +168,8 @@ namespace SizingManager {
 
 		// FLOW:
 
+		DataTimings::ProfileTimer const profileTimer( "ManageSizing" ); // Region of the timing profile
+
 		OutputFileZoneSizing = 0;
 		OutputFileSysSizing = 0;
 		TimeStepInDay = 0;
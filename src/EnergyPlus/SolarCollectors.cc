@@ -914,7 +914,7 @@ namespace SolarCollectors {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   January 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse the incident angle modifier while the solar incidence is unchanged
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -994,8 +994,11 @@ namespace SolarCollectors {
 		SurfNum = Collector( CollectorNum ).Surface;
 		ParamNum = Collector( CollectorNum ).Parameters;
 
-		// Calculate incident angle modifier
-		if ( QRadSWOutIncident( SurfNum ) > 0.0 ) {
+		// Calculate incident angle modifier, unless the solar incidence is the same as when it was last calculated
+		// (as it is for the repeated plant iterations of a timestep)
+		if ( ! SolarIncidenceChanged( CollectorNum ) ) {
+			IncidentAngleModifier = Collector( CollectorNum ).IncidentAngleModifier;
+		} else if ( QRadSWOutIncident( SurfNum ) > 0.0 ) {
 			ThetaBeam = std::acos( CosIncidenceAngle( SurfNum ) );
 
 			// Calculate equivalent incident angles for sky and ground radiation according to Brandemuehl and Beckman (1980)
@@ -1212,6 +1215,46 @@ namespace SolarCollectors {
 
 	}
 
+	bool
+	SolarIncidenceChanged( int const CollectorNum )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Checks whether the solar incidence on the collector surface differs from the one its optical
+		// properties were last calculated for, and if so saves it for the next check.
+
+		// METHODOLOGY EMPLOYED:
+		// The incident angle modifier and the transmittance-absorptance products depend only on the
+		// collector parameters and the solar incidence, which is updated once per zone timestep while the
+		// plant loop may simulate the collector many times, so an exact comparison is sufficient.
+
+		// Using/Aliasing
+		using DataHeatBalance::CosIncidenceAngle;
+		using DataHeatBalance::QRadSWOutIncident;
+		using DataHeatBalance::QRadSWOutIncidentBeam;
+		using DataHeatBalance::QRadSWOutIncidentSkyDiffuse;
+		using DataHeatBalance::QRadSWOutIncidentGndDiffuse;
+
+		auto & thisCollector( Collector( CollectorNum ) );
+		int const SurfNum( thisCollector.Surface );
+
+		if ( thisCollector.OpticsCosIncAng == CosIncidenceAngle( SurfNum ) && thisCollector.OpticsQRadIncident == QRadSWOutIncident( SurfNum ) && thisCollector.OpticsQRadBeam == QRadSWOutIncidentBeam( SurfNum ) && thisCollector.OpticsQRadSkyDiffuse == QRadSWOutIncidentSkyDiffuse( SurfNum ) && thisCollector.OpticsQRadGndDiffuse == QRadSWOutIncidentGndDiffuse( SurfNum ) ) return false;
+
+		thisCollector.OpticsCosIncAng = CosIncidenceAngle( SurfNum );
+		thisCollector.OpticsQRadIncident = QRadSWOutIncident( SurfNum );
+		thisCollector.OpticsQRadBeam = QRadSWOutIncidentBeam( SurfNum );
+		thisCollector.OpticsQRadSkyDiffuse = QRadSWOutIncidentSkyDiffuse( SurfNum );
+		thisCollector.OpticsQRadGndDiffuse = QRadSWOutIncidentGndDiffuse( SurfNum );
+		return true;
+
+	}
+
 	void
 	CalcICSSolarCollector( int const ColleNum )
 	{
@@ -1219,7 +1262,7 @@ namespace SolarCollectors {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse, FSEC/UCF
 		//       DATE WRITTEN   February 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse the transmittance-absorptance product while the solar incidence is unchanged
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1314,9 +1357,12 @@ namespace SolarCollectors {
 			TempOSCM = TempOutdoorAir;
 		}
 
-		// Calculate transmittance-absorptance product of the system
-		ThetaBeam = std::acos( CosIncidenceAngle( SurfNum ) );
-		CalcTransAbsorProduct( ColleNum, ThetaBeam );
+		// Calculate transmittance-absorptance product of the system, unless the solar incidence is the same as
+		// when it was last calculated
+		if ( SolarIncidenceChanged( ColleNum ) ) {
+			ThetaBeam = std::acos( CosIncidenceAngle( SurfNum ) );
+			CalcTransAbsorProduct( ColleNum, ThetaBeam );
+		}
 
 		InletTemp = Collector( ColleNum ).InletTemp;
 
@@ -236,6 +236,13 @@ namespace SolarCollectors {
 		Real64 Volume; // collector net volume (m3)
 		bool OSCM_ON; // Boundary condition is OSCM
 		bool InitICS; // used to initialize ICS variables only
+		// Solar incidence on the surface when the optical properties (incident angle modifier or
+		// transmittance-absorptance products) were last calculated
+		Real64 OpticsCosIncAng; // Cosine of the beam incidence angle
+		Real64 OpticsQRadIncident; // Total incident solar [W/m2]
+		Real64 OpticsQRadBeam; // Incident beam solar [W/m2]
+		Real64 OpticsQRadSkyDiffuse; // Incident sky diffuse solar [W/m2]
+		Real64 OpticsQRadGndDiffuse; // Incident ground diffuse solar [W/m2]
 
 		// Default Constructor
 		CollectorData() :
@@ -308,7 +315,12 @@ namespace SolarCollectors {
 			Area( 0.0 ),
 			Volume( 0.0 ),
 			OSCM_ON( false ),
-			InitICS( false )
+			InitICS( false ),
+			OpticsCosIncAng( 0.0 ),
+			OpticsQRadIncident( -1.0 ),
+			OpticsQRadBeam( 0.0 ),
+			OpticsQRadSkyDiffuse( 0.0 ),
+			OpticsQRadGndDiffuse( 0.0 )
 		{}
 
 		// Member Constructor
@@ -387,7 +399,12 @@ namespace SolarCollectors {
 			Real64 const Area, // collector area (m2)
 			Real64 const Volume, // collector net volume (m3)
 			bool const OSCM_ON, // Boundary condition is OSCM
-			bool const InitICS // used to initialize ICS variables only
+			bool const InitICS, // used to initialize ICS variables only
+			Real64 const OpticsCosIncAng, // Cosine of the beam incidence angle
+			Real64 const OpticsQRadIncident, // Total incident solar [W/m2]
+			Real64 const OpticsQRadBeam, // Incident beam solar [W/m2]
+			Real64 const OpticsQRadSkyDiffuse, // Incident sky diffuse solar [W/m2]
+			Real64 const OpticsQRadGndDiffuse // Incident ground diffuse solar [W/m2]
 		) :
 			Name( Name ),
 			BCType( BCType ),
@@ -463,7 +480,12 @@ namespace SolarCollectors {
 			Area( Area ),
 			Volume( Volume ),
 			OSCM_ON( OSCM_ON ),
-			InitICS( InitICS )
+			InitICS( InitICS ),
+			OpticsCosIncAng( OpticsCosIncAng ),
+			OpticsQRadIncident( OpticsQRadIncident ),
+			OpticsQRadBeam( OpticsQRadBeam ),
+			OpticsQRadSkyDiffuse( OpticsQRadSkyDiffuse ),
+			OpticsQRadGndDiffuse( OpticsQRadGndDiffuse )
 		{}
 
 	};
@@ -498,6 +520,9 @@ namespace SolarCollectors {
 		Real64 const IncidentAngle // Angle of incidence (radians)
 	);
 
+	bool
+	SolarIncidenceChanged( int const CollectorNum );
+
 	void
 	CalcICSSolarCollector( int const ColleNum );
 
@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -16,6 +17,7 @@
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceRayTree.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -47,6 +49,8 @@ namespace SolarReflectionManager {
 	using namespace DataEnvironment;
 
 	using namespace DataVectorTypes;
+	using SurfaceRayTree::SurfacesAlongRay;
+	using SurfaceRayTree::UpdateSurfaceRayTree;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:na
@@ -584,7 +588,7 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann, derived from original CalcBeamSolDiffuseReflFactors
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, receiving surfaces in parallel
 		//       RE-ENGINEERED  B. Griffith, October 2012, revised for timestep integrated solar
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -592,13 +596,16 @@ namespace SolarReflectionManager {
 		// beam-to-diffuse solar reflection from obstructions and ground.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The receiving surfaces are independent, so with OpenMP they are spread over
+		// NumberShadingThreads threads.
 
 		// REFERENCES:
 		// na
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -613,12 +620,12 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
+		int RecSurfNum( 0 ); // Receiving surface number
+		int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
+		int RecPtNum( 0 ); // Receiving point number
+		int NumRecPts( 0 ); // Number of receiving points on a receiving surface
+		int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
 		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
@@ -627,19 +634,18 @@ namespace SolarReflectionManager {
 		Array1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from the ground, divided by
 		// beam normal irradiance
-		static int RayNum( 0 ); // Ray number
-		static int IHit( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
-		static Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
-		static Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
+		int RayNum( 0 ); // Ray number
+		int IHit( 0 ); // > 0 if obstruction is hit; otherwise = 0
+		Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
+		Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
+		Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
+		Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
 		//  the mirrored shading surface
-		static Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
+		Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
 		//  by beam normal irradiance
-		static Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
 		//  from beam solar reflected from a hit point
-		static Real64 SunLitFract( 0.0 ); // Sunlit fraction
+		Real64 SunLitFract( 0.0 ); // Sunlit fraction
 
 		ReflBmToDiffSolObs = 0.0;
 		ReflBmToDiffSolGnd = 0.0;
@@ -648,6 +654,10 @@ namespace SolarReflectionManager {
 		SunVec = SUNCOSHR( iHour, {1,3} );
 
 		// loop through each surface that can receive beam solar reflected as diffuse solar from other surfaces
+		UpdateSurfaceRayTree();
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( SurfNum, RecPtNum, NumRecPts, HitPtSurfNum, RayNum, IHit, OriginThisRay, ObsHitPt, CosIncBmAtHitPt, CosIncBmAtHitPt2, BmReflSolRadiance, dReflBeamToDiffSol, SunLitFract ) firstprivate( ReflBmToDiffSolObs, ReflBmToDiffSolGnd )
+#endif
 		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
 			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
 
@@ -728,7 +738,9 @@ namespace SolarReflectionManager {
 
 					// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
 					//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
-					for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+					static EP_THREAD_LOCAL std::vector< int > RaySurfNums; // Surfaces the ray may hit
+					SurfacesAlongRay( OriginThisRay, SunVec, RaySurfNums );
+					for ( int const ObsSurfNum : RaySurfNums ) {
 						//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
 						//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
 
@@ -865,7 +877,7 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, receiving surfaces in parallel
 		//       RE-ENGINEERED  B. Griffith, October 2012, for timestep integrated solar
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -878,13 +890,17 @@ namespace SolarReflectionManager {
 		// i.e. these surfaces has no specular reflection component.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The receiving surfaces are independent, so with OpenMP they are spread over
+		// NumberShadingThreads threads.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using General::POLYF;
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -899,40 +915,40 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int loop( 0 ); // DO loop indices
-		static int loop2( 0 ); // DO loop indices
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int RecPtNum( 0 ); // Receiving point number
-		static Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
+		int loop( 0 ); // DO loop indices
+		int loop2( 0 ); // DO loop indices
+		Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
+		Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
+		int RecSurfNum( 0 ); // Receiving surface number
+		int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
+		int NumRecPts( 0 ); // Number of receiving points on a receiving surface
+		int RecPtNum( 0 ); // Receiving point number
+		Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
+		Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
 		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from obstructions, divided by
 		// beam normal irradiance
 		//unused  INTEGER           :: RayNum               =0   ! Ray number
-		static int IHitRefl( 0 ); // > 0 if reflecting surface is hit; otherwise = 0
-		static int IHitObs( 0 ); // > 0 if obstruction is hit
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
-		static int IHitObsRefl( 0 ); // > 0 if obstruction hit between rec. pt. and reflection point
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int ReflSurfNum( 0 ); // Reflecting surface number
-		static int ReflSurfRecNum( 0 ); // Receiving surface number corresponding to a reflecting surface number
-		static Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
+		int IHitRefl( 0 ); // > 0 if reflecting surface is hit; otherwise = 0
+		int IHitObs( 0 ); // > 0 if obstruction is hit
+		Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
+		int IHitObsRefl( 0 ); // > 0 if obstruction hit between rec. pt. and reflection point
+		int ObsSurfNum( 0 ); // Obstruction surface number
+		int ReflSurfNum( 0 ); // Reflecting surface number
+		int ReflSurfRecNum( 0 ); // Receiving surface number corresponding to a reflecting surface number
+		Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
 		Array1D< Real64 > ReflBmToBmSolObs( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar specularly reflected from obstructions, divided by
 		// beam normal irradiance
-		static Real64 ReflDistance( 0.0 ); // Distance from receiving point to hit point on a reflecting surface (m)
-		static Real64 ObsDistance( 0.0 ); // Distance from receiving point to hit point on an obstruction (m)
-		static Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
-		static int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
-		static Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
-		static Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
-		static Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
+		Real64 ReflDistance( 0.0 ); // Distance from receiving point to hit point on a reflecting surface (m)
+		Real64 ObsDistance( 0.0 ); // Distance from receiving point to hit point on an obstruction (m)
+		Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
+		int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
+		Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
+		Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
+		Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
 		Array1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts ); // Sum of ReflFac times CosIncAngRefl
-		static Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
+		Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
 
 		ReflBmToDiffSolObs = 0.0;
 		ReflFacTimesCosIncSum = 0.0;
@@ -942,6 +958,10 @@ namespace SolarReflectionManager {
 		// Unit vector to sun
 		SunVec = SUNCOSHR( iHour, {1,3} );
 
+		UpdateSurfaceRayTree();
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( loop, loop2, SunVecMir, SurfNum, NumRecPts, RecPtNum, RecPt, HitPtRefl, IHitRefl, IHitObs, HitPtObs, IHitObsRefl, ObsSurfNum, ReflSurfNum, ReflSurfRecNum, ReflNorm, ReflDistance, ObsDistance, SpecReflectance, ConstrNumRefl, CosIncAngRefl, CosIncAngRec, ReflFac, CosIncWeighted ) firstprivate( ReflBmToBmSolObs, ReflFacTimesCosIncSum )
+#endif
 		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
 			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
 			if ( SolReflRecSurf( RecSurfNum ).NumPossibleObs > 0 ) {
@@ -1003,7 +1023,9 @@ namespace SolarReflectionManager {
 									}
 								} else {
 									// Reflecting surface is a building shade
-									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+									static EP_THREAD_LOCAL std::vector< int > RaySurfNums; // Surfaces the ray may hit
+									SurfacesAlongRay( HitPtRefl, SunVec, RaySurfNums );
+									for ( int const ObsSurfNum : RaySurfNums ) {
 										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 										if ( ObsSurfNum == ReflSurfNum ) continue;
 
@@ -1069,19 +1091,24 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   October 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, receiving surfaces in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Calculates factors for irradiance on exterior heat transfer surfaces due to
 		// reflection of sky diffuse solar radiation from obstructions and ground.
 
-		// METHODOLOGY EMPLOYED: na
+		// METHODOLOGY EMPLOYED:
+		// The receiving surfaces are independent, so with OpenMP they are spread over
+		// NumberShadingThreads threads.
 
 		// REFERENCES: na
 
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 		using namespace Vectors;
 
 		// Locals
@@ -1090,15 +1117,14 @@ namespace SolarReflectionManager {
 		// DERIVED TYPE DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		int RecSurfNum( 0 ); // Receiving surface number
+		int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
+		int RecPtNum( 0 ); // Receiving point number
+		int NumRecPts( 0 ); // Number of receiving points on a receiving surface
+		int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
-		static int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
+		int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
 		// HitPitSurfNum + 1 for mirror surface
 		Array1D< Real64 > ReflSkySolObs( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from obstructions, divided by unobstructed
@@ -1106,36 +1132,40 @@ namespace SolarReflectionManager {
 		Array1D< Real64 > ReflSkySolGnd( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from ground, divided by unobstructed
 		// sky diffuse horizontal irradiance
-		static int RayNum( 0 ); // Ray number
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
-		static int IHitObs( 0 ); // > 0 if obstruction is hit; otherwise = 0
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on an obstruction (m)
+		int RayNum( 0 ); // Ray number
+		Vector3< Real64 > HitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
+		int IHitObs( 0 ); // > 0 if obstruction is hit; otherwise = 0
+		Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on an obstruction (m)
 		//unused  REAL(r64)         :: ObsHitPt(3)          =0.0 ! Hit point on obstruction (m)
-		static Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
-		static Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
-		static Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
+		Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
+		Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
+		Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
 		//  sky diffuse horizontal irradiance
-		static Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
 		//  from sky solar reflected from a hit point
-		static Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 SPhi( 0.0 ); // Sine of Phi
-		static Real64 CPhi( 0.0 ); // Cosine of Phi
-		static Real64 Theta( 0.0 ); // Azimuth angle (radians)
-		static Real64 DTheta( 0.0 ); // Azimuth increment (radians)
-		static int IPhi( 0 ); // Altitude angle index
-		static int ITheta( 0 ); // Azimuth angle index
-		static Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
-		static Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
+		Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
+		Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
+		Real64 SPhi( 0.0 ); // Sine of Phi
+		Real64 CPhi( 0.0 ); // Cosine of Phi
+		Real64 Theta( 0.0 ); // Azimuth angle (radians)
+		Real64 DTheta( 0.0 ); // Azimuth increment (radians)
+		int IPhi( 0 ); // Altitude angle index
+		int ITheta( 0 ); // Azimuth angle index
+		Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
+		Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
 		//  hit point (m)
-		static Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
-		static Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
+		Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
+		Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
 		// FLOW:
 
 		DisplayString( "Calculating Sky Diffuse Exterior Solar Reflection Factors" );
 		ReflSkySolObs = 0.0;
 		ReflSkySolGnd = 0.0;
 
+		UpdateSurfaceRayTree();
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( SurfNum, RecPtNum, NumRecPts, HitPtSurfNum, HitPtSurfNumX, RayNum, HitPtRefl, IHitObs, HitPtObs, dOmega, CosIncAngRayToSky, SkyReflSolRadiance, dReflSkySol, Phi, DPhi, SPhi, CPhi, Theta, DTheta, IPhi, ITheta, URay, SurfVertToGndPt, SurfVert, dReflSkyGnd ) firstprivate( ReflSkySolObs, ReflSkySolGnd )
+#endif
 		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
 			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
 			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
@@ -1204,7 +1234,9 @@ namespace SolarReflectionManager {
 								URay.y = CPhi * std::sin( Theta );
 								// Does this ray hit an obstruction?
 								IHitObs = 0;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+								static EP_THREAD_LOCAL std::vector< int > RaySurfNums; // Surfaces the ray may hit
+								SurfacesAlongRay( HitPtRefl, URay, RaySurfNums );
+								for ( int const ObsSurfNum : RaySurfNums ) {
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									// Horizontal roof surfaces cannot be obstructions for rays from ground
 									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
@@ -1328,9 +1360,9 @@ namespace SolarReflectionManager {
 		//unused  REAL(r64) :: DOTAXCSN                 ! Dot product of vectors AXC and SN
 
 		// Vertex vectors
-		static Array1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
-		static Array1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
-		static Array1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > V( MaxVerticesPerSurface ); // Vertices of surfaces
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > A( MaxVerticesPerSurface ); // Vertex-to-vertex vectors; A(1,i) is from vertex 1 to 2, etc.
+		static EP_THREAD_LOCAL Array1D< Vector3< Real64 > > C( MaxVerticesPerSurface ); // Vectors from vertices to intersection point
 
 		// FLOW:
 		IPIERC = 0;
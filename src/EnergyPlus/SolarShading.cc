@@ -1,6 +1,14 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -127,72 +135,81 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	int MaxHCS( 15000 ); // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
+	EP_SHADING_THREAD_LOCAL int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
 	int MAXHCArrayIncrement( 0 ); // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	int NVS; // Number of vertices of the shadow/clipped surface
-	int NumVertInShadowOrClippedSurface;
-	int CurrentSurfaceBeingShadowed;
-	int CurrentShadowingSurface;
-	int OverlapStatus; // Results of overlap calculation:
+	EP_SHADING_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+	EP_SHADING_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+	EP_SHADING_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+	EP_SHADING_THREAD_LOCAL int CurrentShadowingSurface;
+	EP_SHADING_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
 	Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	int FBKSHC; // HC location of first back surface
-	int FGSSHC; // HC location of first general shadowing surface
-	int FINSHC; // HC location of first back surface overlap
-	int FRVLHC; // HC location of first reveal surface
-	int FSBSHC; // HC location of first subsurface
-	int LOCHCA( 0 ); // Location of highest data in the HC arrays
-	int NBKSHC; // Number of back surfaces in the HC arrays
-	int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	int NINSHC; // Number of back surface overlaps in the HC arrays
-	int NRVLHC; // Number of reveal surfaces in HC array
-	int NSBSHC; // Number of subsurfaces in the HC arrays
+	Array1D< Real64 > SurfOutNormX; // X components of the surface outward normals (contiguous for CalcCosIncidence)
+	Array1D< Real64 > SurfOutNormY; // Y components of the surface outward normals
+	Array1D< Real64 > SurfOutNormZ; // Z components of the surface outward normals
+	EP_SHADING_THREAD_LOCAL int FBKSHC; // HC location of first back surface
+	EP_SHADING_THREAD_LOCAL int FGSSHC; // HC location of first general shadowing surface
+	EP_SHADING_THREAD_LOCAL int FINSHC; // HC location of first back surface overlap
+	EP_SHADING_THREAD_LOCAL int FRVLHC; // HC location of first reveal surface
+	EP_SHADING_THREAD_LOCAL int FSBSHC; // HC location of first subsurface
+	EP_SHADING_THREAD_LOCAL int LOCHCA( 0 ); // Location of highest data in the HC arrays
+	EP_SHADING_THREAD_LOCAL int NBKSHC; // Number of back surfaces in the HC arrays
+	EP_SHADING_THREAD_LOCAL int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	EP_SHADING_THREAD_LOCAL int NINSHC; // Number of back surface overlaps in the HC arrays
+	EP_SHADING_THREAD_LOCAL int NRVLHC; // Number of reveal surfaces in HC array
+	EP_SHADING_THREAD_LOCAL int NSBSHC; // Number of subsurfaces in the HC arrays
 	bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	int ShadowingCalcFrequency( 0 ); // Frequency for Shadowing Calculations
 	int ShadowingDaysLeft( 0 ); // Days left in current shadowing period
+	Real64 SunPositionTolerance( 0.0 ); // Sun movement (deg) within which a surface keeps its last shadow calculation
+	Real64 CosSunPositionTolerance( 1.0 ); // Cosine of SunPositionTolerance
+	bool ReuseTimestepShadows( false ); // True when time step shadow calculations are reused within SunPositionTolerance
+	int ShadowCalcCount( 0 ); // Number of time step shadow calculations, dates the entries of ShadowHistory
 	bool debugging( false );
 	std::ofstream shd_stream; // Shading file stream
-	Array1D_int HCNS; // Surface number of back surface HC figures
-	Array1D_int HCNV; // Number of vertices of each HC figure
-	Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	EP_SHADING_THREAD_LOCAL Array1D_int HCNS; // Surface number of back surface HC figures
+	EP_SHADING_THREAD_LOCAL Array1D_int HCNV; // Number of vertices of each HC figure
+	EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	Array3D_int WindowRevealStatus;
-	Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	Array1D< Real64 > HCT; // Transmittance of each HC figure
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > HCT; // Transmittance of each HC figure
 	Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
 	Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	Array1D_bool SurfSunlitReported; // True if the sunlit area or fraction of this surface is stored for output
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	int NumTooManyFigures( 0 );
 	int NumTooManyVertices( 0 );
 	int NumBaseSubSurround( 0 );
 	Array1D< Real64 > SUNCOS( 3 ); // Direction cosines of solar position
-	Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	Array1D< Real64 > XVS; // X-vertices of the shadow
-	Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	Array1D< Real64 > YVS; // Y-vertices of the shadow
-	Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	EP_SHADING_THREAD_LOCAL Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	EP_SHADING_THREAD_LOCAL Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVS; // X-vertices of the shadow
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVS; // Y-vertices of the shadow
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	EP_SHADING_THREAD_LOCAL Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	int maxNumberOfFigures( 0 );
+	char const ShadingCacheMagic[ 8 ] = { 'E', 'P', 'S', 'H', 'D', 'C', '0', '1' }; // Tag at the start of shading cache files
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -200,6 +217,11 @@ namespace SolarShading {
 	Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	std::vector< ShadowCasterTreeNode > ShadowCasterTree; // Only used while shadowing combinations are determined
+	std::vector< int > ShadowCasterOrder; // Casting surface numbers, grouped by tree leaf
+	Array1D< SurfaceShadowHistory > ShadowHistory; // Last time step shadow calculation by surface
+	Array2D_int ShadowHistoryBackSurfaces; // BackSurfaces of the last shadow calculation by window (BackSurfIndex)
+	Array2D< Real64 > ShadowHistoryOverlapAreas; // OverlapAreas of the last shadow calculation by window (BackSurfIndex)
 
 	static gio::Fmt fmtLD( "*" );
 
@@ -482,6 +504,8 @@ namespace SolarShading {
 			MaxHCS = 15000;
 		}
 
+		SunPositionTolerance = max( rNumericArgs( 3 ), 0.0 );
+
 		if ( NumAlphas >= 1 ) {
 			if ( SameString( cAlphaArgs( 1 ), "AverageOverDaysInFrequency" ) ) {
 				DetailedSolarTimestepIntegration = false;
@@ -548,6 +572,16 @@ namespace SolarShading {
 			DetailedSkyDiffuseAlgorithm = false;
 		}
 
+		if ( SunPositionTolerance > 0.0 ) {
+			if ( DetailedSolarTimestepIntegration ) {
+				CosSunPositionTolerance = std::cos( SunPositionTolerance * DegToRadians );
+				ReuseTimestepShadows = true;
+			} else {
+				ShowWarningError( cCurrentModuleObject + ": " + cNumericFieldNames( 3 ) + " is only used with TimestepFrequency, it will be ignored." );
+				SunPositionTolerance = 0.0;
+			}
+		}
+
 		if ( ! DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
 			ShowWarningError( "GetShadowingInput: The shading transmittance for shading devices changes throughout the year. Choose DetailedSkyDiffuseModeling in the " + cCurrentModuleObject + " object to remove this warning." );
 			ShowContinueError( "Simulation has been reset to use DetailedSkyDiffuseModeling. Simulation continues." );
@@ -565,8 +599,8 @@ namespace SolarShading {
 			}
 		}
 
-		gio::write( OutputFileInits, fmtA ) << "! <Shadowing/Sun Position Calculations> [Annual Simulations], Calculation Method, Value {days}, Allowable Number Figures in Shadow Overlap {}, Polygon Clipping Algorithm, Sky Diffuse Modeling Algorithm";
-		gio::write( OutputFileInits, fmtA ) << "Shadowing/Sun Position Calculations," + cAlphaArgs( 1 ) + ',' + RoundSigDigits( ShadowingCalcFrequency ) + ',' + RoundSigDigits( MaxHCS ) + ',' + cAlphaArgs( 2 ) + ',' + cAlphaArgs( 3 );
+		gio::write( OutputFileInits, fmtA ) << "! <Shadowing/Sun Position Calculations> [Annual Simulations], Calculation Method, Value {days}, Allowable Number Figures in Shadow Overlap {}, Polygon Clipping Algorithm, Sky Diffuse Modeling Algorithm, Sun Position Tolerance {deg}";
+		gio::write( OutputFileInits, fmtA ) << "Shadowing/Sun Position Calculations," + cAlphaArgs( 1 ) + ',' + RoundSigDigits( ShadowingCalcFrequency ) + ',' + RoundSigDigits( MaxHCS ) + ',' + cAlphaArgs( 2 ) + ',' + cAlphaArgs( 3 ) + ',' + RoundSigDigits( SunPositionTolerance, 2 );
 
 	}
 
@@ -578,6 +612,9 @@ namespace SolarShading {
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   February 1998
 		//       MODIFIED       August 2005 JG - Added output variables for energy in J
+		//                      Oct 2026, BackSurfaces and OverlapAreas only hold the windows that use them
+		//                      Oct 2026, surface outward normals copied to SurfOutNormX/Y/Z
+		//                      Oct 2026, ShadowHistory for the Sun Position Tolerance
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -586,6 +623,9 @@ namespace SolarShading {
 
 		// METHODOLOGY EMPLOYED:
 		// Allocation is dependent on the user input file.
+		// BackSurfaces and OverlapAreas are only filled and used for exterior windows with full
+		// interior solar distribution, so they are indexed by BackSurfIndex, which numbers the
+		// window subsurfaces when the distribution is FullInteriorExterior and nothing otherwise.
 
 		// REFERENCES:
 		// na
@@ -612,14 +652,37 @@ namespace SolarShading {
 		// FLOW:
 
 		CTHETA.dimension( TotSurfaces, 0.0 );
+		SurfOutNormX.allocate( TotSurfaces );
+		SurfOutNormY.allocate( TotSurfaces );
+		SurfOutNormZ.allocate( TotSurfaces );
+		for ( SurfLoop = 1; SurfLoop <= TotSurfaces; ++SurfLoop ) {
+			SurfOutNormX( SurfLoop ) = Surface( SurfLoop ).OutNormVec( 1 );
+			SurfOutNormY( SurfLoop ) = Surface( SurfLoop ).OutNormVec( 2 );
+			SurfOutNormZ( SurfLoop ) = Surface( SurfLoop ).OutNormVec( 3 );
+		}
 		SAREA.dimension( TotSurfaces, 0.0 );
 		SurfSunlitArea.dimension( TotSurfaces, 0.0 );
 		SurfSunlitFrac.dimension( TotSurfaces, 0.0 );
+		SurfSunlitReported.dimension( TotSurfaces, false );
 		SunlitFracHR.dimension( 24, TotSurfaces, 0.0 );
 		SunlitFrac.dimension( NumOfTimeStepInHour, 24, TotSurfaces, 0.0 );
 		SunlitFracWithoutReveal.dimension( NumOfTimeStepInHour, 24, TotSurfaces, 0.0 );
-		BackSurfaces.dimension( NumOfTimeStepInHour, 24, MaxBkSurf, TotSurfaces, 0 );
-		OverlapAreas.dimension( NumOfTimeStepInHour, 24, MaxBkSurf, TotSurfaces, 0.0 );
+		BackSurfIndex.dimension( TotSurfaces, 0 );
+		NumBackSurfWindows = 0;
+		if ( SolarDistribution == FullInteriorExterior ) {
+			for ( SurfLoop = 1; SurfLoop <= TotSurfaces; ++SurfLoop ) {
+				if ( Surface( SurfLoop ).BaseSurf == SurfLoop || Surface( SurfLoop ).Construction <= 0 ) continue;
+				if ( ! Construct( Surface( SurfLoop ).Construction ).TypeIsWindow ) continue;
+				BackSurfIndex( SurfLoop ) = ++NumBackSurfWindows;
+			}
+		}
+		BackSurfaces.dimension( NumOfTimeStepInHour, 24, MaxBkSurf, NumBackSurfWindows, 0 );
+		OverlapAreas.dimension( NumOfTimeStepInHour, 24, MaxBkSurf, NumBackSurfWindows, 0.0 );
+		if ( ReuseTimestepShadows ) {
+			ShadowHistory.dimension( TotSurfaces, SurfaceShadowHistory() );
+			ShadowHistoryBackSurfaces.dimension( MaxBkSurf, NumBackSurfWindows, 0 );
+			ShadowHistoryOverlapAreas.dimension( MaxBkSurf, NumBackSurfWindows, 0.0 );
+		}
 		CosIncAngHR.dimension( 24, TotSurfaces, 0.0 );
 		CosIncAng.dimension( NumOfTimeStepInHour, 24, TotSurfaces, 0.0 );
 		AnisoSkyMult.dimension( TotSurfaces, 1.0 ); // For isotropic sky: recalculated in AnisoSkyViewFactors if anisotropic radiance
@@ -818,6 +881,7 @@ namespace SolarShading {
 			if ( Surface( SurfLoop ).ExtSolar ) {
 				SetupOutputVariable( "Surface Outside Face Sunlit Area [m2]", SurfSunlitArea( SurfLoop ), "Zone", "State", Surface( SurfLoop ).Name );
 				SetupOutputVariable( "Surface Outside Face Sunlit Fraction []", SurfSunlitFrac( SurfLoop ), "Zone", "State", Surface( SurfLoop ).Name );
+				SurfSunlitReported( SurfLoop ) = OutputVariableIsStored( Surface( SurfLoop ).Name, "Surface Outside Face Sunlit Area" ) || OutputVariableIsStored( Surface( SurfLoop ).Name, "Surface Outside Face Sunlit Fraction" );
 				SetupOutputVariable( "Surface Outside Face Incident Solar Radiation Rate per Area [W/m2]", QRadSWOutIncident( SurfLoop ), "Zone", "Average", Surface( SurfLoop ).Name );
 				SetupOutputVariable( "Surface Outside Face Incident Beam Solar Radiation Rate per Area [W/m2]", QRadSWOutIncidentBeam( SurfLoop ), "Zone", "Average", Surface( SurfLoop ).Name );
 				SetupOutputVariable( "Surface Outside Face Incident Sky Diffuse Solar Radiation Rate per Area [W/m2]", QRadSWOutIncidentSkyDiffuse( SurfLoop ), "Zone", "Average", Surface( SurfLoop ).Name );
@@ -2454,7 +2518,7 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Legacy Code
 		//       DATE WRITTEN
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, linear indexing of the homogeneous coordinate arrays
 		//       RE-ENGINEERED  Lawrie, Oct 2000
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2487,19 +2551,30 @@ namespace SolarShading {
 		int K; // Vertex number of the overlap
 		int M; // Side number of figure N2
 		int N; // Vertex number of figure N1
+		Array2D< Int64 >::size_type l; // Linear index of side M
 		bool CycleMainLoop; // Sets when to cycle main loop
 		Real64 HFunct;
 
+		//Tuned Linear indexing
+		assert( equal_dimensions( HCX, HCY ) );
+		assert( equal_dimensions( HCX, HCA ) );
+		assert( equal_dimensions( HCX, HCB ) );
+		assert( equal_dimensions( HCX, HCC ) );
+		auto const l2( HCA.index( N2, 1 ) );
+
 		NIN = 0;
 
 		for ( N = 1; N <= N1NumVert; ++N ) {
 
 			CycleMainLoop = false;
+			auto const l1( HCX.index( N1, N ) );
+			Int64 const HCX_N( HCX[ l1 ] );
+			Int64 const HCY_N( HCY[ l1 ] );
 
 			// Eliminate cases where vertex N is to the left of side M.
 
-			for ( M = 1; M <= N2NumVert; ++M ) {
-				HFunct = HCX( N1, N ) * HCA( N2, M ) + HCY( N1, N ) * HCB( N2, M ) + HCC( N2, M );
+			for ( M = 1, l = l2; M <= N2NumVert; ++M, ++l ) {
+				HFunct = HCX_N * HCA[ l ] + HCY_N * HCB[ l ] + HCC[ l ];
 				if ( HFunct > 0.0 ) {
 					CycleMainLoop = true; // Set to cycle to the next value of N
 					break; // M DO loop
@@ -2513,7 +2588,7 @@ namespace SolarShading {
 
 			if ( NumVerticesOverlap != 0 ) {
 				for ( K = 1; K <= NumVerticesOverlap; ++K ) {
-					if ( ( XTEMP( K ) == HCX( N1, N ) ) && ( YTEMP( K ) == HCY( N1, N ) ) ) {
+					if ( ( XTEMP( K ) == HCX_N ) && ( YTEMP( K ) == HCY_N ) ) {
 						CycleMainLoop = true; // Set to cycle to the next value of N
 						break; // K DO loop
 					}
@@ -2524,8 +2599,8 @@ namespace SolarShading {
 			// Record enclosed vertices in temporary arrays.
 
 			++NumVerticesOverlap;
-			XTEMP( NumVerticesOverlap ) = HCX( N1, N );
-			YTEMP( NumVerticesOverlap ) = HCY( N1, N );
+			XTEMP( NumVerticesOverlap ) = HCX_N;
+			YTEMP( NumVerticesOverlap ) = HCY_N;
 
 		}
 
@@ -2544,7 +2619,7 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Legacy Code
 		//       DATE WRITTEN
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, linear indexing of the homogeneous coordinate arrays
 		//       RE-ENGINEERED  Lawrie, Oct 2000
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2586,19 +2661,38 @@ namespace SolarShading {
 		int KK;
 		int M; // Side number of figure NS2
 		int N; // Side number of figure NS1
+		Array2D< Int64 >::size_type l; // Linear index of side M
+
+		//Tuned Linear indexing
+		assert( equal_dimensions( HCX, HCY ) );
+		assert( equal_dimensions( HCX, HCA ) );
+		assert( equal_dimensions( HCX, HCB ) );
+		assert( equal_dimensions( HCX, HCC ) );
+		auto const l2( HCA.index( NS2, 1 ) );
 
 		for ( N = 1; N <= NV1; ++N ) {
-			for ( M = 1; M <= NV2; ++M ) {
+			auto const l1( HCA.index( NS1, N ) );
+			Int64 const HCA_N( HCA[ l1 ] );
+			Int64 const HCB_N( HCB[ l1 ] );
+			Int64 const HCC_N( HCC[ l1 ] );
+			Int64 const HCX_N( HCX[ l1 ] );
+			Int64 const HCY_N( HCY[ l1 ] );
+			Int64 const HCX_N1( HCX[ l1 + 1 ] ); // [ l1 + 1 ] == ( NS1, N + 1 )
+			Int64 const HCY_N1( HCY[ l1 + 1 ] );
+			for ( M = 1, l = l2; M <= NV2; ++M, ++l ) {
 
 				// Eliminate cases where sides N and M do not intersect.
 
-				I1 = HCA( NS1, N ) * HCX( NS2, M ) + HCB( NS1, N ) * HCY( NS2, M ) + HCC( NS1, N );
-				I2 = HCA( NS1, N ) * HCX( NS2, M + 1 ) + HCB( NS1, N ) * HCY( NS2, M + 1 ) + HCC( NS1, N );
+				I1 = HCA_N * HCX[ l ] + HCB_N * HCY[ l ] + HCC_N;
+				I2 = HCA_N * HCX[ l + 1 ] + HCB_N * HCY[ l + 1 ] + HCC_N;
 				if ( I1 >= 0 && I2 >= 0 ) continue;
 				if ( I1 <= 0 && I2 <= 0 ) continue;
 
-				I1 = HCA( NS2, M ) * HCX( NS1, N ) + HCB( NS2, M ) * HCY( NS1, N ) + HCC( NS2, M );
-				I2 = HCA( NS2, M ) * HCX( NS1, N + 1 ) + HCB( NS2, M ) * HCY( NS1, N + 1 ) + HCC( NS2, M );
+				Int64 const HCA_M( HCA[ l ] );
+				Int64 const HCB_M( HCB[ l ] );
+				Int64 const HCC_M( HCC[ l ] );
+				I1 = HCA_M * HCX_N + HCB_M * HCY_N + HCC_M;
+				I2 = HCA_M * HCX_N1 + HCB_M * HCY_N1 + HCC_M;
 				if ( I1 >= 0 && I2 >= 0 ) continue;
 				if ( I1 <= 0 && I2 <= 0 ) continue;
 
@@ -2606,9 +2700,9 @@ namespace SolarShading {
 
 				KK = NV3;
 				++NV3;
-				W = HCB( NS2, M ) * HCA( NS1, N ) - HCA( NS2, M ) * HCB( NS1, N );
-				XUntrunc = ( HCC( NS2, M ) * HCB( NS1, N ) - HCB( NS2, M ) * HCC( NS1, N ) ) / W;
-				YUntrunc = ( HCA( NS2, M ) * HCC( NS1, N ) - HCC( NS2, M ) * HCA( NS1, N ) ) / W;
+				W = HCB_M * HCA_N - HCA_M * HCB_N;
+				XUntrunc = ( HCC_M * HCB_N - HCB_M * HCC_N ) / W;
+				YUntrunc = ( HCA_M * HCC_N - HCC_M * HCA_N ) / W;
 				if ( NV3 > isize( XTEMP ) ) {
 					//        write(outputfiledebug,*) 'nv3=',nv3,' SIZE(xtemp)=',SIZE(xtemp)
 					XTEMP.redimension( isize( XTEMP ) + 10, 0.0 );
@@ -2649,7 +2743,7 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Tyler Hoyt
 		//       DATE WRITTEN   May 4, 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026: edge function evaluated for all vertices in one contiguous pass
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2659,8 +2753,10 @@ namespace SolarShading {
 
 		// METHODOLOGY EMPLOYED:
 		// The Sutherland-Hodgman algorithm for polygon clipping is employed.
-
-		// METHODOLOGY EMPLOYED:
+		// For each clipping edge the subject polygon is first copied and the edge function is
+		// evaluated at all of its vertices in a branch free loop over contiguous (structure of
+		// arrays) storage, which the compiler can vectorize.  The branching pass that emits the
+		// clipped polygon then only looks up the stored values.
 
 		// REFERENCES:
 
@@ -2689,7 +2785,7 @@ namespace SolarShading {
 		int NVTEMP;
 
 		Real64 W; // Normalization factor
-		Real64 HFunct;
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > HFTEMP; // Edge function of the current clipping edge at each vertex
 
 #ifdef EP_Count_Calls
 		++NumClipPoly_Calls;
@@ -2717,24 +2813,33 @@ namespace SolarShading {
 
 		auto l( HCA.index( NS2, 1 ) );
 		for ( int E = 1; E <= NV2; ++E, ++l ) { // Loop over edges of the clipping polygon
-			for ( int P = 1; P <= NVOUT; ++P ) {
-				XTEMP1( P ) = XTEMP( P );
-				YTEMP1( P ) = YTEMP( P );
-			}
-			S = NVOUT;
 			Real64 const HCA_E( HCA[ l ] );
 			Real64 const HCB_E( HCB[ l ] );
 			Real64 const HCC_E( HCC[ l ] );
-			Real64 XTEMP1_S( XTEMP1( S ) );
-			Real64 YTEMP1_S( YTEMP1( S ) );
+			if ( HFTEMP.size() < static_cast< size_type >( MAXHCArrayBounds ) ) HFTEMP.dimension( MAXHCArrayBounds, 0.0 );
+			{ // Contiguous pass: copy the polygon and evaluate the clipping edge function
+				Real64 const * const XT( XTEMP.data() );
+				Real64 const * const YT( YTEMP.data() );
+				Real64 * const XT1( XTEMP1.data() );
+				Real64 * const YT1( YTEMP1.data() );
+				Real64 * const HF( HFTEMP.data() );
+				for ( int P = 0; P < NVOUT; ++P ) {
+					Real64 const X_P( XT[ P ] );
+					Real64 const Y_P( YT[ P ] );
+					XT1[ P ] = X_P;
+					YT1[ P ] = Y_P;
+					HF[ P ] = X_P * HCA_E + Y_P * HCB_E + HCC_E;
+				}
+			}
+			S = NVOUT;
+			Real64 HFunct_S( HFTEMP( S ) );
 			for ( int P = 1; P <= NVOUT; ++P ) {
 				Real64 const XTEMP1_P( XTEMP1( P ) );
 				Real64 const YTEMP1_P( YTEMP1( P ) );
-				HFunct = XTEMP1_P * HCA_E + YTEMP1_P * HCB_E + HCC_E;
+				Real64 const HFunct_P( HFTEMP( P ) );
 				// S is constant within this block
-				if ( HFunct <= 0.0 ) { // Vertex is not in the clipping plane
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
-					if ( HFunct > 0.0 ) { // Test vertex is in the clipping plane
+				if ( HFunct_P <= 0.0 ) { // Vertex is not in the clipping plane
+					if ( HFunct_S > 0.0 ) { // Test vertex is in the clipping plane
 
 						// Find/store the intersection of the clip edge and the line connecting S and P
 						KK = NVTEMP;
@@ -2799,8 +2904,7 @@ namespace SolarShading {
 					}
 
 				} else {
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
-					if ( HFunct <= 0.0 ) { // Test vertex is not in the clipping plane
+					if ( HFunct_S <= 0.0 ) { // Test vertex is not in the clipping plane
 
 						KK = NVTEMP;
 						++NVTEMP;
@@ -2834,8 +2938,7 @@ namespace SolarShading {
 					}
 				}
 				S = P;
-				XTEMP1_S = XTEMP1_P;
-				YTEMP1_S = YTEMP1_P;
+				HFunct_S = HFunct_P;
 			} // end loop over points of subject polygon
 
 			NVOUT = NVTEMP;
@@ -2922,7 +3025,12 @@ namespace SolarShading {
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 
-		maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		if ( NRFIGS > maxNumberOfFigures ) {
+#ifdef _OPENMP
+#pragma omp critical ( SolarShadingMaxFigures )
+#endif
+			maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		}
 
 		NS2 = NNN;
 		for ( I = 1; I <= NRFIGS; ++I ) {
@@ -2985,7 +3093,7 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
 		Real64 DELTAX; // Difference between X coordinates of two vertices
 		Real64 DELTAY; // Difference between Y coordinates of two vertices
 		Real64 SAVES; // Temporary location for exchange of variables
@@ -2999,7 +3107,7 @@ namespace SolarShading {
 		int M; // Number of slopes to be sorted
 		int N; // Vertex number
 		int P; // Location of first slope to be sorted
-		static bool FirstTimeFlag( true );
+		static EP_SHADING_THREAD_LOCAL bool FirstTimeFlag( true );
 
 		if ( FirstTimeFlag ) {
 			SLOPE.allocate( max( 10, MaxVerticesPerSurface + 1 ) );
@@ -3158,15 +3266,20 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyFigures;
 
-			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyFiguresMessage = true;
-			}
+#ifdef _OPENMP
+#pragma omp critical ( SolarShadingOverlapErrors )
+#endif
+			{
+				if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyFiguresMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyFigures.redimension( ++NumTooManyFigures );
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyFigures.redimension( ++NumTooManyFigures );
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 			return;
@@ -3246,30 +3359,40 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyVertices;
 
-			if ( ! TooManyVerticesMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits( MaxHCV ) + "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyVerticesMessage = true;
-			}
+#ifdef _OPENMP
+#pragma omp critical ( SolarShadingOverlapErrors )
+#endif
+			{
+				if ( ! TooManyVerticesMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits( MaxHCV ) + "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyVerticesMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyVertices.redimension( ++NumTooManyVertices );
-				TrackTooManyVertices( NumTooManyVertices ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyVertices( NumTooManyVertices ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyVertices.redimension( ++NumTooManyVertices );
+					TrackTooManyVertices( NumTooManyVertices ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyVertices( NumTooManyVertices ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 		} else if ( NS3 > MaxHCS ) {
 
 			OverlapStatus = TooManyFigures;
 
-			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
-				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
-				TooManyFiguresMessage = true;
-			}
+#ifdef _OPENMP
+#pragma omp critical ( SolarShadingOverlapErrors )
+#endif
+			{
+				if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
+					ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
+					TooManyFiguresMessage = true;
+				}
 
-			if ( DisplayExtraWarnings ) {
-				TrackTooManyFigures.redimension( ++NumTooManyFigures );
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
-				TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				if ( DisplayExtraWarnings ) {
+					TrackTooManyFigures.redimension( ++NumTooManyFigures );
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex1 = CurrentShadowingSurface;
+					TrackTooManyFigures( NumTooManyFigures ).SurfIndex2 = CurrentSurfaceBeingShadowed;
+				}
 			}
 
 		}
@@ -3288,6 +3411,8 @@ namespace SolarShading {
 		//       AUTHOR         Legacy Code
 		//       DATE WRITTEN
 		//       MODIFIED       BG, Nov 2012 - Timestep solar.  DetailedSolarTimestepIntegration
+		//                      Oct 2026 - Optional shading cache (EP_SHADING_CACHE)
+		//                      Oct 2026 - Beam solar reflection factors calculated (and cached) here
 		//       RE-ENGINEERED  Lawrie, Oct 2000
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3295,7 +3420,11 @@ namespace SolarShading {
 		// are calculated for a period of days depending on the input "Shadowing Calculations".
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// When a shading cache folder is given (environment variable EP_SHADING_CACHE), the results
+		// of each period are stored there under a hash of everything they depend on, and later runs
+		// with the same geometry, site, sun positions and shading schedules load them instead.
+		// The beam solar reflection factors, which follow from these results, are calculated and
+		// cached with them.  Detailed timestep integration and complex fenestration are not cached.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
@@ -3305,6 +3434,7 @@ namespace SolarShading {
 		using WindowComplexManager::UpdateComplexWindows;
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::ShadingCacheFolder;
 		using DataGlobals::HourOfDay;
 		using DataGlobals::TimeStep;
 
@@ -3323,6 +3453,8 @@ namespace SolarShading {
 		int iHour; // Hour index number
 		int TS; // TimeStep Loop Counter
 		static bool Once( true );
+		bool UseShadingCache; // TRUE if results are taken from/stored in the shading cache
+		std::uint64_t CacheKey( 0 ); // Shading cache key for this period
 
 		if ( Once ) InitComplexWindows();
 		Once = false;
@@ -3333,6 +3465,13 @@ namespace SolarShading {
 		++NumCalcPerSolBeam_Calls;
 #endif
 
+		// Warm start from the shading cache when these results have been computed before (see ShadingCacheKey)
+		UseShadingCache = ( ! ShadingCacheFolder.empty() && ! DetailedSolarTimestepIntegration && TotComplexWin == 0 );
+		if ( UseShadingCache ) {
+			CacheKey = ShadingCacheKey( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+			if ( ReadShadingCache( CacheKey ) ) return;
+		}
+
 		// Intialize some values for the appropriate period
 		if ( ! DetailedSolarTimestepIntegration ) {
 			SunlitFracHR = 0.0;
@@ -3354,8 +3493,10 @@ namespace SolarShading {
 			CosIncAngHR( HourOfDay, {1,TotSurfaces} ) = 0.0;
 			CosIncAng( TimeStep, HourOfDay, {1,TotSurfaces} ) = 0.0;
 			AOSurf( {1,TotSurfaces} ) = 0.0;
-			BackSurfaces( TimeStep, HourOfDay, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0;
-			OverlapAreas( TimeStep, HourOfDay, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0.0;
+			if ( NumBackSurfWindows > 0 ) {
+				BackSurfaces( TimeStep, HourOfDay, {1,MaxBkSurf}, {1,NumBackSurfWindows} ) = 0;
+				OverlapAreas( TimeStep, HourOfDay, {1,MaxBkSurf}, {1,NumBackSurfWindows} ) = 0.0;
+			}
 			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 				SurfaceWindow( SurfNum ).OutProjSLFracMult( HourOfDay ) = 1.0;
 				SurfaceWindow( SurfNum ).InOutProjSLFracMult( HourOfDay ) = 1.0;
@@ -3383,6 +3524,352 @@ namespace SolarShading {
 			FigureSolarBeamAtTimestep( HourOfDay, TimeStep );
 		}
 
+		// Calculate factors for beam solar reflection
+		if ( CalcSolRefl ) {
+			CalcBeamSolDiffuseReflFactors();
+			CalcBeamSolSpecularReflFactors();
+		}
+
+		if ( UseShadingCache ) WriteShadingCache( CacheKey );
+
+	}
+
+	std::uint64_t
+	ShadingCacheKey(
+		Real64 const AvgEqOfTime, // Average value of Equation of Time for period
+		Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the key under which the results of CalcPerSolarBeam for the current shadowing
+		// period are stored in the shading cache.
+
+		// METHODOLOGY EMPLOYED:
+		// 64 bit FNV-1a hash over everything the beam solar calculations depend on: the
+		// calculation options, site location, average sun position of the period, the shading
+		// geometry (including frames, dividers and reveals) and the shading surface
+		// transmittance schedule values for each hour and time step of the current day.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+		using DataSystemVariables::SutherlandHodgman;
+		using ScheduleManager::LookUpScheduleValue;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::uint64_t const FNVOffsetBasis( 14695981039346656037ULL );
+		std::uint64_t const FNVPrime( 1099511628211ULL );
+		int const CacheVersion( 4 ); // Change when the cached data or its layout changes
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::uint64_t Key( FNVOffsetBasis );
+
+		auto Mix = [ & ]( void const * const Data, std::size_t const NumBytes ) {
+			unsigned char const * const Bytes( static_cast< unsigned char const * >( Data ) );
+			for ( std::size_t I = 0; I < NumBytes; ++I ) {
+				Key ^= Bytes[ I ];
+				Key *= FNVPrime;
+			}
+		};
+		auto MixInt = [ & ]( int const Value ) {
+			Mix( &Value, sizeof( Value ) );
+		};
+		auto MixReal = [ & ]( Real64 const Value ) {
+			Mix( &Value, sizeof( Value ) );
+		};
+
+		MixInt( CacheVersion );
+		MixInt( TotSurfaces );
+		MixInt( NumOfTimeStepInHour );
+		MixInt( MaxBkSurf );
+		MixInt( NumBackSurfWindows );
+		MixInt( MaxHCS );
+		MixInt( SolarDistribution );
+		MixInt( CalcSolRefl );
+		MixInt( SutherlandHodgman );
+		MixInt( DetailedSkyDiffuseAlgorithm );
+		MixInt( ShadingTransmittanceVaries );
+		MixReal( TimeStepZone );
+		MixReal( TS1TimeOffset );
+		MixReal( Latitude );
+		MixReal( Longitude );
+		MixReal( TimeZoneNumber );
+		MixReal( TimeZoneMeridian );
+		MixReal( AvgEqOfTime );
+		MixReal( AvgSinSolarDeclin );
+		MixReal( AvgCosSolarDeclin );
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			MixInt( surface.Sides );
+			for ( int I = 1; I <= surface.Sides; ++I ) {
+				MixReal( surface.Vertex( I ).x );
+				MixReal( surface.Vertex( I ).y );
+				MixReal( surface.Vertex( I ).z );
+			}
+			for ( int I = 1; I <= 3; ++I ) {
+				MixReal( surface.OutNormVec( I ) );
+			}
+			MixInt( surface.Class );
+			MixInt( surface.BaseSurf );
+			MixInt( surface.Zone );
+			MixInt( surface.ExtBoundCond );
+			MixInt( surface.HeatTransSurf );
+			MixInt( surface.ShadowingSurf );
+			MixInt( surface.ExtSolar );
+			MixInt( surface.MirroredSurf );
+			MixInt( surface.IsTransparent );
+			MixReal( surface.Area );
+			MixReal( surface.NetAreaShadowCalc );
+			MixReal( surface.Width );
+			MixReal( surface.Height );
+			MixReal( surface.Azimuth );
+			MixReal( surface.Tilt );
+			MixReal( surface.Reveal );
+			MixInt( surface.Construction );
+			if ( surface.Construction > 0 ) MixReal( Construct( surface.Construction ).TransDiff );
+			if ( CalcSolRefl ) {
+				MixReal( surface.ShadowSurfDiffuseSolRefl );
+				MixReal( surface.ShadowSurfGlazingFrac );
+				MixInt( surface.ShadowSurfGlazingConstruct );
+				MixInt( surface.ShadowSurfPossibleObstruction );
+				MixInt( surface.Shelf );
+				for ( int const ConstrNum : { surface.Construction, surface.ShadowSurfGlazingConstruct } ) {
+					if ( ConstrNum <= 0 ) continue;
+					MixReal( Construct( ConstrNum ).OutsideAbsorpSolar );
+					for ( Real64 const Coef : Construct( ConstrNum ).ReflSolBeamFrontCoef ) {
+						MixReal( Coef );
+					}
+				}
+			}
+			MixInt( surface.FrameDivider );
+			if ( surface.FrameDivider > 0 ) {
+				auto const & frameDivider( FrameDivider( surface.FrameDivider ) );
+				MixReal( frameDivider.FrameWidth );
+				MixReal( frameDivider.FrameProjectionOut );
+				MixReal( frameDivider.FrameProjectionIn );
+				MixReal( frameDivider.DividerWidth );
+				MixReal( frameDivider.DividerProjectionOut );
+				MixReal( frameDivider.DividerProjectionIn );
+				MixInt( frameDivider.HorDividers );
+				MixInt( frameDivider.VertDividers );
+			}
+			if ( SurfaceWindow.allocated() ) MixInt( SurfaceWindow( SurfNum ).OriginalClass );
+			MixInt( surface.SchedShadowSurfIndex );
+			if ( surface.SchedShadowSurfIndex > 0 ) {
+				for ( int iHour = 1; iHour <= 24; ++iHour ) {
+					for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+						MixReal( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS ) );
+					}
+				}
+			}
+		}
+
+		return Key;
+
+	}
+
+	void
+	GetShadingCacheBlocks( std::vector< std::pair< char *, std::size_t > > & Blocks )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the storage of all CalcPerSolarBeam results, in the order they appear in a shading
+		// cache file, so that reading and writing cannot get out of step.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+
+		Blocks.clear();
+		Blocks.emplace_back( reinterpret_cast< char * >( SunlitFracHR.data() ), SunlitFracHR.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( CosIncAngHR.data() ), CosIncAngHR.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SunlitFrac.data() ), SunlitFrac.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SunlitFracWithoutReveal.data() ), SunlitFracWithoutReveal.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( CosIncAng.data() ), CosIncAng.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( BackSurfaces.data() ), BackSurfaces.size() * sizeof( int ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( OverlapAreas.data() ), OverlapAreas.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( WindowRevealStatus.data() ), WindowRevealStatus.size() * sizeof( int ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( CTHETA.data() ), CTHETA.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( AOSurf.data() ), AOSurf.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SAREA.data() ), SAREA.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SUNCOS.data() ), SUNCOS.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SUNCOSHR.data() ), SUNCOSHR.size() * sizeof( Real64 ) );
+		Blocks.emplace_back( reinterpret_cast< char * >( SUNCOSTS.data() ), SUNCOSTS.size() * sizeof( Real64 ) );
+		for ( int SurfNum = 1, SurfNum_end = SurfaceWindow.isize(); SurfNum <= SurfNum_end; ++SurfNum ) {
+			auto & window( SurfaceWindow( SurfNum ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( window.OutProjSLFracMult.data() ), window.OutProjSLFracMult.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( window.InOutProjSLFracMult.data() ), window.InOutProjSLFracMult.size() * sizeof( Real64 ) );
+		}
+		if ( CalcSolRefl ) {
+			Blocks.emplace_back( reinterpret_cast< char * >( ReflFacBmToDiffSolObs.data() ), ReflFacBmToDiffSolObs.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( ReflFacBmToDiffSolGnd.data() ), ReflFacBmToDiffSolGnd.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( ReflFacBmToBmSolObs.data() ), ReflFacBmToBmSolObs.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( CosIncAveBmToBmSolObs.data() ), CosIncAveBmToBmSolObs.size() * sizeof( Real64 ) );
+		}
+		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
+			Blocks.emplace_back( reinterpret_cast< char * >( DifShdgRatioIsoSkyHRTS.data() ), DifShdgRatioIsoSkyHRTS.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( DifShdgRatioHorizHRTS.data() ), DifShdgRatioHorizHRTS.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( WithShdgIsoSky.data() ), WithShdgIsoSky.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( WoShdgIsoSky.data() ), WoShdgIsoSky.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( WithShdgHoriz.data() ), WithShdgHoriz.size() * sizeof( Real64 ) );
+			Blocks.emplace_back( reinterpret_cast< char * >( WoShdgHoriz.data() ), WoShdgHoriz.size() * sizeof( Real64 ) );
+		}
+
+	}
+
+	std::string
+	ShadingCacheFileName( std::uint64_t const Key ) // Shading cache key of the results
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the shading cache file holding the results for a key.
+
+		// Using/Aliasing
+		using DataStringGlobals::pathChar;
+		using DataStringGlobals::altpathChar;
+		using DataSystemVariables::ShadingCacheFolder;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char KeyString[ 17 ];
+
+		std::snprintf( KeyString, sizeof( KeyString ), "%016llx", static_cast< unsigned long long >( Key ) );
+		std::string FileName( ShadingCacheFolder );
+		if ( FileName.back() != pathChar && FileName.back() != altpathChar ) FileName += pathChar;
+		return FileName + "eplusshd_" + KeyString + ".bin";
+
+	}
+
+	bool
+	ReadShadingCache( std::uint64_t const Key ) // Shading cache key of the results
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Loads the results of CalcPerSolarBeam from the shading cache.  Returns false (and leaves
+		// the module data untouched) if there is no usable cache file for the key.
+
+		// METHODOLOGY EMPLOYED:
+		// A cache file is the ShadingCacheMagic tag, the key and the payload size followed
+		// by the raw payload blocks of GetShadingCacheBlocks.  The whole file is read and checked
+		// before anything is copied into the module data.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::vector< std::pair< char *, std::size_t > > Blocks;
+		std::uint64_t FileKey( 0 );
+		std::uint64_t FileSize( 0 );
+		std::size_t PayloadSize( 0 );
+		char Magic[ sizeof( ShadingCacheMagic ) ];
+
+		std::ifstream CacheFile( ShadingCacheFileName( Key ), std::ios::binary );
+		if ( ! CacheFile ) return false;
+
+		GetShadingCacheBlocks( Blocks );
+		for ( auto const & Block : Blocks ) {
+			PayloadSize += Block.second;
+		}
+
+		CacheFile.read( Magic, sizeof( Magic ) );
+		CacheFile.read( reinterpret_cast< char * >( &FileKey ), sizeof( FileKey ) );
+		CacheFile.read( reinterpret_cast< char * >( &FileSize ), sizeof( FileSize ) );
+		if ( ! CacheFile || std::memcmp( Magic, ShadingCacheMagic, sizeof( Magic ) ) != 0 || FileKey != Key || FileSize != PayloadSize ) return false;
+
+		std::vector< char > Payload( PayloadSize );
+		if ( PayloadSize > 0 && ! CacheFile.read( Payload.data(), PayloadSize ) ) return false;
+
+		std::size_t Offset( 0 );
+		for ( auto const & Block : Blocks ) {
+			if ( Block.second > 0 ) std::memcpy( Block.first, Payload.data() + Offset, Block.second );
+			Offset += Block.second;
+		}
+		return true;
+
+	}
+
+	void
+	WriteShadingCache( std::uint64_t const Key ) // Shading cache key of the results
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the results of CalcPerSolarBeam in the shading cache.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is written under a temporary name and then renamed, so runs sharing the cache
+		// folder never see a partially written file (the temporary name includes the process id).  Failures only cost the warm start and are
+		// reported once as a warning.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static bool WarningIssued( false );
+		std::vector< std::pair< char *, std::size_t > > Blocks;
+		std::uint64_t PayloadSize( 0 );
+
+		GetShadingCacheBlocks( Blocks );
+		for ( auto const & Block : Blocks ) {
+			PayloadSize += Block.second;
+		}
+
+		std::string const FileName( ShadingCacheFileName( Key ) );
+#ifdef _WIN32
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( _getpid() ) );
+#else
+		std::string const TempFileName( FileName + ".tmp" + std::to_string( getpid() ) );
+#endif
+		bool WriteOK;
+		{
+			std::ofstream CacheFile( TempFileName, std::ios::binary | std::ios::trunc );
+			CacheFile.write( ShadingCacheMagic, sizeof( ShadingCacheMagic ) );
+			CacheFile.write( reinterpret_cast< char const * >( &Key ), sizeof( Key ) );
+			CacheFile.write( reinterpret_cast< char const * >( &PayloadSize ), sizeof( PayloadSize ) );
+			for ( auto const & Block : Blocks ) {
+				CacheFile.write( Block.first, Block.second );
+			}
+			CacheFile.close();
+			WriteOK = ! CacheFile.fail();
+		}
+		if ( WriteOK ) {
+#ifdef _WIN32
+			std::remove( FileName.c_str() ); // Rename does not replace an existing file on Windows
+#endif
+			WriteOK = ( std::rename( TempFileName.c_str(), FileName.c_str() ) == 0 );
+		}
+		if ( ! WriteOK ) {
+			std::remove( TempFileName.c_str() );
+			if ( ! WarningIssued ) {
+				ShowWarningError( "WriteShadingCache: Could not write shading cache file=\"" + FileName + "\"." );
+				ShowContinueError( "Shading calculations will not be warm started from this period in later runs." );
+				WarningIssued = true;
+			}
+		}
+
 	}
 
 	void
@@ -3448,6 +3935,44 @@ namespace SolarShading {
 
 	}
 
+	void
+	CalcCosIncidence(
+		Array1< Real64 > const & SunCos, // Direction cosines of the sun (or sky patch)
+		Array1< Real64 > & CosInc // Cosine of angle of incidence on each surface
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the cosine of the angle of incidence of the sun's rays on all the surfaces.
+
+		// METHODOLOGY EMPLOYED:
+		// Dot product of the sun direction with the outward normals, which are kept component by
+		// component in contiguous arrays (SurfOutNormX/Y/Z) so the loop is a single SIMD kernel.
+
+		Real64 const SunCos1( SunCos( 1 ) );
+		Real64 const SunCos2( SunCos( 2 ) );
+		Real64 const SunCos3( SunCos( 3 ) );
+		Real64 const * const NormX( SurfOutNormX.data() );
+		Real64 const * const NormY( SurfOutNormY.data() );
+		Real64 const * const NormZ( SurfOutNormZ.data() );
+		Real64 * const Cos( CosInc.data() );
+		int const NumSurfs( TotSurfaces );
+
+#if defined( _OPENMP ) && _OPENMP >= 201307
+#pragma omp simd
+#endif
+		for ( int i = 0; i < NumSurfs; ++i ) {
+			Cos[ i ] = SunCos1 * NormX[ i ] + SunCos2 * NormY[ i ] + SunCos3 * NormZ[ i ];
+		}
+
+	}
+
 	void
 	FigureSolarBeamAtTimestep(
 		int const iHour,
@@ -3458,7 +3983,8 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B.Griffith, derived from CalcPerSolarBeam, Legacy and Lawrie.
 		//       DATE WRITTEN   October 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, surface loops of the detailed sky diffuse ratios done in parallel (OpenMP)
+		//                      Oct 2026, incidence cosines from CalcCosIncidence
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3473,6 +3999,9 @@ namespace SolarShading {
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3506,8 +4035,12 @@ namespace SolarShading {
 
 		if ( SUNCOS( 3 ) < SunIsUpValue ) return;
 
+		CalcCosIncidence( SUNCOS, CTHETA );
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 )
+#endif
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
 			if ( ! DetailedSolarTimestepIntegration ) {
 				if ( iTimeStep == NumOfTimeStepInHour ) CosIncAngHR( iHour, SurfNum ) = CTHETA( SurfNum );
 			} else {
@@ -3518,6 +4051,9 @@ namespace SolarShading {
 
 		SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
 
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( SurfArea )
+#endif
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( Surface( SurfNum ).Area >= 1.e-10 ) {
 				SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
@@ -3540,6 +4076,9 @@ namespace SolarShading {
 		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
 			CosPhi = 1.0 - SUNCOS( 3 );
 
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( Fac1WoShdg, Fac1WithShdg )
+#endif
 			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
 				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
@@ -3558,6 +4097,9 @@ namespace SolarShading {
 				}
 			} // End of surface loop
 
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 )
+#endif
 			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
 				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
@@ -3600,6 +4142,148 @@ namespace SolarShading {
 
 	}
 
+	int
+	BuildShadowCasterTree(
+		std::vector< ShadowCasterTreeNode > const & CasterBox, // Bounding box of each surface (by surface number)
+		int const First, // First position in ShadowCasterOrder to include in the node
+		int const Last // Last position in ShadowCasterOrder to include in the node
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Builds (recursively) the bounding volume hierarchy over the potential shadow casting
+		// surfaces in ShadowCasterOrder(First:Last) and returns the index of the new node.
+
+		// METHODOLOGY EMPLOYED:
+		// The node box is the union of the surface boxes.  Nodes with more than a few surfaces
+		// are split at the median box center along the longest axis of the node box.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxLeafSurfaces( 4 ); // Surfaces per leaf node
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int const NodeNum( ShadowCasterTree.size() ); // Index of the node being built
+		ShadowCasterTreeNode Node;
+		int Middle; // Last position of the first child
+
+		Node = CasterBox[ ShadowCasterOrder[ First ] ];
+		for ( int Pos = First + 1; Pos <= Last; ++Pos ) {
+			auto const & Box( CasterBox[ ShadowCasterOrder[ Pos ] ] );
+			Node.XMin = min( Node.XMin, Box.XMin );
+			Node.YMin = min( Node.YMin, Box.YMin );
+			Node.ZMin = min( Node.ZMin, Box.ZMin );
+			Node.XMax = max( Node.XMax, Box.XMax );
+			Node.YMax = max( Node.YMax, Box.YMax );
+			Node.ZMax = max( Node.ZMax, Box.ZMax );
+		}
+		Node.Left = 0;
+		Node.Right = 0;
+		Node.First = First;
+		Node.Last = Last;
+		ShadowCasterTree.push_back( Node );
+
+		if ( Last - First + 1 <= MaxLeafSurfaces ) return NodeNum;
+
+		Real64 const DX( Node.XMax - Node.XMin );
+		Real64 const DY( Node.YMax - Node.YMin );
+		Real64 const DZ( Node.ZMax - Node.ZMin );
+		Middle = ( First + Last ) / 2;
+		auto const FirstPos( ShadowCasterOrder.begin() + First );
+		auto const MiddlePos( ShadowCasterOrder.begin() + Middle );
+		auto const EndPos( ShadowCasterOrder.begin() + Last + 1 );
+		if ( DX >= DY && DX >= DZ ) {
+			std::nth_element( FirstPos, MiddlePos, EndPos, [&]( int const A, int const B ){ return CasterBox[ A ].XMin + CasterBox[ A ].XMax < CasterBox[ B ].XMin + CasterBox[ B ].XMax; } );
+		} else if ( DY >= DZ ) {
+			std::nth_element( FirstPos, MiddlePos, EndPos, [&]( int const A, int const B ){ return CasterBox[ A ].YMin + CasterBox[ A ].YMax < CasterBox[ B ].YMin + CasterBox[ B ].YMax; } );
+		} else {
+			std::nth_element( FirstPos, MiddlePos, EndPos, [&]( int const A, int const B ){ return CasterBox[ A ].ZMin + CasterBox[ A ].ZMax < CasterBox[ B ].ZMin + CasterBox[ B ].ZMax; } );
+		}
+
+		// Children are appended after this node, so the node is looked up again rather than referenced
+		int const LeftNum( BuildShadowCasterTree( CasterBox, First, Middle ) );
+		int const RightNum( BuildShadowCasterTree( CasterBox, Middle + 1, Last ) );
+		ShadowCasterTree[ NodeNum ].Left = LeftNum;
+		ShadowCasterTree[ NodeNum ].Right = RightNum;
+
+		return NodeNum;
+
+	}
+
+	void
+	GatherPossibleShadowCasters(
+		int const NRS, // Surface number of the potential shadow receiving surface
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & Casters // Casting surfaces that survive the bounding box tests (ascending)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Walks the shadow caster hierarchy and collects the casting surfaces that are not
+		// ruled out for the receiving surface by their bounding boxes.  The survivors still
+		// have to pass CHKGSS.
+
+		// METHODOLOGY EMPLOYED:
+		// A node is skipped when it cannot pass the first or third test of CHKGSS for any of
+		// its surfaces:  its highest point is not above the lowest point of the receiving surface,
+		// or its whole box lies behind the plane of the receiving surface (i.e. outside of the
+		// hemisphere from which the sun can reach the receiving surface).  The plane normal is
+		// formed exactly as in CHKGSS, so the box test is conservative.
+
+		// Using/Aliasing
+		using namespace Vectors;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::vector< int > NodeStack; // Nodes still to be visited
+		Vector AVec; // Vector from vertex 2 to vertex 1 of the receiving surface
+		Vector BVec; // Vector from vertex 2 to vertex 3 of the receiving surface
+		Vector CVec; // Vector perpendicular to the receiving surface at vertex 2
+
+		Casters.clear();
+		if ( ShadowCasterTree.empty() ) return;
+
+		auto const & vertex_R( Surface( NRS ).Vertex );
+		auto const & vertex_R_2( vertex_R( 2 ) );
+		AVec = vertex_R( 1 ) - vertex_R_2;
+		BVec = vertex_R( 3 ) - vertex_R_2;
+		CVec = BVec * AVec;
+
+		NodeStack.push_back( 0 );
+		while ( ! NodeStack.empty() ) {
+			auto const & Node( ShadowCasterTree[ NodeStack.back() ] );
+			NodeStack.pop_back();
+
+			if ( Node.ZMax <= ZMIN ) continue; // No point of any caster is above the receiving surface
+
+			// Largest dot product of the receiving surface normal with any point of the box
+			Real64 const MaxDOTP( CVec.x * ( 0.5 * ( Node.XMin + Node.XMax ) - vertex_R_2.x ) + CVec.y * ( 0.5 * ( Node.YMin + Node.YMax ) - vertex_R_2.y ) + CVec.z * ( 0.5 * ( Node.ZMin + Node.ZMax ) - vertex_R_2.z ) + 0.5 * ( std::abs( CVec.x ) * ( Node.XMax - Node.XMin ) + std::abs( CVec.y ) * ( Node.YMax - Node.YMin ) + std::abs( CVec.z ) * ( Node.ZMax - Node.ZMin ) ) );
+			if ( MaxDOTP < 0.0 ) continue; // Whole box is behind the receiving surface
+
+			if ( Node.Left == 0 ) {
+				for ( int Pos = Node.First; Pos <= Node.Last; ++Pos ) {
+					Casters.push_back( ShadowCasterOrder[ Pos ] );
+				}
+			} else {
+				NodeStack.push_back( Node.Right );
+				NodeStack.push_back( Node.Left );
+			}
+		}
+
+		std::sort( Casters.begin(), Casters.end() );
+
+	}
+
 	void
 	DetermineShadowingCombinations()
 	{
@@ -3609,6 +4293,7 @@ namespace SolarShading {
 		//       DATE WRITTEN
 		//       MODIFIED       LKL; March 2002 -- another missing translation from BLAST's routine
 		//                      FCW; Jan 2003 -- removed line that prevented beam solar through interior windows
+		//                      Oct 2026 -- candidate partners from surface buckets and a bounding box hierarchy
 		//       RE-ENGINEERED  Rick Strand; 1998
 		//                      Linda Lawrie; Oct 2000
 
@@ -3621,6 +4306,11 @@ namespace SolarShading {
 		// As appropriate surfaces are identified, they are placed into the
 		// ShadowComb data structure (module level) with the accompanying lists
 		// of other surface numbers.
+		// Rather than testing every pair of surfaces, subsurfaces are looked up by base surface,
+		// back surfaces by zone, and potential shadow casters are taken from a bounding volume
+		// hierarchy that discards casters which are too low or entirely behind the receiving
+		// surface.  The lists are built in surface number order, so they are the same as
+		// those from the exhaustive search.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
@@ -3652,16 +4342,23 @@ namespace SolarShading {
 		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
 		bool HasWindow; // TRUE if a window is present on receiving surface
 		Real64 ZMIN; // Lowest point on the receiving surface
-		int BackSurfaceNumber; // Back surface number
 		int HTS; // Heat transfer surface number for a receiving surface
 		int GRSNR; // Receiving surface number
 		int GSSNR; // Shadowing surface number
-		int SBSNR; // Subsurface number
 		int NBKS; // Number of back surfaces for a receiving surface
 		int NGSS; // Number of shadowing surfaces for a receiving surface
 		int NSBS; // Number of subsurfaces for a receiving surface
 		bool ShadowingSurf; // True if a receiving surface is a shadowing surface
 		Array1D_bool CastingSurface; // tracking during setup of ShadowComb
+		std::vector< std::vector< int > > SurfacesOnBase; // Surfaces (other than itself) having each surface as base surface
+		std::vector< std::vector< int > > HTSurfacesInZone; // Heat transfer surfaces (except internal mass) in each zone
+		std::vector< ShadowCasterTreeNode > CasterBox; // Bounding box of each potential shadow casting surface
+		std::vector< int > Casters; // Potential shadow casting surfaces for a receiving surface
+		std::size_t OnBasePos; // Position in SurfacesOnBase list of the receiving surface
+		std::size_t CasterPos; // Position in Casters
+		bool FromBase; // TRUE if the current GSSNR has the receiving surface as base surface
+		int MaxZoneNum; // Highest zone number of any surface
+		int SurfNum; // Surface number while sorting surfaces into lists
 
 		static int MaxDim( 0 );
 
@@ -3694,6 +4391,47 @@ namespace SolarShading {
 			return;
 		}
 
+		// Sort the surfaces into lists by base surface and zone, in surface number order
+		SurfacesOnBase.assign( TotSurfaces + 1, std::vector< int >() );
+		MaxZoneNum = 0;
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			MaxZoneNum = max( MaxZoneNum, Surface( SurfNum ).Zone );
+		}
+		HTSurfacesInZone.assign( MaxZoneNum + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( surface.BaseSurf >= 1 && surface.BaseSurf <= TotSurfaces && surface.BaseSurf != SurfNum ) SurfacesOnBase[ surface.BaseSurf ].push_back( SurfNum );
+			if ( surface.HeatTransSurf && surface.Class != SurfaceClass_IntMass && surface.Zone >= 0 ) HTSurfacesInZone[ surface.Zone ].push_back( SurfNum );
+		}
+
+		// Detached shadowing surfaces and base surfaces exposed to the outside environment may shade other base
+		// surfaces.  Casters facing straight up can never pass CHKGSS and are left out of the hierarchy.
+		ShadowCasterTree.clear();
+		ShadowCasterOrder.clear();
+		if ( SolarDistribution != MinimalShadowing ) {
+			CasterBox.assign( TotSurfaces + 1, ShadowCasterTreeNode() );
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & surface( Surface( SurfNum ) );
+				if ( ! ( ( surface.BaseSurf == 0 ) || ( ( surface.BaseSurf == SurfNum ) && ( ( surface.ExtBoundCond == ExternalEnvironment ) || surface.ExtBoundCond == OtherSideCondModeledExt ) ) ) ) continue;
+				if ( surface.OutNormVec( 3 ) > 0.9999 ) continue;
+				auto & Box( CasterBox[ SurfNum ] );
+				auto const & vertex_C( surface.Vertex );
+				Box.XMin = Box.XMax = vertex_C( 1 ).x;
+				Box.YMin = Box.YMax = vertex_C( 1 ).y;
+				Box.ZMin = Box.ZMax = vertex_C( 1 ).z;
+				for ( int I = 2; I <= surface.Sides; ++I ) {
+					Box.XMin = min( Box.XMin, vertex_C( I ).x );
+					Box.YMin = min( Box.YMin, vertex_C( I ).y );
+					Box.ZMin = min( Box.ZMin, vertex_C( I ).z );
+					Box.XMax = max( Box.XMax, vertex_C( I ).x );
+					Box.YMax = max( Box.YMax, vertex_C( I ).y );
+					Box.ZMax = max( Box.ZMax, vertex_C( I ).z );
+				}
+				ShadowCasterOrder.push_back( SurfNum );
+			}
+			if ( ! ShadowCasterOrder.empty() ) BuildShadowCasterTree( CasterBox, 0, ShadowCasterOrder.size() - 1 );
+		}
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
 			ShadowingSurf = Surface( GRSNR ).ShadowingSurf;
@@ -3714,7 +4452,15 @@ namespace SolarShading {
 			NGSS = 0;
 			if ( SolarDistribution != MinimalShadowing ) { // Except when doing simplified exterior shadowing.
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
+				// Merge the surfaces based on GRSNR with the potential casters, keeping surface number order
+				GatherPossibleShadowCasters( GRSNR, ZMIN, Casters );
+				auto const & OnBase( SurfacesOnBase[ GRSNR ] );
+				OnBasePos = 0;
+				CasterPos = 0;
+				while ( OnBasePos < OnBase.size() || CasterPos < Casters.size() ) { // Loop through surfaces that could shade GRSNR
+
+					FromBase = ( CasterPos == Casters.size() ) || ( ( OnBasePos < OnBase.size() ) && ( OnBase[ OnBasePos ] < Casters[ CasterPos ] ) );
+					GSSNR = ( FromBase ? OnBase[ OnBasePos++ ] : Casters[ CasterPos++ ] );
 
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
 					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
@@ -3726,7 +4472,7 @@ namespace SolarShading {
 						if ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) continue;
 					}
 
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
+					if ( FromBase ) { // Shadowing subsurface of receiving surface
 
 						++NGSS;
 						if ( NGSS > MaxGSS ) {
@@ -3734,7 +4480,7 @@ namespace SolarShading {
 						}
 						GSS( NGSS ) = GSSNR;
 
-					} else if ( ( Surface( GSSNR ).BaseSurf == 0 ) || ( ( Surface( GSSNR ).BaseSurf == GSSNR ) && ( ( Surface( GSSNR ).ExtBoundCond == ExternalEnvironment ) || Surface( GSSNR ).ExtBoundCond == OtherSideCondModeledExt ) ) ) { // Detached shadowing surface or | any other base surface exposed to outside environment
+					} else { // Detached shadowing surface or | any other base surface exposed to outside environment
 
 						CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
 						if ( ! CannotShade ) { // Update the shadowing surface data if shading is possible
@@ -3747,20 +4493,17 @@ namespace SolarShading {
 
 					}
 
-				} // ...end of surfaces DO loop (GSSNR)
+				} // ...end of surfaces loop (GSSNR)
 			} else { // Simplified Distribution -- still check for Shading Subsurfaces
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
+				for ( int const SubSurfNum : SurfacesOnBase[ GRSNR ] ) { // Loop through the surfaces based on GRSNR (the only ones which could shade it) ...
 
-					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
-					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // Skip heat transfer subsurfaces of receiving surface
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
-						++NGSS;
-						if ( NGSS > MaxGSS ) {
-							GSS.redimension( MaxGSS *= 2, 0 );
-						}
-						GSS( NGSS ) = GSSNR;
+					if ( Surface( SubSurfNum ).HeatTransSurf ) continue; // Skip heat transfer subsurfaces of receiving surface
+					++NGSS; // Shadowing subsurface of receiving surface
+					if ( NGSS > MaxGSS ) {
+						GSS.redimension( MaxGSS *= 2, 0 );
 					}
+					GSS( NGSS ) = SubSurfNum;
 				}
 
 			} // ...end of check for simplified solar distribution
@@ -3769,11 +4512,9 @@ namespace SolarShading {
 			NSBS = 0;
 			HasWindow = false;
 			//legacy: IF (OSENV(HTS) > 10) WINDOW=.TRUE. -->Note: WINDOW was set true for roof ponds, solar walls, or other zones
-			for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) { // Loop through the surfaces yet again (looking for subsurfaces of GRSNR)...
+			for ( int const SBSNR : SurfacesOnBase[ GRSNR ] ) { // Loop through the subsurfaces of GRSNR...
 
 				if ( ! Surface( SBSNR ).HeatTransSurf ) continue; // Skip non heat transfer subsurfaces
-				if ( SBSNR == GRSNR ) continue; // Surface itself cannot be its own subsurface
-				if ( Surface( SBSNR ).BaseSurf != GRSNR ) continue; // Ignore subsurfaces of other surfaces and other surfaces
 
 				if ( Construct( Surface( SBSNR ).Construction ).TransDiff > 0.0 ) HasWindow = true; // Check for window
 				CHKSBS( HTS, GRSNR, SBSNR ); // Check that the receiving surface completely encloses the subsurface;
@@ -3784,7 +4525,7 @@ namespace SolarShading {
 				}
 				SBS( NSBS ) = SBSNR;
 
-			} // ...end of surfaces DO loop (SBSNR)
+			} // ...end of subsurfaces loop (SBSNR)
 
 			// Check every surface as a back surface
 			NBKS = 0;
@@ -3792,14 +4533,10 @@ namespace SolarShading {
 			//                                        interior solar distribution,
 			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
 
-				for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) { // Loop through surfaces yet again, looking for back surfaces to GRSNR
+				for ( int const BackSurfaceNumber : HTSurfacesInZone[ Surface( GRSNR ).Zone ] ) { // Loop through the heat transfer surfaces of the zone, looking for back surfaces to GRSNR
 
-					if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 					if ( Surface( BackSurfaceNumber ).BaseSurf == GRSNR ) continue; // Skip subsurfaces of this GRSNR
 					if ( BackSurfaceNumber == GRSNR ) continue; // A back surface cannot be GRSNR itself
-					if ( Surface( BackSurfaceNumber ).Zone != Surface( GRSNR ).Zone ) continue; // Skip if back surface not in zone
-
-					if ( Surface( BackSurfaceNumber ).Class == SurfaceClass_IntMass ) continue;
 
 					// Following line removed 1/27/03 by FCW. Was in original code that didn't do beam solar transmitted through
 					// interior windows. Was removed to allow such beam solar but then somehow was put back in.
@@ -3812,7 +4549,7 @@ namespace SolarShading {
 					}
 					BKS( NBKS ) = BackSurfaceNumber;
 
-				} // ...end of surfaces DO loop (BackSurfaceNumber)
+				} // ...end of zone surfaces loop (BackSurfaceNumber)
 
 			}
 
@@ -3846,6 +4583,8 @@ namespace SolarShading {
 		GSS.deallocate();
 		SBS.deallocate();
 		BKS.deallocate();
+		ShadowCasterTree.clear();
+		ShadowCasterOrder.clear();
 
 		shd_stream << "Shadowing Combinations\n";
 		if ( SolarDistribution == MinimalShadowing ) {
@@ -3931,6 +4670,50 @@ namespace SolarShading {
 
 	}
 
+	void
+	InitShadowingThreadScratch()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Allocates the homogeneous coordinate figure arrays and polygon clipping scratch arrays
+		// for the calling thread when SHADOW runs the receiving surfaces in parallel.
+
+		// METHODOLOGY EMPLOYED:
+		// These arrays are thread-private in OpenMP builds.  The master thread has them allocated by
+		// AllocateModuleArrays and DetermineShadowingCombinations; worker threads get copies of the same
+		// size the first time they pick up a receiving surface.
+
+		if ( HCX.allocated() ) return;
+
+		HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCAREA.dimension( 2 * MaxHCS, 0.0 );
+		HCNS.dimension( 2 * MaxHCS, 0 );
+		HCNV.dimension( 2 * MaxHCS, 0 );
+		HCT.dimension( 2 * MaxHCS, 0.0 );
+
+		// Weiler-Atherton
+		MAXHCArrayBounds = 2 * ( MaxVerticesPerSurface + 1 );
+		XTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		XVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		ZVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+
+		// Sutherland-Hodgman
+		ATEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		BTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		CTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+
+	}
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
@@ -3942,6 +4725,8 @@ namespace SolarShading {
 		//       AUTHOR         Legacy Code
 		//       DATE WRITTEN
 		//       MODIFIED       Nov 2003, FCW: modify to do shadowing on shadowing surfaces
+		//                      Oct 2026: receiving surfaces may be shadowed in parallel (OpenMP builds)
+		//                      Oct 2026: time step shadows reused within the Sun Position Tolerance
 		//       RE-ENGINEERED  Lawrie, Oct 2000
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3949,13 +4734,19 @@ namespace SolarShading {
 		// and sunlit areas used in computing the solar beam flux multipliers.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// With a Sun Position Tolerance (TimestepFrequency only), a receiving surface with shading
+		// surfaces or subsurfaces keeps the results of its last shadow calculation while the sun is
+		// within the tolerance of its position then and the transmittance of its scheduled shadowing
+		// surfaces has not changed since.
 
 		// REFERENCES:
 		// BLAST/IBLAST code, original author George Walton
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using ScheduleManager::LookUpScheduleValue;
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3977,10 +4768,10 @@ namespace SolarShading {
 		int NGRS; // Coordinate transformation index
 		int NZ; // Zone Number of surface
 		int NVT;
-		static Array1D< Real64 > XVT; // X Vertices of Shadows
-		static Array1D< Real64 > YVT; // Y vertices of Shadows
-		static Array1D< Real64 > ZVT; // Z vertices of Shadows
-		static bool OneTimeFlag( true );
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVT; // X Vertices of Shadows
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVT; // Y vertices of Shadows
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > ZVT; // Z vertices of Shadows
+		static EP_SHADING_THREAD_LOCAL bool OneTimeFlag( true );
 		int HTS; // Heat transfer surface number of the general receiving surface
 		int GRSNR; // Surface number of general receiving surface
 		int NBKS; // Number of back surfaces
@@ -3989,16 +4780,6 @@ namespace SolarShading {
 		Real64 SurfArea; // Surface area. For walls, includes all window frame areas.
 		// For windows, includes divider area
 
-		if ( OneTimeFlag ) {
-			XVT.allocate( MaxVerticesPerSurface + 1 );
-			YVT.allocate( MaxVerticesPerSurface + 1 );
-			ZVT.allocate( MaxVerticesPerSurface + 1 );
-			XVT = 0.0;
-			YVT = 0.0;
-			ZVT = 0.0;
-			OneTimeFlag = false;
-		}
-
 #ifdef EP_Count_Calls
 		if ( iHour == 0 ) {
 			++NumShadow_Calls;
@@ -4009,10 +4790,47 @@ namespace SolarShading {
 
 		SAREA = 0.0;
 
+		// Date the transmittance changes of the scheduled shadowing surfaces for the shadow reuse test
+		bool const ReuseShadows( ReuseTimestepShadows && iHour > 0 && ! CalcSkyDifShading );
+		if ( ReuseShadows ) {
+			++ShadowCalcCount;
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & surface( Surface( SurfNum ) );
+				if ( surface.HeatTransSurf || surface.SchedShadowSurfIndex <= 0 ) continue;
+				Real64 const Trans( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour, TS ) );
+				Real64 const HourlyTrans( LookUpScheduleValue( surface.SchedShadowSurfIndex, iHour ) );
+				auto & history( ShadowHistory( SurfNum ) );
+				if ( Trans != history.Transmittance || HourlyTrans != history.HourlyTransmittance ) {
+					history.Transmittance = Trans;
+					history.HourlyTransmittance = HourlyTrans;
+					history.TransChangeCount = ShadowCalcCount;
+				}
+			}
+		}
+
+		// Receiving surfaces are independent of each other (each one only writes its own SAREA and that of its
+		// subsurfaces), so with OpenMP they are spread over NumberShadingThreads threads, each working in its own
+		// thread-private set of HC figure arrays.
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( XS, YS, ZS, N, NGRS, NZ, NVT, HTS, NBKS, NGSS, NSBS, SurfArea )
+#endif
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
 
 			if ( ! ShadowComb( GRSNR ).UseThisSurf ) continue;
 
+#ifdef _OPENMP
+			InitShadowingThreadScratch();
+#endif
+			if ( OneTimeFlag ) {
+				XVT.allocate( MaxVerticesPerSurface + 1 );
+				YVT.allocate( MaxVerticesPerSurface + 1 );
+				ZVT.allocate( MaxVerticesPerSurface + 1 );
+				XVT = 0.0;
+				YVT = 0.0;
+				ZVT = 0.0;
+				OneTimeFlag = false;
+			}
+
 			SAREA( GRSNR ) = 0.0;
 
 			NZ = Surface( GRSNR ).Zone;
@@ -4035,6 +4853,9 @@ namespace SolarShading {
 			} else if ( ( NGSS <= 0 ) && ( NSBS <= 0 ) ) { // Simple surface--no shaders or subsurfaces
 
 				SAREA( HTS ) = Surface( GRSNR ).NetAreaShadowCalc;
+			} else if ( ReuseShadows && CanReuseShadow( GRSNR ) ) { // Sun and shading as at the last calculation
+
+				ReuseShadowHistory( GRSNR, iHour, TS );
 			} else { // Surface in sun and either shading surfaces or subsurfaces present (or both)
 
 				NGRS = Surface( GRSNR ).BaseSurf;
@@ -4081,6 +4902,8 @@ namespace SolarShading {
 
 				SAREA( HTS ) = min( SAREA( HTS ), SurfArea );
 
+				if ( ReuseShadows ) SaveShadowHistory( GRSNR, iHour, TS );
+
 			} // ...end of surface in sun/surface with shaders and/or subsurfaces IF-THEN block
 
 			// NOTE:
@@ -4091,6 +4914,114 @@ namespace SolarShading {
 
 	}
 
+	bool
+	CanReuseShadow( int const GRSNR ) // Surface number of the general receiving surface
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines whether the last shadow calculation of a receiving surface still holds: the sun has
+		// moved less than the Sun Position Tolerance since, and none of the surfaces that can shade it
+		// has changed its scheduled transmittance.
+
+		auto const & history( ShadowHistory( GRSNR ) );
+		if ( history.CalcCount == 0 ) return false;
+		if ( SUNCOS( 1 ) * history.SunCos1 + SUNCOS( 2 ) * history.SunCos2 + SUNCOS( 3 ) * history.SunCos3 < CosSunPositionTolerance ) return false;
+
+		auto const & comb( ShadowComb( GRSNR ) );
+		for ( int I = 1; I <= comb.NumGenSurf; ++I ) {
+			if ( ShadowHistory( comb.GenSurf( I ) ).TransChangeCount > history.CalcCount ) return false;
+		}
+		return true;
+
+	}
+
+	void
+	SaveShadowHistory(
+		int const GRSNR, // Surface number of the general receiving surface
+		int const iHour, // Hour index
+		int const TS // Time Step
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the results of the shadow calculation of a receiving surface and its subsurfaces
+		// just done for the time step, for ReuseShadowHistory.
+
+		auto & history( ShadowHistory( GRSNR ) );
+		history.CalcCount = ShadowCalcCount;
+		history.SunCos1 = SUNCOS( 1 );
+		history.SunCos2 = SUNCOS( 2 );
+		history.SunCos3 = SUNCOS( 3 );
+		history.SunlitArea = SAREA( GRSNR );
+
+		auto const & comb( ShadowComb( GRSNR ) );
+		for ( int I = 1; I <= comb.NumSubSurf; ++I ) {
+			int const SubSurfNum( comb.SubSurf( I ) );
+			auto & subHistory( ShadowHistory( SubSurfNum ) );
+			subHistory.SunlitArea = SAREA( SubSurfNum );
+			subHistory.SunlitFracWithoutReveal = SunlitFracWithoutReveal( TS, iHour, SubSurfNum );
+			subHistory.RevealStatus = WindowRevealStatus( TS, iHour, SubSurfNum );
+			int const BkSurfIndex( BackSurfIndex( SubSurfNum ) );
+			if ( BkSurfIndex > 0 ) {
+				for ( int JBKS = 1; JBKS <= MaxBkSurf; ++JBKS ) {
+					ShadowHistoryBackSurfaces( JBKS, BkSurfIndex ) = BackSurfaces( TS, iHour, JBKS, BkSurfIndex );
+					ShadowHistoryOverlapAreas( JBKS, BkSurfIndex ) = OverlapAreas( TS, iHour, JBKS, BkSurfIndex );
+				}
+			}
+		}
+
+	}
+
+	void
+	ReuseShadowHistory(
+		int const GRSNR, // Surface number of the general receiving surface
+		int const iHour, // Hour index
+		int const TS // Time Step
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the shadow results of a receiving surface and its subsurfaces for the time step from
+		// its last shadow calculation (see CanReuseShadow).
+
+		SAREA( GRSNR ) = ShadowHistory( GRSNR ).SunlitArea;
+
+		auto const & comb( ShadowComb( GRSNR ) );
+		for ( int I = 1; I <= comb.NumSubSurf; ++I ) {
+			int const SubSurfNum( comb.SubSurf( I ) );
+			auto const & subHistory( ShadowHistory( SubSurfNum ) );
+			SAREA( SubSurfNum ) = subHistory.SunlitArea;
+			SunlitFracWithoutReveal( TS, iHour, SubSurfNum ) = subHistory.SunlitFracWithoutReveal;
+			WindowRevealStatus( TS, iHour, SubSurfNum ) = subHistory.RevealStatus;
+			int const BkSurfIndex( BackSurfIndex( SubSurfNum ) );
+			if ( BkSurfIndex > 0 ) {
+				for ( int JBKS = 1; JBKS <= MaxBkSurf; ++JBKS ) {
+					BackSurfaces( TS, iHour, JBKS, BkSurfIndex ) = ShadowHistoryBackSurfaces( JBKS, BkSurfIndex );
+					OverlapAreas( TS, iHour, JBKS, BkSurfIndex ) = ShadowHistoryOverlapAreas( JBKS, BkSurfIndex );
+				}
+			}
+		}
+
+	}
+
 	void
 	SHDBKS(
 		int const NGRS, // Number of the general receiving surface
@@ -4138,10 +5069,10 @@ namespace SolarShading {
 		int N;
 		int NVR;
 		int NVT; // Number of vertices of back surface
-		static Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
-		static Array1D< Real64 > YVT; // back surfaces projected into system
-		static Array1D< Real64 > ZVT; // relative to receiving surface
-		static bool OneTimeFlag( true );
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVT; // back surfaces projected into system
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > ZVT; // relative to receiving surface
+		static EP_SHADING_THREAD_LOCAL bool OneTimeFlag( true );
 		int BackSurfaceNumber;
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
@@ -4281,10 +5212,10 @@ namespace SolarShading {
 		int GSSNR; // General shadowing surface number
 		int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
 		// multiple overlaps (unless there was an error)
-		static Array1D< Real64 > XVT;
-		static Array1D< Real64 > YVT;
-		static Array1D< Real64 > ZVT;
-		static bool OneTimeFlag( true );
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVT;
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVT;
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > ZVT;
+		static EP_SHADING_THREAD_LOCAL bool OneTimeFlag( true );
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
@@ -4532,6 +5463,7 @@ namespace SolarShading {
 		int JBKS; // Counter of back surfaces with non-zero overlap with HTSS
 		int JBKSbase; // Back base surface counter
 		int BackSurfNum; // Back surface number
+		int BkSurfIndex; // Index of HTSS in BackSurfaces and OverlapAreas
 		Real64 OverlapArea; // Overlap area (m2)
 
 		bool UseSimpleDistribution; // TRUE means simple interior solar distribution
@@ -4589,6 +5521,8 @@ namespace SolarShading {
 
 			// Check for array space.
 			if ( FSBSHC + NBKSHC > MaxHCS ) UseSimpleDistribution = true;
+			BkSurfIndex = BackSurfIndex( HTSS );
+			if ( BkSurfIndex == 0 ) UseSimpleDistribution = true; // No storage for the back surfaces of this window
 
 			if ( ! UseSimpleDistribution ) { // Compute overlaps
 
@@ -4625,16 +5559,16 @@ namespace SolarShading {
 						++JBKS;
 						if ( Surface( BackSurfNum ).BaseSurf == BackSurfNum ) JBKSbase = JBKS;
 						if ( JBKS <= MaxBkSurf ) {
-							BackSurfaces( TS, iHour, JBKS, HTSS ) = BackSurfNum;
+							BackSurfaces( TS, iHour, JBKS, BkSurfIndex ) = BackSurfNum;
 							// Remove following IF check: multiplying by sunlit fraction in the following is incorrect
 							// (FCW, 6/28/02)
 							//IF (WindowRevealStatus(HTSS,IHOUR,TS) == WindowShadedOnlyByReveal) THEN
 							//  OverlapArea = OverlapArea*(SAREA(HTSS)/Surface(HTSS)%Area)
 							//ENDIF
-							OverlapAreas( TS, iHour, JBKS, HTSS ) = OverlapArea * SurfaceWindow( HTSS ).GlazedFrac;
+							OverlapAreas( TS, iHour, JBKS, BkSurfIndex ) = OverlapArea * SurfaceWindow( HTSS ).GlazedFrac;
 							// If this is a subsurface, subtract its overlap area from the base surface
 							if ( Surface( BackSurfNum ).BaseSurf != BackSurfNum && JBKSbase != 0 ) {
-								OverlapAreas( TS, iHour, JBKSbase, HTSS ) = max( 0.0, OverlapAreas( TS, iHour, JBKSbase, HTSS ) - OverlapAreas( TS, iHour, JBKS, HTSS ) );
+								OverlapAreas( TS, iHour, JBKSbase, BkSurfIndex ) = max( 0.0, OverlapAreas( TS, iHour, JBKSbase, BkSurfIndex ) - OverlapAreas( TS, iHour, JBKS, BkSurfIndex ) );
 							}
 						}
 					}
@@ -6024,14 +6958,15 @@ namespace SolarShading {
 
 							for ( IBack = 1; IBack <= MaxBkSurf; ++IBack ) {
 
-								BackSurfNum = BackSurfaces( TimeStep, HourOfDay, IBack, SurfNum );
+								if ( BackSurfIndex( SurfNum ) == 0 ) break; // Window has no irradiated back surfaces
+								BackSurfNum = BackSurfaces( TimeStep, HourOfDay, IBack, BackSurfIndex( SurfNum ) );
 
 								if ( BackSurfNum == 0 ) break; // No more irradiated back surfaces for this exterior window
 								ConstrNumBack = Surface( BackSurfNum ).Construction;
 								NBackGlass = Construct( ConstrNumBack ).TotGlassLayers;
 								// Irradiated (overlap) area for this back surface, projected onto window plane
 								// (includes effect of shadowing on exterior window)
-								AOverlap = OverlapAreas( TimeStep, HourOfDay, IBack, SurfNum );
+								AOverlap = OverlapAreas( TimeStep, HourOfDay, IBack, BackSurfIndex( SurfNum ) );
 								BOverlap = TBm * AOverlap * CosInc; //[m2]
 
 								if ( Construct( ConstrNumBack ).TransDiff <= 0.0 ) {
@@ -6500,7 +7435,8 @@ namespace SolarShading {
 
 							for ( IBack = 1; IBack <= MaxBkSurf; ++IBack ) {
 
-								BackSurfNum = BackSurfaces( TimeStep, HourOfDay, IBack, SurfNum );
+								if ( BackSurfIndex( SurfNum ) == 0 ) break; // Window has no irradiated back surfaces
+								BackSurfNum = BackSurfaces( TimeStep, HourOfDay, IBack, BackSurfIndex( SurfNum ) );
 
 								if ( BackSurfNum == 0 ) break; // No more irradiated back surfaces for this exterior window
 								if ( SurfaceWindow( IBack ).WindowModelType != WindowEQLModel ) continue; // only EQL back window is allowed
@@ -6509,7 +7445,7 @@ namespace SolarShading {
 								NBackGlass = Construct( ConstrNumBack ).TotGlassLayers;
 								// Irradiated (overlap) area for this back surface, projected onto window plane
 								// (includes effect of shadowing on exterior window)
-								AOverlap = OverlapAreas( TimeStep, HourOfDay, IBack, SurfNum );
+								AOverlap = OverlapAreas( TimeStep, HourOfDay, IBack, BackSurfIndex( SurfNum ) );
 								BOverlap = TBm * AOverlap * CosInc; //[m2]
 
 								if ( Construct( ConstrNumBack ).TransDiff <= 0.0 ) {
@@ -6961,6 +7897,7 @@ namespace SolarShading {
 		//                       CalcBeamSolSpecularReflFactors
 		//                      Jan 2004, FCW: call CalcDayltgCoefficients if storm window status on
 		//                       any window has changed
+		//                      Oct 2026, timed as a region of the timing profile
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -7009,6 +7946,8 @@ namespace SolarShading {
 		Real64 EqTime;
 		//not used INTEGER SurfNum
 
+		DataTimings::ProfileTimer const profileTimer( "PerformSolarCalculations" ); // Region of the timing profile
+
 		// Calculate sky diffuse shading
 
 		if ( BeginSimFlag ) {
@@ -7056,14 +7995,10 @@ namespace SolarShading {
 				AvgCosSolarDeclin = std::sqrt( 1.0 - pow_2( AvgSinSolarDeclin ) );
 			}
 
-			CalcPerSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+			CalcPerSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin ); // Includes the beam solar reflection factors
 
-			// Calculate factors for solar reflection
-			if ( CalcSolRefl ) {
-				CalcBeamSolDiffuseReflFactors();
-				CalcBeamSolSpecularReflFactors();
-				if ( BeginSimFlag ) CalcSkySolDiffuseReflFactors();
-			}
+			// Calculate factors for sky solar reflection
+			if ( CalcSolRefl && BeginSimFlag ) CalcSkySolDiffuseReflFactors();
 
 			//  Calculate daylighting coefficients
 			CalcDayltgCoefficients();
@@ -7133,8 +8068,8 @@ namespace SolarShading {
 		int NS1; // Locations in homogeneous coordinate array
 		int NS2;
 		// note, below dimensions not changed because subsurface still max 4
-		Array1D< Real64 > XVT( 5 ); // Projected X coordinates of vertices
-		Array1D< Real64 > YVT( 5 ); // Projected Y coordinates of vertices
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVT( 5 ); // Projected X coordinates of vertices
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVT( 5 ); // Projected Y coordinates of vertices
 		bool RevealStatusSet; // Used to control flow through this subroutine.
 		// Certain operations performed only if reveal status not yet set.
 		int RevealStatus; // Status of the reveal, takes the parameter values above
@@ -8143,6 +9078,8 @@ namespace SolarShading {
 		//                         error caused underestimate of IR from ground and shadowing surfaces.
 		//                      Dec 2002; LKL: Sky Radiance Distribution now only anisotropic
 		//                      Nov 2003: FCW: modify to do sky solar shading of shadowing surfaces
+		//                      Oct 2026: adaptive azimuth sampling of the sky patches; surfaces without shadowing
+		//                         combinations skip the shadow calculation; patch sums done in parallel (OpenMP)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -8183,12 +9120,17 @@ namespace SolarShading {
 
 		// Using/Aliasing
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
+#ifdef _OPENMP
+		using DataSystemVariables::NumberShadingThreads;
+#endif
 
 		// Locals
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		int const NPhi( 6 ); // Number of altitude angle steps for sky integration
 		int const NTheta( 24 ); // Number of azimuth angle steps for sky integration
+		int const NThetaCoarse( 4 ); // Azimuth steps between the patches that are always shadowed (power of 2 dividing NTheta)
 		Real64 const Eps( 1.e-10 ); // Small number
+		Real64 const FracIllumTolerance( 1.e-6 ); // Sunlit fraction difference below which a patch interval is not refined
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -8213,6 +9155,23 @@ namespace SolarShading {
 		Real64 Fac1WithShdg; // Intermediate calculation factor, with shading
 		Real64 SurfArea; // Surface area (m2)
 		bool ShadowingSurf; // True if surface is a shadowing surface
+		int IStep; // Azimuth steps between patches at the current refinement level
+		int IThetaLeft; // Azimuth index of the patch at the start of an interval being refined
+		int IThetaRight; // Azimuth index of the patch at the end of an interval being refined
+		int IShaded; // Index into ShadedSurfs
+		int NumShaded; // Number of surfaces that need the shadow calculation
+		bool ShadowPatch; // True if the shadow calculation is done for a patch
+		bool SunUp; // True if a patch is in front of a surface
+		Real64 CosInc; // Cosine of angle of incidence of radiation from a patch on a surface
+		Real64 SunlitArea; // Sunlit area of a surface without shadowing combinations (m2)
+		Array1D< Real64 > PatchSunCos1( NTheta ); // X direction cosine of the patches of an altitude band
+		Array1D< Real64 > PatchSunCos2( NTheta ); // Y direction cosine of the patches of an altitude band
+		Array1D_bool PatchResolved( NTheta ); // True once the sunlit fractions of a patch are known
+		Array1D_bool SkyDifSurf; // True for surfaces that take part in the sky integration
+		Array1D_int ShadedIndex; // Index into ShadedSurfs, 0 for surfaces that need no shadow calculation
+		std::vector< int > ShadedSurfs; // Surfaces that need the shadow calculation
+		Array2D< Real64 > PatchFracIlluminated; // Sunlit fraction of the shaded surfaces by patch of an altitude band
+		Array2D< Real64 > PatchCosInc; // Cosine of angle of incidence on the shaded surfaces by patch of an altitude band
 		//REAL(r64), ALLOCATABLE, DIMENSION(:) :: WithShdgIsoSky     ! Diffuse solar irradiance from isotropic
 		//                                                          ! sky on surface, with shading
 		//REAL(r64), ALLOCATABLE, DIMENSION(:) :: WoShdgIsoSky       ! Diffuse solar from isotropic
@@ -8267,40 +9226,111 @@ namespace SolarShading {
 		DThetaDPhi = DTheta * DPhi;
 		PhiMin = 0.5 * DPhi; // 7.5 deg for DPhi = 15 deg
 
+		// Surfaces that take part in the sky integration. Of these, base surfaces without shadowing combinations
+		// or subsurfaces are either fully sunlit by a patch or facing away from it, so their sunlit fraction follows
+		// from the angle of incidence alone. Only the others (ShadedSurfs) need the shadow calculation.
+		SkyDifSurf.dimension( TotSurfaces, false );
+		ShadedIndex.dimension( TotSurfaces, 0 );
+		ShadedSurfs.clear();
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+			SkyDifSurf( SurfNum ) = true;
+			if ( ShadowComb( SurfNum ).UseThisSurf && ShadowComb( SurfNum ).NumGenSurf == 0 && ShadowComb( SurfNum ).NumSubSurf == 0 ) continue;
+			ShadedSurfs.push_back( SurfNum );
+			ShadedIndex( SurfNum ) = ShadedSurfs.size();
+		}
+		NumShaded = ShadedSurfs.size();
+		if ( NumShaded > 0 ) {
+			PatchFracIlluminated.allocate( NTheta, NumShaded );
+			PatchCosInc.allocate( NTheta, NumShaded );
+		}
+
 		for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) { // Loop over patch altitude values
 			Phi = PhiMin + ( IPhi - 1 ) * DPhi; // 7.5,22.5,37.5,52.5,67.5,82.5 for NPhi = 6
 			SUNCOS( 3 ) = std::sin( Phi );
 			CosPhi = std::cos( Phi );
 
-			for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) { // Loop over patch azimuth values
+			for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) { // Patch directions of this altitude band
 				Theta = ( ITheta - 1 ) * DTheta; // 0,15,30,....,330,345 for NTheta = 24
-				SUNCOS( 1 ) = CosPhi * std::cos( Theta );
-				SUNCOS( 2 ) = CosPhi * std::sin( Theta );
+				PatchSunCos1( ITheta ) = CosPhi * std::cos( Theta );
+				PatchSunCos2( ITheta ) = CosPhi * std::sin( Theta );
+				for ( IShaded = 1; IShaded <= NumShaded; ++IShaded ) {
+					SurfNum = ShadedSurfs[ IShaded - 1 ];
+					PatchCosInc( ITheta, IShaded ) = PatchSunCos1( ITheta ) * Surface( SurfNum ).OutNormVec( 1 ) + PatchSunCos2( ITheta ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
+				}
+			}
 
-				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Cosine of angle of incidence on surface of solar
-					// radiation from patch
-					ShadowingSurf = Surface( SurfNum ).ShadowingSurf;
+			// Adaptive azimuth sampling: every NThetaCoarse-th patch is shadowed, then each interval is halved. The
+			// patch in the middle of an interval is only shadowed if a shaded surface's sunlit fraction differs
+			// between the ends of the interval or the surface turns towards or away from the sky there; otherwise
+			// the sunlit fractions at the ends are carried over to it.
+			PatchResolved = false;
+			for ( IStep = NThetaCoarse; IStep >= 1; IStep /= 2 ) {
+				for ( ITheta = 1; ITheta <= NTheta; ITheta += IStep ) {
+					if ( PatchResolved( ITheta ) || NumShaded == 0 ) continue;
+
+					ShadowPatch = ( IStep == NThetaCoarse );
+					if ( ! ShadowPatch ) {
+						IThetaLeft = ITheta - IStep;
+						IThetaRight = ( ITheta + IStep > NTheta ) ? ITheta + IStep - NTheta : ITheta + IStep;
+						for ( IShaded = 1; IShaded <= NumShaded; ++IShaded ) {
+							SunUp = ( PatchCosInc( ITheta, IShaded ) >= SunIsUpValue );
+							if ( std::abs( PatchFracIlluminated( IThetaLeft, IShaded ) - PatchFracIlluminated( IThetaRight, IShaded ) ) > FracIllumTolerance || SunUp != ( PatchCosInc( IThetaLeft, IShaded ) >= SunIsUpValue ) || SunUp != ( PatchCosInc( IThetaRight, IShaded ) >= SunIsUpValue ) ) {
+								ShadowPatch = true;
+								break;
+							}
+						}
+					}
 
-					if ( ! ShadowingSurf && ! Surface( SurfNum ).HeatTransSurf ) continue;
+					if ( ShadowPatch ) {
+						SUNCOS( 1 ) = PatchSunCos1( ITheta );
+						SUNCOS( 2 ) = PatchSunCos2( ITheta );
 
-					CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
-				}
+						CalcCosIncidence( SUNCOS, CTHETA ); // Cosine of angle of incidence on surface of solar radiation from patch
 
-				SHADOW( 0, 0 );
+						SHADOW( 0, 0 );
 
-				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-					ShadowingSurf = Surface( SurfNum ).ShadowingSurf;
+						for ( IShaded = 1; IShaded <= NumShaded; ++IShaded ) {
+							SurfNum = ShadedSurfs[ IShaded - 1 ];
+							SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
+							if ( SurfArea > Eps ) {
+								PatchFracIlluminated( ITheta, IShaded ) = SAREA( SurfNum ) / SurfArea;
+							} else {
+								PatchFracIlluminated( ITheta, IShaded ) = SAREA( SurfNum ) / ( SurfArea + Eps );
+							}
+						}
+					} else {
+						for ( IShaded = 1; IShaded <= NumShaded; ++IShaded ) {
+							PatchFracIlluminated( ITheta, IShaded ) = 0.5 * ( PatchFracIlluminated( IThetaLeft, IShaded ) + PatchFracIlluminated( IThetaRight, IShaded ) );
+						}
+					}
+					PatchResolved( ITheta ) = true;
+				}
+			}
+
+			// Sum the band into the irradiance totals; each surface only adds to its own totals.
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( NumberShadingThreads ) if ( NumberShadingThreads > 1 ) private( ITheta, CosInc, Fac1WoShdg, SurfArea, SunlitArea, FracIlluminated, Fac1WithShdg )
+#endif
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! SkyDifSurf( SurfNum ) ) continue;
 
-					if ( ! ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+				for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) {
+					CosInc = PatchSunCos1( ITheta ) * Surface( SurfNum ).OutNormVec( 1 ) + PatchSunCos2( ITheta ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
 
-					if ( CTHETA( SurfNum ) < 0.0 ) continue;
+					if ( CosInc < 0.0 ) continue;
 
-					Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
-					SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
-					if ( SurfArea > Eps ) {
-						FracIlluminated = SAREA( SurfNum ) / SurfArea;
+					Fac1WoShdg = CosPhi * DThetaDPhi * CosInc;
+					if ( ShadedIndex( SurfNum ) > 0 ) {
+						FracIlluminated = PatchFracIlluminated( ITheta, ShadedIndex( SurfNum ) );
 					} else {
-						FracIlluminated = SAREA( SurfNum ) / ( SurfArea + Eps );
+						SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
+						SunlitArea = ( CosInc < SunIsUpValue ) ? 0.0 : SurfArea;
+						if ( SurfArea > Eps ) {
+							FracIlluminated = SunlitArea / SurfArea;
+						} else {
+							FracIlluminated = SunlitArea / ( SurfArea + Eps );
+						}
 					}
 					Fac1WithShdg = Fac1WoShdg * FracIlluminated;
 					WithShdgIsoSky( SurfNum ) += Fac1WithShdg;
@@ -8311,8 +9341,8 @@ namespace SolarShading {
 						WithShdgHoriz( SurfNum ) += Fac1WithShdg;
 						WoShdgHoriz( SurfNum ) += Fac1WoShdg;
 					}
-				} // End of surface loop
-			} // End of Theta loop
+				} // End of Theta loop
+			} // End of surface loop
 		} // End of Phi loop
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -8556,12 +9586,12 @@ namespace SolarShading {
 		Real64 FracShFDin; // Fraction of glazing that illuminates frame and divider
 		//  inside projections with beam radiation
 
-		Array1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > WinNorm( 3 ); // Window outward normal unit vector
 		Real64 ThWin; // Azimuth angle of WinNorm
-		Array1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > SunPrime( 3 ); // Projection of sun vector onto plane (perpendicular to
 		//  window plane) determined by WinNorm and vector along
 		//  baseline of window
-		Array1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
+		static EP_SHADING_THREAD_LOCAL Array1D< Real64 > WinNormCrossBase( 3 ); // Cross product of WinNorm and vector along window baseline
 
 		if ( FrameDivider( FrDivNum ).FrameProjectionOut == 0.0 && FrameDivider( FrDivNum ).FrameProjectionIn == 0.0 && FrameDivider( FrDivNum ).DividerProjectionOut == 0.0 && FrameDivider( FrDivNum ).DividerProjectionIn == 0.0 ) return;
 
@@ -9152,7 +10182,7 @@ namespace SolarShading {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   April 2000
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, skip surfaces whose sunlit report variables are not stored
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -9190,6 +10220,7 @@ namespace SolarShading {
 		int RepCol; // the column of the predefined report
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ! SurfSunlitReported( SurfNum ) ) continue; // Report variables not stored
 			SurfSunlitFrac( SurfNum ) = SunlitFrac( TimeStep, HourOfDay, SurfNum );
 			SurfSunlitArea( SurfNum ) = SunlitFrac( TimeStep, HourOfDay, SurfNum ) * Surface( SurfNum ).Area;
 		}
@@ -9223,7 +10254,7 @@ namespace SolarShading {
 		if ( RepCol != 0 ) {
 			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 				if ( Surface( SurfNum ).Class == SurfaceClass_Window ) {
-					PreDefTableEntry( RepCol, Surface( SurfNum ).Name, SurfSunlitFrac( SurfNum ) );
+					PreDefTableEntry( RepCol, Surface( SurfNum ).Name, SunlitFrac( TimeStep, HourOfDay, SurfNum ) );
 				}
 			}
 		}
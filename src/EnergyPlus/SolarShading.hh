@@ -2,7 +2,11 @@
 #define SolarShading_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -14,6 +18,15 @@
 #include <DataBSDFWindow.hh>
 #include <DataVectorTypes.hh>
 
+// When built with OpenMP the receiving-surface loop in SHADOW is partitioned across threads, so the
+// homogeneous coordinate (HC) figure arrays and the other polygon scratch state used by the overlap
+// routines must be private to each thread.
+#ifdef _OPENMP
+#define EP_SHADING_THREAD_LOCAL thread_local
+#else
+#define EP_SHADING_THREAD_LOCAL
+#endif
+
 namespace EnergyPlus {
 
 namespace SolarShading {
@@ -52,72 +65,81 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	extern int MaxHCS; // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	extern int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
+	extern EP_SHADING_THREAD_LOCAL int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
 	extern int MAXHCArrayIncrement; // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	extern int NVS; // Number of vertices of the shadow/clipped surface
-	extern int NumVertInShadowOrClippedSurface;
-	extern int CurrentSurfaceBeingShadowed;
-	extern int CurrentShadowingSurface;
-	extern int OverlapStatus; // Results of overlap calculation:
+	extern EP_SHADING_THREAD_LOCAL int NVS; // Number of vertices of the shadow/clipped surface
+	extern EP_SHADING_THREAD_LOCAL int NumVertInShadowOrClippedSurface;
+	extern EP_SHADING_THREAD_LOCAL int CurrentSurfaceBeingShadowed;
+	extern EP_SHADING_THREAD_LOCAL int CurrentShadowingSurface;
+	extern EP_SHADING_THREAD_LOCAL int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
 	extern Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	extern int FBKSHC; // HC location of first back surface
-	extern int FGSSHC; // HC location of first general shadowing surface
-	extern int FINSHC; // HC location of first back surface overlap
-	extern int FRVLHC; // HC location of first reveal surface
-	extern int FSBSHC; // HC location of first subsurface
-	extern int LOCHCA; // Location of highest data in the HC arrays
-	extern int NBKSHC; // Number of back surfaces in the HC arrays
-	extern int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	extern int NINSHC; // Number of back surface overlaps in the HC arrays
-	extern int NRVLHC; // Number of reveal surfaces in HC array
-	extern int NSBSHC; // Number of subsurfaces in the HC arrays
+	extern Array1D< Real64 > SurfOutNormX; // X components of the surface outward normals (contiguous for CalcCosIncidence)
+	extern Array1D< Real64 > SurfOutNormY; // Y components of the surface outward normals
+	extern Array1D< Real64 > SurfOutNormZ; // Z components of the surface outward normals
+	extern EP_SHADING_THREAD_LOCAL int FBKSHC; // HC location of first back surface
+	extern EP_SHADING_THREAD_LOCAL int FGSSHC; // HC location of first general shadowing surface
+	extern EP_SHADING_THREAD_LOCAL int FINSHC; // HC location of first back surface overlap
+	extern EP_SHADING_THREAD_LOCAL int FRVLHC; // HC location of first reveal surface
+	extern EP_SHADING_THREAD_LOCAL int FSBSHC; // HC location of first subsurface
+	extern EP_SHADING_THREAD_LOCAL int LOCHCA; // Location of highest data in the HC arrays
+	extern EP_SHADING_THREAD_LOCAL int NBKSHC; // Number of back surfaces in the HC arrays
+	extern EP_SHADING_THREAD_LOCAL int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	extern EP_SHADING_THREAD_LOCAL int NINSHC; // Number of back surface overlaps in the HC arrays
+	extern EP_SHADING_THREAD_LOCAL int NRVLHC; // Number of reveal surfaces in HC array
+	extern EP_SHADING_THREAD_LOCAL int NSBSHC; // Number of subsurfaces in the HC arrays
 	extern bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	extern int ShadowingCalcFrequency; // Frequency for Shadowing Calculations
 	extern int ShadowingDaysLeft; // Days left in current shadowing period
+	extern Real64 SunPositionTolerance; // Sun movement (deg) within which a surface keeps its last shadow calculation
+	extern Real64 CosSunPositionTolerance; // Cosine of SunPositionTolerance
+	extern bool ReuseTimestepShadows; // True when time step shadow calculations are reused within SunPositionTolerance
+	extern int ShadowCalcCount; // Number of time step shadow calculations, dates the entries of ShadowHistory
 	extern bool debugging;
 	extern std::ofstream shd_stream; // Shading file stream
-	extern Array1D_int HCNS; // Surface number of back surface HC figures
-	extern Array1D_int HCNV; // Number of vertices of each HC figure
-	extern Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	extern Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	extern EP_SHADING_THREAD_LOCAL Array1D_int HCNS; // Surface number of back surface HC figures
+	extern EP_SHADING_THREAD_LOCAL Array1D_int HCNV; // Number of vertices of each HC figure
+	extern EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	extern EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	extern EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	extern EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	extern EP_SHADING_THREAD_LOCAL Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	extern Array3D_int WindowRevealStatus;
-	extern Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	extern Array1D< Real64 > HCT; // Transmittance of each HC figure
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > HCT; // Transmittance of each HC figure
 	extern Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
 	extern Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	extern Array1D_bool SurfSunlitReported; // True if the sunlit area or fraction of this surface is stored for output
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	extern int NumTooManyFigures;
 	extern int NumTooManyVertices;
 	extern int NumBaseSubSurround;
 	extern Array1D< Real64 > SUNCOS; // Direction cosines of solar position
-	extern Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	extern Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	extern Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	extern Array1D< Real64 > XVS; // X-vertices of the shadow
-	extern Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	extern Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	extern Array1D< Real64 > YVS; // Y-vertices of the shadow
-	extern Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	extern EP_SHADING_THREAD_LOCAL Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	extern EP_SHADING_THREAD_LOCAL Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > XVS; // X-vertices of the shadow
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > YVS; // Y-vertices of the shadow
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	extern Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	extern Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	extern Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	extern Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	extern EP_SHADING_THREAD_LOCAL Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	extern int maxNumberOfFigures;
+	extern char const ShadingCacheMagic[ 8 ]; // Tag at the start of shading cache files
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -150,10 +172,75 @@ namespace SolarShading {
 
 	};
 
+	struct SurfaceShadowHistory // Last time step shadow calculation of a surface (ShadowCalculation Sun Position Tolerance)
+	{
+		// Members
+		int CalcCount; // ShadowCalcCount of the last shadow calculation of the receiving surface (0 = none yet)
+		Real64 SunCos1; // Sun direction cosines of that calculation
+		Real64 SunCos2;
+		Real64 SunCos3;
+		Real64 SunlitArea; // Sunlit area (SAREA) of the surface from the last calculation
+		Real64 SunlitFracWithoutReveal; // Sunlit fraction of a window without the reveal shadow
+		int RevealStatus; // Window reveal status
+		Real64 Transmittance; // Scheduled transmittance of a shadowing surface at the last time step
+		Real64 HourlyTransmittance; // Scheduled transmittance of a shadowing surface for the hour
+		int TransChangeCount; // ShadowCalcCount when the transmittance of the shadowing surface last changed
+
+		// Default Constructor
+		SurfaceShadowHistory() :
+			CalcCount( 0 ),
+			SunCos1( 0.0 ),
+			SunCos2( 0.0 ),
+			SunCos3( 0.0 ),
+			SunlitArea( 0.0 ),
+			SunlitFracWithoutReveal( 0.0 ),
+			RevealStatus( 0 ),
+			Transmittance( -1.0 ),
+			HourlyTransmittance( -1.0 ),
+			TransChangeCount( 0 )
+		{}
+
+	};
+
+	struct ShadowCasterTreeNode // Bounding box node of the hierarchy over potential shadow casting surfaces
+	{
+		// Members
+		Real64 XMin; // Bounding box of all casting surfaces below this node
+		Real64 YMin;
+		Real64 ZMin;
+		Real64 XMax;
+		Real64 YMax;
+		Real64 ZMax;
+		int Left; // Index of the first child node (0 for a leaf)
+		int Right; // Index of the second child node (0 for a leaf)
+		int First; // First position in ShadowCasterOrder covered by this node
+		int Last; // Last position in ShadowCasterOrder covered by this node
+
+		// Default Constructor
+		ShadowCasterTreeNode() :
+			XMin( 0.0 ),
+			YMin( 0.0 ),
+			ZMin( 0.0 ),
+			XMax( 0.0 ),
+			YMax( 0.0 ),
+			ZMax( 0.0 ),
+			Left( 0 ),
+			Right( 0 ),
+			First( 0 ),
+			Last( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	extern Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	extern Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	extern std::vector< ShadowCasterTreeNode > ShadowCasterTree; // Only used while shadowing combinations are determined
+	extern std::vector< int > ShadowCasterOrder; // Casting surface numbers, grouped by tree leaf
+	extern Array1D< SurfaceShadowHistory > ShadowHistory; // Last time step shadow calculation by surface
+	extern Array2D_int ShadowHistoryBackSurfaces; // BackSurfaces of the last shadow calculation by window (BackSurfIndex)
+	extern Array2D< Real64 > ShadowHistoryOverlapAreas; // OverlapAreas of the last shadow calculation by window (BackSurfIndex)
 
 	// Functions
 
@@ -295,6 +382,25 @@ namespace SolarShading {
 		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
 	);
 
+	std::uint64_t
+	ShadingCacheKey(
+		Real64 const AvgEqOfTime, // Average value of Equation of Time for period
+		Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
+	);
+
+	void
+	GetShadingCacheBlocks( std::vector< std::pair< char *, std::size_t > > & Blocks );
+
+	std::string
+	ShadingCacheFileName( std::uint64_t const Key ); // Shading cache key of the results
+
+	bool
+	ReadShadingCache( std::uint64_t const Key ); // Shading cache key of the results
+
+	void
+	WriteShadingCache( std::uint64_t const Key ); // Shading cache key of the results
+
 	void
 	FigureSunCosines(
 		int const iHour,
@@ -304,21 +410,61 @@ namespace SolarShading {
 		Real64 const CosSolarDeclin // value of Cosine of Solar Declination for period
 	);
 
+	void
+	CalcCosIncidence(
+		Array1< Real64 > const & SunCos, // Direction cosines of the sun (or sky patch)
+		Array1< Real64 > & CosInc // Cosine of angle of incidence on each surface
+	);
+
 	void
 	FigureSolarBeamAtTimestep(
 		int const iHour,
 		int const iTimeStep
 	);
 
+	int
+	BuildShadowCasterTree(
+		std::vector< ShadowCasterTreeNode > const & CasterBox, // Bounding box of each surface (by surface number)
+		int const First, // First position in ShadowCasterOrder to include in the node
+		int const Last // Last position in ShadowCasterOrder to include in the node
+	);
+
+	void
+	GatherPossibleShadowCasters(
+		int const NRS, // Surface number of the potential shadow receiving surface
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & Casters // Casting surfaces that survive the bounding box tests (ascending)
+	);
+
 	void
 	DetermineShadowingCombinations();
 
+	void
+	InitShadowingThreadScratch();
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
 		int const TS // Time Step
 	);
 
+	bool
+	CanReuseShadow( int const GRSNR ); // Surface number of the general receiving surface
+
+	void
+	SaveShadowHistory(
+		int const GRSNR, // Surface number of the general receiving surface
+		int const iHour, // Hour index
+		int const TS // Time Step
+	);
+
+	void
+	ReuseShadowHistory(
+		int const GRSNR, // Surface number of the general receiving surface
+		int const iHour, // Hour index
+		int const TS // Time Step
+	);
+
 	void
 	SHDBKS(
 		int const NGRS, // Number of the general receiving surface
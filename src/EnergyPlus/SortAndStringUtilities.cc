@@ -1,5 +1,9 @@
 // C++ Headers
+#include <algorithm>
+#include <numeric>
+#include <string>
 #include <utility>
+#include <vector>
 
 // EnergyPlus Headers
 #include <SortAndStringUtilities.hh>
@@ -57,14 +61,16 @@ namespace SortAndStringUtilities {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   March 2009
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, std::stable_sort of an index array instead of QsortC
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Set up and call sort routine for Alphas
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Sort the positions by their strings, then move the strings into that order.
+		// QsortC recursed on array slices and degraded badly on presorted lists; the
+		// stable sort also keeps equal strings in their original order.
 
 		// REFERENCES:
 		// na
@@ -87,12 +93,21 @@ namespace SortAndStringUtilities {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumAlphas( Alphas.u() );
+		std::vector< int > Order( NumAlphas );
+		std::vector< std::string > SortedAlphas;
 
-		for ( int Loop = 1, Loop_end = Alphas.u(); Loop <= Loop_end; ++Loop ) {
-			iAlphas( Loop ) = Loop;
-		}
+		std::iota( Order.begin(), Order.end(), 1 );
+		std::stable_sort( Order.begin(), Order.end(), [&Alphas]( int const a, int const b ) { return Alphas( a ) < Alphas( b ); } );
 
-		QsortC( Alphas, iAlphas );
+		SortedAlphas.reserve( NumAlphas );
+		for ( int Loop = 1; Loop <= NumAlphas; ++Loop ) {
+			iAlphas( Loop ) = Order[ Loop - 1 ];
+			SortedAlphas.push_back( std::move( Alphas( Order[ Loop - 1 ] ) ) );
+		}
+		for ( int Loop = 1; Loop <= NumAlphas; ++Loop ) {
+			Alphas( Loop ) = std::move( SortedAlphas[ Loop - 1 ] );
+		}
 
 	}
 
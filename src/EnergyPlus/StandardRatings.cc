@@ -4,6 +4,7 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/string.functions.hh>
 
 // EnergyPlus Headers
 #include <StandardRatings.hh>
@@ -16,8 +17,10 @@
 #include <DataPrecisionGlobals.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
+#include <InputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <Psychrometrics.hh>
+#include <RecordOutput.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -147,6 +150,68 @@ namespace StandardRatings {
 
 	// Functions
 
+	bool
+	StandardRatingsRequested()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the standard ratings are reported, in the Equipment Summary tabular report
+		// or in the eio file.  The ratings are not calculated when nothing reports them.
+
+		// METHODOLOGY EMPLOYED:
+		// The Equipment Summary is requested by name (EquipmentSummary or Equip) or by one of the
+		// AllSummary keys of Output:Table:SummaryReports.  The eio records of the ratings are
+		// written unless their record classes are listed in the EioSuppress environment variable.
+
+		// Using/Aliasing
+		using InputProcessor::GetNumObjectsFound;
+		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectItem;
+		using InputProcessor::SameString;
+		using RecordOutput::RecordClass;
+		using RecordOutput::WriteRecord;
+		using RecordOutput::WriteTextRecord;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		static bool GetInput( true );
+		static bool Requested( true );
+		std::string const CurrentModuleObject( "Output:Table:SummaryReports" );
+		int NumParams;
+		int NumAlphas;
+		int NumNums;
+		int IOStat;
+
+		if ( ! GetInput ) return Requested;
+		GetInput = false;
+
+		Requested = false;
+		for ( std::string const ClassName : { "Chiller Standard Rating Information", "DX Cooling Coil Standard Rating Information", "DX Heating Coil Standard Rating Information", "DX Cooling Coil ASHRAE 127 Standard Ratings Information" } ) {
+			int const ClassNum( RecordClass( ClassName ) );
+			if ( WriteTextRecord( ClassNum ) || WriteRecord( ClassNum ) ) Requested = true;
+		}
+
+		if ( ! Requested && GetNumObjectsFound( CurrentModuleObject ) > 0 ) {
+			GetObjectDefMaxArgs( CurrentModuleObject, NumParams, NumAlphas, NumNums );
+			Array1D_string Alphas( NumAlphas );
+			Array1D< Real64 > Numbers( NumNums );
+			GetObjectItem( CurrentModuleObject, 1, Alphas, NumAlphas, Numbers, NumNums, IOStat );
+			for ( int AlphaNum = 1; AlphaNum <= NumAlphas; ++AlphaNum ) {
+				if ( SameString( Alphas( AlphaNum ), "EquipmentSummary" ) || SameString( Alphas( AlphaNum ), "Equip" ) || has_prefixi( Alphas( AlphaNum ), "AllSummary" ) ) {
+					Requested = true;
+				}
+			}
+		}
+
+		return Requested;
+
+	}
+
 	void
 	CalcChillerIPLV(
 		std::string const & ChillerName, // Name of Chiller for which IPLV is calculated
@@ -167,7 +232,7 @@ namespace StandardRatings {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Chandan Sharma, FSEC
 		//       DATE WRITTEN   January 2012
-		//       Modified       na
+		//       Modified       Oct 2026, skipped when the ratings are not reported
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -278,6 +343,8 @@ namespace StandardRatings {
 		ChillerEIRFPLR = 0.0;
 		PartLoadRatio = 0.0;
 
+		if ( ! StandardRatingsRequested() ) return;
+
 		CheckCurveLimitsForIPLV( ChillerName, ChillerType, CondenserType, CapFTempCurveIndex, EIRFTempCurveIndex );
 
 		// IPLV calculations:
@@ -512,7 +579,7 @@ namespace StandardRatings {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Chandan Sharma
 		//       DATE WRITTEN   January 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, eio lines follow EioSuppress
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -545,12 +612,15 @@ namespace StandardRatings {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool MyOneTimeFlag( true );
+		static int const RatingRecordClass( RecordOutput::RecordClass( "Chiller Standard Rating Information" ) );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <Chiller Standard Rating Information>, Component Type, Component Name, ','IPLV in SI Units {W/W}, ','IPLV in IP Units {Btu/W-h}')" );
 		static gio::Fmt Format_991( "(' Chiller Standard Rating Information, ',A,', ',A,', ',A,', ',A)" );
 
-		if ( MyOneTimeFlag ) {
+		bool const WriteText( RecordOutput::WriteTextRecord( RatingRecordClass ) );
+
+		if ( MyOneTimeFlag && WriteText ) {
 			gio::write( OutputFileInits, Format_990 );
 			MyOneTimeFlag = false;
 		}
@@ -558,12 +628,12 @@ namespace StandardRatings {
 		{ auto const SELECT_CASE_var( ChillerType );
 		if ( SELECT_CASE_var == TypeOf_Chiller_ElectricEIR ) {
 
-			gio::write( OutputFileInits, Format_991 ) << "Chiller:Electric:EIR" << ChillerName << RoundSigDigits( IPLVValueSI, 2 ) << RoundSigDigits( IPLVValueIP, 2 );
+			if ( WriteText ) gio::write( OutputFileInits, Format_991 ) << "Chiller:Electric:EIR" << ChillerName << RoundSigDigits( IPLVValueSI, 2 ) << RoundSigDigits( IPLVValueIP, 2 );
 			PreDefTableEntry( pdchMechType, ChillerName, "Chiller:Electric:EIR" );
 
 		} else if ( SELECT_CASE_var == TypeOf_Chiller_ElectricReformEIR ) {
 
-			gio::write( OutputFileInits, Format_991 ) << "Chiller:Electric:ReformulatedEIR" << ChillerName << RoundSigDigits( IPLVValueSI, 2 ) << RoundSigDigits( IPLVValueIP, 2 );
+			if ( WriteText ) gio::write( OutputFileInits, Format_991 ) << "Chiller:Electric:ReformulatedEIR" << ChillerName << RoundSigDigits( IPLVValueSI, 2 ) << RoundSigDigits( IPLVValueIP, 2 );
 			PreDefTableEntry( pdchMechType, ChillerName, "Chiller:Electric:ReformulatedEIR" );
 
 		}}
@@ -735,7 +805,7 @@ namespace StandardRatings {
 		//                      C. Sharma, March 2012  Added HSPF Calculation for single speed HP
 		//                      B. Nigusse, August 2012 Added SEER Calculation for Multi-speed HP
 		//                      B. Nigusse, November 2012 Added HSPF Calculation for Multi-speed HP
-
+		//       MODIFIED       Oct 2026, skipped when the ratings are not reported
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -883,6 +953,8 @@ namespace StandardRatings {
 		Array1D< Real64 > NetTotCoolingCapRated( 16 ); // net total cooling capacity of DX Coils for the sixteen ASHRAE Std 127 Test conditions
 		Array1D< Real64 > TotElectricPowerRated( 16 ); // total electric power of DX Coils for the sixteen ASHRAE Std 127 Test conditions
 
+		if ( ! StandardRatingsRequested() ) return;
+
 		NetCoolingCapRated = 0.0;
 
 		{ auto const SELECT_CASE_var( DXCoilType_Num );
@@ -2017,6 +2089,7 @@ namespace StandardRatings {
 		//       DATE WRITTEN   February 2010
 		//       MODIFIED       May 2010 (Added EER and IEER entries)
 		//                      March 2012 (Added HSPF and High/Low Heating Capacity entries)
+		//                      Oct 2026, eio lines follow EioSuppress
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2057,6 +2130,8 @@ namespace StandardRatings {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool MyCoolOneTimeFlag( true );
 		static bool MyHeatOneTimeFlag( true );
+		static int const CoolRecordClass( RecordOutput::RecordClass( "DX Cooling Coil Standard Rating Information" ) );
+		static int const HeatRecordClass( RecordOutput::RecordClass( "DX Heating Coil Standard Rating Information" ) );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <DX Cooling Coil Standard Rating Information>, Component Type, Component Name, ','Standard Rating (Net) Cooling Capacity {W}, ','Standard Rated Net COP {W/W}, ','EER {Btu/W-h}, ','SEER {Btu/W-h}, ','IEER {Btu/W-h}')" );
@@ -2069,12 +2144,13 @@ namespace StandardRatings {
 		{ auto const SELECT_CASE_var( CompTypeNum );
 
 		if ( SELECT_CASE_var == CoilDX_CoolingSingleSpeed ) {
-			if ( MyCoolOneTimeFlag ) {
+			bool const WriteText( RecordOutput::WriteTextRecord( CoolRecordClass ) );
+			if ( MyCoolOneTimeFlag && WriteText ) {
 				gio::write( OutputFileInits, Format_990 );
 				MyCoolOneTimeFlag = false;
 			}
 
-			gio::write( OutputFileInits, Format_991 ) << CompType << CompName << RoundSigDigits( CoolCapVal, 1 ) << RoundSigDigits( EERValueSI, 2 ) << RoundSigDigits( EERValueIP, 2 ) << RoundSigDigits( SEERValueIP, 2 ) << RoundSigDigits( IEERValueIP, 2 );
+			if ( WriteText ) gio::write( OutputFileInits, Format_991 ) << CompType << CompName << RoundSigDigits( CoolCapVal, 1 ) << RoundSigDigits( EERValueSI, 2 ) << RoundSigDigits( EERValueIP, 2 ) << RoundSigDigits( SEERValueIP, 2 ) << RoundSigDigits( IEERValueIP, 2 );
 
 			PreDefTableEntry( pdchDXCoolCoilType, CompName, CompType );
 			PreDefTableEntry( pdchDXCoolCoilNetCapSI, CompName, CoolCapVal, 1 );
@@ -2085,12 +2161,13 @@ namespace StandardRatings {
 			addFootNoteSubTable( pdstDXCoolCoil, "ANSI/AHRI ratings account for supply air fan heat and electric power." );
 
 		} else if ( ( SELECT_CASE_var == CoilDX_HeatingEmpirical ) || ( SELECT_CASE_var == CoilDX_MultiSpeedHeating ) ) {
-			if ( MyHeatOneTimeFlag ) {
+			bool const WriteText( RecordOutput::WriteTextRecord( HeatRecordClass ) );
+			if ( MyHeatOneTimeFlag && WriteText ) {
 				gio::write( OutputFileInits, Format_992 );
 				MyHeatOneTimeFlag = false;
 			}
 
-			gio::write( OutputFileInits, Format_993 ) << CompType << CompName << RoundSigDigits( HighHeatingCapVal, 1 ) << RoundSigDigits( LowHeatingCapVal, 1 ) << RoundSigDigits( HSPFValueIP, 2 ) << RoundSigDigits( RegionNum );
+			if ( WriteText ) gio::write( OutputFileInits, Format_993 ) << CompType << CompName << RoundSigDigits( HighHeatingCapVal, 1 ) << RoundSigDigits( LowHeatingCapVal, 1 ) << RoundSigDigits( HSPFValueIP, 2 ) << RoundSigDigits( RegionNum );
 
 			PreDefTableEntry( pdchDXHeatCoilType, CompName, CompType );
 			PreDefTableEntry( pdchDXHeatCoilHighCap, CompName, HighHeatingCapVal, 1 );
@@ -2100,12 +2177,13 @@ namespace StandardRatings {
 			addFootNoteSubTable( pdstDXHeatCoil, "ANSI/AHRI ratings account for supply air fan heat and electric power." );
 
 		} else if ( SELECT_CASE_var == CoilDX_MultiSpeedCooling ) {
-			if ( MyCoolOneTimeFlag ) {
+			bool const WriteText( RecordOutput::WriteTextRecord( CoolRecordClass ) );
+			if ( MyCoolOneTimeFlag && WriteText ) {
 				gio::write( OutputFileInits, Format_994 );
 				MyCoolOneTimeFlag = false;
 			}
 
-			gio::write( OutputFileInits, Format_995 ) << CompType << CompName << RoundSigDigits( CoolCapVal, 1 ) << ' ' << ' ' << RoundSigDigits( SEERValueIP, 2 ) << ' ';
+			if ( WriteText ) gio::write( OutputFileInits, Format_995 ) << CompType << CompName << RoundSigDigits( CoolCapVal, 1 ) << ' ' << ' ' << RoundSigDigits( SEERValueIP, 2 ) << ' ';
 
 			PreDefTableEntry( pdchDXCoolCoilType, CompName, CompType );
 			PreDefTableEntry( pdchDXCoolCoilNetCapSI, CompName, CoolCapVal, 1 );
@@ -2129,7 +2207,7 @@ namespace StandardRatings {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   October 2014
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, eio lines follow EioSuppress
 		//
 		//       RE-ENGINEERED  na
 
@@ -2170,6 +2248,7 @@ namespace StandardRatings {
 		int Num; // text number counter
 		static std::string ClassName;
 		static std::string CompNameNew;
+		static int const DataCenterRecordClass( RecordOutput::RecordClass( "DX Cooling Coil ASHRAE 127 Standard Ratings Information" ) );
 
 		// Formats
 		static gio::Fmt Format_101( "('! <DX Cooling Coil ASHRAE 127 Standard Ratings Information>, Component Type, Component Name, Standard 127 Classification, ','Rated Net Cooling Capacity Test A {W}, ','Rated Total Electric Power Test A {W}, ','Rated Net Cooling Capacity Test B {W}, ','Rated Total Electric Power Test B {W}, ','Rated Net Cooling Capacity Test C {W}, ','Rated Total Electric Power Test C {W}, ','Rated Net Cooling Capacity Test D {W}, ','Rated Total Electric Power Test D {W} ')" );
@@ -2179,7 +2258,8 @@ namespace StandardRatings {
 		{ auto const SELECT_CASE_var( CompTypeNum );
 
 		if ( SELECT_CASE_var == CoilDX_CoolingSingleSpeed ) {
-			if ( MyCoolOneTimeFlag ) {
+			bool const WriteText( RecordOutput::WriteTextRecord( DataCenterRecordClass ) );
+			if ( MyCoolOneTimeFlag && WriteText ) {
 				gio::write( OutputFileInits, Format_101 );
 				MyCoolOneTimeFlag = false;
 			}
@@ -2187,7 +2267,7 @@ namespace StandardRatings {
 				Num = ( ClassNum - 1 ) * 4;
 				ClassName = "Class " + RoundSigDigits(ClassNum);
 				CompNameNew = CompName + "(" + ClassName + ")";
-				gio::write( OutputFileInits, Format_102 ) << CompType << CompName << ClassName << RoundSigDigits( NetCoolingCapRated( Num + 1 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 1 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 2 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 2 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 3 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 3 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 4 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 4 ), 1 );
+				if ( WriteText ) gio::write( OutputFileInits, Format_102 ) << CompType << CompName << ClassName << RoundSigDigits( NetCoolingCapRated( Num + 1 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 1 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 2 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 2 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 3 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 3 ), 1 ) << RoundSigDigits( NetCoolingCapRated( Num + 4 ), 1 ) << RoundSigDigits( TotElectricPowerRated( Num + 4 ), 1 );
 				PreDefTableEntry( pdchDXCoolCoilType, CompNameNew, CompType );
 				PreDefTableEntry( pdchDXCoolCoilNetCapSIA, CompNameNew, RoundSigDigits( NetCoolingCapRated( Num + 1 ), 1 ) );
 				PreDefTableEntry( pdchDXCoolCoilElecPowerA, CompNameNew, RoundSigDigits( TotElectricPowerRated( Num + 1 ), 1 ) );
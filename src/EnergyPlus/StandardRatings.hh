@@ -93,6 +93,9 @@ namespace StandardRatings {
 
 	// Functions
 
+	bool
+	StandardRatingsRequested();
+
 	void
 	CalcChillerIPLV(
 		std::string const & ChillerName, // Name of Chiller for which IPLV is calculated
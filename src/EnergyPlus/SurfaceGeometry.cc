@@ -2,6 +2,8 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -20,6 +22,7 @@
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -642,6 +645,7 @@ namespace SurfaceGeometry {
 		//       DATE WRITTEN   November 1997
 		//       MODIFIED       April 1999, Linda Lawrie
 		//                      Dec. 2000, FW (add "one-wall zone" checks)
+		//                      Oct 2026, hashed name lookups and subsurface lists for large models
 		//       RE-ENGINEERED  May 2000, Linda Lawrie (breakout surface type gets)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -730,6 +734,7 @@ namespace SurfaceGeometry {
 		using InputProcessor::FindItemInList;
 		using InputProcessor::SameString;
 		using InputProcessor::VerifyName;
+		using InputProcessor::MakeUPPERCase;
 		using General::TrimSigDigits;
 		using General::RoundSigDigits;
 		using namespace Vectors;
@@ -758,6 +763,10 @@ namespace SurfaceGeometry {
 		int ZoneNum; // DO loop counter (zones)
 		int Found; // For matching interzone surfaces
 		int ConstrNumFound; // Construction number of matching interzone surface
+		std::unordered_map< std::string, int > SurfaceNameIndex; // First surface with each name, for base surface and interzone matches
+		std::unordered_map< std::string, int > ZoneNameIndex; // First zone with each (uppercase) name
+		std::vector< std::vector< int > > SubSurfaceNums; // Surfaces that name each surface as their base surface, in order
+		std::vector< std::vector< int > > ZoneSurfaceNums; // Surfaces that name each zone, in order
 		static bool NonMatch( false ); // Error for non-matching interzone surfaces
 		int Lay; // Layer number
 		int MovedSurfs; // Number of Moved Surfaces (when sorting into hierarchical structure)
@@ -863,6 +872,8 @@ namespace SurfaceGeometry {
 		// FLOW:
 		// Get the total number of surfaces to allocate derived type and for surface loops
 
+		DataTimings::ProfileTimer const profileTimer( "GetSurfaceData" ); // Region of the timing profile
+
 		GetGeometryParameters( ErrorsFound );
 
 		if ( WorldCoordSystem ) {
@@ -968,7 +979,6 @@ namespace SurfaceGeometry {
 		if ( NeedToAddSurfaces + NeedToAddSubSurfaces > 0 ) CurNewSurf = FirstTotalSurfaces;
 		auto const Zone_Name( Zone.Name() ); // Member array
 		auto const SurfaceTmp_Name( SurfaceTmp.Name() ); // Member array
-		auto const Surface_Name( Surface.Name() ); // Member array
 		for ( SurfNum = 1; SurfNum <= FirstTotalSurfaces; ++SurfNum ) {
 			if ( SurfaceTmp( SurfNum ).ExtBoundCond != UnenteredAdjacentZoneSurface ) continue;
 			// Need to add surface
@@ -1074,6 +1084,11 @@ namespace SurfaceGeometry {
 		// After all of the surfaces have been defined then the base surfaces for the
 		// sub-surfaces can be defined.  Loop through surfaces and match with the sub-surface
 		// names.
+		SurfaceNameIndex.clear();
+		SurfaceNameIndex.reserve( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			SurfaceNameIndex.emplace( SurfaceTmp( SurfNum ).Name, SurfNum ); // keeps the first, as a list search would find
+		}
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( ! SurfaceTmp( SurfNum ).HeatTransSurf ) continue;
 
@@ -1081,7 +1096,7 @@ namespace SurfaceGeometry {
 			if ( SameString( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp( SurfNum ).Name ) ) {
 				Found = SurfNum;
 			} else {
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp_Name, TotSurfaces );
+				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceNameIndex );
 			}
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
@@ -1101,6 +1116,14 @@ namespace SurfaceGeometry {
 		} // ...end of the Surface DO loop for finding BaseSurf
 		//**********************************************************************************
 
+		// List the surfaces on each base surface once, rather than searching all surfaces for each base surface below
+		SubSurfaceNums.assign( TotSurfaces + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( SurfaceTmp( SurfNum ).BaseSurf >= 1 && SurfaceTmp( SurfNum ).BaseSurf <= TotSurfaces ) {
+				SubSurfaceNums[ SurfaceTmp( SurfNum ).BaseSurf ].push_back( SurfNum );
+			}
+		}
+
 		//**********************************************************************************
 		// orientation of flat subsurfaces (window/door/etc) need to match base surface
 		// CR8628
@@ -1112,7 +1135,8 @@ namespace SurfaceGeometry {
 			SurfTilt = SurfaceTmp( SurfNum ).Tilt;
 			if ( std::abs( SurfTilt ) <= 1.0e-5 || std::abs( SurfTilt - 180.0 ) <= 1.0e-5 ) {
 				// see if there are any subsurfaces on roofs/floors
-				for ( iTmp1 = 1; iTmp1 <= TotSurfaces; ++iTmp1 ) {
+				for ( int const OnBaseSurfNum : SubSurfaceNums[ SurfNum ] ) {
+					iTmp1 = OnBaseSurfNum;
 					if ( iTmp1 == SurfNum ) continue;
 					if ( SurfaceTmp( iTmp1 ).BaseSurf != SurfNum ) continue;
 					if ( ! SurfaceTmp( iTmp1 ).HeatTransSurf ) continue;
@@ -1226,6 +1250,17 @@ namespace SurfaceGeometry {
 		MovedSurfs = 0;
 		Surface.allocate( TotSurfaces ); // Allocate the Surface derived type appropriately
 
+		// List the surfaces of each zone once, rather than comparing every surface with every zone name below
+		ZoneNameIndex.clear();
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			ZoneNameIndex.emplace( MakeUPPERCase( Zone( ZoneNum ).Name ), ZoneNum );
+		}
+		ZoneSurfaceNums.assign( NumOfZones + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const zoneIndex( ZoneNameIndex.find( MakeUPPERCase( SurfaceTmp( SurfNum ).ZoneName ) ) );
+			if ( zoneIndex != ZoneNameIndex.end() ) ZoneSurfaceNums[ zoneIndex->second ].push_back( SurfNum );
+		}
+
 		// Move all Detached Surfaces to Front
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -1246,7 +1281,8 @@ namespace SurfaceGeometry {
 
 			for ( Loop = 1; Loop <= 3; ++Loop ) {
 
-				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				for ( int const ZoneSurfNum : ZoneSurfaceNums[ ZoneNum ] ) {
+					SurfNum = ZoneSurfNum;
 
 					if ( SurfaceTmp( SurfNum ).Zone == 0 ) continue;
 
@@ -1261,7 +1297,8 @@ namespace SurfaceGeometry {
 					Surface( MovedSurfs ).BaseSurf = BaseSurfNum;
 
 					//  Find all subsurfaces to this surface
-					for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+					for ( int const OnBaseSurfNum : SubSurfaceNums[ SurfNum ] ) {
+						SubSurfNum = OnBaseSurfNum;
 
 						if ( SurfaceTmp( SubSurfNum ).Zone == 0 ) continue;
 						if ( SurfaceTmp( SubSurfNum ).BaseSurf != SurfNum ) continue;
@@ -1275,7 +1312,8 @@ namespace SurfaceGeometry {
 				}
 			}
 
-			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int const ZoneSurfNum : ZoneSurfaceNums[ ZoneNum ] ) {
+				SurfNum = ZoneSurfNum;
 
 				if ( SurfaceTmp( SurfNum ).ZoneName != Zone( ZoneNum ).Name ) continue;
 				if ( SurfaceTmp( SurfNum ).Class != SurfaceClass_IntMass ) continue;
@@ -1306,6 +1344,14 @@ namespace SurfaceGeometry {
 
 		SurfaceTmp.deallocate(); // DeAllocate the Temp Surface derived type
 
+		// Subsurfaces of each reordered base surface
+		SubSurfaceNums.assign( TotSurfaces + 1, std::vector< int >() );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( Surface( SurfNum ).BaseSurf >= 1 && Surface( SurfNum ).BaseSurf <= TotSurfaces ) {
+				SubSurfaceNums[ Surface( SurfNum ).BaseSurf ].push_back( SurfNum );
+			}
+		}
+
 		//  For each Base Surface Type (Wall, Floor, Roof)
 
 		for ( Loop = 1; Loop <= 3; ++Loop ) {
@@ -1317,7 +1363,8 @@ namespace SurfaceGeometry {
 				if ( Surface( SurfNum ).Class != BaseSurfIDs( Loop ) ) continue;
 
 				//  Find all subsurfaces to this surface
-				for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+				for ( int const OnBaseSurfNum : SubSurfaceNums[ SurfNum ] ) {
+					SubSurfNum = OnBaseSurfNum;
 
 					if ( SurfNum == SubSurfNum ) continue;
 					if ( Surface( SubSurfNum ).Zone == 0 ) continue;
@@ -1373,6 +1420,10 @@ namespace SurfaceGeometry {
 		// Now, match up interzone surfaces
 		NonMatch = false;
 		izConstDiffMsg = false;
+		SurfaceNameIndex.clear();
+		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) {
+			SurfaceNameIndex.emplace( Surface( SurfNum ).Name, SurfNum );
+		}
 		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) { //TotSurfaces
 			//  Clean up Shading Surfaces, make sure they don't go through here.
 			//  Shading surfaces have "Zone=0", should also have "BaseSurf=0"
@@ -1391,7 +1442,7 @@ namespace SurfaceGeometry {
 					if ( Surface( SurfNum ).ExtBoundCondName == Surface( SurfNum ).Name ) {
 						Found = SurfNum;
 					} else {
-						Found = FindItemInList( Surface( SurfNum ).ExtBoundCondName, Surface_Name, MovedSurfs );
+						Found = FindItemInList( Surface( SurfNum ).ExtBoundCondName, SurfaceNameIndex );
 					}
 					if ( Found != 0 ) {
 						Surface( SurfNum ).ExtBoundCond = Found;
@@ -662,7 +662,7 @@ namespace loc {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   August 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, solve surface heat balances and source flux directly
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -683,8 +683,10 @@ namespace loc {
 		// temperatures. Surface fluxes are then dependant only on source flux. Constant
 		// and terms and terms that multiply the source flux from the QTF equations, are
 		// grouped together for convenience. These are calculated in "CalcBottomFluxCoefficents"
-		// etc. It is necessary to iterate on these equations, updating the current surface
-		// temperatures at each step.
+		// etc. The surface heat balances are linear in the surface fluxes (the radiation
+		// coefficients use the previous surface temperatures) and the QTF equations are linear
+		// in the current surface temperatures and source flux, so the coupled system is solved
+		// directly in "CalcSurfaceTempResponse" instead of iterating with under-relaxation.
 
 		// REFERENCES:
 		// See 'LowTempRadiantSystem' module
@@ -701,18 +703,13 @@ namespace loc {
 		using DataGlobals::BeginTimeStepFlag;
 		using namespace DataEnvironment;
 		using DataPlant::PlantLoop;
-		using General::TrimSigDigits;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 		// INTEGER, INTENT(IN) :: FlowLock             ! flow initialization/condition flag    !DSU
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SurfFluxTol( 0.001 ); // tolerance on the surface fluxes
-		Real64 const SrcFluxTol( 0.001 ); // tolerance on the source flux
-		Real64 const RelaxT( 0.1 ); // temperature relaxation factor
-		int const Maxiter( 100 );
-		int const Maxiter1( 100 );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -727,20 +724,22 @@ namespace loc {
 		Real64 PastFluxBtm; // bottom surface flux - past value
 		Real64 PastTempBtm; // bottom surface temp - past value
 		Real64 PastTempTop; // top surface temp - past value
-		Real64 OldPastFluxTop; // top surface flux - past value used during iteration
-		Real64 OldPastFluxBtm; // bottom surface flux - past value used during iteration
 		// variables used with current environmental conditions
 		static Real64 FluxTop; // top surface flux
 		static Real64 FluxBtm; // bottom surface flux
 		static Real64 TempBtm; // bottom surface temp
 		static Real64 TempTop; // top surface temp
-		Real64 TempT; // top surface temp - used in underrelaxation
-		Real64 TempB; // bottom surface temp - used in underrelaxation
-		Real64 OldFluxTop; // top surface flux - value used during iteration
-		Real64 OldFluxBtm; // bottom surface flux - value used during iteration
-		Real64 OldSourceFlux; // previous value of source flux - used during iteration
-		int iter;
-		int iter1;
+		Real64 TempT; // top surface temp - past conditions
+		Real64 TempB; // bottom surface temp - past conditions
+		Real64 TopSurfConst; // top surface heat balance: constant term
+		Real64 TopSurfFluxCoef; // top surface heat balance: term multiplying the surface flux
+		Real64 BtmSurfConst; // bottom surface heat balance: constant term
+		Real64 BtmSurfFluxCoef; // bottom surface heat balance: term multiplying the surface flux
+		Real64 TtopConst; // top surface temp: constant term
+		Real64 TtopSrcCoef; // top surface temp: term multiplying the source flux
+		Real64 TbtmConst; // bottom surface temp: constant term
+		Real64 TbtmSrcCoef; // bottom surface temp: term multiplying the source flux
+		Real64 EpsMdotCp; // Epsilon (heat exchanger terminology) times water mass flow rate times water specific heat
 		//  INTEGER, SAVE ::ErrCount1=0
 		//  INTEGER, SAVE ::ErrCount2=0
 		//  INTEGER, SAVE ::ErrCount3=0
@@ -755,52 +754,20 @@ namespace loc {
 		if ( BeginTimeStepFlag && FirstHVACIteration && PlantLoop( LoopNum ).LoopSide( LoopSideNum ).FlowLock == 1 ) { //DSU
 			// calc temps and fluxes with past env. conditions and average source flux
 			SourceFlux = SurfaceGHEQTF( SurfaceGHENum ).QSrcAvg;
-			// starting values for the surface temps
-			PastTempBtm = SurfaceGHEQTF( SurfaceGHENum ).TbtmHistory( 1 );
-			PastTempTop = SurfaceGHEQTF( SurfaceGHENum ).TtopHistory( 1 );
-			OldPastFluxTop = 1.0e+30;
-			OldPastFluxBtm = 1.0e+30;
-			OldSourceFlux = 1.0e+30;
-			TempB = 0.0;
-			TempT = 0.0;
-			iter = 0;
-			while ( true ) { // iterate to find surface heat balances
-				// update coefficients
-
-				++iter;
-				CalcTopFluxCoefficents( SurfaceGHENum, PastTempBtm, PastTempTop );
-				// calc top surface flux
-				PastFluxTop = SurfaceGHEQTF( SurfaceGHENum ).QtopConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QtopVarCoef * SourceFlux;
-
-				//calc new top surface temp
-				CalcTopSurfTemp( SurfaceGHENum, -PastFluxTop, TempT, PastOutDryBulbTemp, PastOutWetBulbTemp, PastSkyTemp, PastBeamSolarRad, PastDifSolarRad, PastSolarDirCosVert, PastWindSpeed, PastIsRain, PastIsSnow );
-				// under relax
-				PastTempTop = PastTempTop * ( 1.0 - RelaxT ) + RelaxT * TempT;
-
-				// update coefficients
-				CalcBottomFluxCoefficents( SurfaceGHENum, PastTempBtm, PastTempTop );
-				PastFluxBtm = SurfaceGHEQTF( SurfaceGHENum ).QbtmConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QbtmVarCoef * SourceFlux;
-
-				if ( std::abs( ( OldPastFluxTop - PastFluxTop ) / OldPastFluxTop ) <= SurfFluxTol && std::abs( ( OldPastFluxBtm - PastFluxBtm ) / OldPastFluxBtm ) <= SurfFluxTol ) break;
-
-				//calc new surface temps
-				CalcBottomSurfTemp( SurfaceGHENum, PastFluxBtm, TempB, PastOutDryBulbTemp, PastWindSpeed, PastGroundTemp );
-				// underrelax
-				PastTempBtm = PastTempBtm * ( 1.0 - RelaxT ) + RelaxT * TempB;
-				// update flux record
-				OldPastFluxTop = PastFluxTop;
-				OldPastFluxBtm = PastFluxBtm;
-
-				//Check for non-convergence
-				if ( iter > Maxiter ) {
-					if ( SurfaceGHE( SurfaceGHENum ).ConvErrIndex1 == 0 ) {
-						ShowWarningMessage( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 1), Iterations=" + TrimSigDigits( Maxiter ) );
-						ShowContinueErrorTimeStamp( "" );
-					}
-					ShowRecurringWarningErrorAtEnd( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 1)", SurfaceGHE( SurfaceGHENum ).ConvErrIndex1 );
-					break;
-				}
-			}
+			// solve the surface heat balances and QTF equations together for the surface temps
+			CalcTopSurfTempCoefficients( SurfaceGHENum, TopSurfConst, TopSurfFluxCoef, PastOutDryBulbTemp, PastOutWetBulbTemp, PastSkyTemp, PastBeamSolarRad, PastDifSolarRad, PastSolarDirCosVert, PastWindSpeed, PastIsRain, PastIsSnow );
+			CalcBottomSurfTempCoefficients( SurfaceGHENum, BtmSurfConst, BtmSurfFluxCoef, PastOutDryBulbTemp, PastWindSpeed, PastGroundTemp );
+			CalcSurfaceTempResponse( SurfaceGHENum, TopSurfConst, TopSurfFluxCoef, BtmSurfConst, BtmSurfFluxCoef, TtopConst, TtopSrcCoef, TbtmConst, TbtmSrcCoef );
+			PastTempTop = TtopConst + TtopSrcCoef * SourceFlux;
+			PastTempBtm = TbtmConst + TbtmSrcCoef * SourceFlux;
+			TempT = PastTempTop;
+			TempB = PastTempBtm;
+
+			// calc surface fluxes
+			CalcTopFluxCoefficents( SurfaceGHENum, PastTempBtm, PastTempTop );
+			PastFluxTop = SurfaceGHEQTF( SurfaceGHENum ).QtopConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QtopVarCoef * SourceFlux;
+			CalcBottomFluxCoefficents( SurfaceGHENum, PastTempBtm, PastTempTop );
+			PastFluxBtm = SurfaceGHEQTF( SurfaceGHENum ).QbtmConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QbtmVarCoef * SourceFlux;
 
 			if ( ! InitializeTempTop ) {
 				TempTop = TempT;
@@ -844,69 +811,31 @@ namespace loc {
 			PastWindSpeed = WindSpeedAt( SurfaceHXHeight );
 			PastCloudFraction = CloudFraction;
 
-			TempBtm = SurfaceGHEQTF( SurfaceGHENum ).TbtmHistory( 1 );
-			TempTop = SurfaceGHEQTF( SurfaceGHENum ).TtopHistory( 1 );
-			OldFluxTop = 1.0e+30;
-			OldFluxBtm = 1.0e+30;
-			OldSourceFlux = 1.0e+30;
-			SourceFlux = CalcSourceFlux( SurfaceGHENum );
-			iter = 0;
-			while ( true ) { // iterate to find source flux
-				++iter;
-				iter1 = 0;
-				while ( true ) { // iterate to find surface heat balances
-					++iter1;
-					// update top coefficients
-					CalcTopFluxCoefficents( SurfaceGHENum, TempBtm, TempTop );
-					// calc top surface fluxe
-					FluxTop = SurfaceGHEQTF( SurfaceGHENum ).QtopConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QtopVarCoef * SourceFlux;
-					//calc new surface temps
-					CalcTopSurfTemp( SurfaceGHENum, -FluxTop, TempT, PastOutDryBulbTemp, PastOutWetBulbTemp, PastSkyTemp, PastBeamSolarRad, PastDifSolarRad, PastSolarDirCosVert, PastWindSpeed, PastIsRain, PastIsSnow );
-					// under-relax
-					TempTop = TempTop * ( 1.0 - RelaxT ) + RelaxT * TempT;
-					// update bottom coefficients
-					CalcBottomFluxCoefficents( SurfaceGHENum, TempBtm, TempTop );
-					FluxBtm = SurfaceGHEQTF( SurfaceGHENum ).QbtmConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QbtmVarCoef * SourceFlux;
-					// convergence test on surface fluxes
-					if ( std::abs( ( OldFluxTop - FluxTop ) / OldFluxTop ) <= SurfFluxTol && std::abs( ( OldFluxBtm - FluxBtm ) / OldFluxBtm ) <= SurfFluxTol ) break;
-
-					//calc new surface temps
-					CalcBottomSurfTemp( SurfaceGHENum, FluxBtm, TempB, PastOutDryBulbTemp, PastOutDryBulbTemp, GroundTemp_Surface );
-					// under-relax
-					TempBtm = TempBtm * ( 1.0 - RelaxT ) + RelaxT * TempB;
-					// update flux record
-					OldFluxBtm = FluxBtm;
-					OldFluxTop = FluxTop;
-
-					//Check for non-convergence
-					if ( iter1 > Maxiter1 ) {
-						if ( SurfaceGHE( SurfaceGHENum ).ConvErrIndex2 == 0 ) {
-							ShowWarningMessage( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 2), Iterations=" + TrimSigDigits( Maxiter ) );
-							ShowContinueErrorTimeStamp( "" );
-						}
-						ShowRecurringWarningErrorAtEnd( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 2)", SurfaceGHE( SurfaceGHENum ).ConvErrIndex2 );
-						break;
-					}
-				}
-				// update the source temp coefficients and update the source flux
-				CalcSourceTempCoefficents( SurfaceGHENum, TempBtm, TempTop );
-				SourceFlux = CalcSourceFlux( SurfaceGHENum );
-				// check source flux convergence
-				if ( std::abs( ( OldSourceFlux - SourceFlux ) / ( 1.0e-20 + OldSourceFlux ) ) <= SrcFluxTol ) break;
-				OldSourceFlux = SourceFlux;
-
-				//Check for non-convergence
-				if ( iter > Maxiter ) {
-					if ( SurfaceGHE( SurfaceGHENum ).ConvErrIndex3 == 0 ) {
-						ShowWarningMessage( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 3), Iterations=" + TrimSigDigits( Maxiter ) );
-						ShowContinueErrorTimeStamp( "" );
-					}
-					ShowRecurringWarningErrorAtEnd( "CalcSurfaceGroundHeatExchanger=\"" + SurfaceGHE( SurfaceGHENum ).Name + "\", Did not converge (part 3)", SurfaceGHE( SurfaceGHENum ).ConvErrIndex3 );
-					break;
-				}
-			} // end surface heat balance iteration
+			// surface temps as linear functions of the source flux
+			CalcTopSurfTempCoefficients( SurfaceGHENum, TopSurfConst, TopSurfFluxCoef, PastOutDryBulbTemp, PastOutWetBulbTemp, PastSkyTemp, PastBeamSolarRad, PastDifSolarRad, PastSolarDirCosVert, PastWindSpeed, PastIsRain, PastIsSnow );
+			CalcBottomSurfTempCoefficients( SurfaceGHENum, BtmSurfConst, BtmSurfFluxCoef, PastOutDryBulbTemp, PastOutDryBulbTemp, GroundTemp_Surface );
+			CalcSurfaceTempResponse( SurfaceGHENum, TopSurfConst, TopSurfFluxCoef, BtmSurfConst, BtmSurfFluxCoef, TtopConst, TtopSrcCoef, TbtmConst, TbtmSrcCoef );
+
+			// the source temp is linear in the surface temps, so the source flux follows directly
+			if ( FlowRate > 0.0 ) {
+				EpsMdotCp = CalcHXEffectTerm( SurfaceGHENum, InletTemp, FlowRate );
+				CalcSourceTempCoefficents( SurfaceGHENum, 0.0, 0.0 );
+				SourceFlux = ( InletTemp - SurfaceGHEQTF( SurfaceGHENum ).TsrcConstCoef - SurfaceGHEQTF( SurfaceGHENum ).CTFTSourceIn( 0 ) * TbtmConst - SurfaceGHEQTF( SurfaceGHENum ).CTFTSourceOut( 0 ) * TtopConst ) / ( SurfaceArea / EpsMdotCp + SurfaceGHEQTF( SurfaceGHENum ).TsrcVarCoef + SurfaceGHEQTF( SurfaceGHENum ).CTFTSourceIn( 0 ) * TbtmSrcCoef + SurfaceGHEQTF( SurfaceGHENum ).CTFTSourceOut( 0 ) * TtopSrcCoef );
+			} else {
+				SourceFlux = 0.0;
+			}
+
+			// current surface temps and fluxes
+			TempTop = TtopConst + TtopSrcCoef * SourceFlux;
+			TempBtm = TbtmConst + TbtmSrcCoef * SourceFlux;
+			CalcTopFluxCoefficents( SurfaceGHENum, TempBtm, TempTop );
+			FluxTop = SurfaceGHEQTF( SurfaceGHENum ).QtopConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QtopVarCoef * SourceFlux;
+			CalcBottomFluxCoefficents( SurfaceGHENum, TempBtm, TempTop );
+			FluxBtm = SurfaceGHEQTF( SurfaceGHENum ).QbtmConstCoef + SurfaceGHEQTF( SurfaceGHENum ).QbtmVarCoef * SourceFlux;
+			// source temp coefficients used for the rest of the system time steps
+			CalcSourceTempCoefficents( SurfaceGHENum, TempBtm, TempTop );
 
-		} else { // end source flux iteration
+		} else {
 
 			// For the rest of the system time steps ...
 			// update source flux from Twi
@@ -1193,6 +1122,94 @@ namespace loc {
 
 	//==============================================================================
 
+	void
+	CalcSurfaceTempResponse(
+		int const SurfaceGHENum, // component number
+		Real64 const TopSurfConst, // top surface heat balance: constant term
+		Real64 const TopSurfFluxCoef, // top surface heat balance: term multiplying the surface flux
+		Real64 const BtmSurfConst, // bottom surface heat balance: constant term
+		Real64 const BtmSurfFluxCoef, // bottom surface heat balance: term multiplying the surface flux
+		Real64 & TtopConst, // top surface temperature: constant term
+		Real64 & TtopSrcCoef, // top surface temperature: term multiplying the source flux
+		Real64 & TbtmConst, // bottom surface temperature: constant term
+		Real64 & TbtmSrcCoef // bottom surface temperature: term multiplying the source flux
+	)
+	{
+
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine calculates the top and bottom surface temperatures
+		// that satisfy both the surface heat balances and the QTF equations,
+		// as linear functions of the source flux.
+
+		// METHODOLOGY EMPLOYED:
+		// With the surface heat balances written as
+		//   Ttop = TopSurfConst - TopSurfFluxCoef * Qtop,  Tbtm = BtmSurfConst + BtmSurfFluxCoef * Qbtm
+		// and the QTF equations as
+		//   Qtop = QtopConst + CTFout(0) * Ttop - CTFcross(0) * Tbtm + QtopVar * Qsrc
+		//   Qbtm = QbtmConst - CTFin(0) * Tbtm + CTFcross(0) * Ttop + QbtmVar * Qsrc
+		// (constant terms evaluated with zero current surface temperatures), the two
+		// surface temperatures are the solution of a 2x2 linear system. It is solved once
+		// for the constant part and once for the part multiplying the source flux.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 A11; // coefficient matrix
+		Real64 A12;
+		Real64 A21;
+		Real64 A22;
+		Real64 Det; // determinant of the coefficient matrix
+		Real64 RhsTop; // right hand side - top surface, constant part
+		Real64 RhsBtm; // right hand side - bottom surface, constant part
+		Real64 SrcTop; // right hand side - top surface, source flux part
+		Real64 SrcBtm; // right hand side - bottom surface, source flux part
+
+		// flux coefficients with zero current surface temps
+		CalcTopFluxCoefficents( SurfaceGHENum, 0.0, 0.0 );
+		CalcBottomFluxCoefficents( SurfaceGHENum, 0.0, 0.0 );
+
+		auto const & QTF( SurfaceGHEQTF( SurfaceGHENum ) );
+		A11 = 1.0 + TopSurfFluxCoef * QTF.CTFout( 0 );
+		A12 = -TopSurfFluxCoef * QTF.CTFcross( 0 );
+		A21 = -BtmSurfFluxCoef * QTF.CTFcross( 0 );
+		A22 = 1.0 + BtmSurfFluxCoef * QTF.CTFin( 0 );
+		Det = A11 * A22 - A12 * A21;
+
+		RhsTop = TopSurfConst - TopSurfFluxCoef * QTF.QtopConstCoef;
+		RhsBtm = BtmSurfConst + BtmSurfFluxCoef * QTF.QbtmConstCoef;
+		SrcTop = -TopSurfFluxCoef * QTF.QtopVarCoef;
+		SrcBtm = BtmSurfFluxCoef * QTF.QbtmVarCoef;
+
+		TtopConst = ( RhsTop * A22 - A12 * RhsBtm ) / Det;
+		TbtmConst = ( A11 * RhsBtm - A21 * RhsTop ) / Det;
+		TtopSrcCoef = ( SrcTop * A22 - A12 * SrcBtm ) / Det;
+		TbtmSrcCoef = ( A11 * SrcBtm - A21 * SrcTop ) / Det;
+
+	}
+
+	//==============================================================================
+
 	void
 	UpdateHistories(
 		int const SurfaceGHENum, // component number
@@ -1404,10 +1421,10 @@ namespace loc {
 	//==============================================================================
 
 	void
-	CalcTopSurfTemp(
+	CalcTopSurfTempCoefficients(
 		int const SurfaceNum, // surface index number
-		Real64 const FluxTop, // top surface flux
-		Real64 & TempTop, // top surface temperature
+		Real64 & ConstTerm, // top surface temperature with no surface flux
+		Real64 & FluxCoef, // change in top surface temperature per unit surface flux
 		Real64 const ThisDryBulb, // dry bulb temperature
 		Real64 const ThisWetBulb, // wet bulb temperature
 		Real64 const ThisSkyTemp, // sky temperature
@@ -1422,12 +1439,12 @@ namespace loc {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   August 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return temperature as linear function of surface flux
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine is used to calculate the top surface
-		// temperature for the given surface flux.
+		// This subroutine is used to calculate the top surface temperature
+		// as a linear function of the surface flux.
 
 		// METHODOLOGY EMPLOYED:
 		// calc surface heat balance
@@ -1487,18 +1504,19 @@ namespace loc {
 		// total absorbed solar - no ground solar
 		QSolAbsorbed = TopSolarAbs * ( max( ThisSolarDirCosVert, 0.0 ) * ThisBeamSolarRad + ThisDifSolarRad );
 
-		// solve for temperature
-		TempTop = ( FluxTop + ConvCoef * ExternalTemp + RadCoef * ThisSkyTemp + QSolAbsorbed ) / ( ConvCoef + RadCoef );
+		// temperature terms
+		ConstTerm = ( ConvCoef * ExternalTemp + RadCoef * ThisSkyTemp + QSolAbsorbed ) / ( ConvCoef + RadCoef );
+		FluxCoef = 1.0 / ( ConvCoef + RadCoef );
 
 	}
 
 	//==============================================================================
 
 	void
-	CalcBottomSurfTemp(
+	CalcBottomSurfTempCoefficients(
 		int const SurfaceNum, // surface index number
-		Real64 const FluxBtm, // bottom surface flux
-		Real64 & TempBtm, // bottom surface temperature
+		Real64 & ConstTerm, // bottom surface temperature with no surface flux
+		Real64 & FluxCoef, // change in bottom surface temperature per unit surface flux
 		Real64 const ThisDryBulb, // dry bulb temperature
 		Real64 const ThisWindSpeed, // wind speed
 		Real64 const ThisGroundTemp // ground temperature
@@ -1507,12 +1525,12 @@ namespace loc {
 
 		//       AUTHOR         Simon Rees
 		//       DATE WRITTEN   August 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, return temperature as linear function of surface flux
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine is used to calculate the bottom surface
-		// temperature for the given surface flux.
+		// This subroutine is used to calculate the bottom surface temperature
+		// as a linear function of the surface flux.
 
 		// METHODOLOGY EMPLOYED:
 		// calc surface heat balances
@@ -1560,12 +1578,14 @@ namespace loc {
 				RadCoef = 0.0;
 			}
 
-			// total absorbed solar - no ground solar
-			TempBtm = ( FluxBtm + ConvCoef * ThisDryBulb + RadCoef * ThisDryBulb ) / ( ConvCoef + RadCoef );
+			// temperature terms - no ground solar
+			ConstTerm = ( ConvCoef * ThisDryBulb + RadCoef * ThisDryBulb ) / ( ConvCoef + RadCoef );
+			FluxCoef = 1.0 / ( ConvCoef + RadCoef );
 
 		} else { // ground coupled
 			// just use the supplied ground temperature
-			TempBtm = ThisGroundTemp;
+			ConstTerm = ThisGroundTemp;
+			FluxCoef = 0.0;
 		}
 
 	}
@@ -469,6 +469,21 @@ namespace loc {
 
 	//==============================================================================
 
+	void
+	CalcSurfaceTempResponse(
+		int const SurfaceGHENum, // component number
+		Real64 const TopSurfConst, // top surface heat balance: constant term
+		Real64 const TopSurfFluxCoef, // top surface heat balance: term multiplying the surface flux
+		Real64 const BtmSurfConst, // bottom surface heat balance: constant term
+		Real64 const BtmSurfFluxCoef, // bottom surface heat balance: term multiplying the surface flux
+		Real64 & TtopConst, // top surface temperature: constant term
+		Real64 & TtopSrcCoef, // top surface temperature: term multiplying the source flux
+		Real64 & TbtmConst, // bottom surface temperature: constant term
+		Real64 & TbtmSrcCoef // bottom surface temperature: term multiplying the source flux
+	);
+
+	//==============================================================================
+
 	void
 	UpdateHistories(
 		int const SurfaceGHENum, // component number
@@ -490,10 +505,10 @@ namespace loc {
 	//==============================================================================
 
 	void
-	CalcTopSurfTemp(
+	CalcTopSurfTempCoefficients(
 		int const SurfaceNum, // surface index number
-		Real64 const FluxTop, // top surface flux
-		Real64 & TempTop, // top surface temperature
+		Real64 & ConstTerm, // top surface temperature with no surface flux
+		Real64 & FluxCoef, // change in top surface temperature per unit surface flux
 		Real64 const ThisDryBulb, // dry bulb temperature
 		Real64 const ThisWetBulb, // wet bulb temperature
 		Real64 const ThisSkyTemp, // sky temperature
@@ -508,10 +523,10 @@ namespace loc {
 	//==============================================================================
 
 	void
-	CalcBottomSurfTemp(
+	CalcBottomSurfTempCoefficients(
 		int const SurfaceNum, // surface index number
-		Real64 const FluxBtm, // bottom surface flux
-		Real64 & TempBtm, // bottom surface temperature
+		Real64 & ConstTerm, // bottom surface temperature with no surface flux
+		Real64 & FluxCoef, // change in bottom surface temperature per unit surface flux
 		Real64 const ThisDryBulb, // dry bulb temperature
 		Real64 const ThisWindSpeed, // wind speed
 		Real64 const ThisGroundTemp // ground temperature
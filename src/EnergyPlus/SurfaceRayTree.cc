@@ -0,0 +1,317 @@
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// EnergyPlus Headers
+#include <SurfaceRayTree.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataSurfaces.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceRayTree {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// This module finds the surfaces a ray may hit, so the obstruction and reflection tests of the
+	// daylighting, solar reflection and complex fenestration calculations only call their pierce
+	// routines for those surfaces instead of for every surface in the building.
+
+	// METHODOLOGY EMPLOYED:
+	// Bounding volume hierarchy: each surface gets an axis-aligned box around its vertices (also
+	// around the fourth corner of the parallelogram on its first three vertices, which the pierce
+	// routines use for rectangles), grown by BoxPadding so the boxes stay conservative for the
+	// rounding of the hit points.  The boxes are split at the median of their centers along the
+	// longest axis until a node holds at most MaxLeafSurfaces surfaces.  A query walks the nodes
+	// whose box the ray (the half line from its origin) passes through and returns the surfaces
+	// of the leaves reached, in increasing surface number, so callers keep their loop order and
+	// their results.  The tree is built the first time it is needed (or when the number of
+	// surfaces has changed); surfaces do not move after the input is processed.
+
+	// REFERENCES:
+	// Williams, A., S. Barrus, R.K. Morley and P. Shirley. 2005. An Efficient and Robust Ray-Box
+	//  Intersection Algorithm. Journal of Graphics Tools 10(1): 49-54.
+
+	// OTHER NOTES:
+	// na
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataSurfaces::Surface;
+	using DataSurfaces::TotSurfaces;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const MaxLeafSurfaces( 4 ); // Surfaces in a leaf of the tree
+	Real64 const BoxPadding( 0.01 ); // Distance the surface bounding boxes are grown by (m)
+
+	// DERIVED TYPE DEFINITIONS:
+	struct TreeNodeData
+	{
+		// Members
+		Real64 Lo[ 3 ]; // Low corner of the node box (m)
+		Real64 Hi[ 3 ]; // High corner of the node box (m)
+		int Left; // First child node (-1 for a leaf)
+		int Right; // Second child node (-1 for a leaf)
+		int First; // First surface of a leaf in TreeSurfNums
+		int Count; // Surfaces in a leaf
+
+		// Default Constructor
+		TreeNodeData() :
+			Left( -1 ),
+			Right( -1 ),
+			First( 0 ),
+			Count( 0 )
+		{
+			std::fill( Lo, Lo + 3, 0.0 );
+			std::fill( Hi, Hi + 3, 0.0 );
+		}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	static int TreeTotSurfaces( -1 ); // Number of surfaces the tree was built for (-1 = not built)
+	static std::vector< TreeNodeData > TreeNodes; // Nodes of the tree (root first)
+	static std::vector< int > TreeSurfNums; // Surface numbers, grouped by leaf
+	static std::vector< Real64 > SurfBoxes; // Low and high corners of the box of each surface (6 per surface)
+	static EP_THREAD_LOCAL std::vector< int > NodeStack; // Nodes waiting to be visited by a query
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE:
+
+	// Functions
+
+	static
+	bool
+	RayHitsBox(
+		Real64 const * O, // Ray origin
+		Real64 const * D, // Ray direction
+		Real64 const * Lo, // Low corner of the box
+		Real64 const * Hi // High corner of the box
+	)
+	{
+		// Slab test of the half line O + t D, t >= 0, against the box
+		Real64 tMin( 0.0 );
+		Real64 tMax( std::numeric_limits< Real64 >::max() );
+		for ( int i = 0; i < 3; ++i ) {
+			if ( std::abs( D[ i ] ) < 1.0e-12 ) { // Parallel to this slab
+				if ( ( O[ i ] < Lo[ i ] ) || ( O[ i ] > Hi[ i ] ) ) return false;
+			} else {
+				Real64 t1( ( Lo[ i ] - O[ i ] ) / D[ i ] );
+				Real64 t2( ( Hi[ i ] - O[ i ] ) / D[ i ] );
+				if ( t1 > t2 ) std::swap( t1, t2 );
+				tMin = std::max( tMin, t1 );
+				tMax = std::min( tMax, t2 );
+				if ( tMin > tMax ) return false;
+			}
+		}
+		return true;
+	}
+
+	static
+	int
+	BuildTreeNode(
+		int const First, // First surface of the node in TreeSurfNums
+		int const Count // Surfaces in the node
+	)
+	{
+		int const NodeNum( TreeNodes.size() );
+		TreeNodes.emplace_back();
+
+		// Node box and the box of the surface centers
+		Real64 Lo[ 3 ];
+		Real64 Hi[ 3 ];
+		Real64 CenterLo[ 3 ];
+		Real64 CenterHi[ 3 ];
+		std::fill( Lo, Lo + 3, std::numeric_limits< Real64 >::max() );
+		std::fill( Hi, Hi + 3, std::numeric_limits< Real64 >::lowest() );
+		std::fill( CenterLo, CenterLo + 3, std::numeric_limits< Real64 >::max() );
+		std::fill( CenterHi, CenterHi + 3, std::numeric_limits< Real64 >::lowest() );
+		for ( int n = First; n < First + Count; ++n ) {
+			Real64 const * Box( &SurfBoxes[ 6 * TreeSurfNums[ n ] ] );
+			for ( int i = 0; i < 3; ++i ) {
+				Lo[ i ] = std::min( Lo[ i ], Box[ i ] );
+				Hi[ i ] = std::max( Hi[ i ], Box[ i + 3 ] );
+				Real64 const Center( 0.5 * ( Box[ i ] + Box[ i + 3 ] ) );
+				CenterLo[ i ] = std::min( CenterLo[ i ], Center );
+				CenterHi[ i ] = std::max( CenterHi[ i ], Center );
+			}
+		}
+		std::copy( Lo, Lo + 3, TreeNodes[ NodeNum ].Lo );
+		std::copy( Hi, Hi + 3, TreeNodes[ NodeNum ].Hi );
+
+		if ( Count <= MaxLeafSurfaces ) {
+			TreeNodes[ NodeNum ].First = First;
+			TreeNodes[ NodeNum ].Count = Count;
+			return NodeNum;
+		}
+
+		// Split at the median center along the axis with the largest spread of centers
+		int Axis( 0 );
+		for ( int i = 1; i < 3; ++i ) {
+			if ( CenterHi[ i ] - CenterLo[ i ] > CenterHi[ Axis ] - CenterLo[ Axis ] ) Axis = i;
+		}
+		int const Half( Count / 2 );
+		std::nth_element( TreeSurfNums.begin() + First, TreeSurfNums.begin() + First + Half, TreeSurfNums.begin() + First + Count, [ Axis ]( int const a, int const b ) {
+			return ( SurfBoxes[ 6 * a + Axis ] + SurfBoxes[ 6 * a + Axis + 3 ] ) < ( SurfBoxes[ 6 * b + Axis ] + SurfBoxes[ 6 * b + Axis + 3 ] );
+		} );
+		int const Left( BuildTreeNode( First, Half ) );
+		int const Right( BuildTreeNode( First + Half, Count - Half ) );
+		TreeNodes[ NodeNum ].Left = Left; // TreeNodes may have been reallocated by the calls
+		TreeNodes[ NodeNum ].Right = Right;
+		return NodeNum;
+	}
+
+	void
+	InitSurfaceRayTree()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bounding volume hierarchy over the current surfaces.
+
+		TreeNodes.clear();
+		TreeSurfNums.clear();
+		SurfBoxes.assign( 6 * ( TotSurfaces + 1 ), 0.0 );
+		TreeTotSurfaces = TotSurfaces;
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & vertex( Surface( SurfNum ).Vertex );
+			int const NV( Surface( SurfNum ).Sides );
+			if ( NV < 3 ) continue;
+			Real64 * Box( &SurfBoxes[ 6 * SurfNum ] );
+			Real64 const Corner[ 3 ] = { vertex( 1 ).x + vertex( 3 ).x - vertex( 2 ).x, vertex( 1 ).y + vertex( 3 ).y - vertex( 2 ).y, vertex( 1 ).z + vertex( 3 ).z - vertex( 2 ).z }; // Parallelogram corner
+			for ( int i = 0; i < 3; ++i ) {
+				Box[ i ] = Box[ i + 3 ] = Corner[ i ];
+			}
+			for ( int N = 1; N <= NV; ++N ) {
+				Real64 const P[ 3 ] = { vertex( N ).x, vertex( N ).y, vertex( N ).z };
+				for ( int i = 0; i < 3; ++i ) {
+					Box[ i ] = std::min( Box[ i ], P[ i ] );
+					Box[ i + 3 ] = std::max( Box[ i + 3 ], P[ i ] );
+				}
+			}
+			for ( int i = 0; i < 3; ++i ) {
+				Box[ i ] -= BoxPadding;
+				Box[ i + 3 ] += BoxPadding;
+			}
+			TreeSurfNums.push_back( SurfNum );
+		}
+
+		if ( ! TreeSurfNums.empty() ) {
+			TreeNodes.reserve( 2 * TreeSurfNums.size() );
+			BuildTreeNode( 0, TreeSurfNums.size() );
+		}
+
+	}
+
+	void
+	UpdateSurfaceRayTree()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the tree if it has not been built for the current surfaces.  Queries do this
+		// themselves, so loops that query from several threads call it first.
+
+		if ( TreeTotSurfaces != TotSurfaces ) InitSurfaceRayTree();
+
+	}
+
+	static
+	void
+	FindSurfacesAlongRay(
+		Real64 const * O, // Point from which ray originates
+		Real64 const * D, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	)
+	{
+		UpdateSurfaceRayTree();
+
+		SurfNums.clear();
+		if ( TreeNodes.empty() ) return;
+		NodeStack.clear();
+		NodeStack.push_back( 0 );
+		while ( ! NodeStack.empty() ) {
+			TreeNodeData const & Node( TreeNodes[ NodeStack.back() ] );
+			NodeStack.pop_back();
+			if ( ! RayHitsBox( O, D, Node.Lo, Node.Hi ) ) continue;
+			if ( Node.Left < 0 ) { // Leaf: test the surface boxes
+				for ( int n = Node.First; n < Node.First + Node.Count; ++n ) {
+					int const SurfNum( TreeSurfNums[ n ] );
+					if ( RayHitsBox( O, D, &SurfBoxes[ 6 * SurfNum ], &SurfBoxes[ 6 * SurfNum + 3 ] ) ) SurfNums.push_back( SurfNum );
+				}
+			} else {
+				NodeStack.push_back( Node.Right );
+				NodeStack.push_back( Node.Left );
+			}
+		}
+		std::sort( SurfNums.begin(), SurfNums.end() );
+	}
+
+	void
+	SurfacesAlongRay(
+		ObjexxFCL::Array1< Real64 > const & R1, // Point from which ray originates
+		ObjexxFCL::Array1< Real64 > const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the surfaces whose pierce test may succeed for a ray: every other surface is missed.
+
+		Real64 const O[ 3 ] = { R1( 1 ), R1( 2 ), R1( 3 ) };
+		Real64 const D[ 3 ] = { RN( 1 ), RN( 2 ), RN( 3 ) };
+		FindSurfacesAlongRay( O, D, SurfNums );
+
+	}
+
+	void
+	SurfacesAlongRay(
+		ObjexxFCL::Vector3< Real64 > const & R1, // Point from which ray originates
+		ObjexxFCL::Vector3< Real64 > const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	)
+	{
+		Real64 const O[ 3 ] = { R1.x, R1.y, R1.z };
+		Real64 const D[ 3 ] = { RN.x, RN.y, RN.z };
+		FindSurfacesAlongRay( O, D, SurfNums );
+	}
+
+	void
+	SurfacesAlongRay(
+		Vector const & R1, // Point from which ray originates
+		Vector const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	)
+	{
+		Real64 const O[ 3 ] = { R1.x, R1.y, R1.z };
+		Real64 const D[ 3 ] = { RN.x, RN.y, RN.z };
+		FindSurfacesAlongRay( O, D, SurfNums );
+	}
+
+} // SurfaceRayTree
+
+} // EnergyPlus
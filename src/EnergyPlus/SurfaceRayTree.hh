@@ -0,0 +1,60 @@
+#ifndef SurfaceRayTree_hh_INCLUDED
+#define SurfaceRayTree_hh_INCLUDED
+
+// C++ Headers
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1.hh>
+#include <ObjexxFCL/Vector3.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+#include <DataVectorTypes.hh>
+
+namespace EnergyPlus {
+
+namespace SurfaceRayTree {
+
+	// Using/Aliasing
+	using DataVectorTypes::Vector;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const MaxLeafSurfaces; // Surfaces in a leaf of the tree
+	extern Real64 const BoxPadding; // Distance the surface bounding boxes are grown by (m)
+
+	// Functions
+
+	void
+	InitSurfaceRayTree();
+
+	void
+	UpdateSurfaceRayTree();
+
+	void
+	SurfacesAlongRay(
+		ObjexxFCL::Array1< Real64 > const & R1, // Point from which ray originates
+		ObjexxFCL::Array1< Real64 > const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	);
+
+	void
+	SurfacesAlongRay(
+		ObjexxFCL::Vector3< Real64 > const & R1, // Point from which ray originates
+		ObjexxFCL::Vector3< Real64 > const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	);
+
+	void
+	SurfacesAlongRay(
+		Vector const & R1, // Point from which ray originates
+		Vector const & RN, // Direction of ray
+		std::vector< int > & SurfNums // Surfaces the ray may hit, in increasing order
+	);
+
+} // SurfaceRayTree
+
+} // EnergyPlus
+
+#endif
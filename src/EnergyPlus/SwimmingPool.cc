@@ -748,7 +748,7 @@ namespace SwimmingPool {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand, Ho-Sung Kim
 		//       DATE WRITTEN   October 2014
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, evaluate the zone air latent heat once
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -850,6 +850,7 @@ namespace SwimmingPool {
 		Real64 MUWTerm; // Makeup water term for the "surface" heat balance
 		Real64 CpDeltaTi; // inverse of specific heat of water times the plant loop temperature difference
 		Real64 MassFlowRate; // Target mass flow rate to achieve the proper setpoint temperature
+		Real64 HfgAir; // latent heat of vaporization at the zone air conditions
 
 		// FLOW:
 		// initialize local variables
@@ -868,7 +869,8 @@ namespace SwimmingPool {
 		if ( PSatPool < PParAir ) PSatPool = PParAir;
 		EvapRate = ( 0.1 * ( Surface( SurfNum ).Area / CFA ) * Pool( PoolNum ).CurActivityFactor * ( ( PSatPool - PParAir ) * CFinHg ) ) * CFMF * Pool( PoolNum ).CurCoverEvapFac;
 		Pool( PoolNum ).MakeUpWaterMassFlowRate = EvapRate;
-		EvapEnergyLossPerArea = -EvapRate *  PsyHfgAirFnWTdb( ZoneAirHumRatAvg( ZoneNum ), MAT( ZoneNum ) ) / Surface( SurfNum ).Area;
+		HfgAir = PsyHfgAirFnWTdb( ZoneAirHumRatAvg( ZoneNum ), MAT( ZoneNum ) );
+		EvapEnergyLossPerArea = -EvapRate * HfgAir / Surface( SurfNum ).Area;
 		Pool( PoolNum ).EvapHeatLossRate = EvapEnergyLossPerArea * Surface( SurfNum ).Area;
 
 		// LW and SW radiation term modification: any "excess" radiation blocked by the cover gets convected
@@ -918,7 +920,7 @@ namespace SwimmingPool {
 
 		// Finally take care of the latent and convective gains resulting from the pool
 		SumConvPool( ZoneNum ) += Pool( PoolNum ).RadConvertToConvect;
-		SumLatentPool( ZoneNum ) += EvapRate *  PsyHfgAirFnWTdb( ZoneAirHumRatAvg( ZoneNum ), MAT( ZoneNum ) );
+		SumLatentPool( ZoneNum ) += EvapRate * HfgAir;
 	}
 
 	void
@@ -2158,7 +2158,7 @@ namespace SystemAvailabilityManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR            Xiufeng Pang (XP)
 		//       DATE WRITTEN      August 2013
-		//       MODIFIED
+		//       MODIFIED          Oct 2026, find the fan start times once a day
 		//       RE-ENGINEERED
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2167,6 +2167,8 @@ namespace SystemAvailabilityManager {
 		// METHODOLOGY EMPLOYED:
 		// Sets the AvailStatus indicator according to the
 		// optimum start algorithm
+		// The times the fan schedule first turns on today and tomorrow only change with the day,
+		// so they are found from the day schedules at the beginning of each day and kept.
 
 		// REFERENCES:
 
@@ -2234,17 +2236,9 @@ namespace SystemAvailabilityManager {
 		int ATGWCZoneNumLo;
 		static Real64 NumHoursBeforeOccupancy( 0.0 ); // Variable to store the number of hours before occupancy in optimum start period
 
-		// add or use a new variable OptStartSysAvailMgrData(SysAvailNum)%FanSchIndex
 		if ( KickOffSimulation ) {
 			AvailStatus = NoAction;
 		} else {
-			ScheduleIndex = GetScheduleIndex( OptStartSysAvailMgrData( SysAvailNum ).FanSched );
-			JDay = DayOfYear;
-			TmrJDay = JDay + 1;
-			TmrDayOfWeek = DayOfWeekTomorrow;
-
-			DayValues.allocate( NumOfTimeStepInHour, 24 );
-			DayValuesTmr.allocate( NumOfTimeStepInHour, 24 );
 			if ( ! allocated( OptStartData.OptStartFlag ) ) {
 				OptStartData.OptStartFlag.allocate( NumOfZones );
 				OptStartData.OccStartTime.allocate( NumOfZones );
@@ -2252,32 +2246,48 @@ namespace SystemAvailabilityManager {
 			if ( ! allocated( OptStartData.ActualZoneNum ) ) OptStartData.ActualZoneNum.allocate( NumOfZones );
 			OptStartData.OptStartFlag = false;
 			OptStartData.OccStartTime = 99.99; //initialize the zone occupancy start time
-			GetScheduleValuesForDay( ScheduleIndex, DayValues );
-			GetScheduleValuesForDay( ScheduleIndex, DayValuesTmr, TmrJDay, TmrDayOfWeek );
-
-			FanStartTime = 0.0;
-			FanStartTimeTmr = 0.0;
-			for ( I = 1; I <= 24; ++I ) {
-				for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-					if ( DayValues( J, I ) > 0.0 ) {
-						FanStartTime = I - 1 + 1 / NumOfTimeStepInHour * J;
-						goto Loop1_exit;
+
+			if ( BeginDayFlag || OptStartSysAvailMgrData( SysAvailNum ).FanStartTimeDay != DayOfYear ) {
+				ScheduleIndex = OptStartSysAvailMgrData( SysAvailNum ).FanSchedPtr;
+				JDay = DayOfYear;
+				TmrJDay = JDay + 1;
+				TmrDayOfWeek = DayOfWeekTomorrow;
+
+				DayValues.allocate( NumOfTimeStepInHour, 24 );
+				DayValuesTmr.allocate( NumOfTimeStepInHour, 24 );
+				GetScheduleValuesForDay( ScheduleIndex, DayValues );
+				GetScheduleValuesForDay( ScheduleIndex, DayValuesTmr, TmrJDay, TmrDayOfWeek );
+				FanStartTime = 0.0;
+				FanStartTimeTmr = 0.0;
+				for ( I = 1; I <= 24; ++I ) {
+					for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
+						if ( DayValues( J, I ) > 0.0 ) {
+							FanStartTime = I - 1 + 1 / NumOfTimeStepInHour * J;
+							goto Loop1_exit;
+						}
 					}
 				}
-			}
-			Loop1_exit: ;
+				Loop1_exit: ;
 
-			for ( I = 1; I <= 24; ++I ) {
-				for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-					if ( DayValuesTmr( J, I ) > 0.0 ) {
-						FanStartTimeTmr = I - 1 + 1 / NumOfTimeStepInHour * J;
-						goto Loop3_exit;
+				for ( I = 1; I <= 24; ++I ) {
+					for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
+						if ( DayValuesTmr( J, I ) > 0.0 ) {
+							FanStartTimeTmr = I - 1 + 1 / NumOfTimeStepInHour * J;
+							goto Loop3_exit;
+						}
 					}
 				}
-			}
-			Loop3_exit: ;
+				Loop3_exit: ;
+
+				if ( FanStartTimeTmr == 0.0 ) FanStartTimeTmr = 24.0;
 
-			if ( FanStartTimeTmr == 0.0 ) FanStartTimeTmr = 24.0;
+				OptStartSysAvailMgrData( SysAvailNum ).FanStartTimeDay = DayOfYear;
+				OptStartSysAvailMgrData( SysAvailNum ).FanStartTime = FanStartTime;
+				OptStartSysAvailMgrData( SysAvailNum ).FanStartTimeTmr = FanStartTimeTmr;
+			} else {
+				FanStartTime = OptStartSysAvailMgrData( SysAvailNum ).FanStartTime;
+				FanStartTimeTmr = OptStartSysAvailMgrData( SysAvailNum ).FanStartTimeTmr;
+			}
 
 			// Pass the start time to ZoneTempPredictorCorrector
 			for ( I = 1; I <= NumOfZones; ++I ) {
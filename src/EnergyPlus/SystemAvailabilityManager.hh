@@ -264,6 +264,9 @@ namespace SystemAvailabilityManager {
 		int NumPreDays; // Number of previous days for adaptive control
 		int AvailStatus; // reports status of availability manager
 		Real64 NumHoursBeforeOccupancy;
+		int FanStartTimeDay; // Day of year of FanStartTime and FanStartTimeTmr, 0 before they are found
+		Real64 FanStartTime; // Hour the fan schedule first turns on today
+		Real64 FanStartTimeTmr; // Hour the fan schedule first turns on tomorrow
 
 		// Default Constructor
 		DefineOptStartSysAvailManager() :
@@ -285,7 +288,10 @@ namespace SystemAvailabilityManager {
 			ConstStartTime( 2.0 ),
 			NumPreDays( 1 ),
 			AvailStatus( 0 ),
-			NumHoursBeforeOccupancy( 0.0 )
+			NumHoursBeforeOccupancy( 0.0 ),
+			FanStartTimeDay( 0 ),
+			FanStartTime( 0.0 ),
+			FanStartTimeTmr( 0.0 )
 		{}
 
 		// Member Constructor
@@ -338,7 +344,10 @@ namespace SystemAvailabilityManager {
 			ConstStartTime( ConstStartTime ),
 			NumPreDays( NumPreDays ),
 			AvailStatus( AvailStatus ),
-			NumHoursBeforeOccupancy( NumHoursBeforeOccupancy )
+			NumHoursBeforeOccupancy( NumHoursBeforeOccupancy ),
+			FanStartTimeDay( 0 ),
+			FanStartTime( 0.0 ),
+			FanStartTimeTmr( 0.0 )
 		{}
 
 	};
@@ -89,6 +89,177 @@ namespace SystemReports {
 
 	static std::string const BlankString;
 
+	// Component types accounted for by CalcSystemEnergyUse
+	//Tuned String comparisons were a big performance hit
+	// ComponentTypes and component_strings must remain in sync and sorted
+	enum ComponentTypes : std::vector< std::string >::size_type { // Using older enum style to avoid the name scoping cruft
+		AIRLOOPHVAC_OUTDOORAIRSYSTEM,
+		AIRLOOPHVAC_UNITARY_FURNACE_HEATCOOL,
+		AIRLOOPHVAC_UNITARY_FURNACE_HEATONLY,
+		AIRLOOPHVAC_UNITARYHEATCOOL,
+		AIRLOOPHVAC_UNITARYHEATCOOL_VAVCHANGEOVERBYPASS,
+		AIRLOOPHVAC_UNITARYHEATONLY,
+		AIRLOOPHVAC_UNITARYHEATPUMP_AIRTOAIR,
+		AIRLOOPHVAC_UNITARYHEATPUMP_AIRTOAIR_MULTISPEED,
+		AIRLOOPHVAC_UNITARYHEATPUMP_WATERTOAIR,
+		AIRLOOPHVAC_UNITARYSYSTEM,
+		AIRTERMINAL_DUALDUCT_CONSTANTVOLUME_COOL,
+		AIRTERMINAL_DUALDUCT_CONSTANTVOLUME_HEAT,
+		AIRTERMINAL_DUALDUCT_VAV_COOL,
+		AIRTERMINAL_DUALDUCT_VAV_HEAT,
+		AIRTERMINAL_DUALDUCT_VAV_OUTDOORAIR_OUTDOORAIR,
+		AIRTERMINAL_DUALDUCT_VAV_OUTDOORAIR_RECIRCULATEDAIR,
+		AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_COOLEDBEAM,
+		AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_FOURPIPEINDUCTION,
+		AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_REHEAT,
+		AIRTERMINAL_SINGLEDUCT_INLETSIDEMIXER,
+		AIRTERMINAL_SINGLEDUCT_PARALLELPIU_REHEAT,
+		AIRTERMINAL_SINGLEDUCT_SERIESPIU_REHEAT,
+		AIRTERMINAL_SINGLEDUCT_SUPPLYSIDEMIXER,
+		AIRTERMINAL_SINGLEDUCT_UNCONTROLLED,
+		AIRTERMINAL_SINGLEDUCT_USERDEFINED,
+		AIRTERMINAL_SINGLEDUCT_VAV_HEATANDCOOL_NOREHEAT,
+		AIRTERMINAL_SINGLEDUCT_VAV_HEATANDCOOL_REHEAT,
+		AIRTERMINAL_SINGLEDUCT_VAV_NOREHEAT,
+		AIRTERMINAL_SINGLEDUCT_VAV_REHEAT,
+		AIRTERMINAL_SINGLEDUCT_VAV_REHEAT_VARIABLESPEEDFAN,
+		COIL_COOLING_DX_MULTISPEED,
+		COIL_COOLING_DX_SINGLESPEED,
+		COIL_COOLING_DX_SINGLESPEED_THERMALSTORAGE,
+		COIL_COOLING_DX_TWOSPEED,
+		COIL_COOLING_DX_TWOSTAGEWITHHUMIDITYCONTROLMODE,
+		COIL_COOLING_DX_VARIABLESPEED,
+		COIL_COOLING_WATER,
+		COIL_COOLING_WATER_DETAILEDGEOMETRY,
+		COIL_COOLING_WATERTOAIRHEATPUMP_EQUATIONFIT,
+		COIL_COOLING_WATERTOAIRHEATPUMP_PARAMETERESTIMATION,
+		COIL_COOLING_WATERTOAIRHEATPUMP_VARIABLESPEEDEQUATIONFIT,
+		COIL_HEATING_DESUPERHEATER,
+		COIL_HEATING_DX_MULTISPEED,
+		COIL_HEATING_DX_SINGLESPEED,
+		COIL_HEATING_DX_VARIABLESPEED,
+		COIL_HEATING_ELECTRIC,
+		COIL_HEATING_ELECTRIC_MULTISTAGE,
+		COIL_HEATING_GAS,
+		COIL_HEATING_GAS_MULTISTAGE,
+		COIL_HEATING_STEAM,
+		COIL_HEATING_WATER,
+		COIL_HEATING_WATERTOAIRHEATPUMP_EQUATIONFIT,
+		COIL_HEATING_WATERTOAIRHEATPUMP_PARAMETERESTIMATION,
+		COIL_HEATING_WATERTOAIRHEATPUMP_VARIABLESPEEDEQUATIONFIT,
+		COIL_USERDEFINED,
+		COILSYSTEM_COOLING_DX,
+		COILSYSTEM_COOLING_DX_HEATEXCHANGERASSISTED,
+		COILSYSTEM_COOLING_WATER_HEATEXCHANGERASSISTED,
+		COILSYSTEM_HEATING_DX,
+		DEHUMIDIFIER_DESICCANT_NOFANS,
+		DEHUMIDIFIER_DESICCANT_SYSTEM,
+		DUCT,
+		EVAPORATIVECOOLER_DIRECT_CELDEKPAD,
+		EVAPORATIVECOOLER_DIRECT_RESEARCHSPECIAL,
+		EVAPORATIVECOOLER_INDIRECT_CELDEKPAD,
+		EVAPORATIVECOOLER_INDIRECT_RESEARCHSPECIAL,
+		EVAPORATIVECOOLER_INDIRECT_WETCOIL,
+		FAN_COMPONENTMODEL,
+		FAN_CONSTANTVOLUME,
+		FAN_ONOFF,
+		FAN_VARIABLEVOLUME,
+		HEATEXCHANGER_AIRTOAIR_FLATPLATE,
+		HEATEXCHANGER_AIRTOAIR_SENSIBLEANDLATENT,
+		HEATEXCHANGER_DESICCANT_BALANCEDFLOW,
+		HUMIDIFIER_STEAM_ELECTRIC,
+		HUMIDIFIER_STEAM_GAS,
+		OUTDOORAIR_MIXER,
+		SOLARCOLLECTOR_FLATPLATE_PHOTOVOLTAICTHERMAL,
+		SOLARCOLLECTOR_UNGLAZEDTRANSPIRED,
+		ZONEHVAC_AIRDISTRIBUTIONUNIT,
+		n_ComponentTypes,
+		Unknown_ComponentType
+	};
+
+	static std::vector< std::string > const component_strings = { // Must be sorted!
+		"AIRLOOPHVAC:OUTDOORAIRSYSTEM",
+		"AIRLOOPHVAC:UNITARY:FURNACE:HEATCOOL",
+		"AIRLOOPHVAC:UNITARY:FURNACE:HEATONLY",
+		"AIRLOOPHVAC:UNITARYHEATCOOL",
+		"AIRLOOPHVAC:UNITARYHEATCOOL:VAVCHANGEOVERBYPASS",
+		"AIRLOOPHVAC:UNITARYHEATONLY",
+		"AIRLOOPHVAC:UNITARYHEATPUMP:AIRTOAIR",
+		"AIRLOOPHVAC:UNITARYHEATPUMP:AIRTOAIR:MULTISPEED",
+		"AIRLOOPHVAC:UNITARYHEATPUMP:WATERTOAIR",
+		"AIRLOOPHVAC:UNITARYSYSTEM",
+		"AIRTERMINAL:DUALDUCT:CONSTANTVOLUME:COOL",
+		"AIRTERMINAL:DUALDUCT:CONSTANTVOLUME:HEAT",
+		"AIRTERMINAL:DUALDUCT:VAV:COOL",
+		"AIRTERMINAL:DUALDUCT:VAV:HEAT",
+		"AIRTERMINAL:DUALDUCT:VAV:OUTDOORAIR:OUTDOORAIR",
+		"AIRTERMINAL:DUALDUCT:VAV:OUTDOORAIR:RECIRCULATEDAIR",
+		"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:COOLEDBEAM",
+		"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:FOURPIPEINDUCTION",
+		"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:REHEAT",
+		"AIRTERMINAL:SINGLEDUCT:INLETSIDEMIXER",
+		"AIRTERMINAL:SINGLEDUCT:PARALLELPIU:REHEAT",
+		"AIRTERMINAL:SINGLEDUCT:SERIESPIU:REHEAT",
+		"AIRTERMINAL:SINGLEDUCT:SUPPLYSIDEMIXER",
+		"AIRTERMINAL:SINGLEDUCT:UNCONTROLLED",
+		"AIRTERMINAL:SINGLEDUCT:USERDEFINED",
+		"AIRTERMINAL:SINGLEDUCT:VAV:HEATANDCOOL:NOREHEAT",
+		"AIRTERMINAL:SINGLEDUCT:VAV:HEATANDCOOL:REHEAT",
+		"AIRTERMINAL:SINGLEDUCT:VAV:NOREHEAT",
+		"AIRTERMINAL:SINGLEDUCT:VAV:REHEAT",
+		"AIRTERMINAL:SINGLEDUCT:VAV:REHEAT:VARIABLESPEEDFAN",
+		"COIL:COOLING:DX:MULTISPEED",
+		"COIL:COOLING:DX:SINGLESPEED",
+		"COIL:COOLING:DX:SINGLESPEED:THERMALSTORAGE",
+		"COIL:COOLING:DX:TWOSPEED",
+		"COIL:COOLING:DX:TWOSTAGEWITHHUMIDITYCONTROLMODE",
+		"COIL:COOLING:DX:VARIABLESPEED",
+		"COIL:COOLING:WATER",
+		"COIL:COOLING:WATER:DETAILEDGEOMETRY",
+		"COIL:COOLING:WATERTOAIRHEATPUMP:EQUATIONFIT",
+		"COIL:COOLING:WATERTOAIRHEATPUMP:PARAMETERESTIMATION",
+		"COIL:COOLING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT",
+		"COIL:HEATING:DESUPERHEATER",
+		"COIL:HEATING:DX:MULTISPEED",
+		"COIL:HEATING:DX:SINGLESPEED",
+		"COIL:HEATING:DX:VARIABLESPEED",
+		"COIL:HEATING:ELECTRIC",
+		"COIL:HEATING:ELECTRIC:MULTISTAGE",
+		"COIL:HEATING:GAS",
+		"COIL:HEATING:GAS:MULTISTAGE",
+		"COIL:HEATING:STEAM",
+		"COIL:HEATING:WATER",
+		"COIL:HEATING:WATERTOAIRHEATPUMP:EQUATIONFIT",
+		"COIL:HEATING:WATERTOAIRHEATPUMP:PARAMETERESTIMATION",
+		"COIL:HEATING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT",
+		"COIL:USERDEFINED",
+		"COILSYSTEM:COOLING:DX",
+		"COILSYSTEM:COOLING:DX:HEATEXCHANGERASSISTED",
+		"COILSYSTEM:COOLING:WATER:HEATEXCHANGERASSISTED",
+		"COILSYSTEM:HEATING:DX",
+		"DEHUMIDIFIER:DESICCANT:NOFANS",
+		"DEHUMIDIFIER:DESICCANT:SYSTEM",
+		"DUCT",
+		"EVAPORATIVECOOLER:DIRECT:CELDEKPAD",
+		"EVAPORATIVECOOLER:DIRECT:RESEARCHSPECIAL",
+		"EVAPORATIVECOOLER:INDIRECT:CELDEKPAD",
+		"EVAPORATIVECOOLER:INDIRECT:RESEARCHSPECIAL",
+		"EVAPORATIVECOOLER:INDIRECT:WETCOIL",
+		"FAN:COMPONENTMODEL",
+		"FAN:CONSTANTVOLUME",
+		"FAN:ONOFF",
+		"FAN:VARIABLEVOLUME",
+		"HEATEXCHANGER:AIRTOAIR:FLATPLATE",
+		"HEATEXCHANGER:AIRTOAIR:SENSIBLEANDLATENT",
+		"HEATEXCHANGER:DESICCANT:BALANCEDFLOW",
+		"HUMIDIFIER:STEAM:ELECTRIC",
+		"HUMIDIFIER:STEAM:GAS",
+		"OUTDOORAIR:MIXER",
+		"SOLARCOLLECTOR:FLATPLATE:PHOTOVOLTAICTHERMAL",
+		"SOLARCOLLECTOR:UNGLAZEDTRANSPIRED",
+		"ZONEHVAC:AIRDISTRIBUTIONUNIT"
+	};
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -2925,7 +3096,7 @@ namespace SystemReports {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dan Fisher
 		//       DATE WRITTEN   November 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, look up each component's report type once instead of every call
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2957,8 +3128,6 @@ namespace SystemReports {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		std::string CompType;
-		std::string CompName;
 		int Idx; // loop counter
 		int nodes; // loop counter
 		int CtrlZoneNum; // ZONE counter
@@ -2970,7 +3139,6 @@ namespace SystemReports {
 		int CompNum;
 		int SubCompNum;
 		int SubSubCompNum;
-		int CompMode;
 		int InletNodeNum;
 		int OutletNodeNum;
 		int ADUNum;
@@ -3034,66 +3202,65 @@ namespace SystemReports {
 		SysEvapElec = 0.0;
 
 		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
-			for ( BranchNum = 1; BranchNum <= PrimaryAirSystem( AirLoopNum ).NumBranches; ++BranchNum ) {
-				if ( Node( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).NodeNumOut ).MassFlowRate <= 0.0 ) continue;
-				for ( CompNum = 1; CompNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).TotalComponents; ++CompNum ) {
-					CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name;
-					CompType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).TypeOf;
-					InletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).NodeNumIn;
-					OutletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).NodeNumOut;
+			auto & primaryAirSystem( PrimaryAirSystem( AirLoopNum ) );
+			for ( BranchNum = 1; BranchNum <= primaryAirSystem.NumBranches; ++BranchNum ) {
+				auto & branch( primaryAirSystem.Branch( BranchNum ) );
+				if ( Node( branch.NodeNumOut ).MassFlowRate <= 0.0 ) continue;
+				for ( CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+					auto & comp( branch.Comp( CompNum ) );
+					InletNodeNum = comp.NodeNumIn;
+					OutletNodeNum = comp.NodeNumOut;
 					if ( InletNodeNum <= 0 || OutletNodeNum <= 0 ) continue;
+					if ( comp.SysRptCompType < 0 ) comp.SysRptCompType = SystemEnergyUseCompType( comp.TypeOf );
 					CompLoad = Node( OutletNodeNum ).MassFlowRate * ( PsyHFnTdbW( Node( InletNodeNum ).Temp, Node( InletNodeNum ).HumRat ) - PsyHFnTdbW( Node( OutletNodeNum ).Temp, Node( OutletNodeNum ).HumRat ) );
 					CompLoad *= TimeStepSys * SecInHour;
 					CompEnergyUse = 0.0;
 					EnergyType = iRT_None;
 					CompLoadFlag = true;
-					CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+					CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, comp.TypeOf, comp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 					CompLoadFlag = false;
-					for ( VarNum = 1; VarNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).NumMeteredVars; ++VarNum ) {
-						CompMode = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).MeteredVar( VarNum ).EndUse_CompMode;
-						CompEnergyUse = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).MeteredVar( VarNum ).CurMeterReading;
-						EnergyType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).MeteredVar( VarNum ).ResourceType;
-						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+					for ( VarNum = 1; VarNum <= comp.NumMeteredVars; ++VarNum ) {
+						CompEnergyUse = comp.MeteredVar( VarNum ).CurMeterReading;
+						EnergyType = comp.MeteredVar( VarNum ).ResourceType;
+						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, comp.TypeOf, comp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 					}
 
-					for ( SubCompNum = 1; SubCompNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).NumSubComps; ++SubCompNum ) {
-						CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).Name;
-						CompType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).TypeOf;
-						InletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).NodeNumIn;
+					for ( SubCompNum = 1; SubCompNum <= comp.NumSubComps; ++SubCompNum ) {
+						auto & subComp( comp.SubComp( SubCompNum ) );
+						InletNodeNum = subComp.NodeNumIn;
 						if ( InletNodeNum <= 0 || OutletNodeNum <= 0 ) continue;
-						OutletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).NodeNumOut;
+						OutletNodeNum = subComp.NodeNumOut;
+						if ( subComp.SysRptCompType < 0 ) subComp.SysRptCompType = SystemEnergyUseCompType( subComp.TypeOf );
 						CompLoad = Node( OutletNodeNum ).MassFlowRate * ( PsyHFnTdbW( Node( InletNodeNum ).Temp, Node( InletNodeNum ).HumRat ) - PsyHFnTdbW( Node( OutletNodeNum ).Temp, Node( OutletNodeNum ).HumRat ) );
 						CompLoad *= TimeStepSys * SecInHour;
 						CompEnergyUse = 0.0;
 						EnergyType = iRT_None;
 						CompLoadFlag = true;
-						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subComp.TypeOf, subComp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 						CompLoadFlag = false;
-						for ( VarNum = 1; VarNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).NumMeteredVars; ++VarNum ) {
-							CompMode = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).MeteredVar( VarNum ).EndUse_CompMode;
-							CompEnergyUse = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).MeteredVar( VarNum ).CurMeterReading;
-							EnergyType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).MeteredVar( VarNum ).ResourceType;
-							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+						for ( VarNum = 1; VarNum <= subComp.NumMeteredVars; ++VarNum ) {
+							CompEnergyUse = subComp.MeteredVar( VarNum ).CurMeterReading;
+							EnergyType = subComp.MeteredVar( VarNum ).ResourceType;
+							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subComp.TypeOf, subComp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 						}
 
-						for ( SubSubCompNum = 1; SubSubCompNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).NumSubSubComps; ++SubSubCompNum ) {
-							CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).Name;
-							CompType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).TypeOf;
-							InletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).NodeNumIn;
-							OutletNodeNum = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).NodeNumOut;
+						for ( SubSubCompNum = 1; SubSubCompNum <= subComp.NumSubSubComps; ++SubSubCompNum ) {
+							auto & subSubComp( subComp.SubSubComp( SubSubCompNum ) );
+							InletNodeNum = subSubComp.NodeNumIn;
+							OutletNodeNum = subSubComp.NodeNumOut;
 							if ( InletNodeNum <= 0 || OutletNodeNum <= 0 ) continue;
+							if ( subSubComp.SysRptCompType < 0 ) subSubComp.SysRptCompType = SystemEnergyUseCompType( subSubComp.TypeOf );
 							CompLoad = Node( OutletNodeNum ).MassFlowRate * ( PsyHFnTdbW( Node( InletNodeNum ).Temp, Node( InletNodeNum ).HumRat ) - PsyHFnTdbW( Node( OutletNodeNum ).Temp, Node( OutletNodeNum ).HumRat ) );
 							CompLoad *= TimeStepSys * SecInHour;
 							CompEnergyUse = 0.0;
 							EnergyType = iRT_None;
 							CompLoadFlag = true;
-							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subSubComp.TypeOf, subSubComp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 							CompLoadFlag = false;
-							for ( VarNum = 1; VarNum <= PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).NumMeteredVars; ++VarNum ) {
-								CompMode = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).MeteredVar( VarNum ).EndUse_CompMode;
-								CompEnergyUse = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).MeteredVar( VarNum ).CurMeterReading;
-								EnergyType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).SubComp( SubCompNum ).SubSubComp( SubSubCompNum ).MeteredVar( VarNum ).ResourceType;
-								CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+							for ( VarNum = 1; VarNum <= subSubComp.NumMeteredVars; ++VarNum ) {
+								CompEnergyUse = subSubComp.MeteredVar( VarNum ).CurMeterReading;
+								EnergyType = subSubComp.MeteredVar( VarNum ).ResourceType;
+								CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subSubComp.TypeOf, subSubComp.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 							}
 
 						}
@@ -3165,57 +3332,55 @@ namespace SystemReports {
 						}
 					}
 					CompLoad *= TimeStepSys * SecInHour;
-					CompName = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).Name;
-					CompType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).TypeOf;
+					auto & equipData( ZoneEquipList( EquipListNum ).EquipData( ADUNum ) );
+					if ( equipData.SysRptCompType < 0 ) equipData.SysRptCompType = SystemEnergyUseCompType( equipData.TypeOf );
 					CompEnergyUse = 0.0;
 					EnergyType = iRT_None;
 					CompLoadFlag = true;
-					CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+					CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, equipData.TypeOf, equipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 					CompLoadFlag = false;
-					for ( VarNum = 1; VarNum <= ZoneEquipList( EquipListNum ).EquipData( ADUNum ).NumMeteredVars; ++VarNum ) {
-						CompEnergyUse = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).MeteredVar( VarNum ).CurMeterReading;
-						EnergyType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).MeteredVar( VarNum ).ResourceType;
-						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+					for ( VarNum = 1; VarNum <= equipData.NumMeteredVars; ++VarNum ) {
+						CompEnergyUse = equipData.MeteredVar( VarNum ).CurMeterReading;
+						EnergyType = equipData.MeteredVar( VarNum ).ResourceType;
+						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, equipData.TypeOf, equipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 					}
 
-					for ( SubCompNum = 1; SubCompNum <= ZoneEquipList( EquipListNum ).EquipData( ADUNum ).NumSubEquip; ++SubCompNum ) {
-						CompName = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).Name;
-						CompType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).TypeOf;
-						InletNodeNum = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).InletNodeNum;
-						OutletNodeNum = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).OutletNodeNum;
+					for ( SubCompNum = 1; SubCompNum <= equipData.NumSubEquip; ++SubCompNum ) {
+						auto & subEquipData( equipData.SubEquipData( SubCompNum ) );
+						InletNodeNum = subEquipData.InletNodeNum;
+						OutletNodeNum = subEquipData.OutletNodeNum;
 						if ( InletNodeNum <= 0 || OutletNodeNum <= 0 ) continue;
+						if ( subEquipData.SysRptCompType < 0 ) subEquipData.SysRptCompType = SystemEnergyUseCompType( subEquipData.TypeOf );
 						CompLoad = Node( InletNodeNum ).MassFlowRate * ( PsyHFnTdbW( Node( InletNodeNum ).Temp, Node( InletNodeNum ).HumRat ) - PsyHFnTdbW( Node( OutletNodeNum ).Temp, Node( OutletNodeNum ).HumRat ) );
 						CompLoad *= TimeStepSys * SecInHour;
 						CompEnergyUse = 0.0;
 						EnergyType = iRT_None;
 						CompLoadFlag = true;
-						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+						CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subEquipData.TypeOf, subEquipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 						CompLoadFlag = false;
-						for ( VarNum = 1; VarNum <= ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).NumMeteredVars; ++VarNum ) {
-							CompEnergyUse = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).MeteredVar( VarNum ).CurMeterReading;
-							CompMode = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).MeteredVar( VarNum ).EndUse_CompMode;
-							EnergyType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).MeteredVar( VarNum ).ResourceType;
-							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+						for ( VarNum = 1; VarNum <= subEquipData.NumMeteredVars; ++VarNum ) {
+							CompEnergyUse = subEquipData.MeteredVar( VarNum ).CurMeterReading;
+							EnergyType = subEquipData.MeteredVar( VarNum ).ResourceType;
+							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subEquipData.TypeOf, subEquipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 						}
 
-						for ( SubSubCompNum = 1; SubSubCompNum <= ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).NumSubSubEquip; ++SubSubCompNum ) {
-							CompName = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).Name;
-							CompType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).TypeOf;
-							InletNodeNum = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).InletNodeNum;
-							OutletNodeNum = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).OutletNodeNum;
+						for ( SubSubCompNum = 1; SubSubCompNum <= subEquipData.NumSubSubEquip; ++SubSubCompNum ) {
+							auto & subSubEquipData( subEquipData.SubSubEquipData( SubSubCompNum ) );
+							InletNodeNum = subSubEquipData.InletNodeNum;
+							OutletNodeNum = subSubEquipData.OutletNodeNum;
 							if ( InletNodeNum <= 0 || OutletNodeNum <= 0 ) continue;
+							if ( subSubEquipData.SysRptCompType < 0 ) subSubEquipData.SysRptCompType = SystemEnergyUseCompType( subSubEquipData.TypeOf );
 							CompLoad = Node( InletNodeNum ).MassFlowRate * ( PsyHFnTdbW( Node( InletNodeNum ).Temp, Node( InletNodeNum ).HumRat ) - PsyHFnTdbW( Node( OutletNodeNum ).Temp, Node( OutletNodeNum ).HumRat ) );
 							CompLoad *= TimeStepSys * SecInHour;
 							CompEnergyUse = 0.0;
 							EnergyType = iRT_None;
 							CompLoadFlag = true;
-							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+							CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subSubEquipData.TypeOf, subSubEquipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 							CompLoadFlag = false;
-							for ( VarNum = 1; VarNum <= ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).NumMeteredVars; ++VarNum ) {
-								CompEnergyUse = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).MeteredVar( VarNum ).CurMeterReading;
-								CompMode = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).MeteredVar( VarNum ).EndUse_CompMode;
-								EnergyType = ZoneEquipList( EquipListNum ).EquipData( ADUNum ).SubEquipData( SubCompNum ).SubSubEquipData( SubSubCompNum ).MeteredVar( VarNum ).ResourceType;
-								CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, CompType, EnergyType, CompLoad, CompEnergyUse );
+							for ( VarNum = 1; VarNum <= subSubEquipData.NumMeteredVars; ++VarNum ) {
+								CompEnergyUse = subSubEquipData.MeteredVar( VarNum ).CurMeterReading;
+								EnergyType = subSubEquipData.MeteredVar( VarNum ).ResourceType;
+								CalcSystemEnergyUse( CompLoadFlag, AirLoopNum, subSubEquipData.TypeOf, subSubEquipData.SysRptCompType, EnergyType, CompLoad, CompEnergyUse );
 							}
 						} //SubSubCompNum
 					} //SubCompNum
@@ -3283,11 +3448,36 @@ namespace SystemReports {
 		}
 	}
 
+	int
+	SystemEnergyUseCompType( std::string const & CompType )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Find the CalcSystemEnergyUse component type for a component type string.
+		// Callers keep the result with the component so the lookup is only done once.
+
+		assert( std::is_sorted( component_strings.begin(), component_strings.end() ) );
+		assert( component_strings.size() == n_ComponentTypes );
+
+		std::vector< std::string >::size_type iCompType;
+		if ( index_in_sorted_string_vector( component_strings, CompType, iCompType ) ) {
+			return int( iCompType );
+		} else {
+			return int( Unknown_ComponentType );
+		}
+	}
+
 	void
 	CalcSystemEnergyUse(
 		bool const CompLoadFlag,
 		int const AirLoopNum,
 		std::string const & CompType,
+		int const CompTypeNum, // component type index from SystemEnergyUseCompType
 		int const EnergyType,
 		Real64 const CompLoad,
 		Real64 const CompEnergy
@@ -3296,7 +3486,7 @@ namespace SystemReports {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dan Fisher
 		//       DATE WRITTEN   Nov. 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, component type looked up by caller via SystemEnergyUseCompType
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3319,177 +3509,6 @@ namespace SystemReports {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 
-		//Tuned String comparisons were a big performance hit
-		// ComponentTypes and component_strings must remain in sync and sorted
-		enum ComponentTypes : std::vector< std::string >::size_type { // Using older enum style to avoid the name scoping cruft
-			AIRLOOPHVAC_OUTDOORAIRSYSTEM,
-			AIRLOOPHVAC_UNITARY_FURNACE_HEATCOOL,
-			AIRLOOPHVAC_UNITARY_FURNACE_HEATONLY,
-			AIRLOOPHVAC_UNITARYHEATCOOL,
-			AIRLOOPHVAC_UNITARYHEATCOOL_VAVCHANGEOVERBYPASS,
-			AIRLOOPHVAC_UNITARYHEATONLY,
-			AIRLOOPHVAC_UNITARYHEATPUMP_AIRTOAIR,
-			AIRLOOPHVAC_UNITARYHEATPUMP_AIRTOAIR_MULTISPEED,
-			AIRLOOPHVAC_UNITARYHEATPUMP_WATERTOAIR,
-			AIRLOOPHVAC_UNITARYSYSTEM,
-			AIRTERMINAL_DUALDUCT_CONSTANTVOLUME_COOL,
-			AIRTERMINAL_DUALDUCT_CONSTANTVOLUME_HEAT,
-			AIRTERMINAL_DUALDUCT_VAV_COOL,
-			AIRTERMINAL_DUALDUCT_VAV_HEAT,
-			AIRTERMINAL_DUALDUCT_VAV_OUTDOORAIR_OUTDOORAIR,
-			AIRTERMINAL_DUALDUCT_VAV_OUTDOORAIR_RECIRCULATEDAIR,
-			AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_COOLEDBEAM,
-			AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_FOURPIPEINDUCTION,
-			AIRTERMINAL_SINGLEDUCT_CONSTANTVOLUME_REHEAT,
-			AIRTERMINAL_SINGLEDUCT_INLETSIDEMIXER,
-			AIRTERMINAL_SINGLEDUCT_PARALLELPIU_REHEAT,
-			AIRTERMINAL_SINGLEDUCT_SERIESPIU_REHEAT,
-			AIRTERMINAL_SINGLEDUCT_SUPPLYSIDEMIXER,
-			AIRTERMINAL_SINGLEDUCT_UNCONTROLLED,
-			AIRTERMINAL_SINGLEDUCT_USERDEFINED,
-			AIRTERMINAL_SINGLEDUCT_VAV_HEATANDCOOL_NOREHEAT,
-			AIRTERMINAL_SINGLEDUCT_VAV_HEATANDCOOL_REHEAT,
-			AIRTERMINAL_SINGLEDUCT_VAV_NOREHEAT,
-			AIRTERMINAL_SINGLEDUCT_VAV_REHEAT,
-			AIRTERMINAL_SINGLEDUCT_VAV_REHEAT_VARIABLESPEEDFAN,
-			COIL_COOLING_DX_MULTISPEED,
-			COIL_COOLING_DX_SINGLESPEED,
-			COIL_COOLING_DX_SINGLESPEED_THERMALSTORAGE,
-			COIL_COOLING_DX_TWOSPEED,
-			COIL_COOLING_DX_TWOSTAGEWITHHUMIDITYCONTROLMODE,
-			COIL_COOLING_DX_VARIABLESPEED,
-			COIL_COOLING_WATER,
-			COIL_COOLING_WATER_DETAILEDGEOMETRY,
-			COIL_COOLING_WATERTOAIRHEATPUMP_EQUATIONFIT,
-			COIL_COOLING_WATERTOAIRHEATPUMP_PARAMETERESTIMATION,
-			COIL_COOLING_WATERTOAIRHEATPUMP_VARIABLESPEEDEQUATIONFIT,
-			COIL_HEATING_DESUPERHEATER,
-			COIL_HEATING_DX_MULTISPEED,
-			COIL_HEATING_DX_SINGLESPEED,
-			COIL_HEATING_DX_VARIABLESPEED,
-			COIL_HEATING_ELECTRIC,
-			COIL_HEATING_ELECTRIC_MULTISTAGE,
-			COIL_HEATING_GAS,
-			COIL_HEATING_GAS_MULTISTAGE,
-			COIL_HEATING_STEAM,
-			COIL_HEATING_WATER,
-			COIL_HEATING_WATERTOAIRHEATPUMP_EQUATIONFIT,
-			COIL_HEATING_WATERTOAIRHEATPUMP_PARAMETERESTIMATION,
-			COIL_HEATING_WATERTOAIRHEATPUMP_VARIABLESPEEDEQUATIONFIT,
-			COIL_USERDEFINED,
-			COILSYSTEM_COOLING_DX,
-			COILSYSTEM_COOLING_DX_HEATEXCHANGERASSISTED,
-			COILSYSTEM_COOLING_WATER_HEATEXCHANGERASSISTED,
-			COILSYSTEM_HEATING_DX,
-			DEHUMIDIFIER_DESICCANT_NOFANS,
-			DEHUMIDIFIER_DESICCANT_SYSTEM,
-			DUCT,
-			EVAPORATIVECOOLER_DIRECT_CELDEKPAD,
-			EVAPORATIVECOOLER_DIRECT_RESEARCHSPECIAL,
-			EVAPORATIVECOOLER_INDIRECT_CELDEKPAD,
-			EVAPORATIVECOOLER_INDIRECT_RESEARCHSPECIAL,
-			EVAPORATIVECOOLER_INDIRECT_WETCOIL,
-			FAN_COMPONENTMODEL,
-			FAN_CONSTANTVOLUME,
-			FAN_ONOFF,
-			FAN_VARIABLEVOLUME,
-			HEATEXCHANGER_AIRTOAIR_FLATPLATE,
-			HEATEXCHANGER_AIRTOAIR_SENSIBLEANDLATENT,
-			HEATEXCHANGER_DESICCANT_BALANCEDFLOW,
-			HUMIDIFIER_STEAM_ELECTRIC,
-			HUMIDIFIER_STEAM_GAS,
-			OUTDOORAIR_MIXER,
-			SOLARCOLLECTOR_FLATPLATE_PHOTOVOLTAICTHERMAL,
-			SOLARCOLLECTOR_UNGLAZEDTRANSPIRED,
-			ZONEHVAC_AIRDISTRIBUTIONUNIT,
-			n_ComponentTypes,
-			Unknown_ComponentType
-		};
-
-		static std::vector< std::string > const component_strings = { // Must be sorted!
-			"AIRLOOPHVAC:OUTDOORAIRSYSTEM",
-			"AIRLOOPHVAC:UNITARY:FURNACE:HEATCOOL",
-			"AIRLOOPHVAC:UNITARY:FURNACE:HEATONLY",
-			"AIRLOOPHVAC:UNITARYHEATCOOL",
-			"AIRLOOPHVAC:UNITARYHEATCOOL:VAVCHANGEOVERBYPASS",
-			"AIRLOOPHVAC:UNITARYHEATONLY",
-			"AIRLOOPHVAC:UNITARYHEATPUMP:AIRTOAIR",
-			"AIRLOOPHVAC:UNITARYHEATPUMP:AIRTOAIR:MULTISPEED",
-			"AIRLOOPHVAC:UNITARYHEATPUMP:WATERTOAIR",
-			"AIRLOOPHVAC:UNITARYSYSTEM",
-			"AIRTERMINAL:DUALDUCT:CONSTANTVOLUME:COOL",
-			"AIRTERMINAL:DUALDUCT:CONSTANTVOLUME:HEAT",
-			"AIRTERMINAL:DUALDUCT:VAV:COOL",
-			"AIRTERMINAL:DUALDUCT:VAV:HEAT",
-			"AIRTERMINAL:DUALDUCT:VAV:OUTDOORAIR:OUTDOORAIR",
-			"AIRTERMINAL:DUALDUCT:VAV:OUTDOORAIR:RECIRCULATEDAIR",
-			"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:COOLEDBEAM",
-			"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:FOURPIPEINDUCTION",
-			"AIRTERMINAL:SINGLEDUCT:CONSTANTVOLUME:REHEAT",
-			"AIRTERMINAL:SINGLEDUCT:INLETSIDEMIXER",
-			"AIRTERMINAL:SINGLEDUCT:PARALLELPIU:REHEAT",
-			"AIRTERMINAL:SINGLEDUCT:SERIESPIU:REHEAT",
-			"AIRTERMINAL:SINGLEDUCT:SUPPLYSIDEMIXER",
-			"AIRTERMINAL:SINGLEDUCT:UNCONTROLLED",
-			"AIRTERMINAL:SINGLEDUCT:USERDEFINED",
-			"AIRTERMINAL:SINGLEDUCT:VAV:HEATANDCOOL:NOREHEAT",
-			"AIRTERMINAL:SINGLEDUCT:VAV:HEATANDCOOL:REHEAT",
-			"AIRTERMINAL:SINGLEDUCT:VAV:NOREHEAT",
-			"AIRTERMINAL:SINGLEDUCT:VAV:REHEAT",
-			"AIRTERMINAL:SINGLEDUCT:VAV:REHEAT:VARIABLESPEEDFAN",
-			"COIL:COOLING:DX:MULTISPEED",
-			"COIL:COOLING:DX:SINGLESPEED",
-			"COIL:COOLING:DX:SINGLESPEED:THERMALSTORAGE",
-			"COIL:COOLING:DX:TWOSPEED",
-			"COIL:COOLING:DX:TWOSTAGEWITHHUMIDITYCONTROLMODE",
-			"COIL:COOLING:DX:VARIABLESPEED",
-			"COIL:COOLING:WATER",
-			"COIL:COOLING:WATER:DETAILEDGEOMETRY",
-			"COIL:COOLING:WATERTOAIRHEATPUMP:EQUATIONFIT",
-			"COIL:COOLING:WATERTOAIRHEATPUMP:PARAMETERESTIMATION",
-			"COIL:COOLING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT",
-			"COIL:HEATING:DESUPERHEATER",
-			"COIL:HEATING:DX:MULTISPEED",
-			"COIL:HEATING:DX:SINGLESPEED",
-			"COIL:HEATING:DX:VARIABLESPEED",
-			"COIL:HEATING:ELECTRIC",
-			"COIL:HEATING:ELECTRIC:MULTISTAGE",
-			"COIL:HEATING:GAS",
-			"COIL:HEATING:GAS:MULTISTAGE",
-			"COIL:HEATING:STEAM",
-			"COIL:HEATING:WATER",
-			"COIL:HEATING:WATERTOAIRHEATPUMP:EQUATIONFIT",
-			"COIL:HEATING:WATERTOAIRHEATPUMP:PARAMETERESTIMATION",
-			"COIL:HEATING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT",
-			"COIL:USERDEFINED",
-			"COILSYSTEM:COOLING:DX",
-			"COILSYSTEM:COOLING:DX:HEATEXCHANGERASSISTED",
-			"COILSYSTEM:COOLING:WATER:HEATEXCHANGERASSISTED",
-			"COILSYSTEM:HEATING:DX",
-			"DEHUMIDIFIER:DESICCANT:NOFANS",
-			"DEHUMIDIFIER:DESICCANT:SYSTEM",
-			"DUCT",
-			"EVAPORATIVECOOLER:DIRECT:CELDEKPAD",
-			"EVAPORATIVECOOLER:DIRECT:RESEARCHSPECIAL",
-			"EVAPORATIVECOOLER:INDIRECT:CELDEKPAD",
-			"EVAPORATIVECOOLER:INDIRECT:RESEARCHSPECIAL",
-			"EVAPORATIVECOOLER:INDIRECT:WETCOIL",
-			"FAN:COMPONENTMODEL",
-			"FAN:CONSTANTVOLUME",
-			"FAN:ONOFF",
-			"FAN:VARIABLEVOLUME",
-			"HEATEXCHANGER:AIRTOAIR:FLATPLATE",
-			"HEATEXCHANGER:AIRTOAIR:SENSIBLEANDLATENT",
-			"HEATEXCHANGER:DESICCANT:BALANCEDFLOW",
-			"HUMIDIFIER:STEAM:ELECTRIC",
-			"HUMIDIFIER:STEAM:GAS",
-			"OUTDOORAIR:MIXER",
-			"SOLARCOLLECTOR:FLATPLATE:PHOTOVOLTAICTHERMAL",
-			"SOLARCOLLECTOR:UNGLAZEDTRANSPIRED",
-			"ZONEHVAC:AIRDISTRIBUTIONUNIT"
-		};
-		assert( std::is_sorted( component_strings.begin(), component_strings.end() ) );
-		assert( component_strings.size() == n_ComponentTypes );
 
 
 		// INTERFACE BLOCK SPECIFICATIONS
@@ -3533,11 +3552,9 @@ namespace SystemReports {
 
 		//    cEnergyType=cRT_ValidTypes(EnergyType-ResourceTypeInitialOffset)
 
-		// Find enum for the component type string
-		std::vector< std::string >::size_type iCompType;
 		ComponentTypes comp_type( Unknown_ComponentType );
-		if ( index_in_sorted_string_vector( component_strings, CompType, iCompType ) ) {
-			comp_type = static_cast< ComponentTypes >( iCompType );
+		if ( CompTypeNum >= 0 && CompTypeNum < int( n_ComponentTypes ) ) {
+			comp_type = static_cast< ComponentTypes >( CompTypeNum );
 		}
 
 		switch( comp_type ) {
@@ -330,11 +330,15 @@ namespace SystemReports {
 	void
 	ReportSystemEnergyUse();
 
+	int
+	SystemEnergyUseCompType( std::string const & CompType );
+
 	void
 	CalcSystemEnergyUse(
 		bool const CompLoadFlag,
 		int const AirLoopNum,
 		std::string const & CompType,
+		int const CompTypeNum, // component type index from SystemEnergyUseCompType
 		int const EnergyType,
 		Real64 const CompLoad,
 		Real64 const CompEnergy
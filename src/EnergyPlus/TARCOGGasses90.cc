@@ -91,15 +91,16 @@ namespace TARCOGGasses90 {
 		int i;
 		int j;
 
-		Array1D< Real64 > fvis( maxgas );
-		Array1D< Real64 > fcon( maxgas );
-		Array1D< Real64 > fdens( maxgas );
-		Array1D< Real64 > fcp( maxgas );
-		Array1D< Real64 > kprime( maxgas );
-		Array1D< Real64 > kdblprm( maxgas );
-		Array1D< Real64 > mukpdwn( maxgas );
-		Array1D< Real64 > kpdown( maxgas );
-		Array1D< Real64 > kdpdown( maxgas );
+		// Work arrays are kept between calls: this routine is called for every gap on every TARCOG iteration
+		static Array1D< Real64 > fvis( maxgas );
+		static Array1D< Real64 > fcon( maxgas );
+		static Array1D< Real64 > fdens( maxgas );
+		static Array1D< Real64 > fcp( maxgas );
+		static Array1D< Real64 > kprime( maxgas );
+		static Array1D< Real64 > kdblprm( maxgas );
+		static Array1D< Real64 > mukpdwn( maxgas );
+		static Array1D< Real64 > kpdown( maxgas );
+		static Array1D< Real64 > kdpdown( maxgas );
 		Real64 molmix;
 		Real64 cpmixm;
 		Real64 kpmix;
@@ -115,7 +116,7 @@ namespace TARCOGGasses90 {
 
 		//Simon: TODO: this is used for EN673 calculations and it is not assigned properly. Check this
 		//REAL(r64), dimension(maxgas, 3) :: xgrho //Autodesk:Unused
-		Array2D< Real64 > grho( 3, maxgas );
+		//Array2D< Real64 > grho( 3, maxgas ); // Unused, see the commented out EN673 densities below
 
 		//REAL(r64) gaslaw
 		//DATA gaslaw /8314.51d0/   ! Molar gas constant in Joules/(kmol*K)
@@ -135,7 +136,7 @@ namespace TARCOGGasses90 {
 		cp = 0.0;
 
 		//Simon: remove this when assigned properly
-		grho = 0.0;
+		//grho = 0.0;
 
 		Real64 const tmean_2( pow_2( tmean ) );
 		fcon( 1 ) = xgcon( 1, iprop( 1 ) ) + xgcon( 2, iprop( 1 ) ) * tmean + xgcon( 3, iprop( 1 ) ) * tmean_2;
@@ -424,7 +424,7 @@ namespace ThermalChimney {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Kwang Ho Lee
 		//       DATE WRITTEN   April 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, zone air enthalpy once per zone
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -490,6 +490,7 @@ namespace ThermalChimney {
 		int IterationLoop;
 		Real64 Process1; // Temporary Variable Used in the Middle of the Calculation
 		Real64 Process2; // Temporary Variable Used in the Middle of the Calculation
+		Real64 ZoneEnthalpy; // Enthalpy of the zone air
 		Real64 Process3; // Temporary Variable Used in the Middle of the Calculation
 		//unused1208  REAL(r64)   :: Process4                            ! Temporary Variable Used in the Middle of the Calculation
 		Real64 AirDensityThermalChim; // (kg/m^3)
@@ -578,8 +579,9 @@ namespace ThermalChimney {
 			Process2 = 0.0;
 			for ( TCZoneNum = 1; TCZoneNum <= ThermalChimneySys( Loop ).TotZoneToDistrib; ++TCZoneNum ) {
 				TCZoneNumCounter = ThermalChimneySys( Loop ).ZonePtr( TCZoneNum );
-				Process1 += PsyHFnTdbW( MAT( TCZoneNumCounter ), ZoneAirHumRat( TCZoneNumCounter ) ) * ThermalChimneySys( Loop ).DistanceThermChimInlet( TCZoneNum ) * ThermalChimneySys( Loop ).RatioThermChimAirFlow( TCZoneNum );
-				Process2 += ThermalChimneySys( Loop ).RatioThermChimAirFlow( TCZoneNum ) * PsyHFnTdbW( MAT( TCZoneNumCounter ), ZoneAirHumRat( TCZoneNumCounter ) );
+				ZoneEnthalpy = PsyHFnTdbW( MAT( TCZoneNumCounter ), ZoneAirHumRat( TCZoneNumCounter ) );
+				Process1 += ZoneEnthalpy * ThermalChimneySys( Loop ).DistanceThermChimInlet( TCZoneNum ) * ThermalChimneySys( Loop ).RatioThermChimAirFlow( TCZoneNum );
+				Process2 += ThermalChimneySys( Loop ).RatioThermChimAirFlow( TCZoneNum ) * ZoneEnthalpy;
 			}
 			OverallThermalChimLength = Process1 / Process2;
 
@@ -199,6 +199,9 @@ namespace ThermalComfort {
 	Real64 TotalAnyZoneNotMetCoolingOccupied( 0.0 );
 	Real64 TotalAnyZoneNotMetOccupied( 0.0 );
 	Array1D< Real64 > ZoneOccHrs;
+	bool FangerOutputsUsed( true ); // Outputs of the Fanger model are reported or used by other objects
+	bool PierceOutputsUsed( true ); // Outputs of the Pierce model are reported or used by other objects
+	bool KSUOutputsUsed( true ); // Outputs of the KSU model are reported or used by other objects
 
 	// Subroutine Specifications for the Thermal Comfort module
 
@@ -217,7 +220,7 @@ namespace ThermalComfort {
 		// SUBROUTINE INFORMATION:
 		//     AUTHOR         Rick Strand
 		//     DATE WRITTEN   February 2000
-		//     MODIFIED       na
+		//     MODIFIED       Oct 2026, skip the Fanger, Pierce and KSU models when their outputs are not used
 		//     RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -248,6 +251,12 @@ namespace ThermalComfort {
 		static bool FirstTimeFlag( true ); // Flag set to make sure you get input once
 		static bool ASH55Flag( false );
 		static bool CEN15251Flag( false );
+		// Outputs written by the Fanger, Pierce and KSU models
+		static Array1D_string const CommonVarNames( 3, { "Zone Thermal Comfort Mean Radiant Temperature", "Zone Thermal Comfort Operative Temperature", "Zone Thermal Comfort Clothing Value" } );
+		static Array1D_string const FangerVarNames( 5, { "Zone Thermal Comfort Fanger Model PMV", "Zone Thermal Comfort Fanger Model PPD", "Zone Thermal Comfort Clothing Surface Temperature", "People Air Temperature", "People Air Relative Humidity" } );
+		static Array1D_string const PierceVarNames( 4, { "Zone Thermal Comfort Pierce Model Effective Temperature PMV", "Zone Thermal Comfort Pierce Model Standard Effective Temperature PMV", "Zone Thermal Comfort Pierce Model Discomfort Index", "Zone Thermal Comfort Pierce Model Thermal Sensation Index" } );
+		static Array1D_string const KSUVarNames( 1, { "Zone Thermal Comfort KSU Model Thermal Sensation Vote" } );
+		bool CommonOutputsUsed;
 
 		// FLOW:
 		// No input to get because this is already done by other heat balance routines
@@ -258,6 +267,12 @@ namespace ThermalComfort {
 			if ( TotPeople > 0 ) {
 				if ( any( People.AdaptiveASH55() ) ) ASH55Flag = true;
 				if ( any( People.AdaptiveCEN15251() ) ) CEN15251Flag = true;
+
+				// The models are only run when something looks at their results
+				CommonOutputsUsed = OutputVariablesUsed( CommonVarNames );
+				FangerOutputsUsed = CommonOutputsUsed || OutputVariablesUsed( FangerVarNames );
+				PierceOutputsUsed = CommonOutputsUsed || OutputVariablesUsed( PierceVarNames );
+				KSUOutputsUsed = CommonOutputsUsed || OutputVariablesUsed( KSUVarNames );
 			}
 		}
 
@@ -284,9 +299,9 @@ namespace ThermalComfort {
 		}
 
 		if ( ! DoingSizing && ! WarmupFlag ) {
-			CalcThermalComfortFanger();
-			CalcThermalComfortPierce();
-			CalcThermalComfortKSU();
+			if ( FangerOutputsUsed ) CalcThermalComfortFanger();
+			if ( PierceOutputsUsed ) CalcThermalComfortPierce();
+			if ( KSUOutputsUsed ) CalcThermalComfortKSU();
 			CalcThermalComfortSimpleASH55();
 			CalcIfSetPointMet();
 			if ( ASH55Flag ) CalcThermalComfortAdaptiveASH55( false );
@@ -118,6 +118,9 @@ namespace ThermalComfort {
 	extern Real64 TotalAnyZoneNotMetCoolingOccupied;
 	extern Real64 TotalAnyZoneNotMetOccupied;
 	extern Array1D< Real64 > ZoneOccHrs;
+	extern bool FangerOutputsUsed; // Outputs of the Fanger model are reported or used by other objects
+	extern bool PierceOutputsUsed; // Outputs of the Pierce model are reported or used by other objects
+	extern bool KSUOutputsUsed; // Outputs of the KSU model are reported or used by other objects
 
 	// Subroutine Specifications for the Thermal Comfort module
 
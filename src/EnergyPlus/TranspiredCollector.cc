@@ -1051,7 +1051,7 @@ namespace TranspiredCollector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B.T. Griffith
 		//       DATE WRITTEN   November 2004
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, sum the underlying surface areas once
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1100,11 +1100,13 @@ namespace TranspiredCollector {
 		Real64 VdotThermal;
 		Real64 Twbamb;
 		Real64 OutHumRatAmb;
+		Real64 AreaSum; // sum of areas of underlying surfaces
 
 //		Tamb = sum( Surface( UTSC( UTSCNum ).SurfPtrs ).OutDryBulbTemp * Surface( UTSC( UTSCNum ).SurfPtrs ).Area ) / sum( Surface( UTSC( UTSCNum ).SurfPtrs ).Area ); //Autodesk:F2C++ Array subscript usage: Replaced by below
-		Tamb = sum_product_sub( Surface.OutDryBulbTemp(), Surface.Area(), UTSC( UTSCNum ).SurfPtrs ) / sum_sub( Surface.Area(), UTSC( UTSCNum ).SurfPtrs ); //Autodesk:F2C++ Functions handle array subscript usage
+		AreaSum = sum_sub( Surface.Area(), UTSC( UTSCNum ).SurfPtrs ); //Autodesk:F2C++ Functions handle array subscript usage
+		Tamb = sum_product_sub( Surface.OutDryBulbTemp(), Surface.Area(), UTSC( UTSCNum ).SurfPtrs ) / AreaSum; //Autodesk:F2C++ Functions handle array subscript usage
 //		Twbamb = sum( Surface( UTSC( UTSCNum ).SurfPtrs ).OutWetBulbTemp * Surface( UTSC( UTSCNum ).SurfPtrs ).Area ) / sum( Surface( UTSC( UTSCNum ).SurfPtrs ).Area ); //Autodesk:F2C++ Array subscript usage: Replaced by below
-		Twbamb = sum_product_sub( Surface.OutWetBulbTemp(), Surface.Area(), UTSC( UTSCNum ).SurfPtrs ) / sum_sub( Surface.Area(), UTSC( UTSCNum ).SurfPtrs ); //Autodesk:F2C++ Functions handle array subscript usage
+		Twbamb = sum_product_sub( Surface.OutWetBulbTemp(), Surface.Area(), UTSC( UTSCNum ).SurfPtrs ) / AreaSum; //Autodesk:F2C++ Functions handle array subscript usage
 		OutHumRatAmb = PsyWFnTdbTwbPb( Tamb, Twbamb, OutBaroPress );
 
 		RhoAir = PsyRhoAirFnPbTdbW( OutBaroPress, Tamb, OutHumRatAmb );
@@ -79,19 +79,19 @@ namespace UFADManager {
 	// MODULE VARIABLE DECLARATIONS:
 	static std::string const BlankString;
 
-	Real64 HAT_MX( 0.0 ); // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone
-	Real64 HAT_MXWin( 0.0 ); // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone (windows only)
-	Real64 HA_MX( 0.0 ); // HA_MX Convection Coefficient times Area for the upper subzone
-	Real64 HA_MXWin( 0.0 ); // HA_MX Convection Coefficient times Area for the upper subzone (windows only)
-	Real64 HAT_OC( 0.0 ); // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone
-	Real64 HAT_OCWin( 0.0 ); // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone (windows only)
-	Real64 HA_OC( 0.0 ); // HA_OC Convection Coefficient times Area for the lower subzone
-	Real64 HA_OCWin( 0.0 ); // HA_OC Convection Coefficient times Area for the lower subzone (windows only)
-	Real64 HAT_FLOOR( 0.0 ); // HAT_FLOOR Convection Coefficient times Area times Temperature for the floor(?) subzone
-	Real64 HA_FLOOR( 0.0 ); // HA_FLOOR Convection Coefficient times Area for the floor(?) subzone
+	EP_THREAD_LOCAL Real64 HAT_MX( 0.0 ); // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone
+	EP_THREAD_LOCAL Real64 HAT_MXWin( 0.0 ); // HAT_MX Convection Coefficient times Area times Temperature for the upper subzone (windows only)
+	EP_THREAD_LOCAL Real64 HA_MX( 0.0 ); // HA_MX Convection Coefficient times Area for the upper subzone
+	EP_THREAD_LOCAL Real64 HA_MXWin( 0.0 ); // HA_MX Convection Coefficient times Area for the upper subzone (windows only)
+	EP_THREAD_LOCAL Real64 HAT_OC( 0.0 ); // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone
+	EP_THREAD_LOCAL Real64 HAT_OCWin( 0.0 ); // HAT_OC Convection Coefficient times Area times Temperature for the lower subzone (windows only)
+	EP_THREAD_LOCAL Real64 HA_OC( 0.0 ); // HA_OC Convection Coefficient times Area for the lower subzone
+	EP_THREAD_LOCAL Real64 HA_OCWin( 0.0 ); // HA_OC Convection Coefficient times Area for the lower subzone (windows only)
+	EP_THREAD_LOCAL Real64 HAT_FLOOR( 0.0 ); // HAT_FLOOR Convection Coefficient times Area times Temperature for the floor(?) subzone
+	EP_THREAD_LOCAL Real64 HA_FLOOR( 0.0 ); // HA_FLOOR Convection Coefficient times Area for the floor(?) subzone
 	Real64 HeightFloorSubzoneTop( 0.2 ); // Assumed thickness of floor subzone
 	Real64 ThickOccupiedSubzoneMin( 0.2 ); // Minimum thickness of occupied subzone
-	Real64 HeightIntMass( 0.0 ); // Height of internal mass surfaces, assumed vertical, cannot exceed ceiling height
+	EP_THREAD_LOCAL Real64 HeightIntMass( 0.0 ); // Height of internal mass surfaces, assumed vertical, cannot exceed ceiling height
 	Real64 HeightIntMassDefault( 2.0 ); // Default height of internal mass surfaces
 
 	// SUBROUTINE SPECIFICATIONS:
@@ -175,7 +175,7 @@ namespace UFADManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   August 2005
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, no saved locals so zones can be initialized in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -207,10 +207,10 @@ namespace UFADManager {
 
 		static bool MyOneTimeFlag( true );
 		static Array1D_bool MySizeFlag;
-		static Real64 NumShadesDown( 0.0 );
+		Real64 NumShadesDown( 0.0 );
 		int UINum; // index to underfloor interior zone model data
-		static int Ctd( 0 ); // DO loop index
-		static int SurfNum( 0 ); // surface data structure index
+		int Ctd( 0 ); // DO loop index
+		int SurfNum( 0 ); // surface data structure index
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
@@ -705,11 +705,16 @@ namespace UFADManager {
 				}
 
 				if ( std::abs( ZInfSurf - ZSupSurf ) < 1.e-10 ) {
-					ShowSevereError( "RoomAirModelUFAD:HcUCSDUF: Surface values will cause divide by zero." );
-					ShowContinueError( "Zone=\"" + Zone( Surface( SurfNum ).Zone ).Name + "\", Surface=\"" + Surface( SurfNum ).Name + "\"." );
-					ShowContinueError( "ZInfSurf=[" + RoundSigDigits( ZInfSurf, 4 ) + "], LayH=[" + RoundSigDigits( LayH, 4 ) + "]." );
-					ShowContinueError( "ZSupSurf=[" + RoundSigDigits( ZSupSurf, 4 ) + "], LayH=[" + RoundSigDigits( LayH, 4 ) + "]." );
-					ShowFatalError( "...Previous condition causes termination." );
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
+					{
+						ShowSevereError( "RoomAirModelUFAD:HcUCSDUF: Surface values will cause divide by zero." );
+						ShowContinueError( "Zone=\"" + Zone( Surface( SurfNum ).Zone ).Name + "\", Surface=\"" + Surface( SurfNum ).Name + "\"." );
+						ShowContinueError( "ZInfSurf=[" + RoundSigDigits( ZInfSurf, 4 ) + "], LayH=[" + RoundSigDigits( LayH, 4 ) + "]." );
+						ShowContinueError( "ZSupSurf=[" + RoundSigDigits( ZSupSurf, 4 ) + "], LayH=[" + RoundSigDigits( LayH, 4 ) + "]." );
+						ShowFatalError( "...Previous condition causes termination." );
+					}
 				}
 
 				// The Wall surface is partially in upper and partially in lower subzone
@@ -926,6 +931,7 @@ namespace UFADManager {
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   August 2005
 		//       MODIFIED       Brent Griffith June 2008 for new interpolation and time history
+		//                      Oct 2026, only touch the data of this zone so zones can be calculated in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -962,7 +968,7 @@ namespace UFADManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MIXFLAG( false ); // if true treat as a mixed zone
+		bool MIXFLAG( false ); // if true treat as a mixed zone
 		Real64 CeilingHeight; // zone ceiling height above floor [m]
 		int UINum; // index to underfloor interior zone model data
 		Real64 GainsFrac; // fraction of occupied subzone heat gains that remain in the subzone;
@@ -988,7 +994,7 @@ namespace UFADManager {
 		Real64 MCpT_Total; // total mass flow rate * specific heat* temp for this zone [W]
 		Real64 NumberOfPlumes;
 		Real64 PowerInPlumes; // [W]
-		static Real64 PowerPerPlume( 0.0 ); // power generating each plume [W]
+		Real64 PowerPerPlume( 0.0 ); // power generating each plume [W]
 		Real64 HeightFrac; // Fractional height of transition between occupied and upper subzones
 		Real64 TotSysFlow; // [m3/s]
 		Real64 NumDiffusersPerPlume;
@@ -1007,8 +1013,8 @@ namespace UFADManager {
 		Real64 HeightOccupiedSubzoneAve; // Height of center of occupied air subzone
 		Real64 ZoneMult; // total zone multiplier
 		int ZoneNodeNum; // node number of the HVAC zone node
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
 		static Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
 
 		static Array1D_int IntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
@@ -1031,7 +1037,9 @@ namespace UFADManager {
 		}
 
 		MIXFLAG = false;
-		UFHcIn = HConvIn;
+		for ( int SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+			UFHcIn( SurfNum ) = HConvIn( SurfNum );
+		}
 		SumSysMCp = 0.0;
 		SumSysMCpT = 0.0;
 		TotSysFlow = 0.0;
@@ -1280,6 +1288,9 @@ namespace UFADManager {
 			} else if ( HeightComfort >= HeightUpSubzoneAve && HeightComfort <= CeilingHeight ) {
 				TCMF( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "UFAD comfort height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
@@ -1296,6 +1307,9 @@ namespace UFADManager {
 			} else if ( HeightThermostat >= HeightUpSubzoneAve && HeightThermostat <= CeilingHeight ) {
 				TempTstatAir( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "Underfloor air distribution thermostat height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
@@ -1345,6 +1359,7 @@ namespace UFADManager {
 		//       AUTHOR         Fred Buhl
 		//       DATE WRITTEN   January 2006
 		//       MODIFIED       Brent Griffith June 2008 for new interpolation and time history
+		//                      Oct 2026, only touch the data of this zone so zones can be calculated in parallel
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1381,7 +1396,7 @@ namespace UFADManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MIXFLAG( false ); // if true treat as a mixed zone
+		bool MIXFLAG( false ); // if true treat as a mixed zone
 		Real64 CeilingHeight; // zone ceiling height above floor [m]
 		int UINum; // index to underfloor interior zone model data
 		Real64 GainsFrac; // fraction of occupied subzone heat gains that remain in the subzone;
@@ -1407,9 +1422,9 @@ namespace UFADManager {
 		Real64 MCpT_Total; // total mass flow rate * specific heat* temp for this zone [W]
 		Real64 NumberOfPlumes;
 		Real64 PowerInPlumes; // [W]
-		static Real64 PowerPerPlume( 0.0 ); // power carried by each plume [W]
+		Real64 PowerPerPlume( 0.0 ); // power carried by each plume [W]
 		Real64 PowerInPlumesPerMeter; // Power in Plumes per meter of window length [W/m]
-		static Real64 NumDiffusersPerPlume( 0.0 );
+		Real64 NumDiffusersPerPlume( 0.0 );
 		Real64 HeightFrac; // Fractional height of transition between occupied and upper subzones
 		Real64 TotSysFlow; // [m3/s]
 		Real64 NumDiffusers;
@@ -1427,8 +1442,8 @@ namespace UFADManager {
 		Real64 HeightOccupiedSubzoneAve; // Height of center of occupied air subzone
 		Real64 ZoneMult; // total zone multiplier
 		int ZoneNodeNum; // node number of the HVAC zone node
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
 		static Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
 
 		static Array1D_int IntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
@@ -1452,7 +1467,9 @@ namespace UFADManager {
 
 		HeightFrac = 0.0;
 		MIXFLAG = false;
-		UFHcIn = HConvIn;
+		for ( int SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+			UFHcIn( SurfNum ) = HConvIn( SurfNum );
+		}
 		SumSysMCp = 0.0;
 		SumSysMCpT = 0.0;
 		TotSysFlow = 0.0;
@@ -1737,6 +1754,9 @@ namespace UFADManager {
 			} else if ( HeightComfort >= HeightUpSubzoneAve && HeightComfort <= CeilingHeight ) {
 				TCMF( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "UFAD comfort height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
@@ -1753,6 +1773,9 @@ namespace UFADManager {
 			} else if ( HeightThermostat >= HeightUpSubzoneAve && HeightThermostat <= CeilingHeight ) {
 				TempTstatAir( ZoneNum ) = ZTMX( ZoneNum );
 			} else {
+#ifdef _OPENMP
+#pragma omp critical ( RoomAirModelMessages )
+#endif
 				ShowFatalError( "Underfloor air distribution thermostat height is above ceiling or below floor in Zone: " + Zone( ZoneNum ).Name );
 			}
 		}
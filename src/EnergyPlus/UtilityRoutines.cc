@@ -18,9 +18,11 @@ extern "C" {
 
 // EnergyPlus Headers
 #include <UtilityRoutines.hh>
+#include <AsyncOutput.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
 #include <CommandLineInterface.hh>
+#include <CompressedOutput.hh>
 #include <DataEnvironment.hh>
 #include <DataErrorTracking.hh>
 #include <DataGlobals.hh>
@@ -37,6 +39,7 @@ extern "C" {
 #include <NodeInputManager.hh>
 #include <OutputReports.hh>
 #include <PlantManager.hh>
+#include <RecordOutput.hh>
 #include <SimulationManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
@@ -315,6 +318,11 @@ CloseOutOpenFiles()
 	int UnitNumber;
 	int ios;
 
+	AsyncOutput::StopAllAsyncOutput(); // Writer threads must finish before their files are closed
+	CompressedOutput::StopAllCompressedOutput(); // Compressed streams write their last block
+	RecordOutput::CloseRecordOutput(); // Buffered eplusout.eiob records are written
+	StopAsyncDisplay(); // Queued messages are displayed
+
 	for ( UnitNumber = 1; UnitNumber <= MaxUnitNumber; ++UnitNumber ) {
 		{ IOFlags flags; gio::inquire( UnitNumber, flags ); exists = flags.exists(); opened = flags.open(); ios = flags.ios(); }
 		if ( exists && opened && ios == 0 ) gio::close( UnitNumber );
@@ -1234,7 +1242,7 @@ ShowRecurringSevereErrorAtEnd(
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Michael J. Witte
 	//       DATE WRITTEN   August 2004
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, reuse the message search of the stored message
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -1268,13 +1276,19 @@ ShowRecurringSevereErrorAtEnd(
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	int Loop;
+	int const SearchMatches( RecurringErrorSearchMatches( " ** Severe  ** ", Message, MsgIndex ) );
 
 	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+		if ( SearchMatches & ( 1 << ( Loop - 1 ) ) ) ++MatchCounts( Loop );
 	}
 
 	++TotalSevereErrors;
-	StoreRecurringErrorMessage( " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	if ( MsgIndex == 0 ) {
+		StoreRecurringErrorMessage( " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+		if ( MsgIndex > 0 ) RecurringErrors( MsgIndex ).SearchMatches = SearchMatches;
+	} else { // The message is only stored when the index is assigned
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1294,7 +1308,7 @@ ShowRecurringWarningErrorAtEnd(
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Michael J. Witte
 	//       DATE WRITTEN   August 2004
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, reuse the message search of the stored message
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -1328,13 +1342,19 @@ ShowRecurringWarningErrorAtEnd(
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	int Loop;
+	int const SearchMatches( RecurringErrorSearchMatches( " ** Warning ** ", Message, MsgIndex ) );
 
 	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+		if ( SearchMatches & ( 1 << ( Loop - 1 ) ) ) ++MatchCounts( Loop );
 	}
 
 	++TotalWarningErrors;
-	StoreRecurringErrorMessage( " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	if ( MsgIndex == 0 ) {
+		StoreRecurringErrorMessage( " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+		if ( MsgIndex > 0 ) RecurringErrors( MsgIndex ).SearchMatches = SearchMatches;
+	} else { // The message is only stored when the index is assigned
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1354,7 +1374,7 @@ ShowRecurringContinueErrorAtEnd(
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         Michael J. Witte
 	//       DATE WRITTEN   August 2004
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026, reuse the message search of the stored message
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -1388,12 +1408,18 @@ ShowRecurringContinueErrorAtEnd(
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 	int Loop;
+	int const SearchMatches( RecurringErrorSearchMatches( " **   ~~~   ** ", Message, MsgIndex ) );
 
 	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+		if ( SearchMatches & ( 1 << ( Loop - 1 ) ) ) ++MatchCounts( Loop );
 	}
 
-	StoreRecurringErrorMessage( " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	if ( MsgIndex == 0 ) {
+		StoreRecurringErrorMessage( " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+		if ( MsgIndex > 0 ) RecurringErrors( MsgIndex ).SearchMatches = SearchMatches;
+	} else { // The message is only stored when the index is assigned
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1414,6 +1440,7 @@ StoreRecurringErrorMessage(
 	//       AUTHOR         Michael J. Witte
 	//       DATE WRITTEN   August 2004
 	//       MODIFIED       September 2005;LKL;Added Units
+	//                      Oct 2026, look up stored messages by hash and grow the array geometrically
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -1422,7 +1449,8 @@ StoreRecurringErrorMessage(
 	// of occurences and optional tracking of associated min, max, and sum values
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// A message that is already stored, from another call site or for an index that was reset,
+	// adds to the statistics of the stored message instead of being stored again.
 
 	// REFERENCES:
 	// na
@@ -1448,10 +1476,17 @@ StoreRecurringErrorMessage(
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-	// If Index is zero, then assign next available index and reallocate array
+	// If Index is zero, then use the stored message if there is one
 	if ( ErrorMsgIndex == 0 ) {
-		RecurringErrors.redimension( ++NumRecurringErrors );
-		ErrorMsgIndex = NumRecurringErrors;
+		auto const found( RecurringErrorIndex.find( ErrorMessage ) );
+		if ( found != RecurringErrorIndex.end() ) ErrorMsgIndex = found->second;
+	}
+
+	// If Index is still zero, then assign next available index and reallocate array
+	if ( ErrorMsgIndex == 0 ) {
+		if ( NumRecurringErrors >= isize( RecurringErrors ) ) RecurringErrors.redimension( max( 2 * NumRecurringErrors, 16 ) );
+		ErrorMsgIndex = ++NumRecurringErrors;
+		RecurringErrorIndex.emplace( ErrorMessage, ErrorMsgIndex );
 		// The message string only needs to be stored once when a new recurring message is created
 		RecurringErrors( ErrorMsgIndex ).Message = ErrorMessage;
 		RecurringErrors( ErrorMsgIndex ).Count = 1;
@@ -1505,6 +1540,49 @@ StoreRecurringErrorMessage(
 
 }
 
+int
+RecurringErrorSearchMatches(
+	std::string const & Prefix, // Designation the message is stored with
+	std::string const & Message, // Recurring error message
+	int const MsgIndex // Recurring message index, zero if not yet assigned
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns the MessageSearch strings found in a recurring error message, bit Loop-1 being
+	// set if MessageSearch( Loop ) is found.
+
+	// METHODOLOGY EMPLOYED:
+	// The strings found are kept with the stored message, so the search is only repeated when
+	// the message is new or differs from the one stored for the index.
+
+	// Using/Aliasing
+	using namespace DataErrorTracking;
+
+	// FUNCTION LOCAL VARIABLE DECLARATIONS:
+	int Loop;
+	int SearchMatches( 0 );
+
+	if ( MsgIndex > 0 && MsgIndex <= NumRecurringErrors ) {
+		std::string const & Stored( RecurringErrors( MsgIndex ).Message );
+		if ( Stored.size() == Prefix.size() + Message.size() && Stored.compare( 0, Prefix.size(), Prefix ) == 0 && Stored.compare( Prefix.size(), std::string::npos, Message ) == 0 ) {
+			return RecurringErrors( MsgIndex ).SearchMatches;
+		}
+	}
+
+	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
+		if ( has( Message, MessageSearch( Loop ) ) ) SearchMatches |= 1 << ( Loop - 1 );
+	}
+	return SearchMatches;
+
+}
+
 void
 ShowErrorMessage(
 	std::string const & ErrorMessage,
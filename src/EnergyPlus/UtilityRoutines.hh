@@ -205,6 +205,13 @@ StoreRecurringErrorMessage(
 	std::string const & ErrorReportSumUnits = "" // Units for "sum" reporting
 );
 
+int
+RecurringErrorSearchMatches(
+	std::string const & Prefix, // Designation the message is stored with
+	std::string const & Message, // Recurring error message
+	int const MsgIndex // Recurring message index, zero if not yet assigned
+);
+
 void
 ShowErrorMessage(
 	std::string const & ErrorMessage,
@@ -5941,6 +5941,101 @@ namespace VariableSpeedCoils {
 		return Speeds;
 	}
 
+	Array1D< Real64 > const &
+	GetVarSpeedCoilSpeedCapacities( int const DXCoilNum ) // Variable speed coil index
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the total capacity at each speed level of a variable speed cooling or heating coil
+		// at the inlet conditions of its last simulation, so that a parent unit can choose the speed
+		// that meets its load without simulating the coil at every speed.
+
+		// METHODOLOGY EMPLOYED:
+		// The rated capacity of each speed level is corrected with its capacity curve of temperature,
+		// evaluated at the load side (cooling: wet-bulb, heating: dry-bulb) and source side (water or
+		// outdoor air) inlet temperatures, as in CalcVarSpeedCoilCooling and CalcVarSpeedCoilHeating.
+		// The flow fraction modifiers are left out; at each speed level's rated flow they are near one.
+		// The capacities are kept with the two curve inputs and evaluated again only when these change,
+		// so the speed levels are evaluated once per inlet state however often the unit searches.
+
+		// Using/Aliasing
+		using CurveManager::CurveValue;
+		using Psychrometrics::PsyTwbFnTdbWPb;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "GetVarSpeedCoilSpeedCapacities" );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 LoadSideTemp; // Load side capacity curve input [C]
+		Real64 SourceSideTemp; // Source side capacity curve input [C]
+
+		auto & Coil( VarSpeedCoil( DXCoilNum ) );
+
+		if ( Coil.VSCoilTypeOfNum == Coil_CoolingAirToAirVariableSpeed || Coil.VSCoilTypeOfNum == Coil_CoolingWaterToAirHPVSEquationFit ) {
+			LoadSideTemp = PsyTwbFnTdbWPb( Coil.InletAirDBTemp, Coil.InletAirHumRat, OutBaroPress, RoutineName );
+		} else {
+			LoadSideTemp = Coil.InletAirDBTemp;
+		}
+		if ( Coil.VSCoilTypeOfNum == Coil_CoolingAirToAirVariableSpeed ) {
+			SourceSideTemp = Coil.CondInletTemp;
+		} else if ( Coil.VSCoilTypeOfNum == Coil_HeatingAirToAirVariableSpeed ) {
+			if ( Coil.CondenserInletNodeNum != 0 ) {
+				SourceSideTemp = Node( Coil.CondenserInletNodeNum ).Temp;
+			} else {
+				SourceSideTemp = OutDryBulbTemp;
+			}
+		} else {
+			SourceSideTemp = Coil.InletWaterTemp;
+		}
+
+		if ( ! Coil.HaveSpeedCapacity || LoadSideTemp != Coil.SpeedCapLoadSideTemp || SourceSideTemp != Coil.SpeedCapSourceSideTemp ) {
+			for ( int SpeedNum = 1; SpeedNum <= Coil.NumOfSpeeds; ++SpeedNum ) {
+				Coil.SpeedCapacity( SpeedNum ) = Coil.MSRatedTotCap( SpeedNum ) * CurveValue( Coil.MSCCapFTemp( SpeedNum ), LoadSideTemp, SourceSideTemp );
+			}
+			Coil.SpeedCapLoadSideTemp = LoadSideTemp;
+			Coil.SpeedCapSourceSideTemp = SourceSideTemp;
+			Coil.HaveSpeedCapacity = true;
+		}
+
+		return Coil.SpeedCapacity;
+
+	}
+
+	int
+	EstimateVarSpeedCoilSpeed(
+		int const DXCoilNum, // Variable speed coil index
+		Real64 const CapacityFrac // Fraction of the maximum speed capacity to be met [-]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the lowest speed level whose capacity at the current inlet conditions is at least
+		// the given fraction of the maximum speed capacity.  Parent units start their speed search at
+		// this level and confirm it with the unit model.
+
+		Array1D< Real64 > const & SpeedCapacity( GetVarSpeedCoilSpeedCapacities( DXCoilNum ) );
+		int const MaxSpeed( VarSpeedCoil( DXCoilNum ).NumOfSpeeds );
+		Real64 const CapacityReq( CapacityFrac * SpeedCapacity( MaxSpeed ) );
+
+		for ( int SpeedNum = 1; SpeedNum < MaxSpeed; ++SpeedNum ) {
+			if ( SpeedCapacity( SpeedNum ) >= CapacityReq ) return SpeedNum;
+		}
+		return MaxSpeed;
+
+	}
+
 	void
 	SetVarSpeedCoilData(
 		int const WSHPNum, // Number of OA Controller
@@ -312,6 +312,10 @@ namespace VariableSpeedCoils {
 		Real64 TotalHeatingEnergy; //total water heating energy
 		Real64 TotalHeatingEnergyRate;//total WH energy rate
 		//end variables for HPWH
+		bool HaveSpeedCapacity; // Speed level capacities are stored (GetVarSpeedCoilSpeedCapacities)
+		Real64 SpeedCapLoadSideTemp; // Load side capacity curve input of the stored speed level capacities [C]
+		Real64 SpeedCapSourceSideTemp; // Source side capacity curve input of the stored speed level capacities [C]
+		Array1D< Real64 > SpeedCapacity; // Capacity at each speed level at the stored curve inputs [W]
 
 		// Default Constructor
 		VariableSpeedCoilData() :
@@ -469,8 +473,12 @@ namespace VariableSpeedCoils {
 			AirVolFlowAutoSized( false ), // Used to report autosizing info for the HPWH DX coil
 			WaterVolFlowAutoSized( false ), // Used to report autosizing info for the HPWH DX coil
 			TotalHeatingEnergy( 0.0 ),  //total water heating energy
-			TotalHeatingEnergyRate( 0.0 ) //total WH energy rate
+			TotalHeatingEnergyRate( 0.0 ), //total WH energy rate
 			//end variables for HPWH
+			HaveSpeedCapacity( false ),
+			SpeedCapLoadSideTemp( 0.0 ),
+			SpeedCapSourceSideTemp( 0.0 ),
+			SpeedCapacity( MaxSpedLevels, 0.0 )
 		{}
 
 		// Member Constructor
@@ -796,8 +804,12 @@ namespace VariableSpeedCoils {
 			AirVolFlowAutoSized( AirVolFlowAutoSized ), // Used to report autosizing info for the HPWH DX coil
 			WaterVolFlowAutoSized( WaterVolFlowAutoSized ), // Used to report autosizing info for the HPWH DX coil
 			TotalHeatingEnergy( TotalHeatingEnergy ),  //total water heating energy
-			TotalHeatingEnergyRate( TotalHeatingEnergyRate ) //total WH energy rate
+			TotalHeatingEnergyRate( TotalHeatingEnergyRate ), //total WH energy rate
 			//end variables for HPWH
+			HaveSpeedCapacity( false ),
+			SpeedCapLoadSideTemp( 0.0 ),
+			SpeedCapSourceSideTemp( 0.0 ),
+			SpeedCapacity( MaxSpedLevels, 0.0 )
 		{}
 
 	};
@@ -934,6 +946,15 @@ namespace VariableSpeedCoils {
 		bool & ErrorsFound // set to true if problem
 	);
 
+	Array1D< Real64 > const &
+	GetVarSpeedCoilSpeedCapacities( int const DXCoilNum ); // Variable speed coil index
+
+	int
+	EstimateVarSpeedCoilSpeed(
+		int const DXCoilNum, // Variable speed coil index
+		Real64 const CapacityFrac // Fraction of the maximum speed capacity to be met [-]
+	);
+
 	void
 	SetVarSpeedCoilData(
 		int const WSHPNum, // Number of OA Controller
@@ -754,6 +754,7 @@ namespace WaterCoils {
 		//       DATE WRITTEN   February 1998
 		//       MODIFIED       April 2004: Rahul Chillar
 		//                      November 2013: XP, Tianzhen Hong to handle fouling coils
+		//                      Oct 2026, read the fouling severity set once per zone time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1404,6 +1405,8 @@ namespace WaterCoils {
 				RatedLatentCapacity = 0.0;
 				RatedSHR = 0.0;
 			}
+			// Do not start part wet calculations from the design calculation above or an earlier environment
+			WaterCoil( CoilNum ).PartWetSaved = false;
 			MyEnvrnFlag( CoilNum ) = false;
 
 		} // End If for the Begin Environment initializations
@@ -1497,13 +1500,8 @@ namespace WaterCoils {
 			for ( i = 1; i <= NumFouledCoil; ++i ) {
 				if ( FouledCoils( i ).FouledCoilID == CoilNum ) {
 					// Check faults availability and severity schedules
-					rSchVal = 0.0;
-					if ( GetCurrentScheduleValue( FouledCoils( i ).AvaiSchedPtr ) > 0.0 ) {
-						rSchVal = 1.0;
-						if ( FouledCoils( i ).SeveritySchedPtr > 0 ) {
-							rSchVal = GetCurrentScheduleValue( FouledCoils( i ).SeveritySchedPtr );
-						}
-					}
+					// (evaluated once per zone time step by UpdateFaultsStatus)
+					rSchVal = FouledCoils( i ).SeverityValue;
 
 					if ( FouledCoils( i ).FoulingInputMethod == iFouledCoil_UARated ) {
 						if ( WaterCoil( CoilNum ).WaterCoilType_Num == WaterCoil_SimpleHeating ) {
@@ -3237,7 +3235,7 @@ namespace WaterCoils {
 		// FUNCTION INFORMATION:
 		// AUTHOR         Rahul Chillar
 		// DATE WRITTEN   March 2004
-		// MODIFIED       na
+		// MODIFIED       Oct 2026, start from the last converged part wet solution of the coil
 		// RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -3315,7 +3313,13 @@ namespace WaterCoils {
 		WetCoilTotalHeatTransfer = 0.0;
 		WetCoilSensibleHeatTransfer = 0.0;
 
-		if ( FirstHVACIteration ) {
+		if ( WaterCoil( CoilNum ).PartWetSaved ) {
+			// Start from the wet fraction and outlet water temperature of the last converged part wet calculation,
+			// which is usually close when a controller calls the coil repeatedly or from one time step to the next
+			SurfAreaWetFraction = WaterCoil( CoilNum ).SurfAreaWetFractionSaved;
+			OutletWaterTemp = WaterCoil( CoilNum ).OutletWaterTempSaved;
+
+		} else if ( FirstHVACIteration ) {
 			// Estimate liquid temperature at boundary as entering air dew point
 			WetDryInterfcWaterTemp = AirDewPointTemp;
 
@@ -3405,6 +3409,7 @@ namespace WaterCoils {
 
 				// All coil is Dry so fraction wet is ofcourse =0
 				SurfAreaWetFraction = 0.0;
+				WaterCoil( CoilNum ).PartWetSaved = false;
 				return;
 			}
 
@@ -3429,6 +3434,8 @@ namespace WaterCoils {
 
 		// Save last iterations values for this current time step
 		WaterCoil( CoilNum ).SurfAreaWetFractionSaved = SurfAreaWetFraction;
+		WaterCoil( CoilNum ).OutletWaterTempSaved = OutletWaterTemp;
+		WaterCoil( CoilNum ).PartWetSaved = ( icvg == 1 );
 
 	}
 
@@ -187,6 +187,8 @@ namespace WaterCoils {
 		Real64 UAWetExtPerUnitArea; // External overall heat transfer coefficient(W/m2 C)
 		Real64 UADryExtPerUnitArea; // External overall heat transfer coefficient(W/m2 C)
 		Real64 SurfAreaWetFractionSaved; // Previous saved value, for numerical efficiency.
+		Real64 OutletWaterTempSaved; // Outlet water temperature of the last part wet calculation, for numerical efficiency.
+		bool PartWetSaved; // Saved values are from a converged part wet calculation of this environment
 		//END calculated parameters for Design Inputs Detailed coil
 		// variables for simple heating coil with variable UA
 		Real64 UACoilVariable; // WaterCoil UA value when variable (simple heating coil only)
@@ -302,6 +304,8 @@ namespace WaterCoils {
 			UAWetExtPerUnitArea( 0.0 ),
 			UADryExtPerUnitArea( 0.0 ),
 			SurfAreaWetFractionSaved( 0.0 ),
+			OutletWaterTempSaved( 0.0 ),
+			PartWetSaved( false ),
 			UACoilVariable( 0.0 ),
 			RatioAirSideToWaterSideConvect( 1.0 ),
 			AirSideNominalConvect( 0.0 ),
@@ -528,6 +532,8 @@ namespace WaterCoils {
 			UAWetExtPerUnitArea( UAWetExtPerUnitArea ),
 			UADryExtPerUnitArea( UADryExtPerUnitArea ),
 			SurfAreaWetFractionSaved( SurfAreaWetFractionSaved ),
+			OutletWaterTempSaved( 0.0 ),
+			PartWetSaved( false ),
 			UACoilVariable( UACoilVariable ),
 			RatioAirSideToWaterSideConvect( RatioAirSideToWaterSideConvect ),
 			AirSideNominalConvect( AirSideNominalConvect ),
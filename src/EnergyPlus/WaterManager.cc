@@ -76,7 +76,7 @@ namespace WaterManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, only revisit tanks connected to rain, wells or other tanks
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -144,7 +144,9 @@ namespace WaterManager {
 		}
 
 		//call the tanks again to get updated rain and well activity
+		//  (tanks fed only by other components see the same inputs as above and are skipped)
 		for ( TankNum = 1; TankNum <= NumWaterStorageTanks; ++TankNum ) {
+			if ( ! WaterStorage( TankNum ).UpdateAfterSupply ) continue;
 			CalcWaterStorageTank( TankNum );
 		} //tank loop
 
@@ -756,6 +758,18 @@ namespace WaterManager {
 			if ( ErrorsFound ) {
 				ShowFatalError( "Errors found in processing input for water manager objects" );
 			}
+
+			// flag the tanks whose supplies or demands are set by the rain, well, or tank updates in ManageWater
+			for ( Item = 1; Item <= NumRainCollectors; ++Item ) {
+				WaterStorage( RainCollector( Item ).StorageTankID ).UpdateAfterSupply = true;
+			}
+			for ( Item = 1; Item <= NumGroundWaterWells; ++Item ) {
+				WaterStorage( GroundwaterWell( Item ).StorageTankID ).UpdateAfterSupply = true;
+			}
+			for ( Item = 1; Item <= NumWaterStorageTanks; ++Item ) {
+				if ( WaterStorage( Item ).SupplyTankID > 0 ) WaterStorage( WaterStorage( Item ).SupplyTankID ).UpdateAfterSupply = true;
+				if ( WaterStorage( Item ).OverflowMode == OverflowToTank ) WaterStorage( WaterStorage( Item ).OverflowTankID ).UpdateAfterSupply = true;
+			}
 			// <SetupOutputVariables here...>, CurrentModuleObject='WaterUse:Storage'
 			for ( Item = 1; Item <= NumWaterStorageTanks; ++Item ) {
 				// this next one is a measure of the state of water in the tank, not a flux of m3 that needs to be summed
@@ -964,7 +978,7 @@ namespace WaterManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, sum the supplies once and hoist the time step length
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1015,6 +1029,7 @@ namespace WaterManager {
 		static Real64 underflowVdot( 0.0 );
 		static Real64 VolumePredict( 0.0 );
 		static Real64 OverFillVolume( 0.0 );
+		Real64 const TimeStepSysSec( TimeStepSys * SecInHour ); // system time step length [s]
 
 		if ( BeginTimeStepFlag ) {
 			// initializations are done in UpdateWaterManager
@@ -1030,11 +1045,11 @@ namespace WaterManager {
 		if ( TotVdotSupplyAvail > WaterStorage( TankNum ).MaxInFlowRate ) {
 			// pipe/filter rate constraints on inlet
 			overflowVdot = TotVdotSupplyAvail - WaterStorage( TankNum ).MaxInFlowRate;
-			overflowTwater = sum( WaterStorage( TankNum ).VdotAvailSupply * WaterStorage( TankNum ).TwaterSupply ) / sum( WaterStorage( TankNum ).VdotAvailSupply );
+			overflowTwater = sum( WaterStorage( TankNum ).VdotAvailSupply * WaterStorage( TankNum ).TwaterSupply ) / OrigVdotSupplyAvail;
 			TotVdotSupplyAvail = WaterStorage( TankNum ).MaxInFlowRate;
 		}
-		TotVolSupplyAvail = TotVdotSupplyAvail * TimeStepSys * SecInHour;
-		overflowVol = overflowVdot * TimeStepSys * SecInHour;
+		TotVolSupplyAvail = TotVdotSupplyAvail * TimeStepSysSec;
+		overflowVol = overflowVdot * TimeStepSysSec;
 
 		underflowVdot = 0.0;
 		if ( WaterStorage( TankNum ).NumWaterDemands > 0 ) {
@@ -1042,17 +1057,17 @@ namespace WaterManager {
 		} else {
 			OrigVdotDemandRequest = 0.0;
 		}
-		OrigVolDemandRequest = OrigVdotDemandRequest * TimeStepSys * SecInHour;
+		OrigVolDemandRequest = OrigVdotDemandRequest * TimeStepSysSec;
 		TotVdotDemandAvail = OrigVdotDemandRequest; // initialize to satisfied then modify if needed
 		if ( TotVdotDemandAvail > WaterStorage( TankNum ).MaxOutFlowRate ) {
 			// pipe/filter rate constraints on outlet
 			underflowVdot = OrigVdotDemandRequest - WaterStorage( TankNum ).MaxOutFlowRate;
 			TotVdotDemandAvail = WaterStorage( TankNum ).MaxOutFlowRate;
 		}
-		TotVolDemandAvail = TotVdotDemandAvail * ( TimeStepSys * SecInHour );
+		TotVolDemandAvail = TotVdotDemandAvail * TimeStepSysSec;
 
 		NetVdotAdd = TotVdotSupplyAvail - TotVdotDemandAvail;
-		NetVolAdd = NetVdotAdd * ( TimeStepSys * SecInHour );
+		NetVolAdd = NetVdotAdd * TimeStepSysSec;
 
 		VolumePredict = WaterStorage( TankNum ).LastTimeStepVolume + NetVolAdd;
 
@@ -1064,7 +1079,7 @@ namespace WaterManager {
 			overflowTwater = ( overflowTwater * overflowVol + OverFillVolume * WaterStorage( TankNum ).Twater ) / ( overflowVol + OverFillVolume );
 			overflowVol += OverFillVolume;
 			NetVolAdd -= OverFillVolume;
-			NetVdotAdd = NetVolAdd / ( TimeStepSys * SecInHour );
+			NetVdotAdd = NetVolAdd / TimeStepSysSec;
 			VolumePredict = WaterStorage( TankNum ).MaxCapacity;
 		}
 
@@ -1073,10 +1088,10 @@ namespace WaterManager {
 			AvailVolume = WaterStorage( TankNum ).LastTimeStepVolume + TotVolSupplyAvail;
 			AvailVolume = max( 0.0, AvailVolume );
 			TotVolDemandAvail = AvailVolume;
-			TotVdotDemandAvail = AvailVolume / ( TimeStepSys * SecInHour );
+			TotVdotDemandAvail = AvailVolume / TimeStepSysSec;
 			underflowVdot = OrigVdotDemandRequest - TotVdotDemandAvail;
 			NetVdotAdd = TotVdotSupplyAvail - TotVdotDemandAvail;
-			NetVolAdd = NetVdotAdd * ( TimeStepSys * SecInHour );
+			NetVolAdd = NetVdotAdd * TimeStepSysSec;
 			VolumePredict = 0.0;
 		}
 
@@ -1101,19 +1116,19 @@ namespace WaterManager {
 			// set mains draws for float on (all the way to Float off)
 			if ( WaterStorage( TankNum ).ControlSupplyType == MainsFloatValve ) {
 
-				WaterStorage( TankNum ).MainsDrawVdot = FillVolRequest / ( TimeStepSys * SecInHour );
+				WaterStorage( TankNum ).MainsDrawVdot = FillVolRequest / TimeStepSysSec;
 				NetVolAdd = FillVolRequest;
 
 			}
 			// set demand request in supplying tank if needed
 			if ( ( WaterStorage( TankNum ).ControlSupplyType == OtherTankFloatValve ) || ( WaterStorage( TankNum ).ControlSupplyType == TankMainsBackup ) ) {
-				WaterStorage( WaterStorage( TankNum ).SupplyTankID ).VdotRequestDemand( WaterStorage( TankNum ).SupplyTankDemandARRID ) = FillVolRequest / ( TimeStepSys * SecInHour );
+				WaterStorage( WaterStorage( TankNum ).SupplyTankID ).VdotRequestDemand( WaterStorage( TankNum ).SupplyTankDemandARRID ) = FillVolRequest / TimeStepSysSec;
 
 			}
 
 			// set demand request in groundwater well if needed
 			if ( ( WaterStorage( TankNum ).ControlSupplyType == WellFloatValve ) || ( WaterStorage( TankNum ).ControlSupplyType == WellFloatMainsBackup ) ) {
-				GroundwaterWell( WaterStorage( TankNum ).GroundWellID ).VdotRequest = FillVolRequest / ( TimeStepSys * SecInHour );
+				GroundwaterWell( WaterStorage( TankNum ).GroundWellID ).VdotRequest = FillVolRequest / TimeStepSysSec;
 			}
 
 		}
@@ -1122,18 +1137,18 @@ namespace WaterManager {
 		if ( ( VolumePredict ) < WaterStorage( TankNum ).BackupMainsCapacity ) { //turn on supply
 			if ( ( WaterStorage( TankNum ).ControlSupplyType == WellFloatMainsBackup ) || ( WaterStorage( TankNum ).ControlSupplyType == TankMainsBackup ) ) {
 				FillVolRequest = WaterStorage( TankNum ).ValveOffCapacity - VolumePredict;
-				WaterStorage( TankNum ).MainsDrawVdot = FillVolRequest / ( TimeStepSys * SecInHour );
+				WaterStorage( TankNum ).MainsDrawVdot = FillVolRequest / TimeStepSysSec;
 				NetVolAdd = FillVolRequest;
 
 			}
 		}
 
 		WaterStorage( TankNum ).ThisTimeStepVolume = WaterStorage( TankNum ).LastTimeStepVolume + NetVolAdd;
-		WaterStorage( TankNum ).VdotOverflow = overflowVol / ( TimeStepSys * SecInHour );
+		WaterStorage( TankNum ).VdotOverflow = overflowVol / TimeStepSysSec;
 		WaterStorage( TankNum ).VolOverflow = overflowVol;
 		WaterStorage( TankNum ).TwaterOverflow = overflowTwater;
-		WaterStorage( TankNum ).NetVdot = NetVolAdd / ( TimeStepSys * SecInHour );
-		WaterStorage( TankNum ).MainsDrawVol = WaterStorage( TankNum ).MainsDrawVdot * ( TimeStepSys * SecInHour );
+		WaterStorage( TankNum ).NetVdot = NetVolAdd / TimeStepSysSec;
+		WaterStorage( TankNum ).MainsDrawVol = WaterStorage( TankNum ).MainsDrawVdot * TimeStepSysSec;
 		WaterStorage( TankNum ).VdotToTank = TotVdotSupplyAvail;
 		WaterStorage( TankNum ).VdotFromTank = TotVdotDemandAvail;
 
@@ -131,6 +131,9 @@ namespace WaterThermalTanks {
 	int const InletModeFixed( 1 ); // water heater only, inlet water always enters at the user-specified height
 	int const InletModeSeeking( 2 ); // water heater only, inlet water seeks out the node with the closest temperature
 
+	int const NodeSolutionExplicit( 1 ); // stratified tanks, node heat balances stepped forward one second at a time
+	int const NodeSolutionImplicit( 2 ); // stratified tanks, node heat balances solved implicitly over longer sub time steps
+
 	// integer parameter for water heater
 	int const MixedWaterHeater( TypeOf_WtrHeaterMixed ); // WaterHeater:Mixed
 	int const StratifiedWaterHeater( TypeOf_WtrHeaterStratified ); // WaterHeater:Stratified
@@ -2815,6 +2818,19 @@ namespace WaterThermalTanks {
 						}
 					}
 
+					// Validate node solution method
+					{ auto const SELECT_CASE_var( cAlphaArgs( 23 ) );
+					if ( ( SELECT_CASE_var == "EXPLICIT" ) || ( SELECT_CASE_var == "" ) ) {
+						WaterThermalTank( WaterThermalTankNum ).NodeSolutionMethod = NodeSolutionExplicit;
+
+					} else if ( SELECT_CASE_var == "IMPLICIT" ) {
+						WaterThermalTank( WaterThermalTankNum ).NodeSolutionMethod = NodeSolutionImplicit;
+
+					} else {
+						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Invalid " + cAlphaFieldNames( 23 ) + " entered=" + cAlphaArgs( 23 ) );
+						ErrorsFound = true;
+					}}
+
 				} // WaterThermalTankNum
 
 				if ( ErrorsFound ) {
@@ -3337,6 +3353,19 @@ namespace WaterThermalTanks {
 
 					SetupStratifiedNodes( WaterThermalTankNum );
 
+					// Validate node solution method
+					{ auto const SELECT_CASE_var( cAlphaArgs( 15 ) );
+					if ( ( SELECT_CASE_var == "EXPLICIT" ) || ( SELECT_CASE_var == "" ) ) {
+						WaterThermalTank( WaterThermalTankNum ).NodeSolutionMethod = NodeSolutionExplicit;
+
+					} else if ( SELECT_CASE_var == "IMPLICIT" ) {
+						WaterThermalTank( WaterThermalTankNum ).NodeSolutionMethod = NodeSolutionImplicit;
+
+					} else {
+						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Invalid " + cAlphaFieldNames( 15 ) + " entered=" + cAlphaArgs( 15 ) );
+						ErrorsFound = true;
+					}}
+
 				} // WaterThermalTankNum
 
 				if ( ErrorsFound ) {
@@ -5841,6 +5870,7 @@ namespace WaterThermalTanks {
 		//       DATE WRITTEN   January 2007
 		//       MODIFIED       na
 		//                      Nov 2011, BAN; modified the use and source outlet temperature calculation
+		//                      Oct 2026, added the implicit node solution method
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5851,6 +5881,11 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With the implicit node solution method the node heat balances are solved by the backward Euler method over
+		// sub time steps of up to one minute.  Each node is coupled only to the nodes above and below, so the balances
+		// form a tridiagonal system that is solved directly and is stable for any sub time step.  A heater that would
+		// carry its node past the set point runs only for the part of the sub time step needed to reach it, and
+		// temperature inversions left by the solution are mixed out afterwards.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -5865,13 +5900,15 @@ namespace WaterThermalTanks {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const ExplicitTimeStep( 1.0 ); // Sub time step interval of the explicit node solution (s)
+		Real64 const ImplicitTimeStep( 60.0 ); // Longest sub time step interval of the implicit node solution (s)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
 		Real64 SecInTimeStep; // Seconds in one timestep (s)
 		Real64 TimeRemaining; // Time remaining in the current timestep (s)
+		Real64 dt; // Sub time step interval (s)
 		int NumNodes; // Number of stratified nodes
 		int NodeNum; // Node number index
 		Real64 NodeMass; // Mass of water in a node (kg)
@@ -5934,6 +5971,19 @@ namespace WaterThermalTanks {
 		bool SetPointRecovered; // Flag to indicate when set point is recovered for the first time
 		static int DummyWaterIndex( 1 );
 		Real64 HPWHCondenserDeltaT; // Temperature difference across the condenser for a heat pump water heater
+		bool HeaterOn; // Either heater is on at the start of the sub time step
+		Real64 HeaterFrac1; // Fraction of the sub time step that heater 1 runs
+		Real64 HeaterFrac2; // Fraction of the sub time step that heater 2 runs
+		Real64 HeaterOnFrac; // Fraction of the sub time step that either heater runs
+		Real64 NodeCapacitance; // Heat capacity of a node divided by the sub time step (W/K)
+		Real64 CoeffUp; // Heat transfer coefficient with the upper node, from conduction and flow (W/K)
+		Real64 CoeffDn; // Heat transfer coefficient with the lower node, from conduction and flow (W/K)
+		static Array1D< Real64 > SubDiag; // Coefficients of the temperatures of the nodes above (W/K)
+		static Array1D< Real64 > Diag; // Coefficients of the node temperatures (W/K)
+		static Array1D< Real64 > SuperDiag; // Coefficients of the temperatures of the nodes below (W/K)
+		static Array1D< Real64 > BaseTemp; // New node temperatures without the heaters (C)
+		static Array1D< Real64 > HeaterResponse1; // Node temperature rises due to heater 1 (deltaC)
+		static Array1D< Real64 > HeaterResponse2; // Node temperature rises due to heater 2 (deltaC)
 
 		// References
 		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
@@ -6011,9 +6061,24 @@ namespace WaterThermalTanks {
 
 		if ( Tank.InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
+		if ( ( Tank.NodeSolutionMethod == NodeSolutionImplicit ) && ( Diag.size() < std::size_t( NumNodes ) ) ) {
+			SubDiag.dimension( NumNodes, 0.0 );
+			Diag.dimension( NumNodes, 0.0 );
+			SuperDiag.dimension( NumNodes, 0.0 );
+			BaseTemp.dimension( NumNodes, 0.0 );
+			HeaterResponse1.dimension( NumNodes, 0.0 );
+			HeaterResponse2.dimension( NumNodes, 0.0 );
+		}
+
 		TimeRemaining = SecInTimeStep;
 		while ( TimeRemaining > 0.0 ) {
 
+			if ( Tank.NodeSolutionMethod == NodeSolutionImplicit ) {
+				dt = min( ImplicitTimeStep, TimeRemaining );
+			} else {
+				dt = ExplicitTimeStep;
+			}
+
 			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
 
 			if ( ! Tank.IsChilledWaterTank ) {
@@ -6091,81 +6156,223 @@ namespace WaterThermalTanks {
 				Qoffcycfuel = Tank.OffCycParaLoad;
 			}
 
-			// Loop through all nodes and simulate heat balance
-			for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
-				NodeMass = Tank.Node( NodeNum ).Mass;
-				NodeTemp = Tank.Node( NodeNum ).Temp;
+			if ( Tank.NodeSolutionMethod == NodeSolutionImplicit ) {
+				HeaterOn = Tank.HeaterOn1 || Tank.HeaterOn2;
 
-				UseMassFlowRate = Tank.Node( NodeNum ).UseMassFlowRate * Tank.UseEffectiveness;
-				SourceMassFlowRate = Tank.Node( NodeNum ).SourceMassFlowRate * Tank.SourceEffectiveness;
+				// Assemble the backward Euler heat balances of the nodes
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					StratifiedNodeData const & TankNode( Tank.Node( NodeNum ) );
+					NodeCapacitance = TankNode.Mass * Cp / dt;
 
-				// Heat transfer due to fluid flow entering an inlet node
-				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
-				Qsource = CalcStratifiedTankSourceSideHeatTransferRate(HPWHCondenserDeltaT, SourceInletTemp, Cp, SourceMassFlowRate, NodeTemp);
+					UseMassFlowRate = TankNode.UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = TankNode.SourceMassFlowRate * Tank.SourceEffectiveness;
 
-				InvMixUp = 0.0;
-				if ( NodeNum > 1 ) {
-					TempUp = Tank.Node( NodeNum - 1 ).Temp;
-					if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+					CoeffUp = 0.0;
+					if ( NodeNum > 1 ) CoeffUp = TankNode.CondCoeffUp + TankNode.MassFlowFromUpper * Cp;
+					CoeffDn = 0.0;
+					if ( NodeNum < NumNodes ) CoeffDn = TankNode.CondCoeffDn + TankNode.MassFlowFromLower * Cp;
+
+					if ( HeaterOn ) {
+						LossCoeff = TankNode.OnCycLossCoeff;
+						Qheat = TankNode.OnCycParaLoad * Tank.OnCycParaFracToTank;
+					} else {
+						LossCoeff = TankNode.OffCycLossCoeff;
+						Qheat = TankNode.OffCycParaLoad * Tank.OffCycParaFracToTank;
+					}
+
+					SubDiag( NodeNum ) = -CoeffUp;
+					SuperDiag( NodeNum ) = -CoeffDn;
+					Diag( NodeNum ) = NodeCapacitance + UseMassFlowRate * Cp + CoeffUp + CoeffDn + LossCoeff;
+					BaseTemp( NodeNum ) = NodeCapacitance * TankNode.Temp + UseMassFlowRate * Cp * UseInletTemp + LossCoeff * AmbientTemp + Qheat;
+					if ( HPWHCondenserDeltaT > 0.0 ) {
+						// The heat delivered by the heat pump does not depend on the node temperature
+						BaseTemp( NodeNum ) += SourceMassFlowRate * Cp * HPWHCondenserDeltaT;
+					} else {
+						Diag( NodeNum ) += SourceMassFlowRate * Cp;
+						BaseTemp( NodeNum ) += SourceMassFlowRate * Cp * SourceInletTemp;
+					}
+
+					HeaterResponse1( NodeNum ) = 0.0;
+					HeaterResponse2( NodeNum ) = 0.0;
 				}
 
-				InvMixDn = 0.0;
-				if ( NodeNum < NumNodes ) {
-					TempDn = Tank.Node( NodeNum + 1 ).Temp;
-					if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
+				// The balances are linear, so the new node temperatures are those without the heaters plus the rises due to
+				// each heater on its own
+				SolveStratifiedNodeBalance( NumNodes, SubDiag, Diag, SuperDiag, BaseTemp );
+				if ( Qheater1 > 0.0 ) {
+					HeaterResponse1( Tank.HeaterNode1 ) = Qheater1;
+					SolveStratifiedNodeBalance( NumNodes, SubDiag, Diag, SuperDiag, HeaterResponse1 );
+				}
+				if ( Qheater2 > 0.0 ) {
+					HeaterResponse2( Tank.HeaterNode2 ) = Qheater2;
+					SolveStratifiedNodeBalance( NumNodes, SubDiag, Diag, SuperDiag, HeaterResponse2 );
 				}
 
-				// Heat transfer due to vertical conduction between nodes
-				Qcond = Tank.Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
+				// A heater shuts off partway through the sub time step once its node reaches the set point
+				HeaterFrac1 = 1.0;
+				if ( Qheater1 > 0.0 ) {
+					NodeNum = Tank.HeaterNode1;
+					if ( BaseTemp( NodeNum ) + HeaterResponse1( NodeNum ) > SetPointTemp1 ) {
+						HeaterFrac1 = max( min( ( SetPointTemp1 - BaseTemp( NodeNum ) ) / HeaterResponse1( NodeNum ), 1.0 ), 0.0 );
+					}
+				}
 
-				// Heat transfer due to fluid flow between inlet and outlet nodes
-				Qflow = Tank.Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
+				HeaterFrac2 = 1.0;
+				if ( Qheater2 > 0.0 ) {
+					NodeNum = Tank.HeaterNode2;
+					NodeTemp = BaseTemp( NodeNum ) + HeaterFrac1 * HeaterResponse1( NodeNum );
+					if ( NodeTemp + HeaterResponse2( NodeNum ) > SetPointTemp2 ) {
+						HeaterFrac2 = max( min( ( SetPointTemp2 - NodeTemp ) / HeaterResponse2( NodeNum ), 1.0 ), 0.0 );
+					}
+				}
 
-				// Heat transfer due to temperature inversion mixing between nodes
-				Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
+				if ( HeaterOn ) {
+					HeaterOnFrac = 0.0;
+					if ( Tank.HeaterOn1 ) HeaterOnFrac = max( HeaterOnFrac, HeaterFrac1 );
+					if ( Tank.HeaterOn2 ) HeaterOnFrac = max( HeaterOnFrac, HeaterFrac2 );
+					Runtime -= ( 1.0 - HeaterOnFrac ) * dt;
 
-				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
-					LossCoeff = Tank.Node( NodeNum ).OnCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qlosszone = Qloss * Tank.SkinLossFracToZone;
-					Qoncycheat = Tank.Node( NodeNum ).OnCycParaLoad * Tank.OnCycParaFracToTank;
-
-					Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+					if ( HeaterFrac1 < 1.0 ) {
+						Runtime1 -= ( 1.0 - HeaterFrac1 ) * dt;
+						Qheater1 *= HeaterFrac1;
+						Tank.HeaterOn1 = false;
+						SetPointRecovered = true;
+					}
 
-					Qheat = Qoncycheat;
-					if ( NodeNum == Tank.HeaterNode1 ) Qheat += Qheater1;
-					if ( NodeNum == Tank.HeaterNode2 ) Qheat += Qheater2;
-				} else {
-					LossCoeff = Tank.Node( NodeNum ).OffCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qlosszone = Qloss * Tank.SkinLossFracToZone;
-					Qoffcycheat = Tank.Node( NodeNum ).OffCycParaLoad * Tank.OffCycParaFracToTank;
+					if ( HeaterFrac2 < 1.0 ) {
+						Runtime2 -= ( 1.0 - HeaterFrac2 ) * dt;
+						Qheater2 *= HeaterFrac2;
+						Tank.HeaterOn2 = false;
+						SetPointRecovered = true;
+					}
 
-					Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
-					Qheat = Qoffcycheat;
+					Qfuel = ( Qheater1 + Qheater2 ) / Tank.Efficiency;
+					Qoncycfuel = Tank.OnCycParaLoad * HeaterOnFrac;
+					Qoffcycfuel = Tank.OffCycParaLoad * ( 1.0 - HeaterOnFrac );
 				}
 
-				Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					Tank.Node( NodeNum ).NewTemp = BaseTemp( NodeNum ) + HeaterFrac1 * HeaterResponse1( NodeNum ) + HeaterFrac2 * HeaterResponse2( NodeNum );
+				}
 
-				// Calculate node heat balance
-				Tank.Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+				MixStratifiedNodeInversions( WaterThermalTankNum );
 
 				if ( ! Tank.IsChilledWaterTank ) {
-					if ( ( NodeNum == 1 ) && ( Tank.Node( 1 ).NewTemp > MaxTemp ) ) {
-						Event += NodeMass * Cp * ( MaxTemp - Tank.Node( 1 ).NewTemp );
+					if ( Tank.Node( 1 ).NewTemp > MaxTemp ) {
+						Event += Tank.Node( 1 ).Mass * Cp * ( MaxTemp - Tank.Node( 1 ).NewTemp );
 						Tank.Node( 1 ).NewTemp = MaxTemp;
 					}
 				}
 
-				Esource += Qsource * dt;
-				Eloss += Qloss * dt;
-				Elosszone += Qlosszone * dt;
-				Eneeded += Qneeded * dt;
-				Eunmet += Qunmet * dt;
+				// Heat transfer rates over the sub time step at the new node temperatures
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					NodeTemp = Tank.Node( NodeNum ).NewTemp;
 
-			} // NodeNum
+					UseMassFlowRate = Tank.Node( NodeNum ).UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = Tank.Node( NodeNum ).SourceMassFlowRate * Tank.SourceEffectiveness;
+
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					Qsource = CalcStratifiedTankSourceSideHeatTransferRate( HPWHCondenserDeltaT, SourceInletTemp, Cp, SourceMassFlowRate, NodeTemp );
+
+					if ( HeaterOn ) {
+						LossCoeff = Tank.Node( NodeNum ).OnCycLossCoeff;
+						Qheat = Tank.Node( NodeNum ).OnCycParaLoad * Tank.OnCycParaFracToTank;
+					} else {
+						LossCoeff = Tank.Node( NodeNum ).OffCycLossCoeff;
+						Qheat = Tank.Node( NodeNum ).OffCycParaLoad * Tank.OffCycParaFracToTank;
+					}
+					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+					Qlosszone = Qloss * Tank.SkinLossFracToZone;
+
+					Qneeded = max( -Quse - Qsource - Qloss - Qheat, 0.0 );
+					Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Elosszone += Qlosszone * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
+				}
+
+				Euse += Tank.UseMassFlowRate * Tank.UseEffectiveness * Cp * ( UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).NewTemp ) * dt;
+
+			} else {
+				// Loop through all nodes and simulate heat balance
+				for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+					NodeMass = Tank.Node( NodeNum ).Mass;
+					NodeTemp = Tank.Node( NodeNum ).Temp;
+
+					UseMassFlowRate = Tank.Node( NodeNum ).UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = Tank.Node( NodeNum ).SourceMassFlowRate * Tank.SourceEffectiveness;
+
+					// Heat transfer due to fluid flow entering an inlet node
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					Qsource = CalcStratifiedTankSourceSideHeatTransferRate(HPWHCondenserDeltaT, SourceInletTemp, Cp, SourceMassFlowRate, NodeTemp);
+
+					InvMixUp = 0.0;
+					if ( NodeNum > 1 ) {
+						TempUp = Tank.Node( NodeNum - 1 ).Temp;
+						if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+					}
+
+					InvMixDn = 0.0;
+					if ( NodeNum < NumNodes ) {
+						TempDn = Tank.Node( NodeNum + 1 ).Temp;
+						if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
+					}
+
+					// Heat transfer due to vertical conduction between nodes
+					Qcond = Tank.Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
+
+					// Heat transfer due to fluid flow between inlet and outlet nodes
+					Qflow = Tank.Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
+
+					// Heat transfer due to temperature inversion mixing between nodes
+					Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
+
+					if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+						LossCoeff = Tank.Node( NodeNum ).OnCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qlosszone = Qloss * Tank.SkinLossFracToZone;
+						Qoncycheat = Tank.Node( NodeNum ).OnCycParaLoad * Tank.OnCycParaFracToTank;
 
-			Euse += UseMassFlowRate * Cp * (UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).Temp) * dt;
+						Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+
+						Qheat = Qoncycheat;
+						if ( NodeNum == Tank.HeaterNode1 ) Qheat += Qheater1;
+						if ( NodeNum == Tank.HeaterNode2 ) Qheat += Qheater2;
+					} else {
+						LossCoeff = Tank.Node( NodeNum ).OffCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qlosszone = Qloss * Tank.SkinLossFracToZone;
+						Qoffcycheat = Tank.Node( NodeNum ).OffCycParaLoad * Tank.OffCycParaFracToTank;
+
+						Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
+						Qheat = Qoffcycheat;
+					}
+
+					Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+
+					// Calculate node heat balance
+					Tank.Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+
+					if ( ! Tank.IsChilledWaterTank ) {
+						if ( ( NodeNum == 1 ) && ( Tank.Node( 1 ).NewTemp > MaxTemp ) ) {
+							Event += NodeMass * Cp * ( MaxTemp - Tank.Node( 1 ).NewTemp );
+							Tank.Node( 1 ).NewTemp = MaxTemp;
+						}
+					}
+
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Elosszone += Qlosszone * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
+
+				} // NodeNum
+
+				Euse += UseMassFlowRate * Cp * (UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).Temp) * dt;
+			}
 
 			// Calculation for standard ratings
 			if ( ! Tank.FirstRecoveryDone ) {
@@ -6291,6 +6498,117 @@ namespace WaterThermalTanks {
 		return Qsource;
 	}
 
+	void
+	SolveStratifiedNodeBalance(
+		int const NumNodes, // Number of stratified nodes
+		Array1D< Real64 > const & SubDiag, // Coefficients of the temperatures of the nodes above
+		Array1D< Real64 > const & Diag, // Coefficients of the node temperatures
+		Array1D< Real64 > const & SuperDiag, // Coefficients of the temperatures of the nodes below
+		Array1D< Real64 > & Rhs // Right-hand sides on entry, node temperatures on exit
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the implicit heat balances of the nodes of a stratified tank for the new node temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// Each node exchanges heat only with the nodes directly above and below, so the balances form a tridiagonal
+		// system that is solved by forward elimination and back substitution (Thomas algorithm).  The system is
+		// diagonally dominant, so no pivoting is needed.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static Array1D< Real64 > ElimSuperDiag; // Coefficients of the nodes below after forward elimination
+		int NodeNum; // Node number index
+		Real64 Pivot; // Diagonal coefficient after forward elimination
+
+		// FLOW:
+		if ( ElimSuperDiag.size() < std::size_t( NumNodes ) ) ElimSuperDiag.dimension( NumNodes, 0.0 );
+
+		Pivot = Diag( 1 );
+		ElimSuperDiag( 1 ) = SuperDiag( 1 ) / Pivot;
+		Rhs( 1 ) /= Pivot;
+		for ( NodeNum = 2; NodeNum <= NumNodes; ++NodeNum ) {
+			Pivot = Diag( NodeNum ) - SubDiag( NodeNum ) * ElimSuperDiag( NodeNum - 1 );
+			ElimSuperDiag( NodeNum ) = SuperDiag( NodeNum ) / Pivot;
+			Rhs( NodeNum ) = ( Rhs( NodeNum ) - SubDiag( NodeNum ) * Rhs( NodeNum - 1 ) ) / Pivot;
+		}
+
+		for ( NodeNum = NumNodes - 1; NodeNum >= 1; --NodeNum ) {
+			Rhs( NodeNum ) -= ElimSuperDiag( NodeNum ) * Rhs( NodeNum + 1 );
+		}
+
+	}
+
+	void
+	MixStratifiedNodeInversions( int const WaterThermalTankNum ) // Water Heater being simulated
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Mixes out the temperature inversions left in the new node temperatures of a stratified tank by the implicit
+		// node solution method.
+
+		// METHODOLOGY EMPLOYED:
+		// Going down the tank, each node is added to a block of fully mixed nodes.  While the block above is colder than
+		// the block below, the two are mixed into one.  The mixed temperature of a block is its mass-weighted average,
+		// so the energy of the tank is conserved, and no inversion is left between the blocks.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static Array1D_int BlockTop; // Top node of each block of mixed nodes
+		static Array1D< Real64 > BlockMass; // Mass of each block (kg)
+		static Array1D< Real64 > BlockTemp; // Mixed temperature of each block (C)
+		int NumNodes; // Number of stratified nodes
+		int NumBlocks; // Number of blocks of mixed nodes
+		int NodeNum; // Node number index
+		int BlockNum; // Block number index
+
+		// References to objects
+		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum );
+
+		// FLOW:
+		NumNodes = Tank.Nodes;
+		if ( BlockTop.size() < std::size_t( NumNodes ) ) {
+			BlockTop.dimension( NumNodes, 0 );
+			BlockMass.dimension( NumNodes, 0.0 );
+			BlockTemp.dimension( NumNodes, 0.0 );
+		}
+
+		NumBlocks = 0;
+		for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			++NumBlocks;
+			BlockTop( NumBlocks ) = NodeNum;
+			BlockMass( NumBlocks ) = Tank.Node( NodeNum ).Mass;
+			BlockTemp( NumBlocks ) = Tank.Node( NodeNum ).NewTemp;
+
+			while ( ( NumBlocks > 1 ) && ( BlockTemp( NumBlocks - 1 ) < BlockTemp( NumBlocks ) ) ) {
+				BlockTemp( NumBlocks - 1 ) = ( BlockMass( NumBlocks - 1 ) * BlockTemp( NumBlocks - 1 ) + BlockMass( NumBlocks ) * BlockTemp( NumBlocks ) ) / ( BlockMass( NumBlocks - 1 ) + BlockMass( NumBlocks ) );
+				BlockMass( NumBlocks - 1 ) += BlockMass( NumBlocks );
+				--NumBlocks;
+			}
+		}
+
+		if ( NumBlocks == NumNodes ) return; // No inversions
+
+		for ( BlockNum = 1; BlockNum <= NumBlocks; ++BlockNum ) {
+			int const BottomNode( ( BlockNum < NumBlocks ) ? BlockTop( BlockNum + 1 ) - 1 : NumNodes );
+			for ( NodeNum = BlockTop( BlockNum ); NodeNum <= BottomNode; ++NodeNum ) {
+				Tank.Node( NodeNum ).NewTemp = BlockTemp( BlockNum );
+			}
+		}
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
@@ -50,6 +50,9 @@ namespace WaterThermalTanks {
 	extern int const InletModeFixed; // water heater only, inlet water always enters at the user-specified height
 	extern int const InletModeSeeking; // water heater only, inlet water seeks out the node with the closest temperature
 
+	extern int const NodeSolutionExplicit; // stratified tanks, node heat balances stepped forward one second at a time
+	extern int const NodeSolutionImplicit; // stratified tanks, node heat balances solved implicitly over longer sub time steps
+
 	// integer parameter for water heater
 	extern int const MixedWaterHeater; // WaterHeater:Mixed
 	extern int const StratifiedWaterHeater; // WaterHeater:Stratified
@@ -450,6 +453,7 @@ namespace WaterThermalTanks {
 		int SourceInletStratNode; // Source-side inlet node number
 		int SourceOutletStratNode; // Source-side outlet node number
 		int InletMode; // Inlet position mode:  1 = FIXED; 2 = SEEKING
+		int NodeSolutionMethod; // Node heat balance solution:  1 = EXPLICIT; 2 = IMPLICIT
 		Real64 InversionMixingRate;
 		Array1D< Real64 > AdditionalLossCoeff; // Loss coefficient added to the skin loss coefficient (W/m2-K)
 		int Nodes; // Number of nodes
@@ -630,6 +634,7 @@ namespace WaterThermalTanks {
 			SourceInletStratNode( 0 ),
 			SourceOutletStratNode( 0 ),
 			InletMode( 1 ),
+			NodeSolutionMethod( 1 ),
 			InversionMixingRate( 0.0 ),
 			Nodes( 0 ),
 			VolFlowRate( 0.0 ),
@@ -1459,6 +1464,18 @@ namespace WaterThermalTanks {
 		Real64 NodeTemp // temperature of the source inlet node (C)
 	);
 
+	void
+	SolveStratifiedNodeBalance(
+		int const NumNodes, // Number of stratified nodes
+		Array1D< Real64 > const & SubDiag, // Coefficients of the temperatures of the nodes above
+		Array1D< Real64 > const & Diag, // Coefficients of the node temperatures
+		Array1D< Real64 > const & SuperDiag, // Coefficients of the temperatures of the nodes below
+		Array1D< Real64 > & Rhs // Right-hand sides on entry, node temperatures on exit
+	);
+
+	void
+	MixStratifiedNodeInversions( int const WaterThermalTankNum ); // Water Heater being simulated
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
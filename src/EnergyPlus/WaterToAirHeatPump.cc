@@ -850,6 +850,7 @@ namespace WaterToAirHeatPump {
 		//       AUTHOR         Hui Jin
 		//       DATE WRITTEN   Oct 2000
 		//       MODIFIED       Dan Fisher, Kenneth Tang (Jan 2004), R. Raustad (Oct 2006) Revised iteration technique
+		//                      Oct 2026, warm start the suction state solve from the previous solution
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -880,6 +881,7 @@ namespace WaterToAirHeatPump {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const CpWater( 4210.0 ); // Specific heat of water J/kg_C
 		Real64 const DegreeofSuperheat( 80.0 ); // Initial guess of degree of superheat
+		Real64 const SuctionTempBand( 2.0 ); // Half width of the warm started suction temperature bracket [C]
 		Real64 const gamma( 1.114 ); // Expansion Coefficient
 		Real64 const RelaxParam( 0.5 ); // Relaxation Parameter
 		Real64 const ERR( 0.01 ); // Error Value
@@ -1303,11 +1305,22 @@ namespace WaterToAirHeatPump {
 					Par( 2 ) = double( RefrigIndex );
 					Par( 3 ) = SuperHeatEnth;
 
-					SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
+					// Warm start: bracket the previous suction temperature of this unit first, which usually holds the root
+					// in a much narrower interval; fall back to the full bracket when it does not
+					SolFlag = -2;
+					if ( WatertoAirHP( HPNum ).HaveCompSuctionTemp ) {
+						Real64 const PrevSuctionTemp( WatertoAirHP( HPNum ).PrevCompSuctionTemp );
+						if ( PrevSuctionTemp > CompSuctionTemp1 && PrevSuctionTemp < CompSuctionTemp2 ) {
+							SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, max( CompSuctionTemp1, PrevSuctionTemp - SuctionTempBand ), min( CompSuctionTemp2, PrevSuctionTemp + SuctionTempBand ), Par );
+						}
+					}
+					if ( SolFlag == -2 ) SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
 					if ( SolFlag == -1 ) {
 						WatertoAirHP( HPNum ).SimFlag = false;
 						return;
 					}
+					WatertoAirHP( HPNum ).PrevCompSuctionTemp = CompSuctionTemp;
+					WatertoAirHP( HPNum ).HaveCompSuctionTemp = true;
 					CompSuctionEnth = GetSupHeatEnthalpyRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
 					CompSuctionDensity = GetSupHeatDensityRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
 
@@ -1518,6 +1531,7 @@ namespace WaterToAirHeatPump {
 		//       AUTHOR         Hui Jin
 		//       DATE WRITTEN   Oct 2000
 		//       MODIFIED       R. Raustad (Oct 2006) Revised iteration technique
+		//                      Oct 2026, warm start the suction state solve from the previous solution
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1543,6 +1557,7 @@ namespace WaterToAirHeatPump {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const CpWater( 4210.0 ); // Specific heat of water J/kg_C
 		Real64 const DegreeofSuperheat( 80.0 ); // Initial guess of degree of superheat
+		Real64 const SuctionTempBand( 2.0 ); // Half width of the warm started suction temperature bracket [C]
 		Real64 const gamma( 1.114 ); // Expnasion Coefficient
 		Real64 const RelaxParam( 0.5 ); // Relaxation Parameter
 		Real64 const ERR( 0.01 ); // Error Value
@@ -1835,11 +1850,22 @@ namespace WaterToAirHeatPump {
 				Par( 2 ) = double( RefrigIndex );
 				Par( 3 ) = SuperHeatEnth;
 
-				SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
+				// Warm start: bracket the previous suction temperature of this unit first, which usually holds the root
+				// in a much narrower interval; fall back to the full bracket when it does not
+				SolFlag = -2;
+				if ( WatertoAirHP( HPNum ).HaveCompSuctionTemp ) {
+					Real64 const PrevSuctionTemp( WatertoAirHP( HPNum ).PrevCompSuctionTemp );
+					if ( PrevSuctionTemp > CompSuctionTemp1 && PrevSuctionTemp < CompSuctionTemp2 ) {
+						SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, max( CompSuctionTemp1, PrevSuctionTemp - SuctionTempBand ), min( CompSuctionTemp2, PrevSuctionTemp + SuctionTempBand ), Par );
+					}
+				}
+				if ( SolFlag == -2 ) SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
 				if ( SolFlag == -1 ) {
 					WatertoAirHP( HPNum ).SimFlag = false;
 					return;
 				}
+				WatertoAirHP( HPNum ).PrevCompSuctionTemp = CompSuctionTemp;
+				WatertoAirHP( HPNum ).HaveCompSuctionTemp = true;
 				CompSuctionEnth = GetSupHeatEnthalpyRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
 				CompSuctionDensity = GetSupHeatDensityRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
 
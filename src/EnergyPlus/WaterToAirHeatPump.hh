@@ -121,6 +121,8 @@ namespace WaterToAirHeatPump {
 		int LoopSide; // plant loop side index
 		int BranchNum; // plant branch index
 		int CompNum; // plant component index
+		bool HaveCompSuctionTemp; // true once PrevCompSuctionTemp holds a solved suction temperature
+		Real64 PrevCompSuctionTemp; // last solved compressor suction temperature, warm starts the next solve [C]
 
 		// Default Constructor
 		WatertoAirHPEquipConditions() :
@@ -189,7 +191,9 @@ namespace WaterToAirHeatPump {
 			LoopNum( 0 ),
 			LoopSide( 0 ),
 			BranchNum( 0 ),
-			CompNum( 0 )
+			CompNum( 0 ),
+			HaveCompSuctionTemp( false ),
+			PrevCompSuctionTemp( 0.0 )
 		{}
 
 		// Member Constructor
@@ -332,7 +336,9 @@ namespace WaterToAirHeatPump {
 			LoopNum( LoopNum ),
 			LoopSide( LoopSide ),
 			BranchNum( BranchNum ),
-			CompNum( CompNum )
+			CompNum( CompNum ),
+			HaveCompSuctionTemp( false ),
+			PrevCompSuctionTemp( 0.0 )
 		{}
 
 	};
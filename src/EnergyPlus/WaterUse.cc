@@ -147,6 +147,7 @@ namespace WaterUse {
 		// Simulate all unconnected WATER USE EQUIPMENT objects
 		for ( WaterEquipNum = 1; WaterEquipNum <= NumWaterEquipment; ++WaterEquipNum ) {
 			if ( WaterEquipment( WaterEquipNum ).Connections == 0 ) {
+				CalcEquipmentDemand( WaterEquipNum );
 				CalcEquipmentFlowRates( WaterEquipNum );
 				CalcEquipmentDrainTemp( WaterEquipNum );
 			}
@@ -727,6 +728,99 @@ namespace WaterUse {
 
 	}
 
+	void
+	CalcEquipmentDemand( int const WaterEquipNum )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Peter Graham Ellis
+		//       DATE WRITTEN   August 2006
+		//       MODIFIED       Oct 2026, separated from CalcEquipmentFlowRates and CalcEquipmentDrainTemp
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculate the scheduled total flow rate and target temperature, and the moisture evaporated
+		// to the zone.
+
+		// METHODOLOGY EMPLOYED:
+		// None of these depend on the hot and cold water temperatures, so they are calculated once
+		// per call of the connections (InitConnections) rather than on every heat recovery iteration.
+
+		// Using/Aliasing
+		using ScheduleManager::GetCurrentScheduleValue;
+		using Psychrometrics::RhoH2O;
+		using Psychrometrics::PsyWFnTdbRhPb;
+		using Psychrometrics::PsyRhoAirFnPbTdbW;
+		using Psychrometrics::PsyHfgAirFnWTdb;
+		using DataHeatBalFanSys::MAT;
+		using DataHeatBalFanSys::ZoneAirHumRat;
+		using DataHeatBalance::Zone;
+		using DataEnvironment::OutBaroPress;
+		using DataGlobals::SecInHour;
+		using DataHVACGlobals::TimeStepSys;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+		Real64 ZoneMAT;
+		Real64 ZoneHumRat;
+		Real64 ZoneHumRatSat;
+		Real64 RhoAirDry;
+		Real64 ZoneMassMax;
+		Real64 FlowMassMax;
+		Real64 MoistureMassMax;
+
+		static std::string const RoutineName( "CalcEquipmentDemand" );
+
+		// FLOW:
+		if ( WaterEquipment( WaterEquipNum ).TargetTempSchedule > 0 ) {
+			WaterEquipment( WaterEquipNum ).TargetTemp = GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).TargetTempSchedule );
+		} // else CalcEquipmentFlowRates uses all hot water
+
+		// Get the requested total flow rate
+		// 11-17-2006 BG Added multipliers in next block
+		if ( WaterEquipment( WaterEquipNum ).Zone > 0 ) {
+			if ( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule > 0 ) {
+				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule ) * Zone( WaterEquipment( WaterEquipNum ).Zone ).Multiplier * Zone( WaterEquipment( WaterEquipNum ).Zone ).ListMultiplier;
+			} else {
+				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * Zone( WaterEquipment( WaterEquipNum ).Zone ).Multiplier * Zone( WaterEquipment( WaterEquipNum ).Zone ).ListMultiplier;
+			}
+		} else {
+			if ( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule > 0 ) {
+				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule );
+			} else {
+				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate;
+			}
+		}
+
+		WaterEquipment( WaterEquipNum ).TotalMassFlowRate = WaterEquipment( WaterEquipNum ).TotalVolFlowRate * RhoH2O( InitConvTemp );
+
+		// Moisture gain to the zone
+		WaterEquipment( WaterEquipNum ).LatentRate = 0.0;
+		WaterEquipment( WaterEquipNum ).LatentEnergy = 0.0;
+
+		if ( ( WaterEquipment( WaterEquipNum ).Zone > 0 ) && ( WaterEquipment( WaterEquipNum ).TotalMassFlowRate != 0.0 ) && ( WaterEquipment( WaterEquipNum ).LatentFracSchedule != 0 ) ) {
+			ZoneNum = WaterEquipment( WaterEquipNum ).Zone;
+			ZoneMAT = MAT( ZoneNum );
+			ZoneHumRat = ZoneAirHumRat( ZoneNum );
+			ZoneHumRatSat = PsyWFnTdbRhPb( ZoneMAT, 1.0, OutBaroPress, RoutineName ); // Humidratio at 100% relative humidity
+			RhoAirDry = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneMAT, 0.0 );
+
+			ZoneMassMax = ( ZoneHumRatSat - ZoneHumRat ) * RhoAirDry * Zone( ZoneNum ).Volume; // Max water that can be evaporated to zone
+			FlowMassMax = WaterEquipment( WaterEquipNum ).TotalMassFlowRate * TimeStepSys * SecInHour; // Max water in flow
+			MoistureMassMax = min( ZoneMassMax, FlowMassMax );
+
+			WaterEquipment( WaterEquipNum ).MoistureMass = GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).LatentFracSchedule ) * MoistureMassMax;
+			WaterEquipment( WaterEquipNum ).MoistureRate = WaterEquipment( WaterEquipNum ).MoistureMass / ( TimeStepSys * SecInHour );
+
+			WaterEquipment( WaterEquipNum ).LatentRate = WaterEquipment( WaterEquipNum ).MoistureRate * PsyHfgAirFnWTdb( ZoneHumRat, ZoneMAT );
+			WaterEquipment( WaterEquipNum ).LatentEnergy = WaterEquipment( WaterEquipNum ).LatentRate * TimeStepSys * SecInHour;
+		}
+
+	}
+
 	void
 	CalcEquipmentFlowRates( int const WaterEquipNum )
 	{
@@ -734,19 +828,18 @@ namespace WaterUse {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, scheduled total flow and target temperature moved to CalcEquipmentDemand
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Calculate desired hot and cold water flow rates
 
 		// METHODOLOGY EMPLOYED:
+		// The total flow rate and target temperature are set by CalcEquipmentDemand.
 
 		// Using/Aliasing
 		using ScheduleManager::GetCurrentScheduleValue;
-		using Psychrometrics::RhoH2O;
 		using DataEnvironment::WaterMainsTemp;
-		using DataHeatBalance::Zone;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -777,30 +870,10 @@ namespace WaterUse {
 			}
 		}
 
-		if ( WaterEquipment( WaterEquipNum ).TargetTempSchedule > 0 ) {
-			WaterEquipment( WaterEquipNum ).TargetTemp = GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).TargetTempSchedule );
-		} else { // If no TargetTempSchedule, use all hot water
+		if ( WaterEquipment( WaterEquipNum ).TargetTempSchedule == 0 ) { // If no TargetTempSchedule, use all hot water
 			WaterEquipment( WaterEquipNum ).TargetTemp = WaterEquipment( WaterEquipNum ).HotTemp;
 		}
 
-		// Get the requested total flow rate
-		// 11-17-2006 BG Added multipliers in next block
-		if ( WaterEquipment( WaterEquipNum ).Zone > 0 ) {
-			if ( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule > 0 ) {
-				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule ) * Zone( WaterEquipment( WaterEquipNum ).Zone ).Multiplier * Zone( WaterEquipment( WaterEquipNum ).Zone ).ListMultiplier;
-			} else {
-				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * Zone( WaterEquipment( WaterEquipNum ).Zone ).Multiplier * Zone( WaterEquipment( WaterEquipNum ).Zone ).ListMultiplier;
-			}
-		} else {
-			if ( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule > 0 ) {
-				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate * GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).FlowRateFracSchedule );
-			} else {
-				WaterEquipment( WaterEquipNum ).TotalVolFlowRate = WaterEquipment( WaterEquipNum ).PeakVolFlowRate;
-			}
-		}
-
-		WaterEquipment( WaterEquipNum ).TotalMassFlowRate = WaterEquipment( WaterEquipNum ).TotalVolFlowRate * RhoH2O( InitConvTemp );
-
 		// Calculate hot and cold water mixing at the tap
 		if ( WaterEquipment( WaterEquipNum ).TotalMassFlowRate > 0.0 ) {
 			// Calculate the flow rates needed to meet the target temperature
@@ -842,24 +915,19 @@ namespace WaterUse {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   August 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, moisture gain moved to CalcEquipmentDemand
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Calculate drainwater temperature and heat and moisture gains to zone.
 
 		// METHODOLOGY EMPLOYED:
+		// The moisture gain is set by CalcEquipmentDemand.
 
 		// Using/Aliasing
 		using ScheduleManager::GetCurrentScheduleValue;
 		using Psychrometrics::CPHW;
-		using Psychrometrics::PsyWFnTdbRhPb;
-		using Psychrometrics::PsyRhoAirFnPbTdbW;
-		using Psychrometrics::PsyHfgAirFnWTdb;
 		using DataHeatBalFanSys::MAT;
-		using DataHeatBalFanSys::ZoneAirHumRat;
-		using DataHeatBalance::Zone;
-		using DataEnvironment::OutBaroPress;
 		using DataGlobals::SecInHour;
 		using DataHVACGlobals::TimeStepSys;
 
@@ -869,21 +937,11 @@ namespace WaterUse {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum;
 		Real64 ZoneMAT;
-		Real64 ZoneHumRat;
-		Real64 ZoneHumRatSat;
-		Real64 RhoAirDry;
-		Real64 ZoneMassMax;
-		Real64 FlowMassMax;
-		Real64 MoistureMassMax;
-
-		static std::string const RoutineName( "CalcEquipmentDrainTemp" );
 
 		// FLOW:
 
 		WaterEquipment( WaterEquipNum ).SensibleRate = 0.0;
 		WaterEquipment( WaterEquipNum ).SensibleEnergy = 0.0;
-		WaterEquipment( WaterEquipNum ).LatentRate = 0.0;
-		WaterEquipment( WaterEquipNum ).LatentEnergy = 0.0;
 
 		if ( ( WaterEquipment( WaterEquipNum ).Zone == 0 ) || ( WaterEquipment( WaterEquipNum ).TotalMassFlowRate == 0.0 ) ) {
 			WaterEquipment( WaterEquipNum ).DrainTemp = WaterEquipment( WaterEquipNum ).MixedTemp;
@@ -901,25 +959,6 @@ namespace WaterUse {
 				WaterEquipment( WaterEquipNum ).SensibleEnergy = WaterEquipment( WaterEquipNum ).SensibleRate * TimeStepSys * SecInHour;
 			}
 
-			if ( WaterEquipment( WaterEquipNum ).LatentFracSchedule == 0 ) {
-				WaterEquipment( WaterEquipNum ).LatentRate = 0.0;
-				WaterEquipment( WaterEquipNum ).LatentEnergy = 0.0;
-			} else {
-				ZoneHumRat = ZoneAirHumRat( ZoneNum );
-				ZoneHumRatSat = PsyWFnTdbRhPb( ZoneMAT, 1.0, OutBaroPress, RoutineName ); // Humidratio at 100% relative humidity
-				RhoAirDry = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneMAT, 0.0 );
-
-				ZoneMassMax = ( ZoneHumRatSat - ZoneHumRat ) * RhoAirDry * Zone( ZoneNum ).Volume; // Max water that can be evaporated to zone
-				FlowMassMax = WaterEquipment( WaterEquipNum ).TotalMassFlowRate * TimeStepSys * SecInHour; // Max water in flow
-				MoistureMassMax = min( ZoneMassMax, FlowMassMax );
-
-				WaterEquipment( WaterEquipNum ).MoistureMass = GetCurrentScheduleValue( WaterEquipment( WaterEquipNum ).LatentFracSchedule ) * MoistureMassMax;
-				WaterEquipment( WaterEquipNum ).MoistureRate = WaterEquipment( WaterEquipNum ).MoistureMass / ( TimeStepSys * SecInHour );
-
-				WaterEquipment( WaterEquipNum ).LatentRate = WaterEquipment( WaterEquipNum ).MoistureRate * PsyHfgAirFnWTdb( ZoneHumRat, ZoneMAT );
-				WaterEquipment( WaterEquipNum ).LatentEnergy = WaterEquipment( WaterEquipNum ).LatentRate * TimeStepSys * SecInHour;
-			}
-
 			WaterEquipment( WaterEquipNum ).DrainMassFlowRate = WaterEquipment( WaterEquipNum ).TotalMassFlowRate - WaterEquipment( WaterEquipNum ).MoistureRate;
 
 			if ( WaterEquipment( WaterEquipNum ).DrainMassFlowRate == 0.0 ) {
@@ -939,6 +978,7 @@ namespace WaterUse {
 		//       AUTHOR         Peter Graham Ellis
 		//       DATE WRITTEN   August 2006
 		//       MODIFIED       Brent Griffith 2010, demand side update
+		//                      Oct 2026, calculate the scheduled demand of the connected equipment
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1035,6 +1075,11 @@ namespace WaterUse {
 			}
 		}
 
+		// The scheduled demand of the equipment does not change during the heat recovery iteration
+		for ( int Loop = 1; Loop <= WaterConnections( WaterConnNum ).NumWaterEquipment; ++Loop ) {
+			CalcEquipmentDemand( WaterConnections( WaterConnNum ).WaterEquipment( Loop ) );
+		}
+
 	}
 
 	void
@@ -477,6 +477,9 @@ namespace WaterUse {
 	void
 	GetWaterUseInput();
 
+	void
+	CalcEquipmentDemand( int const WaterEquipNum );
+
 	void
 	CalcEquipmentFlowRates( int const WaterEquipNum );
 
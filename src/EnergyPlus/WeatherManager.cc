@@ -2,6 +2,7 @@
 #include <cmath>
 #include <cstdio>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -28,6 +29,7 @@
 #include <OutputReportPredefined.hh>
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
 
@@ -266,6 +268,7 @@ namespace WeatherManager {
 	DayWeatherVariables TodayVariables; // Today's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
 	DayWeatherVariables TomorrowVariables; // Tomorrow's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
 	Array1D< DayWeatherVariables > DesignDay; // Design day environments
+	Array1D< DesignDayWeatherData > DesignDayWeather; // Generated weather arrays of the design days
 	MissingData Missing; // Dry Bulb Temperature (C) | Dew Point Temperature (C) | Relative Humidity (%) | Atmospheric Pressure (Pa) | Wind Direction (deg) | Wind Speed/Velocity (m/s) | Total Sky Cover (tenths) | Opaque Sky Cover (tenths) | Visibility (km) | Ceiling Height (m) | Precipitable Water (mm) | Aerosol Optical Depth | Snow Depth (cm) | Number of Days since last snow | Albedo | Rain/Liquid Precipitation (mm)
 	MissingDataCounts Missed;
 	RangeDataCounts OutOfRange;
@@ -280,6 +283,7 @@ namespace WeatherManager {
 	Array1D< WeatherProperties > WPSkyTemperature;
 	Array1D< SpecialDayData > SpecialDays;
 	Array1D< DataPeriodData > DataPeriods;
+	std::unordered_map< std::string, InterpretedWeatherLine > InterpretedWeatherLines; // Weather lines interpreted so far, by line text
 
 	static gio::Fmt fmtA( "(A)" );
 	static gio::Fmt fmtAN( "(A,$)" );
@@ -3119,6 +3123,9 @@ namespace WeatherManager {
 		// Field by field interpretation, eliminating the "data source field" which is also
 		// likely to contain blanks.  Note that the "Weatherconditions" must be a 9 character
 		// alpha field with no intervening blanks.
+		// The same lines are read again on every warmup day and whenever an environment searches
+		// the file for its start day, so the results are kept by line text and reused, unless
+		// a memory budget is given (MemoryBudget), when each line is interpreted as it is read.
 
 		// REFERENCES:
 		// CALL InterpretWeatherDataLine(WeatherDataLine,ErrorFound,WYear,WMonth,WDay,WHour,WMinute,  &
@@ -3161,9 +3168,51 @@ namespace WeatherManager {
 		int Count;
 		static int LCount( 0 );
 		bool DateInError;
+		bool MissedWeathCodes( false );
 
 		++LCount;
 		ErrorFound = false;
+
+		auto const Found( InterpretedWeatherLines.find( Line ) );
+		if ( Found != InterpretedWeatherLines.end() ) { // Line interpreted before
+			auto const & Interpreted( Found->second );
+			WYear = Interpreted.WYear;
+			WMonth = Interpreted.WMonth;
+			WDay = Interpreted.WDay;
+			WHour = Interpreted.WHour;
+			WMinute = Interpreted.WMinute;
+			RField1 = Interpreted.RField( 1 );
+			RField2 = Interpreted.RField( 2 );
+			RField3 = Interpreted.RField( 3 );
+			RField4 = Interpreted.RField( 4 );
+			RField5 = Interpreted.RField( 5 );
+			RField6 = Interpreted.RField( 6 );
+			RField7 = Interpreted.RField( 7 );
+			RField8 = Interpreted.RField( 8 );
+			RField9 = Interpreted.RField( 9 );
+			RField10 = Interpreted.RField( 10 );
+			RField11 = Interpreted.RField( 11 );
+			RField12 = Interpreted.RField( 12 );
+			RField13 = Interpreted.RField( 13 );
+			RField14 = Interpreted.RField( 14 );
+			RField15 = Interpreted.RField( 15 );
+			RField16 = Interpreted.RField( 16 );
+			RField17 = Interpreted.RField( 17 );
+			RField18 = Interpreted.RField( 18 );
+			RField19 = Interpreted.RField( 19 );
+			RField20 = Interpreted.RField( 20 );
+			WObs = Interpreted.WObs;
+			WCodesArr = Interpreted.WCodesArr;
+			RField22 = Interpreted.RField( 22 );
+			RField23 = Interpreted.RField( 23 );
+			RField24 = Interpreted.RField( 24 );
+			RField25 = Interpreted.RField( 25 );
+			RField26 = Interpreted.RField( 26 );
+			RField27 = Interpreted.RField( 27 );
+			if ( Interpreted.MissedWeathCodes ) ++Missed.WeathCodes;
+			return;
+		}
+
 		std::string const SaveLine = Line; // in case of errors
 
 		// Do the first five.  (To get to the DataSource field)
@@ -3327,12 +3376,52 @@ namespace WeatherManager {
 				gio::read( PresWeathCodes, fmt9I1 ) >> WCodesArr;
 			} else {
 				++Missed.WeathCodes;
+				MissedWeathCodes = true;
 				WCodesArr = 9;
 			}
 		} else {
 			WCodesArr = 9;
 		}
 
+		if ( DataSystemVariables::MemoryBudget <= 0.0 ) { // Keep the results for the next time this line is read
+			auto & Interpreted( InterpretedWeatherLines[ SaveLine ] );
+			Interpreted.WYear = WYear;
+			Interpreted.WMonth = WMonth;
+			Interpreted.WDay = WDay;
+			Interpreted.WHour = WHour;
+			Interpreted.WMinute = WMinute;
+			Interpreted.RField( 1 ) = RField1;
+			Interpreted.RField( 2 ) = RField2;
+			Interpreted.RField( 3 ) = RField3;
+			Interpreted.RField( 4 ) = RField4;
+			Interpreted.RField( 5 ) = RField5;
+			Interpreted.RField( 6 ) = RField6;
+			Interpreted.RField( 7 ) = RField7;
+			Interpreted.RField( 8 ) = RField8;
+			Interpreted.RField( 9 ) = RField9;
+			Interpreted.RField( 10 ) = RField10;
+			Interpreted.RField( 11 ) = RField11;
+			Interpreted.RField( 12 ) = RField12;
+			Interpreted.RField( 13 ) = RField13;
+			Interpreted.RField( 14 ) = RField14;
+			Interpreted.RField( 15 ) = RField15;
+			Interpreted.RField( 16 ) = RField16;
+			Interpreted.RField( 17 ) = RField17;
+			Interpreted.RField( 18 ) = RField18;
+			Interpreted.RField( 19 ) = RField19;
+			Interpreted.RField( 20 ) = RField20;
+			Interpreted.RField( 21 ) = RField21;
+			Interpreted.WObs = WObs;
+			Interpreted.WCodesArr = WCodesArr;
+			Interpreted.RField( 22 ) = RField22;
+			Interpreted.RField( 23 ) = RField23;
+			Interpreted.RField( 24 ) = RField24;
+			Interpreted.RField( 25 ) = RField25;
+			Interpreted.RField( 26 ) = RField26;
+			Interpreted.RField( 27 ) = RField27;
+			Interpreted.MissedWeathCodes = MissedWeathCodes;
+		}
+
 		return;
 
 Label900: ;
@@ -3371,6 +3460,7 @@ Label902: ;
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   February 1977
 		//       MODIFIED       June 1997 (RKS); May 2013 (LKL) add temperature profile for drybulb.
+		//                      Oct 2026, reuse the weather generated for earlier environments of the design day
 		//       RE-ENGINEERED  August 2003;LKL -- to generate timestep weather for design days.
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3637,6 +3727,29 @@ Label902: ;
 
 		CurrentTime = 25.0;
 
+		// The weather of a design day is the same in each of its environments (the sizing passes and the
+		// HVAC sizing simulation iterations), so the arrays generated the first time are copied back.
+		// EMS weather overrides act on the current values later in the time step, not on these arrays.
+		DesignDayWeatherData & ddWeather( DesignDayWeather( EnvrnNum ) );
+		if ( ddWeather.Generated ) {
+			TomorrowIsRain = ddWeather.IsRain;
+			TomorrowIsSnow = ddWeather.IsSnow;
+			TomorrowOutDryBulbTemp = ddWeather.OutDryBulbTemp;
+			TomorrowOutDewPointTemp = ddWeather.OutDewPointTemp;
+			TomorrowOutBaroPress = ddWeather.OutBaroPress;
+			TomorrowOutRelHum = ddWeather.OutRelHum;
+			TomorrowWindSpeed = ddWeather.WindSpeed;
+			TomorrowWindDir = ddWeather.WindDir;
+			TomorrowSkyTemp = ddWeather.SkyTemp;
+			TomorrowHorizIRSky = ddWeather.HorizIRSky;
+			TomorrowBeamSolarRad = ddWeather.BeamSolarRad;
+			TomorrowDifSolarRad = ddWeather.DifSolarRad;
+			TomorrowAlbedo = ddWeather.Albedo;
+			TomorrowLiquidPrecip = ddWeather.LiquidPrecip;
+			WarmupFlag = SaveWarmupFlag;
+			return;
+		}
+
 		{ auto const SELECT_CASE_var( DesDayInput( EnvrnNum ).HumIndType );
 
 		if ( SELECT_CASE_var == DDHumIndType_WetBulb ) {
@@ -3899,6 +4012,22 @@ Label902: ;
 
 		}
 
+		ddWeather.IsRain = TomorrowIsRain;
+		ddWeather.IsSnow = TomorrowIsSnow;
+		ddWeather.OutDryBulbTemp = TomorrowOutDryBulbTemp;
+		ddWeather.OutDewPointTemp = TomorrowOutDewPointTemp;
+		ddWeather.OutBaroPress = TomorrowOutBaroPress;
+		ddWeather.OutRelHum = TomorrowOutRelHum;
+		ddWeather.WindSpeed = TomorrowWindSpeed;
+		ddWeather.WindDir = TomorrowWindDir;
+		ddWeather.SkyTemp = TomorrowSkyTemp;
+		ddWeather.HorizIRSky = TomorrowHorizIRSky;
+		ddWeather.BeamSolarRad = TomorrowBeamSolarRad;
+		ddWeather.DifSolarRad = TomorrowDifSolarRad;
+		ddWeather.Albedo = TomorrowAlbedo;
+		ddWeather.LiquidPrecip = TomorrowLiquidPrecip;
+		ddWeather.Generated = true;
+
 		WarmupFlag = SaveWarmupFlag;
 
 	}
@@ -5063,6 +5192,7 @@ Label9999: ;
 		//Allocate the Design Day and Environment array to the # of DD's or/and
 		// Annual runs on input file
 		DesignDay.allocate( TotDesDays );
+		DesignDayWeather.allocate( TotDesDays );
 		Environment.allocate( NumOfEnvrn );
 
 		// Set all Environments to False and then the weather environment will be set
@@ -5094,6 +5224,8 @@ Label9999: ;
 		// which will have to be completed to run the annual run.
 		if ( TotRunPers >= 1 || FullAnnualRun ) {
 			GetRunPeriodData( TotRunPers, ErrorsFound );
+			if ( NumRunPeriodSegments > 0 ) SetRunPeriodSegment( ErrorsFound );
+			if ( ! DataStringGlobals::inputCheckpointFileName.empty() ) StartRunPeriodAtCheckpoint( ErrorsFound );
 		}
 
 		if ( RPD1 >= 1 || RPD2 >= 1 || TotRunPers >= 1 || FullAnnualRun ) {
@@ -5561,6 +5693,194 @@ Label9999: ;
 
 	}
 
+	void
+	SetRunPeriodSegment( bool & ErrorsFound )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine cuts each weather file run period down to the segment selected with
+		// --segment K/N, so that the segments of a long run period can be simulated by separate
+		// processes at the same time and their outputs put back together afterwards.
+
+		// METHODOLOGY EMPLOYED:
+		// The days of the run period are split into NumRunPeriodSegments segments.  When the run
+		// period spans at least as many months as there are segments the segments start on the
+		// first of a month, so the monthly values of the segments can be put together; otherwise
+		// the days are split evenly.  A segment on its own would start from the warmup state of
+		// its first day, not from the state the preceding days leave in the building mass and
+		// the ground; so the simulation starts RunPeriodSegmentOverlap days ahead of the segment
+		// (never before the run period).  The days simulated are written to the eio file so the
+		// overlap days can be dropped, and compared with the previous segment, when merging.
+
+		// Using/Aliasing
+		using General::InvJulianDay;
+		using General::JulianDay;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt SegmentHeaderFormat( "('! <Run Period Segment>, Run Period Name, Segment, Number of Segments, Start Date, End Date, Overlap Days, First Day of Segment, Last Day of Segment')" );
+		static gio::Fmt SegmentFormat( "('Run Period Segment',8(',',A))" );
+		static gio::Fmt DateFormat( "(I2.2,'/',I2.2)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const YearDays( JulianDay( 12, 31, LeapYearAdd ) );
+		int StartJDay; // Julian day of the first day of the run period
+		int TotalDays; // Days in the run period
+		int FirstDay; // First day of the segment, counted from 0 at the start of the run period
+		int LastDay; // Last day of the segment, counted from 0 at the start of the run period
+		int OverlapDays; // Days simulated ahead of the segment
+		int Month;
+		int DayOfMonth;
+		std::string StDate;
+		std::string EnDate;
+
+		gio::write( OutputFileInits, SegmentHeaderFormat );
+		for ( int Loop = 1; Loop <= TotRunPers; ++Loop ) {
+			auto & runPeriod( RunPeriodInput( Loop ) );
+			if ( runPeriod.ActualWeather || runPeriod.NumSimYears > 1 ) {
+				ShowSevereError( "SetRunPeriodSegment: Run period \"" + runPeriod.Title + "\" cannot be split into segments with --segment." );
+				ShowContinueError( "Only RunPeriod objects simulating a single year can be split; RunPeriod:CustomRange and repeated run periods cannot." );
+				ErrorsFound = true;
+				continue;
+			}
+
+			StartJDay = JulianDay( runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd );
+			int const EndJDay( JulianDay( runPeriod.EndMonth, runPeriod.EndDay, LeapYearAdd ) );
+			if ( StartJDay <= EndJDay ) {
+				TotalDays = EndJDay - StartJDay + 1;
+			} else {
+				TotalDays = YearDays - StartJDay + 1 + EndJDay;
+			}
+			if ( NumRunPeriodSegments > TotalDays ) {
+				ShowSevereError( "SetRunPeriodSegment: Run period \"" + runPeriod.Title + "\" has " + RoundSigDigits( TotalDays ) + " days and cannot be split into " + RoundSigDigits( NumRunPeriodSegments ) + " segments." );
+				ErrorsFound = true;
+				continue;
+			}
+
+			// Days (from the start of the run period) on which a month begins; the run period start counts as one
+			std::vector< int > MonthStarts( 1, 0 );
+			for ( int Day = 1; Day < TotalDays; ++Day ) {
+				InvJulianDay( ( StartJDay - 1 + Day ) % YearDays + 1, Month, DayOfMonth, LeapYearAdd );
+				if ( DayOfMonth == 1 ) MonthStarts.push_back( Day );
+			}
+			int const NumMonths( MonthStarts.size() );
+			if ( NumMonths >= NumRunPeriodSegments ) {
+				FirstDay = MonthStarts[ ( RunPeriodSegment - 1 ) * NumMonths / NumRunPeriodSegments ];
+				if ( RunPeriodSegment < NumRunPeriodSegments ) {
+					LastDay = MonthStarts[ RunPeriodSegment * NumMonths / NumRunPeriodSegments ] - 1;
+				} else {
+					LastDay = TotalDays - 1;
+				}
+			} else {
+				FirstDay = ( RunPeriodSegment - 1 ) * TotalDays / NumRunPeriodSegments;
+				LastDay = RunPeriodSegment * TotalDays / NumRunPeriodSegments - 1;
+			}
+			OverlapDays = min( RunPeriodSegmentOverlap, FirstDay );
+
+			InvJulianDay( ( StartJDay - 1 + LastDay ) % YearDays + 1, runPeriod.EndMonth, runPeriod.EndDay, LeapYearAdd );
+			DelayRunPeriodStart( runPeriod, FirstDay - OverlapDays, ErrorsFound );
+
+			gio::write( StDate, DateFormat ) << runPeriod.StartMonth << runPeriod.StartDay;
+			gio::write( EnDate, DateFormat ) << runPeriod.EndMonth << runPeriod.EndDay;
+			gio::write( OutputFileInits, SegmentFormat ) << runPeriod.Title << RoundSigDigits( RunPeriodSegment ) << RoundSigDigits( NumRunPeriodSegments ) << StDate << EnDate << RoundSigDigits( OverlapDays ) << RoundSigDigits( FirstDay + 1 ) << RoundSigDigits( LastDay + 1 );
+			ShowMessage( "Run period \"" + runPeriod.Title + "\" segment " + RoundSigDigits( RunPeriodSegment ) + " of " + RoundSigDigits( NumRunPeriodSegments ) + ": simulating " + StDate + " through " + EnDate + " including " + RoundSigDigits( OverlapDays ) + " overlap days" );
+		}
+
+	}
+
+	void
+	StartRunPeriodAtCheckpoint( bool & ErrorsFound )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine starts the run period of the checkpoint given with --resume-from on the
+		// day after the checkpoint; the state of the days before it is restored from the
+		// checkpoint (see SimulationCheckpoint) once the first warmup day is done.
+
+		// Using/Aliasing
+		using General::JulianDay;
+		using SimulationCheckpoint::ReadCheckpointHeader;
+		using SimulationCheckpoint::ResumeDayOfSim;
+		using SimulationCheckpoint::ResumeRunPeriod;
+
+		ReadCheckpointHeader();
+		if ( ResumeRunPeriod < 1 || ResumeRunPeriod > TotRunPers ) {
+			ShowSevereError( "StartRunPeriodAtCheckpoint: The checkpoint given with --resume-from was written in run period " + RoundSigDigits( ResumeRunPeriod ) + ", but there are " + RoundSigDigits( TotRunPers ) + " weather file run periods." );
+			ErrorsFound = true;
+			return;
+		}
+
+		auto & runPeriod( RunPeriodInput( ResumeRunPeriod ) );
+		int const StartJDay( JulianDay( runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd ) );
+		int const EndJDay( JulianDay( runPeriod.EndMonth, runPeriod.EndDay, LeapYearAdd ) );
+		int TotalDays;
+		if ( StartJDay <= EndJDay ) {
+			TotalDays = EndJDay - StartJDay + 1;
+		} else {
+			TotalDays = JulianDay( 12, 31, LeapYearAdd ) - StartJDay + 1 + EndJDay;
+		}
+		if ( runPeriod.ActualWeather || runPeriod.NumSimYears > 1 ) {
+			ShowSevereError( "StartRunPeriodAtCheckpoint: Run period \"" + runPeriod.Title + "\" cannot be resumed from a checkpoint." );
+			ShowContinueError( "Only RunPeriod objects simulating a single year can be resumed; RunPeriod:CustomRange and repeated run periods cannot." );
+			ErrorsFound = true;
+		} else if ( ResumeDayOfSim >= TotalDays ) {
+			ShowSevereError( "StartRunPeriodAtCheckpoint: The checkpoint given with --resume-from was written at the end of day " + RoundSigDigits( ResumeDayOfSim ) + " of run period \"" + runPeriod.Title + "\", which has " + RoundSigDigits( TotalDays ) + " days; there is nothing left to simulate." );
+			ErrorsFound = true;
+		} else {
+			DelayRunPeriodStart( runPeriod, ResumeDayOfSim, ErrorsFound );
+		}
+
+	}
+
+	void
+	DelayRunPeriodStart(
+		RunPeriodData & runPeriod, // Run period (simulating a single year) to change
+		int const Days, // Days the start is moved later
+		bool const ErrorsFound
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine moves the start of a run period later by a number of days, keeping the
+		// days of the week of the whole run period, and recalculates the dates depending on it.
+
+		// Using/Aliasing
+		using General::InvJulianDay;
+		using General::JulianDay;
+
+		int const YearDays( JulianDay( 12, 31, LeapYearAdd ) );
+		int const StartJDay( JulianDay( runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd ) );
+
+		InvJulianDay( ( StartJDay - 1 + Days ) % YearDays + 1, runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd );
+		if ( runPeriod.DayOfWeek != 0 ) {
+			runPeriod.DayOfWeek = mod( runPeriod.DayOfWeek - 1 + Days, 7 ) + 1;
+		}
+		runPeriod.StartDate = JulianDay( runPeriod.StartMonth, runPeriod.StartDay, LeapYearAdd );
+		runPeriod.EndDate = JulianDay( runPeriod.EndMonth, runPeriod.EndDay, LeapYearAdd );
+		runPeriod.MonWeekDay = 0;
+		if ( runPeriod.DayOfWeek != 0 && ! ErrorsFound ) {
+			SetupWeekDaysByMonth( runPeriod.StartMonth, runPeriod.StartDay, runPeriod.DayOfWeek, runPeriod.MonWeekDay );
+		}
+
+	}
+
 	void
 	GetRunPeriodDesignData( bool & ErrorsFound )
 	{
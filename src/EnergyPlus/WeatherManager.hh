@@ -1,8 +1,13 @@
 #ifndef WeatherManager_hh_INCLUDED
 #define WeatherManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
@@ -643,6 +648,32 @@ namespace WeatherManager {
 
 	};
 
+	struct DesignDayWeatherData // Weather arrays of a design day, kept for its later environments
+	{
+		// Members
+		bool Generated; // True once SetUpDesignDay has stored the arrays of the design day
+		Array2D_bool IsRain; // Rain indicator, true=rain
+		Array2D_bool IsSnow; // Snow indicator, true=snow
+		Array2D< Real64 > OutDryBulbTemp; // Dry bulb temperature of outside air
+		Array2D< Real64 > OutDewPointTemp; // Dew Point Temperature of outside air
+		Array2D< Real64 > OutBaroPress; // Barometric pressure of outside air
+		Array2D< Real64 > OutRelHum; // Relative Humidity of outside air
+		Array2D< Real64 > WindSpeed; // Wind speed of outside air
+		Array2D< Real64 > WindDir; // Wind direction of outside air
+		Array2D< Real64 > SkyTemp; // Sky temperature
+		Array2D< Real64 > HorizIRSky; // Horizontal IR from Sky
+		Array2D< Real64 > BeamSolarRad; // Direct normal solar irradiance
+		Array2D< Real64 > DifSolarRad; // Sky diffuse horizontal solar irradiance
+		Array2D< Real64 > Albedo; // Albedo
+		Array2D< Real64 > LiquidPrecip; // Liquid Precipitation Depth
+
+		// Default Constructor
+		DesignDayWeatherData() :
+			Generated( false )
+		{}
+
+	};
+
 	struct SpecialDayData
 	{
 		// Members
@@ -1150,10 +1181,39 @@ namespace WeatherManager {
 
 	};
 
+	struct InterpretedWeatherLine // Results of InterpretWeatherDataLine for one EPW data line
+	{
+		// Members
+		int WYear;
+		int WMonth;
+		int WDay;
+		int WHour;
+		int WMinute;
+		Array1D< Real64 > RField; // RField1 to RField27 of InterpretWeatherDataLine (21 is the observation indicator)
+		int WObs; // PresWeathObs
+		Array1D_int WCodesArr; // PresWeathConds
+		bool MissedWeathCodes; // True if the weather codes on the line were invalid
+
+		// Default Constructor
+		InterpretedWeatherLine() :
+			WYear( 0 ),
+			WMonth( 0 ),
+			WDay( 0 ),
+			WHour( 0 ),
+			WMinute( 0 ),
+			RField( 27, 0.0 ),
+			WObs( 0 ),
+			WCodesArr( 9, 9 ),
+			MissedWeathCodes( false )
+		{}
+
+	};
+
 	// Object Data
 	extern DayWeatherVariables TodayVariables; // Today's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
 	extern DayWeatherVariables TomorrowVariables; // Tomorrow's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of week for weather data | Daylight Saving Time Period indicator (0=no,1=yes) | Holiday indicator (0=no holiday, non-zero=holiday type) | Sine of the solar declination angle | Cosine of the solar declination angle | Value of the equation of time formula
 	extern Array1D< DayWeatherVariables > DesignDay; // Design day environments
+	extern Array1D< DesignDayWeatherData > DesignDayWeather; // Generated weather arrays of the design days
 	extern MissingData Missing; // Dry Bulb Temperature (C) | Dew Point Temperature (C) | Relative Humidity (%) | Atmospheric Pressure (Pa) | Wind Direction (deg) | Wind Speed/Velocity (m/s) | Total Sky Cover (tenths) | Opaque Sky Cover (tenths) | Visibility (km) | Ceiling Height (m) | Precipitable Water (mm) | Aerosol Optical Depth | Snow Depth (cm) | Number of Days since last snow | Albedo | Rain/Liquid Precipitation (mm)
 	extern MissingDataCounts Missed;
 	extern RangeDataCounts OutOfRange;
@@ -1168,6 +1228,7 @@ namespace WeatherManager {
 	extern Array1D< WeatherProperties > WPSkyTemperature;
 	extern Array1D< SpecialDayData > SpecialDays;
 	extern Array1D< DataPeriodData > DataPeriods;
+	extern std::unordered_map< std::string, InterpretedWeatherLine > InterpretedWeatherLines; // Weather lines interpreted so far, by line text
 
 	// Functions
 
@@ -1374,6 +1435,19 @@ namespace WeatherManager {
 		bool & ErrorsFound
 	);
 
+	void
+	SetRunPeriodSegment( bool & ErrorsFound );
+
+	void
+	StartRunPeriodAtCheckpoint( bool & ErrorsFound );
+
+	void
+	DelayRunPeriodStart(
+		RunPeriodData & runPeriod, // Run period (simulating a single year) to change
+		int const Days, // Days the start is moved later
+		bool const ErrorsFound
+	);
+
 	void
 	GetRunPeriodDesignData( bool & ErrorsFound );
 
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -25,6 +26,7 @@
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <Psychrometrics.hh>
+#include <SurfaceRayTree.hh>
 #include <TARCOGGassesParams.hh>
 #include <TARCOGMain.hh>
 #include <TARCOGParams.hh>
@@ -78,6 +80,7 @@ namespace WindowComplexManager {
 	using namespace DataHeatBalance;
 	using namespace DataShadowingCombinations;
 	using namespace Vectors;
+	using SurfaceRayTree::SurfacesAlongRay;
 	using namespace DataHeatBalFanSys;
 
 	// Data
@@ -98,6 +101,8 @@ namespace WindowComplexManager {
 	int const Back_Transmitted( 5 );
 	int const Back_Reflected( 6 );
 
+	Real64 const ThermalCacheTolerance( 1.0e-5 ); // Relative change in a boundary condition that forces a new TARCOG solution
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -117,6 +122,7 @@ namespace WindowComplexManager {
 	Array1D< BasisStruct > BasisList;
 	Array1D< WindowIndex > WindowList;
 	Array2D< WindowStateIndex > WindowStateList;
+	Array1D< ComplexWindowThermalCache > ThermalCache; // Last TARCOG solution of each window surface
 
 	// Functions
 
@@ -768,7 +774,6 @@ namespace WindowComplexManager {
 		Real64 Theta; // Theta angle of incident ray correspongind to beam direction
 		Real64 Phi; // Phi angle of incident ray correspongind to beam direction
 		static int IHit( 0 ); // hit flag
-		int JSurf; // general purpose surface number
 		int Hour; // hour of day
 		int TotHits; // hit counter
 		int TS; // time step
@@ -805,7 +810,9 @@ namespace WindowComplexManager {
 					for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) { //Gnd pt loop
 						IHit = 0;
 						TotHits = 0;
-						for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+						static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+						SurfacesAlongRay( ComplexWind( iSurf ).Geom( iState ).GndPt( I ), SunDir, RaySurfNums );
+						for ( int const JSurf : RaySurfNums ) {
 							// the following test will cycle on anything except exterior surfaces and shading surfaces
 							if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
 							//  skip surfaces that face away from the ground point
@@ -855,7 +862,9 @@ namespace WindowComplexManager {
 			for ( I = 1; I <= ComplexWind( iSurf ).Geom( iState ).NGnd; ++I ) { //Gnd pt loop
 				IHit = 0;
 				TotHits = 0;
-				for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+				static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+				SurfacesAlongRay( ComplexWind( iSurf ).Geom( iState ).GndPt( I ), SunDir, RaySurfNums );
+				for ( int const JSurf : RaySurfNums ) {
 					// the following test will cycle on anything except exterior surfaces and shading surfaces
 					if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
 					//  skip surfaces that face away from the ground point
@@ -938,7 +947,6 @@ namespace WindowComplexManager {
 		Real64 Phi;
 		int JSurf; // gen purpose surface no
 		int BaseSurf; // base surface no
-		int M; // general purpose index--ray
 		int L; // general purpose index--layer
 		int KBkSurf; // general purpose index--back surface
 		Real64 Sum1; // general purpose sum
@@ -975,11 +983,7 @@ namespace WindowComplexManager {
 				State.WinToSurfBmTrans( TS, Hour, I ) = Sum1;
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, J );
-			}
-			State.WinDirHemiTrans( TS, Hour ) = Sum1;
+			State.WinDirHemiTrans( TS, Hour ) = State.FtDirHemiTrans( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( TS, Hour ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -997,9 +1001,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( TS, Hour, J ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( TS, Hour, J ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( TS, Hour, J ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( JRay, M );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( TS, Hour, J ) * Geom.Inc.Lamda( JRay ) * State.FtDirHemiTrans( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1051,11 +1053,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( BkIncRay, J );
-				}
-				Refl = Sum1;
+				Refl = State.BkDirHemiRefl( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( BkIncRay, 1 );
 				}
@@ -1715,7 +1713,9 @@ namespace WindowComplexManager {
 			// Exterior reveal shadowing/reflection treatment should be inserted here
 			IHit = 0;
 			TotHits = 0;
-			for ( JSurf = 1; JSurf <= TotSurfaces; ++JSurf ) {
+			static std::vector< int > RaySurfNums; // Surfaces the ray may hit
+			SurfacesAlongRay( Surface( ISurf ).Centroid, Geom.sInc( IRay ), RaySurfNums );
+			for ( int const JSurf : RaySurfNums ) {
 				// the following test will cycle on anything except exterior surfaces and shading surfaces
 				if ( Surface( JSurf ).HeatTransSurf && Surface( JSurf ).ExtBoundCond != ExternalEnvironment ) continue;
 				//  skip the base surface containing the window and any other subsurfaces of that surface
@@ -2357,6 +2357,31 @@ namespace WindowComplexManager {
 			State.IntegratedBkTrans( J ) = 1 - State.IntegratedBkRefl( J ) - State.IntegratedBkAbs( J );
 		} //Outgoing ray loop
 
+		// ********************************************************************************
+		// Directional-hemispherical properties used by CalculateWindowBeamProperties
+		// ********************************************************************************
+
+		// Front transmittance weighted by the outgoing solid angles, for each incident direction
+		// (matrix-vector product of SolFrtTrans with Trn%Lamda; each row is contiguous in memory)
+		if ( ! allocated( State.FtDirHemiTrans ) ) State.FtDirHemiTrans.allocate( Geom.Inc.NBasis );
+		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
+			Sum1 = 0.0;
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
+				Sum1 += Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M );
+			} // Outgoing ray loop
+			State.FtDirHemiTrans( J ) = Sum1;
+		} // Incident ray loop
+
+		// Back reflectance weighted by the outgoing solid angles, for each back incident direction
+		if ( ! allocated( State.BkDirHemiRefl ) ) State.BkDirHemiRefl.allocate( Geom.Trn.NBasis );
+		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Back incident ray loop
+			Sum1 = 0.0;
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
+				Sum1 += Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( J, M );
+			} // Outgoing ray loop
+			State.BkDirHemiRefl( J ) = Sum1;
+		} // Back incident ray loop
+
 	}
 
 	Real64
@@ -2929,6 +2954,7 @@ namespace WindowComplexManager {
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   October 2009
 		//       MODIFIED       Simon Vidanovic
+		//                      Oct 2026, reuse the last solution when the boundary conditions have not changed
 		//       RE-ENGINEERED  September 2011
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2937,6 +2963,9 @@ namespace WindowComplexManager {
 		// METHODOLOGY EMPLOYED:
 		// draft out an attempt for proof-of-concept, to reuse native TARCOG implementation
 		// based off of 1-26-2009 version of WinCOG/TARCOG solution from Carli, Inc.
+		// The solution for each window surface is kept, and TARCOG is skipped while the construction, shading and
+		// all boundary conditions stay within ThermalCacheTolerance of those of the kept solution, as happens
+		// in the later iterations of the surface heat balance.
 
 		// REFERENCES:
 		// na
@@ -3252,6 +3281,9 @@ namespace WindowComplexManager {
 		Real64 outir;
 		Real64 Ebout;
 		Real64 dominantGapWidth; // store value for dominant gap width.  Used for airflow calculations
+		static Array1D< Real64 > Conditions( 12 + maxlay, 0.0 ); // Boundary conditions that determine the TARCOG solution
+		int NumConditions; // Number of boundary conditions
+		bool ReuseSolution; // The kept solution for the surface still holds
 
 		// fill local vars
 
@@ -3655,8 +3687,75 @@ namespace WindowComplexManager {
 			theta = 273.15;
 		}
 
-		//  call TARCOG
-		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+		// Collect the boundary conditions before TARCOG, which may change some of them
+		ReuseSolution = false;
+		if ( CalcCondition == noCondition ) {
+			if ( ! allocated( ThermalCache ) ) ThermalCache.allocate( TotSurfaces );
+			Conditions( 1 ) = tout;
+			Conditions( 2 ) = tind;
+			Conditions( 3 ) = trmin;
+			Conditions( 4 ) = wso;
+			Conditions( 5 ) = dir;
+			Conditions( 6 ) = outir;
+			Conditions( 7 ) = tsky;
+			Conditions( 8 ) = hin;
+			Conditions( 9 ) = hout;
+			Conditions( 10 ) = fclr;
+			Conditions( 11 ) = Pa;
+			Conditions( 12 ) = SurfaceWindow( SurfNum ).AirflowThisTS;
+			for ( k = 1; k <= nlayer; ++k ) {
+				Conditions( 12 + k ) = asol( k );
+			}
+			NumConditions = 12 + nlayer;
+
+			ComplexWindowThermalCache const & Cache( ThermalCache( SurfNum ) );
+			if ( Cache.Valid && ( Cache.ConstrNum == ConstrNum ) && ( Cache.ShadeFlag == ShadeFlag ) && ( int( Cache.Conditions.size() ) == NumConditions ) ) {
+				ReuseSolution = true;
+				for ( k = 1; k <= NumConditions; ++k ) {
+					if ( std::abs( Conditions( k ) - Cache.Conditions( k ) ) > ThermalCacheTolerance * max( std::abs( Cache.Conditions( k ) ), 1.0 ) ) {
+						ReuseSolution = false;
+						break;
+					}
+				}
+			}
+		}
+
+		if ( ReuseSolution ) {
+			ComplexWindowThermalCache const & Cache( ThermalCache( SurfNum ) );
+			for ( k = 1; k <= 2 * nlayer; ++k ) {
+				theta( k ) = Cache.Theta( k );
+			}
+			for ( k = 1; k <= nlayer + 1; ++k ) {
+				qv( k ) = Cache.Qv( k );
+			}
+			hcin = Cache.Hcin;
+			NumOfIterations = Cache.NumOfIterations;
+			nperr = 0;
+		} else {
+			//  call TARCOG
+			TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+
+			if ( ( CalcCondition == noCondition ) && ( nperr == 0 ) ) {
+				ComplexWindowThermalCache & Cache( ThermalCache( SurfNum ) );
+				Cache.Valid = true;
+				Cache.ConstrNum = ConstrNum;
+				Cache.ShadeFlag = ShadeFlag;
+				Cache.Conditions.dimension( NumConditions );
+				for ( k = 1; k <= NumConditions; ++k ) {
+					Cache.Conditions( k ) = Conditions( k );
+				}
+				Cache.Theta.dimension( 2 * nlayer );
+				for ( k = 1; k <= 2 * nlayer; ++k ) {
+					Cache.Theta( k ) = theta( k );
+				}
+				Cache.Qv.dimension( nlayer + 1 );
+				for ( k = 1; k <= nlayer + 1; ++k ) {
+					Cache.Qv( k ) = qv( k );
+				}
+				Cache.Hcin = hcin;
+				Cache.NumOfIterations = NumOfIterations;
+			}
+		}
 
 		// process results from TARCOG
 		if ( ( nperr > 0 ) && ( nperr < 1000 ) ) { // process error signal from tarcog
@@ -43,6 +43,8 @@ namespace WindowComplexManager {
 	extern int const Back_Transmitted;
 	extern int const Back_Reflected;
 
+	extern Real64 const ThermalCacheTolerance; // Relative change in a boundary condition that forces a new TARCOG solution
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -121,10 +123,34 @@ namespace WindowComplexManager {
 
 	};
 
+	struct ComplexWindowThermalCache
+	{
+		// Members
+		bool Valid; // A solution has been stored
+		int ConstrNum; // Construction of the stored solution
+		int ShadeFlag; // Shading flag of the stored solution
+		Array1D< Real64 > Conditions; // Boundary conditions of the stored solution
+		Array1D< Real64 > Theta; // Surface temperatures of the stored solution [K]
+		Array1D< Real64 > Qv; // Heat fluxes to each gap by ventilation of the stored solution [W/m2]
+		Real64 Hcin; // Indoor convective surface heat transfer coefficient of the stored solution [W/m2 K]
+		int NumOfIterations; // TARCOG iterations taken by the stored solution
+
+		// Default Constructor
+		ComplexWindowThermalCache() :
+			Valid( false ),
+			ConstrNum( 0 ),
+			ShadeFlag( 0 ),
+			Hcin( 0.0 ),
+			NumOfIterations( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< BasisStruct > BasisList;
 	extern Array1D< WindowIndex > WindowList;
 	extern Array2D< WindowStateIndex > WindowStateList;
+	extern Array1D< ComplexWindowThermalCache > ThermalCache; // Last TARCOG solution of each window surface
 
 	// Functions
 
@@ -107,9 +107,16 @@ namespace WindowEquivalentLayer {
 	int const hipTAU_BT0( 2 );
 	int const hipTAU_BB0( 3 );
 	int const hipDIM( 3 ); // dimension of parameter array
+	Real64 const EQLThermalCacheTolerance( 1.0e-5 ); // Relative change in a boundary condition that forces a new ASHWAT solution
 
 	Array3D< Real64 > CFSDiffAbsTrans;
 	Array1D_bool EQLDiffPropFlag;
+	Array3D< Real64 > CFSBeamAbsTrans; // Beam layer absorptances and transmittance at the last beam angles
+	Array2D< Real64 > CFSBeamAngles; // Incidence, vertical and horizontal profile angles of CFSBeamAbsTrans
+	Array1D_bool EQLBeamPropFlag; // CFSBeamAbsTrans holds the beam properties at CFSBeamAngles
+
+	// Object Data
+	Array1D< EQLWindowThermalCache > EQLThermalCache; // Last ASHWAT solution of each window surface
 
 	// MODULE SUBROUTINES:
 	// Initialization routines for module
@@ -166,9 +173,16 @@ namespace WindowEquivalentLayer {
 		if ( ! allocated( CFS ) ) CFS.allocate( TotWinEquivLayerConstructs );
 		if ( ! allocated( EQLDiffPropFlag ) ) EQLDiffPropFlag.allocate( TotWinEquivLayerConstructs );
 		if ( ! allocated( CFSDiffAbsTrans ) ) CFSDiffAbsTrans.allocate( 2, CFSMAXNL + 1, TotWinEquivLayerConstructs );
+		if ( ! allocated( EQLBeamPropFlag ) ) EQLBeamPropFlag.allocate( TotWinEquivLayerConstructs );
+		if ( ! allocated( CFSBeamAbsTrans ) ) CFSBeamAbsTrans.allocate( 2, CFSMAXNL + 1, TotWinEquivLayerConstructs );
+		if ( ! allocated( CFSBeamAngles ) ) CFSBeamAngles.allocate( 3, TotWinEquivLayerConstructs );
+		if ( ! allocated( EQLThermalCache ) ) EQLThermalCache.allocate( TotSurfaces );
 
 		EQLDiffPropFlag = true;
 		CFSDiffAbsTrans = 0.0;
+		EQLBeamPropFlag = false;
+		CFSBeamAbsTrans = 0.0;
+		CFSBeamAngles = 0.0;
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
 			if ( ! Construct( ConstrNum ).TypeIsWindow ) continue;
@@ -663,7 +677,7 @@ namespace WindowEquivalentLayer {
 		// Flow
 
 		// Object Data
-		Array1D< CFSSWP > SWP_ON( CFSMAXNL );
+		static Array1D< CFSSWP > SWP_ON( CFSMAXNL );
 
 		NL = FS.NL;
 		Abs1 = 0.0;
@@ -705,7 +719,7 @@ namespace WindowEquivalentLayer {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   May 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse the last solution when the boundary conditions have not changed
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -714,6 +728,9 @@ namespace WindowEquivalentLayer {
 
 		// METHODOLOGY EMPLOYED:
 		// uses the solar-thermal routine developed for ASHRAE RP-1311 (ASHWAT Model).
+		// The solution for each window surface is kept, and ASHWAT_Thermal is skipped while the construction,
+		// slat angles and boundary conditions stay within EQLThermalCacheTolerance of those of the kept solution,
+		// as happens in the later iterations of the surface heat balance.
 		// REFERENCES:
 		// na
 		// Using/Aliasing
@@ -790,6 +807,10 @@ namespace WindowEquivalentLayer {
 		Real64 NetIRHeatGainWindow; // net radiation gain from the window surface to the zone (W)
 		Real64 ConvHeatGainWindow; // net convection heat gain from inside surface of window to zone air (W)
 		int InSideLayerType; // interior shade type
+		static Array1D< Real64 > Conditions( 6 + 2 * CFSMAXNL + 1, 0.0 ); // Boundary conditions that determine the ASHWAT solution
+		int NumConditions; // Number of boundary conditions
+		bool ReuseSolution; // The kept solution for the surface still holds
+		int Lay; // window layer index
 		// Flow
 
 		if ( CalcCondition != noCondition ) return;
@@ -911,7 +932,54 @@ namespace WindowEquivalentLayer {
 		QAllSWwinAbs( {1,NL + 1} ) = QRadSWwinAbs( {1,NL + 1}, SurfNum );
 		//  Solve energy balance(s) for temperature at each node/layer and
 		//  heat flux, including components, between each pair of nodes/layers
-		ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC );
+		Conditions( 1 ) = TIN;
+		Conditions( 2 ) = Tout;
+		Conditions( 3 ) = HcIn;
+		Conditions( 4 ) = HcOut;
+		Conditions( 5 ) = TRMOUT;
+		Conditions( 6 ) = TRMIN;
+		for ( Lay = 1; Lay <= NL + 1; ++Lay ) {
+			Conditions( 6 + Lay ) = QAllSWwinAbs( Lay );
+		}
+		for ( Lay = 1; Lay <= NL; ++Lay ) { // slat angles set by shade control
+			Conditions( 7 + NL + Lay ) = CFS( EQLNum ).L( Lay ).PHI_DEG;
+		}
+		NumConditions = 7 + 2 * NL;
+
+		ReuseSolution = false;
+		EQLWindowThermalCache & Cache( EQLThermalCache( SurfNum ) );
+		if ( Cache.Valid && ( Cache.EQLNum == EQLNum ) && ( int( Cache.Conditions.size() ) == NumConditions ) ) {
+			ReuseSolution = true;
+			for ( Lay = 1; Lay <= NumConditions; ++Lay ) {
+				if ( std::abs( Conditions( Lay ) - Cache.Conditions( Lay ) ) > EQLThermalCacheTolerance * max( std::abs( Cache.Conditions( Lay ) ), 1.0 ) ) {
+					ReuseSolution = false;
+					break;
+				}
+			}
+		}
+
+		if ( ReuseSolution ) {
+			QOCFRoom = Cache.QOCFRoom;
+			T( 1 ) = Cache.TOut;
+			T( NL ) = Cache.TIn;
+			H( NL ) = Cache.HIn;
+			JB( NL ) = Cache.JBIn;
+			JF( NL + 1 ) = Cache.JFRoom;
+		} else {
+			ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC );
+			Cache.Valid = true;
+			Cache.EQLNum = EQLNum;
+			Cache.Conditions.dimension( NumConditions );
+			for ( Lay = 1; Lay <= NumConditions; ++Lay ) {
+				Cache.Conditions( Lay ) = Conditions( Lay );
+			}
+			Cache.QOCFRoom = QOCFRoom;
+			Cache.TOut = T( 1 );
+			Cache.TIn = T( NL );
+			Cache.HIn = H( NL );
+			Cache.JBIn = JB( NL );
+			Cache.JFRoom = JF( NL + 1 );
+		}
 		// long wave radiant power to room not including reflected
 		QRLWX = JB( NL ) - ( 1.0 - LWAbsIn ) * JF( NL + 1 );
 		// nominal surface temp = effective radiant temperature
@@ -9149,7 +9217,7 @@ namespace WindowEquivalentLayer {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   May 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, reuse the beam properties of the last identical beam angles
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -9160,6 +9228,8 @@ namespace WindowEquivalentLayer {
 		// METHODOLOGY EMPLOYED:
 		// Uses the net radiation method developed for ASHWAT fenestration
 		// model (ASHRAE RP-1311) by John Wright, the University of WaterLoo
+		// The beam properties of each construction are kept with the angles they were
+		// calculated for, and reused by surfaces (or repeated calls) with the same angles.
 
 		// REFERENCES:
 		// na
@@ -9214,9 +9284,18 @@ namespace WindowEquivalentLayer {
 			}
 			// Incident angle
 			IncAng = std::acos( CosIncAng( TimeStep, HourOfDay, SurfNum ) );
-			CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
-			CFSAbs( 1, {1,CFSMAXNL + 1} ) = Abs1( 1, {1,CFSMAXNL + 1} );
-			CFSAbs( 2, {1,CFSMAXNL + 1} ) = Abs1( 2, {1,CFSMAXNL + 1} );
+			if ( EQLBeamPropFlag( EQLNum ) && IncAng == CFSBeamAngles( 1, EQLNum ) && ProfAngVer == CFSBeamAngles( 2, EQLNum ) && ProfAngHor == CFSBeamAngles( 3, EQLNum ) ) {
+				CFSAbs( _, {1,CFSMAXNL + 1} ) = CFSBeamAbsTrans( _, {1,CFSMAXNL + 1}, EQLNum );
+			} else {
+				CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
+				CFSAbs( 1, {1,CFSMAXNL + 1} ) = Abs1( 1, {1,CFSMAXNL + 1} );
+				CFSAbs( 2, {1,CFSMAXNL + 1} ) = Abs1( 2, {1,CFSMAXNL + 1} );
+				CFSBeamAbsTrans( _, {1,CFSMAXNL + 1}, EQLNum ) = Abs1( _, {1,CFSMAXNL + 1} );
+				CFSBeamAngles( 1, EQLNum ) = IncAng;
+				CFSBeamAngles( 2, EQLNum ) = ProfAngVer;
+				CFSBeamAngles( 3, EQLNum ) = ProfAngHor;
+				EQLBeamPropFlag( EQLNum ) = true;
+			}
 		} else {
 			if ( EQLDiffPropFlag( EQLNum ) ) {
 				for ( Lay = 1; Lay <= CFS( EQLNum ).NL; ++Lay ) {
@@ -9237,6 +9316,8 @@ namespace WindowEquivalentLayer {
 				Construct( ConstrNum ).ReflectSolDiffFront = CFS( EQLNum ).L( 1 ).SWP_EL.RHOSFDD;
 				Construct( ConstrNum ).ReflectSolDiffBack = CFS( EQLNum ).L( CFS( EQLNum ).NL ).SWP_EL.RHOSBDD;
 				if ( ! CFS( EQLNum ).ISControlled ) EQLDiffPropFlag( EQLNum ) = false;
+				// shade control has set the slats for diffuse, so the next beam call must set them again
+				if ( CFS( EQLNum ).ISControlled ) EQLBeamPropFlag( EQLNum ) = false;
 			} else {
 				CFSAbs( _, {1,CFSMAXNL + 1} ) = CFSDiffAbsTrans( _, {1,CFSMAXNL + 1}, EQLNum );
 				Construct( ConstrNum ).TransDiff = CFSDiffAbsTrans( 1, CFS( EQLNum ).NL + 1, EQLNum );
@@ -8,6 +8,7 @@
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array2S.hh>
 #include <ObjexxFCL/Array3D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -42,9 +43,45 @@ namespace WindowEquivalentLayer {
 	extern int const hipTAU_BT0;
 	extern int const hipTAU_BB0;
 	extern int const hipDIM; // dimension of parameter array
+	extern Real64 const EQLThermalCacheTolerance; // Relative change in a boundary condition that forces a new ASHWAT solution
 
 	extern Array3D< Real64 > CFSDiffAbsTrans;
 	extern Array1D_bool EQLDiffPropFlag;
+	extern Array3D< Real64 > CFSBeamAbsTrans; // Beam layer absorptances and transmittance at the last beam angles
+	extern Array2D< Real64 > CFSBeamAngles; // Incidence, vertical and horizontal profile angles of CFSBeamAbsTrans
+	extern Array1D_bool EQLBeamPropFlag; // CFSBeamAbsTrans holds the beam properties at CFSBeamAngles
+
+	// Types
+
+	struct EQLWindowThermalCache
+	{
+		// Members
+		bool Valid; // A solution has been stored
+		int EQLNum; // Equivalent layer construction of the stored solution
+		Array1D< Real64 > Conditions; // Boundary conditions of the stored solution
+		Real64 QOCFRoom; // Open channel flow heat gain to the room of the stored solution [W/m2]
+		Real64 TOut; // Outside layer temperature of the stored solution [K]
+		Real64 TIn; // Inside layer temperature of the stored solution [K]
+		Real64 HIn; // Inside face heat transfer coefficient of the stored solution [W/m2 K]
+		Real64 JBIn; // Inside layer back face radiosity of the stored solution [W/m2]
+		Real64 JFRoom; // Room radiosity of the stored solution [W/m2]
+
+		// Default Constructor
+		EQLWindowThermalCache() :
+			Valid( false ),
+			EQLNum( 0 ),
+			QOCFRoom( 0.0 ),
+			TOut( 0.0 ),
+			TIn( 0.0 ),
+			HIn( 0.0 ),
+			JBIn( 0.0 ),
+			JFRoom( 0.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern Array1D< EQLWindowThermalCache > EQLThermalCache; // Last ASHWAT solution of each window surface
 
 	// MODULE SUBROUTINES:
 	// Initialization routines for module
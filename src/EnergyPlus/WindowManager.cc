@@ -2614,7 +2614,7 @@ namespace WindowManager {
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		Array1D< Real64 > hgap( 5 ); // Gap gas conductance
+		static EP_THREAD_LOCAL Array1D< Real64 > hgap( 5 ); // Gap gas conductance //Tuned Made static
 		Real64 gr; // Gap gas Grashof number
 		Real64 con; // Gap gas conductivity
 		Real64 pr; // Gap gas Prandtl number
@@ -2753,7 +2753,8 @@ namespace WindowManager {
 		// METHODOLOGY EMPLOYED:
 		// The Aface and Bface coefficients are determined by the equations for
 		// heat balance at the glass and shade/blind faces. The system of linear equations is solved
-		// by LU decomposition.
+		// by LU decomposition, or directly as a tridiagonal system when no exterior or between-glass
+		// shade, blind or screen couples non-adjacent faces.
 
 		// REFERENCES:
 		// na
@@ -2787,20 +2788,20 @@ namespace WindowManager {
 
 		int ZoneNum; // Zone number corresponding to SurfNum
 		int i; // Counter
-		static Array1D< Real64 > hgap( 5 ); // Gap gas conductance (W/m2-K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hgap( 5 ); // Gap gas conductance (W/m2-K) //Tuned Made static
 		Real64 gr; // Grashof number of gas in a gap
 		Real64 con; // Gap gas conductivity
 		Real64 pr; // Gap gas Prandtl number
 		Real64 nu; // Gap gas Nusselt number
-		static Array1D< Real64 > hr( 10 ); // Radiative conductance (W/m2-K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hr( 10 ); // Radiative conductance (W/m2-K) //Tuned Made static
 		Real64 d; // +1 if number of row interchanges is even,
 		// -1 if odd (in LU decomposition)
-		static Array1D_int indx( 10 ); // Vector of row permutations in LU decomposition //Tuned Made static
-		static Array2D< Real64 > Aface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
-		static Array1D< Real64 > Bface( 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+		static EP_THREAD_LOCAL Array1D_int indx( 10 ); // Vector of row permutations in LU decomposition //Tuned Made static
+		static EP_THREAD_LOCAL Array2D< Real64 > Aface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > Bface( 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
 
 		int iter; // Iteration number
-		static Array1D< Real64 > hrprev( 10 ); // Value of hr from previous iteration //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hrprev( 10 ); // Value of hr from previous iteration //Tuned Made static
 		Real64 errtemp; // Absolute value of sum of face temperature differences
 		//   between iterations, divided by number of faces
 		Real64 VGap; // Air velocity in gap between glass and shade/blind (m/s)
@@ -2811,12 +2812,12 @@ namespace WindowManager {
 		Real64 TGapOutlet; // Temperature of air leaving gap between glass and shade/blind (K)
 		Real64 TAirflowGapOutlet; // Temperature of air leaving airflow gap between glass panes (K)
 		Real64 TAirflowGapOutletC; // Temperature of air leaving airflow gap between glass panes (C)
-		static Array1D< Real64 > TGapNewBG( 2 ); // For between-glass shade/blind, average gas temp in gaps on either //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TGapNewBG( 2 ); // For between-glass shade/blind, average gas temp in gaps on either //Tuned Made static
 		//  side of shade/blind (K)
 		Real64 hcv; // Convection coefficient from gap glass or shade/blind to gap air (W/m2-K)
 		Real64 hcvAirflowGap; // Convection coefficient from airflow gap glass to airflow gap air (W/m2-K)
 		Real64 hcvPrev; // Value of hcv from previous iteration
-		static Array1D< Real64 > hcvBG( 2 ); // For between-glass shade/blind, convection coefficient from gap glass or //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hcvBG( 2 ); // For between-glass shade/blind, convection coefficient from gap glass or //Tuned Made static
 		//  shade/blind to gap gas on either side of shade/blind (W/m2-K)
 		Real64 ConvHeatFlowNatural; // Convective heat flow from gap between glass and interior shade or blind (W)
 		Real64 ConvHeatFlowForced; // Convective heat flow from forced airflow gap (W)
@@ -2835,7 +2836,7 @@ namespace WindowManager {
 		int ShadeFlag; // Shading flag
 		Real64 ShadeAbsFac1; // Fractions for apportioning absorbed radiation to shade/blind faces
 		Real64 ShadeAbsFac2;
-		static Array1D< Real64 > AbsRadShadeFace( 2 ); // Solar radiation, short-wave radiation from lights, and long-wave //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > AbsRadShadeFace( 2 ); // Solar radiation, short-wave radiation from lights, and long-wave //Tuned Made static
 		//  radiation from lights and zone equipment absorbed by faces of shade/blind (W/m2)
 		Real64 ShadeArea; // shade/blind area (m2)
 		Real64 CondHeatGainGlass; // Conduction through inner glass layer, outside to inside (W)
@@ -2850,7 +2851,7 @@ namespace WindowManager {
 		int ConstrNum; // Construction number, bare and with shading device
 		int ConstrNumSh;
 		Real64 TransDiff; // Diffuse shortwave transmittance
-		static Array1D< Real64 > RhoIR( 10 ); // Face IR reflectance //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > RhoIR( 10 ); // Face IR reflectance //Tuned Made static
 		Real64 FacRhoIR25; // Intermediate variable
 		Real64 FacRhoIR63; // Intermediate variable
 		Real64 RhoIRfp; // Intermediate variable
@@ -3336,8 +3337,13 @@ namespace WindowManager {
 				ShowFatalError( "SolveForWindowTemperatures: Invalid number of Glass Layers=" + TrimSigDigits( ngllayer ) + ", up to 4 allowed." );
 			}}
 
-			LUdecomposition( Aface, nglfacep, indx, d ); // Note that these routines change Aface;
-			LUsolution( Aface, nglfacep, indx, Bface ); // face temperatures are returned in Bface
+			if ( ShadeFlag == ExtShadeOn || ShadeFlag == ExtBlindOn || ShadeFlag == ExtScreenOn || ShadeFlag == BGShadeOn || ShadeFlag == BGBlindOn ) {
+				LUdecomposition( Aface, nglfacep, indx, d ); // Note that these routines change Aface;
+				LUsolution( Aface, nglfacep, indx, Bface ); // face temperatures are returned in Bface
+			} else {
+				// Without an exterior or between-glass shading device each face only couples to its neighbors
+				TriDiagonalSolution( Aface, nglfacep, Bface ); // face temperatures are returned in Bface
+			}
 
 			for ( i = 1; i <= nglfacep; ++i ) {
 				thetasPrev( i ) = thetas( i );
@@ -3763,15 +3769,15 @@ namespace WindowManager {
 		int MatNumSh; // Material number of shade/blind layer
 		int nglassfaces; // Number of glass faces in contruction
 		// In the following, "gaps" refer to the gaps on either side of the shade/blind
-		Array1D< Real64 > TGlassFace( 2 ); // Temperature of glass surfaces facing gaps (K)
-		Array1D< Real64 > TShadeFace( 2 ); // Temperature of shade surfaces facing gaps (K)
-		Array1D< Real64 > hGapStill( 2 ); // Still-air conduction/convection coeffs for the gaps (W/m2-K)
-		Array1D< Real64 > TGapOld( 2 ); // Previous-iteration average gas temp in gaps (K)
+		static EP_THREAD_LOCAL Array1D< Real64 > TGlassFace( 2 ); // Temperature of glass surfaces facing gaps (K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TShadeFace( 2 ); // Temperature of shade surfaces facing gaps (K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hGapStill( 2 ); // Still-air conduction/convection coeffs for the gaps (W/m2-K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TGapOld( 2 ); // Previous-iteration average gas temp in gaps (K) //Tuned Made static
 		Real64 GapHeight; // Vertical length of glass-shade/blind gap (m)
 		Real64 GapDepth; // Distance from shade/blind to glass; assumed same for both gaps (m)
-		Array1D< Real64 > RhoGas( 2 ); // Density of gap gas at a temperature of TGapOld (kg/m3)
+		static EP_THREAD_LOCAL Array1D< Real64 > RhoGas( 2 ); // Density of gap gas at a temperature of TGapOld (kg/m3) //Tuned Made static
 		Real64 RhoTRef; // Density of gap gas at reference temp = KelvinConvK (kg/m3)
-		Array1D< Real64 > ViscGas( 2 ); // Viscosity of gap gas at a temperature of TGapOld (kg/m3)
+		static EP_THREAD_LOCAL Array1D< Real64 > ViscGas( 2 ); // Viscosity of gap gas at a temperature of TGapOld (kg/m3) //Tuned Made static
 		Real64 RhoGasZero; // Gas density at KelvinConvK
 		Real64 ViscGasZero; // Gas viscosity at KelvinConvK (not used)
 		Real64 AGap; // Cross sectional area of gaps (m2); for vertical window, this
@@ -3791,9 +3797,9 @@ namespace WindowManager {
 		Real64 AVGap; // Coeff. of VGap**2 term in pressure balance equation
 		Real64 BVGap; // Coeff. of VGap term in pressure balance equation
 		Real64 CVGap; // VGap-independent term in pressure balance equation
-		Array1D< Real64 > GapHeightChar( 2 ); // Characteristic height of the gap gas temperature profile (m)
-		Array1D< Real64 > EpsChar( 2 ); // EXP(-GapHeight/GapHeightChar(IGap))
-		Array1D< Real64 > TAve( 2 ); // Average of TGlass and TShade for the gaps (K)
+		static EP_THREAD_LOCAL Array1D< Real64 > GapHeightChar( 2 ); // Characteristic height of the gap gas temperature profile (m) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > EpsChar( 2 ); // EXP(-GapHeight/GapHeightChar(IGap)) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TAve( 2 ); // Average of TGlass and TShade for the gaps (K) //Tuned Made static
 		Real64 con; // Gap gas conductivity and derivative
 		Real64 gr; // Gap gas Grashof number
 		Real64 pr; // Gap gas Prandtl number
@@ -4104,20 +4110,20 @@ namespace WindowManager {
 		int ConstrNumSh; // Shaded construction number
 		int MatNumSh; // Material number of shade/blind layer
 		// In the following, "gaps" refer to the gaps on either side of the shade/blind
-		Array1D< Real64 > TGlassFace( 2 ); // Temperature of glass surfaces facing gaps (K)
-		Array1D< Real64 > TShadeFace( 2 ); // Temperature of shade surfaces facing gaps (K)
-		Array1D< Real64 > hGapStill( 2 ); // Still-air conduction/convection coeffs for the gaps (W/m2-K)
-		Array1D< Real64 > TGapOld( 2 ); // Previous-iteration average gas temp in gaps (K)
+		static EP_THREAD_LOCAL Array1D< Real64 > TGlassFace( 2 ); // Temperature of glass surfaces facing gaps (K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TShadeFace( 2 ); // Temperature of shade surfaces facing gaps (K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > hGapStill( 2 ); // Still-air conduction/convection coeffs for the gaps (W/m2-K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TGapOld( 2 ); // Previous-iteration average gas temp in gaps (K) //Tuned Made static
 		Real64 GapHeight; // Vertical length of glass-shade/blind gap (m)
 		Real64 GapDepth; // Distance from shade/blind to glass; assumed same for both gaps (m)
-		Array1D< Real64 > RhoAir( 2 ); // Density of gap air (kg/m3)
+		static EP_THREAD_LOCAL Array1D< Real64 > RhoAir( 2 ); // Density of gap air (kg/m3) //Tuned Made static
 		Real64 AGap; // Cross sectional area of each gap (m2); for vertical window, this
 		//   is in horizontal plane normal to window.
 		Real64 TGapInlet; // Gap inlet air temperature (K)
-		Array1D< Real64 > TGapOutlet( 2 ); // Gap outlet air temperature (K)
-		Array1D< Real64 > QConvGap( 2 ); // Convective heat flow from each gap (W)
-		Array1D< Real64 > GapHeightChar( 2 ); // Characteristic height of the gap air temperature profile (m)
-		Array1D< Real64 > TAve( 2 ); // Average of TGlass and TShade for the gaps (K)
+		static EP_THREAD_LOCAL Array1D< Real64 > TGapOutlet( 2 ); // Gap outlet air temperature (K) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > QConvGap( 2 ); // Convective heat flow from each gap (W) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > GapHeightChar( 2 ); // Characteristic height of the gap air temperature profile (m) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > TAve( 2 ); // Average of TGlass and TShade for the gaps (K) //Tuned Made static
 		Real64 con; // Gap air conductivity and derivative
 		Real64 gr; // Gap air Grashof number
 		Real64 pr; // Gap air Prandtl number
@@ -4243,7 +4249,7 @@ namespace WindowManager {
 		int k;
 		int imax; // Temporary variable
 		//   as output: decomposed matrix
-		static Array1D< Real64 > vv( 10 ); // Stores the implicit scaling of each row //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > vv( 10 ); // Stores the implicit scaling of each row //Tuned Made static
 		Real64 aamax; // Absolute value of largest element of matrix
 		Real64 dum; // Temporary variable
 		Real64 sum; // Sum of products of matrix elements
@@ -4374,6 +4380,60 @@ namespace WindowManager {
 		}
 	}
 
+	//**************************************************************************
+
+	void
+	TriDiagonalSolution(
+		Array2< Real64 > const & a, // Tridiagonal matrix in a.x = b
+		int const n, // Dimension of a and b
+		Array1< Real64 > & b // Matrix and vector in a.x = b;
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves set of linear equations a.x = b when a is tridiagonal
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm. Uses the same a(column,row) layout as LUdecomposition. The face
+		// heat balance matrix is diagonally dominant, so no pivoting is done.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		//   b is also output as the solution, x
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i; // Counter
+		static EP_THREAD_LOCAL Array1D< Real64 > cp( 10 ); // Eliminated super-diagonal //Tuned Made static
+		Real64 denom; // Eliminated diagonal
+
+		// FLOW
+
+		assert( n <= 10 ); // cp sizing
+
+		for ( i = 1; i <= n; ++i ) {
+			denom = a( i, i );
+			if ( i > 1 ) {
+				denom -= a( i - 1, i ) * cp( i - 1 );
+				b( i ) -= a( i - 1, i ) * b( i - 1 );
+			}
+			if ( denom == 0.0 ) denom = rTinyValue;
+			cp( i ) = ( i < n ) ? a( i + 1, i ) / denom : 0.0;
+			b( i ) /= denom;
+		}
+		for ( i = n - 1; i >= 1; --i ) {
+			b( i ) -= cp( i ) * b( i + 1 );
+		}
+	}
+
 	//******************************************************************************
 
 	void
@@ -4429,14 +4489,14 @@ namespace WindowManager {
 		int j;
 		int NMix; // Number of gases in a mixture
 		Real64 molmix; // Molecular weight of mixture
-		static Array1D< Real64 > kprime( 10 ); // Monotonic thermal conductivity
-		static Array1D< Real64 > kdblprm( 10 ); // Conductivity term accounting for additional energy moved by
+		static EP_THREAD_LOCAL Array1D< Real64 > kprime( 10 ); // Monotonic thermal conductivity
+		static EP_THREAD_LOCAL Array1D< Real64 > kdblprm( 10 ); // Conductivity term accounting for additional energy moved by
 		//  the diffusional transport of internal energy in polyatomic gases.
 		Real64 kpmix; // Monotonic thermal conductivity of mixture
 		Real64 kdpmix;
-		static Array1D< Real64 > mukpdwn( 10 ); // Denominator term
-		static Array1D< Real64 > kpdown( 10 ); // Denominator terms
-		static Array1D< Real64 > kdpdown( 10 );
+		static EP_THREAD_LOCAL Array1D< Real64 > mukpdwn( 10 ); // Denominator term
+		static EP_THREAD_LOCAL Array1D< Real64 > kpdown( 10 ); // Denominator terms
+		static EP_THREAD_LOCAL Array1D< Real64 > kdpdown( 10 );
 		Real64 kmix; // For accumulating conductance of gas mixture
 		Real64 mumix; // For accumulating viscosity of gas mixture
 		Real64 visc( 0.0 ); // Dynamic viscosity of mixture at tmean (g/m-s)
@@ -4449,11 +4509,11 @@ namespace WindowManager {
 		Real64 psiterm; // Factor
 		Real64 phikup; // Numerator factor
 		Real64 rhomix; // Density of gas mixture (kg/m3)
-		static Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture
-		static Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s)
-		static Array1D< Real64 > fcon( 10 ); // Conductance of each gas in a mixture (W/m2-K)
-		static Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3)
-		static Array1D< Real64 > fcp( 10 ); // Specific heat of each gas in a mixture (J/m3-K)
+		static EP_THREAD_LOCAL Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture
+		static EP_THREAD_LOCAL Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s)
+		static EP_THREAD_LOCAL Array1D< Real64 > fcon( 10 ); // Conductance of each gas in a mixture (W/m2-K)
+		static EP_THREAD_LOCAL Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3)
+		static EP_THREAD_LOCAL Array1D< Real64 > fcp( 10 ); // Specific heat of each gas in a mixture (J/m3-K)
 
 		NMix = gnmix( IGap ); //Autodesk:Logic Either assert NMix>0 or handle NMix<=0 in logic so that con and locals guar. initialized before use
 
@@ -4597,14 +4657,14 @@ namespace WindowManager {
 		int j;
 		int NMix; // Number of gases in a mixture
 		Real64 molmix; // Molecular weight of mixture
-		Array1D< Real64 > mukpdwn( 10 ); // Denominator term
+		static EP_THREAD_LOCAL Array1D< Real64 > mukpdwn( 10 ); // Denominator term //Tuned Made static
 		Real64 mumix; // For accumulating viscosity of gas mixture
 		Real64 phimup; // Numerator factor
 		Real64 downer; // Denominator factor
 		Real64 rhomix; // Density of gas mixture (kg/m3)
-		Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture
-		Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s)
-		Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3)
+		static EP_THREAD_LOCAL Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s) //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3) //Tuned Made static
 
 		NMix = gnmix( IGap );
 
@@ -4705,7 +4765,7 @@ namespace WindowManager {
 
 		int i; // Face counter
 		int ShadeFlag; // Shading flag
-		static Array1D< Real64 > rguess( 11 ); // Combined radiative/convective resistance (m2-K/W) of //Tuned Made static
+		static EP_THREAD_LOCAL Array1D< Real64 > rguess( 11 ); // Combined radiative/convective resistance (m2-K/W) of //Tuned Made static
 		// inside or outside air film, or gap
 		Real64 restot; // Total window resistance including outside
 		//   and inside air films (m2-K/W)
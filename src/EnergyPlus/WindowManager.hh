@@ -293,6 +293,15 @@ namespace WindowManager {
 		Array1< Real64 > & b // Matrix and vector in a.x = b;
 	);
 
+	//**************************************************************************
+
+	void
+	TriDiagonalSolution(
+		Array2< Real64 > const & a, // Tridiagonal matrix in a.x = b
+		int const n, // Dimension of a and b
+		Array1< Real64 > & b // Matrix and vector in a.x = b;
+	);
+
 	//******************************************************************************
 
 	void
@@ -1163,6 +1163,7 @@ namespace ZoneContaminantPredictorCorrector {
 			}
 
 			CONTRAT.dimension( NumOfZones, 0.0 );
+			ZoneSysContFlow.allocate( NumOfZones );
 
 			// Allocate Derived Types
 
@@ -1429,7 +1430,7 @@ namespace ZoneContaminantPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Lixing Gu
 		//       DATE WRITTEN   May 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, find the controlled zone of each zone once for both contaminants
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1480,9 +1481,24 @@ namespace ZoneContaminantPredictorCorrector {
 
 		// FLOW:
 
+		// Find the available contaminant controlled zone, if any, of each zone for both contaminants.
+		// The first one that lists the zone is used, as a search of the controlled zones for each zone would.
+		std::vector< int > ZoneContControlledZoneNums( NumOfZones + 1, 0 );
+		for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
+			auto const & controlledZone( ContaminantControlledZone( ContControlledZoneNum ) );
+			if ( controlledZone.NumOfZones < 1 ) continue;
+			if ( ! ( GetCurrentScheduleValue( controlledZone.AvaiSchedPtr ) > 0.0 ) ) continue;
+			if ( ZoneContControlledZoneNums[ controlledZone.ActualZoneNum ] == 0 ) ZoneContControlledZoneNums[ controlledZone.ActualZoneNum ] = ContControlledZoneNum;
+			for ( I = 1; I <= controlledZone.NumOfZones; ++I ) {
+				if ( ZoneContControlledZoneNums[ controlledZone.ControlZoneNum( I ) ] == 0 ) ZoneContControlledZoneNums[ controlledZone.ControlZoneNum( I ) ] = ContControlledZoneNum;
+			}
+		}
+
 		// Update zone CO2
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
+			ContControlledZoneNum = ZoneContControlledZoneNums[ ZoneNum ];
+
 			if ( ShortenTimeStepSys ) {
 
 				if ( Zone( ZoneNum ).SystemZoneNodeNumber > 0 ) { // roll back result for zone air node,
@@ -1564,32 +1580,13 @@ namespace ZoneContaminantPredictorCorrector {
 				ZoneSysContDemand( ZoneNum ).OutputRequiredToCO2SP = 0.0;
 
 				// Check to see if this is a "CO2 controlled zone"
-				ControlledCO2ZoneFlag = false;
-				// Check all the controlled zones to see if it matches the zone simulated
-				for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
-					if ( GetCurrentScheduleValue( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr ) > 0.0 ) {
-						ZoneAirCO2SetPoint = ZoneCO2SetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
-						if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointOn ) {
-							ZoneAirCO2SetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointValue;
-						}
-						if ( ContaminantControlledZone( ContControlledZoneNum ).NumOfZones >= 1 ) {
-							if ( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum != ZoneNum ) {
-								for ( I = 1; I <= ContaminantControlledZone( ContControlledZoneNum ).NumOfZones; ++I ) {
-									if ( ContaminantControlledZone( ContControlledZoneNum ).ControlZoneNum( I ) == ZoneNum ) {
-										ControlledCO2ZoneFlag = true;
-										break;
-									}
-								}
-								if ( ControlledCO2ZoneFlag ) break;
-							} else {
-								ControlledCO2ZoneFlag = true;
-								break;
-							}
-						}
+				ControlledCO2ZoneFlag = ( ContControlledZoneNum > 0 );
+				if ( ControlledCO2ZoneFlag ) {
+					ZoneAirCO2SetPoint = ZoneCO2SetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
+					if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointOn ) {
+						ZoneAirCO2SetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideCO2SetPointValue;
 					}
-				} // CO2ControlledZoneNum
 
-				if ( ControlledCO2ZoneFlag ) {
 					// The density of air
 					RhoAir = PsyRhoAirFnPbTdbW( OutBaroPress, ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), RoutineName );
 
@@ -1646,32 +1643,13 @@ namespace ZoneContaminantPredictorCorrector {
 				ZoneSysContDemand( ZoneNum ).OutputRequiredToGCSP = 0.0;
 
 				// Check to see if this is a "GC controlled zone"
-				ControlledGCZoneFlag = false;
-				// Check all the controlled zones to see if it matches the zone simulated
-				for ( ContControlledZoneNum = 1; ContControlledZoneNum <= NumContControlledZones; ++ContControlledZoneNum ) {
-					if ( GetCurrentScheduleValue( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr ) > 0.0 ) {
-						ZoneAirGCSetPoint = ZoneGCSetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
-						if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointOn ) {
-							ZoneAirGCSetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointValue;
-						}
-						if ( ContaminantControlledZone( ContControlledZoneNum ).NumOfZones >= 1 ) {
-							if ( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum != ZoneNum ) {
-								for ( I = 1; I <= ContaminantControlledZone( ContControlledZoneNum ).NumOfZones; ++I ) {
-									if ( ContaminantControlledZone( ContControlledZoneNum ).ControlZoneNum( I ) == ZoneNum ) {
-										ControlledGCZoneFlag = true;
-										break;
-									}
-								}
-								if ( ControlledGCZoneFlag ) break;
-							} else {
-								ControlledGCZoneFlag = true;
-								break;
-							}
-						}
+				ControlledGCZoneFlag = ( ContControlledZoneNum > 0 );
+				if ( ControlledGCZoneFlag ) {
+					ZoneAirGCSetPoint = ZoneGCSetPoint( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum );
+					if ( ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointOn ) {
+						ZoneAirGCSetPoint = ContaminantControlledZone( ContControlledZoneNum ).EMSOverrideGCSetPointValue;
 					}
-				} // GCControlledZoneNum
 
-				if ( ControlledGCZoneFlag ) {
 					// The density of air
 					RhoAir = PsyRhoAirFnPbTdbW( OutBaroPress, ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), RoutineName );
 
@@ -1934,12 +1912,13 @@ namespace ZoneContaminantPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Lixing Gu
 		//       DATE WRITTEN   July, 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, use the air system flows gathered by CorrectZoneHumRat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This subroutine updates the zone contaminants.
-		// This subroutine is modified from CorrectZoneHumRat in ZoneTempPredictorCorrector module
+		// This subroutine is modified from CorrectZoneHumRat in ZoneTempPredictorCorrector module, which
+		// gathers the air system and plenum inlet flows of each zone for all species (ZoneSysContFlow)
 
 		// METHODOLOGY EMPLOYED:
 		// na
@@ -1950,12 +1929,6 @@ namespace ZoneContaminantPredictorCorrector {
 
 		// Using/Aliasing
 		using DataLoopNode::Node;
-		using DataZoneEquipment::ZoneEquipConfig;
-		using ZonePlenum::ZoneRetPlenCond;
-		using ZonePlenum::ZoneSupPlenCond;
-		using ZonePlenum::NumZoneReturnPlenums;
-		using ZonePlenum::NumZoneSupplyPlenums;
-		using DataDefineEquip::AirDistUnit;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1970,14 +1943,7 @@ namespace ZoneContaminantPredictorCorrector {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int NodeNum;
 		int ZoneNodeNum;
-		int ZoneEquipConfigNum;
-		bool ControlledZoneAirFlag;
-		int ZoneRetPlenumNum;
-		int ZoneSupPlenumNum;
-		bool ZoneRetPlenumAirFlag;
-		bool ZoneSupPlenumAirFlag;
 		Real64 CO2Gain; // Zone CO2 internal gain
 		Real64 GCGain; // Zone generic contaminant internal gain
 		Real64 RhoAir;
@@ -1990,11 +1956,6 @@ namespace ZoneContaminantPredictorCorrector {
 		Real64 TotExitMassFlowRate;
 		Real64 ZoneMassFlowRate;
 		Real64 SysTimeStepInSeconds;
-		Real64 ZoneMult;
-		int ADUListIndex;
-		int ADUNum;
-		int ADUInNode;
-		int ADUOutNode;
 		int ZoneNum;
 
 		// FLOW:
@@ -2054,111 +2015,11 @@ namespace ZoneContaminantPredictorCorrector {
 			}
 
 			// Start to calculate zone CO2 and genric contaminant levels
-			CO2MassFlowRate = 0.0;
-			GCMassFlowRate = 0.0;
-			ZoneMassFlowRate = 0.0;
-			ExhMassFlowRate = 0.0;
-			TotExitMassFlowRate = 0.0;
-			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-
-			// Check to see if this is a controlled zone
-			ControlledZoneAirFlag = false;
-			for ( ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-				if ( ! Zone( ZoneEquipConfigNum ).IsControlled ) continue;
-				if ( ZoneEquipConfig( ZoneEquipConfigNum ).ActualZoneNum != ZoneNum ) continue;
-				ControlledZoneAirFlag = true;
-				break;
-			} // ZoneEquipConfigNum
-
-			// Check to see if this is a plenum zone
-			ZoneRetPlenumAirFlag = false;
-			for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-				if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-				ZoneRetPlenumAirFlag = true;
-				break;
-			} // ZoneRetPlenumNum
-			ZoneSupPlenumAirFlag = false;
-			for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-				if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-				ZoneSupPlenumAirFlag = true;
-				break;
-			} // ZoneSupPlenumNum
-
-			if ( ControlledZoneAirFlag ) { // If there is system flow then calculate the flow rates
-
-				// Calculate moisture flow rate into each zone
-				for ( NodeNum = 1; NodeNum <= ZoneEquipConfig( ZoneEquipConfigNum ).NumInletNodes; ++NodeNum ) {
-
-					if ( Contaminant.CO2Simulation ) {
-						CO2MassFlowRate += ( Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).CO2 ) / ZoneMult;
-					}
-					if ( Contaminant.GenericContamSimulation ) {
-						GCMassFlowRate += ( Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).GenContam ) / ZoneMult;
-					}
-					ZoneMassFlowRate += Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate / ZoneMult;
-				} // NodeNum
-
-				for ( NodeNum = 1; NodeNum <= ZoneEquipConfig( ZoneEquipConfigNum ).NumExhaustNodes; ++NodeNum ) {
-					ExhMassFlowRate += Node( ZoneEquipConfig( ZoneEquipConfigNum ).ExhaustNode( NodeNum ) ).MassFlowRate / ZoneMult;
-				} // NodeNum
-
-				if ( ZoneEquipConfig( ZoneEquipConfigNum ).ReturnAirNode > 0 ) {
-					TotExitMassFlowRate = ExhMassFlowRate + Node( ZoneEquipConfig( ZoneEquipConfigNum ).ReturnAirNode ).MassFlowRate / ZoneMult;
-				}
-
-				// Do the calculations for the plenum zone
-			} else if ( ZoneRetPlenumAirFlag ) {
-				for ( NodeNum = 1; NodeNum <= ZoneRetPlenCond( ZoneRetPlenumNum ).NumInletNodes; ++NodeNum ) {
-
-					if ( Contaminant.CO2Simulation ) {
-						CO2MassFlowRate += ( Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).CO2 ) / ZoneMult;
-					}
-					if ( Contaminant.GenericContamSimulation ) {
-						GCMassFlowRate += ( Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).GenContam ) / ZoneMult;
-					}
-					ZoneMassFlowRate += Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate / ZoneMult;
-				} // NodeNum
-				// add in the leak flow
-				for ( ADUListIndex = 1; ADUListIndex <= ZoneRetPlenCond( ZoneRetPlenumNum ).NumADUs; ++ADUListIndex ) {
-					ADUNum = ZoneRetPlenCond( ZoneRetPlenumNum ).ADUIndex( ADUListIndex );
-					if ( AirDistUnit( ADUNum ).UpStreamLeak ) {
-						ADUInNode = AirDistUnit( ADUNum ).InletNodeNum;
-						if ( Contaminant.CO2Simulation ) {
-							CO2MassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateUpStrLk * Node( ADUInNode ).CO2 ) / ZoneMult;
-						}
-						if ( Contaminant.GenericContamSimulation ) {
-							GCMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateUpStrLk * Node( ADUInNode ).GenContam ) / ZoneMult;
-						}
-						ZoneMassFlowRate += AirDistUnit( ADUNum ).MassFlowRateUpStrLk / ZoneMult;
-					}
-					if ( AirDistUnit( ADUNum ).DownStreamLeak ) {
-						ADUOutNode = AirDistUnit( ADUNum ).OutletNodeNum;
-						if ( Contaminant.CO2Simulation ) {
-							CO2MassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateDnStrLk * Node( ADUOutNode ).CO2 ) / ZoneMult;
-						}
-						if ( Contaminant.GenericContamSimulation ) {
-							GCMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateDnStrLk * Node( ADUOutNode ).GenContam ) / ZoneMult;
-						}
-						ZoneMassFlowRate += AirDistUnit( ADUNum ).MassFlowRateDnStrLk / ZoneMult;
-					}
-				}
-				// Do not allow exhaust mass flow for a plenum zone
-				ExhMassFlowRate = 0.0;
-				TotExitMassFlowRate = ExhMassFlowRate + ZoneMassFlowRate;
-
-			} else if ( ZoneSupPlenumAirFlag ) {
-
-				if ( Contaminant.CO2Simulation ) {
-					CO2MassFlowRate += ( Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate * Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).CO2 ) / ZoneMult;
-				}
-				if ( Contaminant.GenericContamSimulation ) {
-					GCMassFlowRate += ( Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate * Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).GenContam ) / ZoneMult;
-				}
-				ZoneMassFlowRate += Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate / ZoneMult;
-				// Do not allow exhaust mass flow for a plenum zone
-				ExhMassFlowRate = 0.0;
-				TotExitMassFlowRate = ExhMassFlowRate + ZoneMassFlowRate;
-			}
+			CO2MassFlowRate = ZoneSysContFlow( ZoneNum ).CO2MassFlowRate;
+			GCMassFlowRate = ZoneSysContFlow( ZoneNum ).GCMassFlowRate;
+			ZoneMassFlowRate = ZoneSysContFlow( ZoneNum ).ZoneMassFlowRate;
+			ExhMassFlowRate = ZoneSysContFlow( ZoneNum ).ExhMassFlowRate;
+			TotExitMassFlowRate = ZoneSysContFlow( ZoneNum ).TotExitMassFlowRate;
 
 			SysTimeStepInSeconds = SecInHour * TimeStepSys;
 
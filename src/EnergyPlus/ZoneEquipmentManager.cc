@@ -26,6 +26,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSizing.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DirectAirManager.hh>
@@ -245,6 +246,8 @@ namespace ZoneEquipmentManager {
 		int Counter;
 		int MaxNumOfEquipTypes;
 
+		DataTimings::ProfileTimer const profileTimer( "GetZoneEquipment" ); // Region of the timing profile
+
 		if ( ! ZoneEquipInputsFilled ) {
 			GetZoneEquipmentData();
 		}
@@ -4900,7 +4903,7 @@ namespace ZoneEquipmentManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   February 2014
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, update each source zone after all the mixing flows are set
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4908,7 +4911,9 @@ namespace ZoneEquipmentManager {
 		// air mass balance.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The flow is split between the mixing objects of the zone by their design fractions.
+		// The source zone totals only depend on the final object flows, so they are updated
+		// once the flows of all the objects of the zone are set.
 
 		// REFERENCES:
 		// na
@@ -4950,6 +4955,9 @@ namespace ZoneEquipmentManager {
 				MixingNum = MassConservation(ZoneNum).ZoneMixingReceivingPtr(Loop);
 				Mixing(MixingNum).MixingMassFlowRate = MassConservation(ZoneNum).ZoneMixingReceivingFr(Loop) * ZoneMixingMassFlowRate;
 				MixingMassFlowRate += Mixing(MixingNum).MixingMassFlowRate;
+			}
+			for (Loop = 1; Loop <= NumOfReceivingZoneMixingObjects; ++Loop) {
+				MixingNum = MassConservation(ZoneNum).ZoneMixingReceivingPtr(Loop);
 				CalcZoneMixingFlowRateOfSourceZone(Mixing(MixingNum).FromZone);
 			}
 		}
@@ -4964,7 +4972,7 @@ namespace ZoneEquipmentManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Bereket Nigusse
 		//       DATE WRITTEN   February 2014
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, use the source mixing object pointers directly
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4972,7 +4980,7 @@ namespace ZoneEquipmentManager {
 		// air mass balance.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Sums the flows of the mixing objects that have this zone as their source.
 
 		// REFERENCES:
 		// na
@@ -5001,7 +5009,6 @@ namespace ZoneEquipmentManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int MixingNum;
 		int ZoneMixingNum;
 		int NumOfSourceZoneMixingObjects;
@@ -5012,11 +5019,7 @@ namespace ZoneEquipmentManager {
 		if (NumOfSourceZoneMixingObjects > 0) {
 			for (ZoneMixingNum = 1; ZoneMixingNum <= NumOfSourceZoneMixingObjects; ++ZoneMixingNum) {
 				MixingNum = MassConservation(ZoneNum).ZoneMixingSourcesPtr(ZoneMixingNum);
-				for (Loop = 1; Loop <= TotMixing; ++Loop) {
-					if (Loop == MixingNum) {
-						ZoneSourceMassFlowRate += Mixing(Loop).MixingMassFlowRate;
-					}
-				}
+				ZoneSourceMassFlowRate += Mixing(MixingNum).MixingMassFlowRate;
 			}
 		}
 		MassConservation(ZoneNum).MixingSourceMassFlowRate = ZoneSourceMassFlowRate;
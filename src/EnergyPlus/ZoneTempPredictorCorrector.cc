@@ -10,6 +10,7 @@
 // EnergyPlus Headers
 #include <ZoneTempPredictorCorrector.hh>
 #include <DataAirflowNetwork.hh>
+#include <DataContaminantBalance.hh>
 #include <DataDefineEquip.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
@@ -21,6 +22,8 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -169,6 +172,17 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< Real64 > ZoneTempOscillate;
 	Real64 AnyZoneTempOscillate;
 
+	// Zone indexes and surface segments used by CalcZoneSums
+	bool ZoneSumsIndexesSet( false ); // Indexes are final (the zone equipment and plenum input has been read)
+	Array1D_int ZoneSumsEquipConfigNum; // Controlled zone equipment configuration of each zone (0 if none)
+	Array1D_int ZoneSumsRetPlenumNum; // Return plenum of each zone (0 if none)
+	Array1D_int ZoneSumsSupPlenumNum; // Supply plenum of each zone (0 if none)
+	Array1D_int ZoneOpaqueConvSurfStart; // Start of each zone's segment of ZoneOpaqueConvSurfs (NumOfZones+1 entries)
+	Array1D_int ZoneOpaqueConvSurfs; // Opaque heat transfer surfaces, grouped by zone
+	Array1D< Real64 > ZoneOpaqueConvSurfArea; // Area of the surfaces of ZoneOpaqueConvSurfs
+	Array1D_int ZoneWindowConvSurfStart; // Start of each zone's segment of ZoneWindowConvSurfs (NumOfZones+1 entries)
+	Array1D_int ZoneWindowConvSurfs; // Window heat transfer surfaces, grouped by zone
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Object Data
@@ -410,6 +424,8 @@ namespace ZoneTempPredictorCorrector {
 		static gio::Fmt Format_701( "('Zone Volume Capacitance Multiplier,',F8.3,' ,',F8.3,',',F8.3,',',F8.3)" );
 
 		// FLOW:
+		DataTimings::ProfileTimer const profileTimer( "GetZoneAirSetPoints" ); // Region of the timing profile
+
 		cCurrentModuleObject = cZControlTypes( iZC_TStat );
 		NumTStatStatements = GetNumObjectsFound( cCurrentModuleObject );
 		TStatObjects.allocate( NumTStatStatements );
@@ -490,6 +506,8 @@ namespace ZoneTempPredictorCorrector {
 						CheckCreatedZoneItemName( RoutineName, cCurrentModuleObject, Zone( ZoneList( TStatObjects( Item ).ZoneOrZoneListPtr ).Zone( Item1 ) ).Name, ZoneList( TStatObjects( Item ).ZoneOrZoneListPtr ).MaxZoneNameLength, TStatObjects( Item ).Name, TempControlledZone.Name(), TempControlledZoneNum - 1, TempControlledZone( TempControlledZoneNum ).Name, errFlag );
 						if ( errFlag ) ErrorsFound = true;
 					}
+					// Faulty thermostats are matched to the thermostat by name every time step
+					TempControlledZone( TempControlledZoneNum ).NameID = InternName( TempControlledZone( TempControlledZoneNum ).Name );
 
 					TempControlledZone( TempControlledZoneNum ).ControlTypeSchedName = cAlphaArgs( 3 );
 					TempControlledZone( TempControlledZoneNum ).CTSchedIndex = GetScheduleIndex( cAlphaArgs( 3 ) );
@@ -836,6 +854,7 @@ namespace ZoneTempPredictorCorrector {
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			HumidityControlZone( HumidControlledZoneNum ).ControlName = cAlphaArgs( 1 );
+			HumidityControlZone( HumidControlledZoneNum ).ControlNameID = InternName( cAlphaArgs( 1 ) );
 			// Ensure unique zone name
 			IsNotOK = false;
 			IsBlank = false;
@@ -2026,6 +2045,7 @@ namespace ZoneTempPredictorCorrector {
 			AIRRAT.dimension( NumOfZones, 0.0 );
 			ZTM1.dimension( NumOfZones, 0.0 );
 			ZTM2.dimension( NumOfZones, 0.0 );
+			ZoneAirTempChange.dimension( NumOfZones, 0.0 );
 			ZTM3.dimension( NumOfZones, 0.0 );
 
 			// Allocate Derived Types
@@ -2560,13 +2580,7 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
-		//Tuned Precompute controlled equip zone numbers for performance
-		std::vector< int > controlledZoneEquipConfigNums;
-		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-			if ( Zone( ZoneEquipConfigNum ).IsControlled ) {
-				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
-			}
-		}
+		if ( ! ZoneSumsIndexesSet ) SetupZoneSumsIndexes();
 
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
@@ -2635,7 +2649,7 @@ namespace ZoneTempPredictorCorrector {
 			// Calculate the various heat balance sums
 
 			// NOTE: SumSysMCp and SumSysMCpT are not used in the predict step
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT );
 
 			TempDepCoef = SumHA + SumMCp;
 			TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
@@ -2698,6 +2712,8 @@ namespace ZoneTempPredictorCorrector {
 		//       DATE WRITTEN   Nov 1997
 		//       MODIFIED       Aug 2013, Xiufeng Pang (XP) - Added code for updating set points during
 		//                      optimum start period
+		//                      Oct 2026, match faulty thermostats by interned name ID
+		//                      Oct 2026, read the fault status set once per zone time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2716,7 +2732,6 @@ namespace ZoneTempPredictorCorrector {
 		using General::TrimSigDigits;
 		using DataZoneControls::OccRoomTSetPointHeat;
 		using DataZoneControls::OccRoomTSetPointCool;
-		using InputProcessor::SameString;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2876,18 +2891,13 @@ namespace ZoneTempPredictorCorrector {
 				//  loop through the FaultsThermostatOffset objects to find the one for the zone
 				for ( int iFault = 1; iFault <= NumFaultyThermostat; ++iFault ) {
 
-					if ( SameString( TempControlledZone( RelativeZoneNum ).Name, FaultsThermostatOffset( iFault ).FaultyThermostatName ) ) {
+					if ( TempControlledZone( RelativeZoneNum ).NameID == FaultsThermostatOffset( iFault ).FaultyThermostatNameID ) {
 
-						// Check fault availability schedules
-						if ( GetCurrentScheduleValue( FaultsThermostatOffset( iFault ).AvaiSchedPtr ) > 0.0 ) {
+						// Check fault availability schedules (evaluated once per zone time step by UpdateFaultsStatus)
+						if ( FaultsThermostatOffset( iFault ).Status ) {
 
-							// Check fault severity schedules to update the reference thermostat offset
-							double rSchVal = 1.0;
-							double offsetUpdated;
-							if ( FaultsThermostatOffset( iFault ).SeveritySchedPtr >= 0 ) {
-								rSchVal = GetCurrentScheduleValue( FaultsThermostatOffset( iFault ).SeveritySchedPtr );
-							}
-							offsetUpdated = rSchVal * FaultsThermostatOffset( iFault ).Offset;
+							// Use the fault severity to update the reference thermostat offset
+							double offsetUpdated = FaultsThermostatOffset( iFault ).SeverityValue * FaultsThermostatOffset( iFault ).Offset;
 
 							// Positive offset means the sensor reading is higher than the actual value
 							TempZoneThermostatSetPoint( ActualZoneNum ) -= offsetUpdated;
@@ -3236,7 +3246,8 @@ namespace ZoneTempPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard J. Liesen
 		//       DATE WRITTEN   May 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, match faulty humidistats by interned name ID
+		//                      Oct 2026, read the fault status set once per zone time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3320,7 +3331,7 @@ namespace ZoneTempPredictorCorrector {
 				//  loop through the FaultsHumidistatOffset objects to find the one for the zone
 				for ( int iFault = 1; iFault <= NumFaultyHumidistat; ++iFault ) {
 
-					if ( SameString( HumidityControlZone( HumidControlledZoneNum ).ControlName, FaultsHumidistatOffset( iFault ).FaultyHumidistatName ) ) {
+					if ( HumidityControlZone( HumidControlledZoneNum ).ControlNameID == FaultsHumidistatOffset( iFault ).FaultyHumidistatNameID ) {
 
 						if ( SameString( FaultsHumidistatOffset( iFault ).FaultyHumidistatType, "ThermostatOffsetDependent" ) ) {
 						// For Humidistat Offset Type I: ThermostatOffsetDependent
@@ -3338,18 +3349,12 @@ namespace ZoneTempPredictorCorrector {
 								//  loop through the FaultsThermostatOffset objects to find the one causes the Humidistat Offset
 								for ( int iFaultThermo = 1; iFaultThermo <= NumFaultyThermostat; ++iFaultThermo ) {
 
-									if ( SameString( FaultsHumidistatOffset( iFault ).FaultyThermostatName, FaultsThermostatOffset( iFaultThermo ).Name ) ) {
+									if ( FaultsHumidistatOffset( iFault ).FaultyThermostatNameID == FaultsThermostatOffset( iFaultThermo ).NameID ) {
 										IsThermostatFound = true;
 
-										// Check fault availability schedules
-										if ( GetCurrentScheduleValue( FaultsThermostatOffset( iFaultThermo ).AvaiSchedPtr ) > 0.0 ) {
-
-											// Check fault severity schedules to update the reference thermostat offset
-											double rSchVal = 1.0;
-											if ( FaultsThermostatOffset( iFaultThermo ).SeveritySchedPtr >= 0 ) {
-												rSchVal = GetCurrentScheduleValue( FaultsThermostatOffset( iFaultThermo ).SeveritySchedPtr );
-											}
-											offsetThermostat = rSchVal * FaultsThermostatOffset( iFaultThermo ).Offset;
+										// Check fault availability schedules (evaluated once per zone time step by UpdateFaultsStatus)
+										if ( FaultsThermostatOffset( iFaultThermo ).Status ) {
+											offsetThermostat = FaultsThermostatOffset( iFaultThermo ).SeverityValue * FaultsThermostatOffset( iFaultThermo ).Offset;
 										}
 
 										// Stop searching the FaultsThermostatOffset object for the Humidistat Offset
@@ -3384,16 +3389,11 @@ namespace ZoneTempPredictorCorrector {
 						} else {
 						// For Humidistat Offset Type II: ThermostatOffsetIndependent
 
-							// Check fault availability schedules
-							if ( GetCurrentScheduleValue( FaultsHumidistatOffset( iFault ).AvaiSchedPtr ) > 0.0 ) {
+							// Check fault availability schedules (evaluated once per zone time step by UpdateFaultsStatus)
+							if ( FaultsHumidistatOffset( iFault ).Status ) {
 
-								// Check fault severity schedules to update the reference humidistat offset
-								double rSchVal = 1.0;
-								double offsetUpdated;
-								if ( FaultsHumidistatOffset( iFault ).SeveritySchedPtr >= 0 ) {
-									rSchVal = GetCurrentScheduleValue( FaultsHumidistatOffset( iFault ).SeveritySchedPtr );
-								}
-								offsetUpdated = rSchVal * FaultsHumidistatOffset( iFault ).Offset;
+								// Use the fault severity to update the reference humidistat offset
+								double offsetUpdated = FaultsHumidistatOffset( iFault ).SeverityValue * FaultsHumidistatOffset( iFault ).Offset;
 
 								// Positive offset means the sensor reading is higher than the actual value
 								ZoneRHHumidifyingSetPoint -= offsetUpdated;
@@ -3552,6 +3552,8 @@ namespace ZoneTempPredictorCorrector {
 		//       AUTHOR         Russell Taylor
 		//       DATE WRITTEN   ???
 		//       MODIFIED       November 1999, LKL;
+		//                      Oct 2026, temperature change of each zone (ZoneAirTempChange)
+		//                      Oct 2026, displacement ventilation and UFAD room air models run in parallel
 		//       RE-ENGINEERED  July 2003 (Peter Graham Ellis)
 		//                      February 2008 (Brent Griffith reworked history )
 
@@ -3594,6 +3596,10 @@ namespace ZoneTempPredictorCorrector {
 		using DataRoomAirModel::XM4TMX;
 		using DataRoomAirModel::RoomAirModel_Mundt;
 		using DataRoomAirModel::RoomAirModel_UserDefined;
+		using DataRoomAirModel::RoomAirModel_UCSDDV;
+		using DataRoomAirModel::RoomAirModel_UCSDUFI;
+		using DataRoomAirModel::RoomAirModel_UCSDUFE;
+		using DataSystemVariables::NumberRoomAirThreads;
 		using RoomAirModelManager::ManageAirModel;
 		using General::TrimSigDigits;
 
@@ -3643,12 +3649,11 @@ namespace ZoneTempPredictorCorrector {
 				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
 			}
 		}
+		if ( ! ZoneSumsIndexesSet ) SetupZoneSumsIndexes();
 
-		// Update zone temperatures
+		// Update the history terms and air heat capacity of all zones before any room air model is run
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
-			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
-
 			if ( ShortenTimeStepSys ) {
 				// time step has gotten smaller, use zone timestep history to interpolate new set of "DS" history terms.
 				if ( NumOfSysTimeSteps != NumOfSysTimeStepsLastZoneTimeStep ) { // cannot reuse existing DS data, interpolate from zone time
@@ -3686,13 +3691,44 @@ namespace ZoneTempPredictorCorrector {
 			}
 
 			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneNum ), ZoneAirHumRat( ZoneNum ), RoutineName ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), MAT( ZoneNum ) ) / ( TimeStepSys * SecInHour );
+		}
+
+		// The displacement ventilation and UFAD models only use the data of their own zone and its surfaces,
+		// so they are run for all of their zones at once ahead of the zone loop.  The first time step of an
+		// environment stays serial for the one time and begin environment initializations of the models.
+		std::vector< int > parallelAirModelZoneNums;
+		if ( NumberRoomAirThreads > 1 && ! BeginEnvrnFlag ) {
+			for ( int AirModelZoneNum = 1; AirModelZoneNum <= NumOfZones; ++AirModelZoneNum ) {
+				int const AirModelType( AirModel( AirModelZoneNum ).AirModelType );
+				if ( AirModelType == RoomAirModel_UCSDDV || AirModelType == RoomAirModel_UCSDUFI || AirModelType == RoomAirModel_UCSDUFE ) {
+					parallelAirModelZoneNums.push_back( AirModelZoneNum );
+				}
+			}
+		}
+		int const nParallelAirModelZones( parallelAirModelZoneNums.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) num_threads( NumberRoomAirThreads ) if ( nParallelAirModelZones > 1 )
+#endif
+		for ( int iZone = 0; iZone < nParallelAirModelZones; ++iZone ) {
+			ManageAirModel( parallelAirModelZoneNums[ iZone ] );
+		}
+
+		// Update zone temperatures
+		int iNextParallelAirModelZone( 0 );
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+
+			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 			AirCap = AIRRAT( ZoneNum );
 
-			ManageAirModel( ZoneNum );
+			if ( iNextParallelAirModelZone < nParallelAirModelZones && parallelAirModelZoneNums[ iNextParallelAirModelZone ] == ZoneNum ) {
+				++iNextParallelAirModelZone; // Already run above
+			} else {
+				ManageAirModel( ZoneNum );
+			}
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT );
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
 			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
 
@@ -3824,43 +3860,45 @@ namespace ZoneTempPredictorCorrector {
 			ZoneAirHumRat( ZoneNum ) = ZoneAirHumRatTemp( ZoneNum );
 			ZoneAirRelHum( ZoneNum ) = 100.0 * PsyRhFnTdbWPb( ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), OutBaroPress, RoutineName );
 
-			// ZoneTempChange is used by HVACManager to determine if the timestep needs to be shortened.
+			// ZoneTempChange is used by HVACManager to determine if the timestep needs to be shortened,
+			// ZoneAirTempChange to determine the air loops it is shortened for
 			{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 			if ( SELECT_CASE_var == Use3rdOrder ) {
 				if ( IsZoneDV( ZoneNum ) ) {
 					if ( ZoneDVMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) ) );
+						ZoneAirTempChange( ZoneNum ) = max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+						ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) );
 					}
 				} else if ( IsZoneUI( ZoneNum ) ) {
 					if ( ZoneUFMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) ) );
+						ZoneAirTempChange( ZoneNum ) = max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+						ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) );
 					}
 				} else {
-					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+					ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) );
 				}
 			} else if ( ( SELECT_CASE_var == UseAnalyticalSolution ) || ( SELECT_CASE_var == UseEulerMethod ) ) {
 				if ( IsZoneDV( ZoneNum ) ) {
 					if ( ZoneDVMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) ) );
+						ZoneAirTempChange( ZoneNum ) = max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+						ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) );
 					}
 				} else if ( IsZoneUI( ZoneNum ) ) {
 					if ( ZoneUFMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) ) );
+						ZoneAirTempChange( ZoneNum ) = max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+						ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) );
 					}
 				} else {
-					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+					ZoneAirTempChange( ZoneNum ) = std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) );
 				}
 			}}
+			ZoneTempChange = max( ZoneTempChange, ZoneAirTempChange( ZoneNum ) );
 
-			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
+			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
 
 		} // ZoneNum
 
@@ -4132,11 +4170,12 @@ namespace ZoneTempPredictorCorrector {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Liesen
 		//       DATE WRITTEN   2000
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, also gather the air system flows for the zone contaminants
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine updates the zone humidities.
+		// This subroutine updates the zone humidities.  The air system and plenum inlet flows it gathers
+		// are also kept, with the CO2 and generic contaminant they carry, for CorrectZoneContaminants.
 
 		// METHODOLOGY EMPLOYED:
 		// na
@@ -4156,6 +4195,8 @@ namespace ZoneTempPredictorCorrector {
 		using DataSurfaces::Surface;
 		using DataSurfaces::HeatTransferModel_HAMT;
 		using DataSurfaces::HeatTransferModel_EMPD;
+		using DataContaminantBalance::Contaminant;
+		using DataContaminantBalance::ZoneSysContFlow;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4188,6 +4229,10 @@ namespace ZoneTempPredictorCorrector {
 		Real64 ExhMassFlowRate;
 		Real64 TotExitMassFlowRate;
 		Real64 ZoneMassFlowRate;
+		Real64 CO2MassFlowRate; // Inlet CO2 flow, for the contaminant balance
+		Real64 GCMassFlowRate; // Inlet generic contaminant flow, for the contaminant balance
+		Real64 ContExhMassFlowRate; // Exhaust flow without the balanced exhaust, for the contaminant balance
+		Real64 ContTotExitMassFlowRate; // Exit flow without the balanced exhaust, for the contaminant balance
 		Real64 SysTimeStepInSeconds;
 		Real64 H2OHtOfVap;
 		Real64 ZoneMult;
@@ -4201,6 +4246,10 @@ namespace ZoneTempPredictorCorrector {
 		ZoneMassFlowRate = 0.0;
 		ExhMassFlowRate = 0.0;
 		TotExitMassFlowRate = 0.0;
+		CO2MassFlowRate = 0.0;
+		GCMassFlowRate = 0.0;
+		ContExhMassFlowRate = 0.0;
+		ContTotExitMassFlowRate = 0.0;
 		ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 		// Check to see if this is a controlled zone
@@ -4234,16 +4283,24 @@ namespace ZoneTempPredictorCorrector {
 			for ( NodeNum = 1; NodeNum <= ZoneEquipConfig( ZoneEquipConfigNum ).NumInletNodes; ++NodeNum ) {
 
 				MoistureMassFlowRate += ( Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).HumRat ) / ZoneMult;
+				if ( Contaminant.CO2Simulation ) {
+					CO2MassFlowRate += ( Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).CO2 ) / ZoneMult;
+				}
+				if ( Contaminant.GenericContamSimulation ) {
+					GCMassFlowRate += ( Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).GenContam ) / ZoneMult;
+				}
 				ZoneMassFlowRate += Node( ZoneEquipConfig( ZoneEquipConfigNum ).InletNode( NodeNum ) ).MassFlowRate / ZoneMult;
 			} // NodeNum
 
 			for ( NodeNum = 1; NodeNum <= ZoneEquipConfig( ZoneEquipConfigNum ).NumExhaustNodes; ++NodeNum ) {
 				ExhMassFlowRate += Node( ZoneEquipConfig( ZoneEquipConfigNum ).ExhaustNode( NodeNum ) ).MassFlowRate / ZoneMult;
 			} // NodeNum
+			ContExhMassFlowRate = ExhMassFlowRate; // The contaminant balance does not take out the balanced exhaust
 			ExhMassFlowRate -= ZoneEquipConfig( ZoneEquipConfigNum ).ZoneExhBalanced; // Balanced exhaust flow assumes there are other flows providing makeup air such as mixing or infiltration, so subtract it here
 
 			if ( ZoneEquipConfig( ZoneEquipConfigNum ).ReturnAirNode > 0 ) {
 				TotExitMassFlowRate = ExhMassFlowRate + Node( ZoneEquipConfig( ZoneEquipConfigNum ).ReturnAirNode ).MassFlowRate / ZoneMult;
+				ContTotExitMassFlowRate = ContExhMassFlowRate + Node( ZoneEquipConfig( ZoneEquipConfigNum ).ReturnAirNode ).MassFlowRate / ZoneMult;
 			}
 
 			// Do the calculations for the plenum zone
@@ -4251,6 +4308,12 @@ namespace ZoneTempPredictorCorrector {
 			for ( NodeNum = 1; NodeNum <= ZoneRetPlenCond( ZoneRetPlenumNum ).NumInletNodes; ++NodeNum ) {
 
 				MoistureMassFlowRate += ( Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).HumRat ) / ZoneMult;
+				if ( Contaminant.CO2Simulation ) {
+					CO2MassFlowRate += ( Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).CO2 ) / ZoneMult;
+				}
+				if ( Contaminant.GenericContamSimulation ) {
+					GCMassFlowRate += ( Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate * Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).GenContam ) / ZoneMult;
+				}
 				ZoneMassFlowRate += Node( ZoneRetPlenCond( ZoneRetPlenumNum ).InletNode( NodeNum ) ).MassFlowRate / ZoneMult;
 			} // NodeNum
 			// add in the leak flow
@@ -4259,25 +4322,54 @@ namespace ZoneTempPredictorCorrector {
 				if ( AirDistUnit( ADUNum ).UpStreamLeak ) {
 					ADUInNode = AirDistUnit( ADUNum ).InletNodeNum;
 					MoistureMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateUpStrLk * Node( ADUInNode ).HumRat ) / ZoneMult;
+					if ( Contaminant.CO2Simulation ) {
+						CO2MassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateUpStrLk * Node( ADUInNode ).CO2 ) / ZoneMult;
+					}
+					if ( Contaminant.GenericContamSimulation ) {
+						GCMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateUpStrLk * Node( ADUInNode ).GenContam ) / ZoneMult;
+					}
 					ZoneMassFlowRate += AirDistUnit( ADUNum ).MassFlowRateUpStrLk / ZoneMult;
 				}
 				if ( AirDistUnit( ADUNum ).DownStreamLeak ) {
 					ADUOutNode = AirDistUnit( ADUNum ).OutletNodeNum;
 					MoistureMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateDnStrLk * Node( ADUOutNode ).HumRat ) / ZoneMult;
+					if ( Contaminant.CO2Simulation ) {
+						CO2MassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateDnStrLk * Node( ADUOutNode ).CO2 ) / ZoneMult;
+					}
+					if ( Contaminant.GenericContamSimulation ) {
+						GCMassFlowRate += ( AirDistUnit( ADUNum ).MassFlowRateDnStrLk * Node( ADUOutNode ).GenContam ) / ZoneMult;
+					}
 					ZoneMassFlowRate += AirDistUnit( ADUNum ).MassFlowRateDnStrLk / ZoneMult;
 				}
 			}
 			// Do not allow exhaust mass flow for a plenum zone
 			ExhMassFlowRate = 0.0;
 			TotExitMassFlowRate = ExhMassFlowRate + ZoneMassFlowRate;
+			ContTotExitMassFlowRate = TotExitMassFlowRate;
 
 		} else if ( ZoneSupPlenumAirFlag ) {
 
 			MoistureMassFlowRate += ( Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate * Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).HumRat ) / ZoneMult;
+			if ( Contaminant.CO2Simulation ) {
+				CO2MassFlowRate += ( Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate * Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).CO2 ) / ZoneMult;
+			}
+			if ( Contaminant.GenericContamSimulation ) {
+				GCMassFlowRate += ( Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate * Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).GenContam ) / ZoneMult;
+			}
 			ZoneMassFlowRate += Node( ZoneSupPlenCond( ZoneSupPlenumNum ).InletNode ).MassFlowRate / ZoneMult;
 			// Do not allow exhaust mass flow for a plenum zone
 			ExhMassFlowRate = 0.0;
 			TotExitMassFlowRate = ExhMassFlowRate + ZoneMassFlowRate;
+			ContTotExitMassFlowRate = TotExitMassFlowRate;
+		}
+
+		// Keep the flows for the zone contaminant balances, which are corrected right after the zone air
+		if ( Contaminant.SimulateContaminants ) {
+			ZoneSysContFlow( ZoneNum ).ZoneMassFlowRate = ZoneMassFlowRate;
+			ZoneSysContFlow( ZoneNum ).ExhMassFlowRate = ContExhMassFlowRate;
+			ZoneSysContFlow( ZoneNum ).TotExitMassFlowRate = ContTotExitMassFlowRate;
+			ZoneSysContFlow( ZoneNum ).CO2MassFlowRate = CO2MassFlowRate;
+			ZoneSysContFlow( ZoneNum ).GCMassFlowRate = GCMassFlowRate;
 		}
 
 		// Calculate hourly humidity ratio from infiltration + humdidity added from latent load + system added moisture
@@ -4464,6 +4556,113 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	void
+	SetupZoneSumsIndexes()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the zone indexed lookups and surface segments used by CalcZoneSums so that the
+		// zone sums do not search the zone equipment and plenum lists, or test every surface of
+		// the zone, on each call.
+
+		// METHODOLOGY EMPLOYED:
+		// The controlled zone equipment configuration and the return and supply plenum of each
+		// zone are stored in arrays indexed by zone.  The heat transfer surfaces of the zones are
+		// stored zone by zone in two contiguous lists, one of opaque surfaces (with their areas)
+		// and one of windows, each with an array of segment starts, so the surface convection sums
+		// are a reduction over one segment per zone.  The zone equipment and plenum input is read
+		// during the first HVAC simulation, so the lookups are rebuilt on each call until the zone
+		// equipment has been simulated once.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using namespace DataSurfaces;
+		using DataZoneEquipment::ZoneEquipConfig;
+		using DataZoneEquipment::ZoneEquipSimulatedOnce;
+		using ZonePlenum::ZoneRetPlenCond;
+		using ZonePlenum::ZoneSupPlenCond;
+		using ZonePlenum::NumZoneReturnPlenums;
+		using ZonePlenum::NumZoneSupplyPlenums;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+		int SurfNum;
+		int NumOpaque;
+		int NumWindows;
+
+		// FLOW:
+		ZoneSumsEquipConfigNum.dimension( NumOfZones, 0 );
+		ZoneSumsRetPlenumNum.dimension( NumOfZones, 0 );
+		ZoneSumsSupPlenumNum.dimension( NumOfZones, 0 );
+
+		// The first configuration, return plenum and supply plenum found for a zone is used
+		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
+			if ( ! Zone( ZoneEquipConfigNum ).IsControlled ) continue;
+			ZoneNum = ZoneEquipConfig( ZoneEquipConfigNum ).ActualZoneNum;
+			if ( ZoneNum >= 1 && ZoneNum <= NumOfZones && ZoneSumsEquipConfigNum( ZoneNum ) == 0 ) ZoneSumsEquipConfigNum( ZoneNum ) = ZoneEquipConfigNum;
+		}
+		for ( int ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
+			ZoneNum = ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum;
+			if ( ZoneNum >= 1 && ZoneNum <= NumOfZones && ZoneSumsRetPlenumNum( ZoneNum ) == 0 ) ZoneSumsRetPlenumNum( ZoneNum ) = ZoneRetPlenumNum;
+		}
+		for ( int ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
+			ZoneNum = ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum;
+			if ( ZoneNum >= 1 && ZoneNum <= NumOfZones && ZoneSumsSupPlenumNum( ZoneNum ) == 0 ) ZoneSumsSupPlenumNum( ZoneNum ) = ZoneSupPlenumNum;
+		}
+
+		// The surfaces do not change during the run, so their segments are only built once
+		if ( ! ZoneOpaqueConvSurfStart.allocated() ) {
+			NumOpaque = 0;
+			NumWindows = 0;
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+					if ( Surface( SurfNum ).Class == SurfaceClass_Window ) {
+						++NumWindows;
+					} else {
+						++NumOpaque;
+					}
+				}
+			}
+			ZoneOpaqueConvSurfStart.dimension( NumOfZones + 1, 1 );
+			ZoneOpaqueConvSurfs.dimension( NumOpaque, 0 );
+			ZoneOpaqueConvSurfArea.dimension( NumOpaque, 0.0 );
+			ZoneWindowConvSurfStart.dimension( NumOfZones + 1, 1 );
+			ZoneWindowConvSurfs.dimension( NumWindows, 0 );
+			NumOpaque = 0;
+			NumWindows = 0;
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				ZoneOpaqueConvSurfStart( ZoneNum ) = NumOpaque + 1;
+				ZoneWindowConvSurfStart( ZoneNum ) = NumWindows + 1;
+				for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+					if ( Surface( SurfNum ).Class == SurfaceClass_Window ) {
+						++NumWindows;
+						ZoneWindowConvSurfs( NumWindows ) = SurfNum;
+					} else {
+						++NumOpaque;
+						ZoneOpaqueConvSurfs( NumOpaque ) = SurfNum;
+						ZoneOpaqueConvSurfArea( NumOpaque ) = Surface( SurfNum ).Area;
+					}
+				}
+			}
+			ZoneOpaqueConvSurfStart( NumOfZones + 1 ) = NumOpaque + 1;
+			ZoneWindowConvSurfStart( NumOfZones + 1 ) = NumWindows + 1;
+		}
+
+		ZoneSumsIndexesSet = ZoneEquipSimulatedOnce;
+
+	}
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -4474,8 +4673,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	)
 	{
 
@@ -4484,6 +4682,7 @@ namespace ZoneTempPredictorCorrector {
 		//       DATE WRITTEN   July 2003
 		//       MODIFIED       Aug 2003, FCW: add SumHA contributions from window frame and divider
 		//                      Aug 2003, CC: change how the reference temperatures are used
+		//                      Oct 2026, zone lookups and surface segments from SetupZoneSumsIndexes
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4536,7 +4735,7 @@ namespace ZoneTempPredictorCorrector {
 		int SurfNum; // Surface number
 		Real64 HA; // Hc*Area
 		Real64 Area; // Effective surface area
-		Real64 RefAirTemp; // Reference air temperature for surface convection calculations
+		Real64 SupplyAirTemp; // Supply air reference temperature for surface convection calculations
 		Real64 ZoneMult;
 		int ADUNum;
 		int ADUInNode;
@@ -4579,30 +4778,14 @@ namespace ZoneTempPredictorCorrector {
 		// Sum all system air flow: SumSysMCp, SumSysMCpT
 		// Check to see if this is a controlled zone
 
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ZoneEquipConfigNum = ZoneSumsEquipConfigNum( ZoneNum );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		// BG feb 2008 repeating this do loop every time seems crazy, store ControlledZoneAirFlag in Zone structure?
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneSumsRetPlenumNum( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSumsSupPlenumNum( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -4674,100 +4857,118 @@ namespace ZoneTempPredictorCorrector {
 		SumSysMCp /= ZoneMult;
 		SumSysMCpT /= ZoneMult;
 
+		// Supply air reference temperature for the ceiling diffuser convection correlation,
+		// a weighted average of the inlet temperatures
+		if ( SumSysMCp > 0.0 ) {
+			SupplyAirTemp = SumSysMCpT / SumSysMCp;
+		} else {
+			// no system flow (yet) so just use last value for inlet node temp, this can happen early in the environment
+			SupplyAirTemp = NodeTemp;
+		}
+
 		// Sum all surface convection: SumHA, SumHATsurf, SumHATref (and additional contributions to SumIntGain)
-		for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+		// Opaque surfaces
+		for ( int SurfIndex = ZoneOpaqueConvSurfStart( ZoneNum ), SurfIndex_end = ZoneOpaqueConvSurfStart( ZoneNum + 1 ); SurfIndex < SurfIndex_end; ++SurfIndex ) {
+			SurfNum = ZoneOpaqueConvSurfs( SurfIndex );
 
-			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+			HA = HConvIn( SurfNum ) * ZoneOpaqueConvSurfArea( SurfIndex );
+			SumHATsurf += HA * TempSurfInTmp( SurfNum );
 
-			HA = 0.0;
-			Area = Surface( SurfNum ).Area; // For windows, this is the glazing area
+			// determine reference air temperature for this surface
+			{ auto const SELECT_CASE_var( Surface( SurfNum ).TAirRef );
+			if ( SELECT_CASE_var == AdjacentAirTemp ) {
+				SumHATref += HA * TempEffBulkAir( SurfNum );
+			} else if ( SELECT_CASE_var == ZoneSupplyAirTemp ) {
+				// check whether this zone is a controlled zone or not
+				if ( ! ControlledZoneAirFlag ) {
+					ShowFatalError( "Zones must be controlled for Ceiling-Diffuser Convection model. No system serves zone " + Zone( ZoneNum ).Name );
+					return;
+				}
+				SumHATref += HA * SupplyAirTemp;
+			} else {
+				// The zone air is the reference temperature (which is to be solved for in CorrectZoneAirTemp).
+				SumHA += HA;
+			}}
 
-			if ( Surface( SurfNum ).Class == SurfaceClass_Window ) {
-				auto const shading_flag( SurfaceWindow( SurfNum ).ShadingFlag );
+		} // SurfIndex
 
-				// Add to the convective internal gains
-				if ( shading_flag == IntShadeOn || shading_flag == IntBlindOn ) {
-					// The shade area covers the area of the glazing plus the area of the dividers.
-					Area += SurfaceWindow( SurfNum ).DividerArea;
-					// If interior shade or blind is present it is assumed that both the convective and IR radiative gain
-					// from the inside surface of the divider goes directly into the zone air -- i.e., the IR radiative
-					// interaction between divider and shade or blind is ignored due to the difficulty of calculating this interaction
-					// at the same time that the interaction between glass and shade is calculated.
-					SumIntGain += SurfaceWindow( SurfNum ).DividerConduction;
-				}
+		// Windows
+		for ( int SurfIndex = ZoneWindowConvSurfStart( ZoneNum ), SurfIndex_end = ZoneWindowConvSurfStart( ZoneNum + 1 ); SurfIndex < SurfIndex_end; ++SurfIndex ) {
+			SurfNum = ZoneWindowConvSurfs( SurfIndex );
 
-				// Other convection term is applicable to equivalent layer window (ASHWAT) model
-				if ( Construct( Surface( SurfNum ).Construction ).WindowTypeEQL ) SumIntGain += SurfaceWindow( SurfNum ).OtherConvHeatGain;
+			HA = 0.0;
+			Area = Surface( SurfNum ).Area; // For windows, this is the glazing area
 
-				// Convective heat gain from natural convection in gap between glass and interior shade or blind
-				if ( shading_flag == IntShadeOn || shading_flag == IntBlindOn ) SumIntGain += SurfaceWindow( SurfNum ).ConvHeatFlowNatural;
+			auto const shading_flag( SurfaceWindow( SurfNum ).ShadingFlag );
+
+			// Add to the convective internal gains
+			if ( shading_flag == IntShadeOn || shading_flag == IntBlindOn ) {
+				// The shade area covers the area of the glazing plus the area of the dividers.
+				Area += SurfaceWindow( SurfNum ).DividerArea;
+				// If interior shade or blind is present it is assumed that both the convective and IR radiative gain
+				// from the inside surface of the divider goes directly into the zone air -- i.e., the IR radiative
+				// interaction between divider and shade or blind is ignored due to the difficulty of calculating this interaction
+				// at the same time that the interaction between glass and shade is calculated.
+				SumIntGain += SurfaceWindow( SurfNum ).DividerConduction;
+			}
 
-				// Convective heat gain from airflow window
-				if ( SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 ) {
-					SumIntGain += SurfaceWindow( SurfNum ).ConvHeatGainToZoneAir;
-					if ( Zone( ZoneNum ).NoHeatToReturnAir ) {
-						SumIntGain += SurfaceWindow( SurfNum ).RetHeatGainToZoneAir;
-						WinHeatGain( SurfNum ) += SurfaceWindow( SurfNum ).RetHeatGainToZoneAir;
-						if ( WinHeatGain( SurfNum ) >= 0.0 ) {
-							WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
-							WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
-						} else {
-							WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
-							WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
-						}
+			// Other convection term is applicable to equivalent layer window (ASHWAT) model
+			if ( Construct( Surface( SurfNum ).Construction ).WindowTypeEQL ) SumIntGain += SurfaceWindow( SurfNum ).OtherConvHeatGain;
+
+			// Convective heat gain from natural convection in gap between glass and interior shade or blind
+			if ( shading_flag == IntShadeOn || shading_flag == IntBlindOn ) SumIntGain += SurfaceWindow( SurfNum ).ConvHeatFlowNatural;
+
+			// Convective heat gain from airflow window
+			if ( SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 ) {
+				SumIntGain += SurfaceWindow( SurfNum ).ConvHeatGainToZoneAir;
+				if ( Zone( ZoneNum ).NoHeatToReturnAir ) {
+					SumIntGain += SurfaceWindow( SurfNum ).RetHeatGainToZoneAir;
+					WinHeatGain( SurfNum ) += SurfaceWindow( SurfNum ).RetHeatGainToZoneAir;
+					if ( WinHeatGain( SurfNum ) >= 0.0 ) {
+						WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
+						WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZoneSec;
+					} else {
+						WinHeatLossRep( SurfNum ) = -WinHeatGain( SurfNum );
+						WinHeatLossRepEnergy( SurfNum ) = WinHeatLossRep( SurfNum ) * TimeStepZoneSec;
 					}
 				}
+			}
 
-				// Add to the surface convection sums
-				if ( SurfaceWindow( SurfNum ).FrameArea > 0.0 ) {
-					// Window frame contribution
-					Real64 const HA_surf( HConvIn( SurfNum ) * SurfaceWindow( SurfNum ).FrameArea * ( 1.0 + SurfaceWindow( SurfNum ).ProjCorrFrIn ) );
-					SumHATsurf += HA_surf * SurfaceWindow( SurfNum ).FrameTempSurfIn;
-					HA += HA_surf;
-				}
-
-				if ( SurfaceWindow( SurfNum ).DividerArea > 0.0 && shading_flag != IntShadeOn && shading_flag != IntBlindOn ) {
-					// Window divider contribution (only from shade or blind for window with divider and interior shade or blind)
-					Real64 const HA_surf( HConvIn( SurfNum ) * SurfaceWindow( SurfNum ).DividerArea * ( 1.0 + 2.0 * SurfaceWindow( SurfNum ).ProjCorrDivIn ) );
-					SumHATsurf += HA_surf * SurfaceWindow( SurfNum ).DividerTempSurfIn;
-					HA += HA_surf;
-				}
+			// Add to the surface convection sums
+			if ( SurfaceWindow( SurfNum ).FrameArea > 0.0 ) {
+				// Window frame contribution
+				Real64 const HA_surf( HConvIn( SurfNum ) * SurfaceWindow( SurfNum ).FrameArea * ( 1.0 + SurfaceWindow( SurfNum ).ProjCorrFrIn ) );
+				SumHATsurf += HA_surf * SurfaceWindow( SurfNum ).FrameTempSurfIn;
+				HA += HA_surf;
+			}
 
-			} // End of check if window
+			if ( SurfaceWindow( SurfNum ).DividerArea > 0.0 && shading_flag != IntShadeOn && shading_flag != IntBlindOn ) {
+				// Window divider contribution (only from shade or blind for window with divider and interior shade or blind)
+				Real64 const HA_surf( HConvIn( SurfNum ) * SurfaceWindow( SurfNum ).DividerArea * ( 1.0 + 2.0 * SurfaceWindow( SurfNum ).ProjCorrDivIn ) );
+				SumHATsurf += HA_surf * SurfaceWindow( SurfNum ).DividerTempSurfIn;
+				HA += HA_surf;
+			}
 
 			HA += HConvIn( SurfNum ) * Area;
 			SumHATsurf += HConvIn( SurfNum ) * Area * TempSurfInTmp( SurfNum );
 
 			// determine reference air temperature for this surface
 			{ auto const SELECT_CASE_var( Surface( SurfNum ).TAirRef );
-			if ( SELECT_CASE_var == ZoneMeanAirTemp ) {
-				// The zone air is the reference temperature (which is to be solved for in CorrectZoneAirTemp).
-				RefAirTemp = MAT( ZoneNum );
-				SumHA += HA;
-			} else if ( SELECT_CASE_var == AdjacentAirTemp ) {
-				RefAirTemp = TempEffBulkAir( SurfNum );
-				SumHATref += HA * RefAirTemp;
+			if ( SELECT_CASE_var == AdjacentAirTemp ) {
+				SumHATref += HA * TempEffBulkAir( SurfNum );
 			} else if ( SELECT_CASE_var == ZoneSupplyAirTemp ) {
 				// check whether this zone is a controlled zone or not
 				if ( ! ControlledZoneAirFlag ) {
 					ShowFatalError( "Zones must be controlled for Ceiling-Diffuser Convection model. No system serves zone " + Zone( ZoneNum ).Name );
 					return;
 				}
-				// determine supply air temperature as a weighted average of the inlet temperatures.
-				if ( SumSysMCp > 0.0 ) {
-					RefAirTemp = SumSysMCpT / SumSysMCp;
-				} else {
-					// no system flow (yet) so just use last value for inlet node temp, this can happen early in the environment
-					RefAirTemp = NodeTemp;
-				}
-				SumHATref += HA * RefAirTemp;
+				SumHATref += HA * SupplyAirTemp;
 			} else {
-				// currently set to mean air temp but should add error warning here
-				RefAirTemp = MAT( ZoneNum );
+				// The zone air is the reference temperature (which is to be solved for in CorrectZoneAirTemp).
 				SumHA += HA;
 			}}
 
-		} // SurfNum
+		} // SurfIndex
 
 	}
 
@@ -4783,15 +4984,14 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	)
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Brent Griffith
 		//       DATE WRITTEN   Feb 2008
-		//       MODIFIED
+		//       MODIFIED       Oct 2026, zone lookups from SetupZoneSumsIndexes
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4897,30 +5097,14 @@ namespace ZoneTempPredictorCorrector {
 		// Sum all system air flow: reusing how SumSysMCp, SumSysMCpT are calculated in CalcZoneSums
 		// Check to see if this is a controlled zone
 
-		// CR 7384 continuation needed below.  eliminate do loop for speed and clarity
-		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ZoneEquipConfigNum = ZoneSumsEquipConfigNum( ZoneNum );
+		ControlledZoneAirFlag = ( ZoneEquipConfigNum > 0 );
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneSumsRetPlenumNum( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSumsSupPlenumNum( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
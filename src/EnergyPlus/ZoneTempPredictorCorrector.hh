@@ -96,6 +96,17 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< Real64 > ZoneTempOscillate;
 	extern Real64 AnyZoneTempOscillate;
 
+	// Zone indexes and surface segments used by CalcZoneSums, built by SetupZoneSumsIndexes
+	extern bool ZoneSumsIndexesSet; // Indexes are final (the zone equipment and plenum input has been read)
+	extern Array1D_int ZoneSumsEquipConfigNum; // Controlled zone equipment configuration of each zone (0 if none)
+	extern Array1D_int ZoneSumsRetPlenumNum; // Return plenum of each zone (0 if none)
+	extern Array1D_int ZoneSumsSupPlenumNum; // Supply plenum of each zone (0 if none)
+	extern Array1D_int ZoneOpaqueConvSurfStart; // Start of each zone's segment of ZoneOpaqueConvSurfs (NumOfZones+1 entries)
+	extern Array1D_int ZoneOpaqueConvSurfs; // Opaque heat transfer surfaces, grouped by zone
+	extern Array1D< Real64 > ZoneOpaqueConvSurfArea; // Area of the surfaces of ZoneOpaqueConvSurfs
+	extern Array1D_int ZoneWindowConvSurfStart; // Start of each zone's segment of ZoneWindowConvSurfs (NumOfZones+1 entries)
+	extern Array1D_int ZoneWindowConvSurfs; // Window heat transfer surfaces, grouped by zone
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Types
@@ -260,6 +271,9 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & newVal4 // unused 1208
 	);
 
+	void
+	SetupZoneSumsIndexes();
+
 	void
 	CalcZoneSums(
 		int const ZoneNum, // Zone number
@@ -270,8 +284,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	);
 
 	void
@@ -286,8 +299,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	);
 
 	bool
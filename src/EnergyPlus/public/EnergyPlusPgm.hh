@@ -20,4 +20,29 @@
 	void ENERGYPLUSLIB_API
 	StoreMessageCallback( void ( *f )( std::string const & ) );
 
+	// The progress callbacks are called when the percent progress or the environment changes.  The
+	// progress event callback gets the percent progress, environment number, current simulation day
+	// and total simulation days.  With the AsyncDisplay environment variable set, the message
+	// callback is called from a display thread, in batches, in the order of the messages.
+
+	void ENERGYPLUSLIB_API
+	StoreProgressEventCallback( void ( *f )( int const, int const, int const, int const ) );
+
+	// Report value streaming: the dictionary callback is called for each report variable and meter
+	// as it is set up, with its report ID, reporting interval (-1 each call, 0 timestep, 1 hourly,
+	// 2 daily, 3 monthly, 4 run period), key, name and units.  It returns 0 to ignore the item,
+	// 1 to have its values passed to the value callback, or 2 to have them passed to the value
+	// callback only (leaving them out of the eso, mtr and sql output).  The time stamp callback is
+	// called before the values of each reporting interval with the reporting interval, environment
+	// number, day of simulation, month, day of month, hour and end minute (0 where not defined).
+
+	void ENERGYPLUSLIB_API
+	StoreReportDictionaryCallback( int ( *f )( int const, int const, std::string const &, std::string const &, std::string const & ) );
+
+	void ENERGYPLUSLIB_API
+	StoreReportTimeStampCallback( void ( *f )( int const, int const, int const, int const, int const, int const, double const ) );
+
+	void ENERGYPLUSLIB_API
+	StoreReportValueCallback( void ( *f )( int const, double const ) );
+
 #endif
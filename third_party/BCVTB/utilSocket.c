@@ -119,6 +119,9 @@ derivative works thereof, in binary and source code form.
 
 FILE *f1 = NULL; 
 #define HEADER_LENGTH 54 // =10 + 4*(10+1);
+#define BINARY_FRAME_MAGIC 0x42435642 // "BCVB"
+#define BINARY_FRAME_INTS 4 // magic, version, flag, number of doubles
+#define BINARY_FRAME_HEADER_LENGTH (BINARY_FRAME_INTS * 4 + 8)
 int REQUIRED_READ_LENGTH  = 0;
 int REQUIRED_WRITE_LENGTH = 0;
 int SERVER_VERSION = 0; 
@@ -1186,6 +1189,213 @@ int exchangedoubleswithsocketFMU(const int *sockfd,
 				booValRea);
 }
 
+/////////////////////////////////////////////////////////////////
+/// Writes a character buffer completely to the socket.
+///
+/// This method is called by \c writebinarytosocket and
+/// \c readbinaryfromsocket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The buffer to write.
+///\param bufLen The number of characters to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int writeallsocket(const int *sockfd, const char *buffer, const int bufLen){
+  int retVal;
+  int chaSta = 0;
+  while ( chaSta < bufLen ){
+#ifdef _MSC_VER
+    retVal = send(*sockfd, &buffer[chaSta], bufLen - chaSta, 0);
+#else
+    retVal = write(*sockfd, &buffer[chaSta], bufLen - chaSta);
+#endif
+    if ( retVal <= 0 ){
+      fprintf(stderr, "Error: Unspecified error when writing to socket.\n");
+      return -1;
+    }
+    chaSta += retVal;
+  }
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Reads a given number of characters from the socket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The buffer into which the characters will be written.
+///\param bufLen The number of characters to read.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int readallsocket(const int *sockfd, char *buffer, const int bufLen){
+  int retVal;
+  int chaSta = 0;
+  while ( chaSta < bufLen ){
+#ifdef _MSC_VER
+    retVal = recv(*sockfd, &buffer[chaSta], bufLen - chaSta, 0);
+#else
+    retVal = read(*sockfd, &buffer[chaSta], bufLen - chaSta);
+#endif
+    if ( retVal == 0 ){
+      fprintf(stderr, "Error: The server closed the socket while the client was reading.\n");
+      return -1;
+    }
+    if ( retVal < 0 ){
+      fprintf(stderr, "Error: Unspecified error when reading from socket.\n");
+      return retVal;
+    }
+    chaSta += retVal;
+  }
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Writes a binary frame to the socket.
+///
+/// A binary frame is the header
+/// (\c BINARY_FRAME_MAGIC, main version number, flag and number of doubles
+/// as 4 byte integers, followed by the simulation time as an 8 byte double)
+/// followed by the double values, all in the byte order of the client.
+/// The frame is written with one call to \c send, rather than being
+/// formatted as text as in \c writetosocket.
+/// The server needs to use the same framing.
+///
+///\param sockfd Socket file descripter
+///\param flaWri Communication flag to write to the socket stream.
+///\param nDblWri Number of double values to write.
+///\param simTimWri Current simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int writebinarytosocket(const int *sockfd,
+			const int *flaWri, const int *nDblWri,
+			double *simTimWri, double dblValWri[]){
+  int retVal;
+  int head[BINARY_FRAME_INTS];
+  int bufLen = BINARY_FRAME_HEADER_LENGTH + (*nDblWri) * (int)sizeof(double);
+  char *buffer;
+
+  if (*sockfd < 0 ){
+    fprintf(stderr, "Error: Called write to socket with negative socket number.\n");
+    fprintf(stderr, "       sockfd : %d\n",  *sockfd);
+    return -1;
+  }
+  buffer = malloc(bufLen);
+  if (buffer == NULL) {
+    perror("malloc failed in writebinarytosocket.");
+    return -1;
+  }
+  head[0] = BINARY_FRAME_MAGIC;
+  head[1] = getmainversionnumber();
+  head[2] = *flaWri;
+  head[3] = *nDblWri;
+  memcpy(buffer, head, sizeof(head));
+  memcpy(&buffer[sizeof(head)], simTimWri, sizeof(double));
+  if ( *nDblWri > 0 )
+    memcpy(&buffer[BINARY_FRAME_HEADER_LENGTH], dblValWri, (*nDblWri) * sizeof(double));
+  retVal = writeallsocket(sockfd, buffer, bufLen);
+  free(buffer);
+  return retVal;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Reads a binary frame from the socket.
+///
+/// The frame is described in \c writebinarytosocket.
+///
+///\param sockfd Socket file descripter
+///\param flaRea Communication flag read from the socket stream.
+///\param nDblRea Number of double values read.
+///\param nDblMax Size of \c dblValRea.
+///\param simTimRea Current simulation time in seconds read from socket.
+///\param dblValRea Double values read from socket.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int readbinaryfromsocket(const int *sockfd,
+			 int *flaRea, int *nDblRea, const int *nDblMax,
+			 double *simTimRea, double dblValRea[]){
+  int retVal;
+  int head[BINARY_FRAME_INTS];
+  char buffer[BINARY_FRAME_HEADER_LENGTH];
+
+  retVal = readallsocket(sockfd, buffer, BINARY_FRAME_HEADER_LENGTH);
+  if ( retVal != 0 )
+    return retVal;
+  memcpy(head, buffer, sizeof(head));
+  if ( head[0] != BINARY_FRAME_MAGIC ){
+    fprintf(stderr, "Error: Received a frame that is not a binary BCVTB frame.\n");
+    fprintf(stderr, "       Check that the server uses the binary framing and the byte order of the client.\n");
+    return -1;
+  }
+  if ( head[1] != getmainversionnumber() ){
+    fprintf(stderr, "Error: Server sent version number %d.\n", head[1]);
+    fprintf(stderr, "       Client only supports version number %d.\n", getmainversionnumber());
+    return -1;
+  }
+  if ( head[3] < 0 || head[3] > *nDblMax ){
+    fprintf(stderr, "Error: Server sent %d double values, client can receive at most %d.\n", head[3], *nDblMax);
+    return -1;
+  }
+  *flaRea = head[2];
+  *nDblRea = head[3];
+  memcpy(simTimRea, &buffer[sizeof(head)], sizeof(double));
+  if ( *nDblRea > 0 )
+    retVal = readallsocket(sockfd, (char *)dblValRea, (*nDblRea) * (int)sizeof(double));
+  return retVal;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Exchanges data with the socket using binary frames.
+///
+/// This method differs from \c exchangedoubleswithsocket in that
+/// the values are not formatted as text. See \c writebinarytosocket
+/// for the frame layout.
+///\param sockfd Socket file descripter
+///\param flaWri Communication flag to write to the socket stream.
+///\param flaRea Communication flag read from the socket stream.
+///\param nDblWri Number of double values to write.
+///\param nDblRea Number of double values to read.
+///\param nDblMax Size of \c dblValRea.
+///\param simTimWri Current simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\param simTimRea Current simulation time in seconds read from socket.
+///\param dblValRea Double values read from socket.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int exchangedoubleswithsocketbinary(const int *sockfd,
+		       const int *flaWri, int *flaRea,
+		       const int *nDblWri,
+		       int *nDblRea, const int *nDblMax,
+		       double *simTimWri,
+		       double dblValWri[],
+		       double *simTimRea,
+		       double dblValRea[]){
+  int retVal;
+  retVal = writebinarytosocket(sockfd, flaWri, nDblWri, simTimWri, dblValWri);
+  if ( retVal == 0 )
+    retVal = readbinaryfromsocket(sockfd, flaRea, nDblRea, nDblMax, simTimRea, dblValRea);
+  return retVal;
+}
+
+/////////////////////////////////////////////////////////////////
+/// Writes a message flag to the socket stream as a binary frame.
+///
+/// This is \c sendclientmessage for clients that use
+/// \c exchangedoubleswithsocketbinary.
+///
+///\param sockfd Socket file descripter
+///\param flaWri Flag to be sent to the BCVTB
+int sendclientmessagebinary(const int *sockfd, const int *flaWri){
+  int zI = 0;
+  int flaRea = 0;
+  int nDblRea = 0;
+  int retVal = 0;
+  double zD = 0;
+
+  if ( *sockfd >= 0 ){
+    retVal = writebinarytosocket(sockfd, flaWri, &zI, &zD, NULL);
+    if ( retVal == 0 ){
+      // No error. Wait for acknowledgement, as in sendclientmessage.
+      retVal = readbinaryfromsocket(sockfd, &flaRea, &nDblRea, &zI, &zD, NULL);
+    }
+  }
+  return retVal;
+}
+
 ///////////////////////////////////////////////////////////
 /// Closes the inter process communication socket.
 ///
@@ -455,6 +455,88 @@ int exchangedoubleswithsocketFMU(const int *sockfd,
 				  const int *flaExport);
 
 
+/////////////////////////////////////////////////////////////////
+/// Writes a character buffer completely to the socket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The buffer to write.
+///\param bufLen The number of characters to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int writeallsocket(const int *sockfd, const char *buffer, const int bufLen);
+
+/////////////////////////////////////////////////////////////////
+/// Reads a given number of characters from the socket.
+///
+///\param sockfd The socket file descripter.
+///\param buffer The buffer into which the characters will be written.
+///\param bufLen The number of characters to read.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int readallsocket(const int *sockfd, char *buffer, const int bufLen);
+
+/////////////////////////////////////////////////////////////////
+/// Writes a binary frame to the socket.
+///
+/// A binary frame is the header
+/// (magic number, main version number, flag and number of doubles
+/// as 4 byte integers, followed by the simulation time as an 8 byte double)
+/// followed by the double values, all in the byte order of the client.
+///
+///\param sockfd Socket file descripter
+///\param flaWri Communication flag to write to the socket stream.
+///\param nDblWri Number of double values to write.
+///\param simTimWri Current simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int writebinarytosocket(const int *sockfd,
+			const int *flaWri, const int *nDblWri,
+			double *simTimWri, double dblValWri[]);
+
+/////////////////////////////////////////////////////////////////
+/// Reads a binary frame from the socket.
+///
+///\param sockfd Socket file descripter
+///\param flaRea Communication flag read from the socket stream.
+///\param nDblRea Number of double values read.
+///\param nDblMax Size of \c dblValRea.
+///\param simTimRea Current simulation time in seconds read from socket.
+///\param dblValRea Double values read from socket.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int readbinaryfromsocket(const int *sockfd,
+			 int *flaRea, int *nDblRea, const int *nDblMax,
+			 double *simTimRea, double dblValRea[]);
+
+/////////////////////////////////////////////////////////////////
+/// Exchanges data with the socket using binary frames.
+///
+/// This method differs from \c exchangedoubleswithsocket in that
+/// the values are not formatted as text.
+///\param sockfd Socket file descripter
+///\param flaWri Communication flag to write to the socket stream.
+///\param flaRea Communication flag read from the socket stream.
+///\param nDblWri Number of double values to write.
+///\param nDblRea Number of double values to read.
+///\param nDblMax Size of \c dblValRea.
+///\param simTimWri Current simulation time in seconds to write.
+///\param dblValWri Double values to write.
+///\param simTimRea Current simulation time in seconds read from socket.
+///\param dblValRea Double values read from socket.
+///\return 0 if no error occurred, or a negative value if an error occured.
+int exchangedoubleswithsocketbinary(const int *sockfd,
+			      const int *flaWri, int *flaRea,
+			      const int *nDblWri,
+			      int *nDblRea, const int *nDblMax,
+			      double *simTimWri,
+			      double dblValWri[],
+			      double *simTimRea,
+			      double dblValRea[]);
+
+/////////////////////////////////////////////////////////////////
+/// Writes a message flag to the socket stream as a binary frame.
+///
+///\param sockfd Socket file descripter
+///\param flaWri Flag to be sent to the BCVTB
+int sendclientmessagebinary(const int *sockfd, const int *flaWri);
+
 ///////////////////////////////////////////////////////////
 /// Closes the inter process communication socket.
 ///
@@ -48,6 +48,12 @@ DllExport int DElight2(
 	int iEndDay,						/* Ending month of run period */
 	int iYear);							/* 4 digit year of run period */
 
+DllExport int	DElightLoadBldg4EPlus(
+	char sInputName[MAX_CHAR_LINE+1],	/* input file name */
+	BLDG* bldg_ptr,							/* bldg data structure */
+	LIB* lib_ptr,							/* library data structure */
+    ofstream* pofdmpfile);              // ptr to Error message dump file
+
 DllExport int	DElightDaylightFactors4EPlus(
 	char sInputName[MAX_CHAR_LINE+1],	/* input file name */
 	char sOutputName[MAX_CHAR_LINE+1],	/* output file name */
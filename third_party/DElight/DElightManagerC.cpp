@@ -257,6 +257,110 @@ catch(char* cThrownMsg) {
 return;
 }
 
+/******************************** subroutine delightloadbuilding *******************************/
+/* Loads the DElight bldg and library data from the DElight input file without calculating the */
+/* daylight factors, which EnergyPlus then restores with delightsetdaylightfactors. */
+/* Exported subroutine for EnergyPlus preprocessing call to DElight when the factors are cached. */
+/* See corresponding Interface Subroutine in DElightManagerF.cc EnergyPlus module. */
+/******************************** subroutine delightloadbuilding *******************************/
+extern "C" DllExport void delightloadbuilding(int* piErrorFlag)  // return Error Flag from DElight to EPlus
+{
+    // Open Error message dump file
+    ofdmpfile.open("eplusout.delightdfdmp");
+
+    // Check for successful opening of Error message dump file.
+	if(!ofdmpfile)
+	{
+        // Set ErrorFlag return value for interpretation within EPlus
+        *piErrorFlag = -1;
+		return;
+	}
+
+try {
+
+    char cFullInputFilename[250+1];
+
+    // Create filename for DElight input file that will default to current working directory.
+    strcpy( cFullInputFilename, "eplusout.delightin" );
+
+    // Load the DElight bldg and library data structures
+    int iErrorFlag = DElightLoadBldg4EPlus(cFullInputFilename,	/* input file name */
+                                           &bldg,		/* pointer to DElight bldg data structure */
+                                           &lib,		/* pointer to DElight library data structure */
+                                           &ofdmpfile);    // Error message dump file
+    // Check returned ErrorFlag value
+    if (iErrorFlag < 0) {
+        // Set appropriate ErrorFlag return value for interpretation within EPlus
+        *piErrorFlag = iErrorFlag;
+    }
+}   // end try
+catch(...) {
+    // Set appropriate ErrorFlag return value for interpretation within EPlus
+    *piErrorFlag = -2;
+}
+
+    // Close Error message dump file
+    ofdmpfile.close();
+
+    return;
+}
+
+/******************************** function delightnumdaylightfactors *******************************/
+/* Returns the number of reference point daylight factors held in the DElight bldg data structure, */
+/* the length of the arrays passed to delightgetdaylightfactors and delightsetdaylightfactors. */
+/******************************** function delightnumdaylightfactors *******************************/
+extern "C" DllExport int delightnumdaylightfactors()
+{
+    int iNumFactors = 0;
+    for (int iZone=0; iZone<bldg.nzones; iZone++) {
+        iNumFactors += bldg.zone[iZone]->nrefpts * (1 + 2 * NPHS * NTHS);
+    }
+    return iNumFactors;
+}
+
+/******************************** subroutine delightgetdaylightfactors *******************************/
+/* Copies the reference point daylight factors of the DElight bldg data structure to an array: */
+/* for each zone and reference point, the overcast sky factor, then the clear sky factors and the */
+/* clear sun factors for each sun altitude and azimuth. */
+/******************************** subroutine delightgetdaylightfactors *******************************/
+extern "C" DllExport void delightgetdaylightfactors(double* pdFactors)
+{
+    for (int iZone=0; iZone<bldg.nzones; iZone++) {
+        for (int irp=0; irp<bldg.zone[iZone]->nrefpts; irp++) {
+            REFPT* refpt_ptr = bldg.zone[iZone]->ref_pt[irp];
+            *pdFactors++ = refpt_ptr->dfskyo;
+            for (int iphs=0; iphs<NPHS; iphs++) {
+                for (int iths=0; iths<NTHS; iths++) *pdFactors++ = refpt_ptr->dfsky[iphs][iths];
+            }
+            for (int iphs=0; iphs<NPHS; iphs++) {
+                for (int iths=0; iths<NTHS; iths++) *pdFactors++ = refpt_ptr->dfsun[iphs][iths];
+            }
+        }
+    }
+    return;
+}
+
+/******************************** subroutine delightsetdaylightfactors *******************************/
+/* Restores the reference point daylight factors of the DElight bldg data structure from an array */
+/* filled by delightgetdaylightfactors. */
+/******************************** subroutine delightsetdaylightfactors *******************************/
+extern "C" DllExport void delightsetdaylightfactors(double* pdFactors)
+{
+    for (int iZone=0; iZone<bldg.nzones; iZone++) {
+        for (int irp=0; irp<bldg.zone[iZone]->nrefpts; irp++) {
+            REFPT* refpt_ptr = bldg.zone[iZone]->ref_pt[irp];
+            refpt_ptr->dfskyo = *pdFactors++;
+            for (int iphs=0; iphs<NPHS; iphs++) {
+                for (int iths=0; iths<NTHS; iths++) refpt_ptr->dfsky[iphs][iths] = *pdFactors++;
+            }
+            for (int iphs=0; iphs<NPHS; iphs++) {
+                for (int iths=0; iths<NTHS; iths++) refpt_ptr->dfsun[iphs][iths] = *pdFactors++;
+            }
+        }
+    }
+    return;
+}
+
 /******************************** subroutine delightelecltgctrl *******************************/
 /* Calls the DElight daylighting interior illuminance and electric lighting control routines from the DElight DLL. */
 /* Exported subroutine for EnergyPlus timestep call to DElight. */
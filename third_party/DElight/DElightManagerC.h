@@ -35,6 +35,14 @@ void writewndo(const char* instring, std::string sfpflg);
 extern "C" DllExport void delightdaylightcoefficients(double dBldgLat, 
                                                       int* piErrorFlag); 
 
+extern "C" DllExport void delightloadbuilding(int* piErrorFlag);
+
+extern "C" DllExport int delightnumdaylightfactors();
+
+extern "C" DllExport void delightgetdaylightfactors(double* pdFactors);
+
+extern "C" DllExport void delightsetdaylightfactors(double* pdFactors);
+
 extern "C" DllExport void delightelecltgctrl(int iNameLength,
 								   char* cZoneName, 
 								   double dBldgLat, 
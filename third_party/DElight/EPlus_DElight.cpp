@@ -82,32 +82,18 @@ namespace BGL = BldgGeomLib;
 #include "WxTMY2.h"
 #include "W4Lib.h"
 
-/******************************** subroutine DElightDaylightFactors4EPlus *******************************/
-// Called from DElightManagerC.cpp
-/* Calls key daylighting simulation modules necessary for calculating a set of daylight factors for EnergyPlus. */
-/******************************** subroutine DElightDaylightFactors4EPlus *******************************/
-DllExport int	DElightDaylightFactors4EPlus(
+/******************************** subroutine DElightLoadBldg4EPlus *******************************/
+// Called from DElightDaylightFactors4EPlus and DElightManagerC.cpp
+/* Loads the bldg and library data structures from an EnergyPlus generated DElight input file, */
+/* without calculating daylight factors. */
+/******************************** subroutine DElightLoadBldg4EPlus *******************************/
+DllExport int	DElightLoadBldg4EPlus(
 	char sInputName[MAX_CHAR_LINE+1],	/* input file name */
-	char sOutputName[MAX_CHAR_LINE+1],	/* output file name */
 	BLDG* bldg_ptr,							/* bldg data structure */
 	LIB* lib_ptr,							/* library data structure */
-	int iIterations,					/* Number of radiosity iterations */
-	double dCloudFraction,				/* fraction of sky covered by clouds (0.0=clear 1.0=overcast) */
-	int iSurfNodes,						/* Desired total number of surface nodes */
-	int iWndoNodes,						/* Desired total number of window nodes */
-	int iNumAlts,						/* Number of daylight factor sun altitude angles */
-	double dMinAlt,						/* Minimum daylight factor sun altitude angle */
-	int iNumAzms,						/* Number of daylight factor sun azimuth angles */
-	double dMinAzm,						/* Minimum daylight factor sun azimuth angle */
     ofstream* pofdmpfile)               // ptr to Error message dump file
 {
 	FILE *infile;						/* input file pointer */
-	FILE *outfile;						/* output file pointer */
-	int err;	// error return value from fopen_s
-	SUN_DATA sun_data;	/* sun data structure */
-
-    // Init return value  
-    int iReturnVal = 0;
 
 	/* initialize BLDG and LIB structures */
 	struct_init("BLDG",(char *)bldg_ptr);
@@ -155,6 +141,39 @@ DllExport int	DElightDaylightFactors4EPlus(
 	/* Close input file after successful read. */
 	fclose(infile);
 
+	return(0);
+}
+
+/******************************** subroutine DElightDaylightFactors4EPlus *******************************/
+// Called from DElightManagerC.cpp
+/* Calls key daylighting simulation modules necessary for calculating a set of daylight factors for EnergyPlus. */
+/******************************** subroutine DElightDaylightFactors4EPlus *******************************/
+DllExport int	DElightDaylightFactors4EPlus(
+	char sInputName[MAX_CHAR_LINE+1],	/* input file name */
+	char sOutputName[MAX_CHAR_LINE+1],	/* output file name */
+	BLDG* bldg_ptr,							/* bldg data structure */
+	LIB* lib_ptr,							/* library data structure */
+	int iIterations,					/* Number of radiosity iterations */
+	double dCloudFraction,				/* fraction of sky covered by clouds (0.0=clear 1.0=overcast) */
+	int iSurfNodes,						/* Desired total number of surface nodes */
+	int iWndoNodes,						/* Desired total number of window nodes */
+	int iNumAlts,						/* Number of daylight factor sun altitude angles */
+	double dMinAlt,						/* Minimum daylight factor sun altitude angle */
+	int iNumAzms,						/* Number of daylight factor sun azimuth angles */
+	double dMinAzm,						/* Minimum daylight factor sun azimuth angle */
+    ofstream* pofdmpfile)               // ptr to Error message dump file
+{
+	FILE *outfile;						/* output file pointer */
+	int err;	// error return value from fopen_s
+	SUN_DATA sun_data;	/* sun data structure */
+
+    // Init return value  
+    int iReturnVal = 0;
+
+	/* Load BLDG and LIB structures from the input file. */
+	int iLoadReturnVal = DElightLoadBldg4EPlus(sInputName,bldg_ptr,lib_ptr,pofdmpfile);
+	if (iLoadReturnVal < 0) return(iLoadReturnVal);
+
 	/* Calculate geometrical values required for DF calcs. */
 	if (iSurfNodes > MAX_SURF_NODES) iSurfNodes = MAX_SURF_NODES;
 	if (iWndoNodes > MAX_WNDO_NODES) iWndoNodes = MAX_WNDO_NODES;
@@ -590,10 +590,8 @@ fmiStatus fmiEPlusGetReal(fmiComponent *fmuInstance, const fmiValueReference val
 
 		fmiStatus fmiFlag;
 
-		// get index value
-		_c->index = *index;
-
-		fmiFlag = fmuInstances[_c->index]->getReal(*fmuInstance, valRef, *numOutputs, outValue);
+		// use the index directly rather than through the shared _c, instances may be stepped in parallel
+		fmiFlag = fmuInstances[*index]->getReal(*fmuInstance, valRef, *numOutputs, outValue);
 		if (fmiFlag > fmiWarning) {
 			printf("Error: failed to get all outputs in fmiEPlusGetReal!\n");
 			return fmiError;
@@ -619,10 +617,8 @@ fmiStatus fmiEPlusSetReal(fmiComponent *fmuInstance, const fmiValueReference val
 
 		fmiStatus fmiFlag;
 
-		// get index value
-		_c->index = *index;
-
-		fmiFlag = fmuInstances[_c->index]->setReal(*fmuInstance, valRef, *numInputs, inpVal);
+		// use the index directly rather than through the shared _c, instances may be stepped in parallel
+		fmiFlag = fmuInstances[*index]->setReal(*fmuInstance, valRef, *numInputs, inpVal);
 		if (fmiFlag > fmiWarning) {
 			printf("Error: failed to set all inputs in fmiEPlusSetReal!\n");
 			return fmiError;
@@ -653,10 +649,8 @@ fmiStatus fmiEPlusDoStep(fmiComponent *fmuInstance, fmiReal *curCommPoint,
 		else
 			newStepBoolean = fmiTrue;
 
-		// get index value
-		_c->index = *index;
-
-		fmiFlag = fmuInstances[_c->index]->doStep(*fmuInstance, *curCommPoint, *commStepSize, newStepBoolean);
+		// use the index directly rather than through the shared _c, instances may be stepped in parallel
+		fmiFlag = fmuInstances[*index]->doStep(*fmuInstance, *curCommPoint, *commStepSize, newStepBoolean);
 		if (fmiFlag > fmiWarning) {
 			printf("Error: failed to do Step in fmiEPlusDoStep!\n");
 			return fmiError;
@@ -0,0 +1,147 @@
+// EnergyPlus::AirflowNetworkSolver Micro-Benchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/AirflowNetworkSolver.hh>
+#include <EnergyPlus/DataAirflowNetwork.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::AirflowNetworkSolver;
+using namespace EnergyPlus::DataAirflowNetwork;
+
+namespace {
+
+	int const ZonesPerFloor( 8 );
+
+	// Multizone network of a building with eight zones in a row on each floor. Every zone has a crack to a
+	// windward and a leeward exterior node of its floor and to the zones beside and above it.
+	void
+	SetUpNetwork( int const NumZones )
+	{
+		int const NumFloors( ( NumZones + ZonesPerFloor - 1 ) / ZonesPerFloor );
+		int const NumNodes( NumZones + 2 * NumFloors );
+		int NumLinks( 0 );
+		for ( int ZoneNum = 1; ZoneNum <= NumZones; ++ZoneNum ) {
+			NumLinks += 2;
+			if ( ZoneNum % ZonesPerFloor != 0 && ZoneNum < NumZones ) ++NumLinks;
+			if ( ZoneNum + ZonesPerFloor <= NumZones ) ++NumLinks;
+		}
+
+		AirflowNetworkNumOfNodes = NumNodes;
+		AirflowNetworkNumOfLinks = NumLinks;
+		AirflowNetworkNumOfComps = 1;
+		NumOfNodesMultiZone = NumNodes;
+		NumOfLinksMultiZone = NumLinks;
+
+		AirflowNetworkNodeData.deallocate();
+		AirflowNetworkNodeData.allocate( NumNodes );
+		AirflowNetworkNodeSimu.deallocate();
+		AirflowNetworkNodeSimu.allocate( NumNodes );
+		for ( int NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			auto & node( AirflowNetworkNodeData( NodeNum ) );
+			auto & nodeSimu( AirflowNetworkNodeSimu( NodeNum ) );
+			nodeSimu.WZ = 0.008;
+			if ( NodeNum <= NumZones ) {
+				int const Floor( ( NodeNum - 1 ) / ZonesPerFloor );
+				node.NodeTypeNum = 0;
+				node.NodeHeight = 3.0 * Floor + 1.5;
+				nodeSimu.TZ = 21.0 + 0.5 * Floor;
+				nodeSimu.PZ = 0.0;
+			} else {
+				int const ExtNum( NodeNum - NumZones );
+				int const Floor( ( ExtNum - 1 ) / 2 );
+				bool const Windward( ExtNum % 2 == 1 );
+				node.NodeTypeNum = 1;
+				node.ExtNodeNum = ExtNum;
+				node.NodeHeight = 3.0 * Floor + 1.5;
+				nodeSimu.TZ = 5.0;
+				nodeSimu.PZ = ( Windward ? 6.0 : -4.0 ) * ( 1.0 + 0.05 * Floor );
+			}
+		}
+
+		AirflowNetworkCompData.deallocate();
+		AirflowNetworkCompData.allocate( 1 );
+		AirflowNetworkCompData( 1 ).CompTypeNum = CompTypeNum_SCR;
+		AirflowNetworkCompData( 1 ).TypeNum = 1;
+		MultizoneSurfaceCrackData.deallocate();
+		MultizoneSurfaceCrackData.allocate( 1 );
+		MultizoneSurfaceCrackData( 1 ).FlowCoef = 0.001;
+		MultizoneSurfaceCrackData( 1 ).FlowExpo = 0.65;
+		MultizoneSurfaceCrackData( 1 ).StandardT = 20.0;
+		MultizoneSurfaceCrackData( 1 ).StandardP = 101325.0;
+		MultizoneSurfaceCrackData( 1 ).StandardW = 0.0;
+
+		AirflowNetworkLinkageData.deallocate();
+		AirflowNetworkLinkageData.allocate( NumLinks );
+		MultizoneSurfaceData.deallocate();
+		MultizoneSurfaceData.allocate( NumLinks );
+		int LinkNum( 0 );
+		auto AddLink = [ & ]( int const From, int const To ) {
+			auto & link( AirflowNetworkLinkageData( ++LinkNum ) );
+			link.NodeNums( 1 ) = From;
+			link.NodeNums( 2 ) = To;
+			link.NodeHeights( 1 ) = 0.0;
+			link.NodeHeights( 2 ) = 0.0;
+			link.CompNum = 1;
+			MultizoneSurfaceData( LinkNum ).Factor = 1.0;
+		};
+		for ( int ZoneNum = 1; ZoneNum <= NumZones; ++ZoneNum ) {
+			int const Floor( ( ZoneNum - 1 ) / ZonesPerFloor );
+			AddLink( ZoneNum, NumZones + 2 * Floor + 1 );
+			AddLink( ZoneNum, NumZones + 2 * Floor + 2 );
+			if ( ZoneNum % ZonesPerFloor != 0 && ZoneNum < NumZones ) AddLink( ZoneNum, ZoneNum + 1 );
+			if ( ZoneNum + ZonesPerFloor <= NumZones ) AddLink( ZoneNum, ZoneNum + ZonesPerFloor );
+		}
+
+		AirflowNetworkSimu.InitFlag = 0;
+		AirflowNetworkSimu.MaxIteration = 500;
+		AirflowNetworkSimu.RelTol = 1.0e-4;
+		AirflowNetworkSimu.AbsTol = 1.0e-6;
+		AirflowNetworkSimu.ConvLimit = -0.5;
+		AirflowNetworkSimu.MaxPressure = 500.0;
+
+		AirflowNetworkLinkSimu.deallocate();
+		AirflowNetworkLinkSimu.allocate( NumLinks );
+		AllocateAirflowNetworkData();
+
+		// Node air properties and link pressures as AIRMOV sets them before solving
+		for ( int NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			RHOZ( NodeNum ) = Psychrometrics::PsyRhoAirFnPbTdbW( DataEnvironment::StdBaroPress + PZ( NodeNum ), TZ( NodeNum ), WZ( NodeNum ) );
+			SQRTDZ( NodeNum ) = std::sqrt( RHOZ( NodeNum ) );
+			VISCZ( NodeNum ) = 1.71432e-5 + 4.828e-8 * TZ( NodeNum );
+		}
+		PS = 0.0;
+		DpL = 0.0;
+	}
+
+}
+
+// Solution of the zone pressures of one time step; the argument is the number of zones
+static void
+BM_SOLVZP( benchmark::State & state )
+{
+	int const NumZones( state.range( 0 ) );
+	SetUpNetwork( NumZones );
+	int ITER( 0 );
+	int TotIterations( 0 );
+	for ( auto _ : state ) {
+		for ( int NodeNum = 1; NodeNum <= NumZones; ++NodeNum ) {
+			PZ( NodeNum ) = 0.0;
+		}
+		SOLVZP( IK, AD, AU, ITER );
+		TotIterations += ITER;
+		benchmark::DoNotOptimize( PZ.data() );
+	}
+	state.counters[ "Iterations" ] = benchmark::Counter( TotIterations, benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( BM_SOLVZP )->Arg( 8 )->Arg( 32 )->Arg( 128 )->Arg( 512 );
@@ -0,0 +1,232 @@
+// EnergyPlus::CurveManager Micro-Benchmarks
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/DataGlobals.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+using namespace ObjexxFCL;
+
+namespace {
+
+	// Fixture curve numbers: one curve of each type evaluated by CurveValue
+	int const CurveLinear( 1 );
+	int const CurveQuadratic( 2 );
+	int const CurveCubic( 3 );
+	int const CurveQuartic( 4 );
+	int const CurveExponent( 5 );
+	int const CurveExponentialSkewNormal( 6 );
+	int const CurveSigmoid( 7 );
+	int const CurveRectangularHyperbola1( 8 );
+	int const CurveRectangularHyperbola2( 9 );
+	int const CurveExponentialDecay( 10 );
+	int const CurveDoubleExponentialDecay( 11 );
+	int const CurveBiQuadratic( 12 );
+	int const CurveQuadraticLinear( 13 );
+	int const CurveCubicLinear( 14 );
+	int const CurveBiCubic( 15 );
+	int const CurveFanPressureRise( 16 );
+	int const CurveTriQuadratic( 17 );
+	int const CurveQuadLinear( 18 );
+	int const CurveTableOneIV( 19 );
+	int const CurveTableTwoIV( 20 );
+	int const NumFixtureCurves( 20 );
+
+	// Operating points of a DX coil over a cooling season: part load ratio or flow fraction, entering wet-bulb,
+	// outdoor dry-bulb and a third variable in the same range as the first
+	struct CurveInputs
+	{
+		Real64 X1;
+		Real64 X2;
+		Real64 X3;
+	};
+
+	void
+	SetUpCurve(
+		int const CurveNum,
+		int const CurveType,
+		std::vector< Real64 > const & Coeffs
+	)
+	{
+		auto & Curve( PerfCurve( CurveNum ) );
+		Curve.Name = "BENCHMARK CURVE " + std::to_string( CurveNum );
+		Curve.CurveType = CurveType;
+		Curve.InterpolationType = EvaluateCurveToLimits;
+		Real64 * const Coeff[] = { &Curve.Coeff1, &Curve.Coeff2, &Curve.Coeff3, &Curve.Coeff4, &Curve.Coeff5, &Curve.Coeff6, &Curve.Coeff7, &Curve.Coeff8, &Curve.Coeff9, &Curve.Coeff10, &Curve.Coeff11, &Curve.Coeff12 };
+		for ( std::size_t i = 0; i < Coeffs.size(); ++i ) *Coeff[ i ] = Coeffs[ i ];
+		Curve.Var1Min = -100.0;
+		Curve.Var1Max = 1000.0;
+		Curve.Var2Min = -100.0;
+		Curve.Var2Max = 1000.0;
+		Curve.Var3Min = -100.0;
+		Curve.Var3Max = 1000.0;
+		Curve.Var4Min = -100.0;
+		Curve.Var4Max = 1000.0;
+	}
+
+	void
+	SetUpCurves()
+	{
+		if ( NumCurves == NumFixtureCurves ) return;
+
+		DataGlobals::BeginEnvrnFlag = false;
+		GetCurvesInputFlag = false;
+		NumCurves = NumFixtureCurves;
+		PerfCurve.allocate( NumCurves );
+
+		SetUpCurve( CurveLinear, Linear, { 0.1, 0.9 } );
+		SetUpCurve( CurveQuadratic, Quadratic, { 0.85, 0.15, 0.0 } );
+		SetUpCurve( CurveCubic, Cubic, { 0.0, 1.8, -1.2, 0.4 } );
+		SetUpCurve( CurveQuartic, Quartic, { 0.02, 0.4, 0.9, -0.6, 0.28 } );
+		SetUpCurve( CurveExponent, Exponent, { 0.0, 1.0, 0.8 } );
+		SetUpCurve( CurveExponentialSkewNormal, ExponentialSkewNormal, { 0.4, 0.3, 0.2, 0.8 } );
+		SetUpCurve( CurveSigmoid, Sigmoid, { 0.1, 0.9, 0.5, 0.1, 1.0 } );
+		SetUpCurve( CurveRectangularHyperbola1, RectangularHyperbola1, { 1.2, 0.2, 0.0 } );
+		SetUpCurve( CurveRectangularHyperbola2, RectangularHyperbola2, { 0.8, 0.3, 0.1 } );
+		SetUpCurve( CurveExponentialDecay, ExponentialDecay, { 1.0, -0.9, -3.0 } );
+		SetUpCurve( CurveDoubleExponentialDecay, DoubleExponentialDecay, { 1.0, -0.6, -3.0, -0.3, -9.0 } );
+		SetUpCurve( CurveBiQuadratic, BiQuadratic, { 0.942587793, 0.009543347, 0.000683770, -0.011042676, 0.000005249, -0.000009720 } );
+		SetUpCurve( CurveQuadraticLinear, QuadraticLinear, { 0.9, 0.01, 0.0005, -0.008, 0.0001, -0.00002 } );
+		SetUpCurve( CurveCubicLinear, CubicLinear, { 0.9, 0.01, 0.0005, 0.00001, -0.008, -0.00002 } );
+		SetUpCurve( CurveBiCubic, BiCubic, { 0.9, 0.01, 0.0005, -0.008, 0.0001, -0.00002, 0.000001, -0.000001, 0.0000005, -0.0000005 } );
+		SetUpCurve( CurveFanPressureRise, FanPressureRise, { 1446.75833, 0.0, 0.0, 1.0 } );
+		SetUpCurve( CurveTriQuadratic, TriQuadratic, {} );
+		SetUpCurve( CurveQuadLinear, QuadLinear, { 0.9, 0.01, -0.008, 0.02, 0.03 } );
+
+		auto & Tri2ndOrder( PerfCurve( CurveTriQuadratic ).Tri2ndOrder );
+		Tri2ndOrder.allocate( 1 );
+		Tri2ndOrder( 1 ).CoeffA0 = 0.9;
+		Tri2ndOrder( 1 ).CoeffA1 = 0.0005;
+		Tri2ndOrder( 1 ).CoeffA2 = 0.01;
+		Tri2ndOrder( 1 ).CoeffA3 = 0.0001;
+		Tri2ndOrder( 1 ).CoeffA4 = -0.008;
+		Tri2ndOrder( 1 ).CoeffA5 = -0.05;
+		Tri2ndOrder( 1 ).CoeffA6 = 0.1;
+		Tri2ndOrder( 1 ).CoeffA8 = -0.00002;
+		Tri2ndOrder( 1 ).CoeffA12 = 0.001;
+		Tri2ndOrder( 1 ).CoeffA16 = -0.001;
+		Tri2ndOrder( 1 ).CoeffA26 = 0.00001;
+
+		// Tabular curves: capacity modifier vs. flow fraction and vs. entering wet-bulb and outdoor dry-bulb
+		TableLookup.allocate( 2 );
+		PerfCurveTableData.allocate( 2 );
+		TableLookup( 1 ).NumIndependentVars = 1;
+		PerfCurveTableData( 1 ).X1.allocate( 11 );
+		PerfCurveTableData( 1 ).Y.allocate( 1, 11 );
+		for ( int i = 1; i <= 11; ++i ) {
+			Real64 const X( 0.1 * ( i - 1 ) );
+			PerfCurveTableData( 1 ).X1( i ) = X;
+			PerfCurveTableData( 1 ).Y( 1, i ) = 0.1 + 0.9 * X * ( 2.0 - X );
+		}
+		TableLookup( 2 ).NumIndependentVars = 2;
+		PerfCurveTableData( 2 ).X1.allocate( 6 );
+		PerfCurveTableData( 2 ).X2.allocate( 8 );
+		PerfCurveTableData( 2 ).Y.allocate( 8, 6 );
+		for ( int i = 1; i <= 6; ++i ) PerfCurveTableData( 2 ).X1( i ) = 12.0 + 2.5 * ( i - 1 );
+		for ( int j = 1; j <= 8; ++j ) PerfCurveTableData( 2 ).X2( j ) = 18.0 + 4.0 * ( j - 1 );
+		for ( int i = 1; i <= 6; ++i ) {
+			for ( int j = 1; j <= 8; ++j ) {
+				Real64 const Twb( PerfCurveTableData( 2 ).X1( i ) );
+				Real64 const Tdb( PerfCurveTableData( 2 ).X2( j ) );
+				PerfCurveTableData( 2 ).Y( j, i ) = 0.942587793 + 0.009543347 * Twb + 0.000683770 * Twb * Twb - 0.011042676 * Tdb + 0.000005249 * Tdb * Tdb - 0.000009720 * Twb * Tdb;
+			}
+		}
+		SetUpCurve( CurveTableOneIV, Linear, {} );
+		PerfCurve( CurveTableOneIV ).InterpolationType = LinearInterpolationOfTable;
+		PerfCurve( CurveTableOneIV ).TableIndex = 1;
+		PerfCurve( CurveTableOneIV ).Var1Min = 0.0;
+		PerfCurve( CurveTableOneIV ).Var1Max = 1.0;
+		SetUpCurve( CurveTableTwoIV, BiQuadratic, {} );
+		PerfCurve( CurveTableTwoIV ).InterpolationType = LinearInterpolationOfTable;
+		PerfCurve( CurveTableTwoIV ).TableIndex = 2;
+		PerfCurve( CurveTableTwoIV ).Var1Min = 12.0;
+		PerfCurve( CurveTableTwoIV ).Var1Max = 24.5;
+		PerfCurve( CurveTableTwoIV ).Var2Min = 18.0;
+		PerfCurve( CurveTableTwoIV ).Var2Max = 46.0;
+	}
+
+	std::vector< CurveInputs > const &
+	OperatingPoints()
+	{
+		static std::vector< CurveInputs > Points;
+		if ( Points.empty() ) {
+			int const NumPoints( 1024 );
+			for ( int i = 0; i < NumPoints; ++i ) {
+				CurveInputs Point;
+				Point.X1 = 0.1 + 0.9 * ( ( i * 37 ) % NumPoints ) / NumPoints;
+				Point.X2 = 12.0 + 12.0 * ( ( i * 53 ) % NumPoints ) / NumPoints;
+				Point.X3 = 18.0 + 28.0 * ( ( i * 71 ) % NumPoints ) / NumPoints;
+				Points.push_back( Point );
+			}
+		}
+		return Points;
+	}
+
+}
+
+static void
+BM_CurveValue1( benchmark::State & state, int const CurveNum )
+{
+	SetUpCurves();
+	auto const & Points( OperatingPoints() );
+	for ( auto _ : state ) {
+		for ( auto const & Point : Points ) {
+			benchmark::DoNotOptimize( CurveValue( CurveNum, Point.X1 ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * Points.size() );
+}
+BENCHMARK_CAPTURE( BM_CurveValue1, Linear, CurveLinear );
+BENCHMARK_CAPTURE( BM_CurveValue1, Quadratic, CurveQuadratic );
+BENCHMARK_CAPTURE( BM_CurveValue1, Cubic, CurveCubic );
+BENCHMARK_CAPTURE( BM_CurveValue1, Quartic, CurveQuartic );
+BENCHMARK_CAPTURE( BM_CurveValue1, Exponent, CurveExponent );
+BENCHMARK_CAPTURE( BM_CurveValue1, ExponentialSkewNormal, CurveExponentialSkewNormal );
+BENCHMARK_CAPTURE( BM_CurveValue1, Sigmoid, CurveSigmoid );
+BENCHMARK_CAPTURE( BM_CurveValue1, RectangularHyperbola1, CurveRectangularHyperbola1 );
+BENCHMARK_CAPTURE( BM_CurveValue1, RectangularHyperbola2, CurveRectangularHyperbola2 );
+BENCHMARK_CAPTURE( BM_CurveValue1, ExponentialDecay, CurveExponentialDecay );
+BENCHMARK_CAPTURE( BM_CurveValue1, DoubleExponentialDecay, CurveDoubleExponentialDecay );
+BENCHMARK_CAPTURE( BM_CurveValue1, TableOneIV, CurveTableOneIV );
+
+static void
+BM_CurveValue2( benchmark::State & state, int const CurveNum )
+{
+	SetUpCurves();
+	auto const & Points( OperatingPoints() );
+	for ( auto _ : state ) {
+		for ( auto const & Point : Points ) {
+			benchmark::DoNotOptimize( CurveValue( CurveNum, Point.X2, Point.X3 ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * Points.size() );
+}
+BENCHMARK_CAPTURE( BM_CurveValue2, BiQuadratic, CurveBiQuadratic );
+BENCHMARK_CAPTURE( BM_CurveValue2, QuadraticLinear, CurveQuadraticLinear );
+BENCHMARK_CAPTURE( BM_CurveValue2, CubicLinear, CurveCubicLinear );
+BENCHMARK_CAPTURE( BM_CurveValue2, BiCubic, CurveBiCubic );
+BENCHMARK_CAPTURE( BM_CurveValue2, FanPressureRise, CurveFanPressureRise );
+BENCHMARK_CAPTURE( BM_CurveValue2, TableTwoIV, CurveTableTwoIV );
+
+static void
+BM_CurveValue3( benchmark::State & state, int const CurveNum )
+{
+	SetUpCurves();
+	auto const & Points( OperatingPoints() );
+	for ( auto _ : state ) {
+		for ( auto const & Point : Points ) {
+			benchmark::DoNotOptimize( CurveValue( CurveNum, Point.X2, Point.X3, Point.X1 ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * Points.size() );
+}
+BENCHMARK_CAPTURE( BM_CurveValue3, TriQuadratic, CurveTriQuadratic );
+BENCHMARK_CAPTURE( BM_CurveValue3, QuadLinear, CurveQuadLinear );
@@ -0,0 +1,107 @@
+// EnergyPlus::FluidProperties Micro-Benchmarks
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+using namespace ObjexxFCL;
+
+namespace {
+
+	// 30% propylene glycol with the property tables on the 5 C spacing of the built-in glycol data
+	std::string const GlycolName( "BENCHMARKGLYCOL" );
+
+	void
+	SetUpGlycol()
+	{
+		if ( NumOfGlycols == 1 && GlycolData( 1 ).Name == GlycolName ) return;
+
+		int const NumTempPts( 32 ); // -30 C to 125 C
+		GetInput = false;
+		NumOfGlycols = 1;
+		GlycolData.allocate( NumOfGlycols );
+		GlycolErrorTracking.allocate( NumOfGlycols );
+		auto & Glycol( GlycolData( 1 ) );
+		Glycol.Name = GlycolName;
+		GlycolErrorTracking( 1 ).Name = GlycolName;
+
+		Glycol.CpDataPresent = true;
+		Glycol.NumCpTempPts = NumTempPts;
+		Glycol.CpTemps.allocate( NumTempPts );
+		Glycol.CpValues.allocate( NumTempPts );
+		Glycol.RhoDataPresent = true;
+		Glycol.NumRhoTempPts = NumTempPts;
+		Glycol.RhoTemps.allocate( NumTempPts );
+		Glycol.RhoValues.allocate( NumTempPts );
+		for ( int i = 1; i <= NumTempPts; ++i ) {
+			Real64 const Temp( -30.0 + 5.0 * ( i - 1 ) );
+			Glycol.CpTemps( i ) = Temp;
+			Glycol.CpValues( i ) = 3860.0 + 2.3 * Temp;
+			Glycol.RhoTemps( i ) = Temp;
+			Glycol.RhoValues( i ) = 1037.0 - 0.45 * Temp - 0.0025 * Temp * Temp;
+		}
+		Glycol.CpLowTempIndex = 1;
+		Glycol.CpHighTempIndex = NumTempPts;
+		Glycol.CpLowTempValue = Glycol.CpTemps( 1 );
+		Glycol.CpHighTempValue = Glycol.CpTemps( NumTempPts );
+		InitializeFluidGridIndex( Glycol.CpGrid, Glycol.CpTemps, 1, NumTempPts );
+		Glycol.RhoLowTempIndex = 1;
+		Glycol.RhoHighTempIndex = NumTempPts;
+		Glycol.RhoLowTempValue = Glycol.RhoTemps( 1 );
+		Glycol.RhoHighTempValue = Glycol.RhoTemps( NumTempPts );
+		InitializeFluidGridIndex( Glycol.RhoGrid, Glycol.RhoTemps, 1, NumTempPts );
+	}
+
+	// Loop temperatures of chilled, condenser and hot water plants
+	std::vector< Real64 > const &
+	LoopTemperatures()
+	{
+		static std::vector< Real64 > Temps;
+		if ( Temps.empty() ) {
+			int const NumTemps( 1024 );
+			for ( int i = 0; i < NumTemps; ++i ) {
+				Temps.push_back( 4.0 + 78.0 * ( ( i * 37 ) % NumTemps ) / NumTemps );
+			}
+		}
+		return Temps;
+	}
+
+}
+
+static void
+BM_GetSpecificHeatGlycol( benchmark::State & state )
+{
+	SetUpGlycol();
+	auto const & Temps( LoopTemperatures() );
+	int GlycolIndex( 0 );
+	for ( auto _ : state ) {
+		for ( Real64 const Temp : Temps ) {
+			benchmark::DoNotOptimize( GetSpecificHeatGlycol( GlycolName, Temp, GlycolIndex, "BM_GetSpecificHeatGlycol" ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * Temps.size() );
+}
+BENCHMARK( BM_GetSpecificHeatGlycol );
+
+static void
+BM_GetDensityGlycol( benchmark::State & state )
+{
+	SetUpGlycol();
+	auto const & Temps( LoopTemperatures() );
+	int GlycolIndex( 0 );
+	for ( auto _ : state ) {
+		for ( Real64 const Temp : Temps ) {
+			benchmark::DoNotOptimize( GetDensityGlycol( GlycolName, Temp, GlycolIndex, "BM_GetDensityGlycol" ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * Temps.size() );
+}
+BENCHMARK( BM_GetDensityGlycol );
@@ -0,0 +1,156 @@
+// EnergyPlus::HeatBalanceIntRadExchange Micro-Benchmarks
+
+// C++ Headers
+#include <string>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+namespace {
+
+	// Enclosure of N equal surfaces that all see each other (reciprocal and complete view factors)
+	void
+	UniformEnclosure(
+		int const N,
+		Array1D< Real64 > & A,
+		Array2D< Real64 > & F,
+		Array1D< Real64 > & EMISS
+	)
+	{
+		A.dimension( N, 10.0 );
+		F.dimension( N, N, 1.0 / ( N - 1 ) );
+		for ( int i = 1; i <= N; ++i ) {
+			F( i, i ) = 0.0;
+		}
+		EMISS.dimension( N, 0.9 );
+	}
+
+	int const NumFixtureZones( 10 );
+	int const NumFixtureZoneSurfaces( 12 );
+
+	// Ten 10 m x 10 m x 3 m zones: floor, roof, each wall split in two, and two internal mass surfaces.
+	// CalcInteriorRadExchange initializes its view factors once per process, so the fixture is built once.
+	void
+	SetUpZones()
+	{
+		using namespace DataSurfaces;
+		if ( DataGlobals::NumOfZones == NumFixtureZones ) return;
+
+		DataGlobals::NumOfZones = NumFixtureZones;
+		DataGlobals::KickOffSimulation = false;
+		DataGlobals::KickOffSizing = false;
+		DataGlobals::BeginEnvrnFlag = true;
+		TotSurfaces = NumFixtureZones * NumFixtureZoneSurfaces;
+		DataHeatBalance::Zone.allocate( NumFixtureZones );
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).InsideAbsorpThermal = 0.9;
+		Surface.allocate( TotSurfaces );
+		SurfaceWindow.allocate( TotSurfaces );
+		int SurfNum( 0 );
+		for ( int ZoneNum = 1; ZoneNum <= NumFixtureZones; ++ZoneNum ) {
+			auto & zone( DataHeatBalance::Zone( ZoneNum ) );
+			zone.Name = "ZONE " + std::to_string( ZoneNum );
+			zone.SurfaceFirst = SurfNum + 1;
+			for ( int ZoneSurfNum = 1; ZoneSurfNum <= NumFixtureZoneSurfaces; ++ZoneSurfNum ) {
+				auto & surface( Surface( ++SurfNum ) );
+				surface.Name = zone.Name + " SURFACE " + std::to_string( ZoneSurfNum );
+				surface.Zone = ZoneNum;
+				surface.HeatTransSurf = true;
+				surface.Construction = 1;
+				if ( ZoneSurfNum == 1 ) {
+					surface.Class = SurfaceClass_Floor;
+					surface.Area = 100.0;
+					surface.Tilt = 180.0;
+				} else if ( ZoneSurfNum == 2 ) {
+					surface.Class = SurfaceClass_Roof;
+					surface.Area = 100.0;
+					surface.Tilt = 0.0;
+				} else if ( ZoneSurfNum <= 10 ) {
+					surface.Class = SurfaceClass_Wall;
+					surface.Area = 15.0;
+					surface.Tilt = 90.0;
+					surface.Azimuth = 90.0 * ( ( ZoneSurfNum - 3 ) / 2 );
+				} else {
+					surface.Class = SurfaceClass_IntMass;
+					surface.Area = 20.0;
+					surface.Tilt = 90.0;
+				}
+			}
+			zone.SurfaceLast = SurfNum;
+		}
+	}
+
+}
+
+static void
+BM_CalcScriptF_Invert( benchmark::State & state )
+{
+	int const N( state.range( 0 ) );
+	Array1D< Real64 > A;
+	Array2D< Real64 > F;
+	Array1D< Real64 > EMISS;
+	UniformEnclosure( N, A, F, EMISS );
+	Array2D< Real64 > ScriptF( N, N );
+	Array2D< Real64 > BaseCinverse;
+	Array1D< Real64 > BaseEMISS;
+	for ( auto _ : state ) {
+		BaseEMISS.deallocate(); // No base inverse: form and invert the coefficient matrix
+		CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+		benchmark::DoNotOptimize( ScriptF.data() );
+	}
+}
+BENCHMARK( BM_CalcScriptF_Invert )->Arg( 6 )->Arg( 12 )->Arg( 24 )->Arg( 48 )->Arg( 96 );
+
+static void
+BM_CalcScriptF_ShadeUpdate( benchmark::State & state )
+{
+	int const N( state.range( 0 ) );
+	Array1D< Real64 > A;
+	Array2D< Real64 > F;
+	Array1D< Real64 > EMISS;
+	UniformEnclosure( N, A, F, EMISS );
+	Array2D< Real64 > ScriptF( N, N );
+	Array2D< Real64 > BaseCinverse;
+	Array1D< Real64 > BaseEMISS;
+	CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+	bool ShadeOn( false );
+	for ( auto _ : state ) {
+		ShadeOn = ! ShadeOn; // An interior shade on one window is deployed and retracted
+		EMISS( 2 ) = ShadeOn ? 0.3 : 0.9;
+		CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+		benchmark::DoNotOptimize( ScriptF.data() );
+	}
+}
+BENCHMARK( BM_CalcScriptF_ShadeUpdate )->Arg( 6 )->Arg( 12 )->Arg( 24 )->Arg( 48 )->Arg( 96 );
+
+// Arg is SurfIterations: 0 is the first heat balance iteration of a time step, 1 the later iterations
+static void
+BM_CalcInteriorRadExchange( benchmark::State & state )
+{
+	SetUpZones();
+	int const SurfIterations( state.range( 0 ) );
+	Array1D< Real64 > SurfaceTemp( DataSurfaces::TotSurfaces );
+	Array1D< Real64 > NetLWRadToSurf( DataSurfaces::TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+		SurfaceTemp( SurfNum ) = 20.0 + 0.05 * ( SurfNum % 37 );
+	}
+	DataGlobals::BeginEnvrnFlag = true;
+	CalcInteriorRadExchange( SurfaceTemp, 0, NetLWRadToSurf );
+	DataGlobals::BeginEnvrnFlag = false;
+	for ( auto _ : state ) {
+		CalcInteriorRadExchange( SurfaceTemp, SurfIterations, NetLWRadToSurf );
+		benchmark::DoNotOptimize( NetLWRadToSurf.data() );
+	}
+	state.SetItemsProcessed( state.iterations() * DataSurfaces::TotSurfaces );
+}
+BENCHMARK( BM_CalcInteriorRadExchange )->Arg( 0 )->Arg( 1 );
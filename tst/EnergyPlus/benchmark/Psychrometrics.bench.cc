@@ -0,0 +1,151 @@
+// EnergyPlus::Psychrometrics Micro-Benchmarks
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Psychrometrics;
+
+namespace {
+
+	// Air states of a design day: dry-bulb swings 18-32 C, humidity ratio 6-12 g/kg at a slowly varying pressure
+	struct AirState
+	{
+		Real64 Tdb; // dry-bulb temperature {C}
+		Real64 W; // humidity ratio
+		Real64 Pb; // barometric pressure {Pascals}
+		Real64 H; // enthalpy {J/kg}
+	};
+
+	std::vector< AirState > const &
+	DesignDayStates()
+	{
+		static std::vector< AirState > States;
+		if ( States.empty() ) {
+			InitializePsychRoutines();
+			int const NumStates( 4096 );
+			for ( int i = 0; i < NumStates; ++i ) {
+				Real64 const Phase( 2.0 * 3.14159265358979 * i / 96.0 );
+				AirState State;
+				State.Tdb = 25.0 + 7.0 * std::sin( Phase ) + 0.01 * ( i % 13 );
+				State.W = 0.009 + 0.003 * std::cos( Phase ) + 1.0e-5 * ( i % 7 );
+				State.Pb = 101325.0 - 40.0 * ( i % 11 );
+				State.H = PsyHFnTdbW( State.Tdb, State.W );
+				States.push_back( State );
+			}
+		}
+		return States;
+	}
+
+}
+
+static void
+BM_PsyTwbFnTdbWPb( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTwbFnTdbWPb( Air.Tdb, Air.W, Air.Pb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTwbFnTdbWPb );
+
+static void
+BM_PsyTwbFnTdbWPb_raw( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTwbFnTdbWPb_raw( Air.Tdb, Air.W, Air.Pb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTwbFnTdbWPb_raw );
+
+static void
+BM_PsyPsatFnTemp( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyPsatFnTemp( Air.Tdb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyPsatFnTemp );
+
+static void
+BM_PsyPsatFnTemp_raw( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyPsatFnTemp_raw( Air.Tdb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyPsatFnTemp_raw );
+
+static void
+BM_PsyTsatFnHPb( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTsatFnHPb( Air.H, Air.Pb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTsatFnHPb );
+
+static void
+BM_PsyTsatFnHPb_raw( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTsatFnHPb_raw( Air.H, Air.Pb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTsatFnHPb_raw );
+
+static void
+BM_PsyTsatFnPb( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTsatFnPb( Air.Pb - 1.0e5 + 1.0e3 * Air.Tdb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTsatFnPb );
+
+static void
+BM_PsyTsatFnPb_raw( benchmark::State & state )
+{
+	auto const & States( DesignDayStates() );
+	for ( auto _ : state ) {
+		for ( auto const & Air : States ) {
+			benchmark::DoNotOptimize( PsyTsatFnPb_raw( Air.Pb - 1.0e5 + 1.0e3 * Air.Tdb ) );
+		}
+	}
+	state.SetItemsProcessed( state.iterations() * States.size() );
+}
+BENCHMARK( BM_PsyTsatFnPb_raw );
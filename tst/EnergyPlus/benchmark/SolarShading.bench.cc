@@ -0,0 +1,129 @@
+// EnergyPlus::SolarShading Micro-Benchmarks
+
+// C++ Headers
+#include <cmath>
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/SolarShading.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SolarShading;
+
+namespace {
+
+	int const MaxFixtureVertices( 32 );
+
+	void
+	SetUpShadowingScratch()
+	{
+		if ( HCX.allocated() ) return;
+		DataSurfaces::MaxVerticesPerSurface = MaxFixtureVertices;
+		MaxHCV = ( ( ( MaxFixtureVertices + 16 ) / 16 ) * 16 ) - 1;
+		MaxHCS = 200;
+		MAXHCArrayIncrement = MaxFixtureVertices + 1;
+		InitShadowingThreadScratch();
+	}
+
+	// Regular polygon in clockwise order (the order SHADOW gives the receiving surface) as figure NS
+	void
+	RegularPolygonFigure(
+		int const NS,
+		int const NumVertices,
+		Real64 const XCenter,
+		Real64 const YCenter,
+		Real64 const Radius
+	)
+	{
+		for ( int N = 1; N <= NumVertices; ++N ) {
+			Real64 const Angle( 0.3 - 2.0 * 3.14159265358979 * ( N - 1 ) / NumVertices );
+			XVS( N ) = XCenter + Radius * std::cos( Angle );
+			YVS( N ) = YCenter + Radius * std::sin( Angle );
+		}
+		HTRANS1( NS, NumVertices );
+	}
+
+	// South wall (figure 1) partly shadowed by the shadow of an overhang (figure 2), as SHDGSS sets them up
+	void
+	WallAndOverhangShadowFigures()
+	{
+		SetUpShadowingScratch();
+		XVS( 1 ) = 0.0; YVS( 1 ) = 3.0;
+		XVS( 2 ) = 10.0; YVS( 2 ) = 3.0;
+		XVS( 3 ) = 10.0; YVS( 3 ) = 0.0;
+		XVS( 4 ) = 0.0; YVS( 4 ) = 0.0;
+		HTRANS1( 1, 4 );
+		HCAREA( 1 ) = -HCAREA( 1 );
+		HCT( 1 ) = 1.0;
+		XVS( 1 ) = -1.0; YVS( 1 ) = 3.5;
+		XVS( 2 ) = 11.0; YVS( 2 ) = 3.5;
+		XVS( 3 ) = 12.0; YVS( 3 ) = 1.8;
+		XVS( 4 ) = 0.0; YVS( 4 ) = 1.8;
+		HTRANS1( 2, 4 );
+		HCT( 2 ) = 0.0;
+	}
+
+	// Two overlapping polygons with the given number of vertices as figures 1 and 2
+	void
+	PolygonFigures( int const NumVertices )
+	{
+		SetUpShadowingScratch();
+		RegularPolygonFigure( 1, NumVertices, 0.0, 0.0, 2.0 );
+		HCAREA( 1 ) = -HCAREA( 1 );
+		HCT( 1 ) = 1.0;
+		RegularPolygonFigure( 2, NumVertices, 1.0, 0.5, 2.0 );
+		HCT( 2 ) = 0.0;
+	}
+
+}
+
+static void
+BM_CLIPPOLY_WallOverhang( benchmark::State & state )
+{
+	WallAndOverhangShadowFigures();
+	int NV3( 0 );
+	for ( auto _ : state ) {
+		CLIPPOLY( 1, 2, 4, 4, NV3 );
+		benchmark::DoNotOptimize( NV3 );
+	}
+}
+BENCHMARK( BM_CLIPPOLY_WallOverhang );
+
+static void
+BM_CLIPPOLY_Polygons( benchmark::State & state )
+{
+	int const NumVertices( state.range( 0 ) );
+	PolygonFigures( NumVertices );
+	int NV3( 0 );
+	for ( auto _ : state ) {
+		CLIPPOLY( 1, 2, NumVertices, NumVertices, NV3 );
+		benchmark::DoNotOptimize( NV3 );
+	}
+}
+BENCHMARK( BM_CLIPPOLY_Polygons )->Arg( 4 )->Arg( 8 )->Arg( 16 )->Arg( MaxFixtureVertices );
+
+// The overlap of one shadow with the receiving surface is the work SHADOW repeats for every shadow caster;
+// figure 3 receives the overlap as it does in SHDGSS
+static void
+BM_SHADOW_Overlap( benchmark::State & state, bool const SutherlandHodgman )
+{
+	bool const SaveSutherlandHodgman( DataSystemVariables::SutherlandHodgman );
+	DataSystemVariables::SutherlandHodgman = SutherlandHodgman;
+	int const NumVertices( state.range( 0 ) );
+	if ( NumVertices == 4 ) {
+		WallAndOverhangShadowFigures();
+	} else {
+		PolygonFigures( NumVertices );
+	}
+	for ( auto _ : state ) {
+		DeterminePolygonOverlap( 1, 2, 3 );
+		benchmark::DoNotOptimize( OverlapStatus );
+	}
+	DataSystemVariables::SutherlandHodgman = SaveSutherlandHodgman;
+}
+BENCHMARK_CAPTURE( BM_SHADOW_Overlap, SutherlandHodgman, true )->Arg( 4 )->Arg( 8 )->Arg( 16 )->Arg( MaxFixtureVertices );
+BENCHMARK_CAPTURE( BM_SHADOW_Overlap, Convex, false )->Arg( 4 )->Arg( 8 )->Arg( 16 )->Arg( MaxFixtureVertices );
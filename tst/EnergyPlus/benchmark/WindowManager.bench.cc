@@ -0,0 +1,137 @@
+// EnergyPlus::WindowManager Micro-Benchmarks
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/WindowManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowManager;
+using namespace ObjexxFCL;
+
+namespace {
+
+	// Unshaded 1.2 m x 1.5 m double-glazed window (6 mm clear glass, 13 mm air gap) on a winter night
+	void
+	SetUpDoubleGlazing()
+	{
+		using namespace DataSurfaces;
+		int const NumSurfs( 1 );
+		if ( TotSurfaces == NumSurfs && Surface.allocated() ) return;
+
+		TotSurfaces = NumSurfs;
+		DataGlobals::NumOfZones = 1;
+		DataHeatBalance::Zone.allocate( 1 );
+		DataHeatBalance::Zone( 1 ).InsideConvectionAlgo = DataHeatBalance::ASHRAESimple;
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).TransDiff = 0.7;
+		DataHeatBalance::QS.dimension( 1, 0.0 );
+		DataHeatBalance::QRadSWOutIncident.dimension( NumSurfs, 0.0 );
+		DataHeatBalance::QRadSWwinAbsTot.dimension( NumSurfs, 0.0 );
+		DataHeatBalance::HConvIn.dimension( NumSurfs, 3.076 );
+		DataEnvironment::SunIsUp = false;
+
+		Surface.allocate( NumSurfs );
+		SurfaceWindow.allocate( NumSurfs );
+		auto & surface( Surface( 1 ) );
+		surface.Name = "BENCHMARK WINDOW";
+		surface.Zone = 1;
+		surface.Construction = 1;
+		surface.ShadedConstruction = 0;
+		surface.Area = 1.8;
+		surface.Width = 1.2;
+		surface.Height = 1.5;
+		surface.IntConvCoeff = 0;
+		auto & window( SurfaceWindow( 1 ) );
+		window.ShadingFlag = ShadeOff;
+		window.StormWinFlag = 0;
+		window.EdgeGlCorrFac = 1.0;
+		window.AirflowThisTS = 0.0;
+
+		WinHeatGain.dimension( NumSurfs, 0.0 );
+		WinTransSolar.dimension( NumSurfs, 0.0 );
+		WinGainConvGlazToZoneRep.dimension( NumSurfs, 0.0 );
+		WinGainIRGlazToZoneRep.dimension( NumSurfs, 0.0 );
+		WinGapConvHtFlowRep.dimension( NumSurfs, 0.0 );
+		WinGapConvHtFlowRepEnergy.dimension( NumSurfs, 0.0 );
+		WinLossSWZoneToOutWinRep.dimension( NumSurfs, 0.0 );
+		WinSysSolTransmittance.dimension( NumSurfs, 0.0 );
+		WinSysSolAbsorptance.dimension( NumSurfs, 0.0 );
+		WinSysSolReflectance.dimension( NumSurfs, 0.0 );
+		WinShadingAbsorbedSolar.dimension( NumSurfs, 0.0 );
+
+		// Glazing system as CalcWindowHeatBalance sets it up from the construction
+		ngllayer = 2;
+		nglface = 4;
+		scon( 1 ) = 0.9 / 0.006;
+		scon( 2 ) = 0.9 / 0.006;
+		for ( int i = 1; i <= nglface; ++i ) {
+			emis( i ) = 0.84;
+			tir( i ) = 0.0;
+			AbsRadGlassFace( i ) = 0.0;
+		}
+		gap( 1 ) = 0.013;
+		gnmix( 1 ) = 1;
+		gcon( 1, 1, 1 ) = 2.873e-3;
+		gcon( 2, 1, 1 ) = 7.76e-5;
+		gvis( 1, 1, 1 ) = 3.723e-6;
+		gvis( 2, 1, 1 ) = 4.94e-8;
+		gcp( 1, 1, 1 ) = 1002.737;
+		gcp( 2, 1, 1 ) = 1.2324e-2;
+		gwght( 1, 1 ) = 28.97;
+		gfract( 1, 1 ) = 1.0;
+		A23P = -emis( 3 ) / ( 1.0 - ( 1.0 - emis( 2 ) ) * ( 1.0 - emis( 3 ) ) );
+		A32P = emis( 2 ) / ( 1.0 - ( 1.0 - emis( 2 ) ) * ( 1.0 - emis( 3 ) ) );
+		A23 = emis( 2 ) * sigma * A23P;
+
+		tilt = 90.0;
+		tout = -5.0 + TKelvin;
+		tin = 21.0 + TKelvin;
+		hcout = 20.0;
+		hcin = 3.076;
+		Outir = sigma * pow_4( tout - 3.0 );
+		Rmir = sigma * pow_4( tin );
+	}
+
+}
+
+// Face temperatures from the resistance-network guess used at the start of an environment
+static void
+BM_SolveForWindowTemperatures_ColdStart( benchmark::State & state )
+{
+	SetUpDoubleGlazing();
+	DataGlobals::BeginEnvrnFlag = true;
+	for ( auto _ : state ) {
+		SolveForWindowTemperatures( 1 );
+		benchmark::DoNotOptimize( thetas.data() );
+	}
+	state.counters[ "Iterations" ] = DataSurfaces::SurfaceWindow( 1 ).WindowCalcIterationsRep;
+}
+BENCHMARK( BM_SolveForWindowTemperatures_ColdStart );
+
+// Face temperatures of the previous time step as the starting point, as during a run period
+static void
+BM_SolveForWindowTemperatures_WarmStart( benchmark::State & state )
+{
+	SetUpDoubleGlazing();
+	DataGlobals::BeginEnvrnFlag = true;
+	SolveForWindowTemperatures( 1 );
+	for ( int i = 1; i <= nglface; ++i ) {
+		DataSurfaces::SurfaceWindow( 1 ).ThetaFace( i ) = thetas( i );
+	}
+	DataGlobals::BeginEnvrnFlag = false;
+	for ( auto _ : state ) {
+		SolveForWindowTemperatures( 1 );
+		benchmark::DoNotOptimize( thetas.data() );
+	}
+	state.counters[ "Iterations" ] = DataSurfaces::SurfaceWindow( 1 ).WindowCalcIterationsRep;
+}
+BENCHMARK( BM_SolveForWindowTemperatures_WarmStart );
@@ -0,0 +1,14 @@
+// EnergyPlus Micro-Benchmark Driver
+
+// Google Benchmark Headers
+#include <benchmark/benchmark.h>
+
+// Google Benchmark main
+int
+main( int argc, char **argv )
+{
+	::benchmark::Initialize( &argc, argv );
+	if ( ::benchmark::ReportUnrecognizedArguments( argc, argv ) ) return 1;
+	::benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+"""Times EnergyPlus on a set of example files and compares the results with a stored baseline.
+
+Each file is run with the ProfileTimings environment variable set, so besides the wall time
+of the run the eio file holds the peak memory and the time spent in each timed region
+("Timing Profile Total" lines).  The results are written as JSON; given a baseline written
+by an earlier run (--save-baseline), a report of the changes is printed and the script exits
+with status 1 if the wall time or peak memory of a file grew by more than the tolerance.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+
+def read_file_list(path):
+    """Returns the (idf, epw) pairs of the file list, skipping comments and blank lines."""
+    pairs = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = line.split()
+            if len(fields) != 2:
+                raise ValueError("Expected 'IDF_FILE EPW_FILE' in %s: %s" % (path, line))
+            pairs.append((fields[0], fields[1]))
+    return pairs
+
+
+def read_profile(eio_path):
+    """Returns the peak memory {MB} and the per-region totals from the timing profile of an eio file."""
+    peak_memory = None
+    regions = {}
+    if not os.path.exists(eio_path):
+        return peak_memory, regions
+    with open(eio_path) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split(',')]
+            if fields[0] == 'Timing Profile Total' and len(fields) == 5:
+                regions[fields[1]] = {'calls': int(fields[2]),
+                                      'inclusive': float(fields[3]),
+                                      'exclusive': float(fields[4])}
+            elif fields[0] == 'Timing Profile Peak Memory' and len(fields) == 2:
+                peak_memory = float(fields[1])
+    return peak_memory, regions
+
+
+def run_file(args, idf, epw):
+    """Runs one file args.repeat times and returns the result of the fastest run."""
+    name = os.path.splitext(idf)[0]
+    run_dir = os.path.join(args.output_dir, name)
+    command = [args.energyplus,
+               '-w', os.path.join(args.source_dir, 'weather', epw),
+               '-d', run_dir,
+               '-a' if args.annual else '-D',
+               os.path.join(args.source_dir, 'testfiles', idf)]
+    env = dict(os.environ)
+    env['ProfileTimings'] = 'Yes'
+
+    best = None
+    for _ in range(args.repeat):
+        if os.path.isdir(run_dir):
+            shutil.rmtree(run_dir)
+        os.makedirs(run_dir)
+        with open(os.path.join(run_dir, 'performance.log'), 'w') as log:
+            start = time.time()
+            status = subprocess.call(command, cwd=run_dir, env=env, stdout=log, stderr=subprocess.STDOUT)
+            wall_time = time.time() - start
+        if status != 0:
+            return {'failed': True}
+        peak_memory, regions = read_profile(os.path.join(run_dir, 'eplusout.eio'))
+        result = {'wall_time': wall_time, 'peak_memory': peak_memory, 'regions': regions}
+        if best is None or wall_time < best['wall_time']:
+            best = result
+    return best
+
+
+def change(new, old):
+    """Relative change of new from old, or None if either is unknown."""
+    if new is None or old is None or old <= 0.0:
+        return None
+    return (new - old) / old
+
+
+def format_change(value):
+    return '       n/a' if value is None else '%+9.1f%%' % (100.0 * value)
+
+
+def format_memory(value):
+    return 'n/a' if value is None else '%.1f' % value
+
+
+def compare(results, baseline, tolerance, num_regions):
+    """Prints the changes from the baseline and returns the names of the files that regressed."""
+    regressed = []
+    print('%-48s %10s %10s %10s %10s' % ('File', 'Time {s}', 'Change', 'Mem {MB}', 'Change'))
+    for name in sorted(results['files']):
+        new = results['files'][name]
+        old = baseline['files'].get(name)
+        if new.get('failed'):
+            print('%-48s FAILED' % name)
+            regressed.append(name)
+            continue
+        if old is None or old.get('failed'):
+            print('%-48s %10.2f %10s %10s %10s  (no baseline)' % (name, new['wall_time'], '', format_memory(new['peak_memory']), ''))
+            continue
+        time_change = change(new['wall_time'], old['wall_time'])
+        memory_change = change(new['peak_memory'], old['peak_memory'])
+        flag = ''
+        if (time_change is not None and time_change > tolerance) or (memory_change is not None and memory_change > tolerance):
+            flag = '  REGRESSION'
+            regressed.append(name)
+        print('%-48s %10.2f %s %10s %s%s' % (name, new['wall_time'], format_change(time_change),
+                                             format_memory(new['peak_memory']), format_change(memory_change), flag))
+
+        # The regions that took longest in this run, with their change in inclusive time
+        regions = sorted(new['regions'].items(), key=lambda item: -item[1]['inclusive'])[:num_regions]
+        for region, timing in regions:
+            old_timing = old['regions'].get(region)
+            old_inclusive = old_timing['inclusive'] if old_timing else None
+            print('    %-44s %10.2f %s' % (region, timing['inclusive'], format_change(change(timing['inclusive'], old_inclusive))))
+    return regressed
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--energyplus', required=True, help='EnergyPlus executable')
+    parser.add_argument('--source-dir', default=os.path.normpath(os.path.join(here, '..', '..', '..')),
+                        help='EnergyPlus source tree holding testfiles/ and weather/')
+    parser.add_argument('--output-dir', default=os.path.join(os.getcwd(), 'performance'),
+                        help='Directory for the runs and the results')
+    parser.add_argument('--files', default=os.path.join(here, 'performance_files.txt'), help='List of files to run')
+    parser.add_argument('--annual', action='store_true', help='Run the weather file run periods instead of the design days')
+    parser.add_argument('--repeat', type=int, default=1, help='Runs of each file; the fastest is kept')
+    parser.add_argument('--baseline', help='Results of an earlier run to compare with')
+    parser.add_argument('--save-baseline', help='Also write the results to this file for later comparisons')
+    parser.add_argument('--tolerance', type=float, default=0.1,
+                        help='Relative growth of wall time or peak memory reported as a regression')
+    parser.add_argument('--regions', type=int, default=8, help='Timed regions shown for each file')
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    results = {'annual': args.annual, 'files': {}}
+    for idf, epw in read_file_list(args.files):
+        name = os.path.splitext(idf)[0]
+        print('Running %s' % name)
+        sys.stdout.flush()
+        results['files'][name] = run_file(args, idf, epw)
+
+    with open(os.path.join(args.output_dir, 'performance_results.json'), 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    if args.save_baseline:
+        with open(args.save_baseline, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+
+    baseline = {'annual': args.annual, 'files': {}}
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if baseline.get('annual') != args.annual:
+            print('Warning: the baseline was run for a different simulation period')
+    regressed = compare(results, baseline, args.tolerance, args.regions)
+    if regressed:
+        print('Performance regressions or failed runs: %s' % ', '.join(regressed))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
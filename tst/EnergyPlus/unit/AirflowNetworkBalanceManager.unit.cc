@@ -50,3 +50,36 @@ TEST( AirflowNetworkBalanceManagerTest, TestOtherSideCoefficients )
 }
 
 
+
+TEST( AirflowNetworkBalanceManagerTest, NodeBalanceSolve )
+{
+
+	ShowMessage( "Begin Test: AirflowNetworkBalanceManagerTest, NodeBalanceSolve" );
+
+	// Chain of nodes fed from fixed node 1: x(k) = 0.9 x(k-1) + 0.5, solved by inverse and by elimination
+	for ( int n : { 10, MinNodesByElimination + 10 } ) {
+		MA.dimension( n * n, 0.0 );
+		MV.dimension( n, 0.0 );
+		IVEC.dimension( n + 20, 0 );
+		MA( 1 ) = 1.0e10;
+		MV( 1 ) = 20.0e10;
+		for ( int k = 2; k <= n; ++k ) {
+			MA( ( k - 1 ) * n + k ) = 1.0;
+			MA( ( k - 1 ) * n + k - 1 ) = -0.9;
+			MV( k ) = 0.5;
+		}
+
+		MRXSLV( n );
+
+		Real64 x( 20.0 );
+		EXPECT_NEAR( x, MV( 1 ), 1.0e-9 );
+		for ( int k = 2; k <= n; ++k ) {
+			x = 0.9 * x + 0.5;
+			EXPECT_NEAR( x, MV( k ), 1.0e-9 );
+		}
+	}
+
+	IVEC.deallocate();
+	MV.deallocate();
+	MA.deallocate();
+}
@@ -87,3 +87,56 @@ TEST( AirflowNetworkSolverTest, HorizontalOpening )
 }
 
 
+
+TEST( AirflowNetworkSolverTest, SkylineNodeOrder )
+{
+
+	ShowMessage( "Begin Test: AirflowNetworkSolverTest, SkylineNodeOrder" );
+
+	// Chain 1-4-2-3 of unknown pressure nodes with fixed pressure node 5 on node 1
+	NumOfNodesMultiZone = 0;
+	NetworkNumOfNodes = 5;
+	NetworkNumOfLinks = 4;
+	AirflowNetworkNodeData.allocate( NetworkNumOfNodes );
+	for ( int n = 1; n <= 4; ++n ) AirflowNetworkNodeData( n ).NodeTypeNum = 0;
+	AirflowNetworkNodeData( 5 ).NodeTypeNum = 1;
+	AirflowNetworkLinkageData.allocate( NetworkNumOfLinks );
+	AirflowNetworkLinkageData( 1 ).NodeNums( 1 ) = 1;
+	AirflowNetworkLinkageData( 1 ).NodeNums( 2 ) = 4;
+	AirflowNetworkLinkageData( 2 ).NodeNums( 1 ) = 4;
+	AirflowNetworkLinkageData( 2 ).NodeNums( 2 ) = 2;
+	AirflowNetworkLinkageData( 3 ).NodeNums( 1 ) = 2;
+	AirflowNetworkLinkageData( 3 ).NodeNums( 2 ) = 3;
+	AirflowNetworkLinkageData( 4 ).NodeNums( 1 ) = 5;
+	AirflowNetworkLinkageData( 4 ).NodeNums( 2 ) = 1;
+	ID.allocate( NetworkNumOfNodes );
+	IK.allocate( NetworkNumOfNodes + 1 );
+
+	SETSKY();
+
+	// Fixed pressure node first, then the chain in reverse Cuthill-McKee order
+	EXPECT_EQ( 1, ID( 5 ) );
+	EXPECT_EQ( 5, ID( 1 ) );
+	EXPECT_EQ( 4, ID( 4 ) );
+	EXPECT_EQ( 3, ID( 2 ) );
+	EXPECT_EQ( 2, ID( 3 ) );
+	// One off-diagonal entry per column of the chain (the input order needs four)
+	EXPECT_EQ( 4, IK( NetworkNumOfNodes + 1 ) );
+
+	// Multizone nodes 1-3 keep the leading positions
+	NumOfNodesMultiZone = 3;
+	SETSKY();
+	EXPECT_EQ( 3, ID( 1 ) );
+	EXPECT_EQ( 2, ID( 2 ) );
+	EXPECT_EQ( 1, ID( 3 ) );
+	EXPECT_EQ( 4, ID( 5 ) );
+	EXPECT_EQ( 5, ID( 4 ) );
+	NumOfNodesMultiZone = 0;
+
+	IK.deallocate();
+	ID.deallocate();
+	AirflowNetworkLinkageData.deallocate();
+	AirflowNetworkNodeData.deallocate();
+	NetworkNumOfLinks = 0;
+	NetworkNumOfNodes = 0;
+}
@@ -0,0 +1,60 @@
+// EnergyPlus::CompressedOutput Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// zlib Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CompressedOutput.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CompressedOutput;
+
+TEST( CompressedOutputTest, GzipMembers )
+{
+	ShowMessage( "Begin Test: CompressedOutputTest, GzipMembers" );
+
+	std::string const FileName( "CompressedOutputTest.eso.gz" );
+	std::ostringstream Expected;
+	{
+		std::ofstream File( FileName, std::ios_base::binary );
+		StartCompressedOutput( &File );
+		for ( int Line = 1; Line <= 200000; ++Line ) { // More than one block
+			File << "7," << Line << ".5\n";
+			Expected << "7," << Line << ".5\n";
+		}
+		File.flush();
+		StopCompressedOutput( &File );
+	}
+
+	// gzread reads the concatenated members as one stream
+	gzFile CompressedFile( gzopen( FileName.c_str(), "rb" ) );
+	ASSERT_TRUE( CompressedFile != nullptr );
+	std::string Contents;
+	char Buffer[ 65536 ];
+	int Read;
+	while ( ( Read = gzread( CompressedFile, Buffer, sizeof( Buffer ) ) ) > 0 ) Contents.append( Buffer, Read );
+	gzclose( CompressedFile );
+	EXPECT_EQ( Expected.str(), Contents );
+
+	// Each block starts a gzip member
+	std::ifstream Raw( FileName, std::ios_base::binary );
+	std::string const RawContents( ( std::istreambuf_iterator< char >( Raw ) ), std::istreambuf_iterator< char >() );
+	Raw.close();
+	EXPECT_EQ( '\x1f', RawContents[ 0 ] );
+	EXPECT_EQ( '\x8b', RawContents[ 1 ] );
+	EXPECT_GT( RawContents.size(), 0u );
+	EXPECT_LT( RawContents.size(), Contents.size() );
+
+	std::remove( FileName.c_str() );
+}
@@ -0,0 +1,90 @@
+// EnergyPlus::CondenserLoopTowers Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CondenserLoopTowers.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/General.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CondenserLoopTowers;
+using namespace EnergyPlus::DataLoopNode;
+using namespace ObjexxFCL;
+
+TEST( CondenserLoopTowersTest, VSTowerRangeBalance )
+{
+	ShowMessage( "Begin Test: CondenserLoopTowersTest, VSTowerRangeBalance" );
+
+	SimpleTower.allocate( 1 );
+	VSTower.allocate( 1 );
+	Node.allocate( 1 );
+	SimpleTower( 1 ).TowerModelType = YorkCalcModel;
+	SimpleTower( 1 ).VSTower = 1;
+	SimpleTower( 1 ).WaterInletNodeNum = 1;
+	VSTower( 1 ).Coeff.allocate( 35 );
+	VSTower( 1 ).Coeff = 0.0;
+	VSTower( 1 ).Coeff( 1 ) = -0.359741205;
+	VSTower( 1 ).Coeff( 2 ) = -0.055053608;
+	VSTower( 1 ).Coeff( 3 ) = 0.0023850432;
+	VSTower( 1 ).Coeff( 4 ) = 0.173926877;
+	VSTower( 1 ).Coeff( 5 ) = -0.0248473764;
+	VSTower( 1 ).Coeff( 6 ) = 0.00048430224;
+	VSTower( 1 ).Coeff( 7 ) = -0.005589849456;
+	VSTower( 1 ).Coeff( 8 ) = 0.0005770079712;
+	VSTower( 1 ).Coeff( 9 ) = -1.342427256e-05;
+	VSTower( 1 ).Coeff( 10 ) = 2.84765801111111;
+	VSTower( 1 ).Coeff( 11 ) = -0.121765149;
+	VSTower( 1 ).Coeff( 12 ) = 0.0014599242;
+	VSTower( 1 ).Coeff( 13 ) = 1.680428651;
+	VSTower( 1 ).Coeff( 14 ) = -0.0166920786;
+	VSTower( 1 ).Coeff( 15 ) = -0.0007190532;
+	VSTower( 1 ).Coeff( 16 ) = -0.025485194448;
+	VSTower( 1 ).Coeff( 17 ) = 4.87491696e-05;
+	VSTower( 1 ).Coeff( 18 ) = 2.719234152e-05;
+	VSTower( 1 ).Coeff( 19 ) = -0.0653766255555556;
+	VSTower( 1 ).Coeff( 20 ) = -0.002278167;
+	VSTower( 1 ).Coeff( 21 ) = 0.0002500254;
+	VSTower( 1 ).Coeff( 22 ) = -0.0910565458;
+	VSTower( 1 ).Coeff( 23 ) = 0.00318176316;
+	VSTower( 1 ).Coeff( 24 ) = 3.8621772e-05;
+	VSTower( 1 ).Coeff( 25 ) = -0.0034285382352;
+	VSTower( 1 ).Coeff( 26 ) = 8.56589904e-06;
+	VSTower( 1 ).Coeff( 27 ) = -1.516821552e-06;
+	VSTower( 1 ).MaxRangeTemp = 22.2222;
+
+	Real64 const Acc( 0.0001 );
+	Array1D< Real64 > Par( 4 );
+	int SolFla;
+	int SolFlaRegulaFalsi;
+	Real64 Tr;
+	Real64 TrRegulaFalsi;
+
+	// water flow rate ratio, air flow rate ratio, inlet air wet-bulb and inlet water temperatures
+	Real64 const Conditions[ 3 ][ 4 ] = { { 1.0, 1.0, 20.0, 30.0 }, { 0.8, 0.5, 15.0, 25.0 }, { 1.2, 0.3, 24.0, 32.0 } };
+	for ( auto const & Condition : Conditions ) {
+		Node( 1 ).Temp = Condition[ 3 ];
+		Par( 1 ) = 1.0;
+		Par( 2 ) = Condition[ 0 ];
+		Par( 3 ) = Condition[ 1 ];
+		Par( 4 ) = Condition[ 2 ];
+		General::SolveRegulaFalsi( Acc, 500, SolFlaRegulaFalsi, TrRegulaFalsi, SimpleTowerTrResidual, 0.001, VSTower( 1 ).MaxRangeTemp, Par );
+		SolveVSTowerRange( 1, Condition[ 0 ], Condition[ 1 ], Condition[ 2 ], Acc, 500, SolFla, Tr );
+		EXPECT_GT( SolFlaRegulaFalsi, 0 );
+		EXPECT_GT( SolFla, 0 );
+		EXPECT_NEAR( TrRegulaFalsi, Tr, 0.001 );
+		EXPECT_LT( std::abs( SimpleTowerTrResidual( Tr, Par ) ), Acc );
+	}
+
+	// no balance when the inlet water is colder than the inlet air wet-bulb
+	Node( 1 ).Temp = 10.0;
+	SolveVSTowerRange( 1, 1.0, 1.0, 20.0, Acc, 500, SolFla, Tr );
+	EXPECT_EQ( -2, SolFla );
+	EXPECT_DOUBLE_EQ( 0.001, Tr );
+
+	SimpleTower.deallocate();
+	VSTower.deallocate();
+	Node.deallocate();
+}
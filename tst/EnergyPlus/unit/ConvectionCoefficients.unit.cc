@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <ConvectionCoefficients.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -52,4 +53,20 @@ TEST( ConvectionCoefficientsTest, ConvectionCofficients )
 
 }
 
+TEST( ConvectionCoefficientsTest, ZoneIntConvFlowRegime )
+{
+
+	ShowMessage( "Begin Test: ConvectionCoefficientsTest, ZoneIntConvFlowRegime" );
+
+	int EquipFlowRegime( 0 );
+
+	// A zone without HVAC is in the buoyancy driven regime
+	DataHeatBalance::Zone.allocate( 1 );
+	DataHeatBalance::Zone( 1 ).IsControlled = false;
 
+	EXPECT_EQ( InConvFlowRegime_A3, CalcZoneIntConvFlowRegime( 1, EquipFlowRegime ) );
+	EXPECT_EQ( InConvFlowRegime_A3, EquipFlowRegime );
+
+	DataHeatBalance::Zone.deallocate();
+
+}
@@ -0,0 +1,62 @@
+// EnergyPlus::CurveManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+using namespace ObjexxFCL;
+
+TEST( CurveManagerTest, FindPerfCurveTableInterval )
+{
+	ShowMessage( "Begin Test: CurveManagerTest, FindPerfCurveTableInterval" );
+
+	PerfCurveTableDataStruct Table;
+	Table.X1.allocate( 5 );
+	Table.X1 = { 0.5, 1.0, 2.0, 4.0, 8.0 };
+	Table.X2.allocate( 4 );
+	Table.X2 = { 20.0, 10.0, 40.0, 30.0 }; // order of first appearance in the input
+	SetPerfCurveTableLimits( Table );
+	EXPECT_TRUE( Table.X1Ascending );
+	EXPECT_FALSE( Table.X2Ascending );
+	EXPECT_DOUBLE_EQ( 10.0, Table.X2Min );
+	EXPECT_DOUBLE_EQ( 40.0, Table.X2Max );
+
+	int LowPtr( 0 );
+	int HighPtr( 0 );
+
+	// Ascending values: limits, table values, and intervals found with and without the last interval
+	FindPerfCurveTableInterval( 0.1, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 1, LowPtr );
+	EXPECT_EQ( 1, HighPtr );
+	FindPerfCurveTableInterval( 9.0, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 5, LowPtr );
+	EXPECT_EQ( 5, HighPtr );
+	FindPerfCurveTableInterval( 3.0, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 3, LowPtr );
+	EXPECT_EQ( 4, HighPtr );
+	FindPerfCurveTableInterval( 2.5, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 3, LowPtr );
+	EXPECT_EQ( 4, HighPtr );
+	FindPerfCurveTableInterval( 4.0, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 4, LowPtr );
+	EXPECT_EQ( 4, HighPtr );
+	FindPerfCurveTableInterval( 0.7, Table.X1, Table.X1Min, Table.X1Max, Table.X1Ascending, Table.X1Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 1, LowPtr );
+	EXPECT_EQ( 2, HighPtr );
+
+	// Values out of order: last table value at or below the variable
+	FindPerfCurveTableInterval( 25.0, Table.X2, Table.X2Min, Table.X2Max, Table.X2Ascending, Table.X2Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 2, LowPtr );
+	EXPECT_EQ( 3, HighPtr );
+	FindPerfCurveTableInterval( 30.0, Table.X2, Table.X2Min, Table.X2Max, Table.X2Ascending, Table.X2Hint, LowPtr, HighPtr );
+	EXPECT_EQ( 4, LowPtr );
+	EXPECT_EQ( 4, HighPtr );
+}
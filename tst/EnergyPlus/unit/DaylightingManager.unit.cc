@@ -0,0 +1,66 @@
+// EnergyPlus::DaylightingManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array3D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataDaylighting.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DaylightingManager.hh>
+#include <EnergyPlus/General.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataDaylighting;
+using namespace EnergyPlus::DaylightingManager;
+using namespace ObjexxFCL;
+
+TEST( DaylightingManager, DayltgInterpolateHours )
+{
+	ShowMessage( "Begin Test: DaylightingManager, DayltgInterpolateHours" );
+
+	// Factors indexed (hour, reference point, window) as in the daylight factor arrays
+	int const NumWins( 5 );
+	Array3D< DaylFactorReal > Fac( 24, 2, NumWins );
+	for ( int Hour = 1; Hour <= 24; ++Hour ) {
+		for ( int IL = 1; IL <= 2; ++IL ) {
+			for ( int loop = 1; loop <= NumWins; ++loop ) {
+				Fac( Hour, IL, loop ) = 0.01f * Hour + 0.1f * IL + 0.25f * loop;
+			}
+		}
+	}
+	Array1D< Real64 > FacHr( NumWins, 0.0 );
+
+	DayltgInterpolateHours( NumWins, &Fac( 12, 2, 1 ), &Fac( 11, 2, 1 ), 0.75, 0.25, &FacHr( 1 ) );
+
+	for ( int loop = 1; loop <= NumWins; ++loop ) {
+		EXPECT_NEAR( 0.75 * Fac( 12, 2, loop ) + 0.25 * Fac( 11, 2, loop ), FacHr( loop ), 1.0e-12 );
+		EXPECT_NEAR( 0.1175 + 0.2 + 0.25 * loop, FacHr( loop ), 1.0e-6 );
+	}
+}
+
+TEST( DaylightingManager, InterpSlatAngSinglePrecision )
+{
+	ShowMessage( "Begin Test: DaylightingManager, InterpSlatAngSinglePrecision" );
+
+	using DataGlobals::Pi;
+	using DataSurfaces::MaxSlatAngs;
+	using General::InterpSlatAng;
+
+	Array1D< DaylFactorReal > FacFloat( MaxSlatAngs );
+	Array1D< Real64 > FacDouble( MaxSlatAngs );
+	for ( int i = 1; i <= MaxSlatAngs; ++i ) {
+		FacFloat( i ) = 0.5f + 0.125f * i;
+		FacDouble( i ) = 0.5 + 0.125 * i;
+	}
+
+	for ( Real64 SlatAng : { 0.0, 0.3, 1.0, Pi / 2.0, 2.9, Pi } ) {
+		EXPECT_NEAR( InterpSlatAng( SlatAng, true, FacDouble ), InterpSlatAng( SlatAng, true, FacFloat ), 1.0e-6 );
+	}
+	EXPECT_DOUBLE_EQ( 0.625, InterpSlatAng( 1.0, false, FacFloat ) );
+}
@@ -0,0 +1,86 @@
+// EnergyPlus::DisplayRoutines Unit Tests
+
+// C++ Headers
+#include <string>
+#include <thread>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DisplayRoutines.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+
+static std::vector< int > ProgressValues;
+static std::vector< int > ProgressEvents;
+static std::vector< std::string > Messages;
+static std::thread::id MessageThread;
+
+static void StoreProgress( int const Percent )
+{
+	ProgressValues.push_back( Percent );
+}
+
+static void StoreProgressEvent( int const Percent, int const EnvirNum, int const SimDay, int const SimDays )
+{
+	ProgressEvents.push_back( Percent );
+	ProgressEvents.push_back( EnvirNum );
+	ProgressEvents.push_back( SimDay );
+	ProgressEvents.push_back( SimDays );
+}
+
+static void StoreMessage( std::string const & Message )
+{
+	Messages.push_back( Message );
+	MessageThread = std::this_thread::get_id();
+}
+
+TEST( DisplayRoutinesTest, ProgressCallbacksOnChange )
+{
+	ShowMessage( "Begin Test: DisplayRoutinesTest, ProgressCallbacksOnChange" );
+
+	DataGlobals::fProgressPtr = StoreProgress;
+	DataGlobals::fProgressEventPtr = StoreProgressEvent;
+	DataEnvironment::CurEnvirNum = 1;
+	DisplaySimDaysProgress( 1, 365 ); // 0%
+	DisplaySimDaysProgress( 2, 365 ); // 1%
+	DisplaySimDaysProgress( 3, 365 ); // Still 1%: no callbacks
+	DataEnvironment::CurEnvirNum = 2;
+	DisplaySimDaysProgress( 3, 365 ); // Same percent, new environment
+
+	EXPECT_EQ( std::vector< int >( { 0, 1, 1 } ), ProgressValues );
+	EXPECT_EQ( std::vector< int >( { 0, 1, 1, 365, 1, 1, 2, 365, 1, 2, 3, 365 } ), ProgressEvents );
+
+	DataGlobals::fProgressPtr = nullptr;
+	DataGlobals::fProgressEventPtr = nullptr;
+	DataEnvironment::CurEnvirNum = 0;
+	ProgressValues.clear();
+	ProgressEvents.clear();
+}
+
+TEST( DisplayRoutinesTest, AsyncDisplayKeepsOrder )
+{
+	ShowMessage( "Begin Test: DisplayRoutinesTest, AsyncDisplayKeepsOrder" );
+
+	DataGlobals::fMessagePtr = StoreMessage;
+	StartAsyncDisplay();
+	DisplayString( "First" );
+	DisplayNumberAndString( 2, "Second" );
+	DisplayString( std::string( "Third" ) ); // Console only
+	StopAsyncDisplay();
+
+	EXPECT_EQ( std::vector< std::string >( { "First", "Second 2" } ), Messages );
+	EXPECT_NE( std::this_thread::get_id(), MessageThread );
+
+	DisplayString( "After" ); // Displayed directly once the display thread is stopped
+	EXPECT_EQ( "After", Messages.back() );
+	EXPECT_EQ( std::this_thread::get_id(), MessageThread );
+
+	DataGlobals::fMessagePtr = nullptr;
+	Messages.clear();
+}
@@ -0,0 +1,49 @@
+// EnergyPlus::FluidProperties Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+using namespace ObjexxFCL;
+
+TEST( FluidPropertiesTest, FindGridIndex )
+{
+	ShowMessage( "Begin Test: FluidPropertiesTest, FindGridIndex" );
+
+	// Unevenly spaced values, like the pressures of superheated refrigerant data
+	Array1D< Real64 > const Values( 9, { 1.0e3, 2.0e3, 5.0e3, 1.0e4, 2.5e4, 1.0e5, 1.01e5, 5.0e5, 3.0e6 } );
+	FluidPropsGridIndex Grid;
+
+	for ( int LowBound = 1; LowBound <= 3; ++LowBound ) {
+		int const UpperBound( Values.u() + 1 - LowBound );
+		InitializeFluidGridIndex( Grid, Values, LowBound, UpperBound );
+		EXPECT_FALSE( Grid.Index.empty() );
+		EXPECT_LE( Grid.Index.isize(), GridCellsPerPoint * ( UpperBound - LowBound + 1 ) );
+
+		// Same results as the search, also at and beyond the array values
+		for ( int Loop = Values.l(); Loop <= Values.u(); ++Loop ) {
+			for ( Real64 const Value : { Values( Loop ) * 0.999, Values( Loop ), Values( Loop ) * 1.001 } ) {
+				EXPECT_EQ( FindArrayIndex( Value, Values, LowBound, UpperBound ), FindGridIndex( Value, Values, LowBound, UpperBound, Grid ) );
+			}
+		}
+		for ( int Loop = 0; Loop <= 3000; ++Loop ) {
+			Real64 const Value( 1000.0 * Loop );
+			EXPECT_EQ( FindArrayIndex( Value, Values, LowBound, UpperBound ), FindGridIndex( Value, Values, LowBound, UpperBound, Grid ) );
+		}
+	}
+
+	// Two values (one interval): no grid, still the same results
+	InitializeFluidGridIndex( Grid, Values, 4, 5 );
+	EXPECT_TRUE( Grid.Index.empty() );
+	EXPECT_EQ( 4, FindGridIndex( 2.0e4, Values, 4, 5, Grid ) );
+	EXPECT_EQ( 0, FindGridIndex( 5.0e3, Values, 4, 5, Grid ) );
+	EXPECT_EQ( 5, FindGridIndex( 5.0e4, Values, 4, 5, Grid ) );
+}
@@ -257,3 +257,116 @@ TEST( SlinkyGroundHeatExchangerTest, CalcGroundHeatExchanger )
 	EXPECT_NEAR( 18.91819, thisGLHE.GFNC( 28 ), 0.0001 );
 
 }
+
+TEST( GroundHeatExchangerTest, MultiLevelAggregation )
+{
+	ShowMessage( "Begin Test: GroundHeatExchangerTest, MultiLevelAggregation" );
+
+	// Initialization
+	GLHEVert thisGLHE;
+
+	thisGLHE.initMultiLevelAggregation( 1.0 );
+
+	// The bins must span the year, with the first level one hour wide
+	int const numBins( thisGLHE.QnAggBin.size() );
+	EXPECT_EQ( numAggBinsPerLevel * thisGLHE.numAggLevels, numBins );
+	EXPECT_GE( thisGLHE.aggBinAge( numBins ), 8760.0 );
+	EXPECT_DOUBLE_EQ( 1.0, thisGLHE.aggBinAge( 1 ) );
+	EXPECT_DOUBLE_EQ( 2.0, thisGLHE.aggBinAge( 2 ) );
+
+	// The first level is a plain shift of the hourly loads
+	thisGLHE.shiftMultiLevelAggregation( 3.0 );
+	thisGLHE.shiftMultiLevelAggregation( 5.0 );
+	EXPECT_DOUBLE_EQ( 5.0, thisGLHE.QnAggBin( 1 ) );
+	EXPECT_DOUBLE_EQ( 3.0, thisGLHE.QnAggBin( 2 ) );
+
+	// The load held in the bins equals the load put in; a load moves at most one bin per hour,
+	// so none has reached the oldest bin yet
+	Real64 totalIn( 8.0 );
+	for ( int hour = 1; hour <= 60; ++hour ) {
+		Real64 const qn( 10.0 * std::sin( 0.3 * hour ) );
+		thisGLHE.shiftMultiLevelAggregation( qn );
+		totalIn += qn;
+	}
+	Real64 totalHeld( 0.0 );
+	for ( int binNum = 1; binNum <= numBins; ++binNum ) {
+		Real64 const binWidth( thisGLHE.aggBinAge( binNum ) - ( binNum > 1 ? thisGLHE.aggBinAge( binNum - 1 ) : 0.0 ) );
+		totalHeld += thisGLHE.QnAggBin( binNum ) * binWidth;
+	}
+	EXPECT_NEAR( totalIn, totalHeld, 1.0e-9 );
+}
+
+TEST( SlinkyGroundHeatExchangerTest, GFunctionCacheKey )
+{
+	ShowMessage( "Begin Test: SlinkyGroundHeatExchangerTest, GFunctionCacheKey" );
+
+	// Initialization
+	GLHESlinky thisGLHE;
+
+	thisGLHE.numCoils = 100;
+	thisGLHE.numTrenches = 2;
+	thisGLHE.maxSimYears = 10;
+	thisGLHE.coilPitch = 0.4;
+	thisGLHE.coilDepth = 1.5;
+	thisGLHE.coilDiameter = 0.8;
+	thisGLHE.pipeOutDia = 0.034;
+	thisGLHE.trenchSpacing = 3.0;
+	thisGLHE.diffusivityGround = 3.0e-007;
+
+	GLHESlinky sameGLHE( thisGLHE );
+	sameGLHE.Name = "ANOTHER NAME";
+	EXPECT_EQ( thisGLHE.gFunctionCacheKey(), sameGLHE.gFunctionCacheKey() );
+
+	// Any input the g-functions depend on changes the key
+	GLHESlinky otherGLHE( thisGLHE );
+	otherGLHE.diffusivityGround = 3.1e-007;
+	EXPECT_NE( thisGLHE.gFunctionCacheKey(), otherGLHE.gFunctionCacheKey() );
+	otherGLHE = thisGLHE;
+	otherGLHE.verticalConfig = true;
+	EXPECT_NE( thisGLHE.gFunctionCacheKey(), otherGLHE.gFunctionCacheKey() );
+}
+
+TEST( SlinkyGroundHeatExchangerTest, RingPairResponse )
+{
+	ShowMessage( "Begin Test: SlinkyGroundHeatExchangerTest, RingPairResponse" );
+
+	// Initialization
+	GLHESlinky thisGLHE;
+	RingPairPoints points;
+	Real64 const time( 36000.0 );
+
+	thisGLHE.numCoils = 4;
+	thisGLHE.numTrenches = 2;
+	thisGLHE.coilPitch = 0.4;
+	thisGLHE.coilDepth = 1.5;
+	thisGLHE.coilDiameter = 0.8;
+	thisGLHE.pipeOutDia = 0.034;
+	thisGLHE.trenchSpacing = 1.0;
+	thisGLHE.diffusivityGround = 3.0e-007;
+	thisGLHE.X0.allocate( thisGLHE.numCoils );
+	thisGLHE.Y0.allocate( thisGLHE.numTrenches );
+	for ( int coil = 1; coil <= thisGLHE.numCoils; ++coil ) {
+		thisGLHE.X0( coil ) = thisGLHE.coilPitch * ( coil - 1 );
+	}
+	for ( int trench = 1; trench <= thisGLHE.numTrenches; ++trench ) {
+		thisGLHE.Y0( trench ) = thisGLHE.trenchSpacing * ( trench - 1 );
+	}
+	thisGLHE.Z0 = thisGLHE.coilDepth;
+
+	// Horizontal rings: a ring with itself and with another ring in the same trench (half the points by symmetry)
+	thisGLHE.setupRingPairPoints( 1, 1, 1, 1, 33, 1089, points );
+	EXPECT_EQ( 33u * 1089u / 2u + 1u, points.halfDist1.size() );
+	EXPECT_NEAR( thisGLHE.doubleIntegral( 1, 1, 1, 1, time, 33, 1089 ), thisGLHE.ringPairResponse( points, time ), 1.0e-9 );
+	thisGLHE.setupRingPairPoints( 1, 3, 1, 1, 33, 561, points );
+	EXPECT_NEAR( thisGLHE.doubleIntegral( 1, 3, 1, 1, time, 33, 561 ), thisGLHE.ringPairResponse( points, time ), 1.0e-9 );
+
+	// Horizontal rings in different trenches use all points
+	thisGLHE.setupRingPairPoints( 2, 2, 1, 1, 33, 561, points );
+	EXPECT_EQ( 33u * 561u, points.halfDist1.size() );
+	EXPECT_NEAR( thisGLHE.doubleIntegral( 2, 2, 1, 1, time, 33, 561 ), thisGLHE.ringPairResponse( points, time ), 1.0e-9 );
+
+	// Vertical rings
+	thisGLHE.verticalConfig = true;
+	thisGLHE.setupRingPairPoints( 1, 2, 1, 1, 33, 561, points );
+	EXPECT_NEAR( thisGLHE.doubleIntegral( 1, 2, 1, 1, time, 33, 561 ), thisGLHE.ringPairResponse( points, time ), 1.0e-9 );
+}
@@ -0,0 +1,52 @@
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceHAMTManagerTest, SolveCellChain )
+{
+	ShowMessage( "Begin Test: HeatBalanceHAMTManagerTest, SolveCellChain" );
+
+	// Cells 3 to 7 of a chain, with the boundary cells 1-2 and 8 fixed (part of the right hand side)
+	int const first( 3 );
+	int const last( 7 );
+	celllower.dimension( 8, 0.0 );
+	celldiag.dimension( 8, 0.0 );
+	cellupper.dimension( 8, 0.0 );
+	cellrhs.dimension( 8, 0.0 );
+	Array1D< Real64 > expected( 8, 0.0 );
+	for ( int cid = first; cid <= last; ++cid ) {
+		expected( cid ) = 20.0 + 1.5 * cid;
+		if ( cid > first ) celllower( cid ) = -( 1.0 + 0.1 * cid );
+		if ( cid < last ) cellupper( cid ) = -( 2.0 - 0.1 * cid );
+		celldiag( cid ) = -celllower( cid ) - cellupper( cid ) + 0.5 * cid;
+	}
+	for ( int cid = first; cid <= last; ++cid ) {
+		cellrhs( cid ) = celldiag( cid ) * expected( cid );
+		if ( cid > first ) cellrhs( cid ) += celllower( cid ) * expected( cid - 1 );
+		if ( cid < last ) cellrhs( cid ) += cellupper( cid ) * expected( cid + 1 );
+	}
+
+	SolveCellChain( first, last );
+	for ( int cid = first; cid <= last; ++cid ) {
+		EXPECT_NEAR( expected( cid ), cellrhs( cid ), 1.0e-10 );
+	}
+	EXPECT_DOUBLE_EQ( 0.0, cellrhs( 2 ) ); // Cells outside the chain are not touched
+	EXPECT_DOUBLE_EQ( 0.0, cellrhs( 8 ) );
+
+	celllower.deallocate();
+	celldiag.deallocate();
+	cellupper.deallocate();
+	cellrhs.deallocate();
+}
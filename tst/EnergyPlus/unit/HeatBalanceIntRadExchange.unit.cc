@@ -0,0 +1,82 @@
+// EnergyPlus::HeatBalanceIntRadExchange Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceIntRadExchangeTest, CalcScriptFLowRankUpdate )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, CalcScriptFLowRankUpdate" );
+
+	// Cube with unit faces: every face sees each of the other five faces equally
+	int const N( 6 );
+	Array1D< Real64 > A( N, 1.0 );
+	Array2D< Real64 > F( N, N, 0.2 );
+	for ( int i = 1; i <= N; ++i ) {
+		F( i, i ) = 0.0;
+	}
+	Array1D< Real64 > EMISS( N, 0.9 );
+	Array2D< Real64 > ScriptF( N, N );
+	Array2D< Real64 > BaseCinverse;
+	Array1D< Real64 > BaseEMISS;
+
+	CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+	EXPECT_EQ( N, BaseEMISS.isize() );
+	Array2D< Real64 > const ScriptFBase( ScriptF );
+
+	// One surface (e.g. a window with an interior shade) changes emissivity: updated from the base inverse
+	EMISS( 2 ) = 0.3;
+	CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+	EXPECT_EQ( 0.9, BaseEMISS( 2 ) );
+
+	// Same emissivities from scratch
+	Array2D< Real64 > ScriptFFull( N, N );
+	Array2D< Real64 > FullCinverse;
+	Array1D< Real64 > FullEMISS;
+	CalcScriptF( N, A, F, EMISS, ScriptFFull, FullCinverse, FullEMISS );
+
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_NEAR( ScriptFFull( i, j ), ScriptF( i, j ), 1.0e-12 );
+		}
+	}
+
+	// Back to the base emissivities reproduces the original factors exactly
+	EMISS( 2 ) = 0.9;
+	CalcScriptF( N, A, F, EMISS, ScriptF, BaseCinverse, BaseEMISS );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_EQ( ScriptFBase( i, j ), ScriptF( i, j ) );
+		}
+	}
+}
+
+TEST( HeatBalanceIntRadExchangeTest, EnforceViewFactorReciprocity )
+{
+	ShowMessage( "Begin Test: HeatBalanceIntRadExchangeTest, EnforceViewFactorReciprocity" );
+
+	// Large enough to span several blocks
+	int const N( 150 );
+	Array2D< Real64 > AF( N, N );
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			AF( j, i ) = j + 1000.0 * i;
+		}
+	}
+	Array2D< Real64 > const AFOriginal( AF );
+
+	EnforceViewFactorReciprocity( N, AF );
+
+	for ( int i = 1; i <= N; ++i ) {
+		for ( int j = 1; j <= N; ++j ) {
+			EXPECT_EQ( 0.5 * ( AFOriginal( j, i ) + AFOriginal( i, j ) ), AF( j, i ) );
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include <HeatBalanceManager.hh>
 #include <InputProcessor.hh>
 #include <DataHeatBalance.hh>
+#include <DataHeatBalSurface.hh>
 #include <DataIPShortCuts.hh>
 #include <DataGlobals.hh>
 #include <DataStringGlobals.hh>
@@ -244,3 +245,59 @@ TEST( HeatBalanceManagerTest, GetWindowConstructData )
 	NominalRforNominalUCalculation.deallocate();
 	NominalR.deallocate();
 }
+
+TEST( HeatBalanceManagerTest, ExtrapolateWarmupHistories )
+{
+	ShowMessage( "Begin Test: HeatBalanceManagerTest, ExtrapolateWarmupHistories" );
+
+	using namespace DataHeatBalSurface;
+
+	// Warmup days converging geometrically to 20C at a daily rate of 0.5
+	TH.allocate( 2, 2, 1 );
+	QH.allocate( 2, 2, 1 );
+	THM.allocate( 2, 2, 1 );
+	QHM.allocate( 2, 2, 1 );
+	TempSurfIn.allocate( 1 );
+	TempSurfInTmp.allocate( 1 );
+	TempSurfOut.allocate( 1 );
+	WarmupHistoryDays = 0;
+	NumWarmupExtrapolations = 0;
+	Real64 const DayValues[] = { 25.0, 22.5, 21.25 };
+	for ( Real64 const Value : DayValues ) {
+		TH = Value;
+		QH = Value;
+		THM = Value;
+		QHM = Value;
+		TempSurfIn = Value;
+		TempSurfInTmp = Value;
+		TempSurfOut = Value;
+		ExtrapolateWarmupHistories();
+	}
+
+	EXPECT_EQ( 1, NumWarmupExtrapolations );
+	EXPECT_EQ( 1, WarmupHistoryDays );
+	EXPECT_NEAR( 20.0, TH( 1, 1, 1 ), 1.0e-10 );
+	EXPECT_NEAR( 20.0, TH( 2, 2, 1 ), 1.0e-10 );
+	EXPECT_NEAR( 20.0, QHM( 1, 2, 1 ), 1.0e-10 );
+	EXPECT_NEAR( 20.0, TempSurfOut( 1 ), 1.0e-10 );
+
+	// A change that does not shrink is not extrapolated
+	TH = 30.0;
+	ExtrapolateWarmupHistories();
+	TH = 40.0;
+	ExtrapolateWarmupHistories();
+	EXPECT_EQ( 1, NumWarmupExtrapolations );
+	EXPECT_EQ( 40.0, TH( 1, 1, 1 ) );
+
+	TH.deallocate();
+	QH.deallocate();
+	THM.deallocate();
+	QHM.deallocate();
+	TempSurfIn.deallocate();
+	TempSurfInTmp.deallocate();
+	TempSurfOut.deallocate();
+	WarmupHistoryState = WarmupStateData();
+	WarmupTHChange.deallocate();
+	WarmupHistoryDays = 0;
+	NumWarmupExtrapolations = 0;
+}
@@ -0,0 +1,189 @@
+// EnergyPlus::InputProcessor Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::InputProcessor;
+
+TEST( InputProcessorTest, ObjectRecordIndexes )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, ObjectRecordIndexes" );
+
+	NumObjectDefs = 2;
+	ObjectDef.allocate( NumObjectDefs );
+	ObjectDef( 1 ).Name = "ZONE";
+	ObjectDef( 1 ).NumFound = 2;
+	ObjectDef( 2 ).Name = "BRANCH";
+	ObjectDef( 2 ).NumFound = 1;
+	ObjectDefIndex.clear();
+	ObjectDefIndex.emplace( "ZONE", 1 );
+	ObjectDefIndex.emplace( "BRANCH", 2 );
+	ObjectStartRecord.dimension( NumObjectDefs, 0 );
+	ObjectStartRecord( 1 ) = 1;
+	ObjectStartRecord( 2 ) = 2;
+
+	NumIDFRecords = 3;
+	IDFRecords.allocate( NumIDFRecords );
+	IDFRecords( 1 ).Name = "ZONE";
+	IDFRecords( 2 ).Name = "BRANCH";
+	IDFRecords( 3 ).Name = "ZONE";
+	for ( int Record = 1; Record <= NumIDFRecords; ++Record ) {
+		IDFRecords( Record ).NumAlphas = 1;
+		IDFRecords( Record ).Alphas.allocate( 1 );
+	}
+	IDFRecords( 1 ).Alphas( 1 ) = "LIVING";
+	IDFRecords( 2 ).Alphas( 1 ) = "MAIN BRANCH";
+	IDFRecords( 3 ).Alphas( 1 ) = "ATTIC";
+
+	SetObjectRecords();
+	EXPECT_EQ( 3, NumObjectRecordsSet );
+	ASSERT_EQ( 2u, ObjectRecords( 1 ).size() );
+	EXPECT_EQ( 1, ObjectRecords( 1 )[ 0 ] );
+	EXPECT_EQ( 3, ObjectRecords( 1 )[ 1 ] );
+	ASSERT_EQ( 1u, ObjectRecords( 2 ).size() );
+	EXPECT_EQ( 2, ObjectRecords( 2 )[ 0 ] );
+
+	EXPECT_EQ( 2, FindObjectDefinition( "BRANCH" ) );
+	EXPECT_EQ( 1, FindObjectDefinition( "Zone" ) );
+	EXPECT_EQ( 0, FindObjectDefinition( "Building" ) );
+
+	EXPECT_EQ( 2, GetObjectItemNum( "Zone", "ATTIC" ) );
+	EXPECT_EQ( 1, GetObjectItemNum( "ZONE", "LIVING" ) );
+	EXPECT_EQ( 0, GetObjectItemNum( "Zone", "MAIN BRANCH" ) );
+	EXPECT_EQ( -1, GetObjectItemNum( "Building", "ATTIC" ) );
+
+	std::unordered_map< std::string, int > NameIndex;
+	NameIndex.emplace( "LIVING", 1 );
+	NameIndex.emplace( "ATTIC", 2 );
+	EXPECT_EQ( 2, FindItemInList( "ATTIC", NameIndex ) );
+	EXPECT_EQ( 0, FindItemInList( "Attic", NameIndex ) );
+
+	ObjectRecords.deallocate();
+	ObjectItemNums.deallocate();
+	NumObjectRecordsSet = -1;
+	ObjectDefIndex.clear();
+	IDFRecords.deallocate();
+	NumIDFRecords = 0;
+	ObjectStartRecord.deallocate();
+	ObjectDef.deallocate();
+	NumObjectDefs = 0;
+}
+
+TEST( InputProcessorTest, IDDSnapshot )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, IDDSnapshot" );
+
+	std::istringstream idd_stream( "!IDD_Version 8.3.0\n\\group Simulation Parameters\n" );
+	std::string IDDVersion;
+	std::uint64_t const Key( IDDSnapshotKey( idd_stream, IDDVersion ) );
+	EXPECT_EQ( "IDD_Version 8.3.0", IDDVersion );
+	EXPECT_EQ( 0, idd_stream.tellg() );
+	std::string const FileName( IDDSnapshotFileName( Key ) );
+
+	DataStringGlobals::IDDVerString = IDDVersion;
+	NumSectionDefs = 1;
+	MaxSectionDefs = 2;
+	SectionDef.allocate( MaxSectionDefs );
+	SectionDef( 1 ).Name = "LEAD INPUT";
+	NumObjectDefs = 1;
+	MaxObjectDefs = 3;
+	ObjectDef.allocate( MaxObjectDefs );
+	ObjectDef( 1 ).Name = "Timestep";
+	ObjectDef( 1 ).NumParams = 2;
+	ObjectDef( 1 ).NumAlpha = 1;
+	ObjectDef( 1 ).NumNumeric = 1;
+	ObjectDef( 1 ).UniqueObject = true;
+	ObjectDef( 1 ).ObsPtr = 1;
+	ObjectDef( 1 ).AlphaOrNumeric.allocate( 2 );
+	ObjectDef( 1 ).AlphaOrNumeric( 1 ) = true;
+	ObjectDef( 1 ).AlphaOrNumeric( 2 ) = false;
+	ObjectDef( 1 ).ReqField.dimension( 2, false );
+	ObjectDef( 1 ).AlphRetainCase.dimension( 2, false );
+	ObjectDef( 1 ).AlphFieldChks.dimension( 1, "NAME" );
+	ObjectDef( 1 ).AlphFieldDefs.dimension( 1, "" );
+	ObjectDef( 1 ).NumRangeChks.allocate( 1 );
+	ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxChk = true;
+	ObjectDef( 1 ).NumRangeChks( 1 ).FieldName = "Number of Timesteps per Hour";
+	ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxString( 1 ) = ">=1";
+	ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxValue( 2 ) = 60.0;
+	ObjectDef( 1 ).NumRangeChks( 1 ).WhichMinMax( 2 ) = 3;
+	ObjectDef( 1 ).NumRangeChks( 1 ).Default = 6.0;
+	NumObsoleteObjects = 1;
+	ObsoleteObjectsRepNames.dimension( 1, "Timestep" );
+	MaxAlphaArgsFound = 1;
+	MaxNumericArgsFound = 1;
+	NumAlphaArgsFound = 1;
+	NumNumericArgsFound = 1;
+
+	WriteIDDSnapshot( FileName, Key );
+	ObjectDef.deallocate();
+	SectionDef.deallocate();
+	NumObjectDefs = 0;
+	NumObsoleteObjects = 0;
+
+	EXPECT_FALSE( ReadIDDSnapshot( FileName, Key, "IDD_Version 8.4.0" ) );
+	EXPECT_FALSE( ReadIDDSnapshot( FileName, Key + 1, IDDVersion ) );
+	EXPECT_FALSE( ObjectDef.allocated() );
+
+	ASSERT_TRUE( ReadIDDSnapshot( FileName, Key, IDDVersion ) );
+	EXPECT_EQ( 1, NumSectionDefs );
+	EXPECT_EQ( 2, SectionDef.isize() );
+	EXPECT_EQ( "LEAD INPUT", SectionDef( 1 ).Name );
+	EXPECT_EQ( 1, NumObjectDefs );
+	EXPECT_EQ( 3, ObjectDef.isize() );
+	EXPECT_EQ( "Timestep", ObjectDef( 1 ).Name );
+	EXPECT_EQ( 2, ObjectDef( 1 ).NumParams );
+	EXPECT_TRUE( ObjectDef( 1 ).UniqueObject );
+	EXPECT_FALSE( ObjectDef( 1 ).RequiredObject );
+	EXPECT_TRUE( ObjectDef( 1 ).AlphaOrNumeric( 1 ) );
+	EXPECT_FALSE( ObjectDef( 1 ).AlphaOrNumeric( 2 ) );
+	EXPECT_EQ( "NAME", ObjectDef( 1 ).AlphFieldChks( 1 ) );
+	ASSERT_EQ( 1, ObjectDef( 1 ).NumRangeChks.isize() );
+	EXPECT_TRUE( ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxChk );
+	EXPECT_EQ( ">=1", ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxString( 1 ) );
+	EXPECT_EQ( 60.0, ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxValue( 2 ) );
+	EXPECT_EQ( 3, ObjectDef( 1 ).NumRangeChks( 1 ).WhichMinMax( 2 ) );
+	EXPECT_EQ( 6.0, ObjectDef( 1 ).NumRangeChks( 1 ).Default );
+	EXPECT_EQ( 1, NumObsoleteObjects );
+	EXPECT_EQ( "Timestep", ObsoleteObjectsRepNames( 1 ) );
+
+	std::remove( FileName.c_str() );
+	ObsoleteObjectsRepNames.deallocate();
+	NumObsoleteObjects = 0;
+	MaxAlphaArgsFound = 0;
+	MaxNumericArgsFound = 0;
+	NumAlphaArgsFound = 0;
+	NumNumericArgsFound = 0;
+	ObjectDef.deallocate();
+	NumObjectDefs = 0;
+	MaxObjectDefs = 0;
+	SectionDef.deallocate();
+	NumSectionDefs = 0;
+	MaxSectionDefs = 0;
+	DataStringGlobals::IDDVerString.clear();
+}
+
+TEST( InputProcessorTest, InternName )
+{
+	ShowMessage( "Begin Test: InputProcessorTest, InternName" );
+
+	int const ThermostatID( InternName( "Zone 1 Thermostat" ) );
+	EXPECT_GT( ThermostatID, 0 );
+	EXPECT_EQ( ThermostatID, InternName( "ZONE 1 THERMOSTAT" ) );
+	EXPECT_EQ( ThermostatID, FindInternedName( "zone 1 thermostat" ) );
+	EXPECT_EQ( "ZONE 1 THERMOSTAT", InternedNames[ ThermostatID - 1 ] );
+
+	int const HumidistatID( InternName( "Zone 1 Humidistat" ) );
+	EXPECT_NE( ThermostatID, HumidistatID );
+	EXPECT_EQ( 0, FindInternedName( "Zone 2 Thermostat" ) );
+}
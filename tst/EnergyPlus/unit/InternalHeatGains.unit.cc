@@ -0,0 +1,67 @@
+// EnergyPlus::InternalHeatGains Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/HeatBalanceInternalHeatGains.hh>
+#include <EnergyPlus/InternalHeatGains.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::InternalHeatGains;
+using namespace ObjexxFCL;
+
+TEST( InternalHeatGains, ZoneGainSums )
+{
+	ShowMessage( "Begin Test: InternalHeatGains, ZoneGainSums" );
+
+	Real64 PeopleConv( 100.0 );
+	Real64 PeopleRad( 50.0 );
+	Real64 PeopleLat( 40.0 );
+	Real64 PeopleCO2( 1.e-6 );
+	Real64 LightsConv( 30.0 );
+	Real64 LightsRetAir( 20.0 );
+	Real64 LightsRad( 60.0 );
+
+	DataGlobals::NumOfZones = 1;
+	ZoneIntGain.allocate( 1 );
+	SetupZoneInternalGain( 1, ZoneIntGainDeviceTypes( IntGainTypeOf_People ), "People 1", IntGainTypeOf_People, PeopleConv, _, PeopleRad, PeopleLat, _, PeopleCO2 );
+	SetupZoneInternalGain( 1, ZoneIntGainDeviceTypes( IntGainTypeOf_Lights ), "Lights 1", IntGainTypeOf_Lights, LightsConv, LightsRetAir, LightsRad );
+
+	UpdateInternalGainValues();
+
+	Real64 Sum( 0.0 );
+	SumAllInternalConvectionGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 130.0, Sum );
+	SumAllReturnAirConvectionGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 20.0, Sum );
+	SumAllInternalRadiationGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 110.0, Sum );
+	SumAllInternalLatentGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 40.0, Sum );
+	SumAllInternalCO2Gains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 1.e-6, Sum );
+
+	Array1D_int LightsType( 1, IntGainTypeOf_Lights );
+	SumInternalConvectionGainsByTypes( 1, LightsType, Sum );
+	EXPECT_DOUBLE_EQ( 30.0, Sum );
+	SumInternalRadiationGainsByTypes( 1, LightsType, Sum );
+	EXPECT_DOUBLE_EQ( 60.0, Sum );
+	SumInternalLatentGainsByTypes( 1, LightsType, Sum );
+	EXPECT_DOUBLE_EQ( 0.0, Sum );
+
+	// the sums only follow the device gains when the stored values are updated
+	PeopleConv = 200.0;
+	SumAllInternalConvectionGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 130.0, Sum );
+	UpdateInternalGainValues();
+	SumAllInternalConvectionGains( 1, Sum );
+	EXPECT_DOUBLE_EQ( 230.0, Sum );
+
+	DataGlobals::NumOfZones = 0;
+	ZoneIntGain.deallocate();
+}
@@ -51,3 +51,37 @@ TEST( ManageElectricPowerTest, BatteryDischargeTest )
 
 	PerfCurve.deallocate();
 }
+
+TEST( ManageElectricPowerTest, RainflowCycleCounting )
+{
+	ShowMessage( "Begin Test: ManageElectricPowerTest, RainflowCycleCounting" );
+
+	// fractional state of charge at each peak and valley
+	int const numPoints( 8 );
+	Array1D< Real64 > SOC( numPoints, { 0.5, 0.8, 0.3, 0.9, 0.2, 0.6, 0.4, 0.7 } );
+	int const numBin( 10 );
+	int const dim( 10 );
+	Array1D< Real64 > B1( dim, 0.0 );
+	Array1D< Real64 > X( dim, 0.0 );
+	Array1D< Real64 > Nmb( numBin, 0.0 );
+	Array1D< Real64 > OneNmb( numBin, 0.0 );
+	int count( 2 );
+	B1( 1 ) = SOC( 1 );
+	for ( int i = 2; i <= numPoints; ++i ) {
+		B1( count ) = SOC( i );
+		Rainflow( numBin, SOC( i ), B1, X, count, Nmb, OneNmb, dim );
+	}
+
+	// one full cycle and three half cycles counted, with 0.9, 0.2 and 0.7 still to be counted
+	EXPECT_EQ( 4, count );
+	EXPECT_DOUBLE_EQ( 0.0, Nmb( 1 ) );
+	EXPECT_DOUBLE_EQ( 1.0, Nmb( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, Nmb( 3 ) );
+	EXPECT_DOUBLE_EQ( 0.5, Nmb( 4 ) );
+	EXPECT_DOUBLE_EQ( 0.0, Nmb( 5 ) );
+	EXPECT_DOUBLE_EQ( 0.5, Nmb( 6 ) );
+	EXPECT_DOUBLE_EQ( 0.5, Nmb( 7 ) );
+	EXPECT_DOUBLE_EQ( 0.0, Nmb( 8 ) );
+	EXPECT_DOUBLE_EQ( 1.0, OneNmb( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.5, OneNmb( 7 ) );
+}
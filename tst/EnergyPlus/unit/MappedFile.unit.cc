@@ -0,0 +1,59 @@
+// EnergyPlus::MappedFileBuf Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <istream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/stream.functions.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/MappedFile.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+
+TEST( MappedFileTest, ReadLines )
+{
+	ShowMessage( "Begin Test: MappedFileTest, ReadLines" );
+
+	std::string const FileName( "MappedFileTest.idf" );
+	{
+		std::ofstream File( FileName, std::ios_base::binary );
+		File << "Version,8.3;\r\n\r\nTimestep,6;\n  ! comment";
+	}
+
+	MappedFileBuf buf( FileName );
+	ASSERT_TRUE( buf.is_open() );
+	EXPECT_EQ( 39u, buf.size() );
+	std::istream stream( &buf );
+	std::string Line;
+	cross_platform_get_line( stream, Line );
+	EXPECT_EQ( "Version,8.3;", Line );
+	cross_platform_get_line( stream, Line );
+	EXPECT_EQ( "", Line );
+	cross_platform_get_line( stream, Line );
+	EXPECT_EQ( "Timestep,6;", Line );
+	cross_platform_get_line( stream, Line );
+	EXPECT_EQ( "  ! comment", Line );
+	EXPECT_FALSE( cross_platform_get_line( stream, Line ) );
+
+	stream.clear();
+	stream.seekg( 0, std::ios::beg );
+	cross_platform_get_line( stream, Line );
+	EXPECT_EQ( "Version,8.3;", Line );
+	EXPECT_EQ( 14, stream.tellg() );
+
+	buf.close();
+	EXPECT_FALSE( buf.is_open() );
+	std::remove( FileName.c_str() );
+
+	MappedFileBuf missing( "MappedFileTest.missing.idf" );
+	EXPECT_FALSE( missing.is_open() );
+}
@@ -0,0 +1,53 @@
+// EnergyPlus::MemoryAccounting Unit Tests
+
+// C++ Headers
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array3D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/MemoryAccounting.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::MemoryAccounting;
+using namespace ObjexxFCL;
+
+TEST( MemoryAccountingTest, ArrayMegabytes )
+{
+	ShowMessage( "Begin Test: MemoryAccountingTest, ArrayMegabytes" );
+
+	Array3D< Real64 > Values( 4, 16, 2048 ); // 131072 values
+	EXPECT_DOUBLE_EQ( 1.0, ArrayMegabytes( Values ) );
+
+	Array3D< Real64 > Empty;
+	EXPECT_DOUBLE_EQ( 0.0, ArrayMegabytes( Empty ) );
+}
+
+TEST( MemoryAccountingTest, GatherMemoryUsage )
+{
+	ShowMessage( "Begin Test: MemoryAccountingTest, GatherMemoryUsage" );
+
+	DataHeatBalance::SunlitFrac.allocate( 4, 24, 2048 ); // 196608 values
+	std::vector< MemoryUsageEntry > Entries;
+	GatherMemoryUsage( Entries );
+
+	bool Found( false );
+	for ( auto const & entry : Entries ) {
+		if ( entry.Array == "SunlitFrac" ) {
+			Found = true;
+			EXPECT_EQ( "DataHeatBalance", entry.Module );
+			EXPECT_DOUBLE_EQ( 1.5, entry.Size );
+		} else if ( entry.Array == "BackSurfaces" ) {
+			EXPECT_DOUBLE_EQ( 0.0, entry.Size );
+		}
+	}
+	EXPECT_TRUE( Found );
+
+	DataHeatBalance::SunlitFrac.deallocate();
+}
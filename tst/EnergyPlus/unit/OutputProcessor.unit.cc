@@ -1,9 +1,19 @@
 // EnergyPlus::OutputProcessor Unit Tests
 
+// C++ Headers
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataOutputs.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/OutputProcessor.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
@@ -61,3 +71,238 @@ TEST( OutputProcessor, TestGetMeteredVariables )
 	VarMeterArrays.deallocate();
 	EnergyMeters.deallocate();
 }
+
+TEST( OutputProcessor, BinaryOutputColumns )
+{
+	ShowMessage( "Begin Test: OutputProcessor, BinaryOutputColumns" );
+
+	std::string const SaveEsoFileName( DataStringGlobals::outputEsoFileName );
+	DataStringGlobals::outputEsoFileName = "OutputProcessorBinaryOutputColumns.eso";
+	DataSystemVariables::BinaryOutput = true;
+
+	OpenBinaryOutput();
+	WriteBinaryOutputValue( 7, 1.5 );
+	WriteBinaryOutputValue( 9, 2.0, -1.0, 101, 3.0, 202 );
+	WriteBinaryOutputValue( 7, 2.5 );
+	CloseBinaryOutput();
+
+	DataSystemVariables::BinaryOutput = false;
+	DataStringGlobals::outputEsoFileName = SaveEsoFileName;
+
+	std::ifstream BinaryFile( "OutputProcessorBinaryOutputColumns.esob", std::ios::binary );
+	ASSERT_TRUE( BinaryFile.good() );
+	char Magic[ 8 ];
+	BinaryFile.read( Magic, sizeof( Magic ) );
+	EXPECT_EQ( "EPESOB01", std::string( Magic, sizeof( Magic ) ) );
+
+	// Report ID 7: two records of stamp count and value
+	std::int32_t Header[ 3 ];
+	BinaryFile.read( reinterpret_cast< char * >( Header ), sizeof( Header ) );
+	EXPECT_EQ( 7, Header[ 0 ] );
+	EXPECT_EQ( 2, Header[ 1 ] );
+	EXPECT_EQ( 2, Header[ 2 ] );
+	Real64 Values7[ 4 ];
+	BinaryFile.read( reinterpret_cast< char * >( Values7 ), sizeof( Values7 ) );
+	EXPECT_EQ( 0.0, Values7[ 0 ] );
+	EXPECT_EQ( 1.5, Values7[ 1 ] );
+	EXPECT_EQ( 0.0, Values7[ 2 ] );
+	EXPECT_EQ( 2.5, Values7[ 3 ] );
+
+	// Report ID 9: one record with the minimum and maximum and their dates
+	BinaryFile.read( reinterpret_cast< char * >( Header ), sizeof( Header ) );
+	EXPECT_EQ( 9, Header[ 0 ] );
+	EXPECT_EQ( 6, Header[ 1 ] );
+	EXPECT_EQ( 1, Header[ 2 ] );
+	Real64 Values9[ 6 ];
+	BinaryFile.read( reinterpret_cast< char * >( Values9 ), sizeof( Values9 ) );
+	EXPECT_EQ( 2.0, Values9[ 1 ] );
+	EXPECT_EQ( -1.0, Values9[ 2 ] );
+	EXPECT_EQ( 101.0, Values9[ 3 ] );
+	EXPECT_EQ( 3.0, Values9[ 4 ] );
+	EXPECT_EQ( 202.0, Values9[ 5 ] );
+
+	BinaryFile.peek();
+	EXPECT_TRUE( BinaryFile.eof() );
+	BinaryFile.close();
+	std::remove( "OutputProcessorBinaryOutputColumns.esob" );
+}
+
+namespace {
+	std::vector< std::pair< int, Real64 > > StreamedValues;
+
+	int
+	StreamDictionaryItem( int const, int const, std::string const &, std::string const & variableName, std::string const & )
+	{
+		if ( variableName == "Zone Mean Air Temperature" ) return 2;
+		if ( variableName == "Zone Air Relative Humidity" ) return 1;
+		return 0;
+	}
+
+	void
+	StreamValue( int const reportID, Real64 const value )
+	{
+		StreamedValues.emplace_back( reportID, value );
+	}
+}
+
+TEST( OutputProcessor, ReportValueStreaming )
+{
+	ShowMessage( "Begin Test: OutputProcessor, ReportValueStreaming" );
+
+	std::ostringstream eso;
+	std::ostream * const SaveEsoStream( eso_stream );
+	eso_stream = &eso;
+	fReportDictionaryPtr = StreamDictionaryItem;
+	fReportValuePtr = StreamValue;
+	StreamedValues.clear();
+
+	WriteReportVariableDictionaryItem( ReportTimeStep, SummedVar, 901, 1, "Zone", "901", "LIVING", "Zone Mean Air Temperature", 1, "C", _ );
+	WriteReportVariableDictionaryItem( ReportTimeStep, SummedVar, 902, 1, "Zone", "902", "LIVING", "Zone Air Relative Humidity", 1, "%", _ );
+	WriteReportVariableDictionaryItem( ReportTimeStep, SummedVar, 903, 1, "Zone", "903", "LIVING", "Zone Air Humidity Ratio", 1, "", _ );
+	eso.str( "" );
+
+	WriteRealData( 901, "901", 21.5 );
+	WriteRealData( 902, "902", 40.0 );
+	WriteRealData( 903, "903", 0.01 );
+
+	ASSERT_EQ( 2u, StreamedValues.size() );
+	EXPECT_EQ( 901, StreamedValues[ 0 ].first );
+	EXPECT_EQ( 21.5, StreamedValues[ 0 ].second );
+	EXPECT_EQ( 902, StreamedValues[ 1 ].first );
+	EXPECT_EQ( 40.0, StreamedValues[ 1 ].second );
+	EXPECT_EQ( std::string::npos, eso.str().find( "901," ) ); // Streamed only
+	EXPECT_NE( std::string::npos, eso.str().find( "902," ) );
+	EXPECT_NE( std::string::npos, eso.str().find( "903," ) );
+
+	fReportDictionaryPtr = nullptr;
+	fReportValuePtr = nullptr;
+	eso_stream = SaveEsoStream;
+	StreamedValues.clear();
+}
+
+TEST( OutputProcessor, MeterScatterMatchesMeterLists )
+{
+	ShowMessage( "Begin Test: OutputProcessor, MeterScatterMatchesMeterLists" );
+
+	NumOfRVariable = 3;
+	RVariableTypes.allocate( NumOfRVariable );
+	Array1D< Reference< RealVariables > > RVars( NumOfRVariable );
+	for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+		RVars( Loop ).allocate();
+		RVariableTypes( Loop ).VarPtr = RVars( Loop );
+	}
+	RVariableTypes( 1 ).IndexType = 2;
+	RVariableTypes( 2 ).IndexType = 1;
+	RVariableTypes( 3 ).IndexType = 1;
+	RVars( 1 )().MeterArrayPtr = 1;
+	RVars( 2 )().MeterArrayPtr = 2;
+	RVars( 3 )().MeterArrayPtr = 0; // Not metered
+
+	NumVarMeterArrays = 2;
+	VarMeterArrays.allocate( NumVarMeterArrays );
+	VarMeterArrays( 1 ).NumOnMeters = 2;
+	VarMeterArrays( 1 ).OnMeters( 1 ) = 1;
+	VarMeterArrays( 1 ).OnMeters( 2 ) = 3;
+	VarMeterArrays( 2 ).NumOnMeters = 1;
+	VarMeterArrays( 2 ).OnMeters( 1 ) = 1;
+	VarMeterArrays( 2 ).OnCustomMeters.allocate( 1 );
+	VarMeterArrays( 2 ).NumOnCustomMeters = 1;
+	VarMeterArrays( 2 ).OnCustomMeters( 1 ) = 4;
+
+	NumEnergyMeters = 4;
+	MeterValue.dimension( NumEnergyMeters, 0.0 );
+	MeterValue( 3 ) = 1.0;
+
+	CompileMeterScatter();
+	ASSERT_EQ( 5u, MeterScatterRowStart.size() );
+	EXPECT_EQ( 0, MeterScatterRowStart[ 0 ] );
+	EXPECT_EQ( 2, MeterScatterRowStart[ 1 ] );
+	EXPECT_EQ( 2, MeterScatterRowStart[ 2 ] );
+	EXPECT_EQ( 3, MeterScatterRowStart[ 3 ] );
+	EXPECT_EQ( 4, MeterScatterRowStart[ 4 ] );
+	// Zone variables are added before HVAC variables, as in UpdateDataandReport
+	EXPECT_EQ( 2, MeterScatterVarMeter[ 0 ] );
+	EXPECT_EQ( 1, MeterScatterVarMeter[ 1 ] );
+
+	VarMeterValue[ 1 ] = 10.0;
+	VarMeterValue[ 2 ] = 0.5;
+	ScatterMeterValues();
+	EXPECT_EQ( 10.5, MeterValue( 1 ) );
+	EXPECT_EQ( 0.0, MeterValue( 2 ) );
+	EXPECT_EQ( 11.0, MeterValue( 3 ) );
+	EXPECT_EQ( 0.5, MeterValue( 4 ) );
+
+	// Clean up
+	for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+		RVars( Loop ).deallocate();
+	}
+	NumOfRVariable = 0;
+	RVariableTypes.deallocate();
+	NumVarMeterArrays = 0;
+	VarMeterArrays.deallocate();
+	NumEnergyMeters = 0;
+	MeterValue.deallocate();
+	MeterScatterCompiled = false;
+	MeterScatterRowStart.clear();
+	MeterScatterVarMeter.clear();
+	VarMeterValue.clear();
+}
+
+TEST( OutputProcessor, OutputVariableIsStored )
+{
+	ShowMessage( "Begin Test: OutputProcessor, OutputVariableIsStored" );
+
+	DataOutputs::NumConsideredOutputVariables = 2;
+	DataOutputs::OutputVariablesForSimulation.allocate( 2 );
+	DataOutputs::OutputVariablesForSimulation( 1 ) = DataOutputs::OutputReportingVariables( "WINDOW 1", "SURFACE OUTSIDE FACE SUNLIT AREA", 0, 0 );
+	DataOutputs::OutputVariablesForSimulation( 2 ) = DataOutputs::OutputReportingVariables( "*", "UNITARY SYSTEM TOTAL COOLING RATE", 0, 0 );
+
+	EXPECT_TRUE( OutputVariableIsStored( "Window 1", "Surface Outside Face Sunlit Area [m2]" ) );
+	EXPECT_FALSE( OutputVariableIsStored( "Window 2", "Surface Outside Face Sunlit Area" ) );
+	EXPECT_FALSE( OutputVariableIsStored( "Window 1", "Surface Outside Face Sunlit Fraction" ) );
+	EXPECT_TRUE( OutputVariableIsStored( "Any Unit", "Unitary System Total Cooling Rate" ) );
+
+	DataOutputs::NumConsideredOutputVariables = 0;
+	DataOutputs::OutputVariablesForSimulation.deallocate();
+}
+
+TEST( OutputProcessor, CsvOutputRows )
+{
+	ShowMessage( "Begin Test: OutputProcessor, CsvOutputRows" );
+
+	std::string const SaveCsvFileName( DataStringGlobals::outputCsvFileName );
+	DataStringGlobals::outputCsvFileName = "OutputProcessorCsvOutputRows.csv";
+	DataSystemVariables::CsvOutput = true;
+
+	OpenCsvOutput();
+	AddCsvOutputColumn( 7, ReportHourly, "ZONE ONE:Zone Mean Air Temperature", "C" );
+	AddCsvOutputColumn( 8, ReportHourly, "Electricity:Facility", "J" );
+	AddCsvOutputColumn( 9, ReportDaily, "ZONE ONE:Zone Mean Air Temperature", "C" );
+	StartCsvOutputRow( ReportHourly, 1, 1, 21, 1, 60.0 );
+	SetCsvOutputValue( 7, "21.5" );
+	SetCsvOutputValue( 8, "1000.0" );
+	StartCsvOutputRow( ReportHourly, 1, 1, 21, 2, 60.0 );
+	SetCsvOutputValue( 8, "2000.0" );
+	SetCsvOutputValue( 10, "3.0" ); // Not a column
+	CloseCsvOutput();
+
+	DataSystemVariables::CsvOutput = false;
+	DataStringGlobals::outputCsvFileName = SaveCsvFileName;
+
+	std::ifstream CsvFile( "OutputProcessorCsvOutputRows-hourly.csv" );
+	ASSERT_TRUE( CsvFile.good() );
+	std::string Line;
+	std::getline( CsvFile, Line );
+	EXPECT_EQ( "Date/Time,ZONE ONE:Zone Mean Air Temperature [C](Hourly),Electricity:Facility [J](Hourly)", Line );
+	std::getline( CsvFile, Line );
+	EXPECT_EQ( " 01/21  01:00:00,21.5,1000.0", Line );
+	std::getline( CsvFile, Line );
+	EXPECT_EQ( " 01/21  02:00:00,,2000.0", Line );
+	EXPECT_FALSE( std::getline( CsvFile, Line ) );
+	CsvFile.close();
+	std::remove( "OutputProcessorCsvOutputRows-hourly.csv" );
+
+	// No daily rows, so no daily file
+	std::ifstream DailyFile( "OutputProcessorCsvOutputRows-daily.csv" );
+	EXPECT_FALSE( DailyFile.good() );
+}
@@ -4,7 +4,11 @@
 #include <gtest/gtest.h>
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/string.functions.hh>
 // EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/OutputReportPredefined.hh>
 #include <EnergyPlus/OutputReportTabular.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
@@ -32,3 +36,128 @@ TEST( OutputReportTabularTest, Basic )
 	EXPECT_TRUE( warningAboutKeyNotFound( 0, 1, "moduleName" ) );
 	EXPECT_FALSE( warningAboutKeyNotFound( 100, 1, "moduleName") );
 }
+
+TEST( OutputReportTabularTest, GatherMonthlyCompiledFields )
+{
+	ShowMessage( "Begin Test: OutputReportTabularTest, GatherMonthlyCompiledFields" );
+
+	Real64 energy( 0.0 );
+	Real64 temperature( 0.0 );
+	Real64 humidity( 0.0 );
+
+	DataGlobals::DoWeathSim = true;
+	DataGlobals::TimeStepZone = 0.25;
+	DataGlobals::TimeStepZoneSec = 900.0;
+	DataGlobals::HourOfDay = 1;
+	DataGlobals::CurrentTime = 0.25;
+	DataEnvironment::Month = 1;
+	DataEnvironment::DayOfMonth = 1;
+
+	// one table: summed energy, maximum temperature and humidity at the maximum
+	MonthlyTablesCount = 1;
+	MonthlyTables.allocate( 1 );
+	MonthlyTables( 1 ).firstColumn = 1;
+	MonthlyTables( 1 ).numColumns = 3;
+	MonthlyColumnsCount = 3;
+	MonthlyColumns.allocate( 3 );
+	MonthlyColumns( 1 ).aggType = aggTypeSumOrAvg;
+	MonthlyColumns( 1 ).avgSum = isSum;
+	MonthlyColumns( 2 ).aggType = aggTypeMaximum;
+	MonthlyColumns( 2 ).avgSum = isAverage;
+	MonthlyColumns( 2 ).reslt = -99999.0;
+	MonthlyColumns( 3 ).aggType = aggTypeValueWhenMaxMin;
+	MonthlyColumns( 3 ).avgSum = isAverage;
+	for ( int iCol = 1; iCol <= 3; ++iCol ) MonthlyColumns( iCol ).stepType = stepTypeZone;
+	OutputTableBinnedCount = 0;
+	BinResultsTableCount = 0;
+
+	CompileTabularGatherFields();
+	ASSERT_EQ( 1u, MonthlySumFieldsZone.size() );
+	EXPECT_EQ( 1, MonthlySumFieldsZone[ 0 ].column );
+	EXPECT_TRUE( MonthlySumFieldsZone[ 0 ].isSum );
+	EXPECT_TRUE( MonthlySumFieldsHVAC.empty() );
+
+	// bind the columns to local values in place of report variables
+	MonthlySumFieldsZone[ 0 ].value.realValue = &energy;
+	MonthlyColumnsField( 1 ).realValue = &energy;
+	MonthlyColumnsField( 2 ).realValue = &temperature;
+	MonthlyColumnsField( 3 ).realValue = &humidity;
+
+	energy = 100.0;
+	temperature = 22.0;
+	humidity = 0.4;
+	GatherMonthlyResultsForTimestep( DataGlobals::ZoneTSReporting );
+	energy = 50.0;
+	temperature = 25.0;
+	humidity = 0.6;
+	GatherMonthlyResultsForTimestep( DataGlobals::ZoneTSReporting );
+	energy = 25.0;
+	temperature = 23.0;
+	humidity = 0.5;
+	GatherMonthlyResultsForTimestep( DataGlobals::ZoneTSReporting );
+
+	EXPECT_DOUBLE_EQ( 175.0, MonthlyColumns( 1 ).reslt( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.75, MonthlyColumns( 1 ).duration( 1 ) );
+	EXPECT_DOUBLE_EQ( 25.0, MonthlyColumns( 2 ).reslt( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.6, MonthlyColumns( 3 ).reslt( 1 ) );
+
+	// system time step gathering leaves zone time step columns alone
+	GatherMonthlyResultsForTimestep( DataGlobals::HVACTSReporting );
+	EXPECT_DOUBLE_EQ( 175.0, MonthlyColumns( 1 ).reslt( 1 ) );
+
+	DataGlobals::DoWeathSim = false;
+	MonthlyTablesCount = 0;
+	MonthlyTables.deallocate();
+	MonthlyColumnsCount = 0;
+	MonthlyColumns.deallocate();
+	MonthlyColumnsField.deallocate();
+	BinObjField.deallocate();
+	MonthlySumFieldsZone.clear();
+	MonthlySumFieldsHVAC.clear();
+}
+
+TEST( OutputReportTabularTest, PredefinedEntryFormattedWhenWritten )
+{
+	ShowMessage( "Begin Test: OutputReportTabularTest, PredefinedEntryFormattedWhenWritten" );
+
+	using namespace OutputReportPredefined;
+	PreDefTableEntry( 1, "Object", 1.5 );
+	int const RealEntry( numTableEntry );
+	PreDefTableEntry( 1, "Object", 7 );
+	int const IntEntry( numTableEntry );
+	PreDefTableEntry( 1, "Object", "Text" );
+	int const CharEntry( numTableEntry );
+
+	EXPECT_TRUE( tableEntry( RealEntry ).charEntry.empty() );
+	EXPECT_DOUBLE_EQ( 1.5, tableEntry( RealEntry ).origRealEntry );
+	EXPECT_EQ( "1.50", stripped( TableEntryString( RealEntry ) ) );
+	EXPECT_EQ( 12u, TableEntryString( RealEntry ).size() );
+	EXPECT_EQ( "7", stripped( TableEntryString( IntEntry ) ) );
+	EXPECT_EQ( "Text", TableEntryString( CharEntry ) );
+}
+
+TEST( OutputReportTabularTest, CompSizeTableEntryUpdatedWhenSizedAgain )
+{
+	ShowMessage( "Begin Test: OutputReportTabularTest, CompSizeTableEntryUpdatedWhenSizedAgain" );
+
+	using namespace OutputReportPredefined;
+
+	CompSizeTableEntry.deallocate();
+	AddCompSizeTableEntry( "Coil:Heating:Water", "Reheat Coil", "Design Size U-Factor Times Area Value [W/K]", 100.0 );
+	AddCompSizeTableEntry( "Coil:Heating:Water", "Reheat Coil", "Design Size Maximum Water Flow Rate [m3/s]", 0.001 );
+	AddCompSizeTableEntry( "COIL:HEATING:WATER", "REHEAT COIL", "Design Size U-Factor Times Area Value [W/K]", 120.0 );
+	AddCompSizeTableEntry( "Coil:Heating:Water", "Other Coil", "Design Size U-Factor Times Area Value [W/K]", 50.0 );
+
+	EXPECT_EQ( 3, numCompSizeTableEntry );
+	EXPECT_EQ( "Coil:Heating:Water", CompSizeTableEntry( 1 ).typeField );
+	EXPECT_EQ( 120.0, CompSizeTableEntry( 1 ).valField );
+	EXPECT_EQ( 0.001, CompSizeTableEntry( 2 ).valField );
+	EXPECT_EQ( "Other Coil", CompSizeTableEntry( 3 ).nameField );
+
+	// a new set of entries after the tables are written starts over
+	CompSizeTableEntry.deallocate();
+	AddCompSizeTableEntry( "Coil:Heating:Water", "Other Coil", "Design Size U-Factor Times Area Value [W/K]", 60.0 );
+	EXPECT_EQ( 1, numCompSizeTableEntry );
+	EXPECT_EQ( 60.0, CompSizeTableEntry( 1 ).valField );
+	CompSizeTableEntry.deallocate();
+}
@@ -0,0 +1,78 @@
+// EnergyPlus::Psychrometrics Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::Psychrometrics;
+
+TEST( PsychrometricsTest, CachedSaturationTemperatures )
+{
+	ShowMessage( "Begin Test: PsychrometricsTest, CachedSaturationTemperatures" );
+
+	InitializePsychRoutines();
+
+	// The saturation temperature caches use exact tags: repeated and cached results equal the calculation
+	for ( int i = 0; i < 200; ++i ) {
+		Real64 const H( -1.0e4 + 7.3e2 * i ); // enthalpy {J/kg}
+		Real64 const PB( 101325.0 - 50.0 * ( i % 7 ) ); // barometric pressure {Pascals}
+		Real64 const Tsat( PsyTsatFnHPb( H, PB ) );
+		EXPECT_EQ( PsyTsatFnHPb_raw( H, PB ), Tsat );
+		EXPECT_EQ( Tsat, PsyTsatFnHPb( H, PB ) );
+
+		Real64 const Press( 500.0 + 1.13e3 * i ); // pressure {Pascals}
+		Real64 const TsatP( PsyTsatFnPb( Press ) );
+		EXPECT_EQ( PsyTsatFnPb_raw( Press ), TsatP );
+		EXPECT_EQ( TsatP, PsyTsatFnPb( Press ) );
+	}
+
+	// Saturation temperature at atmospheric pressure
+	EXPECT_NEAR( 100.0, PsyTsatFnPb( 101325.0 ), 0.1 );
+	EXPECT_NEAR( 100.0, PsyTsatFnPb( 101325.0 ), 0.1 );
+
+	cached_TsatHPb.deallocate();
+	cached_TsatPb.deallocate();
+	cached_Twb.deallocate();
+	cached_Psat.deallocate();
+}
+
+TEST( PsychrometricsTest, BatchFunctions )
+{
+	ShowMessage( "Begin Test: PsychrometricsTest, BatchFunctions" );
+
+	InitializePsychRoutines();
+
+	int const n( 37 ); // Not a multiple of any vector width
+	Array1D< Real64 > T( n );
+	Array1D< Real64 > W( n );
+	Array1D< Real64 > H( n );
+	for ( int i = 1; i <= n; ++i ) {
+		T( i ) = -20.0 + 1.7 * i;
+		W( i ) = 0.0005 * ( i % 11 ); // Includes zero, below the 1.0e-5 bound
+		H( i ) = -1.0e4 + 2.9e3 * i;
+	}
+
+	// Batch results match the scalar functions element by element
+	Array1D< Real64 > Result( n );
+	PsyRhoAirFnPbTdbW( 101325.0, T, W, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyRhoAirFnPbTdbW( 101325.0, T( i ), W( i ) ), Result( i ) );
+	PsyHFnTdbW( T, W, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyHFnTdbW( T( i ), W( i ) ), Result( i ) );
+	PsyCpAirFnWTdb( W, T, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyCpAirFnWTdb( W( i ), T( i ) ), Result( i ) );
+	PsyTdbFnHW( H, W, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyTdbFnHW( H( i ), W( i ) ), Result( i ) );
+	PsyPsatFnTemp( T, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyPsatFnTemp( T( i ) ), Result( i ) );
+	PsyTsatFnHPb( H, 101325.0, Result );
+	for ( int i = 1; i <= n; ++i ) EXPECT_DOUBLE_EQ( PsyTsatFnHPb( H( i ), 101325.0 ), Result( i ) );
+
+	cached_TsatHPb.deallocate();
+	cached_TsatPb.deallocate();
+	cached_Twb.deallocate();
+	cached_Psat.deallocate();
+}
@@ -0,0 +1,102 @@
+// EnergyPlus::RecordOutput Unit Tests
+
+// C++ Headers
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/RecordOutput.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RecordOutput;
+
+TEST( RecordOutputTest, TypedRecords )
+{
+	ShowMessage( "Begin Test: RecordOutputTest, TypedRecords" );
+
+	std::string const SaveEioFileName( DataStringGlobals::outputEioFileName );
+	DataStringGlobals::outputEioFileName = "RecordOutputTest.eio";
+	DataSystemVariables::EioRecords = true;
+	DataSystemVariables::EioRecordsOnly = false;
+	DataSystemVariables::EioSuppress = " Script F Factor ;record output test suppressed";
+
+	int const SizingClass( RecordClass( "Record Output Test Sizing" ) );
+	int const SuppressedClass( RecordClass( "Record Output Test Suppressed" ) );
+	EXPECT_EQ( SizingClass, RecordClass( "Record Output Test Sizing" ) );
+
+	OpenRecordOutput();
+	EXPECT_TRUE( WriteTextRecord( SizingClass ) );
+	EXPECT_TRUE( WriteRecord( SizingClass ) );
+	EXPECT_FALSE( WriteTextRecord( SuppressedClass ) );
+	EXPECT_FALSE( WriteRecord( SuppressedClass ) );
+	EXPECT_FALSE( WriteRecord( RecordClass( "Script F Factor" ) ) );
+
+	BeginRecord( SizingClass );
+	RecordField( std::string( "Fan:ConstantVolume" ) );
+	RecordField( 1.25 );
+	RecordField( 3 );
+	EndRecord();
+	CloseRecordOutput();
+
+	std::ifstream File( "RecordOutputTest.eiob", std::ios_base::binary );
+	std::string const Contents( ( std::istreambuf_iterator< char >( File ) ), std::istreambuf_iterator< char >() );
+	File.close();
+	std::remove( "RecordOutputTest.eiob" );
+
+	std::string const ClassName( "Record Output Test Sizing" );
+	std::string const FieldValue( "Fan:ConstantVolume" );
+	ASSERT_EQ( 8u + ( 1 + 4 + 4 + ClassName.size() ) + ( 1 + 4 + 4 ) + ( 1 + 4 + FieldValue.size() ) + ( 1 + 8 ) + ( 1 + 4 ), Contents.size() );
+	EXPECT_EQ( "EPEIOB01", Contents.substr( 0, 8 ) );
+
+	std::size_t Pos( 8 );
+	std::int32_t Int32;
+	Real64 Float64;
+	EXPECT_EQ( 'C', Contents[ Pos ] );
+	std::memcpy( &Int32, &Contents[ Pos + 1 ], 4 );
+	EXPECT_EQ( SizingClass, Int32 );
+	std::memcpy( &Int32, &Contents[ Pos + 5 ], 4 );
+	EXPECT_EQ( int( ClassName.size() ), Int32 );
+	EXPECT_EQ( ClassName, Contents.substr( Pos + 9, ClassName.size() ) );
+	Pos += 9 + ClassName.size();
+
+	EXPECT_EQ( 'R', Contents[ Pos ] );
+	std::memcpy( &Int32, &Contents[ Pos + 5 ], 4 );
+	EXPECT_EQ( 3, Int32 ); // Fields
+	Pos += 9;
+	EXPECT_EQ( 's', Contents[ Pos ] );
+	EXPECT_EQ( FieldValue, Contents.substr( Pos + 5, FieldValue.size() ) );
+	Pos += 5 + FieldValue.size();
+	EXPECT_EQ( 'd', Contents[ Pos ] );
+	std::memcpy( &Float64, &Contents[ Pos + 1 ], 8 );
+	EXPECT_EQ( 1.25, Float64 );
+	Pos += 9;
+	EXPECT_EQ( 'i', Contents[ Pos ] );
+	std::memcpy( &Int32, &Contents[ Pos + 1 ], 4 );
+	EXPECT_EQ( 3, Int32 );
+
+	// Only: the record classes are left out of the eio file
+	DataSystemVariables::EioRecordsOnly = true;
+	OpenRecordOutput();
+	EXPECT_FALSE( WriteTextRecord( SizingClass ) );
+	EXPECT_TRUE( WriteRecord( SizingClass ) );
+	CloseRecordOutput();
+	std::remove( "RecordOutputTest.eiob" );
+
+	DataSystemVariables::EioRecords = false;
+	DataSystemVariables::EioRecordsOnly = false;
+	DataSystemVariables::EioSuppress.clear();
+	OpenRecordOutput();
+	EXPECT_TRUE( WriteTextRecord( SizingClass ) );
+	EXPECT_FALSE( WriteRecord( SizingClass ) );
+	DataStringGlobals::outputEioFileName = SaveEioFileName;
+}
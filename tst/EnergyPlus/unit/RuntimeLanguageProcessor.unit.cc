@@ -0,0 +1,112 @@
+// EnergyPlus::RuntimeLanguageProcessor Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/RuntimeLanguageProcessor.hh>
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RuntimeLanguageProcessor;
+using namespace EnergyPlus::DataRuntimeLanguage;
+
+namespace {
+
+	int
+	AddTestExpression(
+		int const Operator,
+		ErlValueType const & Operand1,
+		ErlValueType const & Operand2
+	)
+	{
+		int const ExpressionNum = NewExpression();
+		ErlExpression( ExpressionNum ).Operator = Operator;
+		ErlExpression( ExpressionNum ).NumOperands = 2;
+		ErlExpression( ExpressionNum ).Operand.allocate( 2 );
+		ErlExpression( ExpressionNum ).Operand( 1 ) = Operand1;
+		ErlExpression( ExpressionNum ).Operand( 2 ) = Operand2;
+		return ExpressionNum;
+	}
+
+	ErlValueType
+	VariableOperand( int const VariableNum )
+	{
+		ErlValueType Operand;
+		Operand.Type = ValueVariable;
+		Operand.Variable = VariableNum;
+		return Operand;
+	}
+
+	ErlValueType
+	ExpressionOperand( int const ExpressionNum )
+	{
+		ErlValueType Operand;
+		Operand.Type = ValueExpression;
+		Operand.Expression = ExpressionNum;
+		return Operand;
+	}
+
+}
+
+TEST( RuntimeLanguageProcessorTest, CompiledExpressions )
+{
+	ShowMessage( "Begin Test: RuntimeLanguageProcessorTest, CompiledExpressions" );
+
+	False = SetErlValueNumber( 0.0 );
+	True = SetErlValueNumber( 1.0 );
+
+	int const xVar = NewEMSVariable( "CompiledTestX", 0, SetErlValueNumber( 4.0 ) );
+	int const yVar = NewEMSVariable( "CompiledTestY", 0, SetErlValueNumber( 0.0 ) );
+	int const nullVar = NewEMSVariable( "CompiledTestNull", 0 );
+	ErlVariable( nullVar ).Value.Type = ValueNull;
+
+	// ( X + 2 ) * 3 > 10
+	int const sumExpr = AddTestExpression( OperatorAdd, VariableOperand( xVar ), SetErlValueNumber( 2.0 ) );
+	int const productExpr = AddTestExpression( OperatorMultiply, ExpressionOperand( sumExpr ), SetErlValueNumber( 3.0 ) );
+	int const compareExpr = AddTestExpression( OperatorGreaterThan, ExpressionOperand( productExpr ), SetErlValueNumber( 10.0 ) );
+	// X ^ 0.5 - X / Y, divides by zero
+	int const powerExpr = AddTestExpression( OperatorRaiseToPower, VariableOperand( xVar ), SetErlValueNumber( 0.5 ) );
+	int const divideExpr = AddTestExpression( OperatorDivide, VariableOperand( xVar ), VariableOperand( yVar ) );
+	int const differenceExpr = AddTestExpression( OperatorSubtract, ExpressionOperand( powerExpr ), ExpressionOperand( divideExpr ) );
+	// X + Null
+	int const nullExpr = AddTestExpression( OperatorAdd, VariableOperand( xVar ), VariableOperand( nullVar ) );
+	// random numbers stay interpreted
+	int const randomExpr = AddTestExpression( FuncRandU, SetErlValueNumber( 0.0 ), SetErlValueNumber( 1.0 ) );
+
+	CompileExpressions();
+
+	EXPECT_EQ( 7u, ErlExpression( compareExpr ).Bytecode.size() );
+	EXPECT_FALSE( ErlExpression( differenceExpr ).Bytecode.empty() );
+	EXPECT_FALSE( ErlExpression( nullExpr ).Bytecode.empty() );
+	EXPECT_TRUE( ErlExpression( randomExpr ).Bytecode.empty() );
+
+	EXPECT_EQ( ValueNumber, EvaluateExpression( productExpr ).Type );
+	EXPECT_DOUBLE_EQ( 18.0, EvaluateExpression( productExpr ).Number );
+	EXPECT_DOUBLE_EQ( True.Number, EvaluateExpression( compareExpr ).Number );
+	ErlVariable( xVar ).Value = SetErlValueNumber( 1.0 );
+	EXPECT_DOUBLE_EQ( False.Number, EvaluateExpression( compareExpr ).Number );
+
+	// cases the compiled form cannot evaluate give the interpreter's result
+	EXPECT_EQ( ValueError, EvaluateExpression( divideExpr ).Type );
+	EXPECT_EQ( "Divide by zero!", EvaluateExpression( divideExpr ).Error );
+	EXPECT_EQ( ValueNumber, EvaluateExpression( differenceExpr ).Type );
+	EXPECT_DOUBLE_EQ( 0.0, EvaluateExpression( differenceExpr ).Number );
+	ErlVariable( yVar ).Value = SetErlValueNumber( 4.0 );
+	EXPECT_DOUBLE_EQ( 0.75, EvaluateExpression( differenceExpr ).Number );
+	EXPECT_EQ( ValueNumber, EvaluateExpression( nullExpr ).Type );
+	EXPECT_DOUBLE_EQ( 0.0, EvaluateExpression( nullExpr ).Number );
+
+	// same answers from the interpreter alone
+	for ( int ExpressionNum = 1; ExpressionNum <= NumExpressions; ++ExpressionNum ) {
+		ErlExpression( ExpressionNum ).Bytecode.clear();
+	}
+	EXPECT_DOUBLE_EQ( False.Number, EvaluateExpression( compareExpr ).Number );
+	EXPECT_DOUBLE_EQ( 0.75, EvaluateExpression( differenceExpr ).Number );
+
+	ErlExpression.deallocate();
+	NumExpressions = 0;
+	ErlVariable.deallocate();
+	NumErlVariables = 0;
+}
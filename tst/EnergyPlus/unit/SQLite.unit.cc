@@ -254,6 +254,29 @@ namespace EnergyPlus {
 		EXPECT_EQ(3ul, result.size());
 	}
 
+	TEST_F( SQLiteFixture, timingsRecords ) {
+		ShowMessage( "Begin Test: SQLiteFixture, timingsRecords" );
+		sqlite_test->sqliteBegin();
+		sqlite_test->createSQLiteTimingsRecord( 1, 0, 0, "ManageHVAC", "ManageHVAC", 8760, 2.5, 1.5 );
+		sqlite_test->createSQLiteTimingsRecord( 2, 0, 1, "ManageAirLoops", "ManageHVAC/ManageAirLoops", 17520, 1.0, 1.0 );
+		auto result = queryResult("SELECT * FROM Timings;", "Timings");
+		sqlite_test->sqliteCommit();
+
+		ASSERT_EQ(2ul, result.size());
+		std::vector<std::string> testResult0 {"1", "0", "", "ManageHVAC", "ManageHVAC", "8760", "2.5", "1.5"};
+		std::vector<std::string> testResult1 {"2", "0", "1", "ManageAirLoops", "ManageHVAC/ManageAirLoops", "17520", "1.0", "1.0"};
+		EXPECT_EQ(testResult0, result[0]);
+		EXPECT_EQ(testResult1, result[1]);
+
+		sqlite_test->sqliteBegin();
+		// This should fail to insert due to foreign key constraint
+		sqlite_test->createSQLiteTimingsRecord( 3, 0, 100, "ManageEMS", "ManageHVAC/ManageEMS", 1, 0.5, 0.5 );
+		result = queryResult("SELECT * FROM Timings;", "Timings");
+		sqlite_test->sqliteCommit();
+
+		EXPECT_EQ(2ul, result.size());
+	}
+
 	TEST_F( SQLiteFixture, createSQLiteReportDictionaryRecord )
 	{
 		ShowMessage( "Begin Test: SQLiteFixture, createSQLiteReportDictionaryRecord" );
@@ -409,6 +432,26 @@ namespace EnergyPlus {
 		EXPECT_EQ(2ul, reportExtendedData.size());
 	}
 
+	TEST_F( SQLiteFixture, createSQLiteReportDataRecordBatches ) {
+		ShowMessage( "Begin Test: SQLiteFixture, createSQLiteReportDataRecordBatches" );
+		sqlite_test->sqliteBegin();
+		sqlite_test->createSQLiteTimeIndexRecord( 4, 1, 1, 0 );
+		sqlite_test->createSQLiteReportDictionaryRecord( 1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 1, false, _ );
+		for ( int i = 1; i <= 450; ++i ) { // Two full batches and 50 single rows
+			sqlite_test->createSQLiteReportDataRecord( 1, 0.5 * i );
+		}
+		sqlite_test->sqliteCommit();
+
+		auto reportData = queryResult("SELECT * FROM ReportData ORDER BY ReportDataIndex;", "ReportData");
+		ASSERT_EQ(450ul, reportData.size());
+		int const firstDataIndex = std::stoi(reportData[0][0]); // Data index carries on from earlier tests
+		for ( int i = 0; i < 450; ++i ) {
+			EXPECT_EQ(firstDataIndex + i, std::stoi(reportData[i][0]));
+			EXPECT_EQ(0.5 * ( i + 1 ), std::stod(reportData[i][3]));
+		}
+		EXPECT_EQ("", ss->str());
+	}
+
 	TEST_F( SQLiteFixture, addSQLiteZoneSizingRecord ) {
 		ShowMessage( "Begin Test: SQLiteFixture, addSQLiteZoneSizingRecord" );
 		sqlite_test->sqliteBegin();
@@ -0,0 +1,93 @@
+// EnergyPlus::ScheduleManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ScheduleManager;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataEnvironment;
+
+TEST( ScheduleManagerTest, UpdateScheduleValuesChanges )
+{
+	ShowMessage( "Begin Test: ScheduleManagerTest, UpdateScheduleValuesChanges" );
+
+	NumOfTimeStepInHour = 2;
+	ScheduleInputProcessed = true;
+	NumDaySchedules = 2;
+	NumWeekSchedules = 2;
+	NumSchedules = 2;
+	DaySchedule.allocate( { 0, NumDaySchedules } );
+	for ( int Day = 0; Day <= NumDaySchedules; ++Day ) {
+		DaySchedule( Day ).TSValue.allocate( NumOfTimeStepInHour, 24 );
+		DaySchedule( Day ).TSValue = 0.0;
+	}
+	DaySchedule( 1 ).TSValue = 1.0; // Constant
+	for ( int Hour = 9; Hour <= 17; ++Hour ) { // 08:00 to 17:00, starting on the second timestep
+		for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+			if ( Hour > 9 || TS > 1 ) DaySchedule( 2 ).TSValue( TS, Hour ) = 0.5;
+		}
+	}
+	WeekSchedule.allocate( { 0, NumWeekSchedules } );
+	WeekSchedule( 1 ).DaySchedulePointer = 1;
+	WeekSchedule( 2 ).DaySchedulePointer = 2;
+	Schedule.allocate( { -1, NumSchedules } );
+	Schedule( 1 ).WeekSchedulePointer = 1;
+	Schedule( 2 ).WeekSchedulePointer = 2;
+
+	DayOfYear_Schedule = 1;
+	DayOfWeek = 2;
+	HolidayIndex = 0;
+
+	for ( DSTIndicator = 0; DSTIndicator <= 1; ++DSTIndicator ) {
+		for ( int Day = 1; Day <= 2; ++Day ) { // Second day repeats the first, as in warmup
+			Real64 LastValue( -1.0 );
+			for ( HourOfDay = 1; HourOfDay <= 24; ++HourOfDay ) {
+				for ( TimeStep = 1; TimeStep <= NumOfTimeStepInHour; ++TimeStep ) {
+					UpdateScheduleValues();
+					int const WhichHour( HourOfDay + DSTIndicator <= 24 ? HourOfDay + DSTIndicator : HourOfDay + DSTIndicator - 24 );
+					Real64 const Value( DaySchedule( 2 ).TSValue( TimeStep, WhichHour ) );
+					EXPECT_DOUBLE_EQ( 1.0, GetCurrentScheduleValue( 1 ) );
+					EXPECT_DOUBLE_EQ( Value, GetCurrentScheduleValue( 2 ) );
+					if ( LastValue >= 0.0 ) {
+						EXPECT_FALSE( GetScheduleValueChanged( 1 ) );
+						EXPECT_EQ( Value != LastValue, GetScheduleValueChanged( 2 ) );
+					}
+					LastValue = Value;
+				}
+			}
+		}
+	}
+
+	// Values changed from outside are picked up
+	DSTIndicator = 0;
+	int ExternalDaySchedule( 2 );
+	Real64 ExternalValue( 0.25 );
+	ExternalInterfaceSetSchedule( ExternalDaySchedule, ExternalValue );
+	HourOfDay = 12;
+	TimeStep = 1;
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( 0.25, GetCurrentScheduleValue( 2 ) );
+	EXPECT_TRUE( GetScheduleValueChanged( 2 ) );
+	EXPECT_FALSE( GetScheduleValueChanged( 1 ) );
+	EXPECT_FALSE( GetScheduleValueChanged( 0 ) );
+
+	ScheduleValueChanged.deallocate();
+	Schedule.deallocate();
+	WeekSchedule.deallocate();
+	DaySchedule.deallocate();
+	NumSchedules = 0;
+	NumWeekSchedules = 0;
+	NumDaySchedules = 0;
+	ScheduleInputProcessed = false;
+	NumOfTimeStepInHour = 0;
+	DSTIndicator = 0;
+	HourOfDay = 0;
+	TimeStep = 0;
+}
@@ -7,6 +7,8 @@
 #include <SetPointManager.hh>
 #include <DataPlant.hh>
 #include <DataLoopNode.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
 
 using namespace EnergyPlus;
  
@@ -186,3 +188,44 @@ TEST( SetPointManager, DefineReturnWaterHWSetPointManager )
 	DataPlant::PlantLoop.deallocate();
 
 }
+
+TEST( SetPointManager, FollowOATempCalculatedOncePerZoneTimeStep )
+{
+
+	SetPointManager::NumFollowOATempSetPtMgrs = 1;
+	SetPointManager::FollowOATempSetPtMgr.allocate( 1 );
+	SetPointManager::FollowOATempSetPtMgr( 1 ).RefTypeMode = SetPointManager::iRefTempType_DryBulb;
+	SetPointManager::FollowOATempSetPtMgr( 1 ).Offset = 1.0;
+	SetPointManager::FollowOATempSetPtMgr( 1 ).MinSetTemp = 0.0;
+	SetPointManager::FollowOATempSetPtMgr( 1 ).MaxSetTemp = 40.0;
+
+	// first pass through the HVAC simulation of a zone time step
+	DataGlobals::BeginTimeStepFlag = true;
+	DataEnvironment::OutDryBulbTemp = 20.0;
+	SetPointManager::SimSetPointManagers();
+	EXPECT_DOUBLE_EQ( 21.0, SetPointManager::FollowOATempSetPtMgr( 1 ).SetPt );
+
+	// later system time steps of the same zone time step keep the setpoint
+	DataGlobals::BeginTimeStepFlag = false;
+	DataEnvironment::OutDryBulbTemp = 25.0;
+	SetPointManager::SimSetPointManagers();
+	EXPECT_DOUBLE_EQ( 21.0, SetPointManager::FollowOATempSetPtMgr( 1 ).SetPt );
+
+	// EMS may change the weather within a zone time step
+	DataGlobals::AnyEnergyManagementSystemInModel = true;
+	SetPointManager::SimSetPointManagers();
+	EXPECT_DOUBLE_EQ( 26.0, SetPointManager::FollowOATempSetPtMgr( 1 ).SetPt );
+	DataGlobals::AnyEnergyManagementSystemInModel = false;
+
+	// next zone time step
+	DataGlobals::BeginTimeStepFlag = true;
+	DataEnvironment::OutDryBulbTemp = 30.0;
+	SetPointManager::SimSetPointManagers();
+	EXPECT_DOUBLE_EQ( 31.0, SetPointManager::FollowOATempSetPtMgr( 1 ).SetPt );
+
+	DataGlobals::BeginTimeStepFlag = false;
+	SetPointManager::TimeStepSetPtsCalculated = false;
+	SetPointManager::NumFollowOATempSetPtMgrs = 0;
+	SetPointManager::FollowOATempSetPtMgr.deallocate();
+
+}
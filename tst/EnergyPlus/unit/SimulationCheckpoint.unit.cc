@@ -0,0 +1,72 @@
+// EnergyPlus::SimulationCheckpoint Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SimulationCheckpoint.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SimulationCheckpoint;
+using namespace ObjexxFCL;
+
+TEST( SimulationCheckpointTest, ArchiveRoundTrip )
+{
+	ShowMessage( "Begin Test: SimulationCheckpointTest, ArchiveRoundTrip" );
+
+	std::string const FileName( "SimulationCheckpointTest.ckpt" );
+
+	Real64 Temp( 21.5 );
+	int Count( -3 );
+	bool On( true );
+	std::string Name( "Zone One" );
+	Array1D< Real64 > History( 3 );
+	History( 1 ) = 20.0;
+	History( 2 ) = 20.5;
+	History( 3 ) = 21.0;
+	{
+		CheckpointArchive ar( FileName, true );
+		EXPECT_TRUE( ar.writing() );
+		ar.section( "Test values", 1 );
+		ar.value( Temp );
+		ar.value( Count );
+		ar.value( On );
+		ar.value( Name );
+		ar.values( History );
+		ar.close();
+	}
+
+	Temp = 0.0;
+	Count = 0;
+	On = false;
+	Name.clear();
+	History = 0.0;
+	{
+		CheckpointArchive ar( FileName, false );
+		EXPECT_FALSE( ar.writing() );
+		ar.section( "Test values", 1 );
+		ar.value( Temp );
+		ar.value( Count );
+		ar.value( On );
+		ar.value( Name );
+		ar.values( History );
+		ar.close();
+	}
+	EXPECT_EQ( 21.5, Temp );
+	EXPECT_EQ( -3, Count );
+	EXPECT_TRUE( On );
+	EXPECT_EQ( "Zone One", Name );
+	EXPECT_EQ( 20.0, History( 1 ) );
+	EXPECT_EQ( 20.5, History( 2 ) );
+	EXPECT_EQ( 21.0, History( 3 ) );
+
+	std::remove( FileName.c_str() );
+}
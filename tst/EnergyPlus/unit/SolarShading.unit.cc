@@ -8,6 +8,7 @@
 #include <EnergyPlus/DataBSDFWindow.hh>
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataShadowingCombinations.hh>
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
@@ -19,6 +20,7 @@ using namespace EnergyPlus::DataGlobals;
 using namespace EnergyPlus::DataSystemVariables;
 using namespace EnergyPlus::DataHeatBalance;
 using namespace EnergyPlus::DataBSDFWindow;
+using namespace EnergyPlus::DataShadowingCombinations;
 using namespace ObjexxFCL;
 
 TEST( SolarShadingTest, CalcPerSolarBeamTest )
@@ -145,3 +147,118 @@ TEST( SolarShadingTest, SurfaceScheduledSolarInc )
 
 	SurfIncSolSSG.deallocate();
 }
+
+TEST( SolarShadingTest, GatherPossibleShadowCasters )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, GatherPossibleShadowCasters" );
+
+	// Receiving surface 1 is a south facing wall in the y=0 plane; surfaces 2, 4, 6, 8 are small
+	// shades in front of it and surfaces 3, 5, 7, 9 are the same shades behind it.
+	TotSurfaces = 9;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).Sides = 4;
+	Surface( 1 ).Vertex.allocate( 4 );
+	Surface( 1 ).Vertex( 1 ) = Vector( 0.0, 0.0, 3.0 );
+	Surface( 1 ).Vertex( 2 ) = Vector( 0.0, 0.0, 0.0 );
+	Surface( 1 ).Vertex( 3 ) = Vector( 10.0, 0.0, 0.0 );
+	Surface( 1 ).Vertex( 4 ) = Vector( 10.0, 0.0, 3.0 );
+
+	std::vector< ShadowCasterTreeNode > CasterBox( TotSurfaces + 1 );
+	ShadowCasterTree.clear();
+	ShadowCasterOrder.clear();
+	for ( int SurfNum = 2; SurfNum <= TotSurfaces; ++SurfNum ) {
+		Real64 const YCoord( ( SurfNum % 2 == 0 ) ? -( 4.0 + SurfNum / 2 ) : ( 4.0 + SurfNum / 2 ) );
+		CasterBox[ SurfNum ].XMin = 0.0;
+		CasterBox[ SurfNum ].XMax = 1.0;
+		CasterBox[ SurfNum ].YMin = YCoord;
+		CasterBox[ SurfNum ].YMax = YCoord;
+		CasterBox[ SurfNum ].ZMin = 0.0;
+		CasterBox[ SurfNum ].ZMax = 1.0;
+		ShadowCasterOrder.push_back( SurfNum );
+	}
+	BuildShadowCasterTree( CasterBox, 0, ShadowCasterOrder.size() - 1 );
+	EXPECT_LT( 1u, ShadowCasterTree.size() );
+
+	std::vector< int > Casters;
+	GatherPossibleShadowCasters( 1, 0.0, Casters );
+	ASSERT_EQ( 4u, Casters.size() );
+	EXPECT_EQ( 2, Casters[ 0 ] );
+	EXPECT_EQ( 4, Casters[ 1 ] );
+	EXPECT_EQ( 6, Casters[ 2 ] );
+	EXPECT_EQ( 8, Casters[ 3 ] );
+
+	// All of the shades are below a receiving surface whose lowest point is at 2 m
+	GatherPossibleShadowCasters( 1, 2.0, Casters );
+	EXPECT_TRUE( Casters.empty() );
+
+	// Clean up
+	ShadowCasterTree.clear();
+	ShadowCasterOrder.clear();
+	Surface.deallocate();
+}
+
+TEST( SolarShadingTest, CalcCosIncidence )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, CalcCosIncidence" );
+
+	// A south wall, an east wall and a roof
+	TotSurfaces = 3;
+	SurfOutNormX.allocate( TotSurfaces );
+	SurfOutNormY.allocate( TotSurfaces );
+	SurfOutNormZ.allocate( TotSurfaces );
+	SurfOutNormX = { 0.0, 1.0, 0.0 };
+	SurfOutNormY = { -1.0, 0.0, 0.0 };
+	SurfOutNormZ = { 0.0, 0.0, 1.0 };
+	CTHETA.dimension( TotSurfaces, 0.0 );
+
+	Array1D< Real64 > SunCos( 3 );
+	SunCos = { 0.6, -0.48, 0.64 };
+	CalcCosIncidence( SunCos, CTHETA );
+
+	EXPECT_DOUBLE_EQ( 0.48, CTHETA( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.6, CTHETA( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.64, CTHETA( 3 ) );
+
+	TotSurfaces = 0;
+	SurfOutNormX.deallocate();
+	SurfOutNormY.deallocate();
+	SurfOutNormZ.deallocate();
+	CTHETA.deallocate();
+}
+
+TEST( SolarShadingTest, CanReuseShadow )
+{
+	ShowMessage( "Begin Test: SolarShadingTest, CanReuseShadow" );
+
+	// Surface 1 is shaded by surface 2, last calculated at ShadowCalcCount 5 with the sun overhead
+	ShadowHistory.allocate( 2 );
+	ShadowComb.allocate( 1 );
+	ShadowComb( 1 ).NumGenSurf = 1;
+	ShadowComb( 1 ).GenSurf.allocate( 1 );
+	ShadowComb( 1 ).GenSurf( 1 ) = 2;
+	SUNCOS.allocate( 3 );
+	CosSunPositionTolerance = std::cos( 1.0 * DegToRadians );
+
+	SUNCOS = { 0.0, 0.0, 1.0 };
+	EXPECT_FALSE( CanReuseShadow( 1 ) ); // Never calculated
+
+	ShadowHistory( 1 ).CalcCount = 5;
+	ShadowHistory( 1 ).SunCos3 = 1.0;
+	EXPECT_TRUE( CanReuseShadow( 1 ) );
+
+	// Sun moved half a degree, then two degrees
+	SUNCOS = { std::sin( 0.5 * DegToRadians ), 0.0, std::cos( 0.5 * DegToRadians ) };
+	EXPECT_TRUE( CanReuseShadow( 1 ) );
+	SUNCOS = { std::sin( 2.0 * DegToRadians ), 0.0, std::cos( 2.0 * DegToRadians ) };
+	EXPECT_FALSE( CanReuseShadow( 1 ) );
+
+	// Transmittance of the shading surface changed since the last calculation
+	SUNCOS = { 0.0, 0.0, 1.0 };
+	ShadowHistory( 2 ).TransChangeCount = 6;
+	EXPECT_FALSE( CanReuseShadow( 1 ) );
+
+	CosSunPositionTolerance = 1.0;
+	ShadowHistory.deallocate();
+	ShadowComb.deallocate();
+	SUNCOS.deallocate();
+}
@@ -23,3 +23,14 @@ TEST( SortAndStringUtilitiesTest, Basic )
 	SetupAndSort( Alphas, iAlphas );
 	EXPECT_TRUE( eq( Array1D_int( { 4, 5, 2, 3, 1 } ), iAlphas ) );
 }
+
+TEST( SortAndStringUtilitiesTest, SortedAlphasAndTies )
+{
+	ShowMessage( "Begin Test: SortAndStringUtilitiesTest, SortedAlphasAndTies" );
+
+	Array1D_string Alphas( { "B", "A", "C", "A", "B" } );
+	Array1D_int iAlphas( 5 );
+	SetupAndSort( Alphas, iAlphas );
+	EXPECT_TRUE( eq( Array1D_string( { "A", "A", "B", "B", "C" } ), Alphas ) );
+	EXPECT_TRUE( eq( Array1D_int( { 2, 4, 1, 5, 3 } ), iAlphas ) );
+}
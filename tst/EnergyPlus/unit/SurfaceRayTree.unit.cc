@@ -0,0 +1,102 @@
+// EnergyPlus::SurfaceRayTree Unit Tests
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SurfaceRayTree.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DaylightingManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SurfaceRayTree;
+using namespace EnergyPlus::DataSurfaces;
+using namespace ObjexxFCL;
+
+namespace {
+
+// Rectangle with vertices a, a+u, a+u+v, a+v
+void
+SetRectangle(
+	int const SurfNum,
+	Real64 const ax, Real64 const ay, Real64 const az,
+	Real64 const ux, Real64 const uy, Real64 const uz,
+	Real64 const vx, Real64 const vy, Real64 const vz
+)
+{
+	Surface( SurfNum ).Sides = 4;
+	Surface( SurfNum ).Shape = Rectangle;
+	Surface( SurfNum ).Vertex.allocate( 4 );
+	Surface( SurfNum ).Vertex( 1 ) = Vector( ax + vx, ay + vy, az + vz );
+	Surface( SurfNum ).Vertex( 2 ) = Vector( ax, ay, az );
+	Surface( SurfNum ).Vertex( 3 ) = Vector( ax + ux, ay + uy, az + uz );
+	Surface( SurfNum ).Vertex( 4 ) = Vector( ax + ux + vx, ay + uy + vy, az + uz + vz );
+}
+
+}
+
+TEST( SurfaceRayTreeTest, SurfacesAlongRay )
+{
+	ShowMessage( "Begin Test: SurfaceRayTreeTest, SurfacesAlongRay" );
+
+	// Three walls across the x axis and one far along the y axis
+	TotSurfaces = 4;
+	Surface.allocate( TotSurfaces );
+	SetRectangle( 1, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 );
+	SetRectangle( 2, 2.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 );
+	SetRectangle( 3, 3.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 );
+	SetRectangle( 4, 2.0, 10.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0 );
+	InitSurfaceRayTree();
+
+	std::vector< int > SurfNums;
+	SurfacesAlongRay( Vector( 0.0, 0.5, 0.5 ), Vector( 1.0, 0.0, 0.0 ), SurfNums );
+	EXPECT_EQ( std::vector< int >( { 1, 2, 3 } ), SurfNums );
+	SurfacesAlongRay( Vector( 2.5, 0.5, 0.5 ), Vector( 1.0, 0.0, 0.0 ), SurfNums );
+	EXPECT_EQ( std::vector< int >( { 3 } ), SurfNums );
+	SurfacesAlongRay( Vector( 0.0, 0.5, 0.5 ), Vector( -1.0, 0.0, 0.0 ), SurfNums );
+	EXPECT_TRUE( SurfNums.empty() );
+	SurfacesAlongRay( Vector( 2.5, 0.0, 0.5 ), Vector( 0.0, 1.0, 0.0 ), SurfNums );
+	EXPECT_EQ( std::vector< int >( { 4 } ), SurfNums );
+
+	// Every surface a ray pierces is returned
+	Array1D< Real64 > R1( 3 );
+	Array1D< Real64 > RN( 3 );
+	Array1D< Real64 > HitPt( 3 );
+	unsigned int Seed( 12345u );
+	auto Random = [ &Seed ]() -> Real64 {
+		Seed = 1664525u * Seed + 1013904223u;
+		return Real64( Seed >> 8 ) / Real64( 1u << 24 );
+	};
+	int NumHits( 0 );
+	for ( int Ray = 1; Ray <= 2000; ++Ray ) {
+		R1( 1 ) = 4.0 * Random() - 0.5;
+		R1( 2 ) = 12.0 * Random() - 1.0;
+		R1( 3 ) = 2.0 * Random() - 0.5;
+		RN( 1 ) = Random() - 0.5;
+		RN( 2 ) = Random() - 0.5;
+		RN( 3 ) = Random() - 0.5;
+		RN /= std::sqrt( RN( 1 ) * RN( 1 ) + RN( 2 ) * RN( 2 ) + RN( 3 ) * RN( 3 ) );
+		SurfacesAlongRay( R1, RN, SurfNums );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			int IHit( 0 );
+			DaylightingManager::DayltgPierceSurface( SurfNum, R1, RN, IHit, HitPt );
+			if ( IHit == 0 ) continue;
+			++NumHits;
+			EXPECT_TRUE( std::find( SurfNums.begin(), SurfNums.end(), SurfNum ) != SurfNums.end() );
+		}
+	}
+	EXPECT_GT( NumHits, 0 );
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+	InitSurfaceRayTree();
+}
@@ -0,0 +1,38 @@
+// EnergyPlus::UtilityRoutines Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataErrorTracking.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataErrorTracking;
+
+TEST( UtilityRoutinesTest, RecurringErrors )
+{
+	ShowMessage( "Begin Test: UtilityRoutinesTest, RecurringErrors" );
+
+	int const FirstError( NumRecurringErrors + 1 );
+	int const MatchCount( MatchCounts( 1 ) );
+	std::string const Message( MessageSearch( 1 ) + " of recurring error test" );
+
+	int Index1( 0 );
+	int Index2( 0 );
+	ShowRecurringWarningErrorAtEnd( Message, Index1, 2.0 );
+	ShowRecurringWarningErrorAtEnd( Message, Index1, 5.0 );
+	ShowRecurringWarningErrorAtEnd( Message, Index2, 3.0 ); // Same message from another call site
+	EXPECT_EQ( FirstError, Index1 );
+	EXPECT_EQ( Index1, Index2 );
+	EXPECT_EQ( FirstError, NumRecurringErrors );
+	EXPECT_EQ( 3, RecurringErrors( Index1 ).Count );
+	EXPECT_DOUBLE_EQ( 5.0, RecurringErrors( Index1 ).MaxValue );
+	EXPECT_EQ( MatchCount + 3, MatchCounts( 1 ) );
+
+	int Index3( 0 );
+	ShowRecurringSevereErrorAtEnd( Message, Index3 ); // Different designation
+	EXPECT_EQ( FirstError + 1, Index3 );
+	EXPECT_EQ( MatchCount + 4, MatchCounts( 1 ) );
+	EXPECT_GE( int( RecurringErrors.size() ), NumRecurringErrors );
+}
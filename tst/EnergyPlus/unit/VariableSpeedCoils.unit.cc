@@ -0,0 +1,70 @@
+// EnergyPlus::VariableSpeedCoils Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/VariableSpeedCoils.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+using namespace EnergyPlus::VariableSpeedCoils;
+
+TEST( VariableSpeedCoilsTest, SpeedCapacities )
+{
+	ShowMessage( "Begin Test: VariableSpeedCoilsTest, SpeedCapacities" );
+
+	Psychrometrics::InitializePsychRoutines();
+	DataEnvironment::OutBaroPress = 101325.0;
+
+	// Capacity modifier 1 + 0.01 * (source side inlet temperature)
+	NumCurves = 1;
+	PerfCurve.allocate( NumCurves );
+	PerfCurve( 1 ).CurveType = CurveManager::BiQuadratic;
+	PerfCurve( 1 ).ObjectType = CurveType_BiQuadratic;
+	PerfCurve( 1 ).InterpolationType = EvaluateCurveToLimits;
+	PerfCurve( 1 ).Coeff1 = 1.0;
+	PerfCurve( 1 ).Coeff4 = 0.01;
+	PerfCurve( 1 ).Var1Min = -100.0;
+	PerfCurve( 1 ).Var1Max = 100.0;
+	PerfCurve( 1 ).Var2Min = -100.0;
+	PerfCurve( 1 ).Var2Max = 100.0;
+
+	NumWatertoAirHPs = 1;
+	VarSpeedCoil.allocate( NumWatertoAirHPs );
+	VarSpeedCoil( 1 ).VSCoilTypeOfNum = DataHVACGlobals::Coil_CoolingWaterToAirHPVSEquationFit;
+	VarSpeedCoil( 1 ).NumOfSpeeds = 3;
+	VarSpeedCoil( 1 ).MSRatedTotCap( 1 ) = 1000.0;
+	VarSpeedCoil( 1 ).MSRatedTotCap( 2 ) = 2000.0;
+	VarSpeedCoil( 1 ).MSRatedTotCap( 3 ) = 3000.0;
+	VarSpeedCoil( 1 ).MSCCapFTemp = 1;
+	VarSpeedCoil( 1 ).InletAirDBTemp = 26.7;
+	VarSpeedCoil( 1 ).InletAirHumRat = 0.0111;
+	VarSpeedCoil( 1 ).InletWaterTemp = 20.0;
+
+	Array1D< Real64 > const & SpeedCapacity( GetVarSpeedCoilSpeedCapacities( 1 ) );
+	EXPECT_NEAR( 1200.0, SpeedCapacity( 1 ), 1.0e-9 );
+	EXPECT_NEAR( 2400.0, SpeedCapacity( 2 ), 1.0e-9 );
+	EXPECT_NEAR( 3600.0, SpeedCapacity( 3 ), 1.0e-9 );
+
+	EXPECT_EQ( 1, EstimateVarSpeedCoilSpeed( 1, 0.2 ) );
+	EXPECT_EQ( 2, EstimateVarSpeedCoilSpeed( 1, 0.5 ) );
+	EXPECT_EQ( 3, EstimateVarSpeedCoilSpeed( 1, 0.7 ) );
+	EXPECT_EQ( 3, EstimateVarSpeedCoilSpeed( 1, 1.5 ) );
+
+	// The capacities follow the inlet state
+	VarSpeedCoil( 1 ).InletWaterTemp = 30.0;
+	EXPECT_NEAR( 3900.0, GetVarSpeedCoilSpeedCapacities( 1 )( 3 ), 1.0e-9 );
+
+	VarSpeedCoil.deallocate();
+	NumWatertoAirHPs = 0;
+	PerfCurve.deallocate();
+	NumCurves = 0;
+	Psychrometrics::cached_Twb.deallocate();
+	Psychrometrics::cached_Psat.deallocate();
+}
@@ -75,3 +75,75 @@ TEST( WaterThermalTankData, GetDeadBandTemp )
 	EXPECT_DOUBLE_EQ( 11.0, thisTank.getDeadBandTemp() );
 
 }
+
+TEST( WaterThermalTankData, SolveStratifiedNodeBalance )
+{
+
+	ShowMessage( "Begin Test: WaterThermalTankData, SolveStratifiedNodeBalance" );
+	int const NumNodes( 3 );
+	Array1D< Real64 > SubDiag( NumNodes, { 0.0, -1.0, -2.0 } );
+	Array1D< Real64 > Diag( NumNodes, { 4.0, 5.0, 6.0 } );
+	Array1D< Real64 > SuperDiag( NumNodes, { -1.0, -2.0, 0.0 } );
+	Array1D< Real64 > Temp( NumNodes, { 50.0, 40.0, 30.0 } );
+
+	// Right-hand sides of the system for the temperatures above
+	Array1D< Real64 > Rhs( NumNodes );
+	Rhs( 1 ) = Diag( 1 ) * Temp( 1 ) + SuperDiag( 1 ) * Temp( 2 );
+	Rhs( 2 ) = SubDiag( 2 ) * Temp( 1 ) + Diag( 2 ) * Temp( 2 ) + SuperDiag( 2 ) * Temp( 3 );
+	Rhs( 3 ) = SubDiag( 3 ) * Temp( 2 ) + Diag( 3 ) * Temp( 3 );
+
+	WaterThermalTanks::SolveStratifiedNodeBalance( NumNodes, SubDiag, Diag, SuperDiag, Rhs );
+	EXPECT_NEAR( 50.0, Rhs( 1 ), 1.0e-10 );
+	EXPECT_NEAR( 40.0, Rhs( 2 ), 1.0e-10 );
+	EXPECT_NEAR( 30.0, Rhs( 3 ), 1.0e-10 );
+
+}
+
+TEST( WaterThermalTankData, MixStratifiedNodeInversions )
+{
+
+	ShowMessage( "Begin Test: WaterThermalTankData, MixStratifiedNodeInversions" );
+	using WaterThermalTanks::WaterThermalTank;
+	WaterThermalTank.allocate( 1 );
+	WaterThermalTank( 1 ).Nodes = 4;
+	WaterThermalTank( 1 ).Node.allocate( 4 );
+	for ( int NodeNum = 1; NodeNum <= 4; ++NodeNum ) {
+		WaterThermalTank( 1 ).Node( NodeNum ).Mass = 10.0;
+	}
+
+	// Stable stratification is left alone
+	WaterThermalTank( 1 ).Node( 1 ).NewTemp = 60.0;
+	WaterThermalTank( 1 ).Node( 2 ).NewTemp = 55.0;
+	WaterThermalTank( 1 ).Node( 3 ).NewTemp = 50.0;
+	WaterThermalTank( 1 ).Node( 4 ).NewTemp = 20.0;
+	WaterThermalTanks::MixStratifiedNodeInversions( 1 );
+	EXPECT_DOUBLE_EQ( 60.0, WaterThermalTank( 1 ).Node( 1 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 2 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 50.0, WaterThermalTank( 1 ).Node( 3 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 20.0, WaterThermalTank( 1 ).Node( 4 ).NewTemp );
+
+	// A warm node below colder ones mixes upward until the tank is stable, conserving energy
+	WaterThermalTank( 1 ).Node( 1 ).NewTemp = 60.0;
+	WaterThermalTank( 1 ).Node( 2 ).NewTemp = 40.0;
+	WaterThermalTank( 1 ).Node( 3 ).NewTemp = 45.0;
+	WaterThermalTank( 1 ).Node( 4 ).NewTemp = 80.0;
+	WaterThermalTanks::MixStratifiedNodeInversions( 1 );
+	EXPECT_DOUBLE_EQ( 60.0, WaterThermalTank( 1 ).Node( 1 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 2 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 3 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 4 ).NewTemp );
+
+	// Separate inversions mix separately
+	WaterThermalTank( 1 ).Node( 1 ).NewTemp = 50.0;
+	WaterThermalTank( 1 ).Node( 2 ).NewTemp = 60.0;
+	WaterThermalTank( 1 ).Node( 3 ).NewTemp = 30.0;
+	WaterThermalTank( 1 ).Node( 4 ).NewTemp = 40.0;
+	WaterThermalTanks::MixStratifiedNodeInversions( 1 );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 1 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 55.0, WaterThermalTank( 1 ).Node( 2 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 35.0, WaterThermalTank( 1 ).Node( 3 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 35.0, WaterThermalTank( 1 ).Node( 4 ).NewTemp );
+
+	WaterThermalTank.deallocate();
+
+}
@@ -0,0 +1,44 @@
+// EnergyPlus::WindowManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/WindowManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowManager;
+using namespace ObjexxFCL;
+
+TEST( WindowManagerTest, TriDiagonalSolutionMatchesLU )
+{
+	ShowMessage( "Begin Test: WindowManagerTest, TriDiagonalSolutionMatchesLU" );
+
+	// Double glazing with an interior shade: six faces coupled only to their neighbors
+	int const n( 6 );
+	Array2D< Real64 > Aface( 10, 10, 0.0 );
+	Array1D< Real64 > Bface( 10, 0.0 );
+	for ( int i = 1; i <= n; ++i ) {
+		Aface( i, i ) = 10.0 + i;
+		if ( i > 1 ) Aface( i - 1, i ) = -2.0 - 0.5 * i;
+		if ( i < n ) Aface( i + 1, i ) = -3.0 + 0.25 * i;
+		Bface( i ) = 100.0 * i - 250.0;
+	}
+
+	Array2D< Real64 > ALU( Aface );
+	Array1D< Real64 > BLU( Bface );
+	Array1D_int indx( 10 );
+	Real64 d;
+	LUdecomposition( ALU, n, indx, d );
+	LUsolution( ALU, n, indx, BLU );
+
+	TriDiagonalSolution( Aface, n, Bface );
+	for ( int i = 1; i <= n; ++i ) {
+		EXPECT_NEAR( BLU( i ), Bface( i ), 1.0e-10 );
+	}
+}
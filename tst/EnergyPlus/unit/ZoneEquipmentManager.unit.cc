@@ -0,0 +1,62 @@
+// EnergyPlus::ZoneEquipmentManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <EnergyPlus/ZoneEquipmentManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::ZoneEquipmentManager;
+using namespace ObjexxFCL;
+
+TEST( ZoneEquipmentManager, CalcZoneMixingFlowRateOfReceivingZone )
+{
+	ShowMessage( "Begin Test: ZoneEquipmentManager, CalcZoneMixingFlowRateOfReceivingZone" );
+
+	// zone 1 receives air from zone 2 through mixing objects 1 and 3 and from zone 3 through object 2
+	TotMixing = 3;
+	Mixing.allocate( TotMixing );
+	Mixing( 1 ).ZonePtr = 1;
+	Mixing( 1 ).FromZone = 2;
+	Mixing( 2 ).ZonePtr = 1;
+	Mixing( 2 ).FromZone = 3;
+	Mixing( 3 ).ZonePtr = 1;
+	Mixing( 3 ).FromZone = 2;
+
+	MassConservation.allocate( 3 );
+	MassConservation( 1 ).NumReceivingZonesMixingObject = 3;
+	MassConservation( 1 ).ZoneMixingReceivingPtr.allocate( 3 );
+	MassConservation( 1 ).ZoneMixingReceivingPtr( 1 ) = 1;
+	MassConservation( 1 ).ZoneMixingReceivingPtr( 2 ) = 2;
+	MassConservation( 1 ).ZoneMixingReceivingPtr( 3 ) = 3;
+	MassConservation( 1 ).ZoneMixingReceivingFr.allocate( 3 );
+	MassConservation( 1 ).ZoneMixingReceivingFr( 1 ) = 0.5;
+	MassConservation( 1 ).ZoneMixingReceivingFr( 2 ) = 0.3;
+	MassConservation( 1 ).ZoneMixingReceivingFr( 3 ) = 0.2;
+	MassConservation( 2 ).NumSourceZonesMixingObject = 2;
+	MassConservation( 2 ).ZoneMixingSourcesPtr.allocate( 2 );
+	MassConservation( 2 ).ZoneMixingSourcesPtr( 1 ) = 1;
+	MassConservation( 2 ).ZoneMixingSourcesPtr( 2 ) = 3;
+	MassConservation( 3 ).NumSourceZonesMixingObject = 1;
+	MassConservation( 3 ).ZoneMixingSourcesPtr.allocate( 1 );
+	MassConservation( 3 ).ZoneMixingSourcesPtr( 1 ) = 2;
+
+	Real64 ZoneMixingMassFlowRate( 2.0 );
+	CalcZoneMixingFlowRateOfReceivingZone( 1, ZoneMixingMassFlowRate );
+
+	EXPECT_DOUBLE_EQ( 1.0, Mixing( 1 ).MixingMassFlowRate );
+	EXPECT_DOUBLE_EQ( 0.6, Mixing( 2 ).MixingMassFlowRate );
+	EXPECT_DOUBLE_EQ( 0.4, Mixing( 3 ).MixingMassFlowRate );
+	EXPECT_DOUBLE_EQ( 2.0, ZoneMixingMassFlowRate );
+	EXPECT_DOUBLE_EQ( 2.0, MassConservation( 1 ).MixingMassFlowRate );
+	EXPECT_DOUBLE_EQ( 1.4, MassConservation( 2 ).MixingSourceMassFlowRate );
+	EXPECT_DOUBLE_EQ( 0.6, MassConservation( 3 ).MixingSourceMassFlowRate );
+
+	TotMixing = 0;
+	Mixing.deallocate();
+	MassConservation.deallocate();
+}
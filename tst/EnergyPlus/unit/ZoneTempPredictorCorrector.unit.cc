@@ -229,3 +229,77 @@ TEST( ZoneTempPredictorCorrector, CorrectZoneHumRatTest )
 	ZoneW1.deallocate();
 
 }
+
+TEST( ZoneTempPredictorCorrector, SetupZoneSumsIndexesTest )
+{
+	ShowMessage( "Begin Test: ZoneTempPredictorCorrector, SetupZoneSumsIndexesTest" );
+
+	// Zone 1 is controlled and has a wall, a shading surface and a window; zone 2 is a return plenum with a roof
+	NumOfZones = 2;
+	Zone.allocate( 2 );
+	Zone( 1 ).IsControlled = true;
+	Zone( 1 ).SurfaceFirst = 1;
+	Zone( 1 ).SurfaceLast = 3;
+	Zone( 2 ).IsControlled = false;
+	Zone( 2 ).SurfaceFirst = 4;
+	Zone( 2 ).SurfaceLast = 4;
+
+	Surface.allocate( 4 );
+	Surface( 1 ).HeatTransSurf = true;
+	Surface( 1 ).Class = SurfaceClass_Wall;
+	Surface( 1 ).Area = 10.0;
+	Surface( 2 ).HeatTransSurf = false;
+	Surface( 2 ).Class = SurfaceClass_Shading;
+	Surface( 3 ).HeatTransSurf = true;
+	Surface( 3 ).Class = SurfaceClass_Window;
+	Surface( 3 ).Area = 2.0;
+	Surface( 4 ).HeatTransSurf = true;
+	Surface( 4 ).Class = SurfaceClass_Roof;
+	Surface( 4 ).Area = 20.0;
+
+	ZoneEquipConfig.allocate( 2 );
+	ZoneEquipConfig( 1 ).ActualZoneNum = 1;
+	NumZoneReturnPlenums = 1;
+	ZoneRetPlenCond.allocate( 1 );
+	ZoneRetPlenCond( 1 ).ActualZoneNum = 2;
+	NumZoneSupplyPlenums = 0;
+
+	SetupZoneSumsIndexes();
+
+	EXPECT_EQ( 1, ZoneSumsEquipConfigNum( 1 ) );
+	EXPECT_EQ( 0, ZoneSumsEquipConfigNum( 2 ) );
+	EXPECT_EQ( 0, ZoneSumsRetPlenumNum( 1 ) );
+	EXPECT_EQ( 1, ZoneSumsRetPlenumNum( 2 ) );
+	EXPECT_EQ( 0, ZoneSumsSupPlenumNum( 2 ) );
+
+	// One opaque surface in each zone and one window in zone 1
+	EXPECT_EQ( 1, ZoneOpaqueConvSurfStart( 1 ) );
+	EXPECT_EQ( 2, ZoneOpaqueConvSurfStart( 2 ) );
+	EXPECT_EQ( 3, ZoneOpaqueConvSurfStart( 3 ) );
+	EXPECT_EQ( 1, ZoneOpaqueConvSurfs( 1 ) );
+	EXPECT_EQ( 4, ZoneOpaqueConvSurfs( 2 ) );
+	EXPECT_DOUBLE_EQ( 20.0, ZoneOpaqueConvSurfArea( 2 ) );
+	EXPECT_EQ( 1, ZoneWindowConvSurfStart( 1 ) );
+	EXPECT_EQ( 2, ZoneWindowConvSurfStart( 2 ) );
+	EXPECT_EQ( 2, ZoneWindowConvSurfStart( 3 ) );
+	EXPECT_EQ( 3, ZoneWindowConvSurfs( 1 ) );
+
+	// The zone equipment has not been simulated, so the lookups are rebuilt on the next call
+	EXPECT_FALSE( ZoneSumsIndexesSet );
+
+	ZoneSumsEquipConfigNum.deallocate();
+	ZoneSumsRetPlenumNum.deallocate();
+	ZoneSumsSupPlenumNum.deallocate();
+	ZoneOpaqueConvSurfStart.deallocate();
+	ZoneOpaqueConvSurfs.deallocate();
+	ZoneOpaqueConvSurfArea.deallocate();
+	ZoneWindowConvSurfStart.deallocate();
+	ZoneWindowConvSurfs.deallocate();
+	ZoneRetPlenCond.deallocate();
+	NumZoneReturnPlenums = 0;
+	ZoneEquipConfig.deallocate();
+	Surface.deallocate();
+	Zone.deallocate();
+	NumOfZones = 0;
+
+}